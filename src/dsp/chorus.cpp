@@ -15,21 +15,33 @@ void Chorus::reset()
     crossover.reset(processSpec.sampleRate, smoothing_time);
     crossover.setCurrentAndTargetValue(raw_crossover);
     write_position = 0;
+    control_rate.reset();
+    updateFilters();
+    wet_filters.rampToTargets(0);
+    bass_filter.rampToTargets(0);
+
+    wet_filters.reset();
+    bass_filter.reset();
+    lfo_left.reset();
+    lfo_right.reset();
+    delay_line.reset();
 }
 
 void Chorus::prepare(const juce::dsp::ProcessSpec& spec)
 {
     processSpec = spec;
+    control_rate.prepare(ControlRate::default_interval);
 
-    pre_hpf.prepare(spec);
-    bass_lpf.prepare(spec);
-    updateFilters();
-
-    pre_lpf.prepare(spec);
-    auto lpf_coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-        spec.sampleRate, pre_lpf_cutoff, 0.707f
+    wet_filters.setSection(
+        pre_lpf_section,
+        BiquadDesign::lowPass(spec.sampleRate, pre_lpf_cutoff, 0.707f)
+    );
+    wet_buffer.setSize(
+        (int)max_channels, (int)spec.maximumBlockSize, false, false, true
+    );
+    bass_buffer.setSize(
+        (int)max_channels, (int)spec.maximumBlockSize, false, false, true
     );
-    *pre_lpf.coefficients = *lpf_coefficients;
 
     lfo_right.prepare(spec);
     lfo_right.initialise([](float x) { return std::sin(x); });
@@ -47,19 +59,21 @@ void Chorus::prepare(const juce::dsp::ProcessSpec& spec)
     reset();
 }
 
+// Targets for the current crossover, reached by the next ramp
 void Chorus::updateFilters()
 {
     float current_crossover = crossover.getCurrentValue();
-    auto hpf_coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(
-        processSpec.sampleRate, current_crossover, 0.707f
-    );
-    *pre_hpf.coefficients = *hpf_coefficients;
-
-    auto bass_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
+    wet_filters.setSectionTarget(
+        pre_hpf_section,
+        BiquadDesign::highPass(
             processSpec.sampleRate, current_crossover, 0.707f
-        );
-    *bass_lpf.coefficients = *bass_lpf_coefficients;
+        )
+    );
+    bass_filter.setSectionTarget(
+        0, BiquadDesign::lowPass(
+               processSpec.sampleRate, current_crossover, 0.707f
+           )
+    );
 }
 
 void Chorus::process(const juce::dsp::ProcessContextReplacing<float>& context)
@@ -71,21 +85,79 @@ void Chorus::process(const juce::dsp::ProcessContextReplacing<float>& context)
     auto* left = block.getChannelPointer(0);
     auto* right = block.getChannelPointer(1);
 
-    if (crossover.isSmoothing())
+    // The crossover filters glide to new coefficients over each control
+    // interval
+    control_rate.process(
+        num_samples, crossover.isSmoothing(),
+        [this] {
+            const size_t interval = control_rate.getInterval();
+            crossover.skip((int)interval);
+            updateFilters();
+            wet_filters.rampToTargets(interval);
+            bass_filter.rampToTargets(interval);
+        },
+        [&](size_t start, size_t length) {
+            filterInputs(left, right, start, length);
+            processSamples(left, right, start, start + length, sample_rate);
+        }
+    );
+}
+
+// Splits the inputs of [start, start + length) into the wet and bass
+// buffers, from their first sample
+void Chorus::filterInputs(
+    const float* left, const float* right, size_t start, size_t length
+)
+{
+    jassert(length <= (size_t)wet_buffer.getNumSamples());
+    const size_t num_inputs = dual_mono ? 2 : 1;
+    const float* inputs[max_channels] = {left, right};
+    for (size_t channel = 0; channel < num_inputs; ++channel)
     {
-        updateFilters();
-        crossover.skip((int)num_samples);
+        juce::FloatVectorOperations::copy(
+            wet_buffer.getWritePointer((int)channel), inputs[channel] + start,
+            (int)length
+        );
+        juce::FloatVectorOperations::copy(
+            bass_buffer.getWritePointer((int)channel), inputs[channel] + start,
+            (int)length
+        );
     }
 
-    for (size_t i = 0; i < num_samples; ++i)
+    auto wet_block = juce::dsp::AudioBlock<float>(wet_buffer)
+                         .getSubsetChannelBlock(0, num_inputs)
+                         .getSubBlock(0, length);
+    auto bass_block = juce::dsp::AudioBlock<float>(bass_buffer)
+                          .getSubsetChannelBlock(0, num_inputs)
+                          .getSubBlock(0, length);
+    using Context = juce::dsp::ProcessContextReplacing<float>;
+    wet_filters.process(Context(wet_block));
+    bass_filter.process(Context(bass_block));
+}
+
+void Chorus::processSamples(
+    float* left, float* right, size_t start, size_t end, float sample_rate
+)
+{
+    // Filtered by filterInputs(), from the start of the chunk
+    const int right_channel = dual_mono ? 1 : 0;
+    const float* wet_left = wet_buffer.getReadPointer(0);
+    const float* bass_left = bass_buffer.getReadPointer(0);
+    const float* wet_right = wet_buffer.getReadPointer(right_channel);
+    const float* bass_right = bass_buffer.getReadPointer(right_channel);
+
+    for (size_t i = start; i < end; ++i)
     {
         float current_mix = mix.getNextValue();
         float current_depth = depth.getNextValue() / 1000.0f;
 
         float input_sample = left[i];
-        float filtered =
-            pre_lpf.processSample(pre_hpf.processSample(input_sample));
-        float bass = bass_lpf.processSample(input_sample);
+        float filtered = wet_left[i - start];
+        float bass = bass_left[i - start];
+
+        float input_right = dual_mono ? right[i] : input_sample;
+        float filtered_right = wet_right[i - start];
+        float bass_right_value = bass_right[i - start];
 
         float lval = lfo_left.processSample(0.0f);
         float rval = lfo_right.processSample(0.0f);
@@ -97,13 +169,13 @@ void Chorus::process(const juce::dsp::ProcessContextReplacing<float>& context)
         float rvalue = delay_line.popSample(1, ldelay * sample_rate, true);
 
         delay_line.pushSample(0, filtered);
-        delay_line.pushSample(1, filtered);
+        delay_line.pushSample(1, filtered_right);
 
         left[i] =
             (input_sample * (1.0f - current_mix) +
              (bass + lvalue) * current_mix);
         right[i] =
-            (input_sample * (1.0f - current_mix) +
-             (bass + rvalue) * current_mix);
+            (input_right * (1.0f - current_mix) +
+             (bass_right_value + rvalue) * current_mix);
     }
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "control_rate.h"
+#include "filters/biquad_cascade.h"
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
 
@@ -12,6 +14,16 @@ class Chorus : juce::dsp::ProcessorBase
     ) override;
     void reset() override;
     void updateFilters();
+    void filterInputs(
+        const float* left, const float* right, size_t start, size_t length
+    );
+    void processSamples(
+        float* left, float* right, size_t start, size_t end, float sample_rate
+    );
+    double getTailLengthSeconds() const
+    {
+        return max_delay_time;
+    }
 
     void setMix(float newMix)
     {
@@ -33,6 +45,12 @@ class Chorus : juce::dsp::ProcessorBase
         depth.setTargetValue(v);
         raw_depth = v;
     }
+    // In dual mono each channel is its own input, otherwise the left
+    // channel feeds both sides
+    void setDualMono(bool should_use_dual_mono)
+    {
+        dual_mono = should_use_dual_mono;
+    }
     void setCrossover(float new_crossover)
     {
         float v = juce::jlimit(50.0f, 10000.0f, new_crossover);
@@ -52,10 +70,23 @@ class Chorus : juce::dsp::ProcessorBase
         float, juce::dsp::DelayLineInterpolationTypes::Lagrange3rd>
         delay_line;
 
-    juce::dsp::IIR::Filter<float> pre_hpf;
-    juce::dsp::IIR::Filter<float> bass_lpf;
-    juce::dsp::IIR::Filter<float> pre_lpf;
+    // The delay line is fed the band above the crossover, low passed at
+    // pre_lpf_cutoff, and the band below it is added back dry. Both are
+    // filtered a chunk at a time into the buffers below, the right channel
+    // only in dual mono.
+    enum WetSection
+    {
+        pre_hpf_section,
+        pre_lpf_section,
+        num_wet_sections
+    };
+    static constexpr size_t max_channels = 2;
+    BiquadCascade<num_wet_sections, max_channels> wet_filters;
+    BiquadCascade<1, max_channels> bass_filter;
+    juce::AudioBuffer<float> wet_buffer, bass_buffer;
     float pre_lpf_cutoff = 5000.0f;
+    bool dual_mono = false;
+    ControlRate control_rate;
 
     float base_delay_time = 7e-3f;
     float max_delay_time = 5e-2f;
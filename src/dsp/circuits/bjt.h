@@ -1,13 +1,13 @@
 #pragma once
-#include "../maths/omega.h"
+#include "memoryless_circuit.h"
 #include <cmath>
 
-class BJT
+class BJT : public MemorylessCircuit<BJT>
 {
   public:
     BJT() {}
-    float processSample(float);
-    float omega(float);
+    template <typename B>
+    typename B::Float processBatch(typename B::Float s) const;
 
   private:
     // Fixed variables
@@ -19,37 +19,23 @@ class BJT
     float k = std::log((i_s * re / vt) * (1 + 1 / beta_f));
 };
 
-inline float BJT::omega(float x)
+// Above the supply the transistor saturates, vin is held at vp
+template <typename B>
+inline typename B::Float BJT::processBatch(typename B::Float s) const
 {
-    if (std::abs(x) > 1.5f)
-    {
-        return omega4(x);
-    }
-    else
-    {
-        float c0 = 0.5671432904097838f;
-        float c1 = 0.3618963236098023f;
-        float c2 = 0.0736778463779836f;
-        float c3 = -0.0013437346889135f;
-        float c4 = -0.0016355437889344f;
-        float c5 = 0.0002166542734346f;
-
-        return c0 + c1 * x + c2 * std::pow(x, 2.0f) + c3 * std::pow(x, 3.0f) +
-               c4 * std::pow(x, 4.0f) + c5 * std::pow(x, 5.0f);
-    }
-}
-
-inline float BJT::processSample(float s)
-{
-    float vref = vp / 2;
-    float vin = s + vref;
-    if (vin >= vp)
-    {
-        float v_x = i_s * re * (1 + 1 / beta_f);
-        float v_out = vt * omega(((vp + v_x) / vt) + k) - v_x;
-        return v_out - vref;
-    }
-    float v_x = i_s * re * (std::exp((vin - vp) / vt) + 1 / beta_f);
-    float v_out = vt * omega(((vin + v_x) / vt) + k) - v_x;
-    return v_out - vref;
+    const float vref = vp / 2;
+    const auto inverse_vt = B::set(1.0f / vt);
+    auto vin = B::min(B::add(s, B::set(vref)), B::set(vp));
+    auto v_x = B::mul(
+        B::set(i_s * re),
+        B::add(
+            FastMath::exp<B>(B::mul(B::sub(vin, B::set(vp)), inverse_vt)),
+            B::set(1 / beta_f)
+        )
+    );
+    auto in_omega = B::add(B::mul(B::add(vin, v_x), inverse_vt), B::set(k));
+    auto v_out = B::sub(
+        B::mul(B::set(vt), FastMath::wrightOmega<B>(in_omega)), v_x
+    );
+    return B::sub(v_out, B::set(vref));
 }
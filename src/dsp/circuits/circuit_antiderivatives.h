@@ -0,0 +1,116 @@
+#pragma once
+
+#include "../maths/antiderivative_table.h"
+#include "../shared_resources.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <juce_dsp/juce_dsp.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ADAA of a MemorylessCircuit whose curve depends on the sample rate, like
+// the diode clippers, so that it cannot be built into the binary the way
+// the CMOS tables are. prepare() samples the circuit on a uniform grid and
+// integrates it twice with AntiderivativeTable::integrate, and every
+// instance at the same rate shares the result through SharedResources.
+// The ADAA filters are then those of CMOS.
+class CircuitAntiderivatives
+{
+  public:
+    // Channels with their own ADAA history
+    static constexpr size_t max_channels = 2;
+
+    // The curve is held at its ends beyond max_input. The key names the
+    // circuit and its range, unique across modules.
+    template <typename Circuit>
+    void prepare(
+        const Circuit& circuit, const std::string& key, double sample_rate,
+        float max_input, size_t num_points
+    )
+    {
+        tables = SharedResources::get<Tables>(key, sample_rate, [&] {
+            Tables result;
+            result.values.resize(num_points);
+            result.f1.resize(num_points);
+            result.f2.resize(num_points);
+            const float step = 2.0f * max_input / (float)(num_points - 1);
+            for (size_t i = 0; i < num_points; ++i)
+                result.values[i] =
+                    circuit.processSample(-max_input + step * (float)i);
+            AntiderivativeTable::integrate(
+                result.values.data(), num_points, -max_input, max_input,
+                result.f1.data(), result.f2.data()
+            );
+            return result;
+        });
+        antiderivatives.initialise(
+            tables->values.data(), tables->f1.data(), tables->f2.data(),
+            tables->values.size(), -max_input, max_input
+        );
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& state : adaa_states)
+            antiderivatives.reset(state);
+    }
+
+    // 1 or 2 for first or second order, 0 leaves the curve to the circuit
+    void setAdaaOrder(int order)
+    {
+        order = std::clamp(order, 0, 2);
+        if (order != adaa_order)
+        {
+            adaa_order = order;
+            reset();
+        }
+    }
+    int getAdaaOrder() const
+    {
+        return adaa_order;
+    }
+
+    // In place, half a sample late at first order and one at second order
+    void process(size_t channel, float* samples, size_t num_samples)
+    {
+        jassert(adaa_order > 0 && channel < max_channels);
+        if (adaa_order == 1)
+            antiderivatives.processFirstOrder(
+                adaa_states[channel], samples, num_samples
+            );
+        else
+            antiderivatives.processSecondOrder(
+                adaa_states[channel], samples, num_samples
+            );
+    }
+
+    // Both channels at once, see AntiderivativeTable
+    void processPair(float* left, float* right, size_t num_samples)
+    {
+        jassert(adaa_order > 0);
+        if (adaa_order == 1)
+            antiderivatives.processFirstOrder(
+                adaa_states[0], adaa_states[1], left, right, num_samples
+            );
+        else
+            antiderivatives.processSecondOrder(
+                adaa_states[0], adaa_states[1], left, right, num_samples
+            );
+    }
+
+  private:
+    struct Tables
+    {
+        std::vector<float> values;
+        std::vector<double> f1;
+        std::vector<double> f2;
+    };
+    std::shared_ptr<const Tables> tables;
+
+    AntiderivativeTable antiderivatives;
+    std::array<AntiderivativeTable::State, max_channels> adaa_states;
+    int adaa_order = 0;
+};
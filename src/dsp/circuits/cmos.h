@@ -1,156 +1,86 @@
 #pragma once
 
-#include "../maths/lookup_table_transform_cubic.h"
+#include "../maths/antiderivative_table.h"
+#include "../maths/lookup_table_simd.h"
+#include "cmos_model.h"
+#include "cmos_table.h"
 #include <algorithm>
 #include <array>
-#include <cfloat>
 #include <juce_dsp/juce_dsp.h>
-#include <utility>
 
+// Table of CmosModel::waveshaper and its antiderivatives, generated ahead of
+// time and shared by every instance. The plain curve stays on the SIMD linear
+// table: the minimax fit in CmosTable is more accurate but slower, see
+// orbital-bench's cmos_polynomial case.
 class CMOS
 {
   public:
     CMOS()
     {
+        using namespace CmosModel;
+        lut = LookupTableSimd::Table::make(
+            CmosTable::values, nullptr, table_size, min_input, max_input
+        );
+        antiderivatives.initialise(
+            CmosTable::values, CmosTable::f1, CmosTable::f2, table_size,
+            min_input, max_input
+        );
+        reset();
     }
     void reset()
     {
+        for (auto& state : adaa_states)
+            antiderivatives.reset(state);
     }
 
-    std::pair<float, float> pmos(float, float);
-    std::pair<float, float> nmos(float, float);
+    // 0 for the plain table lookup, 1 or 2 for first or second order
+    // antiderivative anti-aliasing
+    void setAdaaOrder(int order)
+    {
+        order = std::clamp(order, 0, 2);
+        if (order != adaa_order)
+        {
+            adaa_order = order;
+            reset();
+        }
+    }
+
+    // Channels with their own ADAA history
+    static constexpr size_t max_channels = 2;
 
-    float waveshaper_cmos(float);
     float hermite(float y0, float y1, float d0, float d1, float t);
 
     void prepare();
     float processSample(float);
 
-    void processBlock(juce::AudioBuffer<float>& buffer, int numSamples);
+    // Plain table lookup over a block, without ADAA. in and out may be the
+    // same buffer.
+    void processBlock(const float* in, float* out, size_t num_samples) const
+    {
+        LookupTableSimd::processLinear(lut, in, out, num_samples);
+    }
     void process(const juce::dsp::ProcessContextReplacing<float>& context);
 
   private:
-    juce::dsp::LookupTableTransform<float> lut;
-    // LookupTableTransformCubic<float> lut;
-    static constexpr int lut_size = 8192;
-    static constexpr float lut_min = -1.8f;
-    static constexpr float lut_max = 5.1f;
-
-    static constexpr float n_vtc1 = 1.208306917691355f;
-    static constexpr float n_vtc2 = 0.3139084341943607f;
-    static constexpr float n_alpha1 = 0.020662094888127674f;
-    static constexpr float n_alpha2 = -0.0017181795239085821f;
-
-    static constexpr float p_vtc1 = -0.25610349392710086f;
-    static constexpr float p_vtc2 = 0.27051216771368214f;
-    static constexpr float p_alpha1 = -0.0003577445606469842f;
-    static constexpr float p_alpha2 = -0.0008620153809796321f;
-    static constexpr float p_alpha3 = -0.00016848836814836602f;
-    static constexpr float p_alpha4 = -1.0800821774906936e-5f;
-
-    static constexpr float bias = 3.45f;
-    static constexpr float v_dd = 9.0f;
-    static constexpr float delta = 0.06f;
-
-    static constexpr float NR_EPSILON = FLT_MIN;
+    // Linearly interpolated view of CmosTable::values, evaluated a SIMD
+    // batch at a time by process()
+    LookupTableSimd::Table lut;
+
+    // F1 and F2 of the same table for ADAA
+    AntiderivativeTable antiderivatives;
+    std::array<AntiderivativeTable::State, max_channels> adaa_states;
+    int adaa_order = 0;
 };
 
-inline std::pair<float, float> CMOS::nmos(float vgs, float vds)
-{
-    float vt = n_vtc2 * vgs + n_vtc1;
-    float alpha = n_alpha2 * vgs + n_alpha1;
-    float vgs_minus_vt = vgs - vt;
-
-    // 1. Triode Region
-    float ids_tri = alpha * (vgs_minus_vt - vds * 0.5f) * vds;
-    float gds_tri = alpha * (vgs_minus_vt - vds);
-
-    // 2. Saturation Region
-    float vgs_vt_sq = vgs_minus_vt * vgs_minus_vt;
-    float ids_sat = 0.5f * alpha * vgs_vt_sq;
-    float gds_sat = 0.0f;
-
-    // --- Selection ---
-    bool is_triode = (vds <= vgs_minus_vt);
-    float ids_tri_or_sat = is_triode ? ids_tri : ids_sat;
-    float gds_tri_or_sat = is_triode ? gds_tri : gds_sat;
-
-    bool is_cutoff = (vgs_minus_vt <= 0.0f);
-    float ids = is_cutoff ? 0.0f : ids_tri_or_sat;
-    float gds = is_cutoff ? 0.0f : gds_tri_or_sat;
-
-    return {ids, gds};
-}
-
-inline std::pair<float, float> CMOS::pmos(float vgs, float vds)
-{
-    float alpha =
-        p_alpha1 + vgs * (p_alpha2 + vgs * (p_alpha3 + vgs * p_alpha4));
-    float vt = p_vtc1 + p_vtc2 * vgs;
-    float vgs_minus_vt = vgs - vt;
-
-    // 1. Triode Region
-    float vds_factor = (1.0f - delta * vds);
-    float ids_tri = -alpha * (vgs_minus_vt - vds * 0.5f) * vds * vds_factor;
-    float gds_tri =
-        -alpha * (1.5f * delta * vds * vds -
-                  (2.0f * delta * vgs_minus_vt + 1.0f) * vds + vgs_minus_vt);
-
-    // 2. Saturation Region
-    float vgs_vt_sq = vgs_minus_vt * vgs_minus_vt;
-    float ids_sat = -0.5f * alpha * vgs_vt_sq * vds_factor;
-    float gds_sat = 0.5f * alpha * delta * vgs_vt_sq;
-
-    // --- Selection ---
-    bool is_triode = (vds >= vgs_minus_vt);
-    float ids_tri_or_sat = is_triode ? ids_tri : ids_sat;
-    float gds_tri_or_sat = is_triode ? gds_tri : gds_sat;
-
-    bool is_cutoff = (vgs >= vt);
-    float ids = is_cutoff ? 0.0f : ids_tri_or_sat;
-    float gds = is_cutoff ? 0.0f : gds_tri_or_sat;
-
-    return {ids, gds};
-}
-
-inline float CMOS::waveshaper_cmos(float x)
-{
-    float vin = x + bias;
-    float vout = bias;
-
-    for (int i = 0; i < 5; i++)
-    {
-        float vgs_n = vin;
-        float vds_n = vout;
-
-        float vgs_p = vin - v_dd;
-        float vds_p = vout - v_dd;
-
-        auto [ids_n, gds_n] = nmos(vgs_n, vds_n);
-        auto [ids_p, gds_p] = pmos(vgs_p, vds_p);
-
-        float f_x = ids_n + ids_p;
-
-        float f_prime_x = gds_n + gds_p;
-
-        vout = vout - f_x / (f_prime_x + NR_EPSILON);
-
-        vout = std::clamp(vout, 0.0f, v_dd);
-    }
-    return 1.0f - 2.0f * vout / v_dd;
-}
-
+// The tables are built into the binary, nothing to compute here
 inline void CMOS::prepare()
 {
-    lut.initialise(
-        [this](float x) { return waveshaper_cmos(x); }, lut_min, lut_max,
-        lut_size
-    );
+    reset();
 }
 
 inline float CMOS::processSample(float x)
 {
-    return lut.processSample(x);
+    return LookupTableSimd::processLinear(lut, x);
 }
 
 inline void CMOS::process(
@@ -160,9 +90,36 @@ inline void CMOS::process(
     auto& block = context.getOutputBlock();
     const size_t num_samples = block.getNumSamples();
 
-    auto* ch = block.getChannelPointer(0);
-    for (size_t i = 0; i < num_samples; ++i)
+    // Dual mono runs both ADAA histories in the lanes of one register
+    size_t first_channel = 0;
+    if (adaa_order > 0 && block.getNumChannels() >= 2)
+    {
+        auto* left = block.getChannelPointer(0);
+        auto* right = block.getChannelPointer(1);
+        if (adaa_order == 1)
+            antiderivatives.processFirstOrder(
+                adaa_states[0], adaa_states[1], left, right, num_samples
+            );
+        else
+            antiderivatives.processSecondOrder(
+                adaa_states[0], adaa_states[1], left, right, num_samples
+            );
+        first_channel = 2;
+    }
+
+    for (size_t channel = first_channel; channel < block.getNumChannels();
+         ++channel)
     {
-        ch[i] = processSample(ch[i]);
+        auto* ch = block.getChannelPointer(channel);
+        if (adaa_order == 0 || channel >= max_channels)
+            LookupTableSimd::processLinear(lut, ch, ch, num_samples);
+        else if (adaa_order == 1)
+            antiderivatives.processFirstOrder(
+                adaa_states[channel], ch, num_samples
+            );
+        else
+            antiderivatives.processSecondOrder(
+                adaa_states[channel], ch, num_samples
+            );
     }
 }
@@ -1,13 +1,13 @@
 #pragma once
 
-#include "../maths/omega.h"
+#include "memoryless_circuit.h"
 #include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <juce_dsp/juce_dsp.h>
 #include <utility>
 
-class CMOS2
+class CMOS2 : public MemorylessCircuit<CMOS2>
 {
   public:
     CMOS2()
@@ -17,8 +17,8 @@ class CMOS2
     {
     }
 
-    float omega(float);
-    float processSample(float);
+    template <typename B>
+    typename B::Float processBatch(typename B::Float x) const;
 
   private:
     // static constexpr float s1_p = 0.04f;
@@ -32,31 +32,21 @@ class CMOS2
     static constexpr float s2_m = 0.1f;
 };
 
-inline float CMOS2::omega(float x)
+template <typename B>
+inline typename B::Float CMOS2::processBatch(typename B::Float x) const
 {
-    if (std::abs(x) > 1.5f)
-    {
-        return omega4(x);
-    }
-    else
-    {
-        float c0 = 0.5671432904097838f;
-        float c1 = 0.3618963236098023f;
-        float c2 = 0.0736778463779836f;
-        float c3 = -0.0013437346889135f;
-        float c4 = -0.0016355437889344f;
-        float c5 = 0.0002166542734346f;
-
-        return c0 + c1 * x + c2 * std::pow(x, 2.0f) + c3 * std::pow(x, 3.0f) +
-               c4 * std::pow(x, 4.0f) + c5 * std::pow(x, 5.0f);
-    }
-}
-
-inline float CMOS2::processSample(float x)
-{
-    float sign = (x >= 0.0f) ? 1.0f : -1.0f;
-    float s1 = (sign > 0.0f) ? s1_p : s1_m;
-    float s2 = (sign > 0.0f) ? s2_p : s2_m;
-    return sign *
-           (1.0f - 2.0f / (1.0f + sign * x / s1 + omega(1.0f + sign * x / s2)));
+    auto is_negative = B::less(x, B::set(0.0f));
+    auto inverse_s1 =
+        B::select(is_negative, B::set(1.0f / s1_m), B::set(1.0f / s1_p));
+    auto inverse_s2 =
+        B::select(is_negative, B::set(1.0f / s2_m), B::set(1.0f / s2_p));
+    // sign * x
+    auto x_abs = FastMath::abs<B>(x);
+    auto omega = FastMath::wrightOmega<B>(
+        B::add(B::set(1.0f), B::mul(x_abs, inverse_s2))
+    );
+    auto denominator =
+        B::add(B::add(B::set(1.0f), B::mul(x_abs, inverse_s1)), omega);
+    auto y = B::sub(B::set(1.0f), B::div(B::set(2.0f), denominator));
+    return B::select(is_negative, B::sub(B::set(0.0f), y), y);
 }
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <cfloat>
+#include <cstddef>
+#include <utility>
+
+// Transfer curve of the CMOS inverter, without any JUCE dependency so a
+// host tool can tabulate it ahead of time (see tools/generate_cmos_table.cpp).
+// CMOS only reads the resulting table. The float instantiation is the curve
+// of the table, the double one serves as the reference of the fits.
+namespace CmosModel
+{
+
+// Table of waveshaper() over [min_input, max_input]
+inline constexpr size_t table_size = 8192;
+inline constexpr float min_input = -1.8f;
+inline constexpr float max_input = 5.1f;
+
+inline constexpr float n_vtc1 = 1.208306917691355f;
+inline constexpr float n_vtc2 = 0.3139084341943607f;
+inline constexpr float n_alpha1 = 0.020662094888127674f;
+inline constexpr float n_alpha2 = -0.0017181795239085821f;
+
+inline constexpr float p_vtc1 = -0.25610349392710086f;
+inline constexpr float p_vtc2 = 0.27051216771368214f;
+inline constexpr float p_alpha1 = -0.0003577445606469842f;
+inline constexpr float p_alpha2 = -0.0008620153809796321f;
+inline constexpr float p_alpha3 = -0.00016848836814836602f;
+inline constexpr float p_alpha4 = -1.0800821774906936e-5f;
+
+inline constexpr float bias = 3.45f;
+inline constexpr float v_dd = 9.0f;
+inline constexpr float delta = 0.06f;
+
+inline constexpr float NR_EPSILON = FLT_MIN;
+
+template <typename T>
+inline std::pair<T, T> nmos(T vgs, T vds)
+{
+    T vt = n_vtc2 * vgs + n_vtc1;
+    T alpha = n_alpha2 * vgs + n_alpha1;
+    T vgs_minus_vt = vgs - vt;
+
+    // 1. Triode Region
+    T ids_tri = alpha * (vgs_minus_vt - vds * T(0.5)) * vds;
+    T gds_tri = alpha * (vgs_minus_vt - vds);
+
+    // 2. Saturation Region
+    T vgs_vt_sq = vgs_minus_vt * vgs_minus_vt;
+    T ids_sat = T(0.5) * alpha * vgs_vt_sq;
+    T gds_sat = T(0);
+
+    // --- Selection ---
+    bool is_triode = (vds <= vgs_minus_vt);
+    T ids_tri_or_sat = is_triode ? ids_tri : ids_sat;
+    T gds_tri_or_sat = is_triode ? gds_tri : gds_sat;
+
+    bool is_cutoff = (vgs_minus_vt <= T(0));
+    T ids = is_cutoff ? T(0) : ids_tri_or_sat;
+    T gds = is_cutoff ? T(0) : gds_tri_or_sat;
+
+    return {ids, gds};
+}
+
+template <typename T>
+inline std::pair<T, T> pmos(T vgs, T vds)
+{
+    T alpha = p_alpha1 + vgs * (p_alpha2 + vgs * (p_alpha3 + vgs * p_alpha4));
+    T vt = p_vtc1 + p_vtc2 * vgs;
+    T vgs_minus_vt = vgs - vt;
+
+    // 1. Triode Region
+    T vds_factor = (T(1) - delta * vds);
+    T ids_tri = -alpha * (vgs_minus_vt - vds * T(0.5)) * vds * vds_factor;
+    T gds_tri =
+        -alpha * (T(1.5) * delta * vds * vds -
+                  (T(2) * delta * vgs_minus_vt + T(1)) * vds + vgs_minus_vt);
+
+    // 2. Saturation Region
+    T vgs_vt_sq = vgs_minus_vt * vgs_minus_vt;
+    T ids_sat = -T(0.5) * alpha * vgs_vt_sq * vds_factor;
+    T gds_sat = T(0.5) * alpha * delta * vgs_vt_sq;
+
+    // --- Selection ---
+    bool is_triode = (vds >= vgs_minus_vt);
+    T ids_tri_or_sat = is_triode ? ids_tri : ids_sat;
+    T gds_tri_or_sat = is_triode ? gds_tri : gds_sat;
+
+    bool is_cutoff = (vgs >= vt);
+    T ids = is_cutoff ? T(0) : ids_tri_or_sat;
+    T gds = is_cutoff ? T(0) : gds_tri_or_sat;
+
+    return {ids, gds};
+}
+
+template <typename T>
+inline T waveshaper(T x)
+{
+    T vin = x + bias;
+    T vout = bias;
+
+    for (int i = 0; i < 5; i++)
+    {
+        T vgs_n = vin;
+        T vds_n = vout;
+
+        T vgs_p = vin - v_dd;
+        T vds_p = vout - v_dd;
+
+        auto [ids_n, gds_n] = nmos(vgs_n, vds_n);
+        auto [ids_p, gds_p] = pmos(vgs_p, vds_p);
+
+        T f_x = ids_n + ids_p;
+
+        T f_prime_x = gds_n + gds_p;
+
+        vout = vout - f_x / (f_prime_x + NR_EPSILON);
+
+        vout = std::clamp(vout, T(0), T(v_dd));
+    }
+    return T(1) - T(2) * vout / v_dd;
+}
+
+// Input of table entry i
+inline float tableInput(size_t i)
+{
+    return min_input +
+           (max_input - min_input) * (float)i / (float)(table_size - 1);
+}
+
+} // namespace CmosModel
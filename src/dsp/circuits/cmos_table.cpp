@@ -0,0 +1,27041 @@
+// Generated by orbital-generate-cmos-table, do not edit
+
+#include <cstddef>
+
+namespace CmosTable
+{
+
+extern const size_t num_cells = 256;
+
+extern const float cells[1024] = {
+    0x0p+0f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1p+2f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1p+3f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8p+3f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1p+4f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4p+4f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8p+4f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.cp+4f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1p+5f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2p+5f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4p+5f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6p+5f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8p+5f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ap+5f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.cp+5f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ep+5f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.7p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.9p+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ap+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.bp+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.cp+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.dp+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ep+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.fp+6f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.08p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.18p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.28p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.38p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.48p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.58p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.68p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.7p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.78p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.88p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.9p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.98p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ap+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.a8p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.bp+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.b8p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.cp+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.c8p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.dp+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.d8p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ep+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.e8p+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.fp+7f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.f8p+7f,
+    0x1p+1f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.04p+8f,
+    0x1p+2f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.14p+8f,
+    0x1p+4f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.54p+8f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.58p+8f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5cp+8f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6p+8f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.64p+8f,
+    0x1p+6f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.32p+9f,
+    0x1p+4f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.52p+9f,
+    0x1p+1f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.56p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.58p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5ap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5cp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5ep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.62p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.64p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.66p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.68p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6ap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6cp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6ep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.7p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.72p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.74p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.76p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.78p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.7ap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.7cp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.7ep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.82p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.84p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.86p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.88p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8ap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8cp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.8ep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.9p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.92p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.94p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.96p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.98p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.9ap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.9cp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.9ep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.a2p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.a4p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.a6p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.a8p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.aap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.acp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.aep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.bp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.b2p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.b4p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.b6p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.b8p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.bap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.bcp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.bep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.cp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.c2p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.c4p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.c6p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.c8p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.cap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ccp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.cep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.dp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.d2p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.d4p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.d6p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.d8p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.dap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.dcp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.dep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.e2p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.e4p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.e6p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.e8p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.eap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.ecp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.eep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.fp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.f2p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.f4p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.f6p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.f8p+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.fap+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.fcp+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.fep+9f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.01p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.02p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.03p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.04p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.05p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.06p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.07p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.08p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.09p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.0ap+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.0bp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.0cp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.0dp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.0ep+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.0fp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.11p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.12p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.13p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.14p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.15p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.16p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.17p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.18p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.19p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1ap+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1bp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1cp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1dp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1ep+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.1fp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.21p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.22p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.23p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.24p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.25p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.26p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.27p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.28p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.29p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2ap+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2bp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2cp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2dp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2ep+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.2fp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.31p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.32p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.33p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.34p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.35p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.36p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.37p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.38p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.39p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3ap+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3bp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3cp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3dp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3ep+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.3fp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.41p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.42p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.43p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.44p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.45p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.46p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.47p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.48p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.49p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4ap+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4bp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4cp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4dp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4ep+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.4fp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.51p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.52p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.53p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.54p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.55p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.56p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.57p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.58p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.59p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5ap+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5bp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5cp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5dp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5ep+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.5fp+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.6p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x1.61p+10f,
+    0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+};
+
+extern const float subcells[1416] = {
+    -0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    -0x0p+0f,
+    -0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    -0x0p+0f,
+    -0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    -0x1p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    0x0p+0f,
+    -0x1.fffddp-1f,
+    0x1.75e2cep-14f,
+    0x1.e13552p-14f,
+    0x1.c7eaccp-21f,
+    -0x1.ffe2fcp-1f,
+    0x1.50bf3cp-12f,
+    0x1.ebe4d2p-14f,
+    0x1.c7eaccp-21f,
+    -0x1.ffa968p-1f,
+    0x1.24aec2p-11f,
+    0x1.f69452p-14f,
+    0x1.c7eaccp-21f,
+    -0x1.ff506ap-1f,
+    0x1.a3a9c8p-11f,
+    0x1.00a1eap-13f,
+    0x1.c7eaccp-21f,
+    -0x1.fed7bap-1f,
+    0x1.11354ap-10f,
+    0x1.00099cp-13f,
+    0x1.0973b6p-21f,
+    -0x1.fe3f0ep-1f,
+    0x1.519b3cp-10f,
+    0x1.0325f8p-13f,
+    0x1.0973b6p-21f,
+    -0x1.fd85fcp-1f,
+    0x1.92c846p-10f,
+    0x1.064252p-13f,
+    0x1.0973b6p-21f,
+    -0x1.fcac24p-1f,
+    0x1.d4bc66p-10f,
+    0x1.095eaep-13f,
+    0x1.0973b6p-21f,
+    -0x1.fbb12p-1f,
+    0x1.0bbbcep-9f,
+    0x1.0c7b0ap-13f,
+    0x1.0973b6p-21f,
+    -0x1.fa948cp-1f,
+    0x1.2d7cf6p-9f,
+    0x1.0f9764p-13f,
+    0x1.0973b6p-21f,
+    -0x1.f95604p-1f,
+    0x1.4fa1a8p-9f,
+    0x1.12b3cp-13f,
+    0x1.0973b6p-21f,
+    -0x1.f7f526p-1f,
+    0x1.7229e4p-9f,
+    0x1.15d01ap-13f,
+    0x1.0973b6p-21f,
+    -0x1.f67184p-1f,
+    0x1.95328ap-9f,
+    0x1.18b248p-13f,
+    0x1.4d79cap-21f,
+    -0x1.f4cab2p-1f,
+    0x1.b8875ap-9f,
+    0x1.1c9ab6p-13f,
+    0x1.4d79cap-21f,
+    -0x1.f3004cp-1f,
+    0x1.dc5938p-9f,
+    0x1.208324p-13f,
+    0x1.4d79cap-21f,
+    -0x1.f111d6p-1f,
+    0x1.005412p-8f,
+    0x1.246b9p-13f,
+    0x1.4d79cap-21f,
+    -0x1.eefed2p-1f,
+    0x1.12ba0ep-8f,
+    0x1.2853fep-13f,
+    0x1.4d79cap-21f,
+    -0x1.ecc6c4p-1f,
+    0x1.255e92p-8f,
+    0x1.2c3c6cp-13f,
+    0x1.4d79cap-21f,
+    -0x1.ea692ep-1f,
+    0x1.38419cp-8f,
+    0x1.3024d8p-13f,
+    0x1.4d79cap-21f,
+    -0x1.e7e594p-1f,
+    0x1.4b632cp-8f,
+    0x1.340d46p-13f,
+    0x1.4d79cap-21f,
+    -0x1.e53b54p-1f,
+    0x1.5eeee2p-8f,
+    0x1.37bf64p-13f,
+    0x1.064934p-20f,
+    -0x1.e269dap-1f,
+    0x1.729c06p-8f,
+    0x1.3de51cp-13f,
+    0x1.064934p-20f,
+    -0x1.df70a4p-1f,
+    0x1.86ab84p-8f,
+    0x1.440ad4p-13f,
+    0x1.064934p-20f,
+    -0x1.dc4eeap-1f,
+    0x1.9b1d6p-8f,
+    0x1.4a308ap-13f,
+    0x1.064934p-20f,
+    -0x1.d903ecp-1f,
+    0x1.aff196p-8f,
+    0x1.505642p-13f,
+    0x1.064934p-20f,
+    -0x1.d58ee2p-1f,
+    0x1.c52828p-8f,
+    0x1.567bfap-13f,
+    0x1.064934p-20f,
+    -0x1.d1ef0ap-1f,
+    0x1.dac116p-8f,
+    0x1.5ca1bp-13f,
+    0x1.064934p-20f,
+    -0x1.ce239cp-1f,
+    0x1.f0bc5ep-8f,
+    0x1.62c768p-13f,
+    0x1.064934p-20f,
+    -0x1.ca2b8ep-1f,
+    0x1.03af3cp-7f,
+    0x1.6c88aep-13f,
+    0x1.9f52dep-20f,
+    -0x1.c605d6p-1f,
+    0x1.0f3a72p-7f,
+    0x1.76449ep-13f,
+    0x1.9f52dep-20f,
+    -0x1.c1b154p-1f,
+    0x1.1b1386p-7f,
+    0x1.80009p-13f,
+    0x1.9f52dep-20f,
+    -0x1.bd2cdp-1f,
+    0x1.273a7ap-7f,
+    0x1.89bc8p-13f,
+    0x1.9f52dep-20f,
+    -0x1.b87702p-1f,
+    0x1.33bc92p-7f,
+    0x1.94f08cp-13f,
+    0x1.2bdb4ep-19f,
+    -0x1.b38e74p-1f,
+    0x1.409c5p-7f,
+    0x1.a2fed4p-13f,
+    0x1.2bdb4ep-19f,
+    -0x1.ae7188p-1f,
+    0x1.4dec8p-7f,
+    0x1.b10d1cp-13f,
+    0x1.2bdb4ep-19f,
+    -0x1.a91e7cp-1f,
+    0x1.5bad22p-7f,
+    0x1.bf1b62p-13f,
+    0x1.2bdb4ep-19f,
+    -0x1.a39366p-1f,
+    0x1.69f428p-7f,
+    0x1.cf817p-13f,
+    0x1.c77e8cp-19f,
+    -0x1.9dce2ap-1f,
+    0x1.78c59cp-7f,
+    0x1.e4db5ep-13f,
+    0x1.c77e8cp-19f,
+    -0x1.97cc54p-1f,
+    0x1.8841dep-7f,
+    0x1.fa354cp-13f,
+    0x1.c77e8cp-19f,
+    -0x1.918b38p-1f,
+    0x1.9868fp-7f,
+    0x1.07c79ep-12f,
+    0x1.c77e8cp-19f,
+    -0x1.8b07e8p-1f,
+    0x1.a96182p-7f,
+    0x1.1465p-12f,
+    0x1.7165b4p-18f,
+    -0x1.843f1cp-1f,
+    0x1.bb3258p-7f,
+    0x1.25b5c4p-12f,
+    0x1.7165b4p-18f,
+    -0x1.7d2ce4p-1f,
+    0x1.ce183cp-7f,
+    0x1.370688p-12f,
+    0x1.7165b4p-18f,
+    -0x1.75cceap-1f,
+    0x1.e2132ap-7f,
+    0x1.48574ep-12f,
+    0x1.7165b4p-18f,
+    -0x1.6e1a5ap-1f,
+    0x1.f76e7cp-7f,
+    0x1.5d047cp-12f,
+    0x1.498acp-17f,
+    -0x1.660fb6p-1f,
+    0x1.071af6p-6f,
+    0x1.7be97ep-12f,
+    0x1.498acp-17f,
+    -0x1.5da618p-1f,
+    0x1.1375d6p-6f,
+    0x1.9ace8p-12f,
+    0x1.498acp-17f,
+    -0x1.54d5c6p-1f,
+    0x1.20c7dep-6f,
+    0x1.b9b382p-12f,
+    0x1.498acp-17f,
+    -0x1.4b9622p-1f,
+    0x1.2f5cc8p-6f,
+    0x1.e840f4p-12f,
+    0x1.14dd0ep-16f,
+    -0x1.41dc0ap-1f,
+    0x1.3f6e74p-6f,
+    0x1.0e1532p-11f,
+    0x1.14dd0ep-16f,
+    -0x1.379a9p-1f,
+    0x1.5142dp-6f,
+    0x1.2d88cep-11f,
+    0x1.a52dc4p-16f,
+    -0x1.2cc1ccp-1f,
+    0x1.65574p-6f,
+    0x1.550518p-11f,
+    0x1.a52dc4p-16f,
+    -0x1.213deap-1f,
+    0x1.7c2318p-6f,
+    0x1.867308p-11f,
+    0x1.5b7272p-15f,
+    -0x1.14f5c6p-1f,
+    0x1.969374p-6f,
+    0x1.c7987ep-11f,
+    0x1.5b7272p-15f,
+    -0x1.07c892p-1f,
+    0x1.b596fep-6f,
+    0x1.0e8472p-10f,
+    0x1.444168p-14f,
+    -0x1.f314ecp-2f,
+    0x1.db345p-6f,
+    0x1.4b50b6p-10f,
+    0x1.444168p-14f,
+    -0x1.d3fc3p-2f,
+    0x1.04e5cp-5f,
+    0x1.a566f8p-10f,
+    0x1.2239p-13f,
+    -0x1.b1926ep-2f,
+    0x1.232556p-5f,
+    0x1.186164p-9f,
+    0x1.d97a8ap-13f,
+    -0x1.8abafcp-2f,
+    0x1.4cca9cp-5f,
+    0x1.915856p-9f,
+    0x1.b3e97p-12f,
+    -0x1.6992a4p-2f,
+    0x1.7910cap-6f,
+    0x1.191af6p-10f,
+    0x1.8096fcp-14f,
+    -0x1.50ce4ap-2f,
+    0x1.a15dfcp-6f,
+    0x1.74d056p-10f,
+    0x1.35763ap-13f,
+    -0x1.3c5acap-2f,
+    0x1.c8d286p-7f,
+    0x1.dceb2ep-12f,
+    0x1.16e396p-15f,
+    -0x1.2d9444p-2f,
+    0x1.e9e5e4p-7f,
+    0x1.22c042p-11f,
+    0x1.16e396p-15f,
+    -0x1.1da8a2p-2f,
+    0x1.094e38p-6f,
+    0x1.6e52d8p-11f,
+    0x1.e0564cp-15f,
+    -0x1.0c4c4cp-2f,
+    0x1.236716p-6f,
+    0x1.df680ap-11f,
+    0x1.78eccp-14f,
+    -0x1.0086a4p-2f,
+    0x1.37ffp-8f,
+    0x1.1f1ffp-14f,
+    0x1.46f988p-19f,
+    -0x1.f72826p-3f,
+    0x1.41729cp-8f,
+    0x1.3dc754p-14f,
+    0x1.46f988p-19f,
+    -0x1.ecf392p-3f,
+    0x1.4bdb74p-8f,
+    0x1.5c6eb8p-14f,
+    0x1.46f988p-19f,
+    -0x1.e267e2p-3f,
+    0x1.573988p-8f,
+    0x1.7b161ep-14f,
+    0x1.46f988p-19f,
+    -0x1.d77c52p-3f,
+    0x1.63de64p-8f,
+    0x1.9f6c0ep-14f,
+    0x1.4c6b4p-18f,
+    -0x1.cc26dap-3f,
+    0x1.71d314p-8f,
+    0x1.ddc02ap-14f,
+    0x1.4c6b4p-18f,
+    -0x1.c059fp-3f,
+    0x1.81ba66p-8f,
+    0x1.0e0a22p-13f,
+    0x1.4c6b4p-18f,
+    -0x1.b40602p-3f,
+    0x1.93945ap-8f,
+    0x1.2d343p-13f,
+    0x1.4c6b4p-18f,
+    -0x1.a7191cp-3f,
+    0x1.a82998p-8f,
+    0x1.61772cp-13f,
+    0x1.4a596cp-17f,
+    -0x1.997a48p-3f,
+    0x1.c0309p-8f,
+    0x1.9f67fp-13f,
+    0x1.4a596cp-17f,
+    -0x1.8b0a94p-3f,
+    0x1.dc8ddep-8f,
+    0x1.f01ecp-13f,
+    0x1.2f4b12p-16f,
+    -0x1.7ba0a4p-3f,
+    0x1.ff1dacp-8f,
+    0x1.30ed74p-12f,
+    0x1.2f4b12p-16f,
+    -0x1.6b02e8p-3f,
+    0x1.14f1ecp-7f,
+    0x1.804232p-12f,
+    0x1.5406cp-15f,
+    -0x1.58de68p-3f,
+    0x1.30f224p-7f,
+    0x1.ffc4bap-12f,
+    0x1.5406cp-15f,
+    -0x1.44b17cp-3f,
+    0x1.570cd6p-7f,
+    0x1.6d7abp-11f,
+    0x1.4ce4fp-14f,
+    -0x1.2e25p-3f,
+    0x1.6e9d18p-7f,
+    0x1.38f75p-17f,
+    0x1.094b72p-28f,
+    -0x1.a7fbfp-5f,
+    0x1.73d63ap-3f,
+    0x1.3c49b2p-9f,
+    0x1.11df26p-16f,
+    0x1.0ed0f4p-3f,
+    0x1.7dd234p-3f,
+    0x1.42b4eep-9f,
+    0x1.11df26p-16f,
+    0x1.48db6p-2f,
+    0x1.880234p-3f,
+    0x1.4953b4p-9f,
+    0x1.23843cp-16f,
+    0x1.07b9d8p-1f,
+    0x1.926826p-3f,
+    0x1.5028cep-9f,
+    0x1.23843cp-16f,
+    0x1.3b270cp-1f,
+    0x1.97c4fep-9f,
+    0x1.53b738p-21f,
+    0x1.2f42dcp-34f,
+    0x1.3cbee6p-1f,
+    0x1.97ef78p-9f,
+    0x1.53d3a8p-21f,
+    0x1.2f42dcp-34f,
+    0x1.3e56ecp-1f,
+    0x1.9819f4p-9f,
+    0x1.53f016p-21f,
+    0x1.2f42dcp-34f,
+    0x1.3fef1ap-1f,
+    0x1.984474p-9f,
+    0x1.540c84p-21f,
+    0x1.2f42dcp-34f,
+    0x1.418774p-1f,
+    0x1.986ef6p-9f,
+    0x1.5428f2p-21f,
+    0x1.2f42dcp-34f,
+    0x1.431ff8p-1f,
+    0x1.98997ep-9f,
+    0x1.54456p-21f,
+    0x1.2f42dcp-34f,
+    0x1.44b8a8p-1f,
+    0x1.98c408p-9f,
+    0x1.5461cep-21f,
+    0x1.2f42dcp-34f,
+    0x1.46518p-1f,
+    0x1.98ee96p-9f,
+    0x1.547e3cp-21f,
+    0x1.2f42dcp-34f,
+    0x1.47ea84p-1f,
+    0x1.991928p-9f,
+    0x1.549aacp-21f,
+    0x1.2f42dcp-34f,
+    0x1.4983b4p-1f,
+    0x1.9943bcp-9f,
+    0x1.54b71ap-21f,
+    0x1.2f42dcp-34f,
+    0x1.4b1d0cp-1f,
+    0x1.996e56p-9f,
+    0x1.54d388p-21f,
+    0x1.2f42dcp-34f,
+    0x1.4cb69p-1f,
+    0x1.9998f2p-9f,
+    0x1.54eff6p-21f,
+    0x1.2f42dcp-34f,
+    0x1.4e503ep-1f,
+    0x1.99c392p-9f,
+    0x1.550c64p-21f,
+    0x1.2f42dcp-34f,
+    0x1.4fea16p-1f,
+    0x1.99ee34p-9f,
+    0x1.5528d2p-21f,
+    0x1.2f42dcp-34f,
+    0x1.51841ap-1f,
+    0x1.9a18dcp-9f,
+    0x1.55454p-21f,
+    0x1.2f42dcp-34f,
+    0x1.531e48p-1f,
+    0x1.9a4386p-9f,
+    0x1.5561aep-21f,
+    0x1.2f42dcp-34f,
+    0x1.54b8a2p-1f,
+    0x1.9a6e34p-9f,
+    0x1.557e1ep-21f,
+    0x1.2f42dcp-34f,
+    0x1.565326p-1f,
+    0x1.9a98e6p-9f,
+    0x1.559a8cp-21f,
+    0x1.2f42dcp-34f,
+    0x1.57edd4p-1f,
+    0x1.9ac39ap-9f,
+    0x1.55b6fap-21f,
+    0x1.2f42dcp-34f,
+    0x1.5988acp-1f,
+    0x1.9aee52p-9f,
+    0x1.55d368p-21f,
+    0x1.2f42dcp-34f,
+    0x1.5b23bp-1f,
+    0x1.9b191p-9f,
+    0x1.55efd6p-21f,
+    0x1.2f42dcp-34f,
+    0x1.5cbedep-1f,
+    0x1.9b43cep-9f,
+    0x1.560c44p-21f,
+    0x1.2f42dcp-34f,
+    0x1.5e5a38p-1f,
+    0x1.9b6e92p-9f,
+    0x1.5628b2p-21f,
+    0x1.2f42dcp-34f,
+    0x1.5ff5bcp-1f,
+    0x1.9b995ap-9f,
+    0x1.564522p-21f,
+    0x1.2f42dcp-34f,
+    0x1.61916ap-1f,
+    0x1.9bc424p-9f,
+    0x1.56619p-21f,
+    0x1.2f42dcp-34f,
+    0x1.632d44p-1f,
+    0x1.9beef2p-9f,
+    0x1.567dfep-21f,
+    0x1.2f42dcp-34f,
+    0x1.64c948p-1f,
+    0x1.9c19c4p-9f,
+    0x1.569a6cp-21f,
+    0x1.2f42dcp-34f,
+    0x1.666578p-1f,
+    0x1.9c4498p-9f,
+    0x1.56b6dap-21f,
+    0x1.2f42dcp-34f,
+    0x1.6801d2p-1f,
+    0x1.9c6f7p-9f,
+    0x1.56d348p-21f,
+    0x1.2f42dcp-34f,
+    0x1.699e56p-1f,
+    0x1.9c9a4cp-9f,
+    0x1.56efb6p-21f,
+    0x1.2f42dcp-34f,
+    0x1.6b3b06p-1f,
+    0x1.9cc52cp-9f,
+    0x1.570c24p-21f,
+    0x1.2f42dcp-34f,
+    0x1.6cd7ep-1f,
+    0x1.9cf01p-9f,
+    0x1.572894p-21f,
+    0x1.2f42dcp-34f,
+    0x1.6e74e6p-1f,
+    0x1.9d1af8p-9f,
+    0x1.5746ap-21f,
+    0x1.31fcecp-34f,
+    0x1.701216p-1f,
+    0x1.9d45e2p-9f,
+    0x1.57635p-21f,
+    0x1.31fcecp-34f,
+    0x1.71af72p-1f,
+    0x1.9d70dp-9f,
+    0x1.577ffep-21f,
+    0x1.31fcecp-34f,
+    0x1.734cf8p-1f,
+    0x1.9d9bc2p-9f,
+    0x1.579caep-21f,
+    0x1.31fcecp-34f,
+    0x1.74dae4p-1f,
+    0x1.5b73bep-9f,
+    -0x1.e8e1b6p-12f,
+    0x1.17e8ecp-13f,
+    0x1.7608d8p-1f,
+    0x1.0b1a2ep-9f,
+    -0x1.bd6762p-13f,
+    0x1.68eccap-15f,
+    0x1.76fcdep-1f,
+    0x1.c16402p-10f,
+    -0x1.084e26p-13f,
+    0x1.c547b4p-17f,
+    0x1.77cedp-1f,
+    0x1.89f026p-10f,
+    -0x1.66a16ap-14f,
+    0x1.c547b4p-17f,
+    0x1.788992p-1f,
+    0x1.62fd36p-10f,
+    -0x1.00b1cep-14f,
+    0x1.c5e46cp-19f,
+    0x1.79337cp-1f,
+    0x1.458fd4p-10f,
+    -0x1.ac48c8p-15f,
+    0x1.c5e46cp-19f,
+    0x1.79d004p-1f,
+    0x1.2d741ep-10f,
+    -0x1.572df4p-15f,
+    0x1.c5e46cp-19f,
+    0x1.7a61d4p-1f,
+    0x1.1aaa14p-10f,
+    -0x1.02132p-15f,
+    0x1.c5e46cp-19f,
+    0x1.7aeafcp-1f,
+    0x1.0a56a4p-10f,
+    -0x1.d13008p-16f,
+    0x1.1bb86ap-20f,
+    0x1.7b6ca8p-1f,
+    0x1.f943dep-11f,
+    -0x1.9bfd74p-16f,
+    0x1.1bb86ap-20f,
+    0x1.7be7e6p-1f,
+    0x1.e12d9cp-11f,
+    -0x1.66caep-16f,
+    0x1.1bb86ap-20f,
+    0x1.7c5d86p-1f,
+    0x1.cc6a82p-11f,
+    -0x1.31984cp-16f,
+    0x1.1bb86ap-20f,
+    0x1.7cce3cp-1f,
+    0x1.b95f46p-11f,
+    -0x1.09955ep-16f,
+    0x1.841eecp-22f,
+    0x1.7d3a8cp-1f,
+    0x1.a9577cp-11f,
+    -0x1.eec7d4p-17f,
+    0x1.841eecp-22f,
+    0x1.7da3p-1f,
+    0x1.9a72cap-11f,
+    -0x1.ca64eep-17f,
+    0x1.841eecp-22f,
+    0x1.7e07dep-1f,
+    0x1.8cb12ep-11f,
+    -0x1.a60208p-17f,
+    0x1.841eecp-22f,
+    0x1.7e6972p-1f,
+    0x1.8012a8p-11f,
+    -0x1.819f22p-17f,
+    0x1.841eecp-22f,
+    0x1.7ec8p-1f,
+    0x1.74973cp-11f,
+    -0x1.5d3c3cp-17f,
+    0x1.841eecp-22f,
+    0x1.7f23d4p-1f,
+    0x1.6a3ee4p-11f,
+    -0x1.38d956p-17f,
+    0x1.841eecp-22f,
+    0x1.7f7d38p-1f,
+    0x1.6109a6p-11f,
+    -0x1.14767p-17f,
+    0x1.841eecp-22f,
+    0x1.7fd43ep-1f,
+    0x1.577c1ep-11f,
+    -0x1.0f989p-17f,
+    0x1.226dbep-23f,
+    0x1.802912p-1f,
+    0x1.4f35cep-11f,
+    -0x1.01fb6ap-17f,
+    0x1.226dbep-23f,
+    0x1.807be2p-1f,
+    0x1.475c68p-11f,
+    -0x1.e8bc8ap-18f,
+    0x1.226dbep-23f,
+    0x1.80cccap-1f,
+    0x1.3fefeap-11f,
+    -0x1.cd824p-18f,
+    0x1.226dbep-23f,
+    0x1.811be4p-1f,
+    0x1.38f056p-11f,
+    -0x1.b247f6p-18f,
+    0x1.226dbep-23f,
+    0x1.81694cp-1f,
+    0x1.325daap-11f,
+    -0x1.970daep-18f,
+    0x1.226dbep-23f,
+    0x1.81b51cp-1f,
+    0x1.2c37e8p-11f,
+    -0x1.7bd364p-18f,
+    0x1.226dbep-23f,
+    0x1.81ff7p-1f,
+    0x1.267f1p-11f,
+    -0x1.60991ap-18f,
+    0x1.226dbep-23f,
+    0x1.82b31ep-1f,
+    0x1.190026p-9f,
+    -0x1.37be14p-14f,
+    0x1.bcecb6p-19f,
+    0x1.83c2cep-1f,
+    0x1.06d1f6p-9f,
+    -0x1.0e07e2p-14f,
+    0x1.bcecb6p-19f,
+    0x1.84c1ap-1f,
+    0x1.ee7e52p-10f,
+    -0x1.c8a362p-15f,
+    0x1.bcecb6p-19f,
+    0x1.85b22cp-1f,
+    0x1.d48f8p-10f,
+    -0x1.7537p-15f,
+    0x1.bcecb6p-19f,
+    0x1.86969cp-1f,
+    0x1.bdaafap-10f,
+    -0x1.4ed5c2p-15f,
+    0x1.6a08p-20f,
+    0x1.877064p-1f,
+    0x1.a9cd24p-10f,
+    -0x1.2ce502p-15f,
+    0x1.6a08p-20f,
+    0x1.8840c4p-1f,
+    0x1.980e5ap-10f,
+    -0x1.0af442p-15f,
+    0x1.6a08p-20f,
+    0x1.8908ccp-1f,
+    0x1.886e9ap-10f,
+    -0x1.d20704p-16f,
+    0x1.6a08p-20f,
+    0x1.89c96cp-1f,
+    0x1.7a4b32p-10f,
+    -0x1.a7fa72p-16f,
+    0x1.7a4ce4p-21f,
+    0x1.8a835ap-1f,
+    0x1.6d993cp-10f,
+    -0x1.84833cp-16f,
+    0x1.7a4ce4p-21f,
+    0x1.8b3734p-1f,
+    0x1.6202fep-10f,
+    -0x1.610c06p-16f,
+    0x1.7a4ce4p-21f,
+    0x1.8be58cp-1f,
+    0x1.57887ap-10f,
+    -0x1.3d94d2p-16f,
+    0x1.7a4ce4p-21f,
+    0x1.8c8eep-1f,
+    0x1.4de87ep-10f,
+    -0x1.266474p-16f,
+    0x1.fc2156p-22f,
+    0x1.8d3398p-1f,
+    0x1.4514ap-10f,
+    -0x1.0e92e4p-16f,
+    0x1.fc2156p-22f,
+    0x1.8dd318p-1f,
+    0x1.331edp-10f,
+    -0x1.418956p-15f,
+    0x1.9df0fep-15f,
+    0x1.8e6adep-1f,
+    0x1.2bf09cp-10f,
+    -0x1.db54b6p-17f,
+    0x1.2aac0ap-22f,
+    0x1.90eb2ap-1f,
+    0x1.0e69e6p-7f,
+    -0x1.753efap-11f,
+    0x1.9a3dd2p-14f,
+    0x1.94d2f8p-1f,
+    0x1.cfb368p-8f,
+    -0x1.01dc24p-11f,
+    0x1.c88a6ap-15f,
+    0x1.99c59ap-1f,
+    0x1.8245ep-7f,
+    -0x1.4fdaap-10f,
+    0x1.cb3452p-13f,
+    0x1.9f3fb6p-1f,
+    0x1.3fad82p-7f,
+    -0x1.ae425ep-11f,
+    0x1.bd44dcp-14f,
+    0x1.a3df54p-1f,
+    0x1.12b8bep-7f,
+    -0x1.2ff086p-11f,
+    0x1.f9ae62p-15f,
+    0x1.a7e57p-1f,
+    0x1.e3e6e2p-8f,
+    -0x1.c6cdacp-12f,
+    0x1.06baecp-15f,
+    0x1.ab787ep-1f,
+    0x1.b1358ep-8f,
+    -0x1.644792p-12f,
+    0x1.06baecp-15f,
+    0x1.aeb16ap-1f,
+    0x1.890dp-8f,
+    -0x1.21cc4ep-12f,
+    0x1.0848f4p-16f,
+    0x1.b1a15cp-1f,
+    0x1.67ec5p-8f,
+    -0x1.e07d42p-13f,
+    0x1.0848f4p-16f,
+    0x1.b454b6p-1f,
+    0x1.4c3d1ap-8f,
+    -0x1.8f0c3p-13f,
+    0x1.efab78p-18f,
+    0x1.b6d538p-1f,
+    0x1.34c018p-8f,
+    -0x1.60941ep-13f,
+    0x1.efab78p-18f,
+    0x1.b929a6p-1f,
+    0x1.202a96p-8f,
+    -0x1.321c0ap-13f,
+    0x1.efab78p-18f,
+    0x1.bb57d2p-1f,
+    0x1.0e7c96p-8f,
+    -0x1.03a3f6p-13f,
+    0x1.efab78p-18f,
+    0x1.bd64b4p-1f,
+    0x1.fd5e32p-9f,
+    -0x1.d487dep-14f,
+    0x1.ca4afcp-19f,
+    0x1.bf53ep-1f,
+    0x1.e16d6cp-9f,
+    -0x1.a990d6p-14f,
+    0x1.ca4afcp-19f,
+    0x1.c12874p-1f,
+    0x1.c82c18p-9f,
+    -0x1.7e99cep-14f,
+    0x1.ca4afcp-19f,
+    0x1.c2e51ep-1f,
+    0x1.b19a32p-9f,
+    -0x1.53a2c8p-14f,
+    0x1.ca4afcp-19f,
+    0x1.c48c42p-1f,
+    0x1.9cfce6p-9f,
+    -0x1.376318p-14f,
+    0x1.f9ff94p-20f,
+    0x1.c61fc2p-1f,
+    0x1.8a4474p-9f,
+    -0x1.1fab1cp-14f,
+    0x1.f9ff94p-20f,
+    0x1.c7a148p-1f,
+    0x1.790782p-9f,
+    -0x1.07f322p-14f,
+    0x1.f9ff94p-20f,
+    0x1.c9125p-1f,
+    0x1.69461p-9f,
+    -0x1.e0764ep-15f,
+    0x1.f9ff94p-20f,
+    0x1.ca7432p-1f,
+    0x1.5aabf6p-9f,
+    -0x1.be12a2p-15f,
+    0x1.376814p-20f,
+    0x1.cbc80cp-1f,
+    0x1.4d3028p-9f,
+    -0x1.a0e0ep-15f,
+    0x1.376814p-20f,
+    0x1.cd0eep-1f,
+    0x1.409de8p-9f,
+    -0x1.83af1ep-15f,
+    0x1.376814p-20f,
+    0x1.ce4996p-1f,
+    0x1.34f536p-9f,
+    -0x1.667d5cp-15f,
+    0x1.376814p-20f,
+    0x1.cf79p-1f,
+    0x1.29ee24p-9f,
+    -0x1.49f6a6p-15f,
+    0x1.5a04d2p-21f,
+    0x1.d09ddcp-1f,
+    0x1.1fdf4ep-9f,
+    -0x1.39be6cp-15f,
+    0x1.5a04d2p-21f,
+    0x1.d1b8eap-1f,
+    0x1.16523cp-9f,
+    -0x1.298634p-15f,
+    0x1.5a04d2p-21f,
+    0x1.d2caacp-1f,
+    0x1.0d46ecp-9f,
+    -0x1.194dfap-15f,
+    0x1.5a04d2p-21f,
+    0x1.d3d3a2p-1f,
+    0x1.04bd5cp-9f,
+    -0x1.0915cp-15f,
+    0x1.5a04d2p-21f,
+    0x1.d4d452p-1f,
+    0x1.f96b2p-10f,
+    -0x1.f1bb0ap-16f,
+    0x1.5a04d2p-21f,
+    0x1.d5cd38p-1f,
+    0x1.ea5f0ap-10f,
+    -0x1.d14a98p-16f,
+    0x1.5a04d2p-21f,
+    0x1.d6bedcp-1f,
+    0x1.dc5676p-10f,
+    -0x1.b0da24p-16f,
+    0x1.5a04d2p-21f,
+    0x1.d7a98p-1f,
+    0x1.ce720ap-10f,
+    -0x1.a0bcb8p-16f,
+    0x1.6a9c9ep-22f,
+    0x1.d88d84p-1f,
+    0x1.c1b02p-10f,
+    -0x1.8fbd62p-16f,
+    0x1.6a9c9ep-22f,
+    0x1.d96b48p-1f,
+    0x1.b57634p-10f,
+    -0x1.7ebe0ap-16f,
+    0x1.6a9c9ep-22f,
+    0x1.da431p-1f,
+    0x1.a9c44p-10f,
+    -0x1.6dbeb2p-16f,
+    0x1.6a9c9ep-22f,
+    0x1.db1522p-1f,
+    0x1.9e9a48p-10f,
+    -0x1.5cbf5cp-16f,
+    0x1.6a9c9ep-22f,
+    0x1.dbe1c2p-1f,
+    0x1.93f84ap-10f,
+    -0x1.4bc004p-16f,
+    0x1.6a9c9ep-22f,
+    0x1.dca932p-1f,
+    0x1.89de48p-10f,
+    -0x1.3ac0acp-16f,
+    0x1.6a9c9ep-22f,
+    0x1.dd6bb6p-1f,
+    0x1.804c4p-10f,
+    -0x1.29c156p-16f,
+    0x1.6a9c9ep-22f,
+    0x1.de297cp-1f,
+    0x1.76e0bap-10f,
+    -0x1.1f7454p-16f,
+    0x1.a8c8bep-23f,
+    0x1.dee2b4p-1f,
+    0x1.6e0ceap-10f,
+    -0x1.157f9ep-16f,
+    0x1.a8c8bep-23f,
+    0x1.df9796p-1f,
+    0x1.6588cp-10f,
+    -0x1.0b8aeap-16f,
+    0x1.a8c8bep-23f,
+    0x1.e0484ap-1f,
+    0x1.5d543cp-10f,
+    -0x1.019636p-16f,
+    0x1.a8c8bep-23f,
+    0x1.e0f4f6p-1f,
+    0x1.556f5cp-10f,
+    -0x1.ef4302p-17f,
+    0x1.a8c8bep-23f,
+    0x1.e19dc6p-1f,
+    0x1.4dda24p-10f,
+    -0x1.db599ap-17f,
+    0x1.a8c8bep-23f,
+    0x1.e242dep-1f,
+    0x1.46949p-10f,
+    -0x1.c7703p-17f,
+    0x1.a8c8bep-23f,
+    0x1.e2e468p-1f,
+    0x1.3f9ea2p-10f,
+    -0x1.b386c8p-17f,
+    0x1.a8c8bep-23f,
+    0x1.e3827ep-1f,
+    0x1.38c6a8p-10f,
+    -0x1.a61ecap-17f,
+    0x1.0b2222p-23f,
+    0x1.e41d4p-1f,
+    0x1.324738p-10f,
+    -0x1.99993p-17f,
+    0x1.0b2222p-23f,
+    0x1.e4b4cep-1f,
+    0x1.2bf9dep-10f,
+    -0x1.8d1398p-17f,
+    0x1.0b2222p-23f,
+    0x1.e54942p-1f,
+    0x1.25de9ap-10f,
+    -0x1.808dfep-17f,
+    0x1.0b2222p-23f,
+    0x1.e5dab4p-1f,
+    0x1.1ff56ep-10f,
+    -0x1.740864p-17f,
+    0x1.0b2222p-23f,
+    0x1.e6694p-1f,
+    0x1.1a3e58p-10f,
+    -0x1.6782cap-17f,
+    0x1.0b2222p-23f,
+    0x1.e6f4fap-1f,
+    0x1.14b958p-10f,
+    -0x1.5afd3p-17f,
+    0x1.0b2222p-23f,
+    0x1.e77ep-1f,
+    0x1.0f666ep-10f,
+    -0x1.4e7798p-17f,
+    0x1.0b2222p-23f,
+    0x1.e80464p-1f,
+    0x1.0a04aep-10f,
+    -0x1.3f595ap-17f,
+    0x1.24cdb8p-24f,
+    0x1.e8882ap-1f,
+    0x1.051502p-10f,
+    -0x1.387c88p-17f,
+    0x1.24cdb8p-24f,
+    0x1.e9097ep-1f,
+    0x1.0040cap-10f,
+    -0x1.319fb6p-17f,
+    0x1.24cdb8p-24f,
+    0x1.e9887p-1f,
+    0x1.f71008p-11f,
+    -0x1.2ac2e4p-17f,
+    0x1.24cdb8p-24f,
+    0x1.ea050ap-1f,
+    0x1.edd564p-11f,
+    -0x1.23e61p-17f,
+    0x1.24cdb8p-24f,
+    0x1.ea7f5ep-1f,
+    0x1.e4d1a8p-11f,
+    -0x1.1d093ep-17f,
+    0x1.24cdb8p-24f,
+    0x1.eaf778p-1f,
+    0x1.dc04dp-11f,
+    -0x1.162c6cp-17f,
+    0x1.24cdb8p-24f,
+    0x1.eb6d66p-1f,
+    0x1.d36eep-11f,
+    -0x1.0f4f9ap-17f,
+    0x1.24cdb8p-24f,
+    0x1.ebe134p-1f,
+    0x1.cb0fd6p-11f,
+    -0x1.0872c8p-17f,
+    0x1.24cdb8p-24f,
+    0x1.ec52f2p-1f,
+    0x1.c2e7b4p-11f,
+    -0x1.0195f6p-17f,
+    0x1.24cdb8p-24f,
+    0x1.ecc2acp-1f,
+    0x1.baf678p-11f,
+    -0x1.f57246p-18f,
+    0x1.24cdb8p-24f,
+    0x1.ed3072p-1f,
+    0x1.b33c22p-11f,
+    -0x1.e7b8a2p-18f,
+    0x1.24cdb8p-24f,
+    0x1.ed9c5p-1f,
+    0x1.abb8b2p-11f,
+    -0x1.d9fefcp-18f,
+    0x1.24cdb8p-24f,
+    0x1.ee0652p-1f,
+    0x1.a46c2ap-11f,
+    -0x1.cc4558p-18f,
+    0x1.24cdb8p-24f,
+    0x1.ee6e8ap-1f,
+    0x1.9d5688p-11f,
+    -0x1.be8bb4p-18f,
+    0x1.24cdb8p-24f,
+    0x1.eed502p-1f,
+    0x1.9677ccp-11f,
+    -0x1.b0d20ep-18f,
+    0x1.24cdb8p-24f,
+    0x1.ef39aep-1f,
+    0x1.8f1f6ep-11f,
+    -0x1.ae4434p-18f,
+    0x1.1c4034p-25f,
+    0x1.ef9cap-1f,
+    0x1.8873bp-11f,
+    -0x1.a79ab2p-18f,
+    0x1.1c4034p-25f,
+    0x1.effdeap-1f,
+    0x1.81e298p-11f,
+    -0x1.a0f132p-18f,
+    0x1.1c4034p-25f,
+    0x1.f05d94p-1f,
+    0x1.7b6c26p-11f,
+    -0x1.9a47bp-18f,
+    0x1.1c4034p-25f,
+    0x1.f0bba2p-1f,
+    0x1.75105ap-11f,
+    -0x1.939e2ep-18f,
+    0x1.1c4034p-25f,
+    0x1.f1181ep-1f,
+    0x1.6ecf34p-11f,
+    -0x1.8cf4aep-18f,
+    0x1.1c4034p-25f,
+    0x1.f1730cp-1f,
+    0x1.68a8b4p-11f,
+    -0x1.864b2cp-18f,
+    0x1.1c4034p-25f,
+    0x1.f1cc74p-1f,
+    0x1.629cdcp-11f,
+    -0x1.7fa1aap-18f,
+    0x1.1c4034p-25f,
+    0x1.f2245cp-1f,
+    0x1.5caba8p-11f,
+    -0x1.78f82ap-18f,
+    0x1.1c4034p-25f,
+    0x1.f27accp-1f,
+    0x1.56d51ap-11f,
+    -0x1.724ea8p-18f,
+    0x1.1c4034p-25f,
+    0x1.f2cfcap-1f,
+    0x1.511932p-11f,
+    -0x1.6ba528p-18f,
+    0x1.1c4034p-25f,
+    0x1.f3235ap-1f,
+    0x1.4b77fp-11f,
+    -0x1.64fba6p-18f,
+    0x1.1c4034p-25f,
+    0x1.f37588p-1f,
+    0x1.45f156p-11f,
+    -0x1.5e5224p-18f,
+    0x1.1c4034p-25f,
+    0x1.f3c656p-1f,
+    0x1.40856p-11f,
+    -0x1.57a8a4p-18f,
+    0x1.1c4034p-25f,
+    0x1.f415ccp-1f,
+    0x1.3b341p-11f,
+    -0x1.50ff22p-18f,
+    0x1.1c4034p-25f,
+    0x1.f463f2p-1f,
+    0x1.35fd66p-11f,
+    -0x1.4a55a2p-18f,
+    0x1.1c4034p-25f,
+    0x1.f4b0dp-1f,
+    0x1.3035d6p-11f,
+    -0x1.412ff2p-18f,
+    0x1.cc896cp-27f,
+    0x1.f4fc3cp-1f,
+    0x1.2b367cp-11f,
+    -0x1.3e7d24p-18f,
+    0x1.cc896cp-27f,
+    0x1.f5466cp-1f,
+    0x1.2641ecp-11f,
+    -0x1.3bca56p-18f,
+    0x1.cc896cp-27f,
+    0x1.f58f5ep-1f,
+    0x1.215828p-11f,
+    -0x1.391788p-18f,
+    0x1.cc896cp-27f,
+    0x1.f5d718p-1f,
+    0x1.1c793p-11f,
+    -0x1.3664bap-18f,
+    0x1.cc896cp-27f,
+    0x1.f61d9cp-1f,
+    0x1.17a504p-11f,
+    -0x1.33b1ecp-18f,
+    0x1.cc896cp-27f,
+    0x1.f662ecp-1f,
+    0x1.12dba2p-11f,
+    -0x1.30ff1ep-18f,
+    0x1.cc896cp-27f,
+    0x1.f6a70cp-1f,
+    0x1.0e1d0ap-11f,
+    -0x1.2e4c5p-18f,
+    0x1.cc896cp-27f,
+    0x1.f6e9fcp-1f,
+    0x1.09693ep-11f,
+    -0x1.2b9982p-18f,
+    0x1.cc896cp-27f,
+    0x1.f72bcp-1f,
+    0x1.04c03ep-11f,
+    -0x1.28e6b4p-18f,
+    0x1.cc896cp-27f,
+    0x1.f76c5cp-1f,
+    0x1.002208p-11f,
+    -0x1.2633e6p-18f,
+    0x1.cc896cp-27f,
+    0x1.f7abd2p-1f,
+    0x1.f71d3ep-12f,
+    -0x1.238116p-18f,
+    0x1.cc896cp-27f,
+    0x1.f7ea24p-1f,
+    0x1.ee0cp-12f,
+    -0x1.20ce48p-18f,
+    0x1.cc896cp-27f,
+    0x1.f82756p-1f,
+    0x1.e5105ap-12f,
+    -0x1.1e1b7ap-18f,
+    0x1.cc896cp-27f,
+    0x1.f8636ap-1f,
+    0x1.dc2a48p-12f,
+    -0x1.1b68acp-18f,
+    0x1.cc896cp-27f,
+    0x1.f89e62p-1f,
+    0x1.d359cep-12f,
+    -0x1.18b5dep-18f,
+    0x1.cc896cp-27f,
+    0x1.f8d842p-1f,
+    0x1.ca9eeap-12f,
+    -0x1.16031p-18f,
+    0x1.cc896cp-27f,
+    0x1.f9110ap-1f,
+    0x1.c1f99ep-12f,
+    -0x1.135042p-18f,
+    0x1.cc896cp-27f,
+    0x1.f948cp-1f,
+    0x1.b969e6p-12f,
+    -0x1.109d74p-18f,
+    0x1.cc896cp-27f,
+    0x1.f97f66p-1f,
+    0x1.b0efc6p-12f,
+    -0x1.0deaa6p-18f,
+    0x1.cc896cp-27f,
+    0x1.f9b4fep-1f,
+    0x1.a88b3cp-12f,
+    -0x1.0b37d8p-18f,
+    0x1.cc896cp-27f,
+    0x1.f9e98ap-1f,
+    0x1.a03c48p-12f,
+    -0x1.08850ap-18f,
+    0x1.cc896cp-27f,
+    0x1.fa1d0ep-1f,
+    0x1.9802ecp-12f,
+    -0x1.05d23cp-18f,
+    0x1.cc896cp-27f,
+    0x1.fa4f8cp-1f,
+    0x1.8fdf26p-12f,
+    -0x1.031f6ep-18f,
+    0x1.cc896cp-27f,
+    0x1.fa8106p-1f,
+    0x1.87d0f6p-12f,
+    -0x1.006cap-18f,
+    0x1.cc896cp-27f,
+    0x1.fab18p-1f,
+    0x1.7fd85cp-12f,
+    -0x1.fb73a2p-19f,
+    0x1.cc896cp-27f,
+    0x1.fae0fcp-1f,
+    0x1.77f558p-12f,
+    -0x1.f60e06p-19f,
+    0x1.cc896cp-27f,
+    0x1.fb0f7ep-1f,
+    0x1.7027ecp-12f,
+    -0x1.f0a86ap-19f,
+    0x1.cc896cp-27f,
+    0x1.fb3d08p-1f,
+    0x1.687014p-12f,
+    -0x1.eb42cep-19f,
+    0x1.cc896cp-27f,
+    0x1.fb699cp-1f,
+    0x1.60cdd4p-12f,
+    -0x1.e5dd3p-19f,
+    0x1.cc896cp-27f,
+    0x1.fb953cp-1f,
+    0x1.59412cp-12f,
+    -0x1.e07794p-19f,
+    0x1.cc896cp-27f,
+    0x1.fbbfecp-1f,
+    0x1.51ca18p-12f,
+    -0x1.db11f8p-19f,
+    0x1.cc896cp-27f,
+    0x1.fbe97cp-1f,
+    0x1.49a356p-12f,
+    -0x1.e96566p-19f,
+    0x1.3cf77p-27f,
+    0x1.fc1236p-1f,
+    0x1.42052ep-12f,
+    -0x1.e5ae8p-19f,
+    0x1.3cf77p-27f,
+    0x1.fc39fep-1f,
+    0x1.3a75e2p-12f,
+    -0x1.e1f798p-19f,
+    0x1.3cf77p-27f,
+    0x1.fc60d6p-1f,
+    0x1.32f57p-12f,
+    -0x1.de40b2p-19f,
+    0x1.3cf77p-27f,
+    0x1.fc86bcp-1f,
+    0x1.2b83dcp-12f,
+    -0x1.da89ccp-19f,
+    0x1.3cf77p-27f,
+    0x1.fcabb6p-1f,
+    0x1.242122p-12f,
+    -0x1.d6d2e6p-19f,
+    0x1.3cf77p-27f,
+    0x1.fccfc6p-1f,
+    0x1.1ccd44p-12f,
+    -0x1.d31cp-19f,
+    0x1.3cf77p-27f,
+    0x1.fcf2eap-1f,
+    0x1.158842p-12f,
+    -0x1.cf651ap-19f,
+    0x1.3cf77p-27f,
+    0x1.fd1528p-1f,
+    0x1.0e521cp-12f,
+    -0x1.cbae34p-19f,
+    0x1.3cf77p-27f,
+    0x1.fd368p-1f,
+    0x1.072adp-12f,
+    -0x1.c7f74cp-19f,
+    0x1.3cf77p-27f,
+    0x1.fd56f4p-1f,
+    0x1.001262p-12f,
+    -0x1.c44066p-19f,
+    0x1.3cf77p-27f,
+    0x1.fd7684p-1f,
+    0x1.f2119cp-13f,
+    -0x1.c0898p-19f,
+    0x1.3cf77p-27f,
+    0x1.fd9536p-1f,
+    0x1.e41c2ap-13f,
+    -0x1.bcd29ap-19f,
+    0x1.3cf77p-27f,
+    0x1.fdb30ap-1f,
+    0x1.d64472p-13f,
+    -0x1.b91bb4p-19f,
+    0x1.3cf77p-27f,
+    0x1.fddp-1f,
+    0x1.c88a7p-13f,
+    -0x1.b564cep-19f,
+    0x1.3cf77p-27f,
+    0x1.fdec1ap-1f,
+    0x1.baee24p-13f,
+    -0x1.b1ade6p-19f,
+    0x1.3cf77p-27f,
+    0x1.fe075ep-1f,
+    0x1.ad6f9p-13f,
+    -0x1.adf7p-19f,
+    0x1.3cf77p-27f,
+    0x1.fe21cap-1f,
+    0x1.a00eb4p-13f,
+    -0x1.aa401ap-19f,
+    0x1.3cf77p-27f,
+    0x1.fe3b6p-1f,
+    0x1.92cb9p-13f,
+    -0x1.a68934p-19f,
+    0x1.3cf77p-27f,
+    0x1.fe5424p-1f,
+    0x1.85a622p-13f,
+    -0x1.a2d24ep-19f,
+    0x1.3cf77p-27f,
+    0x1.fe6c16p-1f,
+    0x1.789e6ap-13f,
+    -0x1.9f1b68p-19f,
+    0x1.3cf77p-27f,
+    0x1.fe8338p-1f,
+    0x1.6bb46ap-13f,
+    -0x1.9b648p-19f,
+    0x1.3cf77p-27f,
+    0x1.fe998cp-1f,
+    0x1.5ee822p-13f,
+    -0x1.97ad9ap-19f,
+    0x1.3cf77p-27f,
+    0x1.feaf16p-1f,
+    0x1.523992p-13f,
+    -0x1.93f6b4p-19f,
+    0x1.3cf77p-27f,
+    0x1.fec3d4p-1f,
+    0x1.45a8b8p-13f,
+    -0x1.903fcep-19f,
+    0x1.3cf77p-27f,
+    0x1.fed7ccp-1f,
+    0x1.393594p-13f,
+    -0x1.8c88e8p-19f,
+    0x1.3cf77p-27f,
+    0x1.feeafcp-1f,
+    0x1.2ce028p-13f,
+    -0x1.88d202p-19f,
+    0x1.3cf77p-27f,
+    0x1.fefd68p-1f,
+    0x1.20a874p-13f,
+    -0x1.851b1cp-19f,
+    0x1.3cf77p-27f,
+    0x1.ff0f12p-1f,
+    0x1.148e76p-13f,
+    -0x1.816434p-19f,
+    0x1.3cf77p-27f,
+    0x1.ff1ffap-1f,
+    0x1.08923p-13f,
+    -0x1.7dad4ep-19f,
+    0x1.3cf77p-27f,
+    0x1.ff3024p-1f,
+    0x1.f96744p-14f,
+    -0x1.79f668p-19f,
+    0x1.3cf77p-27f,
+    0x1.ff3f92p-1f,
+    0x1.e1e594p-14f,
+    -0x1.763f82p-19f,
+    0x1.3cf77p-27f,
+    0x1.ff4e52p-1f,
+    0x1.ccc8e4p-14f,
+    -0x1.6e91dap-19f,
+    0x1.2daa2cp-26f,
+    0x1.ff5c5ep-1f,
+    0x1.b61856p-14f,
+    -0x1.677fdep-19f,
+    0x1.2daa2cp-26f,
+    0x1.ff69b6p-1f,
+    0x1.9fd8e8p-14f,
+    -0x1.606dep-19f,
+    0x1.2daa2cp-26f,
+    0x1.ff765cp-1f,
+    0x1.8a0a9ap-14f,
+    -0x1.595be4p-19f,
+    0x1.2daa2cp-26f,
+    0x1.ff8258p-1f,
+    0x1.74ad6cp-14f,
+    -0x1.5249e6p-19f,
+    0x1.2daa2cp-26f,
+    0x1.ff8da8p-1f,
+    0x1.5fc15ep-14f,
+    -0x1.4b37eap-19f,
+    0x1.2daa2cp-26f,
+    0x1.ff9854p-1f,
+    0x1.4b467p-14f,
+    -0x1.4425ecp-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffa25ep-1f,
+    0x1.373cap-14f,
+    -0x1.3d13eep-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffabcap-1f,
+    0x1.23a3f2p-14f,
+    -0x1.3601f2p-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffb49ap-1f,
+    0x1.107c62p-14f,
+    -0x1.2eeff4p-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffbcd2p-1f,
+    0x1.fb8be6p-15f,
+    -0x1.27ddf8p-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffc478p-1f,
+    0x1.d70146p-15f,
+    -0x1.20cbfap-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffcb8cp-1f,
+    0x1.b358e6p-15f,
+    -0x1.19b9fep-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffd214p-1f,
+    0x1.9092c6p-15f,
+    -0x1.12a8p-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffd812p-1f,
+    0x1.6eaee6p-15f,
+    -0x1.0b9604p-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffdd8ap-1f,
+    0x1.4dad46p-15f,
+    -0x1.048406p-19f,
+    0x1.2daa2cp-26f,
+    0x1.ffe286p-1f,
+    0x1.312646p-15f,
+    -0x1.fe530cp-20f,
+    0x1.0f7f48p-25f,
+    0x1.ffe70cp-1f,
+    0x1.120cb6p-15f,
+    -0x1.e4df1ep-20f,
+    0x1.0f7f48p-25f,
+    0x1.ffeb18p-1f,
+    0x1.e914c6p-16f,
+    -0x1.cb6b2ep-20f,
+    0x1.0f7f48p-25f,
+    0x1.ffeeb2p-1f,
+    0x1.b13e9ep-16f,
+    -0x1.b1f74p-20f,
+    0x1.0f7f48p-25f,
+    0x1.fff1dep-1f,
+    0x1.7c96f6p-16f,
+    -0x1.988352p-20f,
+    0x1.0f7f48p-25f,
+    0x1.fff4a6p-1f,
+    0x1.4b1dcap-16f,
+    -0x1.7f0f62p-20f,
+    0x1.0f7f48p-25f,
+    0x1.fff70ep-1f,
+    0x1.1cd31cp-16f,
+    -0x1.659b74p-20f,
+    0x1.0f7f48p-25f,
+    0x1.fff91cp-1f,
+    0x1.e36ddap-17f,
+    -0x1.4c2784p-20f,
+    0x1.0f7f48p-25f,
+    0x1.fffad6p-1f,
+    0x1.939276p-17f,
+    -0x1.32b396p-20f,
+    0x1.0f7f48p-25f,
+    0x1.fffc44p-1f,
+    0x1.4a141p-17f,
+    -0x1.193fa8p-20f,
+    0x1.0f7f48p-25f,
+    0x1.fffd6cp-1f,
+    0x1.06f2a4p-17f,
+    -0x1.ff9772p-21f,
+    0x1.0f7f48p-25f,
+    0x1.fffe54p-1f,
+    0x1.945c66p-18f,
+    -0x1.ccaf94p-21f,
+    0x1.0f7f48p-25f,
+    0x1.ffff04p-1f,
+    0x1.278d7cp-18f,
+    -0x1.99c7b6p-21f,
+    0x1.0f7f48p-25f,
+    0x1.ffff7ep-1f,
+    0x1.8ef114p-19f,
+    -0x1.66dfd8p-21f,
+    0x1.0f7f48p-25f,
+    0x1.ffffccp-1f,
+    0x1.d0764p-20f,
+    -0x1.33f7fap-21f,
+    0x1.0f7f48p-25f,
+    0x1.fffff4p-1f,
+    0x1.6be466p-21f,
+    -0x1.01101ep-21f,
+    0x1.0f7f48p-25f,
+};
+
+extern const float values[8192] = {
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1p+0f,
+    -0x1.fffff8p-1f,
+    -0x1.fffffp-1f,
+    -0x1.ffffdcp-1f,
+    -0x1.ffffcp-1f,
+    -0x1.ffff9cp-1f,
+    -0x1.ffff7p-1f,
+    -0x1.ffff4p-1f,
+    -0x1.ffff08p-1f,
+    -0x1.fffec8p-1f,
+    -0x1.fffe8p-1f,
+    -0x1.fffe3p-1f,
+    -0x1.fffdd4p-1f,
+    -0x1.fffd78p-1f,
+    -0x1.fffd1p-1f,
+    -0x1.fffca4p-1f,
+    -0x1.fffc2cp-1f,
+    -0x1.fffbacp-1f,
+    -0x1.fffb24p-1f,
+    -0x1.fffa94p-1f,
+    -0x1.fffap-1f,
+    -0x1.fff964p-1f,
+    -0x1.fff8cp-1f,
+    -0x1.fff814p-1f,
+    -0x1.fff764p-1f,
+    -0x1.fff6a4p-1f,
+    -0x1.fff5e4p-1f,
+    -0x1.fff514p-1f,
+    -0x1.fff448p-1f,
+    -0x1.fff36cp-1f,
+    -0x1.fff288p-1f,
+    -0x1.fff19cp-1f,
+    -0x1.fff0acp-1f,
+    -0x1.ffefbp-1f,
+    -0x1.ffeebp-1f,
+    -0x1.ffedacp-1f,
+    -0x1.ffec9cp-1f,
+    -0x1.ffeb88p-1f,
+    -0x1.ffea64p-1f,
+    -0x1.ffe94p-1f,
+    -0x1.ffe81p-1f,
+    -0x1.ffe6d4p-1f,
+    -0x1.ffe59cp-1f,
+    -0x1.ffe454p-1f,
+    -0x1.ffe308p-1f,
+    -0x1.ffe1bp-1f,
+    -0x1.ffe054p-1f,
+    -0x1.ffdeecp-1f,
+    -0x1.ffdd8p-1f,
+    -0x1.ffdc1p-1f,
+    -0x1.ffda9p-1f,
+    -0x1.ffd91p-1f,
+    -0x1.ffd78p-1f,
+    -0x1.ffd5ecp-1f,
+    -0x1.ffd45p-1f,
+    -0x1.ffd2bp-1f,
+    -0x1.ffd108p-1f,
+    -0x1.ffcf5p-1f,
+    -0x1.ffcd94p-1f,
+    -0x1.ffcbd4p-1f,
+    -0x1.ffca1p-1f,
+    -0x1.ffc838p-1f,
+    -0x1.ffc664p-1f,
+    -0x1.ffc48p-1f,
+    -0x1.ffc294p-1f,
+    -0x1.ffc0a4p-1f,
+    -0x1.ffbeacp-1f,
+    -0x1.ffbcacp-1f,
+    -0x1.ffbaa4p-1f,
+    -0x1.ffb894p-1f,
+    -0x1.ffb678p-1f,
+    -0x1.ffb45cp-1f,
+    -0x1.ffb238p-1f,
+    -0x1.ffb008p-1f,
+    -0x1.ffaddp-1f,
+    -0x1.ffab9p-1f,
+    -0x1.ffa948p-1f,
+    -0x1.ffa6f8p-1f,
+    -0x1.ffa4a4p-1f,
+    -0x1.ffa248p-1f,
+    -0x1.ff9fe4p-1f,
+    -0x1.ff9d7p-1f,
+    -0x1.ff9bp-1f,
+    -0x1.ff988p-1f,
+    -0x1.ff95f8p-1f,
+    -0x1.ff937p-1f,
+    -0x1.ff90dcp-1f,
+    -0x1.ff8e4p-1f,
+    -0x1.ff8b94p-1f,
+    -0x1.ff88ecp-1f,
+    -0x1.ff8638p-1f,
+    -0x1.ff8378p-1f,
+    -0x1.ff80b8p-1f,
+    -0x1.ff7decp-1f,
+    -0x1.ff7b14p-1f,
+    -0x1.ff7838p-1f,
+    -0x1.ff7554p-1f,
+    -0x1.ff726cp-1f,
+    -0x1.ff6f78p-1f,
+    -0x1.ff6c8p-1f,
+    -0x1.ff6978p-1f,
+    -0x1.ff667p-1f,
+    -0x1.ff635cp-1f,
+    -0x1.ff604p-1f,
+    -0x1.ff5d1cp-1f,
+    -0x1.ff59fp-1f,
+    -0x1.ff56cp-1f,
+    -0x1.ff5388p-1f,
+    -0x1.ff5048p-1f,
+    -0x1.ff4cf8p-1f,
+    -0x1.ff49acp-1f,
+    -0x1.ff465p-1f,
+    -0x1.ff42ecp-1f,
+    -0x1.ff3f8p-1f,
+    -0x1.ff3c1p-1f,
+    -0x1.ff3894p-1f,
+    -0x1.ff3514p-1f,
+    -0x1.ff319p-1f,
+    -0x1.ff2df8p-1f,
+    -0x1.ff2a5cp-1f,
+    -0x1.ff26cp-1f,
+    -0x1.ff2314p-1f,
+    -0x1.ff1f64p-1f,
+    -0x1.ff1bacp-1f,
+    -0x1.ff17ecp-1f,
+    -0x1.ff141cp-1f,
+    -0x1.ff105p-1f,
+    -0x1.ff0c7p-1f,
+    -0x1.ff0894p-1f,
+    -0x1.ff04acp-1f,
+    -0x1.ff00b8p-1f,
+    -0x1.fefccp-1f,
+    -0x1.fef8cp-1f,
+    -0x1.fef4bp-1f,
+    -0x1.fef0a4p-1f,
+    -0x1.feec9p-1f,
+    -0x1.fee86cp-1f,
+    -0x1.fee44p-1f,
+    -0x1.fee01p-1f,
+    -0x1.fedbd4p-1f,
+    -0x1.fed794p-1f,
+    -0x1.fed35p-1f,
+    -0x1.fecef8p-1f,
+    -0x1.fecaa4p-1f,
+    -0x1.fec64p-1f,
+    -0x1.fec1d4p-1f,
+    -0x1.febd64p-1f,
+    -0x1.feb8ecp-1f,
+    -0x1.feb46cp-1f,
+    -0x1.feafe4p-1f,
+    -0x1.feab5p-1f,
+    -0x1.fea6b8p-1f,
+    -0x1.fea214p-1f,
+    -0x1.fe9d6cp-1f,
+    -0x1.fe98b8p-1f,
+    -0x1.fe94p-1f,
+    -0x1.fe8f4p-1f,
+    -0x1.fe8a78p-1f,
+    -0x1.fe85a4p-1f,
+    -0x1.fe80dp-1f,
+    -0x1.fe7becp-1f,
+    -0x1.fe77p-1f,
+    -0x1.fe721p-1f,
+    -0x1.fe6d14p-1f,
+    -0x1.fe681p-1f,
+    -0x1.fe6308p-1f,
+    -0x1.fe5dfp-1f,
+    -0x1.fe58dcp-1f,
+    -0x1.fe53b8p-1f,
+    -0x1.fe4e9p-1f,
+    -0x1.fe495cp-1f,
+    -0x1.fe441cp-1f,
+    -0x1.fe3edcp-1f,
+    -0x1.fe3994p-1f,
+    -0x1.fe344p-1f,
+    -0x1.fe2ee4p-1f,
+    -0x1.fe298p-1f,
+    -0x1.fe2414p-1f,
+    -0x1.fe1ea4p-1f,
+    -0x1.fe1924p-1f,
+    -0x1.fe13a4p-1f,
+    -0x1.fe0e14p-1f,
+    -0x1.fe088p-1f,
+    -0x1.fe02e4p-1f,
+    -0x1.fdfd4p-1f,
+    -0x1.fdf794p-1f,
+    -0x1.fdf1e4p-1f,
+    -0x1.fdec24p-1f,
+    -0x1.fde65cp-1f,
+    -0x1.fde094p-1f,
+    -0x1.fddacp-1f,
+    -0x1.fdd4dcp-1f,
+    -0x1.fdcef8p-1f,
+    -0x1.fdc91p-1f,
+    -0x1.fdc314p-1f,
+    -0x1.fdbd14p-1f,
+    -0x1.fdb714p-1f,
+    -0x1.fdb108p-1f,
+    -0x1.fdaaecp-1f,
+    -0x1.fda4dp-1f,
+    -0x1.fd9eacp-1f,
+    -0x1.fd9878p-1f,
+    -0x1.fd924p-1f,
+    -0x1.fd8cp-1f,
+    -0x1.fd85b8p-1f,
+    -0x1.fd7f6cp-1f,
+    -0x1.fd7914p-1f,
+    -0x1.fd72bp-1f,
+    -0x1.fd6c48p-1f,
+    -0x1.fd65dcp-1f,
+    -0x1.fd5f64p-1f,
+    -0x1.fd58e4p-1f,
+    -0x1.fd5254p-1f,
+    -0x1.fd4bc8p-1f,
+    -0x1.fd452cp-1f,
+    -0x1.fd3e88p-1f,
+    -0x1.fd37dcp-1f,
+    -0x1.fd312cp-1f,
+    -0x1.fd2a7p-1f,
+    -0x1.fd23bp-1f,
+    -0x1.fd1ce4p-1f,
+    -0x1.fd161p-1f,
+    -0x1.fd0f3p-1f,
+    -0x1.fd085p-1f,
+    -0x1.fd0164p-1f,
+    -0x1.fcfa7p-1f,
+    -0x1.fcf37p-1f,
+    -0x1.fcec7p-1f,
+    -0x1.fce564p-1f,
+    -0x1.fcde5p-1f,
+    -0x1.fcd73p-1f,
+    -0x1.fcd008p-1f,
+    -0x1.fcc8dcp-1f,
+    -0x1.fcc1a4p-1f,
+    -0x1.fcba64p-1f,
+    -0x1.fcb31cp-1f,
+    -0x1.fcabdp-1f,
+    -0x1.fca478p-1f,
+    -0x1.fc9d14p-1f,
+    -0x1.fc95acp-1f,
+    -0x1.fc8e4p-1f,
+    -0x1.fc86c8p-1f,
+    -0x1.fc7f4p-1f,
+    -0x1.fc77b8p-1f,
+    -0x1.fc702cp-1f,
+    -0x1.fc689p-1f,
+    -0x1.fc60ecp-1f,
+    -0x1.fc594p-1f,
+    -0x1.fc519p-1f,
+    -0x1.fc49dp-1f,
+    -0x1.fc421p-1f,
+    -0x1.fc3a4p-1f,
+    -0x1.fc326cp-1f,
+    -0x1.fc2a9p-1f,
+    -0x1.fc22acp-1f,
+    -0x1.fc1acp-1f,
+    -0x1.fc12c8p-1f,
+    -0x1.fc0ac8p-1f,
+    -0x1.fc02cp-1f,
+    -0x1.fbfabp-1f,
+    -0x1.fbf29cp-1f,
+    -0x1.fbea8p-1f,
+    -0x1.fbe254p-1f,
+    -0x1.fbda24p-1f,
+    -0x1.fbd1ecp-1f,
+    -0x1.fbc9acp-1f,
+    -0x1.fbc164p-1f,
+    -0x1.fbb91p-1f,
+    -0x1.fbb0bp-1f,
+    -0x1.fba854p-1f,
+    -0x1.fb9fe4p-1f,
+    -0x1.fb977p-1f,
+    -0x1.fb8ef8p-1f,
+    -0x1.fb867p-1f,
+    -0x1.fb7de4p-1f,
+    -0x1.fb755p-1f,
+    -0x1.fb6cbp-1f,
+    -0x1.fb641p-1f,
+    -0x1.fb5b5cp-1f,
+    -0x1.fb52acp-1f,
+    -0x1.fb49ecp-1f,
+    -0x1.fb4124p-1f,
+    -0x1.fb3854p-1f,
+    -0x1.fb2f78p-1f,
+    -0x1.fb2694p-1f,
+    -0x1.fb1dacp-1f,
+    -0x1.fb14cp-1f,
+    -0x1.fb0bcp-1f,
+    -0x1.fb02cp-1f,
+    -0x1.faf9bp-1f,
+    -0x1.faf0a4p-1f,
+    -0x1.fae788p-1f,
+    -0x1.fade64p-1f,
+    -0x1.fad53p-1f,
+    -0x1.faccp-1f,
+    -0x1.fac2cp-1f,
+    -0x1.fab978p-1f,
+    -0x1.fab02cp-1f,
+    -0x1.faa6d4p-1f,
+    -0x1.fa9d7p-1f,
+    -0x1.fa941p-1f,
+    -0x1.fa8a9cp-1f,
+    -0x1.fa8124p-1f,
+    -0x1.fa779cp-1f,
+    -0x1.fa6e14p-1f,
+    -0x1.fa648p-1f,
+    -0x1.fa5ae4p-1f,
+    -0x1.fa5148p-1f,
+    -0x1.fa4794p-1f,
+    -0x1.fa3de4p-1f,
+    -0x1.fa3424p-1f,
+    -0x1.fa2a5cp-1f,
+    -0x1.fa209p-1f,
+    -0x1.fa16b8p-1f,
+    -0x1.fa0cdcp-1f,
+    -0x1.fa02fp-1f,
+    -0x1.f9f9p-1f,
+    -0x1.f9ef08p-1f,
+    -0x1.f9e508p-1f,
+    -0x1.f9dbp-1f,
+    -0x1.f9d0ecp-1f,
+    -0x1.f9c6dp-1f,
+    -0x1.f9bcacp-1f,
+    -0x1.f9b28p-1f,
+    -0x1.f9a848p-1f,
+    -0x1.f99e1p-1f,
+    -0x1.f993c8p-1f,
+    -0x1.f98978p-1f,
+    -0x1.f97f24p-1f,
+    -0x1.f974cp-1f,
+    -0x1.f96a54p-1f,
+    -0x1.f95fe4p-1f,
+    -0x1.f9556cp-1f,
+    -0x1.f94aecp-1f,
+    -0x1.f94064p-1f,
+    -0x1.f935dp-1f,
+    -0x1.f92b3p-1f,
+    -0x1.f9209p-1f,
+    -0x1.f915e4p-1f,
+    -0x1.f90b2cp-1f,
+    -0x1.f9006cp-1f,
+    -0x1.f8f5a4p-1f,
+    -0x1.f8ead4p-1f,
+    -0x1.f8ep-1f,
+    -0x1.f8d51cp-1f,
+    -0x1.f8ca3p-1f,
+    -0x1.f8bf4p-1f,
+    -0x1.f8b448p-1f,
+    -0x1.f8a94p-1f,
+    -0x1.f89e38p-1f,
+    -0x1.f89324p-1f,
+    -0x1.f88808p-1f,
+    -0x1.f87cdcp-1f,
+    -0x1.f871bp-1f,
+    -0x1.f86678p-1f,
+    -0x1.f85b38p-1f,
+    -0x1.f84ffp-1f,
+    -0x1.f8449cp-1f,
+    -0x1.f83948p-1f,
+    -0x1.f82de4p-1f,
+    -0x1.f82278p-1f,
+    -0x1.f81708p-1f,
+    -0x1.f80b88p-1f,
+    -0x1.f8p-1f,
+    -0x1.f7f47p-1f,
+    -0x1.f7e8dcp-1f,
+    -0x1.f7dd4p-1f,
+    -0x1.f7d194p-1f,
+    -0x1.f7c5e4p-1f,
+    -0x1.f7ba2cp-1f,
+    -0x1.f7ae6cp-1f,
+    -0x1.f7a29cp-1f,
+    -0x1.f796dp-1f,
+    -0x1.f78afp-1f,
+    -0x1.f77f08p-1f,
+    -0x1.f7731cp-1f,
+    -0x1.f76724p-1f,
+    -0x1.f75b24p-1f,
+    -0x1.f74f1cp-1f,
+    -0x1.f7431p-1f,
+    -0x1.f736fp-1f,
+    -0x1.f72ad4p-1f,
+    -0x1.f71eacp-1f,
+    -0x1.f7127p-1f,
+    -0x1.f70638p-1f,
+    -0x1.f6f9fp-1f,
+    -0x1.f6eda4p-1f,
+    -0x1.f6e15p-1f,
+    -0x1.f6d4ecp-1f,
+    -0x1.f6c888p-1f,
+    -0x1.f6bc14p-1f,
+    -0x1.f6af9cp-1f,
+    -0x1.f6a314p-1f,
+    -0x1.f6969p-1f,
+    -0x1.f689f8p-1f,
+    -0x1.f67d5cp-1f,
+    -0x1.f670b8p-1f,
+    -0x1.f66408p-1f,
+    -0x1.f6575p-1f,
+    -0x1.f64a9p-1f,
+    -0x1.f63dc8p-1f,
+    -0x1.f630f8p-1f,
+    -0x1.f6241cp-1f,
+    -0x1.f61738p-1f,
+    -0x1.f60a5p-1f,
+    -0x1.f5fd54p-1f,
+    -0x1.f5f05cp-1f,
+    -0x1.f5e354p-1f,
+    -0x1.f5d64p-1f,
+    -0x1.f5c92cp-1f,
+    -0x1.f5bc08p-1f,
+    -0x1.f5aedcp-1f,
+    -0x1.f5a1acp-1f,
+    -0x1.f5947p-1f,
+    -0x1.f5872cp-1f,
+    -0x1.f579dcp-1f,
+    -0x1.f56c88p-1f,
+    -0x1.f55f2cp-1f,
+    -0x1.f551cp-1f,
+    -0x1.f5445p-1f,
+    -0x1.f536d4p-1f,
+    -0x1.f52954p-1f,
+    -0x1.f51bc8p-1f,
+    -0x1.f50e3p-1f,
+    -0x1.f50094p-1f,
+    -0x1.f4f2fp-1f,
+    -0x1.f4e54p-1f,
+    -0x1.f4d788p-1f,
+    -0x1.f4c9c8p-1f,
+    -0x1.f4bcp-1f,
+    -0x1.f4ae2cp-1f,
+    -0x1.f4a05p-1f,
+    -0x1.f4926cp-1f,
+    -0x1.f4848p-1f,
+    -0x1.f47688p-1f,
+    -0x1.f46888p-1f,
+    -0x1.f45a8p-1f,
+    -0x1.f44c7p-1f,
+    -0x1.f43e54p-1f,
+    -0x1.f4303p-1f,
+    -0x1.f42208p-1f,
+    -0x1.f413dp-1f,
+    -0x1.f40594p-1f,
+    -0x1.f3f75p-1f,
+    -0x1.f3e8f8p-1f,
+    -0x1.f3daa4p-1f,
+    -0x1.f3cc4p-1f,
+    -0x1.f3bdd4p-1f,
+    -0x1.f3af64p-1f,
+    -0x1.f3a0e4p-1f,
+    -0x1.f39264p-1f,
+    -0x1.f383dp-1f,
+    -0x1.f37538p-1f,
+    -0x1.f3669cp-1f,
+    -0x1.f357fp-1f,
+    -0x1.f3494p-1f,
+    -0x1.f33a8p-1f,
+    -0x1.f32bcp-1f,
+    -0x1.f31cfp-1f,
+    -0x1.f30e14p-1f,
+    -0x1.f2ff38p-1f,
+    -0x1.f2f05p-1f,
+    -0x1.f2e15cp-1f,
+    -0x1.f2d264p-1f,
+    -0x1.f2c35cp-1f,
+    -0x1.f2b454p-1f,
+    -0x1.f2a54p-1f,
+    -0x1.f2961cp-1f,
+    -0x1.f286f8p-1f,
+    -0x1.f277c8p-1f,
+    -0x1.f2689p-1f,
+    -0x1.f25948p-1f,
+    -0x1.f249f8p-1f,
+    -0x1.f23aacp-1f,
+    -0x1.f22b48p-1f,
+    -0x1.f21be4p-1f,
+    -0x1.f20c7p-1f,
+    -0x1.f1fcf8p-1f,
+    -0x1.f1ed78p-1f,
+    -0x1.f1ddecp-1f,
+    -0x1.f1ce54p-1f,
+    -0x1.f1beb8p-1f,
+    -0x1.f1af1p-1f,
+    -0x1.f19f64p-1f,
+    -0x1.f18facp-1f,
+    -0x1.f17fe4p-1f,
+    -0x1.f1701cp-1f,
+    -0x1.f16048p-1f,
+    -0x1.f1506cp-1f,
+    -0x1.f1408p-1f,
+    -0x1.f13094p-1f,
+    -0x1.f1209cp-1f,
+    -0x1.f11094p-1f,
+    -0x1.f1009p-1f,
+    -0x1.f0f078p-1f,
+    -0x1.f0e05cp-1f,
+    -0x1.f0d03p-1f,
+    -0x1.f0c008p-1f,
+    -0x1.f0afdp-1f,
+    -0x1.f09f88p-1f,
+    -0x1.f08f4p-1f,
+    -0x1.f07eecp-1f,
+    -0x1.f06e9p-1f,
+    -0x1.f05e24p-1f,
+    -0x1.f04db8p-1f,
+    -0x1.f03d4p-1f,
+    -0x1.f02cb8p-1f,
+    -0x1.f01c3p-1f,
+    -0x1.f00b9cp-1f,
+    -0x1.effbp-1f,
+    -0x1.efea54p-1f,
+    -0x1.efd9a4p-1f,
+    -0x1.efc8ecp-1f,
+    -0x1.efb82cp-1f,
+    -0x1.efa75cp-1f,
+    -0x1.ef9688p-1f,
+    -0x1.ef85acp-1f,
+    -0x1.ef74cp-1f,
+    -0x1.ef63d4p-1f,
+    -0x1.ef52d4p-1f,
+    -0x1.ef41d4p-1f,
+    -0x1.ef30c8p-1f,
+    -0x1.ef1fbp-1f,
+    -0x1.ef0e94p-1f,
+    -0x1.eefd6cp-1f,
+    -0x1.eeec38p-1f,
+    -0x1.eedbp-1f,
+    -0x1.eec9b8p-1f,
+    -0x1.eeb87p-1f,
+    -0x1.eea714p-1f,
+    -0x1.ee95b8p-1f,
+    -0x1.ee845p-1f,
+    -0x1.ee72dcp-1f,
+    -0x1.ee6164p-1f,
+    -0x1.ee4fdcp-1f,
+    -0x1.ee3e5p-1f,
+    -0x1.ee2cb8p-1f,
+    -0x1.ee1b14p-1f,
+    -0x1.ee096cp-1f,
+    -0x1.edf7b8p-1f,
+    -0x1.ede5f8p-1f,
+    -0x1.edd43p-1f,
+    -0x1.edc264p-1f,
+    -0x1.edb09p-1f,
+    -0x1.ed9eacp-1f,
+    -0x1.ed8ccp-1f,
+    -0x1.ed7ac8p-1f,
+    -0x1.ed68dp-1f,
+    -0x1.ed56c8p-1f,
+    -0x1.ed44bp-1f,
+    -0x1.ed329cp-1f,
+    -0x1.ed2078p-1f,
+    -0x1.ed0e5p-1f,
+    -0x1.ecfc14p-1f,
+    -0x1.ece9d4p-1f,
+    -0x1.ecd788p-1f,
+    -0x1.ecc538p-1f,
+    -0x1.ecb2dcp-1f,
+    -0x1.eca078p-1f,
+    -0x1.ec8e08p-1f,
+    -0x1.ec7b94p-1f,
+    -0x1.ec691p-1f,
+    -0x1.ec5688p-1f,
+    -0x1.ec43fp-1f,
+    -0x1.ec3154p-1f,
+    -0x1.ec1eacp-1f,
+    -0x1.ec0cp-1f,
+    -0x1.ebf94p-1f,
+    -0x1.ebe68p-1f,
+    -0x1.ebd3bp-1f,
+    -0x1.ebc0dcp-1f,
+    -0x1.ebaep-1f,
+    -0x1.eb9b14p-1f,
+    -0x1.eb8824p-1f,
+    -0x1.eb7524p-1f,
+    -0x1.eb6224p-1f,
+    -0x1.eb4f1p-1f,
+    -0x1.eb3bf8p-1f,
+    -0x1.eb28d4p-1f,
+    -0x1.eb15acp-1f,
+    -0x1.eb0278p-1f,
+    -0x1.eaef38p-1f,
+    -0x1.eadbfp-1f,
+    -0x1.eac8a4p-1f,
+    -0x1.eab548p-1f,
+    -0x1.eaa1e4p-1f,
+    -0x1.ea8e7p-1f,
+    -0x1.ea7bp-1f,
+    -0x1.ea678p-1f,
+    -0x1.ea53fp-1f,
+    -0x1.ea405cp-1f,
+    -0x1.ea2ccp-1f,
+    -0x1.ea191cp-1f,
+    -0x1.ea056cp-1f,
+    -0x1.e9f1bp-1f,
+    -0x1.e9ddecp-1f,
+    -0x1.e9ca24p-1f,
+    -0x1.e9b648p-1f,
+    -0x1.e9a26cp-1f,
+    -0x1.e98e8p-1f,
+    -0x1.e97a9p-1f,
+    -0x1.e9669p-1f,
+    -0x1.e9529p-1f,
+    -0x1.e93e78p-1f,
+    -0x1.e92a64p-1f,
+    -0x1.e9164p-1f,
+    -0x1.e90214p-1f,
+    -0x1.e8eddcp-1f,
+    -0x1.e8d99cp-1f,
+    -0x1.e8c554p-1f,
+    -0x1.e8b1p-1f,
+    -0x1.e89ca4p-1f,
+    -0x1.e8884p-1f,
+    -0x1.e873dp-1f,
+    -0x1.e85f54p-1f,
+    -0x1.e84adp-1f,
+    -0x1.e83648p-1f,
+    -0x1.e821acp-1f,
+    -0x1.e80d1p-1f,
+    -0x1.e7f864p-1f,
+    -0x1.e7e3bp-1f,
+    -0x1.e7cefp-1f,
+    -0x1.e7ba2cp-1f,
+    -0x1.e7a55cp-1f,
+    -0x1.e7908p-1f,
+    -0x1.e77b9cp-1f,
+    -0x1.e766bp-1f,
+    -0x1.e751b8p-1f,
+    -0x1.e73cb8p-1f,
+    -0x1.e727bp-1f,
+    -0x1.e7129cp-1f,
+    -0x1.e6fd8p-1f,
+    -0x1.e6e854p-1f,
+    -0x1.e6d324p-1f,
+    -0x1.e6bdecp-1f,
+    -0x1.e6a8a4p-1f,
+    -0x1.e69354p-1f,
+    -0x1.e67ep-1f,
+    -0x1.e6689cp-1f,
+    -0x1.e6533p-1f,
+    -0x1.e63dcp-1f,
+    -0x1.e6284p-1f,
+    -0x1.e612b8p-1f,
+    -0x1.e5fd24p-1f,
+    -0x1.e5e788p-1f,
+    -0x1.e5d1e4p-1f,
+    -0x1.e5bc3p-1f,
+    -0x1.e5a678p-1f,
+    -0x1.e590bp-1f,
+    -0x1.e57ae4p-1f,
+    -0x1.e5651p-1f,
+    -0x1.e54f2cp-1f,
+    -0x1.e5394p-1f,
+    -0x1.e5235p-1f,
+    -0x1.e50d5p-1f,
+    -0x1.e4f748p-1f,
+    -0x1.e4e138p-1f,
+    -0x1.e4cb1cp-1f,
+    -0x1.e4b4f8p-1f,
+    -0x1.e49ec8p-1f,
+    -0x1.e4889p-1f,
+    -0x1.e47248p-1f,
+    -0x1.e45bf8p-1f,
+    -0x1.e445a4p-1f,
+    -0x1.e42f48p-1f,
+    -0x1.e418dcp-1f,
+    -0x1.e40264p-1f,
+    -0x1.e3ebecp-1f,
+    -0x1.e3d564p-1f,
+    -0x1.e3bedp-1f,
+    -0x1.e3a83p-1f,
+    -0x1.e3919p-1f,
+    -0x1.e37adcp-1f,
+    -0x1.e36424p-1f,
+    -0x1.e34d64p-1f,
+    -0x1.e33694p-1f,
+    -0x1.e31fb8p-1f,
+    -0x1.e308dcp-1f,
+    -0x1.e2f1fp-1f,
+    -0x1.e2daf8p-1f,
+    -0x1.e2c3f8p-1f,
+    -0x1.e2acfp-1f,
+    -0x1.e295e4p-1f,
+    -0x1.e27ec8p-1f,
+    -0x1.e2679cp-1f,
+    -0x1.e2506cp-1f,
+    -0x1.e2393p-1f,
+    -0x1.e221ecp-1f,
+    -0x1.e20a9cp-1f,
+    -0x1.e1f348p-1f,
+    -0x1.e1dbe4p-1f,
+    -0x1.e1c478p-1f,
+    -0x1.e1adp-1f,
+    -0x1.e1958p-1f,
+    -0x1.e17dfp-1f,
+    -0x1.e16664p-1f,
+    -0x1.e14ecp-1f,
+    -0x1.e1371cp-1f,
+    -0x1.e11f64p-1f,
+    -0x1.e107acp-1f,
+    -0x1.e0efe4p-1f,
+    -0x1.e0d81p-1f,
+    -0x1.e0c038p-1f,
+    -0x1.e0a85p-1f,
+    -0x1.e09064p-1f,
+    -0x1.e0786cp-1f,
+    -0x1.e06064p-1f,
+    -0x1.e0485cp-1f,
+    -0x1.e0304p-1f,
+    -0x1.e0181cp-1f,
+    -0x1.dffffp-1f,
+    -0x1.dfe7cp-1f,
+    -0x1.dfcf8p-1f,
+    -0x1.dfb738p-1f,
+    -0x1.df9ee4p-1f,
+    -0x1.df8688p-1f,
+    -0x1.df6e1cp-1f,
+    -0x1.df55acp-1f,
+    -0x1.df3d3p-1f,
+    -0x1.df24acp-1f,
+    -0x1.df0c14p-1f,
+    -0x1.def38p-1f,
+    -0x1.dedadcp-1f,
+    -0x1.dec22cp-1f,
+    -0x1.dea97p-1f,
+    -0x1.de90acp-1f,
+    -0x1.de77dcp-1f,
+    -0x1.de5f08p-1f,
+    -0x1.de4624p-1f,
+    -0x1.de2d38p-1f,
+    -0x1.de144p-1f,
+    -0x1.ddfb4p-1f,
+    -0x1.dde238p-1f,
+    -0x1.ddc924p-1f,
+    -0x1.ddbp-1f,
+    -0x1.dd96d4p-1f,
+    -0x1.dd7da4p-1f,
+    -0x1.dd6464p-1f,
+    -0x1.dd4b1cp-1f,
+    -0x1.dd31dp-1f,
+    -0x1.dd187p-1f,
+    -0x1.dcff08p-1f,
+    -0x1.dce594p-1f,
+    -0x1.dccc1cp-1f,
+    -0x1.dcb294p-1f,
+    -0x1.dc9908p-1f,
+    -0x1.dc7f6cp-1f,
+    -0x1.dc65c8p-1f,
+    -0x1.dc4c1cp-1f,
+    -0x1.dc325cp-1f,
+    -0x1.dc189cp-1f,
+    -0x1.dbfedp-1f,
+    -0x1.dbe4f8p-1f,
+    -0x1.dbcb14p-1f,
+    -0x1.dbb124p-1f,
+    -0x1.db973p-1f,
+    -0x1.db7d2cp-1f,
+    -0x1.db6324p-1f,
+    -0x1.db491p-1f,
+    -0x1.db2eecp-1f,
+    -0x1.db14cp-1f,
+    -0x1.dafa88p-1f,
+    -0x1.dae05p-1f,
+    -0x1.dac6p-1f,
+    -0x1.daabacp-1f,
+    -0x1.da915p-1f,
+    -0x1.da76e4p-1f,
+    -0x1.da5c7p-1f,
+    -0x1.da41fp-1f,
+    -0x1.da276cp-1f,
+    -0x1.da0cdcp-1f,
+    -0x1.d9f238p-1f,
+    -0x1.d9d79p-1f,
+    -0x1.d9bcdcp-1f,
+    -0x1.d9a224p-1f,
+    -0x1.d9875cp-1f,
+    -0x1.d96c88p-1f,
+    -0x1.d951bp-1f,
+    -0x1.d936c8p-1f,
+    -0x1.d91bd4p-1f,
+    -0x1.d900dcp-1f,
+    -0x1.d8e5d4p-1f,
+    -0x1.d8cac8p-1f,
+    -0x1.d8afacp-1f,
+    -0x1.d8948p-1f,
+    -0x1.d87954p-1f,
+    -0x1.d85e1cp-1f,
+    -0x1.d842d4p-1f,
+    -0x1.d82788p-1f,
+    -0x1.d80c2cp-1f,
+    -0x1.d7f0cp-1f,
+    -0x1.d7d554p-1f,
+    -0x1.d7b9dcp-1f,
+    -0x1.d79e54p-1f,
+    -0x1.d782c8p-1f,
+    -0x1.d7672cp-1f,
+    -0x1.d74b88p-1f,
+    -0x1.d72fd4p-1f,
+    -0x1.d7141cp-1f,
+    -0x1.d6f85cp-1f,
+    -0x1.d6dc9p-1f,
+    -0x1.d6c0bp-1f,
+    -0x1.d6a4dp-1f,
+    -0x1.d688e4p-1f,
+    -0x1.d66cecp-1f,
+    -0x1.d650e4p-1f,
+    -0x1.d634d4p-1f,
+    -0x1.d618b8p-1f,
+    -0x1.d5fc94p-1f,
+    -0x1.d5e06cp-1f,
+    -0x1.d5c43p-1f,
+    -0x1.d5a7ecp-1f,
+    -0x1.d58b9cp-1f,
+    -0x1.d56f48p-1f,
+    -0x1.d552e4p-1f,
+    -0x1.d5367p-1f,
+    -0x1.d519f8p-1f,
+    -0x1.d4fd7p-1f,
+    -0x1.d4e0e4p-1f,
+    -0x1.d4c448p-1f,
+    -0x1.d4a7a4p-1f,
+    -0x1.d48af8p-1f,
+    -0x1.d46e4p-1f,
+    -0x1.d45178p-1f,
+    -0x1.d434acp-1f,
+    -0x1.d417dp-1f,
+    -0x1.d3fae4p-1f,
+    -0x1.d3ddf8p-1f,
+    -0x1.d3c1p-1f,
+    -0x1.d3a3f8p-1f,
+    -0x1.d386ecp-1f,
+    -0x1.d369dp-1f,
+    -0x1.d34cacp-1f,
+    -0x1.d32f78p-1f,
+    -0x1.d31238p-1f,
+    -0x1.d2f4f8p-1f,
+    -0x1.d2d7a4p-1f,
+    -0x1.d2ba48p-1f,
+    -0x1.d29ce4p-1f,
+    -0x1.d27f7p-1f,
+    -0x1.d261fp-1f,
+    -0x1.d2446cp-1f,
+    -0x1.d226d4p-1f,
+    -0x1.d20938p-1f,
+    -0x1.d1eb9p-1f,
+    -0x1.d1cddcp-1f,
+    -0x1.d1b01cp-1f,
+    -0x1.d19254p-1f,
+    -0x1.d1748p-1f,
+    -0x1.d156a4p-1f,
+    -0x1.d138b8p-1f,
+    -0x1.d11ac8p-1f,
+    -0x1.d0fccp-1f,
+    -0x1.d0deb8p-1f,
+    -0x1.d0c0a4p-1f,
+    -0x1.d0a28p-1f,
+    -0x1.d08454p-1f,
+    -0x1.d0661cp-1f,
+    -0x1.d047dcp-1f,
+    -0x1.d0299p-1f,
+    -0x1.d00b38p-1f,
+    -0x1.cfecd4p-1f,
+    -0x1.cfce64p-1f,
+    -0x1.cfafecp-1f,
+    -0x1.cf916cp-1f,
+    -0x1.cf72d4p-1f,
+    -0x1.cf544p-1f,
+    -0x1.cf359cp-1f,
+    -0x1.cf16ecp-1f,
+    -0x1.cef83p-1f,
+    -0x1.ced964p-1f,
+    -0x1.ceba94p-1f,
+    -0x1.ce9bb8p-1f,
+    -0x1.ce7cdp-1f,
+    -0x1.ce5ddcp-1f,
+    -0x1.ce3edcp-1f,
+    -0x1.ce1fd4p-1f,
+    -0x1.ce00cp-1f,
+    -0x1.cde19cp-1f,
+    -0x1.cdc278p-1f,
+    -0x1.cda338p-1f,
+    -0x1.cd83f8p-1f,
+    -0x1.cd64bp-1f,
+    -0x1.cd4554p-1f,
+    -0x1.cd25f8p-1f,
+    -0x1.cd0688p-1f,
+    -0x1.cce71p-1f,
+    -0x1.ccc788p-1f,
+    -0x1.cca7f8p-1f,
+    -0x1.cc885cp-1f,
+    -0x1.cc68b8p-1f,
+    -0x1.cc49p-1f,
+    -0x1.cc2948p-1f,
+    -0x1.cc098p-1f,
+    -0x1.cbe9acp-1f,
+    -0x1.cbc9dp-1f,
+    -0x1.cba9e4p-1f,
+    -0x1.cb89ecp-1f,
+    -0x1.cb69ecp-1f,
+    -0x1.cb49dcp-1f,
+    -0x1.cb29c8p-1f,
+    -0x1.cb09a4p-1f,
+    -0x1.cae978p-1f,
+    -0x1.cac94p-1f,
+    -0x1.caa8f8p-1f,
+    -0x1.ca88a4p-1f,
+    -0x1.ca6848p-1f,
+    -0x1.ca47e4p-1f,
+    -0x1.ca277p-1f,
+    -0x1.ca06fp-1f,
+    -0x1.c9e66cp-1f,
+    -0x1.c9c5d4p-1f,
+    -0x1.c9a538p-1f,
+    -0x1.c9849p-1f,
+    -0x1.c963d4p-1f,
+    -0x1.c9431p-1f,
+    -0x1.c9224p-1f,
+    -0x1.c9016cp-1f,
+    -0x1.c8e08p-1f,
+    -0x1.c8bf94p-1f,
+    -0x1.c89e94p-1f,
+    -0x1.c87d9p-1f,
+    -0x1.c85c78p-1f,
+    -0x1.c83b5cp-1f,
+    -0x1.c81a3p-1f,
+    -0x1.c7f8f8p-1f,
+    -0x1.c7d7b8p-1f,
+    -0x1.c7b66cp-1f,
+    -0x1.c79514p-1f,
+    -0x1.c773bp-1f,
+    -0x1.c7524p-1f,
+    -0x1.c730c8p-1f,
+    -0x1.c70f4p-1f,
+    -0x1.c6edbp-1f,
+    -0x1.c6cc1p-1f,
+    -0x1.c6aa64p-1f,
+    -0x1.c688acp-1f,
+    -0x1.c666fp-1f,
+    -0x1.c6451cp-1f,
+    -0x1.c62348p-1f,
+    -0x1.c60164p-1f,
+    -0x1.c5df7p-1f,
+    -0x1.c5bd78p-1f,
+    -0x1.c59b7p-1f,
+    -0x1.c5795cp-1f,
+    -0x1.c5574p-1f,
+    -0x1.c53514p-1f,
+    -0x1.c512dcp-1f,
+    -0x1.c4f09cp-1f,
+    -0x1.c4ce5p-1f,
+    -0x1.c4abf8p-1f,
+    -0x1.c4899p-1f,
+    -0x1.c46724p-1f,
+    -0x1.c444a4p-1f,
+    -0x1.c42214p-1f,
+    -0x1.c3ff88p-1f,
+    -0x1.c3dce4p-1f,
+    -0x1.c3ba38p-1f,
+    -0x1.c3978p-1f,
+    -0x1.c374b8p-1f,
+    -0x1.c351ecp-1f,
+    -0x1.c32f1p-1f,
+    -0x1.c30c2cp-1f,
+    -0x1.c2e938p-1f,
+    -0x1.c2c638p-1f,
+    -0x1.c2a32cp-1f,
+    -0x1.c28014p-1f,
+    -0x1.c25cfp-1f,
+    -0x1.c239cp-1f,
+    -0x1.c21688p-1f,
+    -0x1.c1f34p-1f,
+    -0x1.c1cfecp-1f,
+    -0x1.c1ac9p-1f,
+    -0x1.c18924p-1f,
+    -0x1.c165acp-1f,
+    -0x1.c1422cp-1f,
+    -0x1.c11e9cp-1f,
+    -0x1.c0fbp-1f,
+    -0x1.c0d754p-1f,
+    -0x1.c0b3a4p-1f,
+    -0x1.c08fe4p-1f,
+    -0x1.c06c14p-1f,
+    -0x1.c0484p-1f,
+    -0x1.c0245cp-1f,
+    -0x1.c0007p-1f,
+    -0x1.bfdc7p-1f,
+    -0x1.bfb86cp-1f,
+    -0x1.bf9454p-1f,
+    -0x1.bf703p-1f,
+    -0x1.bf4c08p-1f,
+    -0x1.bf27dp-1f,
+    -0x1.bf039p-1f,
+    -0x1.bedf38p-1f,
+    -0x1.bebae4p-1f,
+    -0x1.be9678p-1f,
+    -0x1.be72p-1f,
+    -0x1.be4d78p-1f,
+    -0x1.be28fp-1f,
+    -0x1.be0454p-1f,
+    -0x1.bddfbp-1f,
+    -0x1.bdbaf8p-1f,
+    -0x1.bd964p-1f,
+    -0x1.bd717p-1f,
+    -0x1.bd4c9cp-1f,
+    -0x1.bd27b8p-1f,
+    -0x1.bd02cp-1f,
+    -0x1.bcddc8p-1f,
+    -0x1.bcb8cp-1f,
+    -0x1.bc93a4p-1f,
+    -0x1.bc6e88p-1f,
+    -0x1.bc4954p-1f,
+    -0x1.bc2424p-1f,
+    -0x1.bbfedcp-1f,
+    -0x1.bbd988p-1f,
+    -0x1.bbb424p-1f,
+    -0x1.bb8eb8p-1f,
+    -0x1.bb694p-1f,
+    -0x1.bb43b8p-1f,
+    -0x1.bb1e2cp-1f,
+    -0x1.baf888p-1f,
+    -0x1.bad2e4p-1f,
+    -0x1.baad2cp-1f,
+    -0x1.ba8764p-1f,
+    -0x1.ba6194p-1f,
+    -0x1.ba3bb8p-1f,
+    -0x1.ba15dp-1f,
+    -0x1.b9efd4p-1f,
+    -0x1.b9c9d4p-1f,
+    -0x1.b9a3c8p-1f,
+    -0x1.b97dbp-1f,
+    -0x1.b95788p-1f,
+    -0x1.b9315p-1f,
+    -0x1.b90b1p-1f,
+    -0x1.b8e4cp-1f,
+    -0x1.b8be64p-1f,
+    -0x1.b898p-1f,
+    -0x1.b87188p-1f,
+    -0x1.b84b08p-1f,
+    -0x1.b8248p-1f,
+    -0x1.b7fddcp-1f,
+    -0x1.b7d738p-1f,
+    -0x1.b7b088p-1f,
+    -0x1.b789c8p-1f,
+    -0x1.b762f8p-1f,
+    -0x1.b73c1cp-1f,
+    -0x1.b71538p-1f,
+    -0x1.b6ee4p-1f,
+    -0x1.b6c74p-1f,
+    -0x1.b6a03p-1f,
+    -0x1.b6791cp-1f,
+    -0x1.b651fp-1f,
+    -0x1.b62acp-1f,
+    -0x1.b6038p-1f,
+    -0x1.b5dc3p-1f,
+    -0x1.b5b4dcp-1f,
+    -0x1.b58d7p-1f,
+    -0x1.b566p-1f,
+    -0x1.b53e78p-1f,
+    -0x1.b516ecp-1f,
+    -0x1.b4ef54p-1f,
+    -0x1.b4c7a4p-1f,
+    -0x1.b49ff8p-1f,
+    -0x1.b4783p-1f,
+    -0x1.b45064p-1f,
+    -0x1.b42888p-1f,
+    -0x1.b4009cp-1f,
+    -0x1.b3d8acp-1f,
+    -0x1.b3b0a4p-1f,
+    -0x1.b38894p-1f,
+    -0x1.b36078p-1f,
+    -0x1.b3385p-1f,
+    -0x1.b31014p-1f,
+    -0x1.b2e7d4p-1f,
+    -0x1.b2bf8p-1f,
+    -0x1.b29724p-1f,
+    -0x1.b26ebp-1f,
+    -0x1.b24638p-1f,
+    -0x1.b21dbp-1f,
+    -0x1.b1f51cp-1f,
+    -0x1.b1cc78p-1f,
+    -0x1.b1a3dp-1f,
+    -0x1.b17b14p-1f,
+    -0x1.b15248p-1f,
+    -0x1.b1297p-1f,
+    -0x1.b1009p-1f,
+    -0x1.b0d7a4p-1f,
+    -0x1.b0ae9cp-1f,
+    -0x1.b08594p-1f,
+    -0x1.b05c8p-1f,
+    -0x1.b03354p-1f,
+    -0x1.b00a24p-1f,
+    -0x1.afe0e4p-1f,
+    -0x1.afb794p-1f,
+    -0x1.af8e4p-1f,
+    -0x1.af64dp-1f,
+    -0x1.af3b5cp-1f,
+    -0x1.af11d4p-1f,
+    -0x1.aee848p-1f,
+    -0x1.aebea4p-1f,
+    -0x1.ae94f8p-1f,
+    -0x1.ae6b4p-1f,
+    -0x1.ae4178p-1f,
+    -0x1.ae17a4p-1f,
+    -0x1.adedcp-1f,
+    -0x1.adc3dp-1f,
+    -0x1.ad99d4p-1f,
+    -0x1.ad6fc8p-1f,
+    -0x1.ad45acp-1f,
+    -0x1.ad1b88p-1f,
+    -0x1.acf154p-1f,
+    -0x1.acc71p-1f,
+    -0x1.ac9cc8p-1f,
+    -0x1.ac7264p-1f,
+    -0x1.ac47f8p-1f,
+    -0x1.ac1d8p-1f,
+    -0x1.abf2f8p-1f,
+    -0x1.abc864p-1f,
+    -0x1.ab9dc8p-1f,
+    -0x1.ab7314p-1f,
+    -0x1.ab485cp-1f,
+    -0x1.ab1d9p-1f,
+    -0x1.aaf2bp-1f,
+    -0x1.aac7dp-1f,
+    -0x1.aa9cd4p-1f,
+    -0x1.aa71d4p-1f,
+    -0x1.aa46cp-1f,
+    -0x1.aa1ba4p-1f,
+    -0x1.a9f078p-1f,
+    -0x1.a9c54p-1f,
+    -0x1.a999f8p-1f,
+    -0x1.a96ea4p-1f,
+    -0x1.a9434p-1f,
+    -0x1.a917c8p-1f,
+    -0x1.a8ec48p-1f,
+    -0x1.a8c0cp-1f,
+    -0x1.a89524p-1f,
+    -0x1.a8697p-1f,
+    -0x1.a83dcp-1f,
+    -0x1.a811fp-1f,
+    -0x1.a7e624p-1f,
+    -0x1.a7ba4p-1f,
+    -0x1.a78e5p-1f,
+    -0x1.a7625p-1f,
+    -0x1.a7364p-1f,
+    -0x1.a70a2cp-1f,
+    -0x1.a6ddf8p-1f,
+    -0x1.a6b1c8p-1f,
+    -0x1.a6858p-1f,
+    -0x1.a6592cp-1f,
+    -0x1.a62cc8p-1f,
+    -0x1.a60054p-1f,
+    -0x1.a5d3dcp-1f,
+    -0x1.a5a748p-1f,
+    -0x1.a57abp-1f,
+    -0x1.a54e08p-1f,
+    -0x1.a5215p-1f,
+    -0x1.a4f488p-1f,
+    -0x1.a4c7bp-1f,
+    -0x1.a49ac8p-1f,
+    -0x1.a46dd4p-1f,
+    -0x1.a440d4p-1f,
+    -0x1.a413c8p-1f,
+    -0x1.a3e6acp-1f,
+    -0x1.a3b978p-1f,
+    -0x1.a38c48p-1f,
+    -0x1.a35ef8p-1f,
+    -0x1.a331a4p-1f,
+    -0x1.a30438p-1f,
+    -0x1.a2d6c8p-1f,
+    -0x1.a2a94p-1f,
+    -0x1.a27bacp-1f,
+    -0x1.a24e14p-1f,
+    -0x1.a2205cp-1f,
+    -0x1.a1f2a4p-1f,
+    -0x1.a1c4d4p-1f,
+    -0x1.a196f8p-1f,
+    -0x1.a1691p-1f,
+    -0x1.a13b14p-1f,
+    -0x1.a10d1p-1f,
+    -0x1.a0defp-1f,
+    -0x1.a0b0dp-1f,
+    -0x1.a0829cp-1f,
+    -0x1.a05454p-1f,
+    -0x1.a02608p-1f,
+    -0x1.9ff7a4p-1f,
+    -0x1.9fc93p-1f,
+    -0x1.9f9ab8p-1f,
+    -0x1.9f6c24p-1f,
+    -0x1.9f3d88p-1f,
+    -0x1.9f0edcp-1f,
+    -0x1.9ee024p-1f,
+    -0x1.9eb164p-1f,
+    -0x1.9e828p-1f,
+    -0x1.9e539cp-1f,
+    -0x1.9e24a4p-1f,
+    -0x1.9df59cp-1f,
+    -0x1.9dc68p-1f,
+    -0x1.9d975cp-1f,
+    -0x1.9d682cp-1f,
+    -0x1.9d38ecp-1f,
+    -0x1.9d0994p-1f,
+    -0x1.9cda38p-1f,
+    -0x1.9caac8p-1f,
+    -0x1.9c7b48p-1f,
+    -0x1.9c4bb8p-1f,
+    -0x1.9c1c14p-1f,
+    -0x1.9bec6cp-1f,
+    -0x1.9bbcbp-1f,
+    -0x1.9b8ce4p-1f,
+    -0x1.9b5d08p-1f,
+    -0x1.9b2d1cp-1f,
+    -0x1.9afd24p-1f,
+    -0x1.9acd14p-1f,
+    -0x1.9a9cf8p-1f,
+    -0x1.9a6cd4p-1f,
+    -0x1.9a3c9cp-1f,
+    -0x1.9a0c5p-1f,
+    -0x1.99dbf8p-1f,
+    -0x1.99ab94p-1f,
+    -0x1.997b1cp-1f,
+    -0x1.994a94p-1f,
+    -0x1.991ap-1f,
+    -0x1.98e95cp-1f,
+    -0x1.98b8a4p-1f,
+    -0x1.9887dcp-1f,
+    -0x1.985708p-1f,
+    -0x1.98261cp-1f,
+    -0x1.97f53p-1f,
+    -0x1.97c43p-1f,
+    -0x1.97931cp-1f,
+    -0x1.9761fp-1f,
+    -0x1.9730cp-1f,
+    -0x1.96ff8p-1f,
+    -0x1.96ce2cp-1f,
+    -0x1.969cc8p-1f,
+    -0x1.966b5p-1f,
+    -0x1.9639d4p-1f,
+    -0x1.960838p-1f,
+    -0x1.95d69cp-1f,
+    -0x1.95a4e4p-1f,
+    -0x1.957324p-1f,
+    -0x1.954154p-1f,
+    -0x1.950f6cp-1f,
+    -0x1.94dd78p-1f,
+    -0x1.94ab7p-1f,
+    -0x1.94795cp-1f,
+    -0x1.94474p-1f,
+    -0x1.941508p-1f,
+    -0x1.93e2c8p-1f,
+    -0x1.93b07p-1f,
+    -0x1.937e1p-1f,
+    -0x1.934b94p-1f,
+    -0x1.93191p-1f,
+    -0x1.92e67p-1f,
+    -0x1.92b3d4p-1f,
+    -0x1.928114p-1f,
+    -0x1.924e54p-1f,
+    -0x1.921b78p-1f,
+    -0x1.91e894p-1f,
+    -0x1.91b59cp-1f,
+    -0x1.91829p-1f,
+    -0x1.914f8p-1f,
+    -0x1.911c5p-1f,
+    -0x1.90e914p-1f,
+    -0x1.90b5c8p-1f,
+    -0x1.90826cp-1f,
+    -0x1.904fp-1f,
+    -0x1.901b8p-1f,
+    -0x1.8fe7ecp-1f,
+    -0x1.8fb45p-1f,
+    -0x1.8f80a4p-1f,
+    -0x1.8f4cdcp-1f,
+    -0x1.8f1914p-1f,
+    -0x1.8ee52cp-1f,
+    -0x1.8eb138p-1f,
+    -0x1.8e7d3p-1f,
+    -0x1.8e491cp-1f,
+    -0x1.8e14fcp-1f,
+    -0x1.8de0cp-1f,
+    -0x1.8dac7cp-1f,
+    -0x1.8d782p-1f,
+    -0x1.8d43bp-1f,
+    -0x1.8d0f3cp-1f,
+    -0x1.8cdabp-1f,
+    -0x1.8ca614p-1f,
+    -0x1.8c7164p-1f,
+    -0x1.8c3c9cp-1f,
+    -0x1.8c07dp-1f,
+    -0x1.8bd2fp-1f,
+    -0x1.8b9df4p-1f,
+    -0x1.8b68fp-1f,
+    -0x1.8b33ep-1f,
+    -0x1.8afeb4p-1f,
+    -0x1.8ac97cp-1f,
+    -0x1.8a943p-1f,
+    -0x1.8a5edp-1f,
+    -0x1.8a2968p-1f,
+    -0x1.89f3e8p-1f,
+    -0x1.89be54p-1f,
+    -0x1.8988b4p-1f,
+    -0x1.895308p-1f,
+    -0x1.891d4p-1f,
+    -0x1.88e764p-1f,
+    -0x1.88b184p-1f,
+    -0x1.887b8p-1f,
+    -0x1.88457p-1f,
+    -0x1.880f58p-1f,
+    -0x1.87d92cp-1f,
+    -0x1.87a2fp-1f,
+    -0x1.876c94p-1f,
+    -0x1.87362cp-1f,
+    -0x1.86ffb8p-1f,
+    -0x1.86c93p-1f,
+    -0x1.869298p-1f,
+    -0x1.865be8p-1f,
+    -0x1.862528p-1f,
+    -0x1.85ee58p-1f,
+    -0x1.85b774p-1f,
+    -0x1.85807cp-1f,
+    -0x1.854978p-1f,
+    -0x1.851258p-1f,
+    -0x1.84db3p-1f,
+    -0x1.84a3fp-1f,
+    -0x1.846cap-1f,
+    -0x1.84354p-1f,
+    -0x1.83fdc8p-1f,
+    -0x1.83c644p-1f,
+    -0x1.838ea8p-1f,
+    -0x1.8356fcp-1f,
+    -0x1.831f4p-1f,
+    -0x1.82e76cp-1f,
+    -0x1.82af88p-1f,
+    -0x1.82779p-1f,
+    -0x1.823f88p-1f,
+    -0x1.82076cp-1f,
+    -0x1.81cf4p-1f,
+    -0x1.8197p-1f,
+    -0x1.815eacp-1f,
+    -0x1.812644p-1f,
+    -0x1.80edc8p-1f,
+    -0x1.80b53cp-1f,
+    -0x1.807c98p-1f,
+    -0x1.8043ecp-1f,
+    -0x1.800b2p-1f,
+    -0x1.7fd25p-1f,
+    -0x1.7f9968p-1f,
+    -0x1.7f6064p-1f,
+    -0x1.7f2754p-1f,
+    -0x1.7eee3p-1f,
+    -0x1.7eb4f8p-1f,
+    -0x1.7e7bbp-1f,
+    -0x1.7e4254p-1f,
+    -0x1.7e08ep-1f,
+    -0x1.7dcf64p-1f,
+    -0x1.7d95c8p-1f,
+    -0x1.7d5c1cp-1f,
+    -0x1.7d225cp-1f,
+    -0x1.7ce88cp-1f,
+    -0x1.7caeacp-1f,
+    -0x1.7c74acp-1f,
+    -0x1.7c3aa8p-1f,
+    -0x1.7c0084p-1f,
+    -0x1.7bc65p-1f,
+    -0x1.7b8c08p-1f,
+    -0x1.7b51bp-1f,
+    -0x1.7b1744p-1f,
+    -0x1.7adcc4p-1f,
+    -0x1.7aa23p-1f,
+    -0x1.7a6784p-1f,
+    -0x1.7a2cccp-1f,
+    -0x1.79f1fp-1f,
+    -0x1.79b71p-1f,
+    -0x1.797c14p-1f,
+    -0x1.79411p-1f,
+    -0x1.7905e4p-1f,
+    -0x1.78caacp-1f,
+    -0x1.788f6cp-1f,
+    -0x1.785408p-1f,
+    -0x1.7818ap-1f,
+    -0x1.77dd1p-1f,
+    -0x1.77a178p-1f,
+    -0x1.7765c8p-1f,
+    -0x1.772a08p-1f,
+    -0x1.76ee3p-1f,
+    -0x1.76b244p-1f,
+    -0x1.76763cp-1f,
+    -0x1.763a3p-1f,
+    -0x1.75fe0cp-1f,
+    -0x1.75c1c4p-1f,
+    -0x1.758578p-1f,
+    -0x1.75491p-1f,
+    -0x1.750c9p-1f,
+    -0x1.74dp-1f,
+    -0x1.74936p-1f,
+    -0x1.7456a8p-1f,
+    -0x1.7419ccp-1f,
+    -0x1.73dcfp-1f,
+    -0x1.739ffp-1f,
+    -0x1.7362e4p-1f,
+    -0x1.7325cp-1f,
+    -0x1.72e88cp-1f,
+    -0x1.72ab4p-1f,
+    -0x1.726ddcp-1f,
+    -0x1.72305cp-1f,
+    -0x1.71f2dp-1f,
+    -0x1.71b53p-1f,
+    -0x1.717774p-1f,
+    -0x1.7139bp-1f,
+    -0x1.70fbc4p-1f,
+    -0x1.70bddp-1f,
+    -0x1.707fcp-1f,
+    -0x1.704198p-1f,
+    -0x1.70036p-1f,
+    -0x1.6fc51p-1f,
+    -0x1.6f86acp-1f,
+    -0x1.6f483p-1f,
+    -0x1.6f09a4p-1f,
+    -0x1.6ecbp-1f,
+    -0x1.6e8c44p-1f,
+    -0x1.6e4d6cp-1f,
+    -0x1.6e0e84p-1f,
+    -0x1.6dcf84p-1f,
+    -0x1.6d907p-1f,
+    -0x1.6d514cp-1f,
+    -0x1.6d120cp-1f,
+    -0x1.6cd2bp-1f,
+    -0x1.6c9348p-1f,
+    -0x1.6c53bcp-1f,
+    -0x1.6c1428p-1f,
+    -0x1.6bd47p-1f,
+    -0x1.6b94bp-1f,
+    -0x1.6b54dp-1f,
+    -0x1.6b14dcp-1f,
+    -0x1.6ad4d4p-1f,
+    -0x1.6a94bp-1f,
+    -0x1.6a5474p-1f,
+    -0x1.6a142cp-1f,
+    -0x1.69d3c4p-1f,
+    -0x1.69935p-1f,
+    -0x1.6952bp-1f,
+    -0x1.691204p-1f,
+    -0x1.68d148p-1f,
+    -0x1.689068p-1f,
+    -0x1.684f7cp-1f,
+    -0x1.680e78p-1f,
+    -0x1.67cd54p-1f,
+    -0x1.678c28p-1f,
+    -0x1.674adp-1f,
+    -0x1.67097p-1f,
+    -0x1.66c7f4p-1f,
+    -0x1.66866p-1f,
+    -0x1.6644bp-1f,
+    -0x1.6602fp-1f,
+    -0x1.65c118p-1f,
+    -0x1.657f2cp-1f,
+    -0x1.653d18p-1f,
+    -0x1.64faf4p-1f,
+    -0x1.64b8bcp-1f,
+    -0x1.647664p-1f,
+    -0x1.643404p-1f,
+    -0x1.63f18p-1f,
+    -0x1.63aeecp-1f,
+    -0x1.636c38p-1f,
+    -0x1.632964p-1f,
+    -0x1.62e684p-1f,
+    -0x1.62a388p-1f,
+    -0x1.626074p-1f,
+    -0x1.621d44p-1f,
+    -0x1.61da04p-1f,
+    -0x1.6196a4p-1f,
+    -0x1.61533p-1f,
+    -0x1.610fap-1f,
+    -0x1.60cbf8p-1f,
+    -0x1.608838p-1f,
+    -0x1.60445cp-1f,
+    -0x1.60006cp-1f,
+    -0x1.5fbc58p-1f,
+    -0x1.5f7838p-1f,
+    -0x1.5f33f8p-1f,
+    -0x1.5eefap-1f,
+    -0x1.5eab3p-1f,
+    -0x1.5e66a8p-1f,
+    -0x1.5e2208p-1f,
+    -0x1.5ddd48p-1f,
+    -0x1.5d987p-1f,
+    -0x1.5d537cp-1f,
+    -0x1.5d0e7cp-1f,
+    -0x1.5cc95p-1f,
+    -0x1.5c841cp-1f,
+    -0x1.5c3ecp-1f,
+    -0x1.5bf95p-1f,
+    -0x1.5bb3c4p-1f,
+    -0x1.5b6e18p-1f,
+    -0x1.5b286p-1f,
+    -0x1.5ae28p-1f,
+    -0x1.5a9c94p-1f,
+    -0x1.5a5684p-1f,
+    -0x1.5a1054p-1f,
+    -0x1.59ca14p-1f,
+    -0x1.5983b8p-1f,
+    -0x1.593d3cp-1f,
+    -0x1.58f6bp-1f,
+    -0x1.58aff8p-1f,
+    -0x1.586938p-1f,
+    -0x1.582254p-1f,
+    -0x1.57db5p-1f,
+    -0x1.57944p-1f,
+    -0x1.574d08p-1f,
+    -0x1.5705b4p-1f,
+    -0x1.56be5p-1f,
+    -0x1.5676cp-1f,
+    -0x1.562f24p-1f,
+    -0x1.55e76p-1f,
+    -0x1.559f8cp-1f,
+    -0x1.55579p-1f,
+    -0x1.550f88p-1f,
+    -0x1.54c758p-1f,
+    -0x1.547f14p-1f,
+    -0x1.5436bp-1f,
+    -0x1.53ee3p-1f,
+    -0x1.53a58cp-1f,
+    -0x1.535cd8p-1f,
+    -0x1.5314p-1f,
+    -0x1.52cb14p-1f,
+    -0x1.52821p-1f,
+    -0x1.5238dcp-1f,
+    -0x1.51ef94p-1f,
+    -0x1.51a63p-1f,
+    -0x1.515cbp-1f,
+    -0x1.51131p-1f,
+    -0x1.50c954p-1f,
+    -0x1.507f84p-1f,
+    -0x1.50359p-1f,
+    -0x1.4feb7cp-1f,
+    -0x1.4fa15p-1f,
+    -0x1.4f5708p-1f,
+    -0x1.4f0c9p-1f,
+    -0x1.4ec21p-1f,
+    -0x1.4e776cp-1f,
+    -0x1.4e2cacp-1f,
+    -0x1.4de1dp-1f,
+    -0x1.4d96dp-1f,
+    -0x1.4d4bb8p-1f,
+    -0x1.4d007cp-1f,
+    -0x1.4cb524p-1f,
+    -0x1.4c69acp-1f,
+    -0x1.4c1e14p-1f,
+    -0x1.4bd268p-1f,
+    -0x1.4b8694p-1f,
+    -0x1.4b3aa4p-1f,
+    -0x1.4aee9p-1f,
+    -0x1.4aa26cp-1f,
+    -0x1.4a561cp-1f,
+    -0x1.4a09b8p-1f,
+    -0x1.49bd28p-1f,
+    -0x1.49708p-1f,
+    -0x1.4923b4p-1f,
+    -0x1.48d6c8p-1f,
+    -0x1.4889dp-1f,
+    -0x1.483c9cp-1f,
+    -0x1.47ef58p-1f,
+    -0x1.47a1fcp-1f,
+    -0x1.475474p-1f,
+    -0x1.4706dp-1f,
+    -0x1.46b90cp-1f,
+    -0x1.466b24p-1f,
+    -0x1.461d1cp-1f,
+    -0x1.45cef4p-1f,
+    -0x1.4580bp-1f,
+    -0x1.45324cp-1f,
+    -0x1.44e3bcp-1f,
+    -0x1.449524p-1f,
+    -0x1.44465p-1f,
+    -0x1.43f768p-1f,
+    -0x1.43a858p-1f,
+    -0x1.43592cp-1f,
+    -0x1.4309ep-1f,
+    -0x1.42ba7p-1f,
+    -0x1.426ae8p-1f,
+    -0x1.421b2cp-1f,
+    -0x1.41cb58p-1f,
+    -0x1.417b64p-1f,
+    -0x1.412b5p-1f,
+    -0x1.40db1p-1f,
+    -0x1.408abcp-1f,
+    -0x1.403a3cp-1f,
+    -0x1.3fe994p-1f,
+    -0x1.3f98dcp-1f,
+    -0x1.3f47fp-1f,
+    -0x1.3ef6ecp-1f,
+    -0x1.3ea5bcp-1f,
+    -0x1.3e5474p-1f,
+    -0x1.3e0304p-1f,
+    -0x1.3db164p-1f,
+    -0x1.3d5fb8p-1f,
+    -0x1.3d0dd4p-1f,
+    -0x1.3cbbdp-1f,
+    -0x1.3c69b4p-1f,
+    -0x1.3c176cp-1f,
+    -0x1.3bc5p-1f,
+    -0x1.3b727cp-1f,
+    -0x1.3b1fbcp-1f,
+    -0x1.3accecp-1f,
+    -0x1.3a79f8p-1f,
+    -0x1.3a26dp-1f,
+    -0x1.39d394p-1f,
+    -0x1.398028p-1f,
+    -0x1.392c94p-1f,
+    -0x1.38d8e8p-1f,
+    -0x1.388508p-1f,
+    -0x1.383108p-1f,
+    -0x1.37dce8p-1f,
+    -0x1.3788a8p-1f,
+    -0x1.37342cp-1f,
+    -0x1.36df9cp-1f,
+    -0x1.368ae4p-1f,
+    -0x1.363604p-1f,
+    -0x1.35e0fp-1f,
+    -0x1.358bdp-1f,
+    -0x1.353674p-1f,
+    -0x1.34e0f4p-1f,
+    -0x1.348b5cp-1f,
+    -0x1.34359p-1f,
+    -0x1.33dfa8p-1f,
+    -0x1.338988p-1f,
+    -0x1.33333cp-1f,
+    -0x1.32dcep-1f,
+    -0x1.32864cp-1f,
+    -0x1.322f9cp-1f,
+    -0x1.31d8bp-1f,
+    -0x1.3181bp-1f,
+    -0x1.312a84p-1f,
+    -0x1.30d33p-1f,
+    -0x1.307bbp-1f,
+    -0x1.302404p-1f,
+    -0x1.2fcc28p-1f,
+    -0x1.2f7434p-1f,
+    -0x1.2f1c0cp-1f,
+    -0x1.2ec3bcp-1f,
+    -0x1.2e6b4p-1f,
+    -0x1.2e12a4p-1f,
+    -0x1.2db9ep-1f,
+    -0x1.2d60dcp-1f,
+    -0x1.2d07bcp-1f,
+    -0x1.2cae74p-1f,
+    -0x1.2c54f4p-1f,
+    -0x1.2bfb54p-1f,
+    -0x1.2ba19p-1f,
+    -0x1.2b4794p-1f,
+    -0x1.2aed7p-1f,
+    -0x1.2a9324p-1f,
+    -0x1.2a38acp-1f,
+    -0x1.29de04p-1f,
+    -0x1.29833p-1f,
+    -0x1.29283p-1f,
+    -0x1.28cd08p-1f,
+    -0x1.2871bp-1f,
+    -0x1.28162cp-1f,
+    -0x1.27ba6cp-1f,
+    -0x1.275e98p-1f,
+    -0x1.27028cp-1f,
+    -0x1.26a64cp-1f,
+    -0x1.2649ep-1f,
+    -0x1.25ed5p-1f,
+    -0x1.25909p-1f,
+    -0x1.253394p-1f,
+    -0x1.24d678p-1f,
+    -0x1.247918p-1f,
+    -0x1.241bbp-1f,
+    -0x1.23bdf4p-1f,
+    -0x1.23602p-1f,
+    -0x1.23020cp-1f,
+    -0x1.22a3dp-1f,
+    -0x1.224564p-1f,
+    -0x1.21e6bcp-1f,
+    -0x1.2187f4p-1f,
+    -0x1.2128fp-1f,
+    -0x1.20c9dp-1f,
+    -0x1.206a6cp-1f,
+    -0x1.200accp-1f,
+    -0x1.1fab14p-1f,
+    -0x1.1f4b14p-1f,
+    -0x1.1eeaecp-1f,
+    -0x1.1e8a9p-1f,
+    -0x1.1e2a0cp-1f,
+    -0x1.1dc948p-1f,
+    -0x1.1d6858p-1f,
+    -0x1.1d0728p-1f,
+    -0x1.1ca5d8p-1f,
+    -0x1.1c444p-1f,
+    -0x1.1be28p-1f,
+    -0x1.1b8088p-1f,
+    -0x1.1b1e58p-1f,
+    -0x1.1abc08p-1f,
+    -0x1.1a5964p-1f,
+    -0x1.19f6a4p-1f,
+    -0x1.19939cp-1f,
+    -0x1.193068p-1f,
+    -0x1.18ccfcp-1f,
+    -0x1.18696p-1f,
+    -0x1.180588p-1f,
+    -0x1.17a17cp-1f,
+    -0x1.173d3p-1f,
+    -0x1.16d8bp-1f,
+    -0x1.167404p-1f,
+    -0x1.160f0cp-1f,
+    -0x1.15a9fp-1f,
+    -0x1.15449p-1f,
+    -0x1.14defcp-1f,
+    -0x1.147928p-1f,
+    -0x1.14131cp-1f,
+    -0x1.13acd8p-1f,
+    -0x1.134658p-1f,
+    -0x1.12dfa4p-1f,
+    -0x1.1278bp-1f,
+    -0x1.12119p-1f,
+    -0x1.11aa28p-1f,
+    -0x1.11428p-1f,
+    -0x1.10daa4p-1f,
+    -0x1.10727cp-1f,
+    -0x1.100a2cp-1f,
+    -0x1.0fa19p-1f,
+    -0x1.0f38c8p-1f,
+    -0x1.0ecfbp-1f,
+    -0x1.0e6664p-1f,
+    -0x1.0dfcdcp-1f,
+    -0x1.0d9308p-1f,
+    -0x1.0d2904p-1f,
+    -0x1.0cbebcp-1f,
+    -0x1.0c544p-1f,
+    -0x1.0be97p-1f,
+    -0x1.0b7e6cp-1f,
+    -0x1.0b132cp-1f,
+    -0x1.0aa798p-1f,
+    -0x1.0a3bc4p-1f,
+    -0x1.09cfc8p-1f,
+    -0x1.09637cp-1f,
+    -0x1.08f6e8p-1f,
+    -0x1.088a2p-1f,
+    -0x1.081cfp-1f,
+    -0x1.07afa8p-1f,
+    -0x1.074204p-1f,
+    -0x1.06d414p-1f,
+    -0x1.0665f8p-1f,
+    -0x1.05f784p-1f,
+    -0x1.0588ep-1f,
+    -0x1.0519e4p-1f,
+    -0x1.04aaa4p-1f,
+    -0x1.043b2p-1f,
+    -0x1.03cb5p-1f,
+    -0x1.035b4p-1f,
+    -0x1.02eaep-1f,
+    -0x1.027a3p-1f,
+    -0x1.02095p-1f,
+    -0x1.01981p-1f,
+    -0x1.012694p-1f,
+    -0x1.00b4ccp-1f,
+    -0x1.0042ap-1f,
+    -0x1.ffa0a8p-2f,
+    -0x1.febb28p-2f,
+    -0x1.fdd548p-2f,
+    -0x1.fceeb8p-2f,
+    -0x1.fc0778p-2f,
+    -0x1.fb1fcp-2f,
+    -0x1.fa376p-2f,
+    -0x1.f94e8p-2f,
+    -0x1.f864dp-2f,
+    -0x1.f77a88p-2f,
+    -0x1.f68f98p-2f,
+    -0x1.f5a438p-2f,
+    -0x1.f4b7f8p-2f,
+    -0x1.f3cb3p-2f,
+    -0x1.f2ddb8p-2f,
+    -0x1.f1efbp-2f,
+    -0x1.f101p-2f,
+    -0x1.f01178p-2f,
+    -0x1.ef219p-2f,
+    -0x1.ee30c8p-2f,
+    -0x1.ed3f6p-2f,
+    -0x1.ec4d7p-2f,
+    -0x1.eb5a98p-2f,
+    -0x1.ea672p-2f,
+    -0x1.e972f8p-2f,
+    -0x1.e87e38p-2f,
+    -0x1.e78898p-2f,
+    -0x1.e69278p-2f,
+    -0x1.e59b7p-2f,
+    -0x1.e4a3ep-2f,
+    -0x1.e3ab6p-2f,
+    -0x1.e2b258p-2f,
+    -0x1.e1b878p-2f,
+    -0x1.e0bddp-2f,
+    -0x1.dfc2ap-2f,
+    -0x1.dec668p-2f,
+    -0x1.ddc9cp-2f,
+    -0x1.dccc08p-2f,
+    -0x1.dbcdap-2f,
+    -0x1.dace9p-2f,
+    -0x1.d9ceap-2f,
+    -0x1.d8cdfp-2f,
+    -0x1.d7cc88p-2f,
+    -0x1.d6ca3p-2f,
+    -0x1.d5c71p-2f,
+    -0x1.d4c34p-2f,
+    -0x1.d3be7p-2f,
+    -0x1.d2b8f8p-2f,
+    -0x1.d1b28p-2f,
+    -0x1.d0ab5p-2f,
+    -0x1.cfa36p-2f,
+    -0x1.ce9a6p-2f,
+    -0x1.cd90cp-2f,
+    -0x1.cc8608p-2f,
+    -0x1.cb7a8p-2f,
+    -0x1.ca6e28p-2f,
+    -0x1.c960ep-2f,
+    -0x1.c852ep-2f,
+    -0x1.c743dp-2f,
+    -0x1.c633c8p-2f,
+    -0x1.c522f8p-2f,
+    -0x1.c4112p-2f,
+    -0x1.c2fe6p-2f,
+    -0x1.c1eac8p-2f,
+    -0x1.c0d61p-2f,
+    -0x1.bfc09p-2f,
+    -0x1.bea9fp-2f,
+    -0x1.bd926p-2f,
+    -0x1.bc79e8p-2f,
+    -0x1.bb605p-2f,
+    -0x1.ba45ep-2f,
+    -0x1.b92a38p-2f,
+    -0x1.b80ddp-2f,
+    -0x1.b6f038p-2f,
+    -0x1.b5d188p-2f,
+    -0x1.b4b1fp-2f,
+    -0x1.b3912p-2f,
+    -0x1.b26f58p-2f,
+    -0x1.b14c6p-2f,
+    -0x1.b0287p-2f,
+    -0x1.af034p-2f,
+    -0x1.addd4p-2f,
+    -0x1.acb5c8p-2f,
+    -0x1.ab8d38p-2f,
+    -0x1.aa63ap-2f,
+    -0x1.a938c8p-2f,
+    -0x1.a80dp-2f,
+    -0x1.a6dfa8p-2f,
+    -0x1.a5b168p-2f,
+    -0x1.a481cp-2f,
+    -0x1.a351p-2f,
+    -0x1.a21efp-2f,
+    -0x1.a0ebb8p-2f,
+    -0x1.9fb7p-2f,
+    -0x1.9e8158p-2f,
+    -0x1.9d4a48p-2f,
+    -0x1.9c11a8p-2f,
+    -0x1.9ad82p-2f,
+    -0x1.999cc8p-2f,
+    -0x1.98607p-2f,
+    -0x1.9722b8p-2f,
+    -0x1.95e378p-2f,
+    -0x1.94a2ep-2f,
+    -0x1.9360c8p-2f,
+    -0x1.921d68p-2f,
+    -0x1.90d89p-2f,
+    -0x1.8f9228p-2f,
+    -0x1.8e4a58p-2f,
+    -0x1.8d00ep-2f,
+    -0x1.8bb5c8p-2f,
+    -0x1.8a6998p-2f,
+    -0x1.891b7p-2f,
+    -0x1.87cc2p-2f,
+    -0x1.867acp-2f,
+    -0x1.8527d8p-2f,
+    -0x1.83d39p-2f,
+    -0x1.827d4p-2f,
+    -0x1.8125a8p-2f,
+    -0x1.7fcbep-2f,
+    -0x1.7e70ap-2f,
+    -0x1.7d13c8p-2f,
+    -0x1.7bb4dp-2f,
+    -0x1.7a542p-2f,
+    -0x1.78f1c8p-2f,
+    -0x1.778d8p-2f,
+    -0x1.762748p-2f,
+    -0x1.74bf3p-2f,
+    -0x1.7354e8p-2f,
+    -0x1.71e9p-2f,
+    -0x1.707adp-2f,
+    -0x1.6f0aep-2f,
+    -0x1.6d989p-2f,
+    -0x1.6c246p-2f,
+    -0x1.6aae08p-2f,
+    -0x1.693558p-2f,
+    -0x1.67baa8p-2f,
+    -0x1.663d98p-2f,
+    -0x1.64be6p-2f,
+    -0x1.633cd8p-2f,
+    -0x1.61b8c8p-2f,
+    -0x1.603288p-2f,
+    -0x1.5ea9d8p-2f,
+    -0x1.5d1e88p-2f,
+    -0x1.5b90b8p-2f,
+    -0x1.5a00bp-2f,
+    -0x1.586d9p-2f,
+    -0x1.56d82p-2f,
+    -0x1.553fb8p-2f,
+    -0x1.53a4b8p-2f,
+    -0x1.5206e8p-2f,
+    -0x1.5066p-2f,
+    -0x1.4ec2ap-2f,
+    -0x1.4d1bfp-2f,
+    -0x1.4b728p-2f,
+    -0x1.49c5ap-2f,
+    -0x1.4815bp-2f,
+    -0x1.4662a8p-2f,
+    -0x1.44ac6p-2f,
+    -0x1.42f298p-2f,
+    -0x1.41356p-2f,
+    -0x1.3f74b8p-2f,
+    -0x1.3db02p-2f,
+    -0x1.3be868p-2f,
+    -0x1.3a1c8p-2f,
+    -0x1.384cep-2f,
+    -0x1.367968p-2f,
+    -0x1.34a1ap-2f,
+    -0x1.32c62p-2f,
+    -0x1.30e608p-2f,
+    -0x1.2f01ep-2f,
+    -0x1.2d18dp-2f,
+    -0x1.2b2b8p-2f,
+    -0x1.293988p-2f,
+    -0x1.27429p-2f,
+    -0x1.2546bp-2f,
+    -0x1.2345bp-2f,
+    -0x1.213f9p-2f,
+    -0x1.1f33fp-2f,
+    -0x1.1d22ap-2f,
+    -0x1.1b0b68p-2f,
+    -0x1.18eebp-2f,
+    -0x1.16cb68p-2f,
+    -0x1.14a248p-2f,
+    -0x1.1272p-2f,
+    -0x1.103b1p-2f,
+    -0x1.0dfd9p-2f,
+    -0x1.0bb84p-2f,
+    -0x1.096bb8p-2f,
+    -0x1.07173p-2f,
+    -0x1.04baap-2f,
+    -0x1.0255a8p-2f,
+    -0x1.ffcfep-3f,
+    -0x1.fae1ep-3f,
+    -0x1.f5e0cp-3f,
+    -0x1.f0cb6p-3f,
+    -0x1.eba1p-3f,
+    -0x1.e660fp-3f,
+    -0x1.e1097p-3f,
+    -0x1.db9aap-3f,
+    -0x1.d610bp-3f,
+    -0x1.d06cbp-3f,
+    -0x1.caac4p-3f,
+    -0x1.c4ccfp-3f,
+    -0x1.becf1p-3f,
+    -0x1.b8acfp-3f,
+    -0x1.b268bp-3f,
+    -0x1.abfbcp-3f,
+    -0x1.a5658p-3f,
+    -0x1.9ea22p-3f,
+    -0x1.97adap-3f,
+    -0x1.9083cp-3f,
+    -0x1.89204p-3f,
+    -0x1.817b5p-3f,
+    -0x1.7990fp-3f,
+    -0x1.7158dp-3f,
+    -0x1.68c59p-3f,
+    -0x1.5fcfdp-3f,
+    -0x1.56665p-3f,
+    -0x1.4c782p-3f,
+    -0x1.41e96p-3f,
+    -0x1.36a6p-3f,
+    -0x1.2b308p-3f,
+    -0x1.1fb92p-3f,
+    -0x1.143fep-3f,
+    -0x1.08c35p-3f,
+    -0x1.fa8c8p-4f,
+    -0x1.e3888p-4f,
+    -0x1.cc858p-4f,
+    -0x1.b5764p-4f,
+    -0x1.9e666p-4f,
+    -0x1.875p-4f,
+    -0x1.70364p-4f,
+    -0x1.5919cp-4f,
+    -0x1.41f28p-4f,
+    -0x1.2acc8p-4f,
+    -0x1.139b2p-4f,
+    -0x1.f8d3p-5f,
+    -0x1.ca658p-5f,
+    -0x1.9be88p-5f,
+    -0x1.6d664p-5f,
+    -0x1.3ed7cp-5f,
+    -0x1.103e4p-5f,
+    -0x1.c3418p-6f,
+    -0x1.65eep-6f,
+    -0x1.08758p-6f,
+    -0x1.560ep-7f,
+    -0x1.35a2p-8f,
+    0x1.032cp-10f,
+    0x1.b7cep-8f,
+    0x1.97a48p-7f,
+    0x1.29a14p-6f,
+    0x1.87a08p-6f,
+    0x1.e5a5cp-6f,
+    0x1.21e12p-5f,
+    0x1.50fc4p-5f,
+    0x1.801e4p-5f,
+    0x1.af49cp-5f,
+    0x1.de7eap-5f,
+    0x1.06e07p-4f,
+    0x1.1e84bp-4f,
+    0x1.36304p-4f,
+    0x1.4dde5p-4f,
+    0x1.65964p-4f,
+    0x1.7d4c2p-4f,
+    0x1.950bcp-4f,
+    0x1.acd1bp-4f,
+    0x1.c499bp-4f,
+    0x1.dc67cp-4f,
+    0x1.f438cp-4f,
+    0x1.0608c8p-3f,
+    0x1.11f5ep-3f,
+    0x1.1de748p-3f,
+    0x1.29da98p-3f,
+    0x1.35d02p-3f,
+    0x1.41c93p-3f,
+    0x1.4dc4p-3f,
+    0x1.59c138p-3f,
+    0x1.65c158p-3f,
+    0x1.71c58p-3f,
+    0x1.7dc86p-3f,
+    0x1.89d07p-3f,
+    0x1.95dafp-3f,
+    0x1.a1e768p-3f,
+    0x1.adf708p-3f,
+    0x1.ba086p-3f,
+    0x1.c61ep-3f,
+    0x1.d23348p-3f,
+    0x1.de4e1p-3f,
+    0x1.ea692p-3f,
+    0x1.f68758p-3f,
+    0x1.01545cp-2f,
+    0x1.076628p-2f,
+    0x1.0d7988p-2f,
+    0x1.138d88p-2f,
+    0x1.19a43p-2f,
+    0x1.1fba0cp-2f,
+    0x1.25d344p-2f,
+    0x1.2beb74p-2f,
+    0x1.320724p-2f,
+    0x1.3822bcp-2f,
+    0x1.3e4048p-2f,
+    0x1.445efp-2f,
+    0x1.4a7eb4p-2f,
+    0x1.50a0ccp-2f,
+    0x1.56c344p-2f,
+    0x1.5ce66p-2f,
+    0x1.630c1p-2f,
+    0x1.6931dcp-2f,
+    0x1.6f5968p-2f,
+    0x1.7582c8p-2f,
+    0x1.7bacbp-2f,
+    0x1.81d81p-2f,
+    0x1.88051p-2f,
+    0x1.8e332cp-2f,
+    0x1.946374p-2f,
+    0x1.9a92f8p-2f,
+    0x1.a0c548p-2f,
+    0x1.a6f87cp-2f,
+    0x1.ad2cecp-2f,
+    0x1.b363dp-2f,
+    0x1.b99a1p-2f,
+    0x1.bfd334p-2f,
+    0x1.c60c2cp-2f,
+    0x1.cc481p-2f,
+    0x1.d2846p-2f,
+    0x1.d8c288p-2f,
+    0x1.df01p-2f,
+    0x1.e5417p-2f,
+    0x1.eb834p-2f,
+    0x1.f1c67p-2f,
+    0x1.f80aa4p-2f,
+    0x1.fe4f8p-2f,
+    0x1.024bf8p-1f,
+    0x1.056f78p-1f,
+    0x1.089454p-1f,
+    0x1.0bb968p-1f,
+    0x1.0edf9cp-1f,
+    0x1.12068cp-1f,
+    0x1.152dep-1f,
+    0x1.185608p-1f,
+    0x1.1b7ec4p-1f,
+    0x1.1ea80cp-1f,
+    0x1.21d1fcp-1f,
+    0x1.24fd0cp-1f,
+    0x1.2827ep-1f,
+    0x1.2b5444p-1f,
+    0x1.2e810cp-1f,
+    0x1.31ae28p-1f,
+    0x1.34dca6p-1f,
+    0x1.380afcp-1f,
+    0x1.3b3a5cp-1f,
+    0x1.3e6a06p-1f,
+    0x1.419ad2p-1f,
+    0x1.44cc14p-1f,
+    0x1.47fdf6p-1f,
+    0x1.4b30aep-1f,
+    0x1.4e641cp-1f,
+    0x1.51980cp-1f,
+    0x1.54cc9p-1f,
+    0x1.580238p-1f,
+    0x1.5b37e8p-1f,
+    0x1.5e6ec8p-1f,
+    0x1.61a5c2p-1f,
+    0x1.64ddc8p-1f,
+    0x1.68168ep-1f,
+    0x1.6b5008p-1f,
+    0x1.6e8a42p-1f,
+    0x1.71c472p-1f,
+    0x1.74eca2p-1f,
+    0x1.77089cp-1f,
+    0x1.7892dep-1f,
+    0x1.79d7d4p-1f,
+    0x1.7af1e8p-1f,
+    0x1.7bee32p-1f,
+    0x1.7cd404p-1f,
+    0x1.7da864p-1f,
+    0x1.7e6e74p-1f,
+    0x1.7f28b8p-1f,
+    0x1.7fd8d4p-1f,
+    0x1.80805p-1f,
+    0x1.812012p-1f,
+    0x1.81b93ap-1f,
+    0x1.824c44p-1f,
+    0x1.82d9f6p-1f,
+    0x1.8362c8p-1f,
+    0x1.83e716p-1f,
+    0x1.84676p-1f,
+    0x1.84e3ccp-1f,
+    0x1.855cdep-1f,
+    0x1.85d2b2p-1f,
+    0x1.86458p-1f,
+    0x1.86b584p-1f,
+    0x1.8722f8p-1f,
+    0x1.878deap-1f,
+    0x1.87f698p-1f,
+    0x1.885d28p-1f,
+    0x1.88c19p-1f,
+    0x1.892428p-1f,
+    0x1.8984dap-1f,
+    0x1.89e3c2p-1f,
+    0x1.8a4116p-1f,
+    0x1.8a9cd2p-1f,
+    0x1.8af71cp-1f,
+    0x1.8b4fe8p-1f,
+    0x1.8ba768p-1f,
+    0x1.8bfd94p-1f,
+    0x1.8c527ap-1f,
+    0x1.8ca63cp-1f,
+    0x1.8cf8d4p-1f,
+    0x1.8d4a54p-1f,
+    0x1.8d9adp-1f,
+    0x1.8de892p-1f,
+    0x1.8e34b6p-1f,
+    0x1.8e7ff4p-1f,
+    0x1.8eca2cp-1f,
+    0x1.8f1396p-1f,
+    0x1.8f5c14p-1f,
+    0x1.8fa3bap-1f,
+    0x1.8feaap-1f,
+    0x1.9030a2p-1f,
+    0x1.9075ecp-1f,
+    0x1.90ba6ap-1f,
+    0x1.90fe34p-1f,
+    0x1.914144p-1f,
+    0x1.91839ap-1f,
+    0x1.91c54p-1f,
+    0x1.920648p-1f,
+    0x1.924698p-1f,
+    0x1.92865p-1f,
+    0x1.92c55ep-1f,
+    0x1.9303dcp-1f,
+    0x1.9341cap-1f,
+    0x1.937f0cp-1f,
+    0x1.93bbd4p-1f,
+    0x1.93f802p-1f,
+    0x1.9433a2p-1f,
+    0x1.946ecp-1f,
+    0x1.94a94ep-1f,
+    0x1.94e36ap-1f,
+    0x1.951cf8p-1f,
+    0x1.955616p-1f,
+    0x1.958ebp-1f,
+    0x1.95c6d8p-1f,
+    0x1.95fe8ap-1f,
+    0x1.9635cp-1f,
+    0x1.966c88p-1f,
+    0x1.96a2e2p-1f,
+    0x1.96d8dp-1f,
+    0x1.970e4ep-1f,
+    0x1.97436ep-1f,
+    0x1.977814p-1f,
+    0x1.97ac6ep-1f,
+    0x1.97e04ep-1f,
+    0x1.9813d4p-1f,
+    0x1.9847p-1f,
+    0x1.9879c2p-1f,
+    0x1.98ac3p-1f,
+    0x1.98de42p-1f,
+    0x1.990ff4p-1f,
+    0x1.994158p-1f,
+    0x1.99726p-1f,
+    0x1.99a308p-1f,
+    0x1.99d368p-1f,
+    0x1.9a0372p-1f,
+    0x1.9a3328p-1f,
+    0x1.9a629p-1f,
+    0x1.9a91a6p-1f,
+    0x1.9ac078p-1f,
+    0x1.9aeefp-1f,
+    0x1.9b1d26p-1f,
+    0x1.9b4b1p-1f,
+    0x1.9b78acp-1f,
+    0x1.9ba6p-1f,
+    0x1.9bd31p-1f,
+    0x1.9bffd6p-1f,
+    0x1.9c2c5ap-1f,
+    0x1.9c589ep-1f,
+    0x1.9c8498p-1f,
+    0x1.9cb052p-1f,
+    0x1.9cdbc4p-1f,
+    0x1.9d0702p-1f,
+    0x1.9d31f6p-1f,
+    0x1.9d5caep-1f,
+    0x1.9d872cp-1f,
+    0x1.9db168p-1f,
+    0x1.9ddb6cp-1f,
+    0x1.9e052ep-1f,
+    0x1.9e2eb8p-1f,
+    0x1.9e580cp-1f,
+    0x1.9e8126p-1f,
+    0x1.9eaap-1f,
+    0x1.9ed2ap-1f,
+    0x1.9efb14p-1f,
+    0x1.9f234cp-1f,
+    0x1.9f4b52p-1f,
+    0x1.9f7322p-1f,
+    0x1.9f9ab8p-1f,
+    0x1.9fc21ap-1f,
+    0x1.9fe94ap-1f,
+    0x1.a0104ap-1f,
+    0x1.a03712p-1f,
+    0x1.a05daap-1f,
+    0x1.a08416p-1f,
+    0x1.a0aa4ep-1f,
+    0x1.a0d058p-1f,
+    0x1.a0f63p-1f,
+    0x1.a11bd6p-1f,
+    0x1.a1415p-1f,
+    0x1.a1669ep-1f,
+    0x1.a18bcp-1f,
+    0x1.a1b0b4p-1f,
+    0x1.a1d576p-1f,
+    0x1.a1fa14p-1f,
+    0x1.a21e8p-1f,
+    0x1.a242cap-1f,
+    0x1.a266e2p-1f,
+    0x1.a28acep-1f,
+    0x1.a2ae92p-1f,
+    0x1.a2d23p-1f,
+    0x1.a2f5a4p-1f,
+    0x1.a318ecp-1f,
+    0x1.a33c12p-1f,
+    0x1.a35f0ap-1f,
+    0x1.a381ep-1f,
+    0x1.a3a48ep-1f,
+    0x1.a3c716p-1f,
+    0x1.a3e972p-1f,
+    0x1.a40ba8p-1f,
+    0x1.a42dc2p-1f,
+    0x1.a44facp-1f,
+    0x1.a4718p-1f,
+    0x1.a4932p-1f,
+    0x1.a4b4a6p-1f,
+    0x1.a4d604p-1f,
+    0x1.a4f73ep-1f,
+    0x1.a5185ep-1f,
+    0x1.a5394cp-1f,
+    0x1.a55a22p-1f,
+    0x1.a57adp-1f,
+    0x1.a59b66p-1f,
+    0x1.a5bbdp-1f,
+    0x1.a5dc1ep-1f,
+    0x1.a5fc4ap-1f,
+    0x1.a61c54p-1f,
+    0x1.a63c46p-1f,
+    0x1.a65c0cp-1f,
+    0x1.a67bb8p-1f,
+    0x1.a69b44p-1f,
+    0x1.a6bab4p-1f,
+    0x1.a6da02p-1f,
+    0x1.a6f932p-1f,
+    0x1.a71842p-1f,
+    0x1.a73734p-1f,
+    0x1.a7560cp-1f,
+    0x1.a774c4p-1f,
+    0x1.a7936p-1f,
+    0x1.a7b1d8p-1f,
+    0x1.a7d038p-1f,
+    0x1.a7ee7cp-1f,
+    0x1.a80ca4p-1f,
+    0x1.a82abp-1f,
+    0x1.a8489ep-1f,
+    0x1.a8667p-1f,
+    0x1.a88428p-1f,
+    0x1.a8a1c4p-1f,
+    0x1.a8bf42p-1f,
+    0x1.a8dca8p-1f,
+    0x1.a8f9f6p-1f,
+    0x1.a91728p-1f,
+    0x1.a9344p-1f,
+    0x1.a9513cp-1f,
+    0x1.a96e1cp-1f,
+    0x1.a98ae4p-1f,
+    0x1.a9a796p-1f,
+    0x1.a9c42ep-1f,
+    0x1.a9e0aap-1f,
+    0x1.a9fd0ep-1f,
+    0x1.aa195cp-1f,
+    0x1.aa358ep-1f,
+    0x1.aa51a8p-1f,
+    0x1.aa6daap-1f,
+    0x1.aa8992p-1f,
+    0x1.aaa564p-1f,
+    0x1.aac122p-1f,
+    0x1.aadcc6p-1f,
+    0x1.aaf85p-1f,
+    0x1.ab13c8p-1f,
+    0x1.ab2f26p-1f,
+    0x1.ab4a6ep-1f,
+    0x1.ab659cp-1f,
+    0x1.ab80b6p-1f,
+    0x1.ab9bbcp-1f,
+    0x1.abb6a8p-1f,
+    0x1.abd18p-1f,
+    0x1.abec4p-1f,
+    0x1.ac06fp-1f,
+    0x1.ac2184p-1f,
+    0x1.ac3c06p-1f,
+    0x1.ac566cp-1f,
+    0x1.ac70c8p-1f,
+    0x1.ac8b0cp-1f,
+    0x1.aca532p-1f,
+    0x1.acbf4cp-1f,
+    0x1.acd95p-1f,
+    0x1.acf34p-1f,
+    0x1.ad0d1ap-1f,
+    0x1.ad26ep-1f,
+    0x1.ad409p-1f,
+    0x1.ad5a3p-1f,
+    0x1.ad73bcp-1f,
+    0x1.ad8d3p-1f,
+    0x1.ada694p-1f,
+    0x1.adbfe6p-1f,
+    0x1.add922p-1f,
+    0x1.adf24ep-1f,
+    0x1.ae0b62p-1f,
+    0x1.ae2468p-1f,
+    0x1.ae3d54p-1f,
+    0x1.ae5636p-1f,
+    0x1.ae6efep-1f,
+    0x1.ae87bcp-1f,
+    0x1.aea05cp-1f,
+    0x1.aeb8f2p-1f,
+    0x1.aed178p-1f,
+    0x1.aee9e4p-1f,
+    0x1.af0246p-1f,
+    0x1.af1a92p-1f,
+    0x1.af32cep-1f,
+    0x1.af4af6p-1f,
+    0x1.af631p-1f,
+    0x1.af7b14p-1f,
+    0x1.af930ap-1f,
+    0x1.afaaeep-1f,
+    0x1.afc2cp-1f,
+    0x1.afda84p-1f,
+    0x1.aff234p-1f,
+    0x1.b009d6p-1f,
+    0x1.b02164p-1f,
+    0x1.b038e4p-1f,
+    0x1.b05052p-1f,
+    0x1.b067b2p-1f,
+    0x1.b07f02p-1f,
+    0x1.b0963ep-1f,
+    0x1.b0ad6ap-1f,
+    0x1.b0c48cp-1f,
+    0x1.b0db9ap-1f,
+    0x1.b0f294p-1f,
+    0x1.b10982p-1f,
+    0x1.b12066p-1f,
+    0x1.b13734p-1f,
+    0x1.b14df4p-1f,
+    0x1.b164a4p-1f,
+    0x1.b17b46p-1f,
+    0x1.b191d8p-1f,
+    0x1.b1a85ap-1f,
+    0x1.b1becep-1f,
+    0x1.b1d532p-1f,
+    0x1.b1eb88p-1f,
+    0x1.b201dp-1f,
+    0x1.b21808p-1f,
+    0x1.b22e34p-1f,
+    0x1.b2444cp-1f,
+    0x1.b25a5cp-1f,
+    0x1.b2705ap-1f,
+    0x1.b2864cp-1f,
+    0x1.b29c3p-1f,
+    0x1.b2b1fcp-1f,
+    0x1.b2c7c4p-1f,
+    0x1.b2dd7cp-1f,
+    0x1.b2f324p-1f,
+    0x1.b308cp-1f,
+    0x1.b31e5p-1f,
+    0x1.b333dp-1f,
+    0x1.b3494p-1f,
+    0x1.b35eacp-1f,
+    0x1.b373fcp-1f,
+    0x1.b38948p-1f,
+    0x1.b39e84p-1f,
+    0x1.b3b3b8p-1f,
+    0x1.b3c8d8p-1f,
+    0x1.b3ddecp-1f,
+    0x1.b3f2f6p-1f,
+    0x1.b407eep-1f,
+    0x1.b41cep-1f,
+    0x1.b431bep-1f,
+    0x1.b44692p-1f,
+    0x1.b45b58p-1f,
+    0x1.b47014p-1f,
+    0x1.b484c2p-1f,
+    0x1.b49962p-1f,
+    0x1.b4adf8p-1f,
+    0x1.b4c28p-1f,
+    0x1.b4d6fcp-1f,
+    0x1.b4eb6ap-1f,
+    0x1.b4ffdp-1f,
+    0x1.b51424p-1f,
+    0x1.b5287p-1f,
+    0x1.b53cbp-1f,
+    0x1.b550e4p-1f,
+    0x1.b5650cp-1f,
+    0x1.b57922p-1f,
+    0x1.b58d32p-1f,
+    0x1.b5a134p-1f,
+    0x1.b5b52cp-1f,
+    0x1.b5c916p-1f,
+    0x1.b5dcf6p-1f,
+    0x1.b5f0ccp-1f,
+    0x1.b60496p-1f,
+    0x1.b61854p-1f,
+    0x1.b62c04p-1f,
+    0x1.b63faap-1f,
+    0x1.b65344p-1f,
+    0x1.b666d6p-1f,
+    0x1.b67a5ap-1f,
+    0x1.b68dd4p-1f,
+    0x1.b6a14p-1f,
+    0x1.b6b4a4p-1f,
+    0x1.b6c7fcp-1f,
+    0x1.b6db4ap-1f,
+    0x1.b6ee8ep-1f,
+    0x1.b701c4p-1f,
+    0x1.b714fp-1f,
+    0x1.b72812p-1f,
+    0x1.b73b2cp-1f,
+    0x1.b74e36p-1f,
+    0x1.b76136p-1f,
+    0x1.b7742ep-1f,
+    0x1.b7871cp-1f,
+    0x1.b799fep-1f,
+    0x1.b7acd6p-1f,
+    0x1.b7bfa4p-1f,
+    0x1.b7d264p-1f,
+    0x1.b7e51ep-1f,
+    0x1.b7f7ccp-1f,
+    0x1.b80a6ep-1f,
+    0x1.b81d08p-1f,
+    0x1.b82f98p-1f,
+    0x1.b8421ep-1f,
+    0x1.b8549ap-1f,
+    0x1.b8671p-1f,
+    0x1.b87974p-1f,
+    0x1.b88bd2p-1f,
+    0x1.b89e28p-1f,
+    0x1.b8b072p-1f,
+    0x1.b8c2b2p-1f,
+    0x1.b8d4e6p-1f,
+    0x1.b8e716p-1f,
+    0x1.b8f936p-1f,
+    0x1.b90b52p-1f,
+    0x1.b91d62p-1f,
+    0x1.b92f68p-1f,
+    0x1.b94164p-1f,
+    0x1.b9535ap-1f,
+    0x1.b96544p-1f,
+    0x1.b97722p-1f,
+    0x1.b988fcp-1f,
+    0x1.b99acap-1f,
+    0x1.b9ac8ep-1f,
+    0x1.b9be48p-1f,
+    0x1.b9cffep-1f,
+    0x1.b9e1a6p-1f,
+    0x1.b9f346p-1f,
+    0x1.ba04dep-1f,
+    0x1.ba166ap-1f,
+    0x1.ba27f2p-1f,
+    0x1.ba396cp-1f,
+    0x1.ba4aep-1f,
+    0x1.ba5c48p-1f,
+    0x1.ba6daap-1f,
+    0x1.ba7f04p-1f,
+    0x1.ba9052p-1f,
+    0x1.baa19ap-1f,
+    0x1.bab2d8p-1f,
+    0x1.bac41p-1f,
+    0x1.bad53ap-1f,
+    0x1.bae65ep-1f,
+    0x1.baf778p-1f,
+    0x1.bb088cp-1f,
+    0x1.bb1998p-1f,
+    0x1.bb2a9cp-1f,
+    0x1.bb3b96p-1f,
+    0x1.bb4c86p-1f,
+    0x1.bb5d7p-1f,
+    0x1.bb6e4ep-1f,
+    0x1.bb7f28p-1f,
+    0x1.bb8ff8p-1f,
+    0x1.bba0bep-1f,
+    0x1.bbb17ep-1f,
+    0x1.bbc236p-1f,
+    0x1.bbd2e6p-1f,
+    0x1.bbe38cp-1f,
+    0x1.bbf42ap-1f,
+    0x1.bc04c2p-1f,
+    0x1.bc155p-1f,
+    0x1.bc25d8p-1f,
+    0x1.bc3656p-1f,
+    0x1.bc46ccp-1f,
+    0x1.bc573ep-1f,
+    0x1.bc67a4p-1f,
+    0x1.bc7804p-1f,
+    0x1.bc885ap-1f,
+    0x1.bc98aap-1f,
+    0x1.bca8f2p-1f,
+    0x1.bcb93p-1f,
+    0x1.bcc96ep-1f,
+    0x1.bcd99cp-1f,
+    0x1.bce9c6p-1f,
+    0x1.bcf9e6p-1f,
+    0x1.bd0ap-1f,
+    0x1.bd1a12p-1f,
+    0x1.bd2a1cp-1f,
+    0x1.bd3a2p-1f,
+    0x1.bd4a1ap-1f,
+    0x1.bd5a12p-1f,
+    0x1.bd69fep-1f,
+    0x1.bd79e4p-1f,
+    0x1.bd89cp-1f,
+    0x1.bd9998p-1f,
+    0x1.bda968p-1f,
+    0x1.bdb92ep-1f,
+    0x1.bdc8fp-1f,
+    0x1.bdd8aap-1f,
+    0x1.bde85cp-1f,
+    0x1.bdf808p-1f,
+    0x1.be07aap-1f,
+    0x1.be1748p-1f,
+    0x1.be26dep-1f,
+    0x1.be366ep-1f,
+    0x1.be45f4p-1f,
+    0x1.be5574p-1f,
+    0x1.be64ecp-1f,
+    0x1.be746p-1f,
+    0x1.be83cap-1f,
+    0x1.be9332p-1f,
+    0x1.bea29p-1f,
+    0x1.beb1e4p-1f,
+    0x1.bec136p-1f,
+    0x1.bed07ep-1f,
+    0x1.bedfcp-1f,
+    0x1.beeefep-1f,
+    0x1.befe3p-1f,
+    0x1.bf0d5cp-1f,
+    0x1.bf1c86p-1f,
+    0x1.bf2ba6p-1f,
+    0x1.bf3acp-1f,
+    0x1.bf49d4p-1f,
+    0x1.bf58ep-1f,
+    0x1.bf67e6p-1f,
+    0x1.bf76e4p-1f,
+    0x1.bf85dcp-1f,
+    0x1.bf94d2p-1f,
+    0x1.bfa3bcp-1f,
+    0x1.bfb2ap-1f,
+    0x1.bfc18p-1f,
+    0x1.bfd05ap-1f,
+    0x1.bfdf26p-1f,
+    0x1.bfedf4p-1f,
+    0x1.bffcbap-1f,
+    0x1.c00b76p-1f,
+    0x1.c01a32p-1f,
+    0x1.c028e2p-1f,
+    0x1.c0378cp-1f,
+    0x1.c04632p-1f,
+    0x1.c054d2p-1f,
+    0x1.c0636ap-1f,
+    0x1.c071fcp-1f,
+    0x1.c0808cp-1f,
+    0x1.c08f1p-1f,
+    0x1.c09d9p-1f,
+    0x1.c0ac0ap-1f,
+    0x1.c0ba7cp-1f,
+    0x1.c0c8eap-1f,
+    0x1.c0d754p-1f,
+    0x1.c0e5b4p-1f,
+    0x1.c0f41p-1f,
+    0x1.c10264p-1f,
+    0x1.c110b4p-1f,
+    0x1.c11efcp-1f,
+    0x1.c12d4p-1f,
+    0x1.c13b7cp-1f,
+    0x1.c149b4p-1f,
+    0x1.c157e6p-1f,
+    0x1.c16612p-1f,
+    0x1.c1743ap-1f,
+    0x1.c18256p-1f,
+    0x1.c19072p-1f,
+    0x1.c19e86p-1f,
+    0x1.c1ac94p-1f,
+    0x1.c1ba9ep-1f,
+    0x1.c1c89ep-1f,
+    0x1.c1d69cp-1f,
+    0x1.c1e49p-1f,
+    0x1.c1f288p-1f,
+    0x1.c20072p-1f,
+    0x1.c20e5ap-1f,
+    0x1.c21c38p-1f,
+    0x1.c22a14p-1f,
+    0x1.c237e8p-1f,
+    0x1.c245bap-1f,
+    0x1.c25384p-1f,
+    0x1.c26146p-1f,
+    0x1.c26f08p-1f,
+    0x1.c27ccp-1f,
+    0x1.c28a74p-1f,
+    0x1.c29824p-1f,
+    0x1.c2a5ccp-1f,
+    0x1.c2b37p-1f,
+    0x1.c2c10cp-1f,
+    0x1.c2cea8p-1f,
+    0x1.c2dc3ap-1f,
+    0x1.c2e9c6p-1f,
+    0x1.c2f74ep-1f,
+    0x1.c304d4p-1f,
+    0x1.c3124ep-1f,
+    0x1.c31fcap-1f,
+    0x1.c32d3cp-1f,
+    0x1.c33aaap-1f,
+    0x1.c34814p-1f,
+    0x1.c35574p-1f,
+    0x1.c362d4p-1f,
+    0x1.c3702ap-1f,
+    0x1.c37d8p-1f,
+    0x1.c38acep-1f,
+    0x1.c39816p-1f,
+    0x1.c3a55cp-1f,
+    0x1.c3b29ap-1f,
+    0x1.c3bfd2p-1f,
+    0x1.c3cd08p-1f,
+    0x1.c3da38p-1f,
+    0x1.c3e76p-1f,
+    0x1.c3f484p-1f,
+    0x1.c401a8p-1f,
+    0x1.c40ecp-1f,
+    0x1.c41bd8p-1f,
+    0x1.c428e8p-1f,
+    0x1.c435f4p-1f,
+    0x1.c442fap-1f,
+    0x1.c44ffep-1f,
+    0x1.c45cfap-1f,
+    0x1.c469f2p-1f,
+    0x1.c476e4p-1f,
+    0x1.c483d4p-1f,
+    0x1.c490bcp-1f,
+    0x1.c49dap-1f,
+    0x1.c4aa8p-1f,
+    0x1.c4b758p-1f,
+    0x1.c4c42ep-1f,
+    0x1.c4d102p-1f,
+    0x1.c4ddccp-1f,
+    0x1.c4ea9p-1f,
+    0x1.c4f754p-1f,
+    0x1.c50414p-1f,
+    0x1.c510cap-1f,
+    0x1.c51d8p-1f,
+    0x1.c52a2ep-1f,
+    0x1.c536dap-1f,
+    0x1.c5437ep-1f,
+    0x1.c55022p-1f,
+    0x1.c55cbcp-1f,
+    0x1.c56954p-1f,
+    0x1.c575e6p-1f,
+    0x1.c58274p-1f,
+    0x1.c58fp-1f,
+    0x1.c59b86p-1f,
+    0x1.c5a806p-1f,
+    0x1.c5b47ep-1f,
+    0x1.c5c0f8p-1f,
+    0x1.c5cd6cp-1f,
+    0x1.c5d9d6p-1f,
+    0x1.c5e642p-1f,
+    0x1.c5f2a8p-1f,
+    0x1.c5ff08p-1f,
+    0x1.c60b62p-1f,
+    0x1.c617bep-1f,
+    0x1.c6241p-1f,
+    0x1.c6305cp-1f,
+    0x1.c63ca6p-1f,
+    0x1.c648ecp-1f,
+    0x1.c6552cp-1f,
+    0x1.c66168p-1f,
+    0x1.c66da2p-1f,
+    0x1.c679d4p-1f,
+    0x1.c68606p-1f,
+    0x1.c69234p-1f,
+    0x1.c69e56p-1f,
+    0x1.c6aa76p-1f,
+    0x1.c6b696p-1f,
+    0x1.c6c2b2p-1f,
+    0x1.c6cec6p-1f,
+    0x1.c6dad8p-1f,
+    0x1.c6e6e6p-1f,
+    0x1.c6f2ecp-1f,
+    0x1.c6fef2p-1f,
+    0x1.c70af2p-1f,
+    0x1.c716eep-1f,
+    0x1.c722e4p-1f,
+    0x1.c72ed8p-1f,
+    0x1.c73ac4p-1f,
+    0x1.c746bp-1f,
+    0x1.c75298p-1f,
+    0x1.c75e7ap-1f,
+    0x1.c76a56p-1f,
+    0x1.c77632p-1f,
+    0x1.c78208p-1f,
+    0x1.c78dd8p-1f,
+    0x1.c799a6p-1f,
+    0x1.c7a57p-1f,
+    0x1.c7b136p-1f,
+    0x1.c7bcf8p-1f,
+    0x1.c7c8b4p-1f,
+    0x1.c7d46ep-1f,
+    0x1.c7e022p-1f,
+    0x1.c7ebd4p-1f,
+    0x1.c7f78p-1f,
+    0x1.c8032ap-1f,
+    0x1.c80eccp-1f,
+    0x1.c81a6ep-1f,
+    0x1.c8260ap-1f,
+    0x1.c831a4p-1f,
+    0x1.c83d3ap-1f,
+    0x1.c848cap-1f,
+    0x1.c85458p-1f,
+    0x1.c85fep-1f,
+    0x1.c86b64p-1f,
+    0x1.c876e6p-1f,
+    0x1.c88262p-1f,
+    0x1.c88ddcp-1f,
+    0x1.c89952p-1f,
+    0x1.c8a4c4p-1f,
+    0x1.c8b03p-1f,
+    0x1.c8bb98p-1f,
+    0x1.c8c7p-1f,
+    0x1.c8d262p-1f,
+    0x1.c8ddbep-1f,
+    0x1.c8e918p-1f,
+    0x1.c8f472p-1f,
+    0x1.c8ffc4p-1f,
+    0x1.c90b1p-1f,
+    0x1.c9165cp-1f,
+    0x1.c921a4p-1f,
+    0x1.c92ce6p-1f,
+    0x1.c93826p-1f,
+    0x1.c9436p-1f,
+    0x1.c94e9ap-1f,
+    0x1.c959cep-1f,
+    0x1.c965p-1f,
+    0x1.c9702cp-1f,
+    0x1.c97b56p-1f,
+    0x1.c9867cp-1f,
+    0x1.c9919cp-1f,
+    0x1.c99cb8p-1f,
+    0x1.c9a7d4p-1f,
+    0x1.c9b2eep-1f,
+    0x1.c9bdfep-1f,
+    0x1.c9c91p-1f,
+    0x1.c9d41cp-1f,
+    0x1.c9df22p-1f,
+    0x1.c9ea28p-1f,
+    0x1.c9f528p-1f,
+    0x1.ca0024p-1f,
+    0x1.ca0b1ep-1f,
+    0x1.ca1616p-1f,
+    0x1.ca2108p-1f,
+    0x1.ca2bf8p-1f,
+    0x1.ca36e4p-1f,
+    0x1.ca41ccp-1f,
+    0x1.ca4caep-1f,
+    0x1.ca579p-1f,
+    0x1.ca626ep-1f,
+    0x1.ca6d46p-1f,
+    0x1.ca781cp-1f,
+    0x1.ca82fp-1f,
+    0x1.ca8dcp-1f,
+    0x1.ca988cp-1f,
+    0x1.caa354p-1f,
+    0x1.caae18p-1f,
+    0x1.cab8d8p-1f,
+    0x1.cac398p-1f,
+    0x1.cace5p-1f,
+    0x1.cad90ap-1f,
+    0x1.cae3bcp-1f,
+    0x1.caee6cp-1f,
+    0x1.caf91ap-1f,
+    0x1.cb03c2p-1f,
+    0x1.cb0e6ap-1f,
+    0x1.cb190ap-1f,
+    0x1.cb23acp-1f,
+    0x1.cb2e46p-1f,
+    0x1.cb38dcp-1f,
+    0x1.cb4374p-1f,
+    0x1.cb4e06p-1f,
+    0x1.cb5894p-1f,
+    0x1.cb631ep-1f,
+    0x1.cb6da8p-1f,
+    0x1.cb782cp-1f,
+    0x1.cb82aap-1f,
+    0x1.cb8d28p-1f,
+    0x1.cb97a6p-1f,
+    0x1.cba21ap-1f,
+    0x1.cbac9p-1f,
+    0x1.cbb7p-1f,
+    0x1.cbc16ep-1f,
+    0x1.cbcbd6p-1f,
+    0x1.cbd64p-1f,
+    0x1.cbe0a2p-1f,
+    0x1.cbebp-1f,
+    0x1.cbf56p-1f,
+    0x1.cbffbap-1f,
+    0x1.cc0a1p-1f,
+    0x1.cc1464p-1f,
+    0x1.cc1eb6p-1f,
+    0x1.cc29p-1f,
+    0x1.cc334cp-1f,
+    0x1.cc3d94p-1f,
+    0x1.cc47d6p-1f,
+    0x1.cc5216p-1f,
+    0x1.cc5c52p-1f,
+    0x1.cc669p-1f,
+    0x1.cc70c4p-1f,
+    0x1.cc7afap-1f,
+    0x1.cc852cp-1f,
+    0x1.cc8f56p-1f,
+    0x1.cc9982p-1f,
+    0x1.cca3aap-1f,
+    0x1.ccadcep-1f,
+    0x1.ccb7eep-1f,
+    0x1.ccc20cp-1f,
+    0x1.cccc28p-1f,
+    0x1.ccd64p-1f,
+    0x1.cce056p-1f,
+    0x1.ccea68p-1f,
+    0x1.ccf476p-1f,
+    0x1.ccfe84p-1f,
+    0x1.cd088cp-1f,
+    0x1.cd129p-1f,
+    0x1.cd1c94p-1f,
+    0x1.cd2694p-1f,
+    0x1.cd309p-1f,
+    0x1.cd3a8cp-1f,
+    0x1.cd4482p-1f,
+    0x1.cd4e76p-1f,
+    0x1.cd5864p-1f,
+    0x1.cd6254p-1f,
+    0x1.cd6c3ep-1f,
+    0x1.cd7626p-1f,
+    0x1.cd800ap-1f,
+    0x1.cd89ecp-1f,
+    0x1.cd93cap-1f,
+    0x1.cd9da8p-1f,
+    0x1.cda78p-1f,
+    0x1.cdb154p-1f,
+    0x1.cdbb2cp-1f,
+    0x1.cdc4fap-1f,
+    0x1.cdcec8p-1f,
+    0x1.cdd894p-1f,
+    0x1.cde25ap-1f,
+    0x1.cdec2p-1f,
+    0x1.cdf5ep-1f,
+    0x1.cdffa4p-1f,
+    0x1.ce095cp-1f,
+    0x1.ce1314p-1f,
+    0x1.ce1cccp-1f,
+    0x1.ce268p-1f,
+    0x1.ce303p-1f,
+    0x1.ce39dep-1f,
+    0x1.ce438ap-1f,
+    0x1.ce4d32p-1f,
+    0x1.ce56d4p-1f,
+    0x1.ce607ap-1f,
+    0x1.ce6a18p-1f,
+    0x1.ce73b4p-1f,
+    0x1.ce7d5p-1f,
+    0x1.ce86e8p-1f,
+    0x1.ce907cp-1f,
+    0x1.ce9a1p-1f,
+    0x1.cea39ep-1f,
+    0x1.cead2ap-1f,
+    0x1.ceb6b2p-1f,
+    0x1.cec03cp-1f,
+    0x1.cec9bep-1f,
+    0x1.ced34p-1f,
+    0x1.cedcbep-1f,
+    0x1.cee63ap-1f,
+    0x1.ceefb2p-1f,
+    0x1.cef92ap-1f,
+    0x1.cf029ep-1f,
+    0x1.cf0c0ep-1f,
+    0x1.cf157cp-1f,
+    0x1.cf1ee8p-1f,
+    0x1.cf285p-1f,
+    0x1.cf31b6p-1f,
+    0x1.cf3b1cp-1f,
+    0x1.cf447cp-1f,
+    0x1.cf4ddap-1f,
+    0x1.cf5738p-1f,
+    0x1.cf608ep-1f,
+    0x1.cf69e4p-1f,
+    0x1.cf7338p-1f,
+    0x1.cf7c8ap-1f,
+    0x1.cf85d8p-1f,
+    0x1.cf8f24p-1f,
+    0x1.cf986cp-1f,
+    0x1.cfa1b4p-1f,
+    0x1.cfaaf8p-1f,
+    0x1.cfb438p-1f,
+    0x1.cfbd76p-1f,
+    0x1.cfc6bp-1f,
+    0x1.cfcfecp-1f,
+    0x1.cfd922p-1f,
+    0x1.cfe258p-1f,
+    0x1.cfeb88p-1f,
+    0x1.cff4b8p-1f,
+    0x1.cffde4p-1f,
+    0x1.d0070ep-1f,
+    0x1.d01038p-1f,
+    0x1.d0195ap-1f,
+    0x1.d0227cp-1f,
+    0x1.d02b9ep-1f,
+    0x1.d034bap-1f,
+    0x1.d03dd4p-1f,
+    0x1.d046ecp-1f,
+    0x1.d05004p-1f,
+    0x1.d05916p-1f,
+    0x1.d06228p-1f,
+    0x1.d06b34p-1f,
+    0x1.d0744p-1f,
+    0x1.d07d48p-1f,
+    0x1.d0865p-1f,
+    0x1.d08f54p-1f,
+    0x1.d09858p-1f,
+    0x1.d0a156p-1f,
+    0x1.d0aa52p-1f,
+    0x1.d0b34ep-1f,
+    0x1.d0bc44p-1f,
+    0x1.d0c53ap-1f,
+    0x1.d0ce2cp-1f,
+    0x1.d0d71ep-1f,
+    0x1.d0e00cp-1f,
+    0x1.d0e8f8p-1f,
+    0x1.d0f1e2p-1f,
+    0x1.d0fac8p-1f,
+    0x1.d103acp-1f,
+    0x1.d10c8cp-1f,
+    0x1.d1156cp-1f,
+    0x1.d11e4ap-1f,
+    0x1.d12724p-1f,
+    0x1.d12ffep-1f,
+    0x1.d138d4p-1f,
+    0x1.d141a6p-1f,
+    0x1.d14a78p-1f,
+    0x1.d15348p-1f,
+    0x1.d15c12p-1f,
+    0x1.d164dcp-1f,
+    0x1.d16da4p-1f,
+    0x1.d17668p-1f,
+    0x1.d17f2cp-1f,
+    0x1.d187ecp-1f,
+    0x1.d190acp-1f,
+    0x1.d19968p-1f,
+    0x1.d1a222p-1f,
+    0x1.d1aad8p-1f,
+    0x1.d1b38cp-1f,
+    0x1.d1bc3ep-1f,
+    0x1.d1c4fp-1f,
+    0x1.d1cd9cp-1f,
+    0x1.d1d648p-1f,
+    0x1.d1def4p-1f,
+    0x1.d1e79ap-1f,
+    0x1.d1f04p-1f,
+    0x1.d1f8e2p-1f,
+    0x1.d20182p-1f,
+    0x1.d20a1ep-1f,
+    0x1.d212bcp-1f,
+    0x1.d21b54p-1f,
+    0x1.d223ecp-1f,
+    0x1.d22c8p-1f,
+    0x1.d23512p-1f,
+    0x1.d23da2p-1f,
+    0x1.d2463p-1f,
+    0x1.d24ebcp-1f,
+    0x1.d25744p-1f,
+    0x1.d25fccp-1f,
+    0x1.d26854p-1f,
+    0x1.d270d4p-1f,
+    0x1.d27956p-1f,
+    0x1.d281d4p-1f,
+    0x1.d28a5p-1f,
+    0x1.d292c8p-1f,
+    0x1.d29b42p-1f,
+    0x1.d2a3b6p-1f,
+    0x1.d2ac28p-1f,
+    0x1.d2b49cp-1f,
+    0x1.d2bd0ap-1f,
+    0x1.d2c578p-1f,
+    0x1.d2cde2p-1f,
+    0x1.d2d64cp-1f,
+    0x1.d2debp-1f,
+    0x1.d2e714p-1f,
+    0x1.d2ef78p-1f,
+    0x1.d2f7d6p-1f,
+    0x1.d30032p-1f,
+    0x1.d3088ep-1f,
+    0x1.d310e8p-1f,
+    0x1.d3194p-1f,
+    0x1.d32194p-1f,
+    0x1.d329e8p-1f,
+    0x1.d33238p-1f,
+    0x1.d33a86p-1f,
+    0x1.d342d2p-1f,
+    0x1.d34b1cp-1f,
+    0x1.d35364p-1f,
+    0x1.d35baap-1f,
+    0x1.d363eep-1f,
+    0x1.d36c3p-1f,
+    0x1.d3747p-1f,
+    0x1.d37cacp-1f,
+    0x1.d384e6p-1f,
+    0x1.d38d22p-1f,
+    0x1.d3955ap-1f,
+    0x1.d39d8ep-1f,
+    0x1.d3a5cp-1f,
+    0x1.d3adf4p-1f,
+    0x1.d3b622p-1f,
+    0x1.d3be4ep-1f,
+    0x1.d3c67ap-1f,
+    0x1.d3ceap-1f,
+    0x1.d3d6c8p-1f,
+    0x1.d3deeep-1f,
+    0x1.d3e71p-1f,
+    0x1.d3ef3p-1f,
+    0x1.d3f75p-1f,
+    0x1.d3ff6cp-1f,
+    0x1.d40786p-1f,
+    0x1.d40f9ep-1f,
+    0x1.d417b4p-1f,
+    0x1.d41fc8p-1f,
+    0x1.d427d8p-1f,
+    0x1.d42feap-1f,
+    0x1.d437f8p-1f,
+    0x1.d44004p-1f,
+    0x1.d4481p-1f,
+    0x1.d45018p-1f,
+    0x1.d4581ep-1f,
+    0x1.d4602p-1f,
+    0x1.d46824p-1f,
+    0x1.d47024p-1f,
+    0x1.d47824p-1f,
+    0x1.d4802p-1f,
+    0x1.d4881ap-1f,
+    0x1.d49012p-1f,
+    0x1.d49808p-1f,
+    0x1.d49ffcp-1f,
+    0x1.d4a7ecp-1f,
+    0x1.d4afep-1f,
+    0x1.d4b7ccp-1f,
+    0x1.d4bfb8p-1f,
+    0x1.d4c7a4p-1f,
+    0x1.d4cf8cp-1f,
+    0x1.d4d774p-1f,
+    0x1.d4df58p-1f,
+    0x1.d4e73cp-1f,
+    0x1.d4ef1cp-1f,
+    0x1.d4f6fcp-1f,
+    0x1.d4fed8p-1f,
+    0x1.d506b2p-1f,
+    0x1.d50e8ap-1f,
+    0x1.d51664p-1f,
+    0x1.d51e38p-1f,
+    0x1.d5260ap-1f,
+    0x1.d52ddep-1f,
+    0x1.d535aep-1f,
+    0x1.d53d7ap-1f,
+    0x1.d54546p-1f,
+    0x1.d54d1p-1f,
+    0x1.d554d8p-1f,
+    0x1.d55c9ep-1f,
+    0x1.d56462p-1f,
+    0x1.d56c24p-1f,
+    0x1.d573e4p-1f,
+    0x1.d57ba4p-1f,
+    0x1.d5836p-1f,
+    0x1.d58b1ap-1f,
+    0x1.d592d4p-1f,
+    0x1.d59a8cp-1f,
+    0x1.d5a24p-1f,
+    0x1.d5a9f4p-1f,
+    0x1.d5b1a4p-1f,
+    0x1.d5b956p-1f,
+    0x1.d5c102p-1f,
+    0x1.d5c8bp-1f,
+    0x1.d5d058p-1f,
+    0x1.d5d802p-1f,
+    0x1.d5dfa8p-1f,
+    0x1.d5e74cp-1f,
+    0x1.d5eeeep-1f,
+    0x1.d5f69p-1f,
+    0x1.d5fe3p-1f,
+    0x1.d605ccp-1f,
+    0x1.d60d68p-1f,
+    0x1.d61502p-1f,
+    0x1.d61c98p-1f,
+    0x1.d6242ep-1f,
+    0x1.d62bc4p-1f,
+    0x1.d63356p-1f,
+    0x1.d63ae6p-1f,
+    0x1.d64276p-1f,
+    0x1.d64a04p-1f,
+    0x1.d6518ep-1f,
+    0x1.d65918p-1f,
+    0x1.d660ap-1f,
+    0x1.d66824p-1f,
+    0x1.d66faap-1f,
+    0x1.d6772cp-1f,
+    0x1.d67eacp-1f,
+    0x1.d6862cp-1f,
+    0x1.d68da8p-1f,
+    0x1.d69524p-1f,
+    0x1.d69c9cp-1f,
+    0x1.d6a418p-1f,
+    0x1.d6ab8cp-1f,
+    0x1.d6b3p-1f,
+    0x1.d6ba72p-1f,
+    0x1.d6c1e4p-1f,
+    0x1.d6c954p-1f,
+    0x1.d6d0cp-1f,
+    0x1.d6d82cp-1f,
+    0x1.d6df96p-1f,
+    0x1.d6e6fep-1f,
+    0x1.d6ee64p-1f,
+    0x1.d6f5c8p-1f,
+    0x1.d6fd2cp-1f,
+    0x1.d7048cp-1f,
+    0x1.d70becp-1f,
+    0x1.d7134ap-1f,
+    0x1.d71aa8p-1f,
+    0x1.d72202p-1f,
+    0x1.d7295ap-1f,
+    0x1.d730bp-1f,
+    0x1.d73806p-1f,
+    0x1.d73f58p-1f,
+    0x1.d746acp-1f,
+    0x1.d74dfcp-1f,
+    0x1.d7554ap-1f,
+    0x1.d75c98p-1f,
+    0x1.d763e4p-1f,
+    0x1.d76b2cp-1f,
+    0x1.d77274p-1f,
+    0x1.d779bap-1f,
+    0x1.d781p-1f,
+    0x1.d78842p-1f,
+    0x1.d78f82p-1f,
+    0x1.d796c2p-1f,
+    0x1.d79ep-1f,
+    0x1.d7a53cp-1f,
+    0x1.d7ac78p-1f,
+    0x1.d7b3bp-1f,
+    0x1.d7bae6p-1f,
+    0x1.d7c21cp-1f,
+    0x1.d7c95p-1f,
+    0x1.d7d082p-1f,
+    0x1.d7d7b4p-1f,
+    0x1.d7dee4p-1f,
+    0x1.d7e61p-1f,
+    0x1.d7ed3cp-1f,
+    0x1.d7f466p-1f,
+    0x1.d7fb8ep-1f,
+    0x1.d802b4p-1f,
+    0x1.d809dap-1f,
+    0x1.d811p-1f,
+    0x1.d8182p-1f,
+    0x1.d81f4p-1f,
+    0x1.d8266p-1f,
+    0x1.d82d7cp-1f,
+    0x1.d83498p-1f,
+    0x1.d83bb2p-1f,
+    0x1.d842cap-1f,
+    0x1.d849e2p-1f,
+    0x1.d850f8p-1f,
+    0x1.d8580ap-1f,
+    0x1.d85f1cp-1f,
+    0x1.d8662cp-1f,
+    0x1.d86d3cp-1f,
+    0x1.d87448p-1f,
+    0x1.d87b54p-1f,
+    0x1.d8826p-1f,
+    0x1.d88968p-1f,
+    0x1.d8906ep-1f,
+    0x1.d89774p-1f,
+    0x1.d89e78p-1f,
+    0x1.d8a57ap-1f,
+    0x1.d8ac7ap-1f,
+    0x1.d8b378p-1f,
+    0x1.d8ba76p-1f,
+    0x1.d8c174p-1f,
+    0x1.d8c86ep-1f,
+    0x1.d8cf66p-1f,
+    0x1.d8d65ep-1f,
+    0x1.d8dd54p-1f,
+    0x1.d8e448p-1f,
+    0x1.d8eb3cp-1f,
+    0x1.d8f22cp-1f,
+    0x1.d8f91cp-1f,
+    0x1.d9000ap-1f,
+    0x1.d906f6p-1f,
+    0x1.d90de2p-1f,
+    0x1.d914ccp-1f,
+    0x1.d91bb4p-1f,
+    0x1.d9229ap-1f,
+    0x1.d9298p-1f,
+    0x1.d93064p-1f,
+    0x1.d93744p-1f,
+    0x1.d93e24p-1f,
+    0x1.d94504p-1f,
+    0x1.d94be2p-1f,
+    0x1.d952bcp-1f,
+    0x1.d95998p-1f,
+    0x1.d96072p-1f,
+    0x1.d96748p-1f,
+    0x1.d96e1ep-1f,
+    0x1.d974f2p-1f,
+    0x1.d97bc6p-1f,
+    0x1.d98296p-1f,
+    0x1.d98968p-1f,
+    0x1.d99036p-1f,
+    0x1.d99704p-1f,
+    0x1.d99dcep-1f,
+    0x1.d9a498p-1f,
+    0x1.d9ab6p-1f,
+    0x1.d9b228p-1f,
+    0x1.d9b8fp-1f,
+    0x1.d9bfb2p-1f,
+    0x1.d9c674p-1f,
+    0x1.d9cd38p-1f,
+    0x1.d9d3f6p-1f,
+    0x1.d9dab6p-1f,
+    0x1.d9e17p-1f,
+    0x1.d9e82cp-1f,
+    0x1.d9eee6p-1f,
+    0x1.d9f5ap-1f,
+    0x1.d9fc56p-1f,
+    0x1.da030cp-1f,
+    0x1.da09cp-1f,
+    0x1.da1074p-1f,
+    0x1.da1724p-1f,
+    0x1.da1dd4p-1f,
+    0x1.da2484p-1f,
+    0x1.da2b3p-1f,
+    0x1.da31dap-1f,
+    0x1.da3886p-1f,
+    0x1.da3f2ep-1f,
+    0x1.da45d4p-1f,
+    0x1.da4c7cp-1f,
+    0x1.da532p-1f,
+    0x1.da59c2p-1f,
+    0x1.da6064p-1f,
+    0x1.da6704p-1f,
+    0x1.da6da4p-1f,
+    0x1.da744p-1f,
+    0x1.da7adcp-1f,
+    0x1.da8178p-1f,
+    0x1.da881p-1f,
+    0x1.da8ea8p-1f,
+    0x1.da953ep-1f,
+    0x1.da9bd2p-1f,
+    0x1.daa268p-1f,
+    0x1.daa8f8p-1f,
+    0x1.daaf8ap-1f,
+    0x1.dab61ap-1f,
+    0x1.dabca8p-1f,
+    0x1.dac334p-1f,
+    0x1.dac9bep-1f,
+    0x1.dad048p-1f,
+    0x1.dad6d2p-1f,
+    0x1.dadd58p-1f,
+    0x1.dae3ep-1f,
+    0x1.daea62p-1f,
+    0x1.daf0e6p-1f,
+    0x1.daf768p-1f,
+    0x1.dafde8p-1f,
+    0x1.db0468p-1f,
+    0x1.db0ae4p-1f,
+    0x1.db116p-1f,
+    0x1.db17dcp-1f,
+    0x1.db1e56p-1f,
+    0x1.db24cep-1f,
+    0x1.db2b44p-1f,
+    0x1.db31b8p-1f,
+    0x1.db382ep-1f,
+    0x1.db3eap-1f,
+    0x1.db4512p-1f,
+    0x1.db4b82p-1f,
+    0x1.db51fp-1f,
+    0x1.db585ep-1f,
+    0x1.db5ecap-1f,
+    0x1.db6534p-1f,
+    0x1.db6b9cp-1f,
+    0x1.db7206p-1f,
+    0x1.db786cp-1f,
+    0x1.db7ed2p-1f,
+    0x1.db8538p-1f,
+    0x1.db8b98p-1f,
+    0x1.db91fap-1f,
+    0x1.db9858p-1f,
+    0x1.db9ebap-1f,
+    0x1.dba516p-1f,
+    0x1.dbab74p-1f,
+    0x1.dbb1cep-1f,
+    0x1.dbb828p-1f,
+    0x1.dbbe7ep-1f,
+    0x1.dbc4d4p-1f,
+    0x1.dbcb2cp-1f,
+    0x1.dbd17ep-1f,
+    0x1.dbd7d2p-1f,
+    0x1.dbde24p-1f,
+    0x1.dbe474p-1f,
+    0x1.dbeac4p-1f,
+    0x1.dbf112p-1f,
+    0x1.dbf76p-1f,
+    0x1.dbfda8p-1f,
+    0x1.dc03f4p-1f,
+    0x1.dc0a3cp-1f,
+    0x1.dc1084p-1f,
+    0x1.dc16cap-1f,
+    0x1.dc1d0ep-1f,
+    0x1.dc2352p-1f,
+    0x1.dc2994p-1f,
+    0x1.dc2fd4p-1f,
+    0x1.dc3614p-1f,
+    0x1.dc3c52p-1f,
+    0x1.dc429p-1f,
+    0x1.dc48ccp-1f,
+    0x1.dc4f06p-1f,
+    0x1.dc554p-1f,
+    0x1.dc5b78p-1f,
+    0x1.dc61aep-1f,
+    0x1.dc67e4p-1f,
+    0x1.dc6e1ap-1f,
+    0x1.dc744cp-1f,
+    0x1.dc7a7ep-1f,
+    0x1.dc80bp-1f,
+    0x1.dc86dcp-1f,
+    0x1.dc8d0cp-1f,
+    0x1.dc9338p-1f,
+    0x1.dc9964p-1f,
+    0x1.dc9f8ep-1f,
+    0x1.dca5b8p-1f,
+    0x1.dcabep-1f,
+    0x1.dcb204p-1f,
+    0x1.dcb82cp-1f,
+    0x1.dcbe5p-1f,
+    0x1.dcc472p-1f,
+    0x1.dcca94p-1f,
+    0x1.dcd0b4p-1f,
+    0x1.dcd6d4p-1f,
+    0x1.dcdcf2p-1f,
+    0x1.dce30ep-1f,
+    0x1.dce92ap-1f,
+    0x1.dcef44p-1f,
+    0x1.dcf55cp-1f,
+    0x1.dcfb76p-1f,
+    0x1.dd018cp-1f,
+    0x1.dd07a2p-1f,
+    0x1.dd0db8p-1f,
+    0x1.dd13c8p-1f,
+    0x1.dd19dcp-1f,
+    0x1.dd1feap-1f,
+    0x1.dd25fap-1f,
+    0x1.dd2c08p-1f,
+    0x1.dd3216p-1f,
+    0x1.dd382p-1f,
+    0x1.dd3e2cp-1f,
+    0x1.dd4436p-1f,
+    0x1.dd4a3ep-1f,
+    0x1.dd5044p-1f,
+    0x1.dd564ap-1f,
+    0x1.dd5c5p-1f,
+    0x1.dd6252p-1f,
+    0x1.dd6854p-1f,
+    0x1.dd6e56p-1f,
+    0x1.dd7456p-1f,
+    0x1.dd7a54p-1f,
+    0x1.dd8052p-1f,
+    0x1.dd865p-1f,
+    0x1.dd8c48p-1f,
+    0x1.dd9244p-1f,
+    0x1.dd983cp-1f,
+    0x1.dd9e34p-1f,
+    0x1.dda42ap-1f,
+    0x1.ddaa2p-1f,
+    0x1.ddb014p-1f,
+    0x1.ddb606p-1f,
+    0x1.ddbbf8p-1f,
+    0x1.ddc1eap-1f,
+    0x1.ddc7d8p-1f,
+    0x1.ddcdc8p-1f,
+    0x1.ddd3b4p-1f,
+    0x1.ddd9ap-1f,
+    0x1.dddf8cp-1f,
+    0x1.dde576p-1f,
+    0x1.ddeb5ep-1f,
+    0x1.ddf144p-1f,
+    0x1.ddf72cp-1f,
+    0x1.ddfd1p-1f,
+    0x1.de02f4p-1f,
+    0x1.de08d6p-1f,
+    0x1.de0eb8p-1f,
+    0x1.de1498p-1f,
+    0x1.de1a78p-1f,
+    0x1.de2056p-1f,
+    0x1.de2634p-1f,
+    0x1.de2c1p-1f,
+    0x1.de31ecp-1f,
+    0x1.de37c4p-1f,
+    0x1.de3d9cp-1f,
+    0x1.de4374p-1f,
+    0x1.de494ap-1f,
+    0x1.de4f2p-1f,
+    0x1.de54f4p-1f,
+    0x1.de5ac8p-1f,
+    0x1.de6098p-1f,
+    0x1.de6668p-1f,
+    0x1.de6c38p-1f,
+    0x1.de7206p-1f,
+    0x1.de77d4p-1f,
+    0x1.de7dap-1f,
+    0x1.de836cp-1f,
+    0x1.de8936p-1f,
+    0x1.de8fp-1f,
+    0x1.de94c6p-1f,
+    0x1.de9a8cp-1f,
+    0x1.dea052p-1f,
+    0x1.dea618p-1f,
+    0x1.deabdap-1f,
+    0x1.deb19cp-1f,
+    0x1.deb75ep-1f,
+    0x1.debd1cp-1f,
+    0x1.dec2dcp-1f,
+    0x1.dec89ap-1f,
+    0x1.dece58p-1f,
+    0x1.ded412p-1f,
+    0x1.ded9cep-1f,
+    0x1.dedf86p-1f,
+    0x1.dee54p-1f,
+    0x1.deeaf8p-1f,
+    0x1.def0acp-1f,
+    0x1.def662p-1f,
+    0x1.defc16p-1f,
+    0x1.df01cap-1f,
+    0x1.df077ap-1f,
+    0x1.df0d2cp-1f,
+    0x1.df12dcp-1f,
+    0x1.df1888p-1f,
+    0x1.df1e38p-1f,
+    0x1.df23e4p-1f,
+    0x1.df299p-1f,
+    0x1.df2f38p-1f,
+    0x1.df34e4p-1f,
+    0x1.df3a8cp-1f,
+    0x1.df4032p-1f,
+    0x1.df45d8p-1f,
+    0x1.df4b7ep-1f,
+    0x1.df512p-1f,
+    0x1.df56c4p-1f,
+    0x1.df5c66p-1f,
+    0x1.df6206p-1f,
+    0x1.df67a6p-1f,
+    0x1.df6d44p-1f,
+    0x1.df72e2p-1f,
+    0x1.df788p-1f,
+    0x1.df7e1ap-1f,
+    0x1.df83b6p-1f,
+    0x1.df894ep-1f,
+    0x1.df8ee6p-1f,
+    0x1.df947ep-1f,
+    0x1.df9a14p-1f,
+    0x1.df9fa8p-1f,
+    0x1.dfa53ep-1f,
+    0x1.dfaadp-1f,
+    0x1.dfb064p-1f,
+    0x1.dfb5f4p-1f,
+    0x1.dfbb84p-1f,
+    0x1.dfc112p-1f,
+    0x1.dfc6a2p-1f,
+    0x1.dfcc2ep-1f,
+    0x1.dfd1b8p-1f,
+    0x1.dfd744p-1f,
+    0x1.dfdccep-1f,
+    0x1.dfe258p-1f,
+    0x1.dfe7ep-1f,
+    0x1.dfed66p-1f,
+    0x1.dff2ecp-1f,
+    0x1.dff87p-1f,
+    0x1.dffdf4p-1f,
+    0x1.e00376p-1f,
+    0x1.e008f8p-1f,
+    0x1.e00e78p-1f,
+    0x1.e013f8p-1f,
+    0x1.e01978p-1f,
+    0x1.e01ef6p-1f,
+    0x1.e02472p-1f,
+    0x1.e029ecp-1f,
+    0x1.e02f68p-1f,
+    0x1.e034ep-1f,
+    0x1.e03a5ap-1f,
+    0x1.e03fdp-1f,
+    0x1.e04548p-1f,
+    0x1.e04abcp-1f,
+    0x1.e0503p-1f,
+    0x1.e055a6p-1f,
+    0x1.e05b16p-1f,
+    0x1.e06088p-1f,
+    0x1.e065f8p-1f,
+    0x1.e06b68p-1f,
+    0x1.e070d6p-1f,
+    0x1.e07644p-1f,
+    0x1.e07bbp-1f,
+    0x1.e0811cp-1f,
+    0x1.e08688p-1f,
+    0x1.e08bf2p-1f,
+    0x1.e0915ap-1f,
+    0x1.e096cp-1f,
+    0x1.e09c28p-1f,
+    0x1.e0a18cp-1f,
+    0x1.e0a6f2p-1f,
+    0x1.e0ac56p-1f,
+    0x1.e0b1b8p-1f,
+    0x1.e0b71ap-1f,
+    0x1.e0bc7ap-1f,
+    0x1.e0c1dap-1f,
+    0x1.e0c738p-1f,
+    0x1.e0cc96p-1f,
+    0x1.e0d1f4p-1f,
+    0x1.e0d74ep-1f,
+    0x1.e0dcaap-1f,
+    0x1.e0e204p-1f,
+    0x1.e0e75ep-1f,
+    0x1.e0ecb4p-1f,
+    0x1.e0f20cp-1f,
+    0x1.e0f762p-1f,
+    0x1.e0fcb6p-1f,
+    0x1.e1020ap-1f,
+    0x1.e1075ep-1f,
+    0x1.e10cbp-1f,
+    0x1.e11202p-1f,
+    0x1.e11752p-1f,
+    0x1.e11cap-1f,
+    0x1.e121eep-1f,
+    0x1.e1273ep-1f,
+    0x1.e12c88p-1f,
+    0x1.e131d4p-1f,
+    0x1.e1371ep-1f,
+    0x1.e13c68p-1f,
+    0x1.e141bp-1f,
+    0x1.e146f8p-1f,
+    0x1.e14c4p-1f,
+    0x1.e15184p-1f,
+    0x1.e156cap-1f,
+    0x1.e15c0ep-1f,
+    0x1.e1615p-1f,
+    0x1.e16692p-1f,
+    0x1.e16bd4p-1f,
+    0x1.e17114p-1f,
+    0x1.e17654p-1f,
+    0x1.e17b92p-1f,
+    0x1.e180cep-1f,
+    0x1.e1860ap-1f,
+    0x1.e18b46p-1f,
+    0x1.e19082p-1f,
+    0x1.e195bap-1f,
+    0x1.e19af2p-1f,
+    0x1.e1a02ap-1f,
+    0x1.e1a562p-1f,
+    0x1.e1aa98p-1f,
+    0x1.e1afccp-1f,
+    0x1.e1b5p-1f,
+    0x1.e1ba34p-1f,
+    0x1.e1bf66p-1f,
+    0x1.e1c496p-1f,
+    0x1.e1c9c6p-1f,
+    0x1.e1cef8p-1f,
+    0x1.e1d426p-1f,
+    0x1.e1d952p-1f,
+    0x1.e1de8p-1f,
+    0x1.e1e3acp-1f,
+    0x1.e1e8d6p-1f,
+    0x1.e1edfep-1f,
+    0x1.e1f328p-1f,
+    0x1.e1f85p-1f,
+    0x1.e1fd78p-1f,
+    0x1.e2029ep-1f,
+    0x1.e207c4p-1f,
+    0x1.e20ce8p-1f,
+    0x1.e2120cp-1f,
+    0x1.e2173p-1f,
+    0x1.e21c5p-1f,
+    0x1.e2217p-1f,
+    0x1.e22692p-1f,
+    0x1.e22bbp-1f,
+    0x1.e230cep-1f,
+    0x1.e235ecp-1f,
+    0x1.e23b08p-1f,
+    0x1.e24022p-1f,
+    0x1.e2453ep-1f,
+    0x1.e24a58p-1f,
+    0x1.e24f7p-1f,
+    0x1.e25488p-1f,
+    0x1.e259ap-1f,
+    0x1.e25eb6p-1f,
+    0x1.e263cap-1f,
+    0x1.e268ep-1f,
+    0x1.e26df2p-1f,
+    0x1.e27304p-1f,
+    0x1.e27818p-1f,
+    0x1.e27d28p-1f,
+    0x1.e28238p-1f,
+    0x1.e28746p-1f,
+    0x1.e28c54p-1f,
+    0x1.e29162p-1f,
+    0x1.e2966ep-1f,
+    0x1.e29b7ap-1f,
+    0x1.e2a084p-1f,
+    0x1.e2a58ep-1f,
+    0x1.e2aa96p-1f,
+    0x1.e2af9ep-1f,
+    0x1.e2b4a6p-1f,
+    0x1.e2b9acp-1f,
+    0x1.e2beb2p-1f,
+    0x1.e2c3b6p-1f,
+    0x1.e2c8bap-1f,
+    0x1.e2cdbep-1f,
+    0x1.e2d2bep-1f,
+    0x1.e2d7cp-1f,
+    0x1.e2dccp-1f,
+    0x1.e2e1cp-1f,
+    0x1.e2e6bep-1f,
+    0x1.e2ebbcp-1f,
+    0x1.e2f0b8p-1f,
+    0x1.e2f5b4p-1f,
+    0x1.e2fabp-1f,
+    0x1.e2ffaap-1f,
+    0x1.e304a2p-1f,
+    0x1.e3099ap-1f,
+    0x1.e30e92p-1f,
+    0x1.e3138ap-1f,
+    0x1.e3188p-1f,
+    0x1.e31d74p-1f,
+    0x1.e32268p-1f,
+    0x1.e3275cp-1f,
+    0x1.e32c5p-1f,
+    0x1.e3314p-1f,
+    0x1.e3363p-1f,
+    0x1.e33b2p-1f,
+    0x1.e3401p-1f,
+    0x1.e344fep-1f,
+    0x1.e349ecp-1f,
+    0x1.e34ed8p-1f,
+    0x1.e353c4p-1f,
+    0x1.e358aep-1f,
+    0x1.e35d9ap-1f,
+    0x1.e36282p-1f,
+    0x1.e3676ap-1f,
+    0x1.e36c52p-1f,
+    0x1.e37138p-1f,
+    0x1.e3761ep-1f,
+    0x1.e37b04p-1f,
+    0x1.e37fe8p-1f,
+    0x1.e384ccp-1f,
+    0x1.e389aep-1f,
+    0x1.e38e9p-1f,
+    0x1.e3937p-1f,
+    0x1.e39852p-1f,
+    0x1.e39d3p-1f,
+    0x1.e3a20ep-1f,
+    0x1.e3a6ecp-1f,
+    0x1.e3abc8p-1f,
+    0x1.e3b0a4p-1f,
+    0x1.e3b58p-1f,
+    0x1.e3ba5cp-1f,
+    0x1.e3bf32p-1f,
+    0x1.e3c40cp-1f,
+    0x1.e3c8e4p-1f,
+    0x1.e3cdbcp-1f,
+    0x1.e3d29p-1f,
+    0x1.e3d766p-1f,
+    0x1.e3dc3cp-1f,
+    0x1.e3e10ep-1f,
+    0x1.e3e5e2p-1f,
+    0x1.e3eab4p-1f,
+    0x1.e3ef84p-1f,
+    0x1.e3f456p-1f,
+    0x1.e3f926p-1f,
+    0x1.e3fdf4p-1f,
+    0x1.e402c2p-1f,
+    0x1.e4079p-1f,
+    0x1.e40c5cp-1f,
+    0x1.e41128p-1f,
+    0x1.e415f2p-1f,
+    0x1.e41abcp-1f,
+    0x1.e41f86p-1f,
+    0x1.e4244ep-1f,
+    0x1.e42916p-1f,
+    0x1.e42ddcp-1f,
+    0x1.e432a4p-1f,
+    0x1.e43768p-1f,
+    0x1.e43c2cp-1f,
+    0x1.e440fp-1f,
+    0x1.e445b2p-1f,
+    0x1.e44a76p-1f,
+    0x1.e44f36p-1f,
+    0x1.e453f6p-1f,
+    0x1.e458b6p-1f,
+    0x1.e45d76p-1f,
+    0x1.e46234p-1f,
+    0x1.e466f2p-1f,
+    0x1.e46bacp-1f,
+    0x1.e47068p-1f,
+    0x1.e47524p-1f,
+    0x1.e479dep-1f,
+    0x1.e47e98p-1f,
+    0x1.e4835p-1f,
+    0x1.e48808p-1f,
+    0x1.e48ccp-1f,
+    0x1.e49176p-1f,
+    0x1.e4962cp-1f,
+    0x1.e49aep-1f,
+    0x1.e49f92p-1f,
+    0x1.e4a446p-1f,
+    0x1.e4a8f8p-1f,
+    0x1.e4adaap-1f,
+    0x1.e4b25ap-1f,
+    0x1.e4b70cp-1f,
+    0x1.e4bbbap-1f,
+    0x1.e4c06ap-1f,
+    0x1.e4c516p-1f,
+    0x1.e4c9c2p-1f,
+    0x1.e4ce7p-1f,
+    0x1.e4d31ap-1f,
+    0x1.e4d7c6p-1f,
+    0x1.e4dc7p-1f,
+    0x1.e4e118p-1f,
+    0x1.e4e5cp-1f,
+    0x1.e4ea68p-1f,
+    0x1.e4ef1p-1f,
+    0x1.e4f3b6p-1f,
+    0x1.e4f85ap-1f,
+    0x1.e4fcfep-1f,
+    0x1.e501a2p-1f,
+    0x1.e50644p-1f,
+    0x1.e50ae8p-1f,
+    0x1.e50f8ap-1f,
+    0x1.e51428p-1f,
+    0x1.e518cap-1f,
+    0x1.e51d68p-1f,
+    0x1.e52208p-1f,
+    0x1.e526a4p-1f,
+    0x1.e52b42p-1f,
+    0x1.e52fdep-1f,
+    0x1.e53478p-1f,
+    0x1.e53914p-1f,
+    0x1.e53daep-1f,
+    0x1.e54246p-1f,
+    0x1.e546dep-1f,
+    0x1.e54b76p-1f,
+    0x1.e5500ep-1f,
+    0x1.e554a2p-1f,
+    0x1.e5593ap-1f,
+    0x1.e55dcep-1f,
+    0x1.e56262p-1f,
+    0x1.e566f6p-1f,
+    0x1.e56b88p-1f,
+    0x1.e57018p-1f,
+    0x1.e574aap-1f,
+    0x1.e5793ap-1f,
+    0x1.e57dc8p-1f,
+    0x1.e58258p-1f,
+    0x1.e586e6p-1f,
+    0x1.e58b72p-1f,
+    0x1.e59p-1f,
+    0x1.e5948cp-1f,
+    0x1.e59916p-1f,
+    0x1.e59dap-1f,
+    0x1.e5a22ap-1f,
+    0x1.e5a6b2p-1f,
+    0x1.e5ab3ap-1f,
+    0x1.e5afc2p-1f,
+    0x1.e5b448p-1f,
+    0x1.e5b8cep-1f,
+    0x1.e5bd52p-1f,
+    0x1.e5c1d8p-1f,
+    0x1.e5c65cp-1f,
+    0x1.e5cadep-1f,
+    0x1.e5cf6p-1f,
+    0x1.e5d3e2p-1f,
+    0x1.e5d864p-1f,
+    0x1.e5dce2p-1f,
+    0x1.e5e162p-1f,
+    0x1.e5e5ep-1f,
+    0x1.e5ea6p-1f,
+    0x1.e5eedcp-1f,
+    0x1.e5f358p-1f,
+    0x1.e5f7d4p-1f,
+    0x1.e5fc5p-1f,
+    0x1.e600c8p-1f,
+    0x1.e60542p-1f,
+    0x1.e609bcp-1f,
+    0x1.e60e32p-1f,
+    0x1.e612aap-1f,
+    0x1.e61722p-1f,
+    0x1.e61b96p-1f,
+    0x1.e6200cp-1f,
+    0x1.e6248p-1f,
+    0x1.e628f4p-1f,
+    0x1.e62d68p-1f,
+    0x1.e631dcp-1f,
+    0x1.e6364cp-1f,
+    0x1.e63abcp-1f,
+    0x1.e63f2ep-1f,
+    0x1.e6439cp-1f,
+    0x1.e6480ap-1f,
+    0x1.e64c78p-1f,
+    0x1.e650e8p-1f,
+    0x1.e65554p-1f,
+    0x1.e659bep-1f,
+    0x1.e65e2cp-1f,
+    0x1.e66296p-1f,
+    0x1.e667p-1f,
+    0x1.e66b68p-1f,
+    0x1.e66fd2p-1f,
+    0x1.e67438p-1f,
+    0x1.e678ap-1f,
+    0x1.e67d06p-1f,
+    0x1.e6816cp-1f,
+    0x1.e685dp-1f,
+    0x1.e68a36p-1f,
+    0x1.e68e98p-1f,
+    0x1.e692fcp-1f,
+    0x1.e6975ep-1f,
+    0x1.e69bcp-1f,
+    0x1.e6a02p-1f,
+    0x1.e6a48p-1f,
+    0x1.e6a8ep-1f,
+    0x1.e6ad3ep-1f,
+    0x1.e6b19cp-1f,
+    0x1.e6b5fap-1f,
+    0x1.e6ba56p-1f,
+    0x1.e6beb2p-1f,
+    0x1.e6c30ep-1f,
+    0x1.e6c768p-1f,
+    0x1.e6cbc2p-1f,
+    0x1.e6d01cp-1f,
+    0x1.e6d474p-1f,
+    0x1.e6d8ccp-1f,
+    0x1.e6dd22p-1f,
+    0x1.e6e17ap-1f,
+    0x1.e6e5cep-1f,
+    0x1.e6ea24p-1f,
+    0x1.e6ee78p-1f,
+    0x1.e6f2ccp-1f,
+    0x1.e6f72p-1f,
+    0x1.e6fb72p-1f,
+    0x1.e6ffc4p-1f,
+    0x1.e70414p-1f,
+    0x1.e70866p-1f,
+    0x1.e70cb4p-1f,
+    0x1.e71104p-1f,
+    0x1.e71552p-1f,
+    0x1.e719ap-1f,
+    0x1.e71decp-1f,
+    0x1.e72238p-1f,
+    0x1.e72684p-1f,
+    0x1.e72adp-1f,
+    0x1.e72f18p-1f,
+    0x1.e73364p-1f,
+    0x1.e737acp-1f,
+    0x1.e73bf4p-1f,
+    0x1.e7403cp-1f,
+    0x1.e74484p-1f,
+    0x1.e748c8p-1f,
+    0x1.e74d1p-1f,
+    0x1.e75154p-1f,
+    0x1.e75598p-1f,
+    0x1.e759dcp-1f,
+    0x1.e75e1ep-1f,
+    0x1.e7626p-1f,
+    0x1.e766a2p-1f,
+    0x1.e76ae4p-1f,
+    0x1.e76f24p-1f,
+    0x1.e77362p-1f,
+    0x1.e777a2p-1f,
+    0x1.e77bep-1f,
+    0x1.e7801ep-1f,
+    0x1.e7845ap-1f,
+    0x1.e78898p-1f,
+    0x1.e78cd2p-1f,
+    0x1.e7910ep-1f,
+    0x1.e79548p-1f,
+    0x1.e79982p-1f,
+    0x1.e79dbcp-1f,
+    0x1.e7a1f4p-1f,
+    0x1.e7a62ap-1f,
+    0x1.e7aa62p-1f,
+    0x1.e7ae98p-1f,
+    0x1.e7b2cep-1f,
+    0x1.e7b704p-1f,
+    0x1.e7bb38p-1f,
+    0x1.e7bf6cp-1f,
+    0x1.e7c39ep-1f,
+    0x1.e7c7d2p-1f,
+    0x1.e7cc04p-1f,
+    0x1.e7d034p-1f,
+    0x1.e7d464p-1f,
+    0x1.e7d896p-1f,
+    0x1.e7dcc4p-1f,
+    0x1.e7e0f4p-1f,
+    0x1.e7e52p-1f,
+    0x1.e7e94ep-1f,
+    0x1.e7ed7ap-1f,
+    0x1.e7f1a6p-1f,
+    0x1.e7f5d2p-1f,
+    0x1.e7f9fcp-1f,
+    0x1.e7fe28p-1f,
+    0x1.e8025p-1f,
+    0x1.e8067ap-1f,
+    0x1.e80aa2p-1f,
+    0x1.e80ec8p-1f,
+    0x1.e812fp-1f,
+    0x1.e81716p-1f,
+    0x1.e81b3cp-1f,
+    0x1.e81f62p-1f,
+    0x1.e82384p-1f,
+    0x1.e827aap-1f,
+    0x1.e82bccp-1f,
+    0x1.e82feep-1f,
+    0x1.e8341p-1f,
+    0x1.e83832p-1f,
+    0x1.e83c52p-1f,
+    0x1.e84072p-1f,
+    0x1.e84492p-1f,
+    0x1.e848bp-1f,
+    0x1.e84ccep-1f,
+    0x1.e850ecp-1f,
+    0x1.e85508p-1f,
+    0x1.e85924p-1f,
+    0x1.e85d4p-1f,
+    0x1.e8615cp-1f,
+    0x1.e86576p-1f,
+    0x1.e8699p-1f,
+    0x1.e86da8p-1f,
+    0x1.e871cp-1f,
+    0x1.e875d8p-1f,
+    0x1.e879fp-1f,
+    0x1.e87e06p-1f,
+    0x1.e8821cp-1f,
+    0x1.e88632p-1f,
+    0x1.e88a46p-1f,
+    0x1.e88e5ap-1f,
+    0x1.e8926ep-1f,
+    0x1.e8968p-1f,
+    0x1.e89a92p-1f,
+    0x1.e89ea4p-1f,
+    0x1.e8a2b6p-1f,
+    0x1.e8a6c6p-1f,
+    0x1.e8aad4p-1f,
+    0x1.e8aee4p-1f,
+    0x1.e8b2f2p-1f,
+    0x1.e8b7p-1f,
+    0x1.e8bb0ep-1f,
+    0x1.e8bf1ap-1f,
+    0x1.e8c326p-1f,
+    0x1.e8c732p-1f,
+    0x1.e8cb3cp-1f,
+    0x1.e8cf46p-1f,
+    0x1.e8d35p-1f,
+    0x1.e8d75ap-1f,
+    0x1.e8db62p-1f,
+    0x1.e8df6ap-1f,
+    0x1.e8e37p-1f,
+    0x1.e8e778p-1f,
+    0x1.e8eb7ep-1f,
+    0x1.e8ef82p-1f,
+    0x1.e8f388p-1f,
+    0x1.e8f78ap-1f,
+    0x1.e8fb8ep-1f,
+    0x1.e8ff92p-1f,
+    0x1.e90394p-1f,
+    0x1.e90796p-1f,
+    0x1.e90b98p-1f,
+    0x1.e90f96p-1f,
+    0x1.e91398p-1f,
+    0x1.e91796p-1f,
+    0x1.e91b94p-1f,
+    0x1.e91f92p-1f,
+    0x1.e9239p-1f,
+    0x1.e9278cp-1f,
+    0x1.e92b8ap-1f,
+    0x1.e92f84p-1f,
+    0x1.e9338p-1f,
+    0x1.e9377ap-1f,
+    0x1.e93b74p-1f,
+    0x1.e93f6ep-1f,
+    0x1.e94366p-1f,
+    0x1.e9475ep-1f,
+    0x1.e94b56p-1f,
+    0x1.e94f4ep-1f,
+    0x1.e95344p-1f,
+    0x1.e95738p-1f,
+    0x1.e95b2ep-1f,
+    0x1.e95f22p-1f,
+    0x1.e96318p-1f,
+    0x1.e9670ap-1f,
+    0x1.e96afcp-1f,
+    0x1.e96eeep-1f,
+    0x1.e972ep-1f,
+    0x1.e976d2p-1f,
+    0x1.e97acp-1f,
+    0x1.e97eb2p-1f,
+    0x1.e982ap-1f,
+    0x1.e9869p-1f,
+    0x1.e98a7ep-1f,
+    0x1.e98e6cp-1f,
+    0x1.e99258p-1f,
+    0x1.e99644p-1f,
+    0x1.e99a3p-1f,
+    0x1.e99e1ap-1f,
+    0x1.e9a206p-1f,
+    0x1.e9a5fp-1f,
+    0x1.e9a9d8p-1f,
+    0x1.e9adc2p-1f,
+    0x1.e9b1aap-1f,
+    0x1.e9b592p-1f,
+    0x1.e9b978p-1f,
+    0x1.e9bd6p-1f,
+    0x1.e9c144p-1f,
+    0x1.e9c52ap-1f,
+    0x1.e9c90ep-1f,
+    0x1.e9ccf4p-1f,
+    0x1.e9d0d6p-1f,
+    0x1.e9d4bap-1f,
+    0x1.e9d89cp-1f,
+    0x1.e9dc7ep-1f,
+    0x1.e9e05ep-1f,
+    0x1.e9e44p-1f,
+    0x1.e9e82p-1f,
+    0x1.e9ecp-1f,
+    0x1.e9efdep-1f,
+    0x1.e9f3bcp-1f,
+    0x1.e9f79ap-1f,
+    0x1.e9fb78p-1f,
+    0x1.e9ff54p-1f,
+    0x1.ea033p-1f,
+    0x1.ea070cp-1f,
+    0x1.ea0ae8p-1f,
+    0x1.ea0ec2p-1f,
+    0x1.ea129cp-1f,
+    0x1.ea1674p-1f,
+    0x1.ea1a4cp-1f,
+    0x1.ea1e24p-1f,
+    0x1.ea21fcp-1f,
+    0x1.ea25d4p-1f,
+    0x1.ea29aap-1f,
+    0x1.ea2d8p-1f,
+    0x1.ea3156p-1f,
+    0x1.ea352ap-1f,
+    0x1.ea38fep-1f,
+    0x1.ea3cd2p-1f,
+    0x1.ea40a4p-1f,
+    0x1.ea4478p-1f,
+    0x1.ea484ap-1f,
+    0x1.ea4c1cp-1f,
+    0x1.ea4fecp-1f,
+    0x1.ea53bcp-1f,
+    0x1.ea578cp-1f,
+    0x1.ea5b5ap-1f,
+    0x1.ea5f2ap-1f,
+    0x1.ea62f6p-1f,
+    0x1.ea66c4p-1f,
+    0x1.ea6a92p-1f,
+    0x1.ea6e5ep-1f,
+    0x1.ea722ap-1f,
+    0x1.ea75f4p-1f,
+    0x1.ea79cp-1f,
+    0x1.ea7d8ap-1f,
+    0x1.ea8152p-1f,
+    0x1.ea851cp-1f,
+    0x1.ea88e4p-1f,
+    0x1.ea8cacp-1f,
+    0x1.ea9074p-1f,
+    0x1.ea943ap-1f,
+    0x1.ea98p-1f,
+    0x1.ea9bc6p-1f,
+    0x1.ea9f8cp-1f,
+    0x1.eaa35p-1f,
+    0x1.eaa714p-1f,
+    0x1.eaaad6p-1f,
+    0x1.eaae9ap-1f,
+    0x1.eab25cp-1f,
+    0x1.eab61ep-1f,
+    0x1.eab9ep-1f,
+    0x1.eabdap-1f,
+    0x1.eac16p-1f,
+    0x1.eac52p-1f,
+    0x1.eac8dep-1f,
+    0x1.eacc9ep-1f,
+    0x1.ead05cp-1f,
+    0x1.ead418p-1f,
+    0x1.ead7d6p-1f,
+    0x1.eadb92p-1f,
+    0x1.eadf4ep-1f,
+    0x1.eae30ap-1f,
+    0x1.eae6c4p-1f,
+    0x1.eaea7ep-1f,
+    0x1.eaee38p-1f,
+    0x1.eaf1fp-1f,
+    0x1.eaf5aap-1f,
+    0x1.eaf96p-1f,
+    0x1.eafd18p-1f,
+    0x1.eb00dp-1f,
+    0x1.eb0486p-1f,
+    0x1.eb083cp-1f,
+    0x1.eb0bfp-1f,
+    0x1.eb0fa6p-1f,
+    0x1.eb135ap-1f,
+    0x1.eb170ep-1f,
+    0x1.eb1ac2p-1f,
+    0x1.eb1e74p-1f,
+    0x1.eb2226p-1f,
+    0x1.eb25d8p-1f,
+    0x1.eb2988p-1f,
+    0x1.eb2d38p-1f,
+    0x1.eb30e8p-1f,
+    0x1.eb3498p-1f,
+    0x1.eb3848p-1f,
+    0x1.eb3bf6p-1f,
+    0x1.eb3fa4p-1f,
+    0x1.eb435p-1f,
+    0x1.eb46fcp-1f,
+    0x1.eb4aaap-1f,
+    0x1.eb4e56p-1f,
+    0x1.eb52p-1f,
+    0x1.eb55aap-1f,
+    0x1.eb5956p-1f,
+    0x1.eb5cfep-1f,
+    0x1.eb60a8p-1f,
+    0x1.eb645p-1f,
+    0x1.eb67f8p-1f,
+    0x1.eb6bap-1f,
+    0x1.eb6f46p-1f,
+    0x1.eb72eep-1f,
+    0x1.eb7694p-1f,
+    0x1.eb7a38p-1f,
+    0x1.eb7ddcp-1f,
+    0x1.eb8182p-1f,
+    0x1.eb8526p-1f,
+    0x1.eb88c8p-1f,
+    0x1.eb8c6ap-1f,
+    0x1.eb900ep-1f,
+    0x1.eb93aep-1f,
+    0x1.eb975p-1f,
+    0x1.eb9af2p-1f,
+    0x1.eb9e9p-1f,
+    0x1.eba23p-1f,
+    0x1.eba5dp-1f,
+    0x1.eba96ep-1f,
+    0x1.ebad0cp-1f,
+    0x1.ebb0aap-1f,
+    0x1.ebb446p-1f,
+    0x1.ebb7e4p-1f,
+    0x1.ebbb7ep-1f,
+    0x1.ebbf1ap-1f,
+    0x1.ebc2b6p-1f,
+    0x1.ebc65p-1f,
+    0x1.ebc9eap-1f,
+    0x1.ebcd82p-1f,
+    0x1.ebd11cp-1f,
+    0x1.ebd4b4p-1f,
+    0x1.ebd84cp-1f,
+    0x1.ebdbe4p-1f,
+    0x1.ebdf7ap-1f,
+    0x1.ebe31p-1f,
+    0x1.ebe6a6p-1f,
+    0x1.ebea3cp-1f,
+    0x1.ebeddp-1f,
+    0x1.ebf164p-1f,
+    0x1.ebf4f8p-1f,
+    0x1.ebf88cp-1f,
+    0x1.ebfc1ep-1f,
+    0x1.ebffbp-1f,
+    0x1.ec0342p-1f,
+    0x1.ec06d4p-1f,
+    0x1.ec0a64p-1f,
+    0x1.ec0df4p-1f,
+    0x1.ec1184p-1f,
+    0x1.ec1512p-1f,
+    0x1.ec18a2p-1f,
+    0x1.ec1c3p-1f,
+    0x1.ec1fbcp-1f,
+    0x1.ec234ap-1f,
+    0x1.ec26d8p-1f,
+    0x1.ec2a64p-1f,
+    0x1.ec2deep-1f,
+    0x1.ec317ap-1f,
+    0x1.ec3504p-1f,
+    0x1.ec388ep-1f,
+    0x1.ec3c18p-1f,
+    0x1.ec3fap-1f,
+    0x1.ec432ap-1f,
+    0x1.ec46b2p-1f,
+    0x1.ec4a3ap-1f,
+    0x1.ec4dcp-1f,
+    0x1.ec5146p-1f,
+    0x1.ec54cep-1f,
+    0x1.ec5852p-1f,
+    0x1.ec5bd8p-1f,
+    0x1.ec5f5cp-1f,
+    0x1.ec62ep-1f,
+    0x1.ec6664p-1f,
+    0x1.ec69e8p-1f,
+    0x1.ec6d6ap-1f,
+    0x1.ec70ecp-1f,
+    0x1.ec746ep-1f,
+    0x1.ec77eep-1f,
+    0x1.ec7b7p-1f,
+    0x1.ec7efp-1f,
+    0x1.ec826ep-1f,
+    0x1.ec85eep-1f,
+    0x1.ec896cp-1f,
+    0x1.ec8cecp-1f,
+    0x1.ec9068p-1f,
+    0x1.ec93e4p-1f,
+    0x1.ec9762p-1f,
+    0x1.ec9adep-1f,
+    0x1.ec9e5ap-1f,
+    0x1.eca1d4p-1f,
+    0x1.eca55p-1f,
+    0x1.eca8cap-1f,
+    0x1.ecac44p-1f,
+    0x1.ecafbcp-1f,
+    0x1.ecb334p-1f,
+    0x1.ecb6aep-1f,
+    0x1.ecba24p-1f,
+    0x1.ecbd9cp-1f,
+    0x1.ecc112p-1f,
+    0x1.ecc48ap-1f,
+    0x1.ecc8p-1f,
+    0x1.eccb74p-1f,
+    0x1.eccee8p-1f,
+    0x1.ecd25ep-1f,
+    0x1.ecd5dp-1f,
+    0x1.ecd944p-1f,
+    0x1.ecdcb8p-1f,
+    0x1.ece02ap-1f,
+    0x1.ece39cp-1f,
+    0x1.ece70cp-1f,
+    0x1.ecea7ep-1f,
+    0x1.ecedeep-1f,
+    0x1.ecf15ep-1f,
+    0x1.ecf4cep-1f,
+    0x1.ecf83cp-1f,
+    0x1.ecfbaap-1f,
+    0x1.ecff18p-1f,
+    0x1.ed0286p-1f,
+    0x1.ed05f4p-1f,
+    0x1.ed096p-1f,
+    0x1.ed0cccp-1f,
+    0x1.ed1036p-1f,
+    0x1.ed13a2p-1f,
+    0x1.ed170ep-1f,
+    0x1.ed1a76p-1f,
+    0x1.ed1dep-1f,
+    0x1.ed214ap-1f,
+    0x1.ed24b2p-1f,
+    0x1.ed281ap-1f,
+    0x1.ed2b82p-1f,
+    0x1.ed2eeap-1f,
+    0x1.ed325p-1f,
+    0x1.ed35b8p-1f,
+    0x1.ed391cp-1f,
+    0x1.ed3c82p-1f,
+    0x1.ed3fe8p-1f,
+    0x1.ed434cp-1f,
+    0x1.ed46bp-1f,
+    0x1.ed4a12p-1f,
+    0x1.ed4d76p-1f,
+    0x1.ed50d8p-1f,
+    0x1.ed543ap-1f,
+    0x1.ed579cp-1f,
+    0x1.ed5afcp-1f,
+    0x1.ed5e5ep-1f,
+    0x1.ed61bep-1f,
+    0x1.ed651ep-1f,
+    0x1.ed687cp-1f,
+    0x1.ed6bdcp-1f,
+    0x1.ed6f3ap-1f,
+    0x1.ed7298p-1f,
+    0x1.ed75f4p-1f,
+    0x1.ed7952p-1f,
+    0x1.ed7caep-1f,
+    0x1.ed800ap-1f,
+    0x1.ed8366p-1f,
+    0x1.ed86cp-1f,
+    0x1.ed8a1ap-1f,
+    0x1.ed8d74p-1f,
+    0x1.ed90cep-1f,
+    0x1.ed9428p-1f,
+    0x1.ed978p-1f,
+    0x1.ed9ad8p-1f,
+    0x1.ed9e3p-1f,
+    0x1.eda188p-1f,
+    0x1.eda4dep-1f,
+    0x1.eda834p-1f,
+    0x1.edab8ap-1f,
+    0x1.edaeep-1f,
+    0x1.edb234p-1f,
+    0x1.edb588p-1f,
+    0x1.edb8dcp-1f,
+    0x1.edbc3p-1f,
+    0x1.edbf82p-1f,
+    0x1.edc2d6p-1f,
+    0x1.edc628p-1f,
+    0x1.edc97ap-1f,
+    0x1.edcccap-1f,
+    0x1.edd01cp-1f,
+    0x1.edd36cp-1f,
+    0x1.edd6bcp-1f,
+    0x1.edda0cp-1f,
+    0x1.eddd5ap-1f,
+    0x1.ede0a8p-1f,
+    0x1.ede3f6p-1f,
+    0x1.ede744p-1f,
+    0x1.edea9p-1f,
+    0x1.ededdcp-1f,
+    0x1.edf128p-1f,
+    0x1.edf474p-1f,
+    0x1.edf7cp-1f,
+    0x1.edfb0cp-1f,
+    0x1.edfe56p-1f,
+    0x1.ee01ap-1f,
+    0x1.ee04e8p-1f,
+    0x1.ee0832p-1f,
+    0x1.ee0b7ap-1f,
+    0x1.ee0ec2p-1f,
+    0x1.ee120ap-1f,
+    0x1.ee155p-1f,
+    0x1.ee1898p-1f,
+    0x1.ee1bdep-1f,
+    0x1.ee1f24p-1f,
+    0x1.ee2268p-1f,
+    0x1.ee25aep-1f,
+    0x1.ee28f2p-1f,
+    0x1.ee2c36p-1f,
+    0x1.ee2f7ap-1f,
+    0x1.ee32bcp-1f,
+    0x1.ee35fep-1f,
+    0x1.ee3942p-1f,
+    0x1.ee3c82p-1f,
+    0x1.ee3fc4p-1f,
+    0x1.ee4306p-1f,
+    0x1.ee4644p-1f,
+    0x1.ee4986p-1f,
+    0x1.ee4cc4p-1f,
+    0x1.ee5004p-1f,
+    0x1.ee5342p-1f,
+    0x1.ee568p-1f,
+    0x1.ee59bep-1f,
+    0x1.ee5cfap-1f,
+    0x1.ee6038p-1f,
+    0x1.ee6374p-1f,
+    0x1.ee66bp-1f,
+    0x1.ee69ecp-1f,
+    0x1.ee6d26p-1f,
+    0x1.ee706p-1f,
+    0x1.ee739ap-1f,
+    0x1.ee76d4p-1f,
+    0x1.ee7a0ep-1f,
+    0x1.ee7d46p-1f,
+    0x1.ee807ep-1f,
+    0x1.ee83b6p-1f,
+    0x1.ee86eep-1f,
+    0x1.ee8a24p-1f,
+    0x1.ee8d5cp-1f,
+    0x1.ee9092p-1f,
+    0x1.ee93c6p-1f,
+    0x1.ee96fcp-1f,
+    0x1.ee9a32p-1f,
+    0x1.ee9d64p-1f,
+    0x1.eea098p-1f,
+    0x1.eea3ccp-1f,
+    0x1.eea7p-1f,
+    0x1.eeaa32p-1f,
+    0x1.eead64p-1f,
+    0x1.eeb096p-1f,
+    0x1.eeb3c6p-1f,
+    0x1.eeb6f8p-1f,
+    0x1.eeba28p-1f,
+    0x1.eebd58p-1f,
+    0x1.eec088p-1f,
+    0x1.eec3b6p-1f,
+    0x1.eec6e4p-1f,
+    0x1.eeca14p-1f,
+    0x1.eecd42p-1f,
+    0x1.eed06ep-1f,
+    0x1.eed39cp-1f,
+    0x1.eed6c8p-1f,
+    0x1.eed9f4p-1f,
+    0x1.eedd1ep-1f,
+    0x1.eee04ap-1f,
+    0x1.eee374p-1f,
+    0x1.eee6ap-1f,
+    0x1.eee9cap-1f,
+    0x1.eeecf2p-1f,
+    0x1.eef01ap-1f,
+    0x1.eef344p-1f,
+    0x1.eef66cp-1f,
+    0x1.eef992p-1f,
+    0x1.eefcbap-1f,
+    0x1.eeffe2p-1f,
+    0x1.ef0308p-1f,
+    0x1.ef062ep-1f,
+    0x1.ef0952p-1f,
+    0x1.ef0c78p-1f,
+    0x1.ef0f9cp-1f,
+    0x1.ef12cp-1f,
+    0x1.ef15e4p-1f,
+    0x1.ef1908p-1f,
+    0x1.ef1c2ap-1f,
+    0x1.ef1f4cp-1f,
+    0x1.ef226ep-1f,
+    0x1.ef259p-1f,
+    0x1.ef28b2p-1f,
+    0x1.ef2bd2p-1f,
+    0x1.ef2ef2p-1f,
+    0x1.ef3212p-1f,
+    0x1.ef3532p-1f,
+    0x1.ef3852p-1f,
+    0x1.ef3b7p-1f,
+    0x1.ef3e8ep-1f,
+    0x1.ef41acp-1f,
+    0x1.ef44cap-1f,
+    0x1.ef47e6p-1f,
+    0x1.ef4b02p-1f,
+    0x1.ef4e1ep-1f,
+    0x1.ef513ap-1f,
+    0x1.ef5454p-1f,
+    0x1.ef577p-1f,
+    0x1.ef5a8ap-1f,
+    0x1.ef5da4p-1f,
+    0x1.ef60bep-1f,
+    0x1.ef63d8p-1f,
+    0x1.ef66fp-1f,
+    0x1.ef6a06p-1f,
+    0x1.ef6d2p-1f,
+    0x1.ef7036p-1f,
+    0x1.ef734ep-1f,
+    0x1.ef7664p-1f,
+    0x1.ef797ap-1f,
+    0x1.ef7c9p-1f,
+    0x1.ef7fa4p-1f,
+    0x1.ef82bap-1f,
+    0x1.ef85cep-1f,
+    0x1.ef88e2p-1f,
+    0x1.ef8bf6p-1f,
+    0x1.ef8f0ap-1f,
+    0x1.ef921cp-1f,
+    0x1.ef952ep-1f,
+    0x1.ef984p-1f,
+    0x1.ef9b52p-1f,
+    0x1.ef9e62p-1f,
+    0x1.efa174p-1f,
+    0x1.efa484p-1f,
+    0x1.efa792p-1f,
+    0x1.efaaa2p-1f,
+    0x1.efadb2p-1f,
+    0x1.efb0cp-1f,
+    0x1.efb3cep-1f,
+    0x1.efb6dcp-1f,
+    0x1.efb9eap-1f,
+    0x1.efbcf6p-1f,
+    0x1.efc002p-1f,
+    0x1.efc30ep-1f,
+    0x1.efc61ap-1f,
+    0x1.efc926p-1f,
+    0x1.efcc3p-1f,
+    0x1.efcf3cp-1f,
+    0x1.efd244p-1f,
+    0x1.efd54ep-1f,
+    0x1.efd858p-1f,
+    0x1.efdb6p-1f,
+    0x1.efde68p-1f,
+    0x1.efe17p-1f,
+    0x1.efe478p-1f,
+    0x1.efe78p-1f,
+    0x1.efea86p-1f,
+    0x1.efed8cp-1f,
+    0x1.eff092p-1f,
+    0x1.eff398p-1f,
+    0x1.eff69cp-1f,
+    0x1.eff9a2p-1f,
+    0x1.effca6p-1f,
+    0x1.efffaap-1f,
+    0x1.f002acp-1f,
+    0x1.f005bp-1f,
+    0x1.f008b2p-1f,
+    0x1.f00bb4p-1f,
+    0x1.f00eb6p-1f,
+    0x1.f011b8p-1f,
+    0x1.f014b8p-1f,
+    0x1.f017b8p-1f,
+    0x1.f01abap-1f,
+    0x1.f01db8p-1f,
+    0x1.f020b8p-1f,
+    0x1.f023b8p-1f,
+    0x1.f026b6p-1f,
+    0x1.f029b4p-1f,
+    0x1.f02cb2p-1f,
+    0x1.f02faep-1f,
+    0x1.f032acp-1f,
+    0x1.f035a8p-1f,
+    0x1.f038a4p-1f,
+    0x1.f03bap-1f,
+    0x1.f03e9cp-1f,
+    0x1.f04196p-1f,
+    0x1.f0449p-1f,
+    0x1.f0478ap-1f,
+    0x1.f04a84p-1f,
+    0x1.f04d7cp-1f,
+    0x1.f05076p-1f,
+    0x1.f0536ep-1f,
+    0x1.f05666p-1f,
+    0x1.f0595ep-1f,
+    0x1.f05c56p-1f,
+    0x1.f05f4cp-1f,
+    0x1.f06242p-1f,
+    0x1.f06538p-1f,
+    0x1.f0682ep-1f,
+    0x1.f06b24p-1f,
+    0x1.f06e18p-1f,
+    0x1.f0710cp-1f,
+    0x1.f074p-1f,
+    0x1.f076f4p-1f,
+    0x1.f079e8p-1f,
+    0x1.f07cdap-1f,
+    0x1.f07fccp-1f,
+    0x1.f082bep-1f,
+    0x1.f085bp-1f,
+    0x1.f088a2p-1f,
+    0x1.f08b92p-1f,
+    0x1.f08e82p-1f,
+    0x1.f09172p-1f,
+    0x1.f09462p-1f,
+    0x1.f09752p-1f,
+    0x1.f09a4p-1f,
+    0x1.f09d3p-1f,
+    0x1.f0a01ep-1f,
+    0x1.f0a30ap-1f,
+    0x1.f0a5f8p-1f,
+    0x1.f0a8e4p-1f,
+    0x1.f0abd2p-1f,
+    0x1.f0aebep-1f,
+    0x1.f0b1aap-1f,
+    0x1.f0b494p-1f,
+    0x1.f0b78p-1f,
+    0x1.f0ba6ap-1f,
+    0x1.f0bd54p-1f,
+    0x1.f0c03ep-1f,
+    0x1.f0c326p-1f,
+    0x1.f0c61p-1f,
+    0x1.f0c8f8p-1f,
+    0x1.f0cbep-1f,
+    0x1.f0cec8p-1f,
+    0x1.f0d1bp-1f,
+    0x1.f0d496p-1f,
+    0x1.f0d77cp-1f,
+    0x1.f0da62p-1f,
+    0x1.f0dd48p-1f,
+    0x1.f0e02ep-1f,
+    0x1.f0e314p-1f,
+    0x1.f0e5f8p-1f,
+    0x1.f0e8dcp-1f,
+    0x1.f0ebcp-1f,
+    0x1.f0eea2p-1f,
+    0x1.f0f186p-1f,
+    0x1.f0f468p-1f,
+    0x1.f0f74ap-1f,
+    0x1.f0fa2ep-1f,
+    0x1.f0fd0ep-1f,
+    0x1.f0fffp-1f,
+    0x1.f102dp-1f,
+    0x1.f105bp-1f,
+    0x1.f1089p-1f,
+    0x1.f10b7p-1f,
+    0x1.f10e5p-1f,
+    0x1.f1112ep-1f,
+    0x1.f1140cp-1f,
+    0x1.f116eap-1f,
+    0x1.f119c8p-1f,
+    0x1.f11ca4p-1f,
+    0x1.f11f82p-1f,
+    0x1.f1225ep-1f,
+    0x1.f1253ap-1f,
+    0x1.f12816p-1f,
+    0x1.f12af2p-1f,
+    0x1.f12dccp-1f,
+    0x1.f130a6p-1f,
+    0x1.f1338p-1f,
+    0x1.f1365ap-1f,
+    0x1.f13934p-1f,
+    0x1.f13c0cp-1f,
+    0x1.f13ee4p-1f,
+    0x1.f141bep-1f,
+    0x1.f14494p-1f,
+    0x1.f1476cp-1f,
+    0x1.f14a44p-1f,
+    0x1.f14d1ap-1f,
+    0x1.f14ffp-1f,
+    0x1.f152c6p-1f,
+    0x1.f1559cp-1f,
+    0x1.f1587p-1f,
+    0x1.f15b46p-1f,
+    0x1.f15e1ap-1f,
+    0x1.f160eep-1f,
+    0x1.f163c2p-1f,
+    0x1.f16694p-1f,
+    0x1.f16968p-1f,
+    0x1.f16c3ap-1f,
+    0x1.f16f0cp-1f,
+    0x1.f171dep-1f,
+    0x1.f174bp-1f,
+    0x1.f1778p-1f,
+    0x1.f17a52p-1f,
+    0x1.f17d2p-1f,
+    0x1.f17ffp-1f,
+    0x1.f182cp-1f,
+    0x1.f1858ep-1f,
+    0x1.f1885ep-1f,
+    0x1.f18b2cp-1f,
+    0x1.f18dfap-1f,
+    0x1.f190c8p-1f,
+    0x1.f19394p-1f,
+    0x1.f19662p-1f,
+    0x1.f1992ep-1f,
+    0x1.f19bfap-1f,
+    0x1.f19ec6p-1f,
+    0x1.f1a19p-1f,
+    0x1.f1a45cp-1f,
+    0x1.f1a726p-1f,
+    0x1.f1a9fp-1f,
+    0x1.f1acbap-1f,
+    0x1.f1af84p-1f,
+    0x1.f1b24cp-1f,
+    0x1.f1b514p-1f,
+    0x1.f1b7dep-1f,
+    0x1.f1baa4p-1f,
+    0x1.f1bd6cp-1f,
+    0x1.f1c034p-1f,
+    0x1.f1c2fap-1f,
+    0x1.f1c5cp-1f,
+    0x1.f1c886p-1f,
+    0x1.f1cb4cp-1f,
+    0x1.f1ce12p-1f,
+    0x1.f1d0d6p-1f,
+    0x1.f1d39cp-1f,
+    0x1.f1d66p-1f,
+    0x1.f1d922p-1f,
+    0x1.f1dbe6p-1f,
+    0x1.f1deaap-1f,
+    0x1.f1e16cp-1f,
+    0x1.f1e42ep-1f,
+    0x1.f1e6fp-1f,
+    0x1.f1e9b2p-1f,
+    0x1.f1ec72p-1f,
+    0x1.f1ef34p-1f,
+    0x1.f1f1f4p-1f,
+    0x1.f1f4b4p-1f,
+    0x1.f1f774p-1f,
+    0x1.f1fa34p-1f,
+    0x1.f1fcf2p-1f,
+    0x1.f1ffbp-1f,
+    0x1.f2026ep-1f,
+    0x1.f2052ep-1f,
+    0x1.f207eap-1f,
+    0x1.f20aa8p-1f,
+    0x1.f20d64p-1f,
+    0x1.f2102p-1f,
+    0x1.f212dcp-1f,
+    0x1.f21598p-1f,
+    0x1.f21854p-1f,
+    0x1.f21b0ep-1f,
+    0x1.f21dc8p-1f,
+    0x1.f22084p-1f,
+    0x1.f2233cp-1f,
+    0x1.f225f6p-1f,
+    0x1.f228bp-1f,
+    0x1.f22b68p-1f,
+    0x1.f22e2p-1f,
+    0x1.f230d8p-1f,
+    0x1.f2339p-1f,
+    0x1.f23648p-1f,
+    0x1.f238fep-1f,
+    0x1.f23bb4p-1f,
+    0x1.f23e6ap-1f,
+    0x1.f2412p-1f,
+    0x1.f243d6p-1f,
+    0x1.f2468ap-1f,
+    0x1.f2494p-1f,
+    0x1.f24bf4p-1f,
+    0x1.f24ea8p-1f,
+    0x1.f2515cp-1f,
+    0x1.f2540ep-1f,
+    0x1.f256c2p-1f,
+    0x1.f25974p-1f,
+    0x1.f25c26p-1f,
+    0x1.f25ed8p-1f,
+    0x1.f26188p-1f,
+    0x1.f2643ap-1f,
+    0x1.f266eap-1f,
+    0x1.f2699cp-1f,
+    0x1.f26c4ap-1f,
+    0x1.f26efap-1f,
+    0x1.f271aap-1f,
+    0x1.f27458p-1f,
+    0x1.f27708p-1f,
+    0x1.f279b6p-1f,
+    0x1.f27c62p-1f,
+    0x1.f27f1p-1f,
+    0x1.f281bep-1f,
+    0x1.f2846ap-1f,
+    0x1.f28716p-1f,
+    0x1.f289c2p-1f,
+    0x1.f28c6ep-1f,
+    0x1.f28f1ap-1f,
+    0x1.f291c4p-1f,
+    0x1.f2946ep-1f,
+    0x1.f29718p-1f,
+    0x1.f299c4p-1f,
+    0x1.f29c6cp-1f,
+    0x1.f29f16p-1f,
+    0x1.f2a1bep-1f,
+    0x1.f2a466p-1f,
+    0x1.f2a70ep-1f,
+    0x1.f2a9b6p-1f,
+    0x1.f2ac5ep-1f,
+    0x1.f2af04p-1f,
+    0x1.f2b1acp-1f,
+    0x1.f2b452p-1f,
+    0x1.f2b6f8p-1f,
+    0x1.f2b99ep-1f,
+    0x1.f2bc42p-1f,
+    0x1.f2bee6p-1f,
+    0x1.f2c18cp-1f,
+    0x1.f2c43p-1f,
+    0x1.f2c6d4p-1f,
+    0x1.f2c976p-1f,
+    0x1.f2cc1ap-1f,
+    0x1.f2cebcp-1f,
+    0x1.f2d15ep-1f,
+    0x1.f2d4p-1f,
+    0x1.f2d6a2p-1f,
+    0x1.f2d944p-1f,
+    0x1.f2dbe4p-1f,
+    0x1.f2de84p-1f,
+    0x1.f2e126p-1f,
+    0x1.f2e3c6p-1f,
+    0x1.f2e664p-1f,
+    0x1.f2e904p-1f,
+    0x1.f2eba2p-1f,
+    0x1.f2ee42p-1f,
+    0x1.f2f0ep-1f,
+    0x1.f2f37cp-1f,
+    0x1.f2f61ap-1f,
+    0x1.f2f8b8p-1f,
+    0x1.f2fb54p-1f,
+    0x1.f2fdfp-1f,
+    0x1.f3008cp-1f,
+    0x1.f30328p-1f,
+    0x1.f305c4p-1f,
+    0x1.f3085ep-1f,
+    0x1.f30af8p-1f,
+    0x1.f30d92p-1f,
+    0x1.f3102cp-1f,
+    0x1.f312c6p-1f,
+    0x1.f3156p-1f,
+    0x1.f317f8p-1f,
+    0x1.f31a9p-1f,
+    0x1.f31d2ap-1f,
+    0x1.f31fc2p-1f,
+    0x1.f32258p-1f,
+    0x1.f324fp-1f,
+    0x1.f32786p-1f,
+    0x1.f32a1cp-1f,
+    0x1.f32cb2p-1f,
+    0x1.f32f48p-1f,
+    0x1.f331dep-1f,
+    0x1.f33472p-1f,
+    0x1.f33708p-1f,
+    0x1.f3399cp-1f,
+    0x1.f33c3p-1f,
+    0x1.f33ec2p-1f,
+    0x1.f34156p-1f,
+    0x1.f343eap-1f,
+    0x1.f3467cp-1f,
+    0x1.f3490ep-1f,
+    0x1.f34bap-1f,
+    0x1.f34e32p-1f,
+    0x1.f350c2p-1f,
+    0x1.f35354p-1f,
+    0x1.f355e4p-1f,
+    0x1.f35874p-1f,
+    0x1.f35b04p-1f,
+    0x1.f35d94p-1f,
+    0x1.f36022p-1f,
+    0x1.f362b2p-1f,
+    0x1.f3654p-1f,
+    0x1.f367cep-1f,
+    0x1.f36a5cp-1f,
+    0x1.f36ce8p-1f,
+    0x1.f36f76p-1f,
+    0x1.f37202p-1f,
+    0x1.f3748ep-1f,
+    0x1.f3771ap-1f,
+    0x1.f379a6p-1f,
+    0x1.f37c32p-1f,
+    0x1.f37ebcp-1f,
+    0x1.f38148p-1f,
+    0x1.f383d2p-1f,
+    0x1.f3865cp-1f,
+    0x1.f388e4p-1f,
+    0x1.f38b6ep-1f,
+    0x1.f38df8p-1f,
+    0x1.f3908p-1f,
+    0x1.f39308p-1f,
+    0x1.f3959p-1f,
+    0x1.f39818p-1f,
+    0x1.f39a9ep-1f,
+    0x1.f39d26p-1f,
+    0x1.f39facp-1f,
+    0x1.f3a232p-1f,
+    0x1.f3a4b8p-1f,
+    0x1.f3a73ep-1f,
+    0x1.f3a9c2p-1f,
+    0x1.f3ac48p-1f,
+    0x1.f3aeccp-1f,
+    0x1.f3b15p-1f,
+    0x1.f3b3d4p-1f,
+    0x1.f3b658p-1f,
+    0x1.f3b8dap-1f,
+    0x1.f3bb5ep-1f,
+    0x1.f3bdep-1f,
+    0x1.f3c062p-1f,
+    0x1.f3c2e4p-1f,
+    0x1.f3c566p-1f,
+    0x1.f3c7e6p-1f,
+    0x1.f3ca66p-1f,
+    0x1.f3cce8p-1f,
+    0x1.f3cf68p-1f,
+    0x1.f3d1e8p-1f,
+    0x1.f3d466p-1f,
+    0x1.f3d6e6p-1f,
+    0x1.f3d964p-1f,
+    0x1.f3dbe4p-1f,
+    0x1.f3de6p-1f,
+    0x1.f3e0dep-1f,
+    0x1.f3e35cp-1f,
+    0x1.f3e5d8p-1f,
+    0x1.f3e856p-1f,
+    0x1.f3ead2p-1f,
+    0x1.f3ed4ep-1f,
+    0x1.f3efcap-1f,
+    0x1.f3f244p-1f,
+    0x1.f3f4cp-1f,
+    0x1.f3f73ap-1f,
+    0x1.f3f9b6p-1f,
+    0x1.f3fc3p-1f,
+    0x1.f3fea8p-1f,
+    0x1.f40122p-1f,
+    0x1.f4039cp-1f,
+    0x1.f40614p-1f,
+    0x1.f4088cp-1f,
+    0x1.f40b04p-1f,
+    0x1.f40d7cp-1f,
+    0x1.f40ff2p-1f,
+    0x1.f4126ap-1f,
+    0x1.f414e2p-1f,
+    0x1.f41758p-1f,
+    0x1.f419cep-1f,
+    0x1.f41c42p-1f,
+    0x1.f41eb8p-1f,
+    0x1.f4212ep-1f,
+    0x1.f423a2p-1f,
+    0x1.f42616p-1f,
+    0x1.f4288ap-1f,
+    0x1.f42afep-1f,
+    0x1.f42d72p-1f,
+    0x1.f42fe4p-1f,
+    0x1.f43258p-1f,
+    0x1.f434cap-1f,
+    0x1.f4373cp-1f,
+    0x1.f439aep-1f,
+    0x1.f43c1ep-1f,
+    0x1.f43e9p-1f,
+    0x1.f441p-1f,
+    0x1.f4437p-1f,
+    0x1.f445ep-1f,
+    0x1.f4485p-1f,
+    0x1.f44acp-1f,
+    0x1.f44d2ep-1f,
+    0x1.f44f9ep-1f,
+    0x1.f4520cp-1f,
+    0x1.f4547ap-1f,
+    0x1.f456e8p-1f,
+    0x1.f45954p-1f,
+    0x1.f45bc2p-1f,
+    0x1.f45e2ep-1f,
+    0x1.f4609ap-1f,
+    0x1.f46308p-1f,
+    0x1.f46574p-1f,
+    0x1.f467dep-1f,
+    0x1.f46a4ap-1f,
+    0x1.f46cb4p-1f,
+    0x1.f46f2p-1f,
+    0x1.f47188p-1f,
+    0x1.f473f2p-1f,
+    0x1.f4765cp-1f,
+    0x1.f478c4p-1f,
+    0x1.f47b2ep-1f,
+    0x1.f47d96p-1f,
+    0x1.f47ffep-1f,
+    0x1.f48266p-1f,
+    0x1.f484cep-1f,
+    0x1.f48736p-1f,
+    0x1.f4899cp-1f,
+    0x1.f48c02p-1f,
+    0x1.f48e68p-1f,
+    0x1.f490cep-1f,
+    0x1.f49334p-1f,
+    0x1.f4959ap-1f,
+    0x1.f497fep-1f,
+    0x1.f49a62p-1f,
+    0x1.f49cc8p-1f,
+    0x1.f49f2ap-1f,
+    0x1.f4a18ep-1f,
+    0x1.f4a3f2p-1f,
+    0x1.f4a654p-1f,
+    0x1.f4a8b8p-1f,
+    0x1.f4ab1ap-1f,
+    0x1.f4ad7cp-1f,
+    0x1.f4afdcp-1f,
+    0x1.f4b23ep-1f,
+    0x1.f4b4ap-1f,
+    0x1.f4b7p-1f,
+    0x1.f4b96p-1f,
+    0x1.f4bbcp-1f,
+    0x1.f4be2p-1f,
+    0x1.f4c08p-1f,
+    0x1.f4c2dep-1f,
+    0x1.f4c53ep-1f,
+    0x1.f4c79cp-1f,
+    0x1.f4c9fap-1f,
+    0x1.f4cc58p-1f,
+    0x1.f4ceb4p-1f,
+    0x1.f4d112p-1f,
+    0x1.f4d36ep-1f,
+    0x1.f4d5ccp-1f,
+    0x1.f4d828p-1f,
+    0x1.f4da84p-1f,
+    0x1.f4dcdep-1f,
+    0x1.f4df3ap-1f,
+    0x1.f4e196p-1f,
+    0x1.f4e3fp-1f,
+    0x1.f4e64ap-1f,
+    0x1.f4e8a4p-1f,
+    0x1.f4eafcp-1f,
+    0x1.f4ed56p-1f,
+    0x1.f4efbp-1f,
+    0x1.f4f208p-1f,
+    0x1.f4f46p-1f,
+    0x1.f4f6b8p-1f,
+    0x1.f4f91p-1f,
+    0x1.f4fb68p-1f,
+    0x1.f4fdbep-1f,
+    0x1.f50016p-1f,
+    0x1.f5026cp-1f,
+    0x1.f504c2p-1f,
+    0x1.f50716p-1f,
+    0x1.f5096cp-1f,
+    0x1.f50bc2p-1f,
+    0x1.f50e16p-1f,
+    0x1.f5106ap-1f,
+    0x1.f512bep-1f,
+    0x1.f51514p-1f,
+    0x1.f51766p-1f,
+    0x1.f519bap-1f,
+    0x1.f51c0cp-1f,
+    0x1.f51e6p-1f,
+    0x1.f520b2p-1f,
+    0x1.f52304p-1f,
+    0x1.f52554p-1f,
+    0x1.f527a6p-1f,
+    0x1.f529f8p-1f,
+    0x1.f52c48p-1f,
+    0x1.f52e98p-1f,
+    0x1.f530e8p-1f,
+    0x1.f53338p-1f,
+    0x1.f53588p-1f,
+    0x1.f537d6p-1f,
+    0x1.f53a26p-1f,
+    0x1.f53c74p-1f,
+    0x1.f53ec2p-1f,
+    0x1.f5411p-1f,
+    0x1.f5435cp-1f,
+    0x1.f545aap-1f,
+    0x1.f547f6p-1f,
+    0x1.f54a44p-1f,
+    0x1.f54c9p-1f,
+    0x1.f54edcp-1f,
+    0x1.f55128p-1f,
+    0x1.f55372p-1f,
+    0x1.f555bep-1f,
+    0x1.f55808p-1f,
+    0x1.f55a52p-1f,
+    0x1.f55c9cp-1f,
+    0x1.f55ee6p-1f,
+    0x1.f5613p-1f,
+    0x1.f56378p-1f,
+    0x1.f565c2p-1f,
+    0x1.f5680ap-1f,
+    0x1.f56a52p-1f,
+    0x1.f56c9ap-1f,
+    0x1.f56ee2p-1f,
+    0x1.f57128p-1f,
+    0x1.f5737p-1f,
+    0x1.f575b6p-1f,
+    0x1.f577fcp-1f,
+    0x1.f57a42p-1f,
+    0x1.f57c88p-1f,
+    0x1.f57ecep-1f,
+    0x1.f58112p-1f,
+    0x1.f58358p-1f,
+    0x1.f5859cp-1f,
+    0x1.f587ep-1f,
+    0x1.f58a24p-1f,
+    0x1.f58c66p-1f,
+    0x1.f58eaap-1f,
+    0x1.f590ecp-1f,
+    0x1.f5933p-1f,
+    0x1.f59572p-1f,
+    0x1.f597b4p-1f,
+    0x1.f599f6p-1f,
+    0x1.f59c36p-1f,
+    0x1.f59e78p-1f,
+    0x1.f5a0b8p-1f,
+    0x1.f5a2f8p-1f,
+    0x1.f5a538p-1f,
+    0x1.f5a778p-1f,
+    0x1.f5a9b8p-1f,
+    0x1.f5abf6p-1f,
+    0x1.f5ae36p-1f,
+    0x1.f5b074p-1f,
+    0x1.f5b2b2p-1f,
+    0x1.f5b4fp-1f,
+    0x1.f5b72ep-1f,
+    0x1.f5b96ap-1f,
+    0x1.f5bba8p-1f,
+    0x1.f5bde4p-1f,
+    0x1.f5c022p-1f,
+    0x1.f5c25cp-1f,
+    0x1.f5c498p-1f,
+    0x1.f5c6d4p-1f,
+    0x1.f5c91p-1f,
+    0x1.f5cb4ap-1f,
+    0x1.f5cd84p-1f,
+    0x1.f5cfbep-1f,
+    0x1.f5d1f8p-1f,
+    0x1.f5d432p-1f,
+    0x1.f5d66cp-1f,
+    0x1.f5d8a4p-1f,
+    0x1.f5dadcp-1f,
+    0x1.f5dd16p-1f,
+    0x1.f5df4ep-1f,
+    0x1.f5e186p-1f,
+    0x1.f5e3bcp-1f,
+    0x1.f5e5f4p-1f,
+    0x1.f5e82ap-1f,
+    0x1.f5ea6p-1f,
+    0x1.f5ec98p-1f,
+    0x1.f5eeccp-1f,
+    0x1.f5f102p-1f,
+    0x1.f5f338p-1f,
+    0x1.f5f56cp-1f,
+    0x1.f5f7a2p-1f,
+    0x1.f5f9d6p-1f,
+    0x1.f5fc0ap-1f,
+    0x1.f5fe3ep-1f,
+    0x1.f60072p-1f,
+    0x1.f602a4p-1f,
+    0x1.f604d8p-1f,
+    0x1.f6070ap-1f,
+    0x1.f6093cp-1f,
+    0x1.f60b6ep-1f,
+    0x1.f60dap-1f,
+    0x1.f60fdp-1f,
+    0x1.f61202p-1f,
+    0x1.f61432p-1f,
+    0x1.f61662p-1f,
+    0x1.f61892p-1f,
+    0x1.f61ac2p-1f,
+    0x1.f61cf2p-1f,
+    0x1.f61f22p-1f,
+    0x1.f6215p-1f,
+    0x1.f6237ep-1f,
+    0x1.f625aep-1f,
+    0x1.f627dap-1f,
+    0x1.f62a08p-1f,
+    0x1.f62c36p-1f,
+    0x1.f62e64p-1f,
+    0x1.f6309p-1f,
+    0x1.f632bcp-1f,
+    0x1.f634e8p-1f,
+    0x1.f63714p-1f,
+    0x1.f6394p-1f,
+    0x1.f63b6cp-1f,
+    0x1.f63d96p-1f,
+    0x1.f63fcp-1f,
+    0x1.f641ecp-1f,
+    0x1.f64416p-1f,
+    0x1.f6463ep-1f,
+    0x1.f64868p-1f,
+    0x1.f64a92p-1f,
+    0x1.f64cbap-1f,
+    0x1.f64ee4p-1f,
+    0x1.f6510cp-1f,
+    0x1.f65332p-1f,
+    0x1.f6555ap-1f,
+    0x1.f65782p-1f,
+    0x1.f659aap-1f,
+    0x1.f65bdp-1f,
+    0x1.f65df6p-1f,
+    0x1.f6601cp-1f,
+    0x1.f66242p-1f,
+    0x1.f66468p-1f,
+    0x1.f6668cp-1f,
+    0x1.f668b2p-1f,
+    0x1.f66ad6p-1f,
+    0x1.f66cfap-1f,
+    0x1.f66f1ep-1f,
+    0x1.f67142p-1f,
+    0x1.f67366p-1f,
+    0x1.f6758ap-1f,
+    0x1.f677acp-1f,
+    0x1.f679cep-1f,
+    0x1.f67bfp-1f,
+    0x1.f67e12p-1f,
+    0x1.f68034p-1f,
+    0x1.f68256p-1f,
+    0x1.f68476p-1f,
+    0x1.f68698p-1f,
+    0x1.f688b8p-1f,
+    0x1.f68ad8p-1f,
+    0x1.f68cf8p-1f,
+    0x1.f68f18p-1f,
+    0x1.f69138p-1f,
+    0x1.f69356p-1f,
+    0x1.f69574p-1f,
+    0x1.f69792p-1f,
+    0x1.f699bp-1f,
+    0x1.f69bcep-1f,
+    0x1.f69decp-1f,
+    0x1.f6a00ap-1f,
+    0x1.f6a226p-1f,
+    0x1.f6a442p-1f,
+    0x1.f6a66p-1f,
+    0x1.f6a87cp-1f,
+    0x1.f6aa98p-1f,
+    0x1.f6acb2p-1f,
+    0x1.f6aecep-1f,
+    0x1.f6b0e8p-1f,
+    0x1.f6b302p-1f,
+    0x1.f6b51cp-1f,
+    0x1.f6b736p-1f,
+    0x1.f6b95p-1f,
+    0x1.f6bb6ap-1f,
+    0x1.f6bd82p-1f,
+    0x1.f6bf9cp-1f,
+    0x1.f6c1b4p-1f,
+    0x1.f6c3ccp-1f,
+    0x1.f6c5e4p-1f,
+    0x1.f6c7fcp-1f,
+    0x1.f6ca12p-1f,
+    0x1.f6cc2ap-1f,
+    0x1.f6ce4p-1f,
+    0x1.f6d058p-1f,
+    0x1.f6d26ep-1f,
+    0x1.f6d482p-1f,
+    0x1.f6d698p-1f,
+    0x1.f6d8aep-1f,
+    0x1.f6dac2p-1f,
+    0x1.f6dcd6p-1f,
+    0x1.f6deecp-1f,
+    0x1.f6e1p-1f,
+    0x1.f6e314p-1f,
+    0x1.f6e526p-1f,
+    0x1.f6e73ap-1f,
+    0x1.f6e94cp-1f,
+    0x1.f6eb6p-1f,
+    0x1.f6ed72p-1f,
+    0x1.f6ef84p-1f,
+    0x1.f6f196p-1f,
+    0x1.f6f3a6p-1f,
+    0x1.f6f5b8p-1f,
+    0x1.f6f7c8p-1f,
+    0x1.f6f9dap-1f,
+    0x1.f6fbeap-1f,
+    0x1.f6fdfap-1f,
+    0x1.f70008p-1f,
+    0x1.f70218p-1f,
+    0x1.f70428p-1f,
+    0x1.f70636p-1f,
+    0x1.f70844p-1f,
+    0x1.f70a52p-1f,
+    0x1.f70c6p-1f,
+    0x1.f70e6ep-1f,
+    0x1.f7107cp-1f,
+    0x1.f71288p-1f,
+    0x1.f71496p-1f,
+    0x1.f716a2p-1f,
+    0x1.f718aep-1f,
+    0x1.f71abap-1f,
+    0x1.f71cc6p-1f,
+    0x1.f71edp-1f,
+    0x1.f720dcp-1f,
+    0x1.f722e6p-1f,
+    0x1.f724fp-1f,
+    0x1.f726fcp-1f,
+    0x1.f72904p-1f,
+    0x1.f72b0ep-1f,
+    0x1.f72d18p-1f,
+    0x1.f72f2p-1f,
+    0x1.f7312ap-1f,
+    0x1.f73332p-1f,
+    0x1.f7353ap-1f,
+    0x1.f73742p-1f,
+    0x1.f7394ap-1f,
+    0x1.f73b5p-1f,
+    0x1.f73d58p-1f,
+    0x1.f73f5ep-1f,
+    0x1.f74164p-1f,
+    0x1.f7436ap-1f,
+    0x1.f7457p-1f,
+    0x1.f74776p-1f,
+    0x1.f7497cp-1f,
+    0x1.f74b8p-1f,
+    0x1.f74d84p-1f,
+    0x1.f74f88p-1f,
+    0x1.f7518ep-1f,
+    0x1.f7539p-1f,
+    0x1.f75594p-1f,
+    0x1.f75798p-1f,
+    0x1.f7599ap-1f,
+    0x1.f75b9cp-1f,
+    0x1.f75dap-1f,
+    0x1.f75fa2p-1f,
+    0x1.f761a2p-1f,
+    0x1.f763a4p-1f,
+    0x1.f765a6p-1f,
+    0x1.f767a6p-1f,
+    0x1.f769a8p-1f,
+    0x1.f76ba8p-1f,
+    0x1.f76da8p-1f,
+    0x1.f76fa8p-1f,
+    0x1.f771a6p-1f,
+    0x1.f773a6p-1f,
+    0x1.f775a4p-1f,
+    0x1.f777a4p-1f,
+    0x1.f779a2p-1f,
+    0x1.f77bap-1f,
+    0x1.f77d9ep-1f,
+    0x1.f77f9cp-1f,
+    0x1.f78198p-1f,
+    0x1.f78396p-1f,
+    0x1.f78592p-1f,
+    0x1.f7878ep-1f,
+    0x1.f7898ap-1f,
+    0x1.f78b86p-1f,
+    0x1.f78d82p-1f,
+    0x1.f78f7cp-1f,
+    0x1.f79178p-1f,
+    0x1.f79372p-1f,
+    0x1.f7956cp-1f,
+    0x1.f79766p-1f,
+    0x1.f7996p-1f,
+    0x1.f79b5ap-1f,
+    0x1.f79d52p-1f,
+    0x1.f79f4cp-1f,
+    0x1.f7a144p-1f,
+    0x1.f7a33cp-1f,
+    0x1.f7a534p-1f,
+    0x1.f7a72cp-1f,
+    0x1.f7a924p-1f,
+    0x1.f7ab1cp-1f,
+    0x1.f7ad12p-1f,
+    0x1.f7af08p-1f,
+    0x1.f7b1p-1f,
+    0x1.f7b2f6p-1f,
+    0x1.f7b4eap-1f,
+    0x1.f7b6ep-1f,
+    0x1.f7b8d6p-1f,
+    0x1.f7bacap-1f,
+    0x1.f7bccp-1f,
+    0x1.f7beb4p-1f,
+    0x1.f7c0a8p-1f,
+    0x1.f7c29cp-1f,
+    0x1.f7c49p-1f,
+    0x1.f7c682p-1f,
+    0x1.f7c876p-1f,
+    0x1.f7ca68p-1f,
+    0x1.f7cc5ap-1f,
+    0x1.f7ce4cp-1f,
+    0x1.f7d03ep-1f,
+    0x1.f7d23p-1f,
+    0x1.f7d422p-1f,
+    0x1.f7d612p-1f,
+    0x1.f7d802p-1f,
+    0x1.f7d9f4p-1f,
+    0x1.f7dbe4p-1f,
+    0x1.f7ddd4p-1f,
+    0x1.f7dfc2p-1f,
+    0x1.f7e1b2p-1f,
+    0x1.f7e3a2p-1f,
+    0x1.f7e59p-1f,
+    0x1.f7e77ep-1f,
+    0x1.f7e96cp-1f,
+    0x1.f7eb5ap-1f,
+    0x1.f7ed48p-1f,
+    0x1.f7ef36p-1f,
+    0x1.f7f122p-1f,
+    0x1.f7f31p-1f,
+    0x1.f7f4fcp-1f,
+    0x1.f7f6e8p-1f,
+    0x1.f7f8d4p-1f,
+    0x1.f7facp-1f,
+    0x1.f7fcaap-1f,
+    0x1.f7fe96p-1f,
+    0x1.f80082p-1f,
+    0x1.f8026cp-1f,
+    0x1.f80456p-1f,
+    0x1.f8064p-1f,
+    0x1.f8082ap-1f,
+    0x1.f80a14p-1f,
+    0x1.f80bfcp-1f,
+    0x1.f80de4p-1f,
+    0x1.f80fcep-1f,
+    0x1.f811b6p-1f,
+    0x1.f8139ep-1f,
+    0x1.f81586p-1f,
+    0x1.f8176ep-1f,
+    0x1.f81954p-1f,
+    0x1.f81b3cp-1f,
+    0x1.f81d22p-1f,
+    0x1.f81f08p-1f,
+    0x1.f820eep-1f,
+    0x1.f822d4p-1f,
+    0x1.f824bap-1f,
+    0x1.f8269ep-1f,
+    0x1.f82884p-1f,
+    0x1.f82a68p-1f,
+    0x1.f82c4cp-1f,
+    0x1.f82e3p-1f,
+    0x1.f83014p-1f,
+    0x1.f831f8p-1f,
+    0x1.f833dcp-1f,
+    0x1.f835bep-1f,
+    0x1.f837a2p-1f,
+    0x1.f83984p-1f,
+    0x1.f83b66p-1f,
+    0x1.f83d48p-1f,
+    0x1.f83f2ap-1f,
+    0x1.f8410ap-1f,
+    0x1.f842ecp-1f,
+    0x1.f844cep-1f,
+    0x1.f846aep-1f,
+    0x1.f8488ep-1f,
+    0x1.f84a6ep-1f,
+    0x1.f84c4ep-1f,
+    0x1.f84e2ep-1f,
+    0x1.f8500cp-1f,
+    0x1.f851ecp-1f,
+    0x1.f853cap-1f,
+    0x1.f855a8p-1f,
+    0x1.f85786p-1f,
+    0x1.f85964p-1f,
+    0x1.f85b42p-1f,
+    0x1.f85d1ep-1f,
+    0x1.f85efcp-1f,
+    0x1.f860d8p-1f,
+    0x1.f862b4p-1f,
+    0x1.f8649p-1f,
+    0x1.f8666cp-1f,
+    0x1.f86848p-1f,
+    0x1.f86a24p-1f,
+    0x1.f86bfep-1f,
+    0x1.f86dd8p-1f,
+    0x1.f86fb4p-1f,
+    0x1.f8718ep-1f,
+    0x1.f87368p-1f,
+    0x1.f87542p-1f,
+    0x1.f8771ap-1f,
+    0x1.f878f4p-1f,
+    0x1.f87accp-1f,
+    0x1.f87ca6p-1f,
+    0x1.f87e7ep-1f,
+    0x1.f88056p-1f,
+    0x1.f8822ep-1f,
+    0x1.f88404p-1f,
+    0x1.f885dcp-1f,
+    0x1.f887b2p-1f,
+    0x1.f8898ap-1f,
+    0x1.f88b6p-1f,
+    0x1.f88d36p-1f,
+    0x1.f88f0cp-1f,
+    0x1.f890e2p-1f,
+    0x1.f892b6p-1f,
+    0x1.f8948cp-1f,
+    0x1.f8966p-1f,
+    0x1.f89834p-1f,
+    0x1.f89a0ap-1f,
+    0x1.f89bdep-1f,
+    0x1.f89dbp-1f,
+    0x1.f89f84p-1f,
+    0x1.f8a156p-1f,
+    0x1.f8a32ap-1f,
+    0x1.f8a4fcp-1f,
+    0x1.f8a6cep-1f,
+    0x1.f8a8ap-1f,
+    0x1.f8aa72p-1f,
+    0x1.f8ac44p-1f,
+    0x1.f8ae16p-1f,
+    0x1.f8afe6p-1f,
+    0x1.f8b1b6p-1f,
+    0x1.f8b386p-1f,
+    0x1.f8b558p-1f,
+    0x1.f8b728p-1f,
+    0x1.f8b8f6p-1f,
+    0x1.f8bac6p-1f,
+    0x1.f8bc94p-1f,
+    0x1.f8be64p-1f,
+    0x1.f8c032p-1f,
+    0x1.f8c2p-1f,
+    0x1.f8c3cep-1f,
+    0x1.f8c59cp-1f,
+    0x1.f8c76ap-1f,
+    0x1.f8c936p-1f,
+    0x1.f8cb04p-1f,
+    0x1.f8ccdp-1f,
+    0x1.f8ce9cp-1f,
+    0x1.f8d068p-1f,
+    0x1.f8d234p-1f,
+    0x1.f8d4p-1f,
+    0x1.f8d5cap-1f,
+    0x1.f8d796p-1f,
+    0x1.f8d96p-1f,
+    0x1.f8db2ap-1f,
+    0x1.f8dcf4p-1f,
+    0x1.f8decp-1f,
+    0x1.f8e088p-1f,
+    0x1.f8e252p-1f,
+    0x1.f8e41ap-1f,
+    0x1.f8e5e4p-1f,
+    0x1.f8e7acp-1f,
+    0x1.f8e974p-1f,
+    0x1.f8eb3cp-1f,
+    0x1.f8ed04p-1f,
+    0x1.f8eeccp-1f,
+    0x1.f8f092p-1f,
+    0x1.f8f25ap-1f,
+    0x1.f8f42p-1f,
+    0x1.f8f5e6p-1f,
+    0x1.f8f7aep-1f,
+    0x1.f8f974p-1f,
+    0x1.f8fb38p-1f,
+    0x1.f8fcfep-1f,
+    0x1.f8fec4p-1f,
+    0x1.f90088p-1f,
+    0x1.f9024cp-1f,
+    0x1.f9041p-1f,
+    0x1.f905d4p-1f,
+    0x1.f90798p-1f,
+    0x1.f9095cp-1f,
+    0x1.f90b1ep-1f,
+    0x1.f90ce2p-1f,
+    0x1.f90ea4p-1f,
+    0x1.f91066p-1f,
+    0x1.f91228p-1f,
+    0x1.f913eap-1f,
+    0x1.f915acp-1f,
+    0x1.f9176ep-1f,
+    0x1.f9192ep-1f,
+    0x1.f91afp-1f,
+    0x1.f91cbp-1f,
+    0x1.f91e7p-1f,
+    0x1.f9203p-1f,
+    0x1.f921fp-1f,
+    0x1.f923aep-1f,
+    0x1.f9256ep-1f,
+    0x1.f9272cp-1f,
+    0x1.f928ecp-1f,
+    0x1.f92aaap-1f,
+    0x1.f92c68p-1f,
+    0x1.f92e26p-1f,
+    0x1.f92fe4p-1f,
+    0x1.f931a2p-1f,
+    0x1.f9335ep-1f,
+    0x1.f9351ap-1f,
+    0x1.f936d8p-1f,
+    0x1.f93894p-1f,
+    0x1.f93a5p-1f,
+    0x1.f93c0cp-1f,
+    0x1.f93dc6p-1f,
+    0x1.f93f82p-1f,
+    0x1.f9413cp-1f,
+    0x1.f942f8p-1f,
+    0x1.f944b2p-1f,
+    0x1.f9466cp-1f,
+    0x1.f94826p-1f,
+    0x1.f949ep-1f,
+    0x1.f94b98p-1f,
+    0x1.f94d52p-1f,
+    0x1.f94f0ap-1f,
+    0x1.f950c4p-1f,
+    0x1.f9527cp-1f,
+    0x1.f95434p-1f,
+    0x1.f955eap-1f,
+    0x1.f957a2p-1f,
+    0x1.f9595ap-1f,
+    0x1.f95b1p-1f,
+    0x1.f95cc8p-1f,
+    0x1.f95e7ep-1f,
+    0x1.f96034p-1f,
+    0x1.f961eap-1f,
+    0x1.f963ap-1f,
+    0x1.f96554p-1f,
+    0x1.f9670ap-1f,
+    0x1.f968bep-1f,
+    0x1.f96a74p-1f,
+    0x1.f96c28p-1f,
+    0x1.f96ddcp-1f,
+    0x1.f96f9p-1f,
+    0x1.f97142p-1f,
+    0x1.f972f6p-1f,
+    0x1.f974a8p-1f,
+    0x1.f9765cp-1f,
+    0x1.f9780ep-1f,
+    0x1.f979cp-1f,
+    0x1.f97b72p-1f,
+    0x1.f97d24p-1f,
+    0x1.f97ed6p-1f,
+    0x1.f98086p-1f,
+    0x1.f98238p-1f,
+    0x1.f983e8p-1f,
+    0x1.f98598p-1f,
+    0x1.f98748p-1f,
+    0x1.f988f8p-1f,
+    0x1.f98aa8p-1f,
+    0x1.f98c58p-1f,
+    0x1.f98e06p-1f,
+    0x1.f98fb6p-1f,
+    0x1.f99164p-1f,
+    0x1.f99312p-1f,
+    0x1.f994cp-1f,
+    0x1.f9966ep-1f,
+    0x1.f9981cp-1f,
+    0x1.f999c8p-1f,
+    0x1.f99b76p-1f,
+    0x1.f99d22p-1f,
+    0x1.f99ecep-1f,
+    0x1.f9a07ap-1f,
+    0x1.f9a226p-1f,
+    0x1.f9a3d2p-1f,
+    0x1.f9a57ep-1f,
+    0x1.f9a728p-1f,
+    0x1.f9a8d4p-1f,
+    0x1.f9aa7ep-1f,
+    0x1.f9ac28p-1f,
+    0x1.f9add2p-1f,
+    0x1.f9af7cp-1f,
+    0x1.f9b126p-1f,
+    0x1.f9b2dp-1f,
+    0x1.f9b478p-1f,
+    0x1.f9b622p-1f,
+    0x1.f9b7cap-1f,
+    0x1.f9b972p-1f,
+    0x1.f9bb1ap-1f,
+    0x1.f9bcc2p-1f,
+    0x1.f9be68p-1f,
+    0x1.f9c01p-1f,
+    0x1.f9c1b8p-1f,
+    0x1.f9c35ep-1f,
+    0x1.f9c504p-1f,
+    0x1.f9c6aap-1f,
+    0x1.f9c85p-1f,
+    0x1.f9c9f6p-1f,
+    0x1.f9cb9cp-1f,
+    0x1.f9cd4p-1f,
+    0x1.f9cee6p-1f,
+    0x1.f9d08ap-1f,
+    0x1.f9d22ep-1f,
+    0x1.f9d3d2p-1f,
+    0x1.f9d576p-1f,
+    0x1.f9d71ap-1f,
+    0x1.f9d8bep-1f,
+    0x1.f9da6p-1f,
+    0x1.f9dc04p-1f,
+    0x1.f9dda6p-1f,
+    0x1.f9df48p-1f,
+    0x1.f9e0eap-1f,
+    0x1.f9e28cp-1f,
+    0x1.f9e42ep-1f,
+    0x1.f9e5cep-1f,
+    0x1.f9e77p-1f,
+    0x1.f9e91p-1f,
+    0x1.f9eabp-1f,
+    0x1.f9ec52p-1f,
+    0x1.f9edfp-1f,
+    0x1.f9ef9p-1f,
+    0x1.f9f13p-1f,
+    0x1.f9f2dp-1f,
+    0x1.f9f46ep-1f,
+    0x1.f9f60cp-1f,
+    0x1.f9f7acp-1f,
+    0x1.f9f94ap-1f,
+    0x1.f9fae8p-1f,
+    0x1.f9fc86p-1f,
+    0x1.f9fe22p-1f,
+    0x1.f9ffcp-1f,
+    0x1.fa015cp-1f,
+    0x1.fa02fap-1f,
+    0x1.fa0496p-1f,
+    0x1.fa0632p-1f,
+    0x1.fa07cep-1f,
+    0x1.fa096ap-1f,
+    0x1.fa0b04p-1f,
+    0x1.fa0cap-1f,
+    0x1.fa0e3ap-1f,
+    0x1.fa0fd4p-1f,
+    0x1.fa116ep-1f,
+    0x1.fa130ap-1f,
+    0x1.fa14a2p-1f,
+    0x1.fa163cp-1f,
+    0x1.fa17d6p-1f,
+    0x1.fa196ep-1f,
+    0x1.fa1b08p-1f,
+    0x1.fa1cap-1f,
+    0x1.fa1e38p-1f,
+    0x1.fa1fdp-1f,
+    0x1.fa2168p-1f,
+    0x1.fa23p-1f,
+    0x1.fa2496p-1f,
+    0x1.fa262ep-1f,
+    0x1.fa27c4p-1f,
+    0x1.fa295ap-1f,
+    0x1.fa2af2p-1f,
+    0x1.fa2c86p-1f,
+    0x1.fa2e1cp-1f,
+    0x1.fa2fb2p-1f,
+    0x1.fa3148p-1f,
+    0x1.fa32dcp-1f,
+    0x1.fa347p-1f,
+    0x1.fa3606p-1f,
+    0x1.fa379ap-1f,
+    0x1.fa392ep-1f,
+    0x1.fa3acp-1f,
+    0x1.fa3c54p-1f,
+    0x1.fa3de8p-1f,
+    0x1.fa3f7ap-1f,
+    0x1.fa410cp-1f,
+    0x1.fa42ap-1f,
+    0x1.fa4432p-1f,
+    0x1.fa45c4p-1f,
+    0x1.fa4754p-1f,
+    0x1.fa48e6p-1f,
+    0x1.fa4a78p-1f,
+    0x1.fa4c08p-1f,
+    0x1.fa4d98p-1f,
+    0x1.fa4f2ap-1f,
+    0x1.fa50bap-1f,
+    0x1.fa524ap-1f,
+    0x1.fa53d8p-1f,
+    0x1.fa5568p-1f,
+    0x1.fa56f8p-1f,
+    0x1.fa5886p-1f,
+    0x1.fa5a14p-1f,
+    0x1.fa5ba2p-1f,
+    0x1.fa5d3p-1f,
+    0x1.fa5ebep-1f,
+    0x1.fa604cp-1f,
+    0x1.fa61dap-1f,
+    0x1.fa6366p-1f,
+    0x1.fa64f4p-1f,
+    0x1.fa668p-1f,
+    0x1.fa680cp-1f,
+    0x1.fa6998p-1f,
+    0x1.fa6b24p-1f,
+    0x1.fa6cbp-1f,
+    0x1.fa6e3ap-1f,
+    0x1.fa6fc6p-1f,
+    0x1.fa715p-1f,
+    0x1.fa72dcp-1f,
+    0x1.fa7466p-1f,
+    0x1.fa75fp-1f,
+    0x1.fa777ap-1f,
+    0x1.fa7902p-1f,
+    0x1.fa7a8cp-1f,
+    0x1.fa7c14p-1f,
+    0x1.fa7d9ep-1f,
+    0x1.fa7f26p-1f,
+    0x1.fa80aep-1f,
+    0x1.fa8236p-1f,
+    0x1.fa83bep-1f,
+    0x1.fa8546p-1f,
+    0x1.fa86ccp-1f,
+    0x1.fa8854p-1f,
+    0x1.fa89dap-1f,
+    0x1.fa8b6p-1f,
+    0x1.fa8ce8p-1f,
+    0x1.fa8e6ep-1f,
+    0x1.fa8ff4p-1f,
+    0x1.fa9178p-1f,
+    0x1.fa92fep-1f,
+    0x1.fa9482p-1f,
+    0x1.fa9608p-1f,
+    0x1.fa978cp-1f,
+    0x1.fa991p-1f,
+    0x1.fa9a94p-1f,
+    0x1.fa9c18p-1f,
+    0x1.fa9d9cp-1f,
+    0x1.fa9f1ep-1f,
+    0x1.faa0a2p-1f,
+    0x1.faa224p-1f,
+    0x1.faa3a6p-1f,
+    0x1.faa528p-1f,
+    0x1.faa6aap-1f,
+    0x1.faa82cp-1f,
+    0x1.faa9aep-1f,
+    0x1.faab3p-1f,
+    0x1.faacbp-1f,
+    0x1.faae3p-1f,
+    0x1.faafb2p-1f,
+    0x1.fab132p-1f,
+    0x1.fab2b2p-1f,
+    0x1.fab432p-1f,
+    0x1.fab5bp-1f,
+    0x1.fab73p-1f,
+    0x1.fab8aep-1f,
+    0x1.faba2ep-1f,
+    0x1.fabbacp-1f,
+    0x1.fabd2ap-1f,
+    0x1.fabea8p-1f,
+    0x1.fac026p-1f,
+    0x1.fac1a4p-1f,
+    0x1.fac32p-1f,
+    0x1.fac49ep-1f,
+    0x1.fac61ap-1f,
+    0x1.fac796p-1f,
+    0x1.fac912p-1f,
+    0x1.faca9p-1f,
+    0x1.facc0ap-1f,
+    0x1.facd86p-1f,
+    0x1.facf02p-1f,
+    0x1.fad07cp-1f,
+    0x1.fad1f8p-1f,
+    0x1.fad372p-1f,
+    0x1.fad4ecp-1f,
+    0x1.fad666p-1f,
+    0x1.fad7ep-1f,
+    0x1.fad958p-1f,
+    0x1.fadad2p-1f,
+    0x1.fadc4cp-1f,
+    0x1.faddc4p-1f,
+    0x1.fadf3cp-1f,
+    0x1.fae0b4p-1f,
+    0x1.fae22cp-1f,
+    0x1.fae3a4p-1f,
+    0x1.fae51cp-1f,
+    0x1.fae694p-1f,
+    0x1.fae80ap-1f,
+    0x1.fae98p-1f,
+    0x1.faeaf8p-1f,
+    0x1.faec6ep-1f,
+    0x1.faede4p-1f,
+    0x1.faef5ap-1f,
+    0x1.faf0dp-1f,
+    0x1.faf244p-1f,
+    0x1.faf3bap-1f,
+    0x1.faf52ep-1f,
+    0x1.faf6a2p-1f,
+    0x1.faf816p-1f,
+    0x1.faf98ap-1f,
+    0x1.fafafep-1f,
+    0x1.fafc72p-1f,
+    0x1.fafde6p-1f,
+    0x1.faff58p-1f,
+    0x1.fb00ccp-1f,
+    0x1.fb023ep-1f,
+    0x1.fb03bp-1f,
+    0x1.fb0522p-1f,
+    0x1.fb0694p-1f,
+    0x1.fb0806p-1f,
+    0x1.fb0976p-1f,
+    0x1.fb0ae8p-1f,
+    0x1.fb0c58p-1f,
+    0x1.fb0dcap-1f,
+    0x1.fb0f3ap-1f,
+    0x1.fb10aap-1f,
+    0x1.fb121ap-1f,
+    0x1.fb138ap-1f,
+    0x1.fb14f8p-1f,
+    0x1.fb1668p-1f,
+    0x1.fb17d6p-1f,
+    0x1.fb1946p-1f,
+    0x1.fb1ab4p-1f,
+    0x1.fb1c22p-1f,
+    0x1.fb1d9p-1f,
+    0x1.fb1efcp-1f,
+    0x1.fb206ap-1f,
+    0x1.fb21d8p-1f,
+    0x1.fb2344p-1f,
+    0x1.fb24b2p-1f,
+    0x1.fb261ep-1f,
+    0x1.fb278ap-1f,
+    0x1.fb28f6p-1f,
+    0x1.fb2a62p-1f,
+    0x1.fb2bccp-1f,
+    0x1.fb2d38p-1f,
+    0x1.fb2ea2p-1f,
+    0x1.fb300ep-1f,
+    0x1.fb3178p-1f,
+    0x1.fb32e2p-1f,
+    0x1.fb344cp-1f,
+    0x1.fb35b6p-1f,
+    0x1.fb372p-1f,
+    0x1.fb3888p-1f,
+    0x1.fb39f2p-1f,
+    0x1.fb3b5ap-1f,
+    0x1.fb3cc2p-1f,
+    0x1.fb3e2ap-1f,
+    0x1.fb3f92p-1f,
+    0x1.fb40fap-1f,
+    0x1.fb4262p-1f,
+    0x1.fb43cap-1f,
+    0x1.fb453p-1f,
+    0x1.fb4696p-1f,
+    0x1.fb47fep-1f,
+    0x1.fb4964p-1f,
+    0x1.fb4acap-1f,
+    0x1.fb4c3p-1f,
+    0x1.fb4d96p-1f,
+    0x1.fb4efap-1f,
+    0x1.fb506p-1f,
+    0x1.fb51c4p-1f,
+    0x1.fb5328p-1f,
+    0x1.fb548ep-1f,
+    0x1.fb55f2p-1f,
+    0x1.fb5756p-1f,
+    0x1.fb58b8p-1f,
+    0x1.fb5a1cp-1f,
+    0x1.fb5b8p-1f,
+    0x1.fb5ce2p-1f,
+    0x1.fb5e44p-1f,
+    0x1.fb5fa8p-1f,
+    0x1.fb610ap-1f,
+    0x1.fb626cp-1f,
+    0x1.fb63ccp-1f,
+    0x1.fb652ep-1f,
+    0x1.fb669p-1f,
+    0x1.fb67fp-1f,
+    0x1.fb695p-1f,
+    0x1.fb6ab2p-1f,
+    0x1.fb6c12p-1f,
+    0x1.fb6d72p-1f,
+    0x1.fb6ed2p-1f,
+    0x1.fb703p-1f,
+    0x1.fb719p-1f,
+    0x1.fb72eep-1f,
+    0x1.fb744ep-1f,
+    0x1.fb75acp-1f,
+    0x1.fb770ap-1f,
+    0x1.fb7868p-1f,
+    0x1.fb79c6p-1f,
+    0x1.fb7b24p-1f,
+    0x1.fb7c82p-1f,
+    0x1.fb7ddep-1f,
+    0x1.fb7f3ap-1f,
+    0x1.fb8098p-1f,
+    0x1.fb81f4p-1f,
+    0x1.fb835p-1f,
+    0x1.fb84acp-1f,
+    0x1.fb8608p-1f,
+    0x1.fb8762p-1f,
+    0x1.fb88bep-1f,
+    0x1.fb8a18p-1f,
+    0x1.fb8b74p-1f,
+    0x1.fb8ccep-1f,
+    0x1.fb8e28p-1f,
+    0x1.fb8f82p-1f,
+    0x1.fb90dcp-1f,
+    0x1.fb9234p-1f,
+    0x1.fb938ep-1f,
+    0x1.fb94e6p-1f,
+    0x1.fb964p-1f,
+    0x1.fb9798p-1f,
+    0x1.fb98fp-1f,
+    0x1.fb9a48p-1f,
+    0x1.fb9bap-1f,
+    0x1.fb9cf8p-1f,
+    0x1.fb9e4ep-1f,
+    0x1.fb9fa6p-1f,
+    0x1.fba0fcp-1f,
+    0x1.fba254p-1f,
+    0x1.fba3aap-1f,
+    0x1.fba5p-1f,
+    0x1.fba656p-1f,
+    0x1.fba7aap-1f,
+    0x1.fba9p-1f,
+    0x1.fbaa56p-1f,
+    0x1.fbabaap-1f,
+    0x1.fbacfep-1f,
+    0x1.fbae54p-1f,
+    0x1.fbafa8p-1f,
+    0x1.fbb0fcp-1f,
+    0x1.fbb24ep-1f,
+    0x1.fbb3a2p-1f,
+    0x1.fbb4f6p-1f,
+    0x1.fbb648p-1f,
+    0x1.fbb79cp-1f,
+    0x1.fbb8eep-1f,
+    0x1.fbba4p-1f,
+    0x1.fbbb92p-1f,
+    0x1.fbbce4p-1f,
+    0x1.fbbe36p-1f,
+    0x1.fbbf86p-1f,
+    0x1.fbc0d8p-1f,
+    0x1.fbc228p-1f,
+    0x1.fbc378p-1f,
+    0x1.fbc4cap-1f,
+    0x1.fbc618p-1f,
+    0x1.fbc76ap-1f,
+    0x1.fbc8b8p-1f,
+    0x1.fbca08p-1f,
+    0x1.fbcb56p-1f,
+    0x1.fbcca6p-1f,
+    0x1.fbcdf4p-1f,
+    0x1.fbcf42p-1f,
+    0x1.fbd09p-1f,
+    0x1.fbd1dep-1f,
+    0x1.fbd32cp-1f,
+    0x1.fbd47ap-1f,
+    0x1.fbd5c8p-1f,
+    0x1.fbd714p-1f,
+    0x1.fbd86p-1f,
+    0x1.fbd9aep-1f,
+    0x1.fbdafap-1f,
+    0x1.fbdc46p-1f,
+    0x1.fbdd92p-1f,
+    0x1.fbdedep-1f,
+    0x1.fbe028p-1f,
+    0x1.fbe174p-1f,
+    0x1.fbe2bep-1f,
+    0x1.fbe408p-1f,
+    0x1.fbe554p-1f,
+    0x1.fbe69ep-1f,
+    0x1.fbe7e8p-1f,
+    0x1.fbe93p-1f,
+    0x1.fbea7ap-1f,
+    0x1.fbebc4p-1f,
+    0x1.fbed0cp-1f,
+    0x1.fbee56p-1f,
+    0x1.fbef9ep-1f,
+    0x1.fbf0e6p-1f,
+    0x1.fbf22ep-1f,
+    0x1.fbf376p-1f,
+    0x1.fbf4bcp-1f,
+    0x1.fbf604p-1f,
+    0x1.fbf74cp-1f,
+    0x1.fbf892p-1f,
+    0x1.fbf9d8p-1f,
+    0x1.fbfb2p-1f,
+    0x1.fbfc64p-1f,
+    0x1.fbfdaap-1f,
+    0x1.fbfefp-1f,
+    0x1.fc0036p-1f,
+    0x1.fc017cp-1f,
+    0x1.fc02cp-1f,
+    0x1.fc0404p-1f,
+    0x1.fc054ap-1f,
+    0x1.fc068ep-1f,
+    0x1.fc07d2p-1f,
+    0x1.fc0914p-1f,
+    0x1.fc0a58p-1f,
+    0x1.fc0b9cp-1f,
+    0x1.fc0cdep-1f,
+    0x1.fc0e22p-1f,
+    0x1.fc0f64p-1f,
+    0x1.fc10a6p-1f,
+    0x1.fc11e8p-1f,
+    0x1.fc132ap-1f,
+    0x1.fc146cp-1f,
+    0x1.fc15aep-1f,
+    0x1.fc16eep-1f,
+    0x1.fc183p-1f,
+    0x1.fc197p-1f,
+    0x1.fc1abp-1f,
+    0x1.fc1bfp-1f,
+    0x1.fc1d3p-1f,
+    0x1.fc1e7p-1f,
+    0x1.fc1fbp-1f,
+    0x1.fc20eep-1f,
+    0x1.fc222ep-1f,
+    0x1.fc236cp-1f,
+    0x1.fc24acp-1f,
+    0x1.fc25eap-1f,
+    0x1.fc2728p-1f,
+    0x1.fc2866p-1f,
+    0x1.fc29a2p-1f,
+    0x1.fc2aep-1f,
+    0x1.fc2c1ep-1f,
+    0x1.fc2d5ap-1f,
+    0x1.fc2e98p-1f,
+    0x1.fc2fd4p-1f,
+    0x1.fc311p-1f,
+    0x1.fc324cp-1f,
+    0x1.fc3388p-1f,
+    0x1.fc34c2p-1f,
+    0x1.fc35fep-1f,
+    0x1.fc373ap-1f,
+    0x1.fc3874p-1f,
+    0x1.fc39aep-1f,
+    0x1.fc3ae8p-1f,
+    0x1.fc3c22p-1f,
+    0x1.fc3d5cp-1f,
+    0x1.fc3e96p-1f,
+    0x1.fc3fdp-1f,
+    0x1.fc4108p-1f,
+    0x1.fc4242p-1f,
+    0x1.fc437ap-1f,
+    0x1.fc44b2p-1f,
+    0x1.fc45ecp-1f,
+    0x1.fc4724p-1f,
+    0x1.fc485ap-1f,
+    0x1.fc4992p-1f,
+    0x1.fc4acap-1f,
+    0x1.fc4cp-1f,
+    0x1.fc4d38p-1f,
+    0x1.fc4e6ep-1f,
+    0x1.fc4fa4p-1f,
+    0x1.fc50dap-1f,
+    0x1.fc521p-1f,
+    0x1.fc5346p-1f,
+    0x1.fc547cp-1f,
+    0x1.fc55bp-1f,
+    0x1.fc56e6p-1f,
+    0x1.fc581ap-1f,
+    0x1.fc595p-1f,
+    0x1.fc5a84p-1f,
+    0x1.fc5bb8p-1f,
+    0x1.fc5ceap-1f,
+    0x1.fc5e1ep-1f,
+    0x1.fc5f52p-1f,
+    0x1.fc6084p-1f,
+    0x1.fc61b8p-1f,
+    0x1.fc62eap-1f,
+    0x1.fc641cp-1f,
+    0x1.fc655p-1f,
+    0x1.fc668p-1f,
+    0x1.fc67b2p-1f,
+    0x1.fc68e4p-1f,
+    0x1.fc6a16p-1f,
+    0x1.fc6b46p-1f,
+    0x1.fc6c78p-1f,
+    0x1.fc6da8p-1f,
+    0x1.fc6ed8p-1f,
+    0x1.fc7008p-1f,
+    0x1.fc7138p-1f,
+    0x1.fc7268p-1f,
+    0x1.fc7396p-1f,
+    0x1.fc74c6p-1f,
+    0x1.fc75f6p-1f,
+    0x1.fc7724p-1f,
+    0x1.fc7852p-1f,
+    0x1.fc798p-1f,
+    0x1.fc7aaep-1f,
+    0x1.fc7bdcp-1f,
+    0x1.fc7d0ap-1f,
+    0x1.fc7e36p-1f,
+    0x1.fc7f64p-1f,
+    0x1.fc809p-1f,
+    0x1.fc81bep-1f,
+    0x1.fc82eap-1f,
+    0x1.fc8416p-1f,
+    0x1.fc8542p-1f,
+    0x1.fc866ep-1f,
+    0x1.fc879ap-1f,
+    0x1.fc88c4p-1f,
+    0x1.fc89fp-1f,
+    0x1.fc8b1ap-1f,
+    0x1.fc8c44p-1f,
+    0x1.fc8d6ep-1f,
+    0x1.fc8e98p-1f,
+    0x1.fc8fc2p-1f,
+    0x1.fc90ecp-1f,
+    0x1.fc9216p-1f,
+    0x1.fc934p-1f,
+    0x1.fc9468p-1f,
+    0x1.fc959p-1f,
+    0x1.fc96bap-1f,
+    0x1.fc97e2p-1f,
+    0x1.fc990ap-1f,
+    0x1.fc9a3p-1f,
+    0x1.fc9b58p-1f,
+    0x1.fc9c8p-1f,
+    0x1.fc9da6p-1f,
+    0x1.fc9ecep-1f,
+    0x1.fc9ff4p-1f,
+    0x1.fca11ap-1f,
+    0x1.fca242p-1f,
+    0x1.fca366p-1f,
+    0x1.fca48cp-1f,
+    0x1.fca5b2p-1f,
+    0x1.fca6d8p-1f,
+    0x1.fca7fcp-1f,
+    0x1.fca922p-1f,
+    0x1.fcaa46p-1f,
+    0x1.fcab6ap-1f,
+    0x1.fcac8ep-1f,
+    0x1.fcadb2p-1f,
+    0x1.fcaed6p-1f,
+    0x1.fcaffap-1f,
+    0x1.fcb11cp-1f,
+    0x1.fcb24p-1f,
+    0x1.fcb362p-1f,
+    0x1.fcb484p-1f,
+    0x1.fcb5a6p-1f,
+    0x1.fcb6c8p-1f,
+    0x1.fcb7eap-1f,
+    0x1.fcb90cp-1f,
+    0x1.fcba2ep-1f,
+    0x1.fcbb4ep-1f,
+    0x1.fcbc7p-1f,
+    0x1.fcbd9p-1f,
+    0x1.fcbebp-1f,
+    0x1.fcbfdp-1f,
+    0x1.fcc0fp-1f,
+    0x1.fcc21p-1f,
+    0x1.fcc33p-1f,
+    0x1.fcc45p-1f,
+    0x1.fcc56ep-1f,
+    0x1.fcc68ep-1f,
+    0x1.fcc7acp-1f,
+    0x1.fcc8cap-1f,
+    0x1.fcc9e8p-1f,
+    0x1.fccb06p-1f,
+    0x1.fccc24p-1f,
+    0x1.fccd42p-1f,
+    0x1.fcce5ep-1f,
+    0x1.fccf7cp-1f,
+    0x1.fcd098p-1f,
+    0x1.fcd1b6p-1f,
+    0x1.fcd2d2p-1f,
+    0x1.fcd3eep-1f,
+    0x1.fcd50ap-1f,
+    0x1.fcd626p-1f,
+    0x1.fcd74p-1f,
+    0x1.fcd85cp-1f,
+    0x1.fcd976p-1f,
+    0x1.fcda92p-1f,
+    0x1.fcdbacp-1f,
+    0x1.fcdcc6p-1f,
+    0x1.fcddep-1f,
+    0x1.fcdefap-1f,
+    0x1.fce014p-1f,
+    0x1.fce12ep-1f,
+    0x1.fce246p-1f,
+    0x1.fce36p-1f,
+    0x1.fce478p-1f,
+    0x1.fce59p-1f,
+    0x1.fce6a8p-1f,
+    0x1.fce7c2p-1f,
+    0x1.fce8d8p-1f,
+    0x1.fce9fp-1f,
+    0x1.fceb08p-1f,
+    0x1.fcec1ep-1f,
+    0x1.fced36p-1f,
+    0x1.fcee4cp-1f,
+    0x1.fcef62p-1f,
+    0x1.fcf07ap-1f,
+    0x1.fcf19p-1f,
+    0x1.fcf2a6p-1f,
+    0x1.fcf3bap-1f,
+    0x1.fcf4dp-1f,
+    0x1.fcf5e4p-1f,
+    0x1.fcf6fap-1f,
+    0x1.fcf80ep-1f,
+    0x1.fcf922p-1f,
+    0x1.fcfa38p-1f,
+    0x1.fcfb4cp-1f,
+    0x1.fcfc5ep-1f,
+    0x1.fcfd72p-1f,
+    0x1.fcfe86p-1f,
+    0x1.fcff98p-1f,
+    0x1.fd00acp-1f,
+    0x1.fd01bep-1f,
+    0x1.fd02dp-1f,
+    0x1.fd03e2p-1f,
+    0x1.fd04f4p-1f,
+    0x1.fd0606p-1f,
+    0x1.fd0718p-1f,
+    0x1.fd082ap-1f,
+    0x1.fd093ap-1f,
+    0x1.fd0a4ap-1f,
+    0x1.fd0b5cp-1f,
+    0x1.fd0c6cp-1f,
+    0x1.fd0d7cp-1f,
+    0x1.fd0e8cp-1f,
+    0x1.fd0f9cp-1f,
+    0x1.fd10acp-1f,
+    0x1.fd11bap-1f,
+    0x1.fd12cap-1f,
+    0x1.fd13d8p-1f,
+    0x1.fd14e6p-1f,
+    0x1.fd15f6p-1f,
+    0x1.fd1704p-1f,
+    0x1.fd1812p-1f,
+    0x1.fd191ep-1f,
+    0x1.fd1a2cp-1f,
+    0x1.fd1b3ap-1f,
+    0x1.fd1c46p-1f,
+    0x1.fd1d54p-1f,
+    0x1.fd1e6p-1f,
+    0x1.fd1f6cp-1f,
+    0x1.fd2078p-1f,
+    0x1.fd2184p-1f,
+    0x1.fd229p-1f,
+    0x1.fd239cp-1f,
+    0x1.fd24a6p-1f,
+    0x1.fd25b2p-1f,
+    0x1.fd26bcp-1f,
+    0x1.fd27c8p-1f,
+    0x1.fd28d2p-1f,
+    0x1.fd29dcp-1f,
+    0x1.fd2ae6p-1f,
+    0x1.fd2beep-1f,
+    0x1.fd2cf8p-1f,
+    0x1.fd2e02p-1f,
+    0x1.fd2f0ap-1f,
+    0x1.fd3014p-1f,
+    0x1.fd311cp-1f,
+    0x1.fd3224p-1f,
+    0x1.fd332cp-1f,
+    0x1.fd3434p-1f,
+    0x1.fd353cp-1f,
+    0x1.fd3644p-1f,
+    0x1.fd374ap-1f,
+    0x1.fd3852p-1f,
+    0x1.fd3958p-1f,
+    0x1.fd3a5ep-1f,
+    0x1.fd3b64p-1f,
+    0x1.fd3c6cp-1f,
+    0x1.fd3d72p-1f,
+    0x1.fd3e76p-1f,
+    0x1.fd3f7cp-1f,
+    0x1.fd4082p-1f,
+    0x1.fd4186p-1f,
+    0x1.fd428cp-1f,
+    0x1.fd439p-1f,
+    0x1.fd4494p-1f,
+    0x1.fd4598p-1f,
+    0x1.fd469cp-1f,
+    0x1.fd47ap-1f,
+    0x1.fd48a2p-1f,
+    0x1.fd49a6p-1f,
+    0x1.fd4aaap-1f,
+    0x1.fd4bacp-1f,
+    0x1.fd4caep-1f,
+    0x1.fd4dbp-1f,
+    0x1.fd4eb2p-1f,
+    0x1.fd4fb4p-1f,
+    0x1.fd50b6p-1f,
+    0x1.fd51b8p-1f,
+    0x1.fd52bap-1f,
+    0x1.fd53bap-1f,
+    0x1.fd54bcp-1f,
+    0x1.fd55bcp-1f,
+    0x1.fd56bcp-1f,
+    0x1.fd57bcp-1f,
+    0x1.fd58bcp-1f,
+    0x1.fd59bcp-1f,
+    0x1.fd5abcp-1f,
+    0x1.fd5bbap-1f,
+    0x1.fd5cbap-1f,
+    0x1.fd5db8p-1f,
+    0x1.fd5eb6p-1f,
+    0x1.fd5fb6p-1f,
+    0x1.fd60b4p-1f,
+    0x1.fd61b2p-1f,
+    0x1.fd62aep-1f,
+    0x1.fd63acp-1f,
+    0x1.fd64aap-1f,
+    0x1.fd65a6p-1f,
+    0x1.fd66a4p-1f,
+    0x1.fd67ap-1f,
+    0x1.fd689cp-1f,
+    0x1.fd6998p-1f,
+    0x1.fd6a94p-1f,
+    0x1.fd6b9p-1f,
+    0x1.fd6c8cp-1f,
+    0x1.fd6d86p-1f,
+    0x1.fd6e82p-1f,
+    0x1.fd6f7cp-1f,
+    0x1.fd7078p-1f,
+    0x1.fd7172p-1f,
+    0x1.fd726cp-1f,
+    0x1.fd7366p-1f,
+    0x1.fd746p-1f,
+    0x1.fd755ap-1f,
+    0x1.fd7652p-1f,
+    0x1.fd774cp-1f,
+    0x1.fd7844p-1f,
+    0x1.fd793ep-1f,
+    0x1.fd7a36p-1f,
+    0x1.fd7b2ep-1f,
+    0x1.fd7c26p-1f,
+    0x1.fd7d1ep-1f,
+    0x1.fd7e14p-1f,
+    0x1.fd7f0cp-1f,
+    0x1.fd8004p-1f,
+    0x1.fd80fap-1f,
+    0x1.fd81f2p-1f,
+    0x1.fd82e8p-1f,
+    0x1.fd83dep-1f,
+    0x1.fd84d4p-1f,
+    0x1.fd85cap-1f,
+    0x1.fd86cp-1f,
+    0x1.fd87b4p-1f,
+    0x1.fd88aap-1f,
+    0x1.fd899ep-1f,
+    0x1.fd8a94p-1f,
+    0x1.fd8b88p-1f,
+    0x1.fd8c7cp-1f,
+    0x1.fd8d7p-1f,
+    0x1.fd8e64p-1f,
+    0x1.fd8f58p-1f,
+    0x1.fd904ap-1f,
+    0x1.fd913ep-1f,
+    0x1.fd923p-1f,
+    0x1.fd9324p-1f,
+    0x1.fd9416p-1f,
+    0x1.fd9508p-1f,
+    0x1.fd95fap-1f,
+    0x1.fd96ecp-1f,
+    0x1.fd97dep-1f,
+    0x1.fd98dp-1f,
+    0x1.fd99cp-1f,
+    0x1.fd9ab2p-1f,
+    0x1.fd9ba2p-1f,
+    0x1.fd9c94p-1f,
+    0x1.fd9d84p-1f,
+    0x1.fd9e74p-1f,
+    0x1.fd9f64p-1f,
+    0x1.fda054p-1f,
+    0x1.fda142p-1f,
+    0x1.fda232p-1f,
+    0x1.fda322p-1f,
+    0x1.fda41p-1f,
+    0x1.fda4fep-1f,
+    0x1.fda5ecp-1f,
+    0x1.fda6dcp-1f,
+    0x1.fda7cap-1f,
+    0x1.fda8b6p-1f,
+    0x1.fda9a4p-1f,
+    0x1.fdaa92p-1f,
+    0x1.fdab7ep-1f,
+    0x1.fdac6cp-1f,
+    0x1.fdad58p-1f,
+    0x1.fdae44p-1f,
+    0x1.fdaf32p-1f,
+    0x1.fdb01ep-1f,
+    0x1.fdb108p-1f,
+    0x1.fdb1f4p-1f,
+    0x1.fdb2ep-1f,
+    0x1.fdb3ccp-1f,
+    0x1.fdb4b6p-1f,
+    0x1.fdb5ap-1f,
+    0x1.fdb68cp-1f,
+    0x1.fdb776p-1f,
+    0x1.fdb86p-1f,
+    0x1.fdb94ap-1f,
+    0x1.fdba34p-1f,
+    0x1.fdbb1cp-1f,
+    0x1.fdbc06p-1f,
+    0x1.fdbceep-1f,
+    0x1.fdbdd8p-1f,
+    0x1.fdbecp-1f,
+    0x1.fdbfa8p-1f,
+    0x1.fdc09p-1f,
+    0x1.fdc178p-1f,
+    0x1.fdc26p-1f,
+    0x1.fdc348p-1f,
+    0x1.fdc43p-1f,
+    0x1.fdc516p-1f,
+    0x1.fdc5fep-1f,
+    0x1.fdc6e4p-1f,
+    0x1.fdc7cap-1f,
+    0x1.fdc8bp-1f,
+    0x1.fdc996p-1f,
+    0x1.fdca7cp-1f,
+    0x1.fdcb62p-1f,
+    0x1.fdcc48p-1f,
+    0x1.fdcd2cp-1f,
+    0x1.fdce12p-1f,
+    0x1.fdcef6p-1f,
+    0x1.fdcfdap-1f,
+    0x1.fdd0bep-1f,
+    0x1.fdd1a2p-1f,
+    0x1.fdd286p-1f,
+    0x1.fdd36ap-1f,
+    0x1.fdd44ep-1f,
+    0x1.fdd53p-1f,
+    0x1.fdd614p-1f,
+    0x1.fdd6f6p-1f,
+    0x1.fdd7dap-1f,
+    0x1.fdd8bcp-1f,
+    0x1.fdd99ep-1f,
+    0x1.fdda8p-1f,
+    0x1.fddb62p-1f,
+    0x1.fddc42p-1f,
+    0x1.fddd24p-1f,
+    0x1.fdde06p-1f,
+    0x1.fddee6p-1f,
+    0x1.fddfc6p-1f,
+    0x1.fde0a8p-1f,
+    0x1.fde188p-1f,
+    0x1.fde268p-1f,
+    0x1.fde348p-1f,
+    0x1.fde426p-1f,
+    0x1.fde506p-1f,
+    0x1.fde5e6p-1f,
+    0x1.fde6c4p-1f,
+    0x1.fde7a4p-1f,
+    0x1.fde882p-1f,
+    0x1.fde96p-1f,
+    0x1.fdea3ep-1f,
+    0x1.fdeb1cp-1f,
+    0x1.fdebfap-1f,
+    0x1.fdecd8p-1f,
+    0x1.fdedb4p-1f,
+    0x1.fdee92p-1f,
+    0x1.fdef6ep-1f,
+    0x1.fdf04ap-1f,
+    0x1.fdf128p-1f,
+    0x1.fdf204p-1f,
+    0x1.fdf2ep-1f,
+    0x1.fdf3bcp-1f,
+    0x1.fdf496p-1f,
+    0x1.fdf572p-1f,
+    0x1.fdf64ep-1f,
+    0x1.fdf728p-1f,
+    0x1.fdf802p-1f,
+    0x1.fdf8dep-1f,
+    0x1.fdf9b8p-1f,
+    0x1.fdfa92p-1f,
+    0x1.fdfb6cp-1f,
+    0x1.fdfc46p-1f,
+    0x1.fdfd1ep-1f,
+    0x1.fdfdf8p-1f,
+    0x1.fdfedp-1f,
+    0x1.fdffaap-1f,
+    0x1.fe0082p-1f,
+    0x1.fe015ap-1f,
+    0x1.fe0232p-1f,
+    0x1.fe030ap-1f,
+    0x1.fe03e2p-1f,
+    0x1.fe04bap-1f,
+    0x1.fe0592p-1f,
+    0x1.fe0668p-1f,
+    0x1.fe074p-1f,
+    0x1.fe0816p-1f,
+    0x1.fe08ecp-1f,
+    0x1.fe09c2p-1f,
+    0x1.fe0a98p-1f,
+    0x1.fe0b6ep-1f,
+    0x1.fe0c44p-1f,
+    0x1.fe0d1ap-1f,
+    0x1.fe0dfp-1f,
+    0x1.fe0ec4p-1f,
+    0x1.fe0f98p-1f,
+    0x1.fe106ep-1f,
+    0x1.fe1142p-1f,
+    0x1.fe1216p-1f,
+    0x1.fe12eap-1f,
+    0x1.fe13bep-1f,
+    0x1.fe1492p-1f,
+    0x1.fe1564p-1f,
+    0x1.fe1638p-1f,
+    0x1.fe170ap-1f,
+    0x1.fe17dep-1f,
+    0x1.fe18bp-1f,
+    0x1.fe1982p-1f,
+    0x1.fe1a54p-1f,
+    0x1.fe1b26p-1f,
+    0x1.fe1bf8p-1f,
+    0x1.fe1ccap-1f,
+    0x1.fe1d9ap-1f,
+    0x1.fe1e6cp-1f,
+    0x1.fe1f3cp-1f,
+    0x1.fe200cp-1f,
+    0x1.fe20dep-1f,
+    0x1.fe21aep-1f,
+    0x1.fe227ep-1f,
+    0x1.fe234ep-1f,
+    0x1.fe241cp-1f,
+    0x1.fe24ecp-1f,
+    0x1.fe25bcp-1f,
+    0x1.fe268ap-1f,
+    0x1.fe2758p-1f,
+    0x1.fe2828p-1f,
+    0x1.fe28f6p-1f,
+    0x1.fe29c4p-1f,
+    0x1.fe2a92p-1f,
+    0x1.fe2b6p-1f,
+    0x1.fe2c2cp-1f,
+    0x1.fe2cfap-1f,
+    0x1.fe2dc8p-1f,
+    0x1.fe2e94p-1f,
+    0x1.fe2f6p-1f,
+    0x1.fe302ep-1f,
+    0x1.fe30fap-1f,
+    0x1.fe31c6p-1f,
+    0x1.fe3292p-1f,
+    0x1.fe335cp-1f,
+    0x1.fe3428p-1f,
+    0x1.fe34f4p-1f,
+    0x1.fe35bep-1f,
+    0x1.fe368ap-1f,
+    0x1.fe3754p-1f,
+    0x1.fe381ep-1f,
+    0x1.fe38e8p-1f,
+    0x1.fe39b2p-1f,
+    0x1.fe3a7cp-1f,
+    0x1.fe3b46p-1f,
+    0x1.fe3c1p-1f,
+    0x1.fe3cd8p-1f,
+    0x1.fe3da2p-1f,
+    0x1.fe3e6ap-1f,
+    0x1.fe3f32p-1f,
+    0x1.fe3ffap-1f,
+    0x1.fe40c2p-1f,
+    0x1.fe418ap-1f,
+    0x1.fe4252p-1f,
+    0x1.fe431ap-1f,
+    0x1.fe43e2p-1f,
+    0x1.fe44a8p-1f,
+    0x1.fe456ep-1f,
+    0x1.fe4636p-1f,
+    0x1.fe46fcp-1f,
+    0x1.fe47c2p-1f,
+    0x1.fe4888p-1f,
+    0x1.fe494ep-1f,
+    0x1.fe4a14p-1f,
+    0x1.fe4adap-1f,
+    0x1.fe4b9ep-1f,
+    0x1.fe4c64p-1f,
+    0x1.fe4d28p-1f,
+    0x1.fe4decp-1f,
+    0x1.fe4eb2p-1f,
+    0x1.fe4f76p-1f,
+    0x1.fe503ap-1f,
+    0x1.fe50fep-1f,
+    0x1.fe51cp-1f,
+    0x1.fe5284p-1f,
+    0x1.fe5348p-1f,
+    0x1.fe540ap-1f,
+    0x1.fe54ccp-1f,
+    0x1.fe559p-1f,
+    0x1.fe5652p-1f,
+    0x1.fe5714p-1f,
+    0x1.fe57d6p-1f,
+    0x1.fe5898p-1f,
+    0x1.fe5958p-1f,
+    0x1.fe5a1ap-1f,
+    0x1.fe5adcp-1f,
+    0x1.fe5b9cp-1f,
+    0x1.fe5c5ep-1f,
+    0x1.fe5d1ep-1f,
+    0x1.fe5ddep-1f,
+    0x1.fe5e9ep-1f,
+    0x1.fe5f5ep-1f,
+    0x1.fe601ep-1f,
+    0x1.fe60dcp-1f,
+    0x1.fe619cp-1f,
+    0x1.fe625cp-1f,
+    0x1.fe631ap-1f,
+    0x1.fe63d8p-1f,
+    0x1.fe6498p-1f,
+    0x1.fe6556p-1f,
+    0x1.fe6614p-1f,
+    0x1.fe66d2p-1f,
+    0x1.fe678ep-1f,
+    0x1.fe684cp-1f,
+    0x1.fe690ap-1f,
+    0x1.fe69c6p-1f,
+    0x1.fe6a84p-1f,
+    0x1.fe6b4p-1f,
+    0x1.fe6bfcp-1f,
+    0x1.fe6cb8p-1f,
+    0x1.fe6d74p-1f,
+    0x1.fe6e3p-1f,
+    0x1.fe6eecp-1f,
+    0x1.fe6fa8p-1f,
+    0x1.fe7062p-1f,
+    0x1.fe711ep-1f,
+    0x1.fe71d8p-1f,
+    0x1.fe7292p-1f,
+    0x1.fe734ep-1f,
+    0x1.fe7408p-1f,
+    0x1.fe74c2p-1f,
+    0x1.fe757cp-1f,
+    0x1.fe7634p-1f,
+    0x1.fe76eep-1f,
+    0x1.fe77a8p-1f,
+    0x1.fe786p-1f,
+    0x1.fe7918p-1f,
+    0x1.fe79d2p-1f,
+    0x1.fe7a8ap-1f,
+    0x1.fe7b42p-1f,
+    0x1.fe7bfap-1f,
+    0x1.fe7cb2p-1f,
+    0x1.fe7d6ap-1f,
+    0x1.fe7e2p-1f,
+    0x1.fe7ed8p-1f,
+    0x1.fe7f8ep-1f,
+    0x1.fe8046p-1f,
+    0x1.fe80fcp-1f,
+    0x1.fe81b2p-1f,
+    0x1.fe8268p-1f,
+    0x1.fe831ep-1f,
+    0x1.fe83d4p-1f,
+    0x1.fe848ap-1f,
+    0x1.fe854p-1f,
+    0x1.fe85f4p-1f,
+    0x1.fe86aap-1f,
+    0x1.fe875ep-1f,
+    0x1.fe8812p-1f,
+    0x1.fe88c6p-1f,
+    0x1.fe897ap-1f,
+    0x1.fe8a2ep-1f,
+    0x1.fe8ae2p-1f,
+    0x1.fe8b96p-1f,
+    0x1.fe8c4ap-1f,
+    0x1.fe8cfcp-1f,
+    0x1.fe8dbp-1f,
+    0x1.fe8e62p-1f,
+    0x1.fe8f14p-1f,
+    0x1.fe8fc6p-1f,
+    0x1.fe9078p-1f,
+    0x1.fe912ap-1f,
+    0x1.fe91dcp-1f,
+    0x1.fe928ep-1f,
+    0x1.fe934p-1f,
+    0x1.fe93fp-1f,
+    0x1.fe94a2p-1f,
+    0x1.fe9552p-1f,
+    0x1.fe9602p-1f,
+    0x1.fe96b4p-1f,
+    0x1.fe9764p-1f,
+    0x1.fe9814p-1f,
+    0x1.fe98c2p-1f,
+    0x1.fe9972p-1f,
+    0x1.fe9a22p-1f,
+    0x1.fe9adp-1f,
+    0x1.fe9b8p-1f,
+    0x1.fe9c2ep-1f,
+    0x1.fe9cdcp-1f,
+    0x1.fe9d8cp-1f,
+    0x1.fe9e3ap-1f,
+    0x1.fe9ee8p-1f,
+    0x1.fe9f96p-1f,
+    0x1.fea042p-1f,
+    0x1.fea0fp-1f,
+    0x1.fea19ep-1f,
+    0x1.fea24ap-1f,
+    0x1.fea2f6p-1f,
+    0x1.fea3a4p-1f,
+    0x1.fea45p-1f,
+    0x1.fea4fcp-1f,
+    0x1.fea5a8p-1f,
+    0x1.fea654p-1f,
+    0x1.fea6fep-1f,
+    0x1.fea7aap-1f,
+    0x1.fea856p-1f,
+    0x1.fea9p-1f,
+    0x1.fea9acp-1f,
+    0x1.feaa56p-1f,
+    0x1.feabp-1f,
+    0x1.feabaap-1f,
+    0x1.feac54p-1f,
+    0x1.feacfep-1f,
+    0x1.feada8p-1f,
+    0x1.feae5p-1f,
+    0x1.feaefap-1f,
+    0x1.feafa4p-1f,
+    0x1.feb04cp-1f,
+    0x1.feb0f4p-1f,
+    0x1.feb19cp-1f,
+    0x1.feb244p-1f,
+    0x1.feb2ecp-1f,
+    0x1.feb394p-1f,
+    0x1.feb43cp-1f,
+    0x1.feb4e4p-1f,
+    0x1.feb58ap-1f,
+    0x1.feb632p-1f,
+    0x1.feb6d8p-1f,
+    0x1.feb78p-1f,
+    0x1.feb826p-1f,
+    0x1.feb8ccp-1f,
+    0x1.feb972p-1f,
+    0x1.feba18p-1f,
+    0x1.febabep-1f,
+    0x1.febb62p-1f,
+    0x1.febc08p-1f,
+    0x1.febcaep-1f,
+    0x1.febd52p-1f,
+    0x1.febdf6p-1f,
+    0x1.febe9cp-1f,
+    0x1.febf4p-1f,
+    0x1.febfe4p-1f,
+    0x1.fec088p-1f,
+    0x1.fec12ap-1f,
+    0x1.fec1cep-1f,
+    0x1.fec272p-1f,
+    0x1.fec314p-1f,
+    0x1.fec3b8p-1f,
+    0x1.fec45ap-1f,
+    0x1.fec4fcp-1f,
+    0x1.fec5ap-1f,
+    0x1.fec642p-1f,
+    0x1.fec6e4p-1f,
+    0x1.fec784p-1f,
+    0x1.fec826p-1f,
+    0x1.fec8c8p-1f,
+    0x1.fec968p-1f,
+    0x1.feca0ap-1f,
+    0x1.fecaaap-1f,
+    0x1.fecb4cp-1f,
+    0x1.fecbecp-1f,
+    0x1.fecc8cp-1f,
+    0x1.fecd2cp-1f,
+    0x1.fecdccp-1f,
+    0x1.fece6ap-1f,
+    0x1.fecf0ap-1f,
+    0x1.fecfaap-1f,
+    0x1.fed048p-1f,
+    0x1.fed0e8p-1f,
+    0x1.fed186p-1f,
+    0x1.fed224p-1f,
+    0x1.fed2c2p-1f,
+    0x1.fed36p-1f,
+    0x1.fed3fep-1f,
+    0x1.fed49cp-1f,
+    0x1.fed53ap-1f,
+    0x1.fed5d6p-1f,
+    0x1.fed674p-1f,
+    0x1.fed71p-1f,
+    0x1.fed7aep-1f,
+    0x1.fed84ap-1f,
+    0x1.fed8e6p-1f,
+    0x1.fed982p-1f,
+    0x1.feda1ep-1f,
+    0x1.fedabap-1f,
+    0x1.fedb56p-1f,
+    0x1.fedbfp-1f,
+    0x1.fedc8cp-1f,
+    0x1.fedd26p-1f,
+    0x1.feddc2p-1f,
+    0x1.fede5cp-1f,
+    0x1.fedef6p-1f,
+    0x1.fedf9p-1f,
+    0x1.fee02ap-1f,
+    0x1.fee0c4p-1f,
+    0x1.fee15ep-1f,
+    0x1.fee1f8p-1f,
+    0x1.fee29p-1f,
+    0x1.fee32ap-1f,
+    0x1.fee3c2p-1f,
+    0x1.fee45ap-1f,
+    0x1.fee4f4p-1f,
+    0x1.fee58cp-1f,
+    0x1.fee624p-1f,
+    0x1.fee6bcp-1f,
+    0x1.fee754p-1f,
+    0x1.fee7eap-1f,
+    0x1.fee882p-1f,
+    0x1.fee91ap-1f,
+    0x1.fee9bp-1f,
+    0x1.feea46p-1f,
+    0x1.feeadep-1f,
+    0x1.feeb74p-1f,
+    0x1.feec0ap-1f,
+    0x1.feecap-1f,
+    0x1.feed36p-1f,
+    0x1.feedccp-1f,
+    0x1.feee6p-1f,
+    0x1.feeef6p-1f,
+    0x1.feef8ap-1f,
+    0x1.fef02p-1f,
+    0x1.fef0b4p-1f,
+    0x1.fef148p-1f,
+    0x1.fef1dcp-1f,
+    0x1.fef27p-1f,
+    0x1.fef304p-1f,
+    0x1.fef398p-1f,
+    0x1.fef42cp-1f,
+    0x1.fef4cp-1f,
+    0x1.fef552p-1f,
+    0x1.fef5e6p-1f,
+    0x1.fef678p-1f,
+    0x1.fef70ap-1f,
+    0x1.fef79cp-1f,
+    0x1.fef82ep-1f,
+    0x1.fef8cp-1f,
+    0x1.fef952p-1f,
+    0x1.fef9e4p-1f,
+    0x1.fefa76p-1f,
+    0x1.fefb06p-1f,
+    0x1.fefb98p-1f,
+    0x1.fefc28p-1f,
+    0x1.fefcbap-1f,
+    0x1.fefd4ap-1f,
+    0x1.fefddap-1f,
+    0x1.fefe6ap-1f,
+    0x1.fefefap-1f,
+    0x1.feff8ap-1f,
+    0x1.ff001ap-1f,
+    0x1.ff00a8p-1f,
+    0x1.ff0138p-1f,
+    0x1.ff01c6p-1f,
+    0x1.ff0256p-1f,
+    0x1.ff02e4p-1f,
+    0x1.ff0372p-1f,
+    0x1.ff04p-1f,
+    0x1.ff048ep-1f,
+    0x1.ff051cp-1f,
+    0x1.ff05aap-1f,
+    0x1.ff0638p-1f,
+    0x1.ff06c4p-1f,
+    0x1.ff0752p-1f,
+    0x1.ff07dep-1f,
+    0x1.ff086cp-1f,
+    0x1.ff08f8p-1f,
+    0x1.ff0984p-1f,
+    0x1.ff0a1p-1f,
+    0x1.ff0a9cp-1f,
+    0x1.ff0b28p-1f,
+    0x1.ff0bb4p-1f,
+    0x1.ff0c3ep-1f,
+    0x1.ff0ccap-1f,
+    0x1.ff0d54p-1f,
+    0x1.ff0dep-1f,
+    0x1.ff0e6ap-1f,
+    0x1.ff0ef4p-1f,
+    0x1.ff0f8p-1f,
+    0x1.ff100ap-1f,
+    0x1.ff1094p-1f,
+    0x1.ff111cp-1f,
+    0x1.ff11a6p-1f,
+    0x1.ff123p-1f,
+    0x1.ff12b8p-1f,
+    0x1.ff1342p-1f,
+    0x1.ff13cap-1f,
+    0x1.ff1454p-1f,
+    0x1.ff14dcp-1f,
+    0x1.ff1564p-1f,
+    0x1.ff15ecp-1f,
+    0x1.ff1674p-1f,
+    0x1.ff16fcp-1f,
+    0x1.ff1782p-1f,
+    0x1.ff180ap-1f,
+    0x1.ff1892p-1f,
+    0x1.ff1918p-1f,
+    0x1.ff199ep-1f,
+    0x1.ff1a26p-1f,
+    0x1.ff1aacp-1f,
+    0x1.ff1b32p-1f,
+    0x1.ff1bb8p-1f,
+    0x1.ff1c3ep-1f,
+    0x1.ff1cc4p-1f,
+    0x1.ff1d48p-1f,
+    0x1.ff1dcep-1f,
+    0x1.ff1e54p-1f,
+    0x1.ff1ed8p-1f,
+    0x1.ff1f5cp-1f,
+    0x1.ff1fep-1f,
+    0x1.ff2066p-1f,
+    0x1.ff20eap-1f,
+    0x1.ff216ep-1f,
+    0x1.ff21f2p-1f,
+    0x1.ff2274p-1f,
+    0x1.ff22f8p-1f,
+    0x1.ff237cp-1f,
+    0x1.ff23fep-1f,
+    0x1.ff2482p-1f,
+    0x1.ff2504p-1f,
+    0x1.ff2586p-1f,
+    0x1.ff2608p-1f,
+    0x1.ff268ap-1f,
+    0x1.ff270ep-1f,
+    0x1.ff278ep-1f,
+    0x1.ff281p-1f,
+    0x1.ff2892p-1f,
+    0x1.ff2912p-1f,
+    0x1.ff2994p-1f,
+    0x1.ff2a14p-1f,
+    0x1.ff2a96p-1f,
+    0x1.ff2b16p-1f,
+    0x1.ff2b96p-1f,
+    0x1.ff2c16p-1f,
+    0x1.ff2c96p-1f,
+    0x1.ff2d16p-1f,
+    0x1.ff2d96p-1f,
+    0x1.ff2e16p-1f,
+    0x1.ff2e94p-1f,
+    0x1.ff2f14p-1f,
+    0x1.ff2f92p-1f,
+    0x1.ff301p-1f,
+    0x1.ff309p-1f,
+    0x1.ff310ep-1f,
+    0x1.ff318cp-1f,
+    0x1.ff320ap-1f,
+    0x1.ff3288p-1f,
+    0x1.ff3306p-1f,
+    0x1.ff3382p-1f,
+    0x1.ff34p-1f,
+    0x1.ff347cp-1f,
+    0x1.ff34fap-1f,
+    0x1.ff3576p-1f,
+    0x1.ff35f2p-1f,
+    0x1.ff366ep-1f,
+    0x1.ff36ecp-1f,
+    0x1.ff3768p-1f,
+    0x1.ff37e2p-1f,
+    0x1.ff385ep-1f,
+    0x1.ff38dap-1f,
+    0x1.ff3956p-1f,
+    0x1.ff39dp-1f,
+    0x1.ff3a4cp-1f,
+    0x1.ff3ac6p-1f,
+    0x1.ff3b4p-1f,
+    0x1.ff3bbap-1f,
+    0x1.ff3c34p-1f,
+    0x1.ff3caep-1f,
+    0x1.ff3d28p-1f,
+    0x1.ff3da2p-1f,
+    0x1.ff3e1cp-1f,
+    0x1.ff3e94p-1f,
+    0x1.ff3f0ep-1f,
+    0x1.ff3f86p-1f,
+    0x1.ff4p-1f,
+    0x1.ff4078p-1f,
+    0x1.ff40fp-1f,
+    0x1.ff4168p-1f,
+    0x1.ff41ep-1f,
+    0x1.ff4258p-1f,
+    0x1.ff42dp-1f,
+    0x1.ff4348p-1f,
+    0x1.ff43bep-1f,
+    0x1.ff4436p-1f,
+    0x1.ff44acp-1f,
+    0x1.ff4524p-1f,
+    0x1.ff459ap-1f,
+    0x1.ff461p-1f,
+    0x1.ff4686p-1f,
+    0x1.ff46fcp-1f,
+    0x1.ff4772p-1f,
+    0x1.ff47e8p-1f,
+    0x1.ff485ep-1f,
+    0x1.ff48d4p-1f,
+    0x1.ff4948p-1f,
+    0x1.ff49bep-1f,
+    0x1.ff4a32p-1f,
+    0x1.ff4aa6p-1f,
+    0x1.ff4b1cp-1f,
+    0x1.ff4b9p-1f,
+    0x1.ff4c04p-1f,
+    0x1.ff4c78p-1f,
+    0x1.ff4cecp-1f,
+    0x1.ff4d5ep-1f,
+    0x1.ff4dd2p-1f,
+    0x1.ff4e46p-1f,
+    0x1.ff4eb8p-1f,
+    0x1.ff4f2ap-1f,
+    0x1.ff4f9ep-1f,
+    0x1.ff501p-1f,
+    0x1.ff5082p-1f,
+    0x1.ff50f4p-1f,
+    0x1.ff5166p-1f,
+    0x1.ff51d8p-1f,
+    0x1.ff524ap-1f,
+    0x1.ff52bcp-1f,
+    0x1.ff532cp-1f,
+    0x1.ff539ep-1f,
+    0x1.ff540ep-1f,
+    0x1.ff548p-1f,
+    0x1.ff54fp-1f,
+    0x1.ff556p-1f,
+    0x1.ff55dp-1f,
+    0x1.ff564p-1f,
+    0x1.ff56bp-1f,
+    0x1.ff572p-1f,
+    0x1.ff579p-1f,
+    0x1.ff58p-1f,
+    0x1.ff586ep-1f,
+    0x1.ff58dep-1f,
+    0x1.ff594cp-1f,
+    0x1.ff59bap-1f,
+    0x1.ff5a2ap-1f,
+    0x1.ff5a98p-1f,
+    0x1.ff5b06p-1f,
+    0x1.ff5b74p-1f,
+    0x1.ff5be2p-1f,
+    0x1.ff5c5p-1f,
+    0x1.ff5cbcp-1f,
+    0x1.ff5d2ap-1f,
+    0x1.ff5d96p-1f,
+    0x1.ff5e04p-1f,
+    0x1.ff5e7p-1f,
+    0x1.ff5edep-1f,
+    0x1.ff5f4ap-1f,
+    0x1.ff5fb6p-1f,
+    0x1.ff6022p-1f,
+    0x1.ff608ep-1f,
+    0x1.ff60fap-1f,
+    0x1.ff6164p-1f,
+    0x1.ff61dp-1f,
+    0x1.ff623cp-1f,
+    0x1.ff62a6p-1f,
+    0x1.ff6312p-1f,
+    0x1.ff637cp-1f,
+    0x1.ff63e6p-1f,
+    0x1.ff645p-1f,
+    0x1.ff64bap-1f,
+    0x1.ff6524p-1f,
+    0x1.ff658ep-1f,
+    0x1.ff65f8p-1f,
+    0x1.ff6662p-1f,
+    0x1.ff66cap-1f,
+    0x1.ff6734p-1f,
+    0x1.ff679cp-1f,
+    0x1.ff6806p-1f,
+    0x1.ff686ep-1f,
+    0x1.ff68d6p-1f,
+    0x1.ff693ep-1f,
+    0x1.ff69a6p-1f,
+    0x1.ff6a0ep-1f,
+    0x1.ff6a76p-1f,
+    0x1.ff6adep-1f,
+    0x1.ff6b46p-1f,
+    0x1.ff6bacp-1f,
+    0x1.ff6c14p-1f,
+    0x1.ff6c7ap-1f,
+    0x1.ff6ce2p-1f,
+    0x1.ff6d48p-1f,
+    0x1.ff6daep-1f,
+    0x1.ff6e14p-1f,
+    0x1.ff6e7ap-1f,
+    0x1.ff6eep-1f,
+    0x1.ff6f46p-1f,
+    0x1.ff6facp-1f,
+    0x1.ff7012p-1f,
+    0x1.ff7076p-1f,
+    0x1.ff70dcp-1f,
+    0x1.ff714p-1f,
+    0x1.ff71a4p-1f,
+    0x1.ff720ap-1f,
+    0x1.ff726ep-1f,
+    0x1.ff72d2p-1f,
+    0x1.ff7336p-1f,
+    0x1.ff739ap-1f,
+    0x1.ff73fep-1f,
+    0x1.ff746p-1f,
+    0x1.ff74c4p-1f,
+    0x1.ff7528p-1f,
+    0x1.ff758ap-1f,
+    0x1.ff75eep-1f,
+    0x1.ff765p-1f,
+    0x1.ff76b2p-1f,
+    0x1.ff7714p-1f,
+    0x1.ff7776p-1f,
+    0x1.ff77d8p-1f,
+    0x1.ff783ap-1f,
+    0x1.ff789cp-1f,
+    0x1.ff78fep-1f,
+    0x1.ff796p-1f,
+    0x1.ff79cp-1f,
+    0x1.ff7a22p-1f,
+    0x1.ff7a82p-1f,
+    0x1.ff7ae2p-1f,
+    0x1.ff7b44p-1f,
+    0x1.ff7ba4p-1f,
+    0x1.ff7c04p-1f,
+    0x1.ff7c64p-1f,
+    0x1.ff7cc4p-1f,
+    0x1.ff7d24p-1f,
+    0x1.ff7d82p-1f,
+    0x1.ff7de2p-1f,
+    0x1.ff7e4p-1f,
+    0x1.ff7eap-1f,
+    0x1.ff7efep-1f,
+    0x1.ff7f5ep-1f,
+    0x1.ff7fbcp-1f,
+    0x1.ff801ap-1f,
+    0x1.ff8078p-1f,
+    0x1.ff80d6p-1f,
+    0x1.ff8134p-1f,
+    0x1.ff8192p-1f,
+    0x1.ff81fp-1f,
+    0x1.ff824cp-1f,
+    0x1.ff82aap-1f,
+    0x1.ff8306p-1f,
+    0x1.ff8364p-1f,
+    0x1.ff83cp-1f,
+    0x1.ff841cp-1f,
+    0x1.ff847ap-1f,
+    0x1.ff84d6p-1f,
+    0x1.ff8532p-1f,
+    0x1.ff858ep-1f,
+    0x1.ff85e8p-1f,
+    0x1.ff8644p-1f,
+    0x1.ff86ap-1f,
+    0x1.ff86fap-1f,
+    0x1.ff8756p-1f,
+    0x1.ff87bp-1f,
+    0x1.ff880cp-1f,
+    0x1.ff8866p-1f,
+    0x1.ff88cp-1f,
+    0x1.ff891ap-1f,
+    0x1.ff8974p-1f,
+    0x1.ff89cep-1f,
+    0x1.ff8a28p-1f,
+    0x1.ff8a82p-1f,
+    0x1.ff8adcp-1f,
+    0x1.ff8b34p-1f,
+    0x1.ff8b8ep-1f,
+    0x1.ff8be6p-1f,
+    0x1.ff8c4p-1f,
+    0x1.ff8c98p-1f,
+    0x1.ff8cfp-1f,
+    0x1.ff8d48p-1f,
+    0x1.ff8dap-1f,
+    0x1.ff8df8p-1f,
+    0x1.ff8e5p-1f,
+    0x1.ff8ea8p-1f,
+    0x1.ff8fp-1f,
+    0x1.ff8f56p-1f,
+    0x1.ff8faep-1f,
+    0x1.ff9004p-1f,
+    0x1.ff905cp-1f,
+    0x1.ff90b2p-1f,
+    0x1.ff9108p-1f,
+    0x1.ff915ep-1f,
+    0x1.ff91b4p-1f,
+    0x1.ff920ap-1f,
+    0x1.ff926p-1f,
+    0x1.ff92b6p-1f,
+    0x1.ff930cp-1f,
+    0x1.ff9362p-1f,
+    0x1.ff93b6p-1f,
+    0x1.ff940cp-1f,
+    0x1.ff946p-1f,
+    0x1.ff94b6p-1f,
+    0x1.ff950ap-1f,
+    0x1.ff955ep-1f,
+    0x1.ff95b2p-1f,
+    0x1.ff9606p-1f,
+    0x1.ff965ap-1f,
+    0x1.ff96aep-1f,
+    0x1.ff9702p-1f,
+    0x1.ff9754p-1f,
+    0x1.ff97a8p-1f,
+    0x1.ff97fcp-1f,
+    0x1.ff984ep-1f,
+    0x1.ff98a2p-1f,
+    0x1.ff98f4p-1f,
+    0x1.ff9946p-1f,
+    0x1.ff9998p-1f,
+    0x1.ff99eap-1f,
+    0x1.ff9a3cp-1f,
+    0x1.ff9a8ep-1f,
+    0x1.ff9aep-1f,
+    0x1.ff9b32p-1f,
+    0x1.ff9b84p-1f,
+    0x1.ff9bd4p-1f,
+    0x1.ff9c26p-1f,
+    0x1.ff9c76p-1f,
+    0x1.ff9cc6p-1f,
+    0x1.ff9d18p-1f,
+    0x1.ff9d68p-1f,
+    0x1.ff9db8p-1f,
+    0x1.ff9e08p-1f,
+    0x1.ff9e58p-1f,
+    0x1.ff9ea8p-1f,
+    0x1.ff9ef8p-1f,
+    0x1.ff9f48p-1f,
+    0x1.ff9f96p-1f,
+    0x1.ff9fe6p-1f,
+    0x1.ffa034p-1f,
+    0x1.ffa084p-1f,
+    0x1.ffa0d2p-1f,
+    0x1.ffa12p-1f,
+    0x1.ffa17p-1f,
+    0x1.ffa1bep-1f,
+    0x1.ffa20cp-1f,
+    0x1.ffa25ap-1f,
+    0x1.ffa2a8p-1f,
+    0x1.ffa2f4p-1f,
+    0x1.ffa342p-1f,
+    0x1.ffa39p-1f,
+    0x1.ffa3dcp-1f,
+    0x1.ffa42ap-1f,
+    0x1.ffa476p-1f,
+    0x1.ffa4c4p-1f,
+    0x1.ffa51p-1f,
+    0x1.ffa55cp-1f,
+    0x1.ffa5a8p-1f,
+    0x1.ffa5f4p-1f,
+    0x1.ffa64p-1f,
+    0x1.ffa68cp-1f,
+    0x1.ffa6d8p-1f,
+    0x1.ffa724p-1f,
+    0x1.ffa76ep-1f,
+    0x1.ffa7bap-1f,
+    0x1.ffa804p-1f,
+    0x1.ffa85p-1f,
+    0x1.ffa89ap-1f,
+    0x1.ffa8e4p-1f,
+    0x1.ffa93p-1f,
+    0x1.ffa97ap-1f,
+    0x1.ffa9c4p-1f,
+    0x1.ffaa0ep-1f,
+    0x1.ffaa58p-1f,
+    0x1.ffaaap-1f,
+    0x1.ffaaeap-1f,
+    0x1.ffab34p-1f,
+    0x1.ffab7cp-1f,
+    0x1.ffabc6p-1f,
+    0x1.ffac0ep-1f,
+    0x1.ffac58p-1f,
+    0x1.ffacap-1f,
+    0x1.fface8p-1f,
+    0x1.ffad3p-1f,
+    0x1.ffad78p-1f,
+    0x1.ffadcp-1f,
+    0x1.ffae08p-1f,
+    0x1.ffae5p-1f,
+    0x1.ffae98p-1f,
+    0x1.ffaedep-1f,
+    0x1.ffaf26p-1f,
+    0x1.ffaf6cp-1f,
+    0x1.ffafb4p-1f,
+    0x1.ffaffap-1f,
+    0x1.ffb042p-1f,
+    0x1.ffb088p-1f,
+    0x1.ffb0cep-1f,
+    0x1.ffb114p-1f,
+    0x1.ffb15ap-1f,
+    0x1.ffb1ap-1f,
+    0x1.ffb1e6p-1f,
+    0x1.ffb22ap-1f,
+    0x1.ffb27p-1f,
+    0x1.ffb2b6p-1f,
+    0x1.ffb2fap-1f,
+    0x1.ffb34p-1f,
+    0x1.ffb384p-1f,
+    0x1.ffb3c8p-1f,
+    0x1.ffb40ep-1f,
+    0x1.ffb452p-1f,
+    0x1.ffb496p-1f,
+    0x1.ffb4dap-1f,
+    0x1.ffb51ep-1f,
+    0x1.ffb562p-1f,
+    0x1.ffb5a6p-1f,
+    0x1.ffb5e8p-1f,
+    0x1.ffb62cp-1f,
+    0x1.ffb67p-1f,
+    0x1.ffb6b2p-1f,
+    0x1.ffb6f4p-1f,
+    0x1.ffb738p-1f,
+    0x1.ffb77ap-1f,
+    0x1.ffb7bcp-1f,
+    0x1.ffb8p-1f,
+    0x1.ffb842p-1f,
+    0x1.ffb884p-1f,
+    0x1.ffb8c4p-1f,
+    0x1.ffb906p-1f,
+    0x1.ffb948p-1f,
+    0x1.ffb98ap-1f,
+    0x1.ffb9cap-1f,
+    0x1.ffba0cp-1f,
+    0x1.ffba4cp-1f,
+    0x1.ffba8ep-1f,
+    0x1.ffbacep-1f,
+    0x1.ffbb0ep-1f,
+    0x1.ffbb5p-1f,
+    0x1.ffbb9p-1f,
+    0x1.ffbbdp-1f,
+    0x1.ffbc1p-1f,
+    0x1.ffbc5p-1f,
+    0x1.ffbc8ep-1f,
+    0x1.ffbccep-1f,
+    0x1.ffbd0ep-1f,
+    0x1.ffbd4cp-1f,
+    0x1.ffbd8cp-1f,
+    0x1.ffbdcap-1f,
+    0x1.ffbe0ap-1f,
+    0x1.ffbe48p-1f,
+    0x1.ffbe86p-1f,
+    0x1.ffbec6p-1f,
+    0x1.ffbf04p-1f,
+    0x1.ffbf42p-1f,
+    0x1.ffbf8p-1f,
+    0x1.ffbfbcp-1f,
+    0x1.ffbffap-1f,
+    0x1.ffc038p-1f,
+    0x1.ffc076p-1f,
+    0x1.ffc0b2p-1f,
+    0x1.ffc0fp-1f,
+    0x1.ffc12cp-1f,
+    0x1.ffc16ap-1f,
+    0x1.ffc1a6p-1f,
+    0x1.ffc1e2p-1f,
+    0x1.ffc21ep-1f,
+    0x1.ffc25ap-1f,
+    0x1.ffc296p-1f,
+    0x1.ffc2d2p-1f,
+    0x1.ffc30ep-1f,
+    0x1.ffc34ap-1f,
+    0x1.ffc386p-1f,
+    0x1.ffc3c2p-1f,
+    0x1.ffc3fcp-1f,
+    0x1.ffc438p-1f,
+    0x1.ffc472p-1f,
+    0x1.ffc4aep-1f,
+    0x1.ffc4e8p-1f,
+    0x1.ffc522p-1f,
+    0x1.ffc55cp-1f,
+    0x1.ffc596p-1f,
+    0x1.ffc5dp-1f,
+    0x1.ffc60ap-1f,
+    0x1.ffc644p-1f,
+    0x1.ffc67ep-1f,
+    0x1.ffc6b8p-1f,
+    0x1.ffc6f2p-1f,
+    0x1.ffc72ap-1f,
+    0x1.ffc764p-1f,
+    0x1.ffc79cp-1f,
+    0x1.ffc7d6p-1f,
+    0x1.ffc80ep-1f,
+    0x1.ffc846p-1f,
+    0x1.ffc87ep-1f,
+    0x1.ffc8b8p-1f,
+    0x1.ffc8fp-1f,
+    0x1.ffc928p-1f,
+    0x1.ffc96p-1f,
+    0x1.ffc996p-1f,
+    0x1.ffc9cep-1f,
+    0x1.ffca06p-1f,
+    0x1.ffca3ep-1f,
+    0x1.ffca74p-1f,
+    0x1.ffcaacp-1f,
+    0x1.ffcae2p-1f,
+    0x1.ffcb18p-1f,
+    0x1.ffcb5p-1f,
+    0x1.ffcb86p-1f,
+    0x1.ffcbbcp-1f,
+    0x1.ffcbf2p-1f,
+    0x1.ffcc28p-1f,
+    0x1.ffcc5ep-1f,
+    0x1.ffcc94p-1f,
+    0x1.ffcccap-1f,
+    0x1.ffcdp-1f,
+    0x1.ffcd34p-1f,
+    0x1.ffcd6ap-1f,
+    0x1.ffcdap-1f,
+    0x1.ffcdd4p-1f,
+    0x1.ffce08p-1f,
+    0x1.ffce3ep-1f,
+    0x1.ffce72p-1f,
+    0x1.ffcea6p-1f,
+    0x1.ffcedap-1f,
+    0x1.ffcf0ep-1f,
+    0x1.ffcf42p-1f,
+    0x1.ffcf76p-1f,
+    0x1.ffcfaap-1f,
+    0x1.ffcfdep-1f,
+    0x1.ffd012p-1f,
+    0x1.ffd046p-1f,
+    0x1.ffd078p-1f,
+    0x1.ffd0acp-1f,
+    0x1.ffd0dep-1f,
+    0x1.ffd112p-1f,
+    0x1.ffd144p-1f,
+    0x1.ffd176p-1f,
+    0x1.ffd1a8p-1f,
+    0x1.ffd1dcp-1f,
+    0x1.ffd20ep-1f,
+    0x1.ffd24p-1f,
+    0x1.ffd272p-1f,
+    0x1.ffd2a2p-1f,
+    0x1.ffd2d4p-1f,
+    0x1.ffd306p-1f,
+    0x1.ffd338p-1f,
+    0x1.ffd368p-1f,
+    0x1.ffd39ap-1f,
+    0x1.ffd3cap-1f,
+    0x1.ffd3fcp-1f,
+    0x1.ffd42cp-1f,
+    0x1.ffd45cp-1f,
+    0x1.ffd48cp-1f,
+    0x1.ffd4bep-1f,
+    0x1.ffd4eep-1f,
+    0x1.ffd51ep-1f,
+    0x1.ffd54ep-1f,
+    0x1.ffd57ep-1f,
+    0x1.ffd5acp-1f,
+    0x1.ffd5dcp-1f,
+    0x1.ffd60cp-1f,
+    0x1.ffd63ap-1f,
+    0x1.ffd66ap-1f,
+    0x1.ffd69ap-1f,
+    0x1.ffd6c8p-1f,
+    0x1.ffd6f6p-1f,
+    0x1.ffd726p-1f,
+    0x1.ffd754p-1f,
+    0x1.ffd782p-1f,
+    0x1.ffd7bp-1f,
+    0x1.ffd7dep-1f,
+    0x1.ffd80cp-1f,
+    0x1.ffd83ap-1f,
+    0x1.ffd868p-1f,
+    0x1.ffd896p-1f,
+    0x1.ffd8c2p-1f,
+    0x1.ffd8fp-1f,
+    0x1.ffd91ep-1f,
+    0x1.ffd94ap-1f,
+    0x1.ffd978p-1f,
+    0x1.ffd9a4p-1f,
+    0x1.ffd9dp-1f,
+    0x1.ffd9fep-1f,
+    0x1.ffda2ap-1f,
+    0x1.ffda56p-1f,
+    0x1.ffda82p-1f,
+    0x1.ffdaaep-1f,
+    0x1.ffdadap-1f,
+    0x1.ffdb06p-1f,
+    0x1.ffdb32p-1f,
+    0x1.ffdb5ep-1f,
+    0x1.ffdb88p-1f,
+    0x1.ffdbb4p-1f,
+    0x1.ffdbdep-1f,
+    0x1.ffdc0ap-1f,
+    0x1.ffdc34p-1f,
+    0x1.ffdc6p-1f,
+    0x1.ffdc8ap-1f,
+    0x1.ffdcb4p-1f,
+    0x1.ffdcep-1f,
+    0x1.ffdd0ap-1f,
+    0x1.ffdd34p-1f,
+    0x1.ffdd5ep-1f,
+    0x1.ffdd88p-1f,
+    0x1.ffddb2p-1f,
+    0x1.ffdddcp-1f,
+    0x1.ffde04p-1f,
+    0x1.ffde2ep-1f,
+    0x1.ffde58p-1f,
+    0x1.ffde8p-1f,
+    0x1.ffdeaap-1f,
+    0x1.ffded2p-1f,
+    0x1.ffdefcp-1f,
+    0x1.ffdf24p-1f,
+    0x1.ffdf4cp-1f,
+    0x1.ffdf74p-1f,
+    0x1.ffdf9ep-1f,
+    0x1.ffdfc6p-1f,
+    0x1.ffdfeep-1f,
+    0x1.ffe016p-1f,
+    0x1.ffe03ep-1f,
+    0x1.ffe064p-1f,
+    0x1.ffe08cp-1f,
+    0x1.ffe0b4p-1f,
+    0x1.ffe0dcp-1f,
+    0x1.ffe102p-1f,
+    0x1.ffe12ap-1f,
+    0x1.ffe15p-1f,
+    0x1.ffe178p-1f,
+    0x1.ffe19ep-1f,
+    0x1.ffe1c4p-1f,
+    0x1.ffe1ecp-1f,
+    0x1.ffe212p-1f,
+    0x1.ffe238p-1f,
+    0x1.ffe25ep-1f,
+    0x1.ffe284p-1f,
+    0x1.ffe2aap-1f,
+    0x1.ffe2dp-1f,
+    0x1.ffe2f6p-1f,
+    0x1.ffe31ap-1f,
+    0x1.ffe34p-1f,
+    0x1.ffe366p-1f,
+    0x1.ffe38ap-1f,
+    0x1.ffe3bp-1f,
+    0x1.ffe3d4p-1f,
+    0x1.ffe3fap-1f,
+    0x1.ffe41ep-1f,
+    0x1.ffe442p-1f,
+    0x1.ffe466p-1f,
+    0x1.ffe48cp-1f,
+    0x1.ffe4bp-1f,
+    0x1.ffe4d4p-1f,
+    0x1.ffe4f8p-1f,
+    0x1.ffe51cp-1f,
+    0x1.ffe54p-1f,
+    0x1.ffe562p-1f,
+    0x1.ffe586p-1f,
+    0x1.ffe5aap-1f,
+    0x1.ffe5cep-1f,
+    0x1.ffe5fp-1f,
+    0x1.ffe614p-1f,
+    0x1.ffe636p-1f,
+    0x1.ffe65ap-1f,
+    0x1.ffe67cp-1f,
+    0x1.ffe69ep-1f,
+    0x1.ffe6cp-1f,
+    0x1.ffe6e4p-1f,
+    0x1.ffe706p-1f,
+    0x1.ffe728p-1f,
+    0x1.ffe74ap-1f,
+    0x1.ffe76cp-1f,
+    0x1.ffe78ep-1f,
+    0x1.ffe7aep-1f,
+    0x1.ffe7dp-1f,
+    0x1.ffe7f2p-1f,
+    0x1.ffe814p-1f,
+    0x1.ffe834p-1f,
+    0x1.ffe856p-1f,
+    0x1.ffe876p-1f,
+    0x1.ffe898p-1f,
+    0x1.ffe8b8p-1f,
+    0x1.ffe8d8p-1f,
+    0x1.ffe8fap-1f,
+    0x1.ffe91ap-1f,
+    0x1.ffe93ap-1f,
+    0x1.ffe95ap-1f,
+    0x1.ffe97ap-1f,
+    0x1.ffe99ap-1f,
+    0x1.ffe9bap-1f,
+    0x1.ffe9dap-1f,
+    0x1.ffe9fap-1f,
+    0x1.ffea1ap-1f,
+    0x1.ffea38p-1f,
+    0x1.ffea58p-1f,
+    0x1.ffea78p-1f,
+    0x1.ffea96p-1f,
+    0x1.ffeab6p-1f,
+    0x1.ffead4p-1f,
+    0x1.ffeaf2p-1f,
+    0x1.ffeb12p-1f,
+    0x1.ffeb3p-1f,
+    0x1.ffeb4ep-1f,
+    0x1.ffeb6cp-1f,
+    0x1.ffeb8ap-1f,
+    0x1.ffeba8p-1f,
+    0x1.ffebc6p-1f,
+    0x1.ffebe4p-1f,
+    0x1.ffec02p-1f,
+    0x1.ffec2p-1f,
+    0x1.ffec3ep-1f,
+    0x1.ffec5cp-1f,
+    0x1.ffec78p-1f,
+    0x1.ffec96p-1f,
+    0x1.ffecb2p-1f,
+    0x1.ffecdp-1f,
+    0x1.ffececp-1f,
+    0x1.ffed0ap-1f,
+    0x1.ffed26p-1f,
+    0x1.ffed42p-1f,
+    0x1.ffed6p-1f,
+    0x1.ffed7cp-1f,
+    0x1.ffed98p-1f,
+    0x1.ffedb4p-1f,
+    0x1.ffeddp-1f,
+    0x1.ffedecp-1f,
+    0x1.ffee08p-1f,
+    0x1.ffee24p-1f,
+    0x1.ffee4p-1f,
+    0x1.ffee5ap-1f,
+    0x1.ffee76p-1f,
+    0x1.ffee92p-1f,
+    0x1.ffeeacp-1f,
+    0x1.ffeec8p-1f,
+    0x1.ffeee2p-1f,
+    0x1.ffeefep-1f,
+    0x1.ffef18p-1f,
+    0x1.ffef34p-1f,
+    0x1.ffef4ep-1f,
+    0x1.ffef68p-1f,
+    0x1.ffef82p-1f,
+    0x1.ffef9cp-1f,
+    0x1.ffefb6p-1f,
+    0x1.ffefdp-1f,
+    0x1.ffefeap-1f,
+    0x1.fff004p-1f,
+    0x1.fff01ep-1f,
+    0x1.fff038p-1f,
+    0x1.fff052p-1f,
+    0x1.fff06cp-1f,
+    0x1.fff084p-1f,
+    0x1.fff09ep-1f,
+    0x1.fff0b6p-1f,
+    0x1.fff0dp-1f,
+    0x1.fff0e8p-1f,
+    0x1.fff102p-1f,
+    0x1.fff11ap-1f,
+    0x1.fff134p-1f,
+    0x1.fff14cp-1f,
+    0x1.fff164p-1f,
+    0x1.fff17cp-1f,
+    0x1.fff194p-1f,
+    0x1.fff1acp-1f,
+    0x1.fff1c4p-1f,
+    0x1.fff1dcp-1f,
+    0x1.fff1f4p-1f,
+    0x1.fff20cp-1f,
+    0x1.fff224p-1f,
+    0x1.fff23cp-1f,
+    0x1.fff252p-1f,
+    0x1.fff26ap-1f,
+    0x1.fff282p-1f,
+    0x1.fff298p-1f,
+    0x1.fff2bp-1f,
+    0x1.fff2c6p-1f,
+    0x1.fff2dep-1f,
+    0x1.fff2f4p-1f,
+    0x1.fff30ap-1f,
+    0x1.fff322p-1f,
+    0x1.fff338p-1f,
+    0x1.fff34ep-1f,
+    0x1.fff364p-1f,
+    0x1.fff37ap-1f,
+    0x1.fff39p-1f,
+    0x1.fff3a6p-1f,
+    0x1.fff3bcp-1f,
+    0x1.fff3d2p-1f,
+    0x1.fff3e8p-1f,
+    0x1.fff3fep-1f,
+    0x1.fff412p-1f,
+    0x1.fff428p-1f,
+    0x1.fff43ep-1f,
+    0x1.fff452p-1f,
+    0x1.fff468p-1f,
+    0x1.fff47cp-1f,
+    0x1.fff492p-1f,
+    0x1.fff4a6p-1f,
+    0x1.fff4bcp-1f,
+    0x1.fff4dp-1f,
+    0x1.fff4e4p-1f,
+    0x1.fff4f8p-1f,
+    0x1.fff50ep-1f,
+    0x1.fff522p-1f,
+    0x1.fff536p-1f,
+    0x1.fff54ap-1f,
+    0x1.fff55ep-1f,
+    0x1.fff572p-1f,
+    0x1.fff586p-1f,
+    0x1.fff59ap-1f,
+    0x1.fff5acp-1f,
+    0x1.fff5cp-1f,
+    0x1.fff5d4p-1f,
+    0x1.fff5e8p-1f,
+    0x1.fff5fap-1f,
+    0x1.fff60ep-1f,
+    0x1.fff62p-1f,
+    0x1.fff634p-1f,
+    0x1.fff646p-1f,
+    0x1.fff65ap-1f,
+    0x1.fff66cp-1f,
+    0x1.fff67ep-1f,
+    0x1.fff692p-1f,
+    0x1.fff6a4p-1f,
+    0x1.fff6b6p-1f,
+    0x1.fff6c8p-1f,
+    0x1.fff6dap-1f,
+    0x1.fff6ecp-1f,
+    0x1.fff6fep-1f,
+    0x1.fff71p-1f,
+    0x1.fff722p-1f,
+    0x1.fff734p-1f,
+    0x1.fff746p-1f,
+    0x1.fff758p-1f,
+    0x1.fff768p-1f,
+    0x1.fff77ap-1f,
+    0x1.fff78cp-1f,
+    0x1.fff79cp-1f,
+    0x1.fff7aep-1f,
+    0x1.fff7bep-1f,
+    0x1.fff7dp-1f,
+    0x1.fff7ep-1f,
+    0x1.fff7f2p-1f,
+    0x1.fff802p-1f,
+    0x1.fff812p-1f,
+    0x1.fff824p-1f,
+    0x1.fff834p-1f,
+    0x1.fff844p-1f,
+    0x1.fff854p-1f,
+    0x1.fff864p-1f,
+    0x1.fff874p-1f,
+    0x1.fff884p-1f,
+    0x1.fff894p-1f,
+    0x1.fff8a4p-1f,
+    0x1.fff8b4p-1f,
+    0x1.fff8c4p-1f,
+    0x1.fff8d4p-1f,
+    0x1.fff8e2p-1f,
+    0x1.fff8f2p-1f,
+    0x1.fff902p-1f,
+    0x1.fff91p-1f,
+    0x1.fff92p-1f,
+    0x1.fff92ep-1f,
+    0x1.fff93ep-1f,
+    0x1.fff94cp-1f,
+    0x1.fff95cp-1f,
+    0x1.fff96ap-1f,
+    0x1.fff97ap-1f,
+    0x1.fff988p-1f,
+    0x1.fff996p-1f,
+    0x1.fff9a4p-1f,
+    0x1.fff9b4p-1f,
+    0x1.fff9c2p-1f,
+    0x1.fff9dp-1f,
+    0x1.fff9dep-1f,
+    0x1.fff9ecp-1f,
+    0x1.fff9fap-1f,
+    0x1.fffa08p-1f,
+    0x1.fffa16p-1f,
+    0x1.fffa24p-1f,
+    0x1.fffa3p-1f,
+    0x1.fffa3ep-1f,
+    0x1.fffa4cp-1f,
+    0x1.fffa5ap-1f,
+    0x1.fffa66p-1f,
+    0x1.fffa74p-1f,
+    0x1.fffa8p-1f,
+    0x1.fffa8ep-1f,
+    0x1.fffa9cp-1f,
+    0x1.fffaa8p-1f,
+    0x1.fffab4p-1f,
+    0x1.fffac2p-1f,
+    0x1.fffacep-1f,
+    0x1.fffadap-1f,
+    0x1.fffae8p-1f,
+    0x1.fffaf4p-1f,
+    0x1.fffbp-1f,
+    0x1.fffb0cp-1f,
+    0x1.fffb18p-1f,
+    0x1.fffb26p-1f,
+    0x1.fffb32p-1f,
+    0x1.fffb3ep-1f,
+    0x1.fffb4ap-1f,
+    0x1.fffb56p-1f,
+    0x1.fffb6p-1f,
+    0x1.fffb6cp-1f,
+    0x1.fffb78p-1f,
+    0x1.fffb84p-1f,
+    0x1.fffb9p-1f,
+    0x1.fffb9ap-1f,
+    0x1.fffba6p-1f,
+    0x1.fffbb2p-1f,
+    0x1.fffbbcp-1f,
+    0x1.fffbc8p-1f,
+    0x1.fffbd4p-1f,
+    0x1.fffbdep-1f,
+    0x1.fffbe8p-1f,
+    0x1.fffbf4p-1f,
+    0x1.fffbfep-1f,
+    0x1.fffc0ap-1f,
+    0x1.fffc14p-1f,
+    0x1.fffc1ep-1f,
+    0x1.fffc2ap-1f,
+    0x1.fffc34p-1f,
+    0x1.fffc3ep-1f,
+    0x1.fffc48p-1f,
+    0x1.fffc52p-1f,
+    0x1.fffc5cp-1f,
+    0x1.fffc66p-1f,
+    0x1.fffc7p-1f,
+    0x1.fffc7ap-1f,
+    0x1.fffc84p-1f,
+    0x1.fffc8ep-1f,
+    0x1.fffc98p-1f,
+    0x1.fffca2p-1f,
+    0x1.fffcacp-1f,
+    0x1.fffcb4p-1f,
+    0x1.fffcbep-1f,
+    0x1.fffcc8p-1f,
+    0x1.fffcd2p-1f,
+    0x1.fffcdap-1f,
+    0x1.fffce4p-1f,
+    0x1.fffcecp-1f,
+    0x1.fffcf6p-1f,
+    0x1.fffcfep-1f,
+    0x1.fffd08p-1f,
+    0x1.fffd1p-1f,
+    0x1.fffd1ap-1f,
+    0x1.fffd22p-1f,
+    0x1.fffd2ap-1f,
+    0x1.fffd34p-1f,
+    0x1.fffd3cp-1f,
+    0x1.fffd44p-1f,
+    0x1.fffd4ep-1f,
+    0x1.fffd56p-1f,
+    0x1.fffd5ep-1f,
+    0x1.fffd66p-1f,
+    0x1.fffd6ep-1f,
+    0x1.fffd76p-1f,
+    0x1.fffd7ep-1f,
+    0x1.fffd86p-1f,
+    0x1.fffd8ep-1f,
+    0x1.fffd96p-1f,
+    0x1.fffd9ep-1f,
+    0x1.fffda6p-1f,
+    0x1.fffdaep-1f,
+    0x1.fffdb4p-1f,
+    0x1.fffdbcp-1f,
+    0x1.fffdc4p-1f,
+    0x1.fffdccp-1f,
+    0x1.fffdd2p-1f,
+    0x1.fffddap-1f,
+    0x1.fffde2p-1f,
+    0x1.fffde8p-1f,
+    0x1.fffdfp-1f,
+    0x1.fffdf6p-1f,
+    0x1.fffdfep-1f,
+    0x1.fffe04p-1f,
+    0x1.fffe0cp-1f,
+    0x1.fffe12p-1f,
+    0x1.fffe1ap-1f,
+    0x1.fffe2p-1f,
+    0x1.fffe26p-1f,
+    0x1.fffe2ep-1f,
+    0x1.fffe34p-1f,
+    0x1.fffe3ap-1f,
+    0x1.fffe4p-1f,
+    0x1.fffe46p-1f,
+    0x1.fffe4ep-1f,
+    0x1.fffe54p-1f,
+    0x1.fffe5ap-1f,
+    0x1.fffe6p-1f,
+    0x1.fffe66p-1f,
+    0x1.fffe6cp-1f,
+    0x1.fffe72p-1f,
+    0x1.fffe78p-1f,
+    0x1.fffe7ep-1f,
+    0x1.fffe84p-1f,
+    0x1.fffe8ap-1f,
+    0x1.fffe9p-1f,
+    0x1.fffe94p-1f,
+    0x1.fffe9ap-1f,
+    0x1.fffeap-1f,
+    0x1.fffea6p-1f,
+    0x1.fffeaap-1f,
+    0x1.fffebp-1f,
+    0x1.fffeb6p-1f,
+    0x1.fffebap-1f,
+    0x1.fffecp-1f,
+    0x1.fffec6p-1f,
+    0x1.fffecap-1f,
+    0x1.fffedp-1f,
+    0x1.fffed4p-1f,
+    0x1.fffedap-1f,
+    0x1.fffedep-1f,
+    0x1.fffee4p-1f,
+    0x1.fffee8p-1f,
+    0x1.fffeecp-1f,
+    0x1.fffef2p-1f,
+    0x1.fffef6p-1f,
+    0x1.fffefap-1f,
+    0x1.ffffp-1f,
+    0x1.ffff04p-1f,
+    0x1.ffff08p-1f,
+    0x1.ffff0cp-1f,
+    0x1.ffff12p-1f,
+    0x1.ffff16p-1f,
+    0x1.ffff1ap-1f,
+    0x1.ffff1ep-1f,
+    0x1.ffff22p-1f,
+    0x1.ffff26p-1f,
+    0x1.ffff2ap-1f,
+    0x1.ffff2ep-1f,
+    0x1.ffff32p-1f,
+    0x1.ffff36p-1f,
+    0x1.ffff3ap-1f,
+    0x1.ffff3ep-1f,
+    0x1.ffff42p-1f,
+    0x1.ffff46p-1f,
+    0x1.ffff4ap-1f,
+    0x1.ffff4ep-1f,
+    0x1.ffff52p-1f,
+    0x1.ffff54p-1f,
+    0x1.ffff58p-1f,
+    0x1.ffff5cp-1f,
+    0x1.ffff6p-1f,
+    0x1.ffff62p-1f,
+    0x1.ffff66p-1f,
+    0x1.ffff6ap-1f,
+    0x1.ffff6cp-1f,
+    0x1.ffff7p-1f,
+    0x1.ffff74p-1f,
+    0x1.ffff76p-1f,
+    0x1.ffff7ap-1f,
+    0x1.ffff7cp-1f,
+    0x1.ffff8p-1f,
+    0x1.ffff82p-1f,
+    0x1.ffff86p-1f,
+    0x1.ffff88p-1f,
+    0x1.ffff8cp-1f,
+    0x1.ffff8ep-1f,
+    0x1.ffff92p-1f,
+    0x1.ffff94p-1f,
+    0x1.ffff96p-1f,
+    0x1.ffff9ap-1f,
+    0x1.ffff9cp-1f,
+    0x1.ffff9ep-1f,
+    0x1.ffffa2p-1f,
+    0x1.ffffa4p-1f,
+    0x1.ffffa6p-1f,
+    0x1.ffffa8p-1f,
+    0x1.ffffacp-1f,
+    0x1.ffffaep-1f,
+    0x1.ffffbp-1f,
+    0x1.ffffb2p-1f,
+    0x1.ffffb4p-1f,
+    0x1.ffffb6p-1f,
+    0x1.ffffb8p-1f,
+    0x1.ffffbcp-1f,
+    0x1.ffffbep-1f,
+    0x1.ffffcp-1f,
+    0x1.ffffc2p-1f,
+    0x1.ffffc4p-1f,
+    0x1.ffffc6p-1f,
+    0x1.ffffc8p-1f,
+    0x1.ffffcap-1f,
+    0x1.ffffccp-1f,
+    0x1.ffffcep-1f,
+    0x1.ffffcep-1f,
+    0x1.ffffdp-1f,
+    0x1.ffffd2p-1f,
+    0x1.ffffd4p-1f,
+    0x1.ffffd6p-1f,
+    0x1.ffffd8p-1f,
+    0x1.ffffdap-1f,
+    0x1.ffffdap-1f,
+    0x1.ffffdcp-1f,
+    0x1.ffffdep-1f,
+    0x1.ffffep-1f,
+    0x1.ffffep-1f,
+    0x1.ffffe2p-1f,
+    0x1.ffffe4p-1f,
+    0x1.ffffe6p-1f,
+    0x1.ffffe6p-1f,
+    0x1.ffffe8p-1f,
+    0x1.ffffeap-1f,
+    0x1.ffffeap-1f,
+    0x1.ffffecp-1f,
+    0x1.ffffecp-1f,
+    0x1.ffffeep-1f,
+    0x1.fffffp-1f,
+    0x1.fffffp-1f,
+    0x1.fffff2p-1f,
+    0x1.fffff2p-1f,
+    0x1.fffff4p-1f,
+    0x1.fffff4p-1f,
+    0x1.fffff6p-1f,
+    0x1.fffff6p-1f,
+    0x1.fffff8p-1f,
+    0x1.fffff8p-1f,
+    0x1.fffffap-1f,
+    0x1.fffffap-1f,
+    0x1.fffffcp-1f,
+    0x1.fffffcp-1f,
+    0x1.fffffcp-1f,
+    0x1.fffffep-1f,
+    0x1.fffffep-1f,
+    0x1p+0f,
+    0x1p+0f,
+    0x1p+0f,
+    0x1p+0f,
+    0x1p+0f,
+    0x1p+0f,
+    0x1p+0f,
+};
+
+extern const double f1[8192] = {
+    0x0p+0,
+    -0x1.b9a7663b31d99p-11,
+    -0x1.b9a7663b31d99p-10,
+    -0x1.4b3d8cac65633p-9,
+    -0x1.b9a7663b31d99p-9,
+    -0x1.14089fe4ff28p-8,
+    -0x1.4b3d8cac65633p-8,
+    -0x1.82727973cb9e6p-8,
+    -0x1.b9a7663b31d99p-8,
+    -0x1.f0dc53029814cp-8,
+    -0x1.14089fe4ff28p-7,
+    -0x1.2fa31648b245ap-7,
+    -0x1.4b3d8cac65634p-7,
+    -0x1.66d803101880ep-7,
+    -0x1.82727973cb9e8p-7,
+    -0x1.9e0cefd77ebc2p-7,
+    -0x1.b9a7663b31d9cp-7,
+    -0x1.d541dc9ee4f76p-7,
+    -0x1.f0dc53029815p-7,
+    -0x1.063b64b325995p-6,
+    -0x1.14089fe4ff282p-6,
+    -0x1.21d5db16d8b6fp-6,
+    -0x1.2fa31648b245cp-6,
+    -0x1.3d70517a8bd49p-6,
+    -0x1.4b3d8cac65636p-6,
+    -0x1.590ac7de3ef23p-6,
+    -0x1.66d803101881p-6,
+    -0x1.74a53e41f20fdp-6,
+    -0x1.82727973cb9eap-6,
+    -0x1.903fb4a5a52d7p-6,
+    -0x1.9e0cefd77ebc4p-6,
+    -0x1.abda2b09584b1p-6,
+    -0x1.b9a7663b31d9ep-6,
+    -0x1.c774a16d0b68bp-6,
+    -0x1.d541dc9ee4f78p-6,
+    -0x1.e30f17d0be865p-6,
+    -0x1.f0dc530298152p-6,
+    -0x1.fea98e3471a3fp-6,
+    -0x1.063b64b325996p-5,
+    -0x1.0d22024c1260cp-5,
+    -0x1.14089fe4ff282p-5,
+    -0x1.1aef3d7debef8p-5,
+    -0x1.21d5db16d8b6ep-5,
+    -0x1.28bc78afc57e4p-5,
+    -0x1.2fa31648b245ap-5,
+    -0x1.3689b3e19f0dp-5,
+    -0x1.3d70517a8bd46p-5,
+    -0x1.4456ef13789bcp-5,
+    -0x1.4b3d8cac65632p-5,
+    -0x1.52242a45522a8p-5,
+    -0x1.590ac7de3ef1ep-5,
+    -0x1.5ff165772bb94p-5,
+    -0x1.66d803101880ap-5,
+    -0x1.6dbea0a90548p-5,
+    -0x1.74a53e41f20f6p-5,
+    -0x1.7b8bdbdaded6cp-5,
+    -0x1.82727973cb9e2p-5,
+    -0x1.8959170cb8658p-5,
+    -0x1.903fb4a5a52cep-5,
+    -0x1.9726523e91f44p-5,
+    -0x1.9e0cefd77ebbap-5,
+    -0x1.a4f38d706b83p-5,
+    -0x1.abda2b09584a6p-5,
+    -0x1.b2c0c8a24511cp-5,
+    -0x1.b9a7663b31d92p-5,
+    -0x1.c08e03d41ea08p-5,
+    -0x1.c774a16d0b67ep-5,
+    -0x1.ce5b3f05f82f4p-5,
+    -0x1.d541dc9ee4f6ap-5,
+    -0x1.dc287a37d1bep-5,
+    -0x1.e30f17d0be856p-5,
+    -0x1.e9f5b569ab4ccp-5,
+    -0x1.f0dc530298142p-5,
+    -0x1.f7c2f09b84db8p-5,
+    -0x1.fea98e3471a2ep-5,
+    -0x1.02c815e6af352p-4,
+    -0x1.063b64b32598dp-4,
+    -0x1.09aeb37f9bfc8p-4,
+    -0x1.0d22024c12603p-4,
+    -0x1.1095511888c3ep-4,
+    -0x1.14089fe4ff279p-4,
+    -0x1.177beeb1758b4p-4,
+    -0x1.1aef3d7debeefp-4,
+    -0x1.1e628c4a6252ap-4,
+    -0x1.21d5db16d8b65p-4,
+    -0x1.254929e34f1ap-4,
+    -0x1.28bc78afc57dbp-4,
+    -0x1.2c2fc77c3be16p-4,
+    -0x1.2fa31648b2451p-4,
+    -0x1.3316651528a8cp-4,
+    -0x1.3689b3e19f0c7p-4,
+    -0x1.39fd02ae15702p-4,
+    -0x1.3d70517a8bd3dp-4,
+    -0x1.40e3a04702378p-4,
+    -0x1.4456ef13789b3p-4,
+    -0x1.47ca3ddfeefeep-4,
+    -0x1.4b3d8cac65629p-4,
+    -0x1.4eb0db78dbc64p-4,
+    -0x1.52242a455229fp-4,
+    -0x1.55977911c88dap-4,
+    -0x1.590ac7de3ef15p-4,
+    -0x1.5c7e16aab555p-4,
+    -0x1.5ff165772bb8bp-4,
+    -0x1.6364b443a21c6p-4,
+    -0x1.66d8031018801p-4,
+    -0x1.6a4b51dc8ee3cp-4,
+    -0x1.6dbea0a905477p-4,
+    -0x1.7131ef757bab2p-4,
+    -0x1.74a53e41f20edp-4,
+    -0x1.78188d0e68728p-4,
+    -0x1.7b8bdbdaded63p-4,
+    -0x1.7eff2aa75539ep-4,
+    -0x1.82727973cb9d9p-4,
+    -0x1.85e5c84042014p-4,
+    -0x1.8959170cb864fp-4,
+    -0x1.8ccc65d92ec8ap-4,
+    -0x1.903fb4a5a52c5p-4,
+    -0x1.93b303721b9p-4,
+    -0x1.9726523e91f3bp-4,
+    -0x1.9a99a10b08576p-4,
+    -0x1.9e0cefd77ebb1p-4,
+    -0x1.a1803ea3f51ecp-4,
+    -0x1.a4f38d706b827p-4,
+    -0x1.a866dc3ce1e62p-4,
+    -0x1.abda2b095849dp-4,
+    -0x1.af4d79d5cead8p-4,
+    -0x1.b2c0c8a245113p-4,
+    -0x1.b634176ebb74ep-4,
+    -0x1.b9a7663b31d89p-4,
+    -0x1.bd1ab507a83c4p-4,
+    -0x1.c08e03d41e9ffp-4,
+    -0x1.c40152a09503ap-4,
+    -0x1.c774a16d0b675p-4,
+    -0x1.cae7f0329b2d7p-4,
+    -0x1.ce5b3eea5db86p-4,
+    -0x1.d1ce8d89f91bbp-4,
+    -0x1.d541dc002ccd7p-4,
+    -0x1.d8b52a3f2b926p-4,
+    -0x1.dc287839282f6p-4,
+    -0x1.df9bc5e3c8b8p-4,
+    -0x1.e30f1334b33fep-4,
+    -0x1.e682601e1a8bcp-4,
+    -0x1.e9f5ac9231608p-4,
+    -0x1.ed68f8832a82ep-4,
+    -0x1.f0dc43dfc568fp-4,
+    -0x1.f44f8e9da8264p-4,
+    -0x1.f7c2d8b278ce7p-4,
+    -0x1.fb3622106a264p-4,
+    -0x1.fea96aa9aef29p-4,
+    -0x1.010e59368354bp-3,
+    -0x1.02c7fca65207cp-3,
+    -0x1.04819f9d5cf4dp-3,
+    -0x1.063b42167725cp-3,
+    -0x1.07f4e40c73a45p-3,
+    -0x1.09ae85786bd2fp-3,
+    -0x1.0b6826537914p-3,
+    -0x1.0d21c6986e716p-3,
+    -0x1.0edb663eaba6p-3,
+    -0x1.1095053f4a144p-3,
+    -0x1.124ea393631e9p-3,
+    -0x1.14084135c9cecp-3,
+    -0x1.15c1de21512eap-3,
+    -0x1.177b7a4b9f51cp-3,
+    -0x1.193515adcd9a9p-3,
+    -0x1.1aeeb042af12ep-3,
+    -0x1.1ca84a035d1d1p-3,
+    -0x1.1e61e2e8f11b8p-3,
+    -0x1.201b7aeff7bf7p-3,
+    -0x1.21d512118a6b4p-3,
+    -0x1.238ea846c2816p-3,
+    -0x1.25483d86ffbcdp-3,
+    -0x1.2701d1cb5b7ffp-3,
+    -0x1.28bb650ea8d49p-3,
+    -0x1.2a74f7468dce5p-3,
+    -0x1.2c2e886f971e5p-3,
+    -0x1.2de8188497ce7p-3,
+    -0x1.2fa1a77cef99bp-3,
+    -0x1.315b3551b7e27p-3,
+    -0x1.3314c1fc0a0b2p-3,
+    -0x1.34ce4d74ff762p-3,
+    -0x1.3687d7b5b185dp-3,
+    -0x1.384160baaceb7p-3,
+    -0x1.39fae87b5162p-3,
+    -0x1.3bb46ef0b84bep-3,
+    -0x1.3d6df413fb0b8p-3,
+    -0x1.3f2777dc795bdp-3,
+    -0x1.40e0fa450646bp-3,
+    -0x1.429a7b4874d5ep-3,
+    -0x1.4453fae198133p-3,
+    -0x1.460d790616124p-3,
+    -0x1.47c6f5ad4e8e1p-3,
+    -0x1.498070d3ce37dp-3,
+    -0x1.4b39ea7621c0cp-3,
+    -0x1.4cf36289ef3c7p-3,
+    -0x1.4eacd908500d4p-3,
+    -0x1.50664dec173d1p-3,
+    -0x1.521fc12aeadf7p-3,
+    -0x1.53d932bf9dfe2p-3,
+    -0x1.5592a2a503a3p-3,
+    -0x1.574c10d435307p-3,
+    -0x1.59057d464c08ep-3,
+    -0x1.5abee7f4618ebp-3,
+    -0x1.5c7850d5d57cep-3,
+    -0x1.5e31b7e57add4p-3,
+    -0x1.5feb1d1fde61p-3,
+    -0x1.61a4807c5fc32p-3,
+    -0x1.635de1f25ebeap-3,
+    -0x1.6517417af4b5ep-3,
+    -0x1.66d09f0f3b0b6p-3,
+    -0x1.6889faa84b217p-3,
+    -0x1.6a435440f801ep-3,
+    -0x1.6bfcabd414b69p-3,
+    -0x1.6db6015abaa1dp-3,
+    -0x1.6f6f54ca8fd74p-3,
+    -0x1.7128a61e6760cp-3,
+    -0x1.72e1f5511448p-3,
+    -0x1.749b42583ca0bp-3,
+    -0x1.76548d306d1cp-3,
+    -0x1.780dd5d478c3cp-3,
+    -0x1.79c71c3bbf52ep-3,
+    -0x1.7b80605be6dd1p-3,
+    -0x1.7d39a22fc26c1p-3,
+    -0x1.7ef2e1b3deb11p-3,
+    -0x1.80ac1edde1bfbp-3,
+    -0x1.826559a89ea1cp-3,
+    -0x1.841e920ee8611p-3,
+    -0x1.85d7c80665113p-3,
+    -0x1.8790fb882e149p-3,
+    -0x1.894a2c8f1675p-3,
+    -0x1.8b035b15f13c4p-3,
+    -0x1.8cbc8715d7cccp-3,
+    -0x1.8e75b087e388fp-3,
+    -0x1.902ed763742bcp-3,
+    -0x1.91e7fba1a317ap-3,
+    -0x1.93a11d3d43566p-3,
+    -0x1.955a3c2db4a3p-3,
+    -0x1.9713586c105fep-3,
+    -0x1.98cc71f16fef6p-3,
+    -0x1.9a8588b8a65b6p-3,
+    -0x1.9c3e9cbc86adap-3,
+    -0x1.9df7adf62a489p-3,
+    -0x1.9fb0bc5b373fcp-3,
+    -0x1.a169c7e6809d1p-3,
+    -0x1.a322d092d96a4p-3,
+    -0x1.a4dbd655e7bafp-3,
+    -0x1.a694d928c4f18p-3,
+    -0x1.a84dd9064417cp-3,
+    -0x1.aa06d5e77e901p-3,
+    -0x1.abbfcfc58dbcep-3,
+    -0x1.ad78c69cfe4f6p-3,
+    -0x1.af31ba63765b3p-3,
+    -0x1.b0eaab0e9bf3fp-3,
+    -0x1.b2a3989cb5723p-3,
+    -0x1.b45c8306dc385p-3,
+    -0x1.b6156a4470016p-3,
+    -0x1.b7ce4e5043d72p-3,
+    -0x1.b9872f23711cp-3,
+    -0x1.bb400cb39de3ap-3,
+    -0x1.bcf8e6fb9d37cp-3,
+    -0x1.beb1bdf4887adp-3,
+    -0x1.c06a9197790f3p-3,
+    -0x1.c22361e0fba61p-3,
+    -0x1.c3dc2ec6b6531p-3,
+    -0x1.c594f841c278ap-3,
+    -0x1.c74dbe4cf3208p-3,
+    -0x1.c90680ddee5e5p-3,
+    -0x1.cabf3fef873bep-3,
+    -0x1.cc77fb800411dp-3,
+    -0x1.ce30b3850af3bp-3,
+    -0x1.cfe967f441f52p-3,
+    -0x1.d1a218c87c1fep-3,
+    -0x1.d35ac5fad2d66p-3,
+    -0x1.d5136f845f7b1p-3,
+    -0x1.d6cc1561aebf2p-3,
+    -0x1.d884b78866b62p-3,
+    -0x1.da3d55f1a0c28p-3,
+    -0x1.dbf5f0982fee1p-3,
+    -0x1.ddae8771ba4c6p-3,
+    -0x1.df671a7912e74p-3,
+    -0x1.e11fa9a90cc88p-3,
+    -0x1.e2d834fac1529p-3,
+    -0x1.e490bc6749e7dp-3,
+    -0x1.e6493fe606433p-3,
+    -0x1.e801bf700fc73p-3,
+    -0x1.e9ba3afe7fd63p-3,
+    -0x1.eb72b28a6fd29p-3,
+    -0x1.ed2b260cf91ecp-3,
+    -0x1.eee3957f351d2p-3,
+    -0x1.f09c00dbf6d78p-3,
+    -0x1.f254681c57b04p-3,
+    -0x1.f40ccb37b7627p-3,
+    -0x1.f5c52a28e8f7dp-3,
+    -0x1.f77d84e905d2dp-3,
+    -0x1.f935db6db407p-3,
+    -0x1.faee2db1c69e4p-3,
+    -0x1.fca67bae56faep-3,
+    -0x1.fe5ec55ac4d7fp-3,
+    -0x1.000b8558f19fap-2,
+    -0x1.00e7a5d588f5ep-2,
+    -0x1.01c3c42091f3ap-2,
+    -0x1.029fe037761ddp-2,
+    -0x1.037bfa15e551fp-2,
+    -0x1.045811b86c413p-2,
+    -0x1.05342719ddf55p-2,
+    -0x1.06103a37a3f34p-2,
+    -0x1.06ec4b100493ap-2,
+    -0x1.07c8599eafb3fp-2,
+    -0x1.08a465df5531bp-2,
+    -0x1.09806fce81be1p-2,
+    -0x1.0a5c7768c20a4p-2,
+    -0x1.0b387cab7f9b3p-2,
+    -0x1.0c147f926a4e5p-2,
+    -0x1.0cf0801a0ed4ep-2,
+    -0x1.0dcc7e3ef9e01p-2,
+    -0x1.0ea879fcdb4d7p-2,
+    -0x1.0f8473511ca1dp-2,
+    -0x1.10606a384a8e7p-2,
+    -0x1.113c5eaef1c48p-2,
+    -0x1.121850b27bc8ep-2,
+    -0x1.12f4403e98792p-2,
+    -0x1.13d02d4e1adfp-2,
+    -0x1.14ac17df49532p-2,
+    -0x1.1587ffef8d5a6p-2,
+    -0x1.1663e578dd2aep-2,
+    -0x1.173fc877c575ep-2,
+    -0x1.181ba8eb6967ap-2,
+    -0x1.18f786ce9c09ep-2,
+    -0x1.19d3621c30668p-2,
+    -0x1.1aaf3ad349a9cp-2,
+    -0x1.1b8b10f151589p-2,
+    -0x1.1c66e4703da91p-2,
+    -0x1.1d42b54c9b4c7p-2,
+    -0x1.1e1e8384b09b4p-2,
+    -0x1.1efa4f13509f5p-2,
+    -0x1.1fd617f42b362p-2,
+    -0x1.20b1de24a9e4ap-2,
+    -0x1.218da1a1595cp-2,
+    -0x1.22696267a3212p-2,
+    -0x1.2345207413e53p-2,
+    -0x1.2420dbc17eb21p-2,
+    -0x1.24fc944c7038ep-2,
+    -0x1.25d84a132ed24p-2,
+    -0x1.26b3fd12472f7p-2,
+    -0x1.278fad45692dep-2,
+    -0x1.286b5aa767d76p-2,
+    -0x1.29470535acb0ep-2,
+    -0x1.2a22aceda13f4p-2,
+    -0x1.2afe51ca188c5p-2,
+    -0x1.2bd9f3c79f494p-2,
+    -0x1.2cb592e39efafp-2,
+    -0x1.2d912f1aa452ap-2,
+    -0x1.2e6cc8693c018p-2,
+    -0x1.2f485ecbf2b8cp-2,
+    -0x1.3023f23e7855ep-2,
+    -0x1.30ff82bc7cb67p-2,
+    -0x1.31db1043695f4p-2,
+    -0x1.32b69ad0a7d54p-2,
+    -0x1.3392225fe7f5fp-2,
+    -0x1.346da6ecd99eep-2,
+    -0x1.35492874e654ep-2,
+    -0x1.3624a6f5779cep-2,
+    -0x1.3700226a3d546p-2,
+    -0x1.37db9acee758ep-2,
+    -0x1.38b7101f2587ep-2,
+    -0x1.3992825861664p-2,
+    -0x1.3a6df17727a54p-2,
+    -0x1.3b495d7728226p-2,
+    -0x1.3c24c654ef8edp-2,
+    -0x1.3d002c0de76f7p-2,
+    -0x1.3ddb8e9e9c758p-2,
+    -0x1.3eb6ee01e1aacp-2,
+    -0x1.3f924a3443c07p-2,
+    -0x1.406da334090f2p-2,
+    -0x1.4148f8fdbe48p-2,
+    -0x1.42244b8b59a13p-2,
+    -0x1.42ff9ad967cbfp-2,
+    -0x1.43dae6e70bf48p-2,
+    -0x1.44b62faff5f86p-2,
+    -0x1.4591752ef8e16p-2,
+    -0x1.466cb760a160bp-2,
+    -0x1.4747f64258fb3p-2,
+    -0x1.482331cfcf8e7p-2,
+    -0x1.48fe6a0591cbap-2,
+    -0x1.49d99ee02c63fp-2,
+    -0x1.4ab4d05b4f34ep-2,
+    -0x1.4b8ffe7463c35p-2,
+    -0x1.4c6b2927f6c08p-2,
+    -0x1.4d46507294ddap-2,
+    -0x1.4e21744fedf83p-2,
+    -0x1.4efc94bbb1edbp-2,
+    -0x1.4fd7b1b26d6f5p-2,
+    -0x1.50b2cb30ad2e5p-2,
+    -0x1.518de133daaf9p-2,
+    -0x1.5268f3b95f77fp-2,
+    -0x1.534402bc0e914p-2,
+    -0x1.541f0e3797d9p-2,
+    -0x1.54fa162964d42p-2,
+    -0x1.55d51a8e0233cp-2,
+    -0x1.56b01b61fca92p-2,
+    -0x1.578b18a10411cp-2,
+    -0x1.58661245eb777p-2,
+    -0x1.5941084ef932dp-2,
+    -0x1.5a1bfab8b9f5p-2,
+    -0x1.5af6e97e00c7ep-2,
+    -0x1.5bd1d49d1404p-2,
+    -0x1.5cacbc11a386ep-2,
+    -0x1.5d879fd75f2ep-2,
+    -0x1.5e627febb07e5p-2,
+    -0x1.5f3d5c4a47554p-2,
+    -0x1.601834f08d37cp-2,
+    -0x1.60f309da32035p-2,
+    -0x1.61cddb03c2693p-2,
+    -0x1.62a8a86aa7ee3p-2,
+    -0x1.63837209b59c3p-2,
+    -0x1.645e37dd78246p-2,
+    -0x1.6538f9e19f643p-2,
+    -0x1.6613b811db393p-2,
+    -0x1.66ee726b95284p-2,
+    -0x1.67c928ed138ap-2,
+    -0x1.68a3db9129684p-2,
+    -0x1.697e8a5386a08p-2,
+    -0x1.6a593530b7e3fp-2,
+    -0x1.6b33dc2626b77p-2,
+    -0x1.6c0e7f313c9ffp-2,
+    -0x1.6ce91e4ccca73p-2,
+    -0x1.6dc3b973a9d7p-2,
+    -0x1.6e9e50a33db45p-2,
+    -0x1.6f78e3d8f1c41p-2,
+    -0x1.7053730f991p-2,
+    -0x1.712dfe449d1dp-2,
+    -0x1.720885748a9c5p-2,
+    -0x1.72e3089a3497bp-2,
+    -0x1.73bd87b3e167cp-2,
+    -0x1.749802be1dbdcp-2,
+    -0x1.757279b3bca37p-2,
+    -0x1.764cec906df65p-2,
+    -0x1.77275b50be67ap-2,
+    -0x1.7801c5f2177c3p-2,
+    -0x1.78dc2c7029119p-2,
+    -0x1.79b68ec939806p-2,
+    -0x1.7a90ecf81bd26p-2,
+    -0x1.7b6b46f87fe51p-2,
+    -0x1.7c459cc7cf3d6p-2,
+    -0x1.7d1fee60dce52p-2,
+    -0x1.7dfa3bc112613p-2,
+    -0x1.7ed484e4fc62cp-2,
+    -0x1.7faec9c9279b1p-2,
+    -0x1.80890a6943e79p-2,
+    -0x1.816346c10125cp-2,
+    -0x1.823d7ecdc8da9p-2,
+    -0x1.8317b28c27b74p-2,
+    -0x1.83f1e1f8aa6cfp-2,
+    -0x1.84cc0d0f00d92p-2,
+    -0x1.85a633cadad96p-2,
+    -0x1.86805628c51edp-2,
+    -0x1.875a74254c5abp-2,
+    -0x1.88348dbc206a8p-2,
+    -0x1.890ea2eaaad32p-2,
+    -0x1.89e8b3ad7845dp-2,
+    -0x1.8ac2bfff5bcc5p-2,
+    -0x1.8b9cc7ddbeeb9p-2,
+    -0x1.8c76cb4451811p-2,
+    -0x1.8d50ca2de6969p-2,
+    -0x1.8e2ac497e7b1p-2,
+    -0x1.8f04ba7fbe555p-2,
+    -0x1.8fdeabe1f734bp-2,
+    -0x1.90b898bb1f005p-2,
+    -0x1.91928106e595ap-2,
+    -0x1.926c64c01dfe8p-2,
+    -0x1.934643e431bfdp-2,
+    -0x1.94201e708a5e8p-2,
+    -0x1.94f9f45ffae45p-2,
+    -0x1.95d3c5ae332edp-2,
+    -0x1.96ad9257bfef2p-2,
+    -0x1.97875a592dd68p-2,
+    -0x1.98611dafe669ep-2,
+    -0x1.993adc579986bp-2,
+    -0x1.9a14964b1a36cp-2,
+    -0x1.9aee4b87d1ffp-2,
+    -0x1.9bc7fc0b2a645p-2,
+    -0x1.9ca1a7cff6708p-2,
+    -0x1.9d7b4ed2c2d4cp-2,
+    -0x1.9e54f110f915fp-2,
+    -0x1.9f2e8e864911ap-2,
+    -0x1.a008272d85d19p-2,
+    -0x1.a0e1bb033c06fp-2,
+    -0x1.a1bb4a04d536bp-2,
+    -0x1.a294d42e013e5p-2,
+    -0x1.a36e597b4ccf1p-2,
+    -0x1.a447d9e867c66p-2,
+    -0x1.a5215572bba92p-2,
+    -0x1.a5facc16d5289p-2,
+    -0x1.a6d43dcf874e8p-2,
+    -0x1.a7adaa9a3b9fdp-2,
+    -0x1.a8871272a1fap-2,
+    -0x1.a96075538d66ep-2,
+    -0x1.aa39d3398a97ap-2,
+    -0x1.ab132c2203113p-2,
+    -0x1.abec800a60587p-2,
+    -0x1.acc5ceed75773p-2,
+    -0x1.ad9f18c6f24afp-2,
+    -0x1.ae785d9440589p-2,
+    -0x1.af519d51ec515p-2,
+    -0x1.b02ad7fac93efp-2,
+    -0x1.b1040d8c40a66p-2,
+    -0x1.b1dd3e02df38dp-2,
+    -0x1.b2b669589b2c5p-2,
+    -0x1.b38f8f8ade05dp-2,
+    -0x1.b468b09634769p-2,
+    -0x1.b541cc764e5cp-2,
+    -0x1.b61ae327b8676p-2,
+    -0x1.b6f3f4a7dc1d8p-2,
+    -0x1.b7cd00f18c884p-2,
+    -0x1.b8a608015658dp-2,
+    -0x1.b97f09d57fe7dp-2,
+    -0x1.ba5806672297ap-2,
+    -0x1.bb30fdb2cb197p-2,
+    -0x1.bc09efb5e2f23p-2,
+    -0x1.bce2dc6c19ff5p-2,
+    -0x1.bdbbc3d2d9c5dp-2,
+    -0x1.be94a5e4f54f6p-2,
+    -0x1.bf6d829ef94d5p-2,
+    -0x1.c04659fd7270cp-2,
+    -0x1.c11f2bfc10973p-2,
+    -0x1.c1f7f896839e3p-2,
+    -0x1.c2d0bfca350aap-2,
+    -0x1.c3a98193b18dbp-2,
+    -0x1.c4823dedcc313p-2,
+    -0x1.c55af4d5ee7ap-2,
+    -0x1.c633a647c845ap-2,
+    -0x1.c70c523f0971ap-2,
+    -0x1.c7e4f8b83eaf2p-2,
+    -0x1.c8bd99aff4af6p-2,
+    -0x1.c9963522b8239p-2,
+    -0x1.ca6ecb0c38e93p-2,
+    -0x1.cb475b6826ddcp-2,
+    -0x1.cc1fe633eb863p-2,
+    -0x1.ccf86b6a59ec4p-2,
+    -0x1.cdd0eb07fec13p-2,
+    -0x1.cea9650a4389ep-2,
+    -0x1.cf81d96b1e7c6p-2,
+    -0x1.d05a4827f91dap-2,
+    -0x1.d132b13d601eep-2,
+    -0x1.d20b14a62689ep-2,
+    -0x1.d2e3725fb5e38p-2,
+    -0x1.d3bbca669addp-2,
+    -0x1.d4941cb68553ep-2,
+    -0x1.d56c694b25259p-2,
+    -0x1.d644b02107035p-2,
+    -0x1.d71cf13594721p-2,
+    -0x1.d7f52c83a07b9p-2,
+    -0x1.d8cd6206dafd5p-2,
+    -0x1.d9a591bbd0a89p-2,
+    -0x1.da7dbb9f0e2e8p-2,
+    -0x1.db55dfad20405p-2,
+    -0x1.dc2dfde0d9e7cp-2,
+    -0x1.dd061636c7d61p-2,
+    -0x1.ddde28ac53903p-2,
+    -0x1.deb6353d2cf39p-2,
+    -0x1.df8e3be503ddcp-2,
+    -0x1.e0663ca064ffep-2,
+    -0x1.e13e376bdd0b3p-2,
+    -0x1.e2162c431bdd3p-2,
+    -0x1.e2ee1b21d1536p-2,
+    -0x1.e3c604048a1efp-2,
+    -0x1.e49de6e7d2f12p-2,
+    -0x1.e575c3c75ba76p-2,
+    -0x1.e64d9a9ed41f3p-2,
+    -0x1.e7256b6ac909dp-2,
+    -0x1.e7fd3627c7187p-2,
+    -0x1.e8d4fad17e289p-2,
+    -0x1.e9acb9639e17bp-2,
+    -0x1.ea8471db906abp-2,
+    -0x1.eb5c243504ff1p-2,
+    -0x1.ec33d06babb26p-2,
+    -0x1.ed0b767cee098p-2,
+    -0x1.ede31662c23a8p-2,
+    -0x1.eebab019b4f6ap-2,
+    -0x1.ef92439f2fc2cp-2,
+    -0x1.f069d0ee05a8bp-2,
+    -0x1.f1415803a02d5p-2,
+    -0x1.f218d8dbaf2e3p-2,
+    -0x1.f2f05372bf5c7p-2,
+    -0x1.f3c7c7c48095ap-2,
+    -0x1.f49f35cbc5e38p-2,
+    -0x1.f5769d86d59ebp-2,
+    -0x1.f64dfef15fa4bp-2,
+    -0x1.f7255a0713d3p-2,
+    -0x1.f7fcaec3a2073p-2,
+    -0x1.f8d3fd2396f26p-2,
+    -0x1.f9ab45237f45dp-2,
+    -0x1.fa8286bd51379p-2,
+    -0x1.fb59c1ee764c8p-2,
+    -0x1.fc30f6b458099p-2,
+    -0x1.fd082509c9789p-2,
+    -0x1.fddf4ceb574abp-2,
+    -0x1.feb66e54b15d8p-2,
+    -0x1.ff8d894264622p-2,
+    -0x1.00324ed8eceecp-1,
+    -0x1.009dd5ce8402ep-1,
+    -0x1.010959803dc6p-1,
+    -0x1.0174d9eccefa9p-1,
+    -0x1.01e057120f8f6p-1,
+    -0x1.024bd0ed69095p-1,
+    -0x1.02b7477c44ed4p-1,
+    -0x1.0322babe34d16p-1,
+    -0x1.038e2ab110a47p-1,
+    -0x1.03f9975241eb5p-1,
+    -0x1.046500a00efeap-1,
+    -0x1.04d066984fcd2p-1,
+    -0x1.053bc939b9194p-1,
+    -0x1.05a7288222d1cp-1,
+    -0x1.0612846ef67b8p-1,
+    -0x1.067ddcfe7a6f2p-1,
+    -0x1.06e9322ef5054p-1,
+    -0x1.075483feac967p-1,
+    -0x1.07bfd26be77b5p-1,
+    -0x1.082b1d73a0cefp-1,
+    -0x1.089665141ee9ep-1,
+    -0x1.0901a94c168eap-1,
+    -0x1.096cea195fabep-1,
+    -0x1.09d8277963c69p-1,
+    -0x1.0a43616a69375p-1,
+    -0x1.0aae97eb24c08p-1,
+    -0x1.0b19caf8917d4p-1,
+    -0x1.0b84fa91643p-1,
+    -0x1.0bf026b3e3315p-1,
+    -0x1.0c5b4f5d78062p-1,
+    -0x1.0cc6748bfa9d3p-1,
+    -0x1.0d31963e1fb8fp-1,
+    -0x1.0d9cb4729c1bdp-1,
+    -0x1.0e07cf25fc771p-1,
+    -0x1.0e72e65687234p-1,
+    -0x1.0eddfa02f0e2dp-1,
+    -0x1.0f490a2911a48p-1,
+    -0x1.0fb416c652ed4p-1,
+    -0x1.101f1fd8fb15bp-1,
+    -0x1.108a255fbee03p-1,
+    -0x1.10f527579967dp-1,
+    -0x1.116025bed1053p-1,
+    -0x1.11cb20941a7adp-1,
+    -0x1.123617d54db76p-1,
+    -0x1.12a10b7fd43fcp-1,
+    -0x1.130bfb918602cp-1,
+    -0x1.1376e80917c2dp-1,
+    -0x1.13e1d0e4cfd88p-1,
+    -0x1.144cb62217c8cp-1,
+    -0x1.14b797bec7825p-1,
+    -0x1.152275b993c7ap-1,
+    -0x1.158d500fe61dap-1,
+    -0x1.15f826c004dcep-1,
+    -0x1.1662f9c7c7f42p-1,
+    -0x1.16cdc92507522p-1,
+    -0x1.173894d677b95p-1,
+    -0x1.17a35cd982aeap-1,
+    -0x1.180e212c6e8abp-1,
+    -0x1.1878e1cd81a61p-1,
+    -0x1.18e39eba2585ap-1,
+    -0x1.194e57f0a082p-1,
+    -0x1.19b90d6eca89fp-1,
+    -0x1.1a23bf32e9f61p-1,
+    -0x1.1a8e6d3ad6b51p-1,
+    -0x1.1af9178468b5cp-1,
+    -0x1.1b63be0e54ba9p-1,
+    -0x1.1bce60d604486p-1,
+    -0x1.1c38ffd9bdb7dp-1,
+    -0x1.1ca39b1758f7ap-1,
+    -0x1.1d0e328cadf69p-1,
+    -0x1.1d78c638030d3p-1,
+    -0x1.1de35616c1c07p-1,
+    -0x1.1e4de2273068fp-1,
+    -0x1.1eb86a67955f4p-1,
+    -0x1.1f22eed55a285p-1,
+    -0x1.1f8d6f6e56b2dp-1,
+    -0x1.1ff7ec313fc14p-1,
+    -0x1.2062651cca161p-1,
+    -0x1.20ccda2e5f362p-1,
+    -0x1.21374b6368a66p-1,
+    -0x1.21a1b8b9be559p-1,
+    -0x1.220c223015062p-1,
+    -0x1.227687c4b310bp-1,
+    -0x1.22e0e97425267p-1,
+    -0x1.234b473d2009dp-1,
+    -0x1.23b5a11e587d4p-1,
+    -0x1.241ff715a66f9p-1,
+    -0x1.248a492073659p-1,
+    -0x1.24f4973c28e43p-1,
+    -0x1.255ee1670d441p-1,
+    -0x1.25c9279f66dddp-1,
+    -0x1.263369e37c0ap-1,
+    -0x1.269da83124b76p-1,
+    -0x1.2707e28638d4bp-1,
+    -0x1.277218e0feba8p-1,
+    -0x1.27dc4b3f4e57ap-1,
+    -0x1.2846799eff9acp-1,
+    -0x1.28b0a3fdea72bp-1,
+    -0x1.291aca59e6ce3p-1,
+    -0x1.2984ecb13b05dp-1,
+    -0x1.29ef0b022d723p-1,
+    -0x1.2a59254a27983p-1,
+    -0x1.2ac33b870166ap-1,
+    -0x1.2b2d4db701361p-1,
+    -0x1.2b975bd7fef54p-1,
+    -0x1.2c0165e8af66ap-1,
+    -0x1.2c6b6be67c0f1p-1,
+    -0x1.2cd56dcf3cdd6p-1,
+    -0x1.2d3f6ba0c9c04p-1,
+    -0x1.2da9655969106p-1,
+    -0x1.2e135af6f2bc7p-1,
+    -0x1.2e7d4c76d0496p-1,
+    -0x1.2ee739d7480fcp-1,
+    -0x1.2f512316a0683p-1,
+    -0x1.2fbb08331fab4p-1,
+    -0x1.3024e92a2f5dep-1,
+    -0x1.308ec5f9a76edp-1,
+    -0x1.30f89ea03ca08p-1,
+    -0x1.3162731bc6e1bp-1,
+    -0x1.31cc4369afb75p-1,
+    -0x1.32360f8760a64p-1,
+    -0x1.329fd7738e70fp-1,
+    -0x1.33099b2cedd9dp-1,
+    -0x1.33735ab00b922p-1,
+    -0x1.33dd15fabf889p-1,
+    -0x1.3446cd0bbe7fap-1,
+    -0x1.34b07fe14ecffp-1,
+    -0x1.351a2e7948683p-1,
+    -0x1.3583d8d114cd5p-1,
+    -0x1.35ed7ee68bee1p-1,
+    -0x1.365720b8628cep-1,
+    -0x1.36c0be44022eap-1,
+    -0x1.372a578742c22p-1,
+    -0x1.3793ec806a9ffp-1,
+    -0x1.37fd7d2d51b6dp-1,
+    -0x1.3867098bcff58p-1,
+    -0x1.38d0919a2bb4ap-1,
+    -0x1.393a1555ce791p-1,
+    -0x1.39a394bc90319p-1,
+    -0x1.3a0d0fcd25a0ap-1,
+    -0x1.3a768684f84b2p-1,
+    -0x1.3adff8e1e01fcp-1,
+    -0x1.3b4966e1b50d5p-1,
+    -0x1.3bb2d082bd6c7p-1,
+    -0x1.3c1c35c2d12bdp-1,
+    -0x1.3c85969fc83a4p-1,
+    -0x1.3ceef317e8f05p-1,
+    -0x1.3d584b290b3ccp-1,
+    -0x1.3dc19ed098a47p-1,
+    -0x1.3e2aee0c69163p-1,
+    -0x1.3e9438db31546p-1,
+    -0x1.3efd7f3a5ae4p-1,
+    -0x1.3f66c127bdb3cp-1,
+    -0x1.3fcffea1a01c4p-1,
+    -0x1.403937a56ba26p-1,
+    -0x1.40a26c30f834ep-1,
+    -0x1.410b9c428c2c6p-1,
+    -0x1.4174c7d86de17p-1,
+    -0x1.41ddeef006d9p-1,
+    -0x1.424711872f01dp-1,
+    -0x1.42b02f9c2cb47p-1,
+    -0x1.4319492cd7dfbp-1,
+    -0x1.43825e3708724p-1,
+    -0x1.43eb6eb904c4cp-1,
+    -0x1.44547ab0a4c5fp-1,
+    -0x1.44bd821bc064ap-1,
+    -0x1.452684f7c125ap-1,
+    -0x1.458f83427ef7cp-1,
+    -0x1.45f87cfaae9d6p-1,
+    -0x1.4661721db99b8p-1,
+    -0x1.46ca62a90976fp-1,
+    -0x1.47334e9b52f23p-1,
+    -0x1.479c35f26dfcp-1,
+    -0x1.480518abc4194p-1,
+    -0x1.486df6c60a0c6p-1,
+    -0x1.48d6d03f17c43p-1,
+    -0x1.493fa51456c59p-1,
+    -0x1.49a875439eff4p-1,
+    -0x1.4a1140cac85ffp-1,
+    -0x1.4a7a07a819405p-1,
+    -0x1.4ae2c9d8fb254p-1,
+    -0x1.4b4b875b45fd8p-1,
+    -0x1.4bb4402cd1b7dp-1,
+    -0x1.4c1cf44b7642fp-1,
+    -0x1.4c85a3b5e8615p-1,
+    -0x1.4cee4e699197dp-1,
+    -0x1.4d56f463db6b6p-1,
+    -0x1.4dbf95a37a9e8p-1,
+    -0x1.4e283226471fep-1,
+    -0x1.4e90c9e9aa747p-1,
+    -0x1.4ef95cebeaf4cp-1,
+    -0x1.4f61eb2ae08f9p-1,
+    -0x1.4fca74a46333ap-1,
+    -0x1.5032f9564acfcp-1,
+    -0x1.509b793e6f52ap-1,
+    -0x1.5103f45a3a413p-1,
+    -0x1.516c6aa715205p-1,
+    -0x1.51d4dc23b4b27p-1,
+    -0x1.523d48cecdba1p-1,
+    -0x1.52a5b0a5c9bc1p-1,
+    -0x1.530e13a5a3d37p-1,
+    -0x1.537671cd10c2bp-1,
+    -0x1.53decb1a56e27p-1,
+    -0x1.54471f8a714dbp-1,
+    -0x1.54af6f1ac9896p-1,
+    -0x1.5517b9ca1457fp-1,
+    -0x1.557fff9629a82p-1,
+    -0x1.55e8407c72feep-1,
+    -0x1.56507c7ba51e9p-1,
+    -0x1.56b8b391298c2p-1,
+    -0x1.5720e5b9fb62ap-1,
+    -0x1.578912f4cf648p-1,
+    -0x1.57f13b3febea6p-1,
+    -0x1.58595e984c0f5p-1,
+    -0x1.58c17cfbc7c2p-1,
+    -0x1.59299668a55b1p-1,
+    -0x1.5991aadd999dp-1,
+    -0x1.59f9ba587c768p-1,
+    -0x1.5a61c4d5da98dp-1,
+    -0x1.5ac9ca538bf2ap-1,
+    -0x1.5b31cacfd6dcap-1,
+    -0x1.5b99c64893458p-1,
+    -0x1.5c01bcbb991cp-1,
+    -0x1.5c69ae272eb8cp-1,
+    -0x1.5cd19a892c0a8p-1,
+    -0x1.5d3981defa962p-1,
+    -0x1.5da16426724a7p-1,
+    -0x1.5e09415d6b162p-1,
+    -0x1.5e7119814e7e2p-1,
+    -0x1.5ed8ec90d144ep-1,
+    -0x1.5f40ba89cb592p-1,
+    -0x1.5fa88369a63fcp-1,
+    -0x1.6010472e39e78p-1,
+    -0x1.607805d55e3f3p-1,
+    -0x1.60dfbf5d599f6p-1,
+    -0x1.614773c327232p-1,
+    -0x1.61af23050d23p-1,
+    -0x1.6216cd20e38dcp-1,
+    -0x1.627e721482523p-1,
+    -0x1.62e611de2fc8ep-1,
+    -0x1.634dac7ae70cep-1,
+    -0x1.63b541e8ee76cp-1,
+    -0x1.641cd2261df55p-1,
+    -0x1.64845d2f70a39p-1,
+    -0x1.64ebe3032cda2p-1,
+    -0x1.655363a0075b7p-1,
+    -0x1.65badf03d8165p-1,
+    -0x1.6622552c088f9p-1,
+    -0x1.6689c61670b6p-1,
+    -0x1.66f131c0e8785p-1,
+    -0x1.67589828d95b7p-1,
+    -0x1.67bff94c1b4e3p-1,
+    -0x1.68275528f4a91p-1,
+    -0x1.688eabbd3d5aep-1,
+    -0x1.68f5fd05f07eap-1,
+    -0x1.695d4901546cfp-1,
+    -0x1.69c48fae1de85p-1,
+    -0x1.6a2bd109480bcp-1,
+    -0x1.6a930d103c5c2p-1,
+    -0x1.6afa43c0d2c84p-1,
+    -0x1.6b617518e33eep-1,
+    -0x1.6bc8a116b4189p-1,
+    -0x1.6c2fc7b81d441p-1,
+    -0x1.6c96e8fa88464p-1,
+    -0x1.6cfe04dbcd0dfp-1,
+    -0x1.6d651b59c389ep-1,
+    -0x1.6dcc2c72b212ap-1,
+    -0x1.6e3338247096fp-1,
+    -0x1.6e9a3e6bfa31ep-1,
+    -0x1.6f013f46b8686p-1,
+    -0x1.6f683ab35ffcep-1,
+    -0x1.6fcf30afc8de1p-1,
+    -0x1.703621395c90ep-1,
+    -0x1.709d0c4ecfd7dp-1,
+    -0x1.7103f1ed8c37bp-1,
+    -0x1.716ad2128ccbap-1,
+    -0x1.71d1acbba9826p-1,
+    -0x1.723881e728b48p-1,
+    -0x1.729f5192e250cp-1,
+    -0x1.73061bbcae45ep-1,
+    -0x1.736ce0626482ap-1,
+    -0x1.73d39f816e8bfp-1,
+    -0x1.743a591812ba6p-1,
+    -0x1.74a10d234c29p-1,
+    -0x1.7507bba0f2c6ap-1,
+    -0x1.756e648fbb55ap-1,
+    -0x1.75d507ed0f5afp-1,
+    -0x1.763ba5b6585b7p-1,
+    -0x1.76a23de8ffdcp-1,
+    -0x1.7708d0834c354p-1,
+    -0x1.776f5d831556p-1,
+    -0x1.77d5e4e6332cfp-1,
+    -0x1.783c66aaec12bp-1,
+    -0x1.78a2e2ce3b224p-1,
+    -0x1.7909594d89e09p-1,
+    -0x1.796fca26b03c6p-1,
+    -0x1.79d6355862f82p-1,
+    -0x1.7a3c9ae00b98cp-1,
+    -0x1.7aa2fabaa5395p-1,
+    -0x1.7b0954e6e49c3p-1,
+    -0x1.7b6fa96233465p-1,
+    -0x1.7bd5f829fabcap-1,
+    -0x1.7c3c413c12eddp-1,
+    -0x1.7ca28496c2329p-1,
+    -0x1.7d08c2384ee36p-1,
+    -0x1.7d6efa1d45b18p-1,
+    -0x1.7dd52c431021ep-1,
+    -0x1.7e3b58a7f48d1p-1,
+    -0x1.7ea17f4a394bap-1,
+    -0x1.7f07a027b64c6p-1,
+    -0x1.7f6dbb3d66aa5p-1,
+    -0x1.7fd3d08990be2p-1,
+    -0x1.8039e00a0c768p-1,
+    -0x1.809fe9bbd4ee7p-1,
+    -0x1.8105ed9d307eap-1,
+    -0x1.816bebabf715cp-1,
+    -0x1.81d1e3e600a2ap-1,
+    -0x1.8237d6492514p-1,
+    -0x1.829dc2d1f11bp-1,
+    -0x1.8303a97eab105p-1,
+    -0x1.83698a4e07b65p-1,
+    -0x1.83cf653d02282p-1,
+    -0x1.84353a4972547p-1,
+    -0x1.849b0971302ap-1,
+    -0x1.8500d2b0c85a1p-1,
+    -0x1.85669606813d3p-1,
+    -0x1.85cc53710f95ep-1,
+    -0x1.86320aed6e7f2p-1,
+    -0x1.8697bc7975e7bp-1,
+    -0x1.86fd6812fdbe6p-1,
+    -0x1.87630db76f88p-1,
+    -0x1.87c8ad6434c99p-1,
+    -0x1.882e47172571cp-1,
+    -0x1.8893dacef643p-1,
+    -0x1.88f968897f2c2p-1,
+    -0x1.895ef0434cde4p-1,
+    -0x1.89c471fa37483p-1,
+    -0x1.8a29edacf32c6p-1,
+    -0x1.8a8f6358ea0fbp-1,
+    -0x1.8af4d2fb170d3p-1,
+    -0x1.8b5a3c90e3a9cp-1,
+    -0x1.8bbfa01827d43p-1,
+    -0x1.8c24fd8ebb7b3p-1,
+    -0x1.8c8a54f353614p-1,
+    -0x1.8cefa643590b4p-1,
+    -0x1.8d54f17bc7944p-1,
+    -0x1.8dba369a76ebp-1,
+    -0x1.8e1f759dad682p-1,
+    -0x1.8e84ae8342fa5p-1,
+    -0x1.8ee9e147c452dp-1,
+    -0x1.8f4f0de909606p-1,
+    -0x1.8fb43464ea11cp-1,
+    -0x1.901954b93e55ap-1,
+    -0x1.907e6ee3de1adp-1,
+    -0x1.90e382e232e63p-1,
+    -0x1.914890b283106p-1,
+    -0x1.91ad9852a6882p-1,
+    -0x1.921299bf98688p-1,
+    -0x1.927794f730a04p-1,
+    -0x1.92dc89f7471e1p-1,
+    -0x1.934178bc68933p-1,
+    -0x1.93a66144db584p-1,
+    -0x1.940b438f542fbp-1,
+    -0x1.94701f98ce348p-1,
+    -0x1.94d4f55f21558p-1,
+    -0x1.9539c4e025816p-1,
+    -0x1.959e8e19443d1p-1,
+    -0x1.96035107e70d8p-1,
+    -0x1.96680da9090dbp-1,
+    -0x1.96ccc3fb5f002p-1,
+    -0x1.973173fcc0d38p-1,
+    -0x1.97961daa29a2ep-1,
+    -0x1.97fac101dfc6ep-1,
+    -0x1.985f5e014cc47p-1,
+    -0x1.98c3f4a56bb69p-1,
+    -0x1.992884ec82f5ep-1,
+    -0x1.998d0ed3fc074p-1,
+    -0x1.99f19259406f9p-1,
+    -0x1.9a560f7a96878p-1,
+    -0x1.9aba863567d3ep-1,
+    -0x1.9b1ef6871dd9ap-1,
+    -0x1.9b83606d90878p-1,
+    -0x1.9be7c3e697cc4p-1,
+    -0x1.9c4c20f00b96ap-1,
+    -0x1.9cb07787556b9p-1,
+    -0x1.9d14c7aa4d39cp-1,
+    -0x1.9d791155ee1c5p-1,
+    -0x1.9ddd5487a1981p-1,
+    -0x1.9e41913e1c6f8p-1,
+    -0x1.9ea5c77659bdbp-1,
+    -0x1.9f09f72dc3078p-1,
+    -0x1.9f6e2062303bcp-1,
+    -0x1.9fd2431179492p-1,
+    -0x1.a0365f39761e6p-1,
+    -0x1.a09a74d790407p-1,
+    -0x1.a0fe83e931343p-1,
+    -0x1.a1628c6bc27e8p-1,
+    -0x1.a1c68e5d1c0e3p-1,
+    -0x1.a22a89bb843bdp-1,
+    -0x1.a28e7e8387b89p-1,
+    -0x1.a2f26cb2fe733p-1,
+    -0x1.a35654489d2e3p-1,
+    -0x1.a3ba35415f049p-1,
+    -0x1.a41e0f9aad7b4p-1,
+    -0x1.a481e35183ad5p-1,
+    -0x1.a4e5b063b9897p-1,
+    -0x1.a54976cf95684p-1,
+    -0x1.a5ad369280cebp-1,
+    -0x1.a610efa9e541ap-1,
+    -0x1.a674a2132c45fp-1,
+    -0x1.a6d84dcc2dca7p-1,
+    -0x1.a73bf2d2c1bddp-1,
+    -0x1.a79f9123e33b3p-1,
+    -0x1.a80328bdd89b2p-1,
+    -0x1.a866b99d9cf8ap-1,
+    -0x1.a8ca43c02b6edp-1,
+    -0x1.a92dc724a729fp-1,
+    -0x1.a99143c80b451p-1,
+    -0x1.a9f4b9a82fafp-1,
+    -0x1.aa5828c2ec567p-1,
+    -0x1.aabb91153c567p-1,
+    -0x1.ab1ef29c8933ep-1,
+    -0x1.ab824d563c73bp-1,
+    -0x1.abe5a1402e04ap-1,
+    -0x1.ac48ee5835d57p-1,
+    -0x1.acac349b4f013p-1,
+    -0x1.ad0f740751769p-1,
+    -0x1.ad72ac9a838e4p-1,
+    -0x1.add5de51e0634p-1,
+    -0x1.ae39092b3fe45p-1,
+    -0x1.ae9c2d240b965p-1,
+    -0x1.aeff4a393e946p-1,
+    -0x1.af626068b0cd3p-1,
+    -0x1.afc56fafcbc5bp-1,
+    -0x1.b028780c676cap-1,
+    -0x1.b08b797c5bb0cp-1,
+    -0x1.b0ee73fd1216fp-1,
+    -0x1.b151678c628dfp-1,
+    -0x1.b1b454274830dp-1,
+    -0x1.b21739cabe1aap-1,
+    -0x1.b27a18749c3a2p-1,
+    -0x1.b2dcf02328e7fp-1,
+    -0x1.b33fc0d3cda8fp-1,
+    -0x1.b3a28a8385982p-1,
+    -0x1.b4054d30970e3p-1,
+    -0x1.b46808d86b9p-1,
+    -0x1.b4cabd786ca27p-1,
+    -0x1.b52d6b0ee09e2p-1,
+    -0x1.b590119854344p-1,
+    -0x1.b5f2b111c27fdp-1,
+    -0x1.b6554979036fap-1,
+    -0x1.b6b7dacc5d5c5p-1,
+    -0x1.b71a6508cb60ep-1,
+    -0x1.b77ce82bb7024p-1,
+    -0x1.b7df6432f82f2p-1,
+    -0x1.b841d91bf86c8p-1,
+    -0x1.b8a446e4213f3p-1,
+    -0x1.b906ad88dc2c2p-1,
+    -0x1.b9690d0801221p-1,
+    -0x1.b9cb655e8b3c1p-1,
+    -0x1.ba2db68a5268ep-1,
+    -0x1.ba9000892e974p-1,
+    -0x1.baf24358894c1p-1,
+    -0x1.bb547ef5cc0c4p-1,
+    -0x1.bbb6b35e605cbp-1,
+    -0x1.bc18e0901e2c2p-1,
+    -0x1.bc7b06886eff7p-1,
+    -0x1.bcdd2544bc5b9p-1,
+    -0x1.bd3f3cc26fc56p-1,
+    -0x1.bda14cfe8458p-1,
+    -0x1.be0355f663984p-1,
+    -0x1.be6557a853decp-1,
+    -0x1.bec7521150469p-1,
+    -0x1.bf29452ec254ap-1,
+    -0x1.bf8b30fef0618p-1,
+    -0x1.bfed157e671e6p-1,
+    -0x1.c04ef2aafe7ap-1,
+    -0x1.c0b0c8828e633p-1,
+    -0x1.c112970211f4fp-1,
+    -0x1.c1745e27611ep-1,
+    -0x1.c1d61defe5634p-1,
+    -0x1.c237d65899dfdp-1,
+    -0x1.c299875f56826p-1,
+    -0x1.c2fb3101f339bp-1,
+    -0x1.c35cd33dd98abp-1,
+    -0x1.c3be6e1004907p-1,
+    -0x1.c42001764c39ap-1,
+    -0x1.c4818d6e1a0b3p-1,
+    -0x1.c4e311f38c4c8p-1,
+    -0x1.c5448f0557cp-1,
+    -0x1.c5a604a154547p-1,
+    -0x1.c60772c40ebbp-1,
+    -0x1.c668d96b5ee27p-1,
+    -0x1.c6ca38943fe5dp-1,
+    -0x1.c72b903c89b3ep-1,
+    -0x1.c78ce062143b6p-1,
+    -0x1.c7ee290249013p-1,
+    -0x1.c84f6a1a918a4p-1,
+    -0x1.c8b0a3a7e8f1ap-1,
+    -0x1.c911d5a7b8bc3p-1,
+    -0x1.c97300176a6edp-1,
+    -0x1.c9d422f4678e7p-1,
+    -0x1.ca353e3c199ffp-1,
+    -0x1.ca9651ec58922p-1,
+    -0x1.caf75e028de9dp-1,
+    -0x1.cb58627bb4c22p-1,
+    -0x1.cbb95f55a509cp-1,
+    -0x1.cc1a548dc845ap-1,
+    -0x1.cc7b42211990dp-1,
+    -0x1.ccdc280d70da1p-1,
+    -0x1.cd3d065037a64p-1,
+    -0x1.cd9ddce669107p-1,
+    -0x1.cdfeabcd0033bp-1,
+    -0x1.ce5f7301d4fecp-1,
+    -0x1.cec03282bf605p-1,
+    -0x1.cf20ea4c4c09bp-1,
+    -0x1.cf819a5c52e99p-1,
+    -0x1.cfe242b0abeebp-1,
+    -0x1.d042e346c09dfp-1,
+    -0x1.d0a37c1b8c127p-1,
+    -0x1.d1040d2c77d1p-1,
+    -0x1.d1649676ed5eap-1,
+    -0x1.d1c517f7796c7p-1,
+    -0x1.d22591ac62531p-1,
+    -0x1.d286039380014p-1,
+    -0x1.d2e66daa3bfbep-1,
+    -0x1.d346cfed22f43p-1,
+    -0x1.d3a72a5a0cd8fp-1,
+    -0x1.d4077ceed198dp-1,
+    -0x1.d467c7a78f7b4p-1,
+    -0x1.d4c80a81419b4p-1,
+    -0x1.d528457a2e517p-1,
+    -0x1.d58878902d8c8p-1,
+    -0x1.d5e8a3c03a679p-1,
+    -0x1.d648c7074ffdap-1,
+    -0x1.d6a8e263463d8p-1,
+    -0x1.d708f5d186acp-1,
+    -0x1.d769014f0c644p-1,
+    -0x1.d7c904d9af55p-1,
+    -0x1.d829006d8dc59p-1,
+    -0x1.d888f4087fa4bp-1,
+    -0x1.d8e8dfa8cb4bp-1,
+    -0x1.d948c34a8effep-1,
+    -0x1.d9a89eeba2b2p-1,
+    -0x1.da0872896fe65p-1,
+    -0x1.da683e21ce8b9p-1,
+    -0x1.dac801b296908p-1,
+    -0x1.db27bd37e63c8p-1,
+    -0x1.db8770aeb8aa9p-1,
+    -0x1.dbe71c14775fap-1,
+    -0x1.dc46bf66fa4a7p-1,
+    -0x1.dca65aa33c86p-1,
+    -0x1.dd05edc716012p-1,
+    -0x1.dd6578cf81d6dp-1,
+    -0x1.ddc4fbb9e98cp-1,
+    -0x1.de247684250f7p-1,
+    -0x1.de83e92a52a88p-1,
+    -0x1.dee353a9dbdc1p-1,
+    -0x1.df42b6009898ep-1,
+    -0x1.dfa2102bf263dp-1,
+    -0x1.e001622875ee2p-1,
+    -0x1.e060abf38cbcbp-1,
+    -0x1.e0bfed8b7d281p-1,
+    -0x1.e11f26edb0b53p-1,
+    -0x1.e17e5817227f2p-1,
+    -0x1.e1dd81045f371p-1,
+    -0x1.e23ca1b2d061fp-1,
+    -0x1.e29bba1fdf84ap-1,
+    -0x1.e2faca4887ba3p-1,
+    -0x1.e359d22aa0f15p-1,
+    -0x1.e3b8d1c326452p-1,
+    -0x1.e417c90f12d0ap-1,
+    -0x1.e476b80cacec7p-1,
+    -0x1.e4d59eb812dffp-1,
+    -0x1.e5347d0e3fc62p-1,
+    -0x1.e593530de8618p-1,
+    -0x1.e5f220b407cd2p-1,
+    -0x1.e650e5fd2aba2p-1,
+    -0x1.e6afa2e64c43ap-1,
+    -0x1.e70e576d44585p-1,
+    -0x1.e76d038f0e135p-1,
+    -0x1.e7cba748a48fap-1,
+    -0x1.e82a429771522p-1,
+    -0x1.e888d5794c49ap-1,
+    -0x1.e8e75feb30912p-1,
+    -0x1.e945e1ea1943cp-1,
+    -0x1.e9a45b73de503p-1,
+    -0x1.ea02cc850c67ap-1,
+    -0x1.ea61351b7b78ep-1,
+    -0x1.eabf9534269efp-1,
+    -0x1.eb1deccc08f4ep-1,
+    -0x1.eb7c3be01d95cp-1,
+    -0x1.ebda826d5f9cap-1,
+    -0x1.ec38c07215621p-1,
+    -0x1.ec96f5ea5d2d7p-1,
+    -0x1.ecf522d40eed8p-1,
+    -0x1.ed53472c94273p-1,
+    -0x1.edb162f0798bap-1,
+    -0x1.ee0f761d9709ap-1,
+    -0x1.ee6d80b079526p-1,
+    -0x1.eecb82a6f854ap-1,
+    -0x1.ef297bfe0f2b6p-1,
+    -0x1.ef876cb24a87ep-1,
+    -0x1.efe554c18258ep-1,
+    -0x1.f043342920234p-1,
+    -0x1.f0a10ae5b0984p-1,
+    -0x1.f0fed8f49d3ccp-1,
+    -0x1.f15c9e534f95ap-1,
+    -0x1.f1ba5afec2bep-1,
+    -0x1.f2180ef38367p-1,
+    -0x1.f275ba2e8cabbp-1,
+    -0x1.f2d35cadb67aep-1,
+    -0x1.f330f66dfbef9p-1,
+    -0x1.f38e876c5824dp-1,
+    -0x1.f3ec0fa6a3095p-1,
+    -0x1.f4498f1a46221p-1,
+    -0x1.f4a705c35fb66p-1,
+    -0x1.f504739eeae15p-1,
+    -0x1.f561d8aabf919p-1,
+    -0x1.f5bf34e4b5b5fp-1,
+    -0x1.f61c88487d2bfp-1,
+    -0x1.f679d2d3110eap-1,
+    -0x1.f6d7148326206p-1,
+    -0x1.f7344d54daa8ap-1,
+    -0x1.f7917d4529c26p-1,
+    -0x1.f7eea451eb5c7p-1,
+    -0x1.f84bc277ac27fp-1,
+    -0x1.f8a8d7b44413bp-1,
+    -0x1.f905e4043fd0dp-1,
+    -0x1.f962e7642c109p-1,
+    -0x1.f9bfe1d17257ep-1,
+    -0x1.fa1cd3497c2bap-1,
+    -0x1.fa79bbc944a6dp-1,
+    -0x1.fad69b4d587abp-1,
+    -0x1.fb3371d38f96p-1,
+    -0x1.fb903f58e513dp-1,
+    -0x1.fbed03da540f2p-1,
+    -0x1.fc49bf54d7a31p-1,
+    -0x1.fca671c56aeaap-1,
+    -0x1.fd031b29776abp-1,
+    -0x1.fd5fbb7df83e6p-1,
+    -0x1.fdbc52bf7a16dp-1,
+    -0x1.fe18e0eb6678fp-1,
+    -0x1.fe7565ff26e9bp-1,
+    -0x1.fed1e1f7481a3p-1,
+    -0x1.ff2e54d1a1f94p-1,
+    -0x1.ff8abe8ac1381p-1,
+    -0x1.ffe71f1ec41dfp-1,
+    -0x1.0021bb45c14cdp+0,
+    -0x1.004fe266fbe32p+0,
+    -0x1.007e04f18f5f7p+0,
+    -0x1.00ac22e467b91p+0,
+    -0x1.00da3c3dcb48bp+0,
+    -0x1.010850fc379bcp+0,
+    -0x1.0136611e6174cp+0,
+    -0x1.01646ca220c27p+0,
+    -0x1.01927386617c3p+0,
+    -0x1.01c075c9a12f8p+0,
+    -0x1.01ee736a2635p+0,
+    -0x1.021c6c66a54f2p+0,
+    -0x1.024a60bd9c0b6p+0,
+    -0x1.0278506dbf2c4p+0,
+    -0x1.02a63b758c3f4p+0,
+    -0x1.02d421d380d1fp+0,
+    -0x1.030203861a71cp+0,
+    -0x1.032fe08bd6ac5p+0,
+    -0x1.035db8e2c4a54p+0,
+    -0x1.038b8c8961ea1p+0,
+    -0x1.03b95b7ed1a72p+0,
+    -0x1.03e725c19169fp+0,
+    -0x1.0414eb4f41ec4p+0,
+    -0x1.0442ac26cf258p+0,
+    -0x1.04706846b6a34p+0,
+    -0x1.049e1fad75f3p+0,
+    -0x1.04cbd259f90c1p+0,
+    -0x1.04f9804a4f123p+0,
+    -0x1.0527297cf592ep+0,
+    -0x1.0554cdf032e6cp+0,
+    -0x1.05826da2f3052p+0,
+    -0x1.05b008934511cp+0,
+    -0x1.05dd9ebfa69a2p+0,
+    -0x1.060b30270395ap+0,
+    -0x1.0638bcc76b27ep+0,
+    -0x1.0666449f5ade7p+0,
+    -0x1.0693c7ad1911fp+0,
+    -0x1.06c145ef91b9cp+0,
+    -0x1.06eebf650b2e7p+0,
+    -0x1.071c340bcbc8ap+0,
+    -0x1.0749a3e2bf7fbp+0,
+    -0x1.07770ee82cac3p+0,
+    -0x1.07a4751a59a6dp+0,
+    -0x1.07d1d6778cc81p+0,
+    -0x1.07ff32fe0c68ap+0,
+    -0x1.082c8aac5615fp+0,
+    -0x1.0859dd811e928p+0,
+    -0x1.08872b7b1aa0dp+0,
+    -0x1.08b47498c7ce5p+0,
+    -0x1.08e1b8d7fe09dp+0,
+    -0x1.090ef837a94abp+0,
+    -0x1.093c32b6471e7p+0,
+    -0x1.09696851e6a8bp+0,
+    -0x1.0996990905771p+0,
+    -0x1.09c3c4da2117p+0,
+    -0x1.09f0ebc3b7161p+0,
+    -0x1.0a1e0dc3d697fp+0,
+    -0x1.0a4b2ad9a2c8fp+0,
+    -0x1.0a7843032accbp+0,
+    -0x1.0aa5563eb4fbep+0,
+    -0x1.0ad2648af618ep+0,
+    -0x1.0aff6de5fd476p+0,
+    -0x1.0b2c724e7f49dp+0,
+    -0x1.0b5971c2c278dp+0,
+    -0x1.0b866c414461fp+0,
+    -0x1.0bb361c81428dp+0,
+    -0x1.0be05255af5afp+0,
+    -0x1.0c0d3de901efcp+0,
+    -0x1.0c3a247fe3d6p+0,
+    -0x1.0c67061909d01p+0,
+    -0x1.0c93e2b2f16b9p+0,
+    -0x1.0cc0ba4b72973p+0,
+    -0x1.0ced8ce1794a5p+0,
+    -0x1.0d1a5a734bdd9p+0,
+    -0x1.0d4722fef974ap+0,
+    -0x1.0d73e68336d1fp+0,
+    -0x1.0da0a4fe8183p+0,
+    -0x1.0dcd5e6fc57f3p+0,
+    -0x1.0dfa12d4a3806p+0,
+    -0x1.0e26c22b2aaa3p+0,
+    -0x1.0e536c7246f4p+0,
+    -0x1.0e8011a807818p+0,
+    -0x1.0eacb1ca7b766p+0,
+    -0x1.0ed94cd820603p+0,
+    -0x1.0f05e2cfe2364p+0,
+    -0x1.0f3273b03e862p+0,
+    -0x1.0f5eff770d3e9p+0,
+    -0x1.0f8b8622cbed1p+0,
+    -0x1.0fb807b22f541p+0,
+    -0x1.0fe4842346974p+0,
+    -0x1.1010fb74580f4p+0,
+    -0x1.103d6da372dfcp+0,
+    -0x1.1069daaf4bcb3p+0,
+    -0x1.109642969794p+0,
+    -0x1.10c2a557655dep+0,
+    -0x1.10ef02effb816p+0,
+    -0x1.111b5b5ea0572p+0,
+    -0x1.1147aea1d16cbp+0,
+    -0x1.1173fcb79de5bp+0,
+    -0x1.11a0459e14e5dp+0,
+    -0x1.11cc895422647p+0,
+    -0x1.11f8c7d843ef2p+0,
+    -0x1.1225012851749p+0,
+    -0x1.12513542914d6p+0,
+    -0x1.127d6425b83c1p+0,
+    -0x1.12a98dd00c993p+0,
+    -0x1.12d5b23f9d887p+0,
+    -0x1.1301d172e8975p+0,
+    -0x1.132deb686b535p+0,
+    -0x1.135a001e34e03p+0,
+    -0x1.13860f9254619p+0,
+    -0x1.13b219c34765p+0,
+    -0x1.13de1eaf1d0e2p+0,
+    -0x1.140a1e548a1f7p+0,
+    -0x1.143618b27a904p+0,
+    -0x1.14620dc6c64f6p+0,
+    -0x1.148dfd8f0e16ap+0,
+    -0x1.14b9e809cf738p+0,
+    -0x1.14e5cd35f65d7p+0,
+    -0x1.1511ad1191f81p+0,
+    -0x1.153d879ab1671p+0,
+    -0x1.15695ccf63ce1p+0,
+    -0x1.15952cae5def9p+0,
+    -0x1.15c0f735aeef4p+0,
+    -0x1.15ecbc639d25bp+0,
+    -0x1.16187c36a6207p+0,
+    -0x1.164436acd9033p+0,
+    -0x1.166febc4ea906p+0,
+    -0x1.169b9b7cb2b6bp+0,
+    -0x1.16c745d24099ep+0,
+    -0x1.16f2eac3da928p+0,
+    -0x1.171e8a4fc6f93p+0,
+    -0x1.174a2474f1c55p+0,
+    -0x1.1775b9316a1a9p+0,
+    -0x1.17a148833f1c9p+0,
+    -0x1.17ccd268b723fp+0,
+    -0x1.17f856e018895p+0,
+    -0x1.1823d5e772705p+0,
+    -0x1.184f4f7cd3fcbp+0,
+    -0x1.187ac39e4c521p+0,
+    -0x1.18a6324a9032ep+0,
+    -0x1.18d19b7fe5f7cp+0,
+    -0x1.18fcff3c5cc46p+0,
+    -0x1.19285d7e72264p+0,
+    -0x1.1953b64435411p+0,
+    -0x1.197f098c23a26p+0,
+    -0x1.19aa57541538ep+0,
+    -0x1.19d59f9abec71p+0,
+    -0x1.1a00e25e2f709p+0,
+    -0x1.1a2c1f9c07ef4p+0,
+    -0x1.1a575752c5d0ap+0,
+    -0x1.1a828980af6d4p+0,
+    -0x1.1aadb6240b1ddp+0,
+    -0x1.1ad8dd3ae805fp+0,
+    -0x1.1b03fec31e146p+0,
+    -0x1.1b2f1abb2ad6ap+0,
+    -0x1.1b5a3121c30f3p+0,
+    -0x1.1b8541f48777ep+0,
+    -0x1.1bb04d31f59e3p+0,
+    -0x1.1bdb52d853dacp+0,
+    -0x1.1c0652e542e76p+0,
+    -0x1.1c314d57091cbp+0,
+    -0x1.1c5c422becd35p+0,
+    -0x1.1c873162a2cdap+0,
+    -0x1.1cb21af902fa7p+0,
+    -0x1.1cdcfeed1c7d6p+0,
+    -0x1.1d07dd3d35af1p+0,
+    -0x1.1d32b5e6ef495p+0,
+    -0x1.1d5d88e8fe0eap+0,
+    -0x1.1d885641df8c8p+0,
+    -0x1.1db31def6bb1bp+0,
+    -0x1.1ddddfefb1a1dp+0,
+    -0x1.1e089c405216cp+0,
+    -0x1.1e3352dfca9e1p+0,
+    -0x1.1e5e03cccffa2p+0,
+    -0x1.1e88af04cbafep+0,
+    -0x1.1eb35485cce3p+0,
+    -0x1.1eddf44ebf8adp+0,
+    -0x1.1f088e5d7b962p+0,
+    -0x1.1f3322afd8f3bp+0,
+    -0x1.1f5db1441dfc1p+0,
+    -0x1.1f883a18229e1p+0,
+    -0x1.1fb2bd2a64673p+0,
+    -0x1.1fdd3a7929bp+0,
+    -0x1.2007b20213326p+0,
+    -0x1.203223c36746ep+0,
+    -0x1.205c8fbbdaaffp+0,
+    -0x1.2086f5e9455c6p+0,
+    -0x1.20b1564910d11p+0,
+    -0x1.20dbb0d9f1d07p+0,
+    -0x1.21060599c0494p+0,
+    -0x1.21305485e5c06p+0,
+    -0x1.215a9d9d4e2d4p+0,
+    -0x1.2184e0de771d6p+0,
+    -0x1.21af1e476fb47p+0,
+    -0x1.21d955d5a1775p+0,
+    -0x1.22038786ad1fdp+0,
+    -0x1.222db35947707p+0,
+    -0x1.2257d94bb6c1cp+0,
+    -0x1.2281f95c0a377p+0,
+    -0x1.22ac138819c04p+0,
+    -0x1.22d627cdbd4afp+0,
+    -0x1.2300362b3b302p+0,
+    -0x1.232a3e9ea2937p+0,
+    -0x1.23544125cb63bp+0,
+    -0x1.237e3dbefbf97p+0,
+    -0x1.23a834680c437p+0,
+    -0x1.23d2251f0b656p+0,
+    -0x1.23fc0fe23fb7dp+0,
+    -0x1.2425f4af81299p+0,
+    -0x1.244fd38516133p+0,
+    -0x1.2479ac60d6637p+0,
+    -0x1.24a37f40d13ep+0,
+    -0x1.24cd4c2315c69p+0,
+    -0x1.24f713057bebep+0,
+    -0x1.2520d3e64a068p+0,
+    -0x1.254a8ec358053p+0,
+    -0x1.2574439a7dd6cp+0,
+    -0x1.259df269ca9edp+0,
+    -0x1.25c79b2f4d811p+0,
+    -0x1.25f13de915a13p+0,
+    -0x1.261ada953222ep+0,
+    -0x1.26447131b229cp+0,
+    -0x1.266e01bc6da4ap+0,
+    -0x1.26978c333c823p+0,
+    -0x1.26c11093f6b14p+0,
+    -0x1.26ea8edcab557p+0,
+    -0x1.2714070b325d8p+0,
+    -0x1.273d791dd2221p+0,
+    -0x1.2766e5126291ep+0,
+    -0x1.27904ae6f2d0ap+0,
+    -0x1.27b9aa9a006bdp+0,
+    -0x1.27e30428bdb37p+0,
+    -0x1.280c579102964p+0,
+    -0x1.2835a4d1156cdp+0,
+    -0x1.285eebe6ce25fp+0,
+    -0x1.28882cd03be54p+0,
+    -0x1.28b1678b6dce7p+0,
+    -0x1.28da9c16049b5p+0,
+    -0x1.2903ca6e46a48p+0,
+    -0x1.292cf2920bd8cp+0,
+    -0x1.2956147ebdbdp+0,
+    -0x1.297f30326b74ep+0,
+    -0x1.29a845ab24241p+0,
+    -0x1.29d154e72e232p+0,
+    -0x1.29fa5de3f2f7p+0,
+    -0x1.2a23609f81c36p+0,
+    -0x1.2a4c5d17e9abfp+0,
+    -0x1.2a75534a94359p+0,
+    -0x1.2a9e43359083ep+0,
+    -0x1.2ac72cd6edbaap+0,
+    -0x1.2af0102cbafd8p+0,
+    -0x1.2b18ed34d03b3p+0,
+    -0x1.2b41c3ed05627p+0,
+    -0x1.2b6a9452fb2d2p+0,
+    -0x1.2b935e64c0befp+0,
+    -0x1.2bbc221fbf9ccp+0,
+    -0x1.2be4df81cfb55p+0,
+    -0x1.2c0d968937613p+0,
+    -0x1.2c36473405c41p+0,
+    -0x1.2c5ef17fa462ep+0,
+    -0x1.2c879569458dap+0,
+    -0x1.2cb032efd53bap+0,
+    -0x1.2cd8ca10f426cp+0,
+    -0x1.2d015aca7a3dbp+0,
+    -0x1.2d29e51a083a5p+0,
+    -0x1.2d5268fd07a18p+0,
+    -0x1.2d7ae671becbep+0,
+    -0x1.2da35d7605a83p+0,
+    -0x1.2dcbce07b4253p+0,
+    -0x1.2df438246afcbp+0,
+    -0x1.2e1c9bc993b3ap+0,
+    -0x1.2e44f8f574a29p+0,
+    -0x1.2e6d4fa68b57p+0,
+    -0x1.2e959fd99bb72p+0,
+    -0x1.2ebde98c7db1ap+0,
+    -0x1.2ee62cbd779f3p+0,
+    -0x1.2f0e6969bbcfbp+0,
+    -0x1.2f369f8f2231fp+0,
+    -0x1.2f5ecf2bf11e9p+0,
+    -0x1.2f86f83e00844p+0,
+    -0x1.2faf1ac214493p+0,
+    -0x1.2fd736b63b91p+0,
+    -0x1.2fff4c18857f6p+0,
+    -0x1.30275ae65b993p+0,
+    -0x1.304f631dcd023p+0,
+    -0x1.307764bcb1a91p+0,
+    -0x1.309f5fc0e17c9p+0,
+    -0x1.30c75427c601ap+0,
+    -0x1.30ef41ee91883p+0,
+    -0x1.311729131bff1p+0,
+    -0x1.313f0993abbedp+0,
+    -0x1.3166e36daa4c5p+0,
+    -0x1.318eb69f26cb5p+0,
+    -0x1.31b683258ac0ap+0,
+    -0x1.31de48fe3fb13p+0,
+    -0x1.3206082754c0bp+0,
+    -0x1.322dc09dfc3f2p+0,
+    -0x1.325572600e1b3p+0,
+    -0x1.327d1d6b6243bp+0,
+    -0x1.32a4c1bd99726p+0,
+    -0x1.32cc5f5454612p+0,
+    -0x1.32f3f62d6afebp+0,
+    -0x1.331b8646b539dp+0,
+    -0x1.33430f9d9c977p+0,
+    -0x1.336a922f53678p+0,
+    -0x1.33920df97a63dp+0,
+    -0x1.33b982f9e97b2p+0,
+    -0x1.33e0f12e41674p+0,
+    -0x1.34085894914bfp+0,
+    -0x1.342fb92a79e2fp+0,
+    -0x1.345712ecf6475p+0,
+    -0x1.347e65d9de67ep+0,
+    -0x1.34a5b1ee9bc97p+0,
+    -0x1.34ccf728cf25ep+0,
+    -0x1.34f435861937p+0,
+    -0x1.351b6d041ab6bp+0,
+    -0x1.35429da0ab93ap+0,
+    -0x1.3569c758fe1ddp+0,
+    -0x1.3590ea2aea44p+0,
+    -0x1.35b80613d98b2p+0,
+    -0x1.35df1b10fe432p+0,
+    -0x1.36062920678fap+0,
+    -0x1.362d303fb62a9p+0,
+    -0x1.3654306c8acdbp+0,
+    -0x1.367b29a3e0941p+0,
+    -0x1.36a21be2b298cp+0,
+    -0x1.36c907277e694p+0,
+    -0x1.36efeb6f76559p+0,
+    -0x1.3716c8b803e29p+0,
+    -0x1.373d9eff3634p+0,
+    -0x1.37646e420864ep+0,
+    -0x1.378b367e5263fp+0,
+    -0x1.37b1f7b146812p+0,
+    -0x1.37d8b1d8170c7p+0,
+    -0x1.37ff64f0d3299p+0,
+    -0x1.382610f8ad288p+0,
+    -0x1.384cb5ecd7593p+0,
+    -0x1.387353caf2758p+0,
+    -0x1.3899ea90d66c2p+0,
+    -0x1.38c07a3c23f6fp+0,
+    -0x1.38e702c99efc1p+0,
+    -0x1.390d843642968p+0,
+    -0x1.3933fe801deap+0,
+    -0x1.395a71a463468p+0,
+    -0x1.3980dda0ea9acp+0,
+    -0x1.39a7427354a09p+0,
+    -0x1.39cda018d3a7fp+0,
+    -0x1.39f3f68ed135cp+0,
+    -0x1.3a1a45d1d9fb4p+0,
+    -0x1.3a408ddf8eb23p+0,
+    -0x1.3a66ceb5c7496p+0,
+    -0x1.3a8d0851b610cp+0,
+    -0x1.3ab33ab08d585p+0,
+    -0x1.3ad965cfedd9ep+0,
+    -0x1.3aff89ad411a6p+0,
+    -0x1.3b25a645b969cp+0,
+    -0x1.3b4bbb96c04cfp+0,
+    -0x1.3b71c99d8813ep+0,
+    -0x1.3b97d0577a437p+0,
+    -0x1.3bbdcfc1c92bbp+0,
+    -0x1.3be3c7d9de517p+0,
+    -0x1.3c09b89cb4cfdp+0,
+    -0x1.3c2fa207b62bbp+0,
+    -0x1.3c558418831eep+0,
+    -0x1.3c7b5ecc16c47p+0,
+    -0x1.3ca1321fdaa14p+0,
+    -0x1.3cc6fe11383a4p+0,
+    -0x1.3cecc29d99145p+0,
+    -0x1.3d127fc1f84a8p+0,
+    -0x1.3d38357b50f7ep+0,
+    -0x1.3d5de3c6d56c6p+0,
+    -0x1.3d838aa25d96dp+0,
+    -0x1.3da92a0ae4923p+0,
+    -0x1.3dcec1fd9cae8p+0,
+    -0x1.3df45277ef70ap+0,
+    -0x1.3e19db76a0bebp+0,
+    -0x1.3e3f5cf71a1dap+0,
+    -0x1.3e64d6f61f739p+0,
+    -0x1.3e8a4971517a5p+0,
+    -0x1.3eafb465e281dp+0,
+    -0x1.3ed517d104da2p+0,
+    -0x1.3efa73b022081p+0,
+    -0x1.3f1fc7ff8f87fp+0,
+    -0x1.3f4514bcb6debp+0,
+    -0x1.3f6a59e538c61p+0,
+    -0x1.3f8f9775d9244p+0,
+    -0x1.3fb4cd6c017e2p+0,
+    -0x1.3fd9fbc475b9dp+0,
+    -0x1.3fff227c68275p+0,
+    -0x1.4024419179807p+0,
+    -0x1.404958ffff417p+0,
+    -0x1.406e68c59a243p+0,
+    -0x1.409370df7c78ap+0,
+    -0x1.40b87149fbbb1p+0,
+    -0x1.40dd6a02b8a55p+0,
+    -0x1.41025b06771d8p+0,
+    -0x1.41274452323eap+0,
+    -0x1.414c25e31c58bp+0,
+    -0x1.4170ffb63086dp+0,
+    -0x1.4195d1c869e4p+0,
+    -0x1.41ba9c16fac03p+0,
+    -0x1.41df5e9f156b6p+0,
+    -0x1.4204195d7dcbbp+0,
+    -0x1.4228cc4f66312p+0,
+    -0x1.424d77719281dp+0,
+    -0x1.42721ac08f6efp+0,
+    -0x1.4296b6398f488p+0,
+    -0x1.42bb49d9c45e7p+0,
+    -0x1.42dfd59e29cbdp+0,
+    -0x1.43045984604a8p+0,
+    -0x1.4328d5888621cp+0,
+    -0x1.434d49a6f0cdfp+0,
+    -0x1.4371b5dd09d3fp+0,
+    -0x1.43961a27cc4ecp+0,
+    -0x1.43ba7683fc249p+0,
+    -0x1.43decaee5d3b7p+0,
+    -0x1.4403176459185p+0,
+    -0x1.44275be2ead64p+0,
+    -0x1.444b986667f19p+0,
+    -0x1.446fccebcb854p+0,
+    -0x1.4493f97047e14p+0,
+    -0x1.44b81defc4181p+0,
+    -0x1.44dc3a673b44bp+0,
+    -0x1.45004ed44e21p+0,
+    -0x1.45245b33895e3p+0,
+    -0x1.45485f81e8174p+0,
+    -0x1.456c5bbbf6fd7p+0,
+    -0x1.45904fde79f6ep+0,
+    -0x1.45b43be634e9bp+0,
+    -0x1.45d81fcfb4871p+0,
+    -0x1.45fbfb97bcb52p+0,
+    -0x1.461fcf3ada252p+0,
+    -0x1.46439ab63f27p+0,
+    -0x1.46675e06afa0ep+0,
+    -0x1.468b1928810fp+0,
+    -0x1.46aecc184022ap+0,
+    -0x1.46d276d31f2bbp+0,
+    -0x1.46f61955e2105p+0,
+    -0x1.4719b39d1581cp+0,
+    -0x1.473d45a546312p+0,
+    -0x1.4760cf6ac99acp+0,
+    -0x1.478450ea63a4dp+0,
+    -0x1.47a7ca2069cb8p+0,
+    -0x1.47cb3b0a7cc8bp+0,
+    -0x1.47eea3a4bae3bp+0,
+    -0x1.481203eb0b2fp+0,
+    -0x1.48355bdb45995p+0,
+    -0x1.4858ab71bf9eep+0,
+    -0x1.487bf2aa97872p+0,
+    -0x1.489f318291382p+0,
+    -0x1.48c267f6022e3p+0,
+    -0x1.48e596013fe59p+0,
+    -0x1.4908bba0d70f7p+0,
+    -0x1.492bd8d18b92p+0,
+    -0x1.494eed9021535p+0,
+    -0x1.4971f9d87f65dp+0,
+    -0x1.4994fda7d8198p+0,
+    -0x1.49b7f8fa80eabp+0,
+    -0x1.49daebcc29b6dp+0,
+    -0x1.49fdd6199664p+0,
+    -0x1.4a20b7df1c6e9p+0,
+    -0x1.4a4391197fbcap+0,
+    -0x1.4a6661c515ca7p+0,
+    -0x1.4a8929dea27e2p+0,
+    -0x1.4aabe9620cea2p+0,
+    -0x1.4acea04b3c20ep+0,
+    -0x1.4af14e972b3d7p+0,
+    -0x1.4b13f44266f1p+0,
+    -0x1.4b369148d64dfp+0,
+    -0x1.4b5925a706058p+0,
+    -0x1.4b7bb15982c8ep+0,
+    -0x1.4b9e345bc540bp+0,
+    -0x1.4bc0aeaac887fp+0,
+    -0x1.4be32042e21afp+0,
+    -0x1.4c05891ff90c1p+0,
+    -0x1.4c27e93e62d7ap+0,
+    -0x1.4c4a409a74f9ep+0,
+    -0x1.4c6c8f30bc241p+0,
+    -0x1.4c8ed4fc79c9dp+0,
+    -0x1.4cb111fa71d14p+0,
+    -0x1.4cd34626f9b6ap+0,
+    -0x1.4cf5717d52edap+0,
+    -0x1.4d1793fa78915p+0,
+    -0x1.4d39ad9ac01dfp+0,
+    -0x1.4d5bbe59d971p+0,
+    -0x1.4d7dc6348870ap+0,
+    -0x1.4d9fc52645c56p+0,
+    -0x1.4dc1bb2af881cp+0,
+    -0x1.4de3a83fd2f5ap+0,
+    -0x1.4e058c601694cp+0,
+    -0x1.4e276787e1a66p+0,
+    -0x1.4e4939b389a6ep+0,
+    -0x1.4e6b02de5009dp+0,
+    -0x1.4e8cc304c1807p+0,
+    -0x1.4eae7a22c51d3p+0,
+    -0x1.4ed02833d388ap+0,
+    -0x1.4ef1cd347973fp+0,
+    -0x1.4f13692143906p+0,
+    -0x1.4f34fbf53c1cap+0,
+    -0x1.4f5685ac12f63p+0,
+    -0x1.4f7806428c033p+0,
+    -0x1.4f997db457212p+0,
+    -0x1.4fbaebfc7e8ecp+0,
+    -0x1.4fdc51178efd4p+0,
+    -0x1.4ffdad01a6b3fp+0,
+    -0x1.501effb598bcbp+0,
+    -0x1.5040493028fd9p+0,
+    -0x1.5061896d3e89p+0,
+    -0x1.5082c068893c9p+0,
+    -0x1.50a3ee1d81c0cp+0,
+    -0x1.50c51286c3ea8p+0,
+    -0x1.50e62da1139fep+0,
+    -0x1.51073f688f284p+0,
+    -0x1.512847d8af2c4p+0,
+    -0x1.514946ecb51f8p+0,
+    -0x1.516a3ca050df8p+0,
+    -0x1.518b28f00f1d7p+0,
+    -0x1.51ac0bd76881ep+0,
+    -0x1.51cce551d5b57p+0,
+    -0x1.51edb55a982bcp+0,
+    -0x1.520e7becba238p+0,
+    -0x1.522f390459e41p+0,
+    -0x1.524fec9d5e7fep+0,
+    -0x1.527096b2d235bp+0,
+    -0x1.529137402dae1p+0,
+    -0x1.52b1ce4157fb7p+0,
+    -0x1.52d25bb26f652p+0,
+    -0x1.52f2df8dd88b2p+0,
+    -0x1.531359ce9dac2p+0,
+    -0x1.5333ca7114447p+0,
+    -0x1.535431700f5ddp+0,
+    -0x1.53748ec6d06bfp+0,
+    -0x1.5394e271aceb1p+0,
+    -0x1.53b52c6baf19fp+0,
+    -0x1.53d56cafaa026p+0,
+    -0x1.53f5a3394d81ep+0,
+    -0x1.5415d0041241p+0,
+    -0x1.5435f30b027e8p+0,
+    -0x1.54560c4928791p+0,
+    -0x1.54761bb9c5a46p+0,
+    -0x1.5496215852a9p+0,
+    -0x1.54b61d2010fa9p+0,
+    -0x1.54d60f0c0ad7dp+0,
+    -0x1.54f5f716a4e0bp+0,
+    -0x1.5515d53b8ef2cp+0,
+    -0x1.5535a976b0206p+0,
+    -0x1.555573c235d49p+0,
+    -0x1.55753418f3193p+0,
+    -0x1.5594ea7697cbbp+0,
+    -0x1.55b496d69c94bp+0,
+    -0x1.55d439332edf3p+0,
+    -0x1.55f3d18758e9fp+0,
+    -0x1.56135fcdb689cp+0,
+    -0x1.5632e4022ed12p+0,
+    -0x1.56525e1fcbfecp+0,
+    -0x1.5671ce20bb7dbp+0,
+    -0x1.569134003ec19p+0,
+    -0x1.56b08fb8ba6a5p+0,
+    -0x1.56cfe1456febap+0,
+    -0x1.56ef28a08cb08p+0,
+    -0x1.570e65c51af7bp+0,
+    -0x1.572d98ae24ffep+0,
+    -0x1.574cc156ec3ccp+0,
+    -0x1.576bdfba43b82p+0,
+    -0x1.578af3d144d46p+0,
+    -0x1.57a9fd97683a1p+0,
+    -0x1.57c8fd0780f3p+0,
+    -0x1.57e7f21b85355p+0,
+    -0x1.5806dcce7f3fcp+0,
+    -0x1.5825bd1b7951p+0,
+    -0x1.584492fcd809p+0,
+    -0x1.58635e6cc8d2dp+0,
+    -0x1.58821f6579197p+0,
+    -0x1.58a0d5e1bbe6bp+0,
+    -0x1.58bf81dbf5da8p+0,
+    -0x1.58de234e1d2bp+0,
+    -0x1.58fcba3304e2p+0,
+    -0x1.591b4684a3359p+0,
+    -0x1.5939c83e39996p+0,
+    -0x1.59583f59870eap+0,
+    -0x1.5976abd081cb6p+0,
+    -0x1.59950d9dc5a48p+0,
+    -0x1.59b364bb119b3p+0,
+    -0x1.59d1b12301845p+0,
+    -0x1.59eff2cff9ffep+0,
+    -0x1.5a0e29bc2878ep+0,
+    -0x1.5a2c55e183256p+0,
+    -0x1.5a4a7739c9069p+0,
+    -0x1.5a688dbeb91dap+0,
+    -0x1.5a86996b26746p+0,
+    -0x1.5aa49a3898d71p+0,
+    -0x1.5ac29021067bdp+0,
+    -0x1.5ae07b1ed4029p+0,
+    -0x1.5afe5b2b89379p+0,
+    -0x1.5b1c3040e51cp+0,
+    -0x1.5b39fa586f7c2p+0,
+    -0x1.5b57b96c1e8ep+0,
+    -0x1.5b756d75b152dp+0,
+    -0x1.5b93166f1e00bp+0,
+    -0x1.5bb0b4522398dp+0,
+    -0x1.5bce4718ef863p+0,
+    -0x1.5bebcebd40cap+0,
+    -0x1.5c094b37c25cdp+0,
+    -0x1.5c26bc82333fdp+0,
+    -0x1.5c442295acd56p+0,
+    -0x1.5c617d6bee1ebp+0,
+    -0x1.5c7eccfeb61cfp+0,
+    -0x1.5c9c11478c9c6p+0,
+    -0x1.5cb94a3fc2345p+0,
+    -0x1.5cd677e039123p+0,
+    -0x1.5cf39a22e76c3p+0,
+    -0x1.5d10b100783adp+0,
+    -0x1.5d2dbc723c157p+0,
+    -0x1.5d4abc71f1fd3p+0,
+    -0x1.5d67b0f921be5p+0,
+    -0x1.5d849a0076516p+0,
+    -0x1.5da177809aaefp+0,
+    -0x1.5dbe4973850d2p+0,
+    -0x1.5ddb0fd171faap+0,
+    -0x1.5df7ca9266d13p+0,
+    -0x1.5e1479b0c830dp+0,
+    -0x1.5e311d261de5cp+0,
+    -0x1.5e4db4ea3614dp+0,
+    -0x1.5e6a40f661556p+0,
+    -0x1.5e86c14236975p+0,
+    -0x1.5ea335c6cf3d1p+0,
+    -0x1.5ebf9e7dea47cp+0,
+    -0x1.5edbfb5e7908ap+0,
+    -0x1.5ef84c62034bep+0,
+    -0x1.5f1491816b3fp+0,
+    -0x1.5f30cab55bda8p+0,
+    -0x1.5f4cf7f68017p+0,
+    -0x1.5f69193c6ee46p+0,
+    -0x1.5f852e7fd33b3p+0,
+    -0x1.5fa137b8e9aa3p+0,
+    -0x1.5fbd34e025f4fp+0,
+    -0x1.5fd925edc4aa3p+0,
+    -0x1.5ff50ad92584fp+0,
+    -0x1.6010e39b61e79p+0,
+    -0x1.602cb02cb660cp+0,
+    -0x1.60487084b9e08p+0,
+    -0x1.6064249c175f5p+0,
+    -0x1.607fcc6951c48p+0,
+    -0x1.609b67e54b3d9p+0,
+    -0x1.60b6f70809244p+0,
+    -0x1.60d279c8b3feap+0,
+    -0x1.60edf01ff6c54p+0,
+    -0x1.61095a04545f7p+0,
+    -0x1.6124b76dd227p+0,
+    -0x1.61400854acaaap+0,
+    -0x1.615b4cb0e9441p+0,
+    -0x1.6176847979448p+0,
+    -0x1.6191afa4a85e4p+0,
+    -0x1.61acce29d64c6p+0,
+    -0x1.61c7e00176d28p+0,
+    -0x1.61e2e5227b41cp+0,
+    -0x1.61fddd832f4c9p+0,
+    -0x1.6218c91b29e2dp+0,
+    -0x1.6233a7e1cabf8p+0,
+    -0x1.624e79cea8d29p+0,
+    -0x1.62693ed76a2fap+0,
+    -0x1.6283f6f3a5c6ap+0,
+    -0x1.629ea21abb528p+0,
+    -0x1.62b9404250e6fp+0,
+    -0x1.62d3d1626bddbp+0,
+    -0x1.62ee557120b43p+0,
+    -0x1.6308cc63de492p+0,
+    -0x1.6323363195edap+0,
+    -0x1.633d92d17027dp+0,
+    -0x1.6357e2394a403p+0,
+    -0x1.6372245fa71e1p+0,
+    -0x1.638c593ad273dp+0,
+    -0x1.63a680c0e0beep+0,
+    -0x1.63c09ae7af47dp+0,
+    -0x1.63daa7a51b572p+0,
+    -0x1.63f4a6efa7d42p+0,
+    -0x1.640e98bc1dfebp+0,
+    -0x1.64287d016f28p+0,
+    -0x1.644253b4d2f9dp+0,
+    -0x1.645c1ccc26bcbp+0,
+    -0x1.6475d83d10843p+0,
+    -0x1.648f85fb7cbc8p+0,
+    -0x1.64a925fe2581fp+0,
+    -0x1.64c2b83a79b32p+0,
+    -0x1.64dc3ca5428ffp+0,
+    -0x1.64f5b3345d60fp+0,
+    -0x1.650f1bdc5c311p+0,
+    -0x1.6528769162a18p+0,
+    -0x1.6541c3494dfacp+0,
+    -0x1.655b01f87912ep+0,
+    -0x1.6574329375f4ep+0,
+    -0x1.658d550ed6abbp+0,
+    -0x1.65a6695ebed87p+0,
+    -0x1.65bf6f790bc3bp+0,
+    -0x1.65d867513b6fdp+0,
+    -0x1.65f150dba8b2dp+0,
+    -0x1.660a2c0c772dep+0,
+    -0x1.6622f8d67f448p+0,
+    -0x1.663bb72e8a36bp+0,
+    -0x1.6654670884709p+0,
+    -0x1.666d0858fffd2p+0,
+    -0x1.66859b13b213bp+0,
+    -0x1.669e1f2a96442p+0,
+    -0x1.66b6949198faap+0,
+    -0x1.66cefb3c38398p+0,
+    -0x1.66e7531d152f7p+0,
+    -0x1.66ff9c281c48bp+0,
+    -0x1.6717d64fb77efp+0,
+    -0x1.67300186bf35cp+0,
+    -0x1.67481dc00bd0cp+0,
+    -0x1.67602aed61aaep+0,
+    -0x1.6778290207919p+0,
+    -0x1.679017eff914bp+0,
+    -0x1.67a7f7a9a02dfp+0,
+    -0x1.67bfc820c1385p+0,
+    -0x1.67d78947c62d9p+0,
+    -0x1.67ef3b11503c5p+0,
+    -0x1.6806dd6da14dp+0,
+    -0x1.681e704eec248p+0,
+    -0x1.6835f3a686b3ep+0,
+    -0x1.684d676558827p+0,
+    -0x1.6864cb7c804c5p+0,
+    -0x1.687c1fdd1ccdbp+0,
+    -0x1.68936477de58fp+0,
+    -0x1.68aa993e8949p+0,
+    -0x1.68c1be215f865p+0,
+    -0x1.68d8d30eb21d1p+0,
+    -0x1.68efd7f7d6fe6p+0,
+    -0x1.6906cccd1012bp+0,
+    -0x1.691db17f44e15p+0,
+    -0x1.693485fd34e03p+0,
+    -0x1.694b4a35d6ba5p+0,
+    -0x1.6961fe1935233p+0,
+    -0x1.6978a1960f90dp+0,
+    -0x1.698f349bcb18p+0,
+    -0x1.69a5b7195e63bp+0,
+    -0x1.69bc28fc74e14p+0,
+    -0x1.69d28a343c709p+0,
+    -0x1.69e8dab088904p+0,
+    -0x1.69ff1a5cdc9c7p+0,
+    -0x1.6a1549282f4p+0,
+    -0x1.6a2b66ffbd7e9p+0,
+    -0x1.6a4173d01ebcdp+0,
+    -0x1.6a576f88ef448p+0,
+    -0x1.6a6d5a1620db9p+0,
+    -0x1.6a833363dc7cfp+0,
+    -0x1.6a98fb5e82588p+0,
+    -0x1.6aaeb1f2e107ep+0,
+    -0x1.6ac4570dfe59bp+0,
+    -0x1.6ad9ea9aef403p+0,
+    -0x1.6aef6c8537179p+0,
+    -0x1.6b04dcb7b39d2p+0,
+    -0x1.6b1a3b1bc01bdp+0,
+    -0x1.6b2f879e99972p+0,
+    -0x1.6b44c22b1dcc7p+0,
+    -0x1.6b59eaabbc0f3p+0,
+    -0x1.6b6f010a3e143p+0,
+    -0x1.6b84052dd7151p+0,
+    -0x1.6b98f70278d7cp+0,
+    -0x1.6badd670a1d38p+0,
+    -0x1.6bc2a361761e3p+0,
+    -0x1.6bd75dbd05c53p+0,
+    -0x1.6bec056a15985p+0,
+    -0x1.6c009a538354ep+0,
+    -0x1.6c151c5fa560ep+0,
+    -0x1.6c298b73f54e8p+0,
+    -0x1.6c3de77928c9ep+0,
+    -0x1.6c523056730cap+0,
+    -0x1.6c6665f116741p+0,
+    -0x1.6c7a882ec3c75p+0,
+    -0x1.6c8e96f372263p+0,
+    -0x1.6ca29224d257dp+0,
+    -0x1.6cb679a7ef849p+0,
+    -0x1.6cca4d60f8013p+0,
+    -0x1.6cde0d3374839p+0,
+    -0x1.6cf1b90210edep+0,
+    -0x1.6d0550b0fb94dp+0,
+    -0x1.6d18d42126b34p+0,
+    -0x1.6d2c4334988c9p+0,
+    -0x1.6d3f9dcd202f4p+0,
+    -0x1.6d52e3cb78a14p+0,
+    -0x1.6d661510cb524p+0,
+    -0x1.6d79317bab36fp+0,
+    -0x1.6d8c38eb8817ap+0,
+    -0x1.6d9f2b40775b7p+0,
+    -0x1.6db2085789848p+0,
+    -0x1.6dc4d00d60ab3p+0,
+    -0x1.6dd782416c97dp+0,
+    -0x1.6dea1ecf04252p+0,
+    -0x1.6dfca590d88f2p+0,
+    -0x1.6e0f166277e58p+0,
+    -0x1.6e21711d7f5b9p+0,
+    -0x1.6e33b59ca02d6p+0,
+    -0x1.6e45e3b718482p+0,
+    -0x1.6e57fb4684df2p+0,
+    -0x1.6e69fc2300b35p+0,
+    -0x1.6e7be622b5a94p+0,
+    -0x1.6e8db91af0d1cp+0,
+    -0x1.6e9f74ded72c8p+0,
+    -0x1.6eb11943ecff4p+0,
+    -0x1.6ec2a61e6b524p+0,
+    -0x1.6ed41b3fbd7dcp+0,
+    -0x1.6ee57878039c6p+0,
+    -0x1.6ef6bd97cc32ap+0,
+    -0x1.6f07ea6c32764p+0,
+    -0x1.6f18fec479ae4p+0,
+    -0x1.6f29fa6e2b7a3p+0,
+    -0x1.6f3add32b88cp+0,
+    -0x1.6f4ba6ddf0dbep+0,
+    -0x1.6f5c57378b747p+0,
+    -0x1.6f6cee081c34p+0,
+    -0x1.6f7d6b16461c8p+0,
+    -0x1.6f8dce264ce9cp+0,
+    -0x1.6f9e16fa4c464p+0,
+    -0x1.6fae4553149f1p+0,
+    -0x1.6fbe58f330089p+0,
+    -0x1.6fce5197fba0fp+0,
+    -0x1.6fde2efd1adfp+0,
+    -0x1.6fedf0dd5465ep+0,
+    -0x1.6ffd96f1ec663p+0,
+    -0x1.700d20f190957p+0,
+    -0x1.701c8e8f0cf08p+0,
+    -0x1.702bdf7a5fc44p+0,
+    -0x1.703b1364d29b2p+0,
+    -0x1.704a29fb27a81p+0,
+    -0x1.705922e7c1d7ep+0,
+    -0x1.7067fdd0eb29cp+0,
+    -0x1.7076ba57523cfp+0,
+    -0x1.7085581fbe9e3p+0,
+    -0x1.7093d6c6fd341p+0,
+    -0x1.70a235e5538dap+0,
+    -0x1.70b07511bbfc7p+0,
+    -0x1.70be93dd95721p+0,
+    -0x1.70cc91d7713p+0,
+    -0x1.70da6e88eab67p+0,
+    -0x1.70e8297593bbbp+0,
+    -0x1.70f5c21b62961p+0,
+    -0x1.710337f27b06dp+0,
+    -0x1.71108a6c889b8p+0,
+    -0x1.711db8f641207p+0,
+    -0x1.712ac2f3f151ep+0,
+    -0x1.7137a7c44a8bep+0,
+    -0x1.714466b944f82p+0,
+    -0x1.7150ff1b5ba77p+0,
+    -0x1.715d702e82535p+0,
+    -0x1.7169b92611cap+0,
+    -0x1.7175d92e0dd26p+0,
+    -0x1.7181cf5fee6bap+0,
+    -0x1.718d9ac8e0cc5p+0,
+    -0x1.71993a66c27d5p+0,
+    -0x1.71a4ad1ea4412p+0,
+    -0x1.71aff1c6472c9p+0,
+    -0x1.71bb0718777cep+0,
+    -0x1.71c5ebb38a254p+0,
+    -0x1.71d09e187ffafp+0,
+    -0x1.71db1c9ebaecep+0,
+    -0x1.71e56574dad7p+0,
+    -0x1.71ef769f03db3p+0,
+    -0x1.71f94dd6855e5p+0,
+    -0x1.7202e88d16222p+0,
+    -0x1.720c43df75741p+0,
+    -0x1.72155c746c8b9p+0,
+    -0x1.721e2e582564ep+0,
+    -0x1.7226b4f1626afp+0,
+    -0x1.722eed23f456ep+0,
+    -0x1.7236d63c6f273p+0,
+    -0x1.723e702de2747p+0,
+    -0x1.7245bae66815dp+0,
+    -0x1.724cb658d86eep+0,
+    -0x1.7253627270833p+0,
+    -0x1.7259bf23e0a51p+0,
+    -0x1.725fcc59c0394p+0,
+    -0x1.726589fdd8f48p+0,
+    -0x1.726af803e00e2p+0,
+    -0x1.7270165acc31p+0,
+    -0x1.7274e4f80c3bdp+0,
+    -0x1.727963c455dabp+0,
+    -0x1.727d92af45575p+0,
+    -0x1.728171a762f2dp+0,
+    -0x1.72850098a0732p+0,
+    -0x1.72883f79b7f48p+0,
+    -0x1.728b2e34732bbp+0,
+    -0x1.728dccb6ebefep+0,
+    -0x1.72901af209c85p+0,
+    -0x1.729218d1be7b1p+0,
+    -0x1.7293c64919a09p+0,
+    -0x1.7295234a16c8bp+0,
+    -0x1.72962fba2f85bp+0,
+    -0x1.7296eb8dbeadap+0,
+    -0x1.729756b4608a3p+0,
+    -0x1.7297711ac81aap+0,
+    -0x1.72973ab22fb59p+0,
+    -0x1.7296b35d7a723p+0,
+    -0x1.7295db1682ec1p+0,
+    -0x1.7294b1cf44b32p+0,
+    -0x1.7293377059d9p+0,
+    -0x1.72916bed24c59p+0,
+    -0x1.728f4f3083363p+0,
+    -0x1.728ce1296bd5dp+0,
+    -0x1.728a21c9be99dp+0,
+    -0x1.7287110133666p+0,
+    -0x1.7283aebc2a6b6p+0,
+    -0x1.727ffae9b5ee3p+0,
+    -0x1.727bf577d42b9p+0,
+    -0x1.72779e559768ep+0,
+    -0x1.7272f56da62eap+0,
+    -0x1.726dfab28610fp+0,
+    -0x1.7268ae16f3d9p+0,
+    -0x1.72630f7f3975ep+0,
+    -0x1.725d1edce40dbp+0,
+    -0x1.7256dc21ef304p+0,
+    -0x1.7250473ed3fbp+0,
+    -0x1.7249602106a66p+0,
+    -0x1.724226b8ad806p+0,
+    -0x1.723a9af487ff1p+0,
+    -0x1.7232bcbf21106p+0,
+    -0x1.722a8c0a3d0f4p+0,
+    -0x1.722208c204f6ap+0,
+    -0x1.721932d43fce5p+0,
+    -0x1.72100a329656dp+0,
+    -0x1.72068ecab3fd9p+0,
+    -0x1.71fcc084a8cfep+0,
+    -0x1.71f29f56f7b5p+0,
+    -0x1.71e82b3426413p+0,
+    -0x1.71dd6401e53b9p+0,
+    -0x1.71d249b10090fp+0,
+    -0x1.71c6dc2fc94d7p+0,
+    -0x1.71bb1b6d6d50fp+0,
+    -0x1.71af075538c2bp+0,
+    -0x1.71a29fd9959c6p+0,
+    -0x1.7195e4e8b94fbp+0,
+    -0x1.7188d66eb13d2p+0,
+    -0x1.717b745fa105cp+0,
+    -0x1.716dbea5c0c83p+0,
+    -0x1.715fb52e84bcep+0,
+    -0x1.715157e7611c4p+0,
+    -0x1.7142a6c121d32p+0,
+    -0x1.7133a1a5222c6p+0,
+    -0x1.712448868d5bp+0,
+    -0x1.71149b53b46b2p+0,
+    -0x1.710499fc8675ep+0,
+    -0x1.70f4446ffa263p+0,
+    -0x1.70e39a968df33p+0,
+    -0x1.70d29c636d0fep+0,
+    -0x1.70c149c17539ap+0,
+    -0x1.70afa2a156c2cp+0,
+    -0x1.709da6eb58ed8p+0,
+    -0x1.708b568cd457ep+0,
+    -0x1.7078b17ec6c9dp+0,
+    -0x1.7065b7aaf9f81p+0,
+    -0x1.705268fee21b2p+0,
+    -0x1.703ec56daa65ep+0,
+    -0x1.702accdea1ac7p+0,
+    -0x1.70167f417fd3p+0,
+    -0x1.7001dc88779e6p+0,
+    -0x1.6fece49e2f97p+0,
+    -0x1.6fd7976fc925fp+0,
+    -0x1.6fc1f4e69f961p+0,
+    -0x1.6fabfcf8fe99cp+0,
+    -0x1.6f95af98e1c0ep+0,
+    -0x1.6f7f0cacd6a65p+0,
+    -0x1.6f681426333b3p+0,
+    -0x1.6f50c5eb851a5p+0,
+    -0x1.6f3921f04a461p+0,
+    -0x1.6f212824fbdbdp+0,
+    -0x1.6f08d876d6df2p+0,
+    -0x1.6ef032d2e11eap+0,
+    -0x1.6ed73722077b5p+0,
+    -0x1.6ebde554a7783p+0,
+    -0x1.6ea43d5bdfd16p+0,
+    -0x1.6e8a3f27f26f6p+0,
+    -0x1.6e6feaa1cc334p+0,
+    -0x1.6e553fb672eb9p+0,
+    -0x1.6e3a3e5567479p+0,
+    -0x1.6e1ee6731fb7cp+0,
+    -0x1.6e0337f263b8ep+0,
+    -0x1.6de732c46da18p+0,
+    -0x1.6dcad6e065f7cp+0,
+    -0x1.6dae243084da3p+0,
+    -0x1.6d911aa23e814p+0,
+    -0x1.6d73ba1be952ep+0,
+    -0x1.6d56028dfe6c8p+0,
+    -0x1.6d37f3e7abaep+0,
+    -0x1.6d198e15887c1p+0,
+    -0x1.6cfad1080df43p+0,
+    -0x1.6cdbbcaea12b1p+0,
+    -0x1.6cbc50f0ac8f5p+0,
+    -0x1.6c9c8dc1e5583p+0,
+    -0x1.6c7c730ff6f31p+0,
+    -0x1.6c5c00bfec885p+0,
+    -0x1.6c3b36c7da957p+0,
+    -0x1.6c1a151023f72p+0,
+    -0x1.6bf89b87daf2dp+0,
+    -0x1.6bd6ca22d05a3p+0,
+    -0x1.6bb4a0ceaf9aap+0,
+    -0x1.6b921f77d8e4p+0,
+    -0x1.6b6f46084d1ffp+0,
+    -0x1.6b4c14710f703p+0,
+    -0x1.6b288a9df6004p+0,
+    -0x1.6b04a879a7589p+0,
+    -0x1.6ae06df35159p+0,
+    -0x1.6abbdafbf7234p+0,
+    -0x1.6a96ef7bdff9ap+0,
+    -0x1.6a71ab62df5abp+0,
+    -0x1.6a4c0ea023265p+0,
+    -0x1.6a261921e0ce4p+0,
+    -0x1.69ffcad83ea07p+0,
+    -0x1.69d923aa6fd69p+0,
+    -0x1.69b2238466369p+0,
+    -0x1.698aca5213868p+0,
+    -0x1.69631809a7de3p+0,
+    -0x1.693b0da41b6b8p+0,
+    -0x1.6912ba8f9f9aap+0,
+    -0x1.68ea351d21b8p+0,
+    -0x1.68c188e435af7p+0,
+    -0x1.6898bbf120476p+0,
+    -0x1.686fd22ee0099p+0,
+    -0x1.6846ce6eb3e57p+0,
+    -0x1.681db2d77d77bp+0,
+    -0x1.67f4811f8c723p+0,
+    -0x1.67cb3aaf3b4a8p+0,
+    -0x1.67a1e0b587782p+0,
+    -0x1.67787435a77adp+0,
+    -0x1.674ef611492c8p+0,
+    -0x1.6725670e2d215p+0,
+    -0x1.66fbc7dbdda22p+0,
+    -0x1.66d2191888d36p+0,
+    -0x1.66a85b5137eap+0,
+    -0x1.667e8f078625dp+0,
+    -0x1.6654b4b13267ep+0,
+    -0x1.662accbb087ccp+0,
+    -0x1.6600d788a9e7dp+0,
+    -0x1.65d6d57517e75p+0,
+    -0x1.65acc6d6cc623p+0,
+    -0x1.6582abfe00408p+0,
+    -0x1.655885348fd11p+0,
+    -0x1.652e52c075a9fp+0,
+    -0x1.650414e39373cp+0,
+    -0x1.64d9cbda66abfp+0,
+    -0x1.64af77dfea5d7p+0,
+    -0x1.6485192ae50b3p+0,
+    -0x1.645aafee8e4eep+0,
+    -0x1.64303c5dcaf2cp+0,
+    -0x1.6405bea714042p+0,
+    -0x1.63db36f6307acp+0,
+    -0x1.63b0a575120c9p+0,
+    -0x1.63860a4c43977p+0,
+    -0x1.635b65a243828p+0,
+    -0x1.6330b79b4c891p+0,
+    -0x1.6306005b46973p+0,
+    -0x1.62db4003831dcp+0,
+    -0x1.62b076b3d11b3p+0,
+    -0x1.6285a48b59ef2p+0,
+    -0x1.625ac9a73a827p+0,
+    -0x1.622fe63b18d8ap+0,
+    -0x1.6204fa82e86aep+0,
+    -0x1.61da06a161821p+0,
+    -0x1.61af0ab10a8bfp+0,
+    -0x1.618406cb1eb8cp+0,
+    -0x1.6158fb077260bp+0,
+    -0x1.612de77e63e04p+0,
+    -0x1.6102cc45f24dcp+0,
+    -0x1.60d7a974c25e6p+0,
+    -0x1.60ac7f210a5d6p+0,
+    -0x1.60814d5fb5587p+0,
+    -0x1.6056144577286p+0,
+    -0x1.602ad3e60b37dp+0,
+    -0x1.5fff8c557fc0cp+0,
+    -0x1.5fd43da758f8ep+0,
+    -0x1.5fa8e7ed98a38p+0,
+    -0x1.5f7d8b3aaeedap+0,
+    -0x1.5f5227a0b935p+0,
+    -0x1.5f26bd31139e1p+0,
+    -0x1.5efb4bfcabe36p+0,
+    -0x1.5ecfd41308e79p+0,
+    -0x1.5ea4558533ffcp+0,
+    -0x1.5e78d06306dddp+0,
+    -0x1.5e4d44bb62c5bp+0,
+    -0x1.5e21b29e3d03cp+0,
+    -0x1.5df61a1a3fa6ep+0,
+    -0x1.5dca7b3e30587p+0,
+    -0x1.5d9ed617f7ee2p+0,
+    -0x1.5d732ab563a32p+0,
+    -0x1.5d47792425182p+0,
+    -0x1.5d1bc17163e99p+0,
+    -0x1.5cf003aa634e6p+0,
+    -0x1.5cc43fdba5442p+0,
+    -0x1.5c98761235ccdp+0,
+    -0x1.5c6ca65ab2809p+0,
+    -0x1.5c40d0c0f7be3p+0,
+    -0x1.5c14f550c64a3p+0,
+    -0x1.5be91415fa836p+0,
+    -0x1.5bbd2d1baf8f6p+0,
+    -0x1.5b91406d8a982p+0,
+    -0x1.5b654e1638597p+0,
+    -0x1.5b395620658f1p+0,
+    -0x1.5b0d5897802e1p+0,
+    -0x1.5ae155853c841p+0,
+    -0x1.5ab54cf42bb26p+0,
+    -0x1.5a893eee8c0aep+0,
+    -0x1.5a5d2b7ddaa65p+0,
+    -0x1.5a3112ac3a3c3p+0,
+    -0x1.5a04f4830c4abp+0,
+    -0x1.59d8d10b7b1b2p+0,
+    -0x1.59aca84fa965p+0,
+    -0x1.59807a58a5d72p+0,
+    -0x1.5954472ef51cp+0,
+    -0x1.59280edbc17dp+0,
+    -0x1.58fbd167c6d99p+0,
+    -0x1.58cf8edba576bp+0,
+    -0x1.58a3473f73951p+0,
+    -0x1.5876fa9bb5df4p+0,
+    -0x1.584aa8f8d5654p+0,
+    -0x1.581e525e79fdfp+0,
+    -0x1.57f1f6d4f11efp+0,
+    -0x1.57c596645108fp+0,
+    -0x1.5799311425f84p+0,
+    -0x1.576cc6ec17c3cp+0,
+    -0x1.574057f3b2a7dp+0,
+    -0x1.5713e431f8dc8p+0,
+    -0x1.56e76bae5b03bp+0,
+    -0x1.56baee7049bf5p+0,
+    -0x1.568e6c7f1a16ep+0,
+    -0x1.5661e5e17b73p+0,
+    -0x1.56355a9e38d6dp+0,
+    -0x1.5608cabc8baf4p+0,
+    -0x1.55dc3642d095bp+0,
+    -0x1.55af9d37b6f2cp+0,
+    -0x1.5582ffa1d294ap+0,
+    -0x1.55565d87b7499p+0,
+    -0x1.5529b6eff8dfdp+0,
+    -0x1.54fd0be08586cp+0,
+    -0x1.54d05c5f67084p+0,
+    -0x1.54a3a87331329p+0,
+    -0x1.5476f02277d3fp+0,
+    -0x1.544a3372bab1ep+0,
+    -0x1.541d7269952c8p+0,
+    -0x1.53f0ad0cf5733p+0,
+    -0x1.53c3e36276e6p+0,
+    -0x1.53971570234eep+0,
+    -0x1.536a433be8dd3p+0,
+    -0x1.533d6ccb47569p+0,
+    -0x1.53109223874bap+0,
+    -0x1.52e3b34a441c7p+0,
+    -0x1.52b6d04519291p+0,
+    -0x1.5289e918fc32dp+0,
+    -0x1.525cfdcb1a2fdp+0,
+    -0x1.52300e60bbb0cp+0,
+    -0x1.52031adf0dabdp+0,
+    -0x1.51d6234b744c3p+0,
+    -0x1.51a927ab00ed8p+0,
+    -0x1.517c2802721c3p+0,
+    -0x1.514f245686649p+0,
+    -0x1.51221cac17ed7p+0,
+    -0x1.50f5110853adp+0,
+    -0x1.50c8016fdc953p+0,
+    -0x1.509aede75597dp+0,
+    -0x1.506dd673460c6p+0,
+    -0x1.5040bb18354a4p+0,
+    -0x1.50139bdb34ad3p+0,
+    -0x1.4fe678c0cb8c9p+0,
+    -0x1.4fb951cd2e707p+0,
+    -0x1.4f8c2704ad7b6p+0,
+    -0x1.4f5ef86beb9f3p+0,
+    -0x1.4f31c6071d63fp+0,
+    -0x1.4f048fda92ec2p+0,
+    -0x1.4ed755ea9c5a4p+0,
+    -0x1.4eaa183b37016p+0,
+    -0x1.4e7cd6d09769ap+0,
+    -0x1.4e4f91af294fep+0,
+    -0x1.4e2248db58712p+0,
+    -0x1.4df4fc58b3b6ap+0,
+    -0x1.4dc7ac2b540ep+0,
+    -0x1.4d9a5856ff956p+0,
+    -0x1.4d6d00dfb39fep+0,
+    -0x1.4d3fa5c9a4b59p+0,
+    -0x1.4d12471861bfbp+0,
+    -0x1.4ce4e4d003abdp+0,
+    -0x1.4cb77ef3e22e4p+0,
+    -0x1.4c8a15881634ap+0,
+    -0x1.4c5ca8909d12p+0,
+    -0x1.4c2f3810ea153p+0,
+    -0x1.4c01c40c708dp+0,
+    -0x1.4bd44c86dafd3p+0,
+    -0x1.4ba6d1840b1e5p+0,
+    -0x1.4b79530758a4dp+0,
+    -0x1.4b4bd1146e146p+0,
+    -0x1.4b1e4bae6bec6p+0,
+    -0x1.4af0c2d8fcb09p+0,
+    -0x1.4ac33697e67f2p+0,
+    -0x1.4a95a6ee49d77p+0,
+    -0x1.4a6813df62d37p+0,
+    -0x1.4a3a7d6e89277p+0,
+    -0x1.4a0ce39f30223p+0,
+    -0x1.49df4674af782p+0,
+    -0x1.49b1a5f25edd8p+0,
+    -0x1.4984021b43375p+0,
+    -0x1.49565af27d04fp+0,
+    -0x1.4928b07b48604p+0,
+    -0x1.48fb02b918981p+0,
+    -0x1.48cd51af29c64p+0,
+    -0x1.489f9d60499adp+0,
+    -0x1.4871e5cf7cfacp+0,
+    -0x1.48442affc8cafp+0,
+    -0x1.48166cf44d8aep+0,
+    -0x1.47e8abb02bb9ep+0,
+    -0x1.47bae7364ca28p+0,
+    -0x1.478d1f89998f3p+0,
+    -0x1.475f54ad32ff6p+0,
+    -0x1.473186a4023d9p+0,
+    -0x1.4703b5709dc4ep+0,
+    -0x1.46d5e115d3454p+0,
+    -0x1.46a809968c094p+0,
+    -0x1.467a2ef5b15b5p+0,
+    -0x1.464c513648207p+0,
+    -0x1.461e705b1e089p+0,
+    -0x1.45f08c66adf47p+0,
+    -0x1.45c2a55b8e5f1p+0,
+    -0x1.4594bb3ca893p+0,
+    -0x1.4566ce0cca403p+0,
+    -0x1.4538ddce6e475p+0,
+    -0x1.450aea8446bdfp+0,
+    -0x1.44dcf43121542p+0,
+    -0x1.44aefad79484fp+0,
+    -0x1.4480fe7a5265fp+0,
+    -0x1.4452ff1bf1723p+0,
+    -0x1.4424fcbeb5557p+0,
+    -0x1.43f6f76518f05p+0,
+    -0x1.43c8ef11e9f2dp+0,
+    -0x1.439ae3c787a33p+0,
+    -0x1.436cd58851479p+0,
+    -0x1.433ec456dd5bp+0,
+    -0x1.4310b035c258bp+0,
+    -0x1.42e299277b213p+0,
+    -0x1.42b47f2e2fc5cp+0,
+    -0x1.4286624c5b271p+0,
+    -0x1.425842847825cp+0,
+    -0x1.422a1fd8e607fp+0,
+    -0x1.41fbfa4bccdefp+0,
+    -0x1.41cdd1df8bf0ep+0,
+    -0x1.419fa6969e1e6p+0,
+    -0x1.417178737e482p+0,
+    -0x1.4143477838e4ep+0,
+    -0x1.411513a6a3368p+0,
+    -0x1.40e6dd01a6878p+0,
+    -0x1.40b8a38b86839p+0,
+    -0x1.408a6746186c9p+0,
+    -0x1.405c28339fee4p+0,
+    -0x1.402de65660b44p+0,
+    -0x1.3fffa1b09e6a6p+0,
+    -0x1.3fd15a449cbc4p+0,
+    -0x1.3fa310146820bp+0,
+    -0x1.3f74c321f1741p+0,
+    -0x1.3f46736f97fc8p+0,
+    -0x1.3f1820ff83cb4p+0,
+    -0x1.3ee9cbd38a223p+0,
+    -0x1.3ebb73edd3129p+0,
+    -0x1.3e8d19506b132p+0,
+    -0x1.3e5ebbfd7a352p+0,
+    -0x1.3e305bf70cef7p+0,
+    -0x1.3e01f93f4b534p+0,
+    -0x1.3dd393d8263cep+0,
+    -0x1.3da52bc38e88ap+0,
+    -0x1.3d76c1037512ep+0,
+    -0x1.3d48539a01ecdp+0,
+    -0x1.3d19e3895d27cp+0,
+    -0x1.3ceb70d2ed9bbp+0,
+    -0x1.3cbcfb78f6f45p+0,
+    -0x1.3c8e837d6a0dfp+0,
+    -0x1.3c6008e2009p+0,
+    -0x1.3c318ba8c6f14p+0,
+    -0x1.3c030bd3ae0ep+0,
+    -0x1.3bd489648b283p+0,
+    -0x1.3ba6045d4f1c1p+0,
+    -0x1.3b777cbfeac6p+0,
+    -0x1.3b48f28e17cd6p+0,
+    -0x1.3b1a65c9c70e8p+0,
+    -0x1.3aebd674b230dp+0,
+    -0x1.3abd4490ae762p+0,
+    -0x1.3a8eb01f91205p+0,
+    -0x1.3a6019232f714p+0,
+    -0x1.3a317f9d5eaadp+0,
+    -0x1.3a02e38fd8746p+0,
+    -0x1.39d444fc56756p+0,
+    -0x1.39a5a3e476babp+0,
+    -0x1.3977004a2a20bp+0,
+    -0x1.39485a2f6183bp+0,
+    -0x1.3919b19583bbbp+0,
+    -0x1.38eb067e2ed5ap+0,
+    -0x1.38bc58eb8ae2cp+0,
+    -0x1.388da8df518a8p+0,
+    -0x1.385ef65ab26ffp+0,
+    -0x1.3830415f673a7p+0,
+    -0x1.380189ef60c65p+0,
+    -0x1.37d2d00c3d209p+0,
+    -0x1.37a413b79a561p+0,
+    -0x1.377554f31673dp+0,
+    -0x1.374693c06b212p+0,
+    -0x1.3717d021366bp+0,
+    -0x1.36e90a17165e6p+0,
+    -0x1.36ba41a3a9083p+0,
+    -0x1.368b76c870daep+0,
+    -0x1.365ca9870be36p+0,
+    -0x1.362dd9e0fc943p+0,
+    -0x1.35ff07d7fc94cp+0,
+    -0x1.35d0336d8e578p+0,
+    -0x1.35a15ca318b47p+0,
+    -0x1.3572837a39b88p+0,
+    -0x1.3543a7f4583bbp+0,
+    -0x1.3514ca1380b4dp+0,
+    -0x1.34e5e9d935966p+0,
+    -0x1.34b707468ae8fp+0,
+    -0x1.3488225d3a53fp+0,
+    -0x1.34593b1ec649dp+0,
+    -0x1.342a518c7a083p+0,
+    -0x1.33fb65a7d8017p+0,
+    -0x1.33cc777299dd1p+0,
+    -0x1.339d86edd3a3ap+0,
+    -0x1.336e941b3efc8p+0,
+    -0x1.333f9efc958f2p+0,
+    -0x1.3310a792eb642p+0,
+    -0x1.32e1addf8bb91p+0,
+    -0x1.32b2b1e3f9007p+0,
+    -0x1.3283b3a1ece19p+0,
+    -0x1.3254b31a96ffap+0,
+    -0x1.3225b04f79cdp+0,
+    -0x1.31f6ab41e0875p+0,
+    -0x1.31c7a3f332069p+0,
+    -0x1.31989a650c57ap+0,
+    -0x1.31698e98bab82p+0,
+    -0x1.313a808f88659p+0,
+    -0x1.310b704ac09d8p+0,
+    -0x1.30dc5dcbe5d27p+0,
+    -0x1.30ad49144341ep+0,
+    -0x1.307e322524297p+0,
+    -0x1.304f18ffef611p+0,
+    -0x1.301ffda60bc0dp+0,
+    -0x1.2ff0e018a8ebcp+0,
+    -0x1.2fc1c0592db9ep+0,
+    -0x1.2f929e6901033p+0,
+    -0x1.2f637a4936d06p+0,
+    -0x1.2f3453fb1a5efp+0,
+    -0x1.2f052b7ff6ec7p+0,
+    -0x1.2ed600d96a85dp+0,
+    -0x1.2ea6d408c068ap+0,
+    -0x1.2e77a50f0c9d8p+0,
+    -0x1.2e4873ed9a61fp+0,
+    -0x1.2e1940a5b4f39p+0,
+    -0x1.2dea0b38a78fep+0,
+    -0x1.2dbad3a7863f8p+0,
+    -0x1.2d8b99f380a58p+0,
+    -0x1.2d5c5e1de1ff8p+0,
+    -0x1.2d2d202811257p+0,
+    -0x1.2cfde0135954fp+0,
+    -0x1.2cce9de0ea31p+0,
+    -0x1.2c9f5991d7c25p+0,
+    -0x1.2c70132751abfp+0,
+    -0x1.2c40caa2a32b7p+0,
+    -0x1.2c118005177e6p+0,
+    -0x1.2be2334fde47dp+0,
+    -0x1.2bb2e4840b906p+0,
+    -0x1.2b8393a2cefb2p+0,
+    -0x1.2b5440ad3c90cp+0,
+    -0x1.2b24eba49f8ecp+0,
+    -0x1.2af5948a4332bp+0,
+    -0x1.2ac63b5f3b853p+0,
+    -0x1.2a96e02480f47p+0,
+    -0x1.2a6782db5ebdfp+0,
+    -0x1.2a3823853bb9cp+0,
+    -0x1.2a08c2231056p+0,
+    -0x1.29d95eb5d500ep+0,
+    -0x1.29a9f93eb95d7p+0,
+    -0x1.297a91beed0ecp+0,
+    -0x1.294b2837841d8p+0,
+    -0x1.291bbca9c9c73p+0,
+    -0x1.28ec4f16d2148p+0,
+    -0x1.28bcdf7f95739p+0,
+    -0x1.288d6de55f21fp+0,
+    -0x1.285dfa4943283p+0,
+    -0x1.282e84ac39f49p+0,
+    -0x1.27ff0d0f578fap+0,
+    -0x1.27cf9373b002p+0,
+    -0x1.27a017da201f7p+0,
+    -0x1.27709a43f3257p+0,
+    -0x1.27411ab274519p+0,
+    -0x1.2711992664dd1p+0,
+    -0x1.26e215a0d8d09p+0,
+    -0x1.26b29022ffcf2p+0,
+    -0x1.268308ae097bep+0,
+    -0x1.26537f42d2aa8p+0,
+    -0x1.2623f3e26f63ap+0,
+    -0x1.25f4668df3afep+0,
+    -0x1.25c4d7463c62fp+0,
+    -0x1.2595460c791fep+0,
+    -0x1.2565b2e1bdef5p+0,
+    -0x1.25361dc6e7a5p+0,
+    -0x1.250686bceeaf1p+0,
+    -0x1.24d6edc51e4b1p+0,
+    -0x1.24a752e0534ccp+0,
+    -0x1.2477b60f6a87cp+0,
+    -0x1.24481753939f3p+0,
+    -0x1.241876ade29bbp+0,
+    -0x1.23e8d41f18b67p+0,
+    -0x1.23b92fa82e5dap+0,
+    -0x1.2389894a53346p+0,
+    -0x1.2359e106640e6p+0,
+    -0x1.232a36dd74f43p+0,
+    -0x1.22fa8ad062b99p+0,
+    -0x1.22cadce025ccbp+0,
+    -0x1.229b2d0dd2362p+0,
+    -0x1.226b7b5a60642p+0,
+    -0x1.223bc7c6c8c4cp+0,
+    -0x1.220c1253cc915p+0,
+    -0x1.21dc5b027fd26p+0,
+    -0x1.21aca1d3daf63p+0,
+    -0x1.217ce6c8bad06p+0,
+    -0x1.214d29e1fc34ap+0,
+    -0x1.211d6b20b32bap+0,
+    -0x1.20edaa85f3bdfp+0,
+    -0x1.20bde8129abf5p+0,
+    -0x1.208e23c785037p+0,
+    -0x1.205e5da573c39p+0,
+    -0x1.202e95ad43d35p+0,
+    -0x1.1ffecbdfeda0fp+0,
+    -0x1.1fcf003e8535p+0,
+    -0x1.1f9f32c9e7634p+0,
+    -0x1.1f6f63830c99dp+0,
+    -0x1.1f3f926ad1ac7p+0,
+    -0x1.1f0fbf81f7d45p+0,
+    -0x1.1edfeac9931a1p+0,
+    -0x1.1eb0144280517p+0,
+    -0x1.1e803bed80b3ap+0,
+    -0x1.1e5061cb71145p+0,
+    -0x1.1e2085dd49e1bp+0,
+    -0x1.1df0a8240389fp+0,
+    -0x1.1dc0c8a05f464p+0,
+    -0x1.1d90e75339ea6p+0,
+    -0x1.1d61043d704ap+0,
+    -0x1.1d311f5fdf38dp+0,
+    -0x1.1d0138bb7f24fp+0,
+    -0x1.1cd15050f5ad3p+0,
+    -0x1.1ca166211fa54p+0,
+    -0x1.1c717a2cf57b5p+0,
+    -0x1.1c418c7554031p+0,
+    -0x1.1c119cfb18103p+0,
+    -0x1.1be1abbf02dbfp+0,
+    -0x1.1bb1b8c20cd48p+0,
+    -0x1.1b81c404bffe2p+0,
+    -0x1.1b51cd87f92c9p+0,
+    -0x1.1b21d54ccc687p+0,
+    -0x1.1af1db53faeafp+0,
+    -0x1.1ac1df9e6187dp+0,
+    -0x1.1a91e22cc1785p+0,
+    -0x1.1a61e2fff7901p+0,
+    -0x1.1a31e218c5086p+0,
+    -0x1.1a01df7806b4fp+0,
+    -0x1.19d1db1e62348p+0,
+    -0x1.19a1d50c98c04p+0,
+    -0x1.1971cd43a2c67p+0,
+    -0x1.1941c3c45d1acp+0,
+    -0x1.1911b88f88f66p+0,
+    -0x1.18e1aba5cbf82p+0,
+    -0x1.18b19d081e8e2p+0,
+    -0x1.18818cb741f1bp+0,
+    -0x1.18517ab3dbc18p+0,
+    -0x1.182166fec8d15p+0,
+    -0x1.17f15198ca5a6p+0,
+    -0x1.17c13a82bd306p+0,
+    -0x1.179121bd628c8p+0,
+    -0x1.17610749600d9p+0,
+    -0x1.1730eb2776ecdp+0,
+    -0x1.1700cd5883fdfp+0,
+    -0x1.16d0addd6414ap+0,
+    -0x1.16a08cb6d86a2p+0,
+    -0x1.167069e5869d4p+0,
+    -0x1.1640456a2fe73p+0,
+    -0x1.16101f4579e6cp+0,
+    -0x1.15dff7780a3abp+0,
+    -0x1.15afce02f4ebap+0,
+    -0x1.157fa2e6df985p+0,
+    -0x1.154f76246fdf9p+0,
+    -0x1.151f47bc82951p+0,
+    -0x1.14ef17afa1bd2p+0,
+    -0x1.14bee5feaa2b7p+0,
+    -0x1.148eb2aa944e3p+0,
+    -0x1.145e7db3ce8f3p+0,
+    -0x1.142e471afe8d4p+0,
+    -0x1.13fe0ee1011c1p+0,
+    -0x1.13cdd5067bda6p+0,
+    -0x1.139d998c30017p+0,
+    -0x1.136d5c72deca8p+0,
+    -0x1.133d1dbb496edp+0,
+    -0x1.130cdd6631279p+0,
+    -0x1.12dc9b74045ebp+0,
+    -0x1.12ac57e5844d6p+0,
+    -0x1.127c12bba961cp+0,
+    -0x1.124bcbf6fda03p+0,
+    -0x1.121b83980b0cfp+0,
+    -0x1.11eb399fe5b0bp+0,
+    -0x1.11baee0f332a2p+0,
+    -0x1.118aa0e64648cp+0,
+    -0x1.115a5226177aap+0,
+    -0x1.112a01cf30c42p+0,
+    -0x1.10f9afe237c4p+0,
+    -0x1.10c95c6024e87p+0,
+    -0x1.109907498235bp+0,
+    -0x1.1068b09ed9b02p+0,
+    -0x1.10385860ec91p+0,
+    -0x1.1007fe907c118p+0,
+    -0x1.0fd7a32df69b8p+0,
+    -0x1.0fa7463a1d683p+0,
+    -0x1.0f76e7b5cd4b5p+0,
+    -0x1.0f4687a190493p+0,
+    -0x1.0f1625fe279b1p+0,
+    -0x1.0ee5c2cc38dfbp+0,
+    -0x1.0eb55e0c3280ep+0,
+    -0x1.0e84f7bed5b7fp+0,
+    -0x1.0e548fe4e3be1p+0,
+    -0x1.0e24267f02321p+0,
+    -0x1.0df3bb8dd6b2bp+0,
+    -0x1.0dc34f1206debp+0,
+    -0x1.0d92e10c3854ep+0,
+    -0x1.0d62717d10b4p+0,
+    -0x1.0d320065359aep+0,
+    -0x1.0d018dc5310dcp+0,
+    -0x1.0cd1199da8ab7p+0,
+    -0x1.0ca0a3ef26784p+0,
+    -0x1.0c702cba8747ep+0,
+    -0x1.0c3fb40070b92p+0,
+    -0x1.0c0f39c15135dp+0,
+    -0x1.0bdebdfde9f73p+0,
+    -0x1.0bae40b6c5019p+0,
+    -0x1.0b7dc1eca38e3p+0,
+    -0x1.0b4d41a02b3bdp+0,
+    -0x1.0b1cbfd201a94p+0,
+    -0x1.0aec3c8279a5dp+0,
+    -0x1.0abbb7b21d35ep+0,
+    -0x1.0a8b3161c92d2p+0,
+    -0x1.0a5aa992232a5p+0,
+    -0x1.0a2a2043d0cc4p+0,
+    -0x1.09f995775c174p+0,
+    -0x1.09c9092d4f0fap+0,
+    -0x1.09987b6633b9ap+0,
+    -0x1.0967ec22e6e9p+0,
+    -0x1.09375b63d707ap+0,
+    -0x1.0906c9298e19cp+0,
+    -0x1.08d63574cd58bp+0,
+    -0x1.08a5a046032e3p+0,
+    -0x1.0875099dd5392p+0,
+    -0x1.0844717ce9184p+0,
+    -0x1.0813d7e3e46a5p+0,
+    -0x1.07e33cd335992p+0,
+    -0x1.07b2a04b66a91p+0,
+    -0x1.0782024d546ddp+0,
+    -0x1.075162d988ebbp+0,
+    -0x1.0720c1f056f21p+0,
+    -0x1.06f01f927fba3p+0,
+    -0x1.06bf7bc08d486p+0,
+    -0x1.068ed67aee067p+0,
+    -0x1.065e2fc2632dap+0,
+    -0x1.062d87975b27dp+0,
+    -0x1.05fcddfa972e4p+0,
+    -0x1.05cc32eca1454p+0,
+    -0x1.059b866e03711p+0,
+    -0x1.056ad87f47b61p+0,
+    -0x1.053a2920dc7e1p+0,
+    -0x1.0509785383025p+0,
+    -0x1.04d8c617a9acbp+0,
+    -0x1.04a8126dda817p+0,
+    -0x1.04775d56d6b9ep+0,
+    -0x1.0446a6d30cbfdp+0,
+    -0x1.0415eee2eafd1p+0,
+    -0x1.03e5358732aafp+0,
+    -0x1.03b47ac089683p+0,
+    -0x1.0383be8f2669bp+0,
+    -0x1.035300f3af4e4p+0,
+    -0x1.032241eec9b4bp+0,
+    -0x1.02f18180e406dp+0,
+    -0x1.02c0bfaaa3e36p+0,
+    -0x1.028ffc6c934ecp+0,
+    -0x1.025f37c720b2cp+0,
+    -0x1.022e71bad613bp+0,
+    -0x1.01fdaa4859105p+0,
+    -0x1.01cce17033acfp+0,
+    -0x1.019c1732d4537p+0,
+    -0x1.016b4b90c5082p+0,
+    -0x1.013a7e8aab69dp+0,
+    -0x1.0109b020f5e25p+0,
+    -0x1.00d8e0544a106p+0,
+    -0x1.00a80f2531f85p+0,
+    -0x1.00773c93e4cf2p+0,
+    -0x1.004668a108338p+0,
+    -0x1.0015934d78f93p+0,
+    -0x1.ffc9793313df2p-1,
+    -0x1.ff67c90ae4971p-1,
+    -0x1.ff061623e68cbp-1,
+    -0x1.fea4607f2dc8ap-1,
+    -0x1.fe42a81d971eap-1,
+    -0x1.fde0ed0036974p-1,
+    -0x1.fd7f2f28203b2p-1,
+    -0x1.fd1d6e9630dep-1,
+    -0x1.fcbbab4b7c887p-1,
+    -0x1.fc59e5494e78p-1,
+    -0x1.fbf81c9083807p-1,
+    -0x1.fb9651222faa5p-1,
+    -0x1.fb3482fef8947p-1,
+    -0x1.fad2b227bb128p-1,
+    -0x1.fa70de9dc2621p-1,
+    -0x1.fa0f086290f59p-1,
+    -0x1.f9ad2f76cc6bdp-1,
+    -0x1.f94b53dae32ebp-1,
+    -0x1.f8e975908ee58p-1,
+    -0x1.f8879498ac64p-1,
+    -0x1.f825b0f3aa141p-1,
+    -0x1.f7c3caa2d3333p-1,
+    -0x1.f761e1a772ffp-1,
+    -0x1.f6fff601f7e14p-1,
+    -0x1.f69e07b33eadbp-1,
+    -0x1.f63c16bd010bcp-1,
+    -0x1.f5da23201bcf1p-1,
+    -0x1.f5782cdd34967p-1,
+    -0x1.f51633f55f6a8p-1,
+    -0x1.f4b43869b053ep-1,
+    -0x1.f4523a3accf15p-1,
+    -0x1.f3f03969c94b8p-1,
+    -0x1.f38e35f782361p-1,
+    -0x1.f32c2fe4661aep-1,
+    -0x1.f2ca27322ea16p-1,
+    -0x1.f2681be25e3cp-1,
+    -0x1.f2060df52c1fbp-1,
+    -0x1.f1a3fd6b06b64p-1,
+    -0x1.f141ea45393d5p-1,
+    -0x1.f0dfd484d7bd7p-1,
+    -0x1.f07dbc2a87d56p-1,
+    -0x1.f01ba13794c2cp-1,
+    -0x1.efb983acdb594p-1,
+    -0x1.ef57638b0137ap-1,
+    -0x1.eef540d31a668p-1,
+    -0x1.ee931b863aee8p-1,
+    -0x1.ee30f3a53fa35p-1,
+    -0x1.edcec9313c8d9p-1,
+    -0x1.ed6c9c2b0e81p-1,
+    -0x1.ed0a6c9323e77p-1,
+    -0x1.eca83a6a90c98p-1,
+    -0x1.ec4605b2a064bp-1,
+    -0x1.ebe3ce6bf857ep-1,
+    -0x1.eb8194973e41cp-1,
+    -0x1.eb1f5835bd5ffp-1,
+    -0x1.eabd194852861p-1,
+    -0x1.ea5ad7cfa352fp-1,
+    -0x1.e9f893cc8c9a4p-1,
+    -0x1.e9964d3feb2fcp-1,
+    -0x1.e934042ad31cp-1,
+    -0x1.e8d1b88e2132cp-1,
+    -0x1.e86f6a6ab247ap-1,
+    -0x1.e80d19c1632e6p-1,
+    -0x1.e7aac69310bacp-1,
+    -0x1.e74870e097c06p-1,
+    -0x1.e6e618ab0c47ep-1,
+    -0x1.e683bdf34b25p-1,
+    -0x1.e62160b9f9f68p-1,
+    -0x1.e5bf00fff5901p-1,
+    -0x1.e55c9ec5e3907p-1,
+    -0x1.e4fa3a0cd8005p-1,
+    -0x1.e497d2d5afb36p-1,
+    -0x1.e4356921477d4p-1,
+    -0x1.e3d2fcf0b366ap-1,
+    -0x1.e3708e44990e5p-1,
+    -0x1.e30e1d1dd547fp-1,
+    -0x1.e2aba97d44e74p-1,
+    -0x1.e24933638d8bp-1,
+    -0x1.e1e6bad18c06ep-1,
+    -0x1.e1843fc854638p-1,
+    -0x1.e121c248faa99p-1,
+    -0x1.e0bf4253ed42dp-1,
+    -0x1.e05cbfe9d1ce2p-1,
+    -0x1.dffa3b0bf389p-1,
+    -0x1.df97b3bb2f472p-1,
+    -0x1.df3529f7bc3d7p-1,
+    -0x1.ded29dc2773fap-1,
+    -0x1.de700f1ce2c03p-1,
+    -0x1.de0d7e07a45dep-1,
+    -0x1.ddaaea832a829p-1,
+    -0x1.dd4854908936ep-1,
+    -0x1.dce5bc309d4e8p-1,
+    -0x1.dc832164439d2p-1,
+    -0x1.dc20842c21c19p-1,
+    -0x1.dbbde488dd5a9p-1,
+    -0x1.db5b427b533bdp-1,
+    -0x1.daf89e046039p-1,
+    -0x1.da95f724e125ep-1,
+    -0x1.da334ddd7ba13p-1,
+    -0x1.d9d0a22f43b39p-1,
+    -0x1.d96df41b4d65ap-1,
+    -0x1.d90b43a207213p-1,
+    -0x1.d8a890c3a81b4p-1,
+    -0x1.d845db817b915p-1,
+    -0x1.d7e323dc5e571p-1,
+    -0x1.d78069d4bed66p-1,
+    -0x1.d71dad6be84cdp-1,
+    -0x1.d6baeea280592p-1,
+    -0x1.d6582d792c9a1p-1,
+    -0x1.d5f569f101185p-1,
+    -0x1.d592a40aa372ap-1,
+    -0x1.d52fdbc68212dp-1,
+    -0x1.d4cd112579ccap-1,
+    -0x1.d46a44286773cp-1,
+    -0x1.d40774cff0a6fp-1,
+    -0x1.d3a4a31cf239fp-1,
+    -0x1.d341cf1080355p-1,
+    -0x1.d2def8ab4037ep-1,
+    -0x1.d27c1feda0ab7p-1,
+    -0x1.d21944d8b598bp-1,
+    -0x1.d1b6676d5bd35p-1,
+    -0x1.d15387ac01c52p-1,
+    -0x1.d0f0a5954d0cep-1,
+    -0x1.d08dc12a1a7e5p-1,
+    -0x1.d02ada6b46ed2p-1,
+    -0x1.cfc7f159af2d1p-1,
+    -0x1.cf6505f63011cp-1,
+    -0x1.cf02184138051p-1,
+    -0x1.ce9f283ba3dabp-1,
+    -0x1.ce3c35e619317p-1,
+    -0x1.cdd941413da81p-1,
+    -0x1.cd764a4e25473p-1,
+    -0x1.cd13510d3e78bp-1,
+    -0x1.ccb0557f66103p-1,
+    -0x1.cc4d57a541ac9p-1,
+    -0x1.cbea577fae217p-1,
+    -0x1.cb87550f510dap-1,
+    -0x1.cb245054d00fep-1,
+    -0x1.cac149517665cp-1,
+    -0x1.ca5e40057b443p-1,
+    -0x1.c9fb34714d15p-1,
+    -0x1.c9982695ffe0dp-1,
+    -0x1.c9351674707b6p-1,
+    -0x1.c8d2040d0d4e8p-1,
+    -0x1.c86eef607bf9p-1,
+    -0x1.c80bd87007b86p-1,
+    -0x1.c7a8bf3c562b7p-1,
+    -0x1.c745a3c567522p-1,
+    -0x1.c6e2860c4f352p-1,
+    -0x1.c67f6611eaa82p-1,
+    -0x1.c61c43d6a815p-1,
+    -0x1.c5b91f5b644f6p-1,
+    -0x1.c555f8a0fc2bp-1,
+    -0x1.c4f2cfa7de11cp-1,
+    -0x1.c48fa470afa26p-1,
+    -0x1.c42c76fcbc1a6p-1,
+    -0x1.c3c9474c3aaecp-1,
+    -0x1.c366155f99c95p-1,
+    -0x1.c302e137ed72bp-1,
+    -0x1.c29faad5db49bp-1,
+    -0x1.c23c7239d1b82p-1,
+    -0x1.c1d93764e4c6ap-1,
+    -0x1.c175fa57ba13fp-1,
+    -0x1.c112bb1288d51p-1,
+    -0x1.c0af799665129p-1,
+    -0x1.c04c35e42ba02p-1,
+    -0x1.bfe8effc821c9p-1,
+    -0x1.bf85a7df9fbcdp-1,
+    -0x1.bf225d8e61549p-1,
+    -0x1.bebf1109a3b78p-1,
+    -0x1.be5bc2519e1a8p-1,
+    -0x1.bdf871679bbb3p-1,
+    -0x1.bd951e4c42385p-1,
+    -0x1.bd31c8ffc8c6dp-1,
+    -0x1.bcce71830c3a6p-1,
+    -0x1.bc6b17d6e966bp-1,
+    -0x1.bc07bbfc05ea9p-1,
+    -0x1.bba45df2d02fdp-1,
+    -0x1.bb40fdbbedd54p-1,
+    -0x1.badd9b580479ap-1,
+    -0x1.ba7a36c7b9bbbp-1,
+    -0x1.ba16d00bea6f3p-1,
+    -0x1.b9b3672504fdfp-1,
+    -0x1.b94ffc13af06bp-1,
+    -0x1.b8ec8ed8fc922p-1,
+    -0x1.b8891f755c0a1p-1,
+    -0x1.b825ade93bd86p-1,
+    -0x1.b7c23a3578d0cp-1,
+    -0x1.b75ec45a815d1p-1,
+    -0x1.b6fb4c58fb1c1p-1,
+    -0x1.b697d231c2e17p-1,
+    -0x1.b63455e5b580ep-1,
+    -0x1.b5d0d77541644p-1,
+    -0x1.b56d56e0d4f57p-1,
+    -0x1.b509d4294d081p-1,
+    -0x1.b4a64f4f4f3afp-1,
+    -0x1.b442c853812cep-1,
+    -0x1.b3df3f36887cap-1,
+    -0x1.b37bb3f8d394p-1,
+    -0x1.b318269b0811dp-1,
+    -0x1.b2b4971e39febp-1,
+    -0x1.b2510582695aap-1,
+    -0x1.b1ed71c83bc46p-1,
+    -0x1.b189dbf0c544ap-1,
+    -0x1.b12643fc3d104p-1,
+    -0x1.b0c2a9eb7ffafp-1,
+    -0x1.b05f0dbf33a38p-1,
+    -0x1.affb6f77fda8bp-1,
+    -0x1.af97cf16153f7p-1,
+    -0x1.af342c9a573b7p-1,
+    -0x1.aed088060eda4p-1,
+    -0x1.ae6ce1593c1bep-1,
+    -0x1.ae0938944d6a2p-1,
+    -0x1.ada58db81f98cp-1,
+    -0x1.ad41e0c558468p-1,
+    -0x1.acde31bc65dd4p-1,
+    -0x1.ac7a809dedfbcp-1,
+    -0x1.ac16cd6b04aaap-1,
+    -0x1.abb31823e11edp-1,
+    -0x1.ab4f60c8f1c22p-1,
+    -0x1.aaeba75b4a9d4p-1,
+    -0x1.aa87ebdb22e51p-1,
+    -0x1.aa242e48e9037p-1,
+    -0x1.a9c06ea579cc1p-1,
+    -0x1.a95cacf143a8cp-1,
+    -0x1.a8f8e92cec385p-1,
+    -0x1.a8952359504e8p-1,
+    -0x1.a8315b77158ap-1,
+    -0x1.a7cd9186731fdp-1,
+    -0x1.a769c5880eaeap-1,
+    -0x1.a705f77cc50a3p-1,
+    -0x1.a6a22765049c6p-1,
+    -0x1.a63e55417303fp-1,
+    -0x1.a5da8112b5dfap-1,
+    -0x1.a576aad93b995p-1,
+    -0x1.a512d295729aep-1,
+    -0x1.a4aef84837b8p-1,
+    -0x1.a44b1bf2308f7p-1,
+    -0x1.a3e73d93cb8b1p-1,
+    -0x1.a3835d2dae49ap-1,
+    -0x1.a31f7ac07e69ep-1,
+    -0x1.a2bb964c7320dp-1,
+    -0x1.a257afd2320d3p-1,
+    -0x1.a1f3c7529802bp-1,
+    -0x1.a18fdccddc363p-1,
+    -0x1.a12bf044db7b7p-1,
+    -0x1.a0c801b872a62p-1,
+    -0x1.a0641128d8eb3p-1,
+    -0x1.a0001e967cb48p-1,
+    -0x1.9f9c2a0203a0dp-1,
+    -0x1.9f38336c134eep-1,
+    -0x1.9ed43ad5515d8p-1,
+    -0x1.9e70403e2c368p-1,
+    -0x1.9e0c43a71243cp-1,
+    -0x1.9da84510e058fp-1,
+    -0x1.9d44447c3c14ep-1,
+    -0x1.9ce041e9cb165p-1,
+    -0x1.9c7c3d59c4923p-1,
+    -0x1.9c1836cc96f25p-1,
+    -0x1.9bb42e42e7d58p-1,
+    -0x1.9b5023bd5cda8p-1,
+    -0x1.9aec173c9ba01p-1,
+    -0x1.9a8808c112901p-1,
+    -0x1.9a23f84b67495p-1,
+    -0x1.99bfe5dbd100bp-1,
+    -0x1.995bd1732c89fp-1,
+    -0x1.98f7bb1256b8bp-1,
+    -0x1.9893a2b94f8dp-1,
+    -0x1.982f8868bca5ap-1,
+    -0x1.97cb6c217ad64p-1,
+    -0x1.97674de3f888cp-1,
+    -0x1.97032db06cf21p-1,
+    -0x1.969f0b877db0fp-1,
+    -0x1.963ae769d0642p-1,
+    -0x1.95d6c1580aaa7p-1,
+    -0x1.95729952d222ap-1,
+    -0x1.950e6f5a95369p-1,
+    -0x1.94aa436fc2502p-1,
+    -0x1.94461592c7d92p-1,
+    -0x1.93e1e5c4143b6p-1,
+    -0x1.937db4044d15bp-1,
+    -0x1.931980544f3bdp-1,
+    -0x1.92b54ab451e2ap-1,
+    -0x1.92511324faa8ep-1,
+    -0x1.91ecd9a6ef2d6p-1,
+    -0x1.91889e3a9dd9fp-1,
+    -0x1.912460e075187p-1,
+    -0x1.90c02198e352cp-1,
+    -0x1.905be0648e27ap-1,
+    -0x1.8ff79d43e400fp-1,
+    -0x1.8f9358378a7d7p-1,
+    -0x1.8f2f1140273bep-1,
+    -0x1.8ecac85e5fdb1p-1,
+    -0x1.8e667d92a2c4dp-1,
+    -0x1.8e0230dd272e1p-1,
+    -0x1.8d9de23e92b5ap-1,
+    -0x1.8d3991b753c55p-1,
+    -0x1.8cd53f47d8c7p-1,
+    -0x1.8c70eaf0fe8e6p-1,
+    -0x1.8c0c94b333855p-1,
+    -0x1.8ba83c8eaee0bp-1,
+    -0x1.8b43e2844d743p-1,
+    -0x1.8adf8694b4deap-1,
+    -0x1.8a7b28c01c54fp-1,
+    -0x1.8a16c9072975ep-1,
+    -0x1.89b2676a4aab5p-1,
+    -0x1.894e03e9ee5f2p-1,
+    -0x1.88e99e8682fb1p-1,
+    -0x1.8885374076e91p-1,
+    -0x1.8820ce186fc7ep-1,
+    -0x1.87bc630f13364p-1,
+    -0x1.8757f62506d3p-1,
+    -0x1.86f3875ab907fp-1,
+    -0x1.868f16b0610a1p-1,
+    -0x1.862aa426a4781p-1,
+    -0x1.85c62fbe28f0cp-1,
+    -0x1.8561b976ee742p-1,
+    -0x1.84fd41519aa0fp-1,
+    -0x1.8498c74ed316p-1,
+    -0x1.84344b6f063d2p-1,
+    -0x1.83cfcdb2d9b52p-1,
+    -0x1.836b4e1af31ccp-1,
+    -0x1.8306cca789a8fp-1,
+    -0x1.82a249590bc38p-1,
+    -0x1.823dc4301f0b4p-1,
+    -0x1.81d93d2d31ea1p-1,
+    -0x1.8174b450e9febp-1,
+    -0x1.8110299bb5b2fp-1,
+    -0x1.80ab9d0e0370bp-1,
+    -0x1.80470ea841a1dp-1,
+    -0x1.7fe27e6b15e51p-1,
+    -0x1.7f7dec56eea45p-1,
+    -0x1.7f19586bcbdf8p-1,
+    -0x1.7eb4c2aa8a6a6p-1,
+    -0x1.7e502b13cfe3cp-1,
+    -0x1.7deb91a7d3808p-1,
+    -0x1.7d86f6673adf6p-1,
+    -0x1.7d225952ab9f3p-1,
+    -0x1.7cbdba6a5cf4ep-1,
+    -0x1.7c5919aebd4a4p-1,
+    -0x1.7bf47720a973p-1,
+    -0x1.7b8fd2c0216f3p-1,
+    -0x1.7b2b2c8d93a8ap-1,
+    -0x1.7ac68489a5be1p-1,
+    -0x1.7a61dab4c6196p-1,
+    -0x1.79fd2f0f63247p-1,
+    -0x1.7998819a227ep-1,
+    -0x1.7933d255a9c4dp-1,
+    -0x1.78cf2141f8f8fp-1,
+    -0x1.786a6e5fb5b92p-1,
+    -0x1.7805b9afbcd91p-1,
+    -0x1.77a10332458dbp-1,
+    -0x1.773c4ae7870bep-1,
+    -0x1.76d790cfefbd8p-1,
+    -0x1.7672d4ec25416p-1,
+    -0x1.760e173c96015p-1,
+    -0x1.75a957c1b0673p-1,
+    -0x1.7544967c1a11cp-1,
+    -0x1.74dfd36c416aep-1,
+    -0x1.747b0e9294dc6p-1,
+    -0x1.741647ef82d02p-1,
+    -0x1.73b17f8379bp-1,
+    -0x1.734cb54ee7e5dp-1,
+    -0x1.72e7e9523bdb7p-1,
+    -0x1.72831b8de3fabp-1,
+    -0x1.721e4c0285e26p-1,
+    -0x1.71b97ab0c7314p-1,
+    -0x1.7154a798a7e76p-1,
+    -0x1.70efd2ba5f39ap-1,
+    -0x1.708afc16c9fbbp-1,
+    -0x1.702623ae8dcc5p-1,
+    -0x1.6fc14981aaab9p-1,
+    -0x1.6f5c6d908f034p-1,
+    -0x1.6ef78fdc17a71p-1,
+    -0x1.6e92b0647bccp-1,
+    -0x1.6e2dcf2a6110cp-1,
+    -0x1.6dc8ec2e35df3p-1,
+    -0x1.6d64076ffa375p-1,
+    -0x1.6cff20f053b7fp-1,
+    -0x1.6c9a38afe7ffdp-1,
+    -0x1.6c354eaeee43ep-1,
+    -0x1.6bd062edd4edfp-1,
+    -0x1.6b6b756d419cdp-1,
+    -0x1.6b06862da2ba5p-1,
+    -0x1.6aa1952f66b05p-1,
+    -0x1.6a3ca272fbe8bp-1,
+    -0x1.69d7adf908022p-1,
+    -0x1.6972b7c1c231ap-1,
+    -0x1.690dbfcd61ac2p-1,
+    -0x1.68a8c61c8c106p-1,
+    -0x1.6843caaf78934p-1,
+    -0x1.67decd86959ebp-1,
+    -0x1.6779cea288d16p-1,
+    -0x1.6714ce03f7ca2p-1,
+    -0x1.66afcbab19bdep-1,
+    -0x1.664ac79825e19p-1,
+    -0x1.65e5c1cb8a9fp-1,
+    -0x1.6580ba45b6601p-1,
+    -0x1.651bb1074ec39p-1,
+    -0x1.64b6a610c2334p-1,
+    -0x1.645199627f191p-1,
+    -0x1.63ec8afcf3dedp-1,
+    -0x1.63877ae0c6234p-1,
+    -0x1.6322690df5e67p-1,
+    -0x1.62bd5584f1923p-1,
+    -0x1.6258404695fa3p-1,
+    -0x1.61f32952e31e8p-1,
+    -0x1.618e10aa4768ep-1,
+    -0x1.6128f64d31434p-1,
+    -0x1.60c3da3c0f177p-1,
+    -0x1.605ebc774f4f5p-1,
+    -0x1.5ff99cff6054bp-1,
+    -0x1.5f947bd4b0917p-1,
+    -0x1.5f2f58f7ae6f6p-1,
+    -0x1.5eca3468ff8d5p-1,
+    -0x1.5e650e2912552p-1,
+    -0x1.5dffe637e6c6cp-1,
+    -0x1.5d9abc95eb4c1p-1,
+    -0x1.5d359143fcb8cp-1,
+    -0x1.5cd064421b0cep-1,
+    -0x1.5c6b35907d7d5p-1,
+    -0x1.5c06053000ddcp-1,
+    -0x1.5ba0d32113981p-1,
+    -0x1.5b3b9f63ece12p-1,
+    -0x1.5ad669f8fb22dp-1,
+    -0x1.5a7132e0acc7p-1,
+    -0x1.5a0bfa1b70379p-1,
+    -0x1.59a6bfa9b3de5p-1,
+    -0x1.5941838be6251p-1,
+    -0x1.58dc45c23e40dp-1,
+    -0x1.5877064d2a9b6p-1,
+    -0x1.5811c52d50d38p-1,
+    -0x1.57ac8262e81e2p-1,
+    -0x1.57473dee27b03p-1,
+    -0x1.56e1f7cfb5288p-1,
+    -0x1.567cb007fef0ep-1,
+    -0x1.5617669773732p-1,
+    -0x1.55b21b7e49e44p-1,
+    -0x1.554ccebcf0ae1p-1,
+    -0x1.54e78053d63a6p-1,
+    -0x1.5482304368f32p-1,
+    -0x1.541cde8c17421p-1,
+    -0x1.53b78b2e185c3p-1,
+    -0x1.5352362a11e04p-1,
+    -0x1.52ecdf8072382p-1,
+    -0x1.528787317098bp-1,
+    -0x1.52222d3d4436ep-1,
+    -0x1.51bcd1a492b18p-1,
+    -0x1.51577467ca726p-1,
+    -0x1.50f2158722ae7p-1,
+    -0x1.508cb50341047p-1,
+    -0x1.502752dc93de4p-1,
+    -0x1.4fc1ef131b3bep-1,
+    -0x1.4f5c89a745873p-1,
+    -0x1.4ef72299b85efp-1,
+    -0x1.4e91b9eaaaf8p-1,
+    -0x1.4e2c4f9a54876p-1,
+    -0x1.4dc6e3a95aabdp-1,
+    -0x1.4d6176182bcf2p-1,
+    -0x1.4cfc06e6ff265p-1,
+    -0x1.4c9696167a501p-1,
+    -0x1.4c3123a6d4816p-1,
+    -0x1.4bcbaf9844ef2p-1,
+    -0x1.4b6639eb71382p-1,
+    -0x1.4b00c2a090915p-1,
+    -0x1.4a9b49b811648p-1,
+    -0x1.4a35cf32621b8p-1,
+    -0x1.49d0530ff1204p-1,
+    -0x1.496ad550be72bp-1,
+    -0x1.490555f5387cbp-1,
+    -0x1.489fd4fe3c11fp-1,
+    -0x1.483a526c00676p-1,
+    -0x1.47d4ce3ebcb1fp-1,
+    -0x1.476f4876a8268p-1,
+    -0x1.4709c1146863ep-1,
+    -0x1.46a438186bd3fp-1,
+    -0x1.463ead82e9ab9p-1,
+    -0x1.45d921545054ap-1,
+    -0x1.4573938d0e38fp-1,
+    -0x1.450e042d91c26p-1,
+    -0x1.44a873361225ep-1,
+    -0x1.4442e0a6fdcd5p-1,
+    -0x1.43dd4c80c3228p-1,
+    -0x1.4377b6c3995a6p-1,
+    -0x1.43121f6fb7a9ep-1,
+    -0x1.42ac86858c7adp-1,
+    -0x1.4246ec05bd6bfp-1,
+    -0x1.41e14ff0b8e73p-1,
+    -0x1.417bb246b6217p-1,
+    -0x1.4116130823849p-1,
+    -0x1.40b0723538457p-1,
+    -0x1.404acfce2b99p-1,
+    -0x1.3fe52bd3a31e1p-1,
+    -0x1.3f7f8645d6098p-1,
+    -0x1.3f19df24fb905p-1,
+    -0x1.3eb43671b9513p-1,
+    -0x1.3e4e8c2c7db61p-1,
+    -0x1.3de8e0557ff3dp-1,
+    -0x1.3d8332ecf73f5p-1,
+    -0x1.3d1d83f352028p-1,
+    -0x1.3cb7d36935dc2p-1,
+    -0x1.3c52214eda011p-1,
+    -0x1.3bec6da475a65p-1,
+    -0x1.3b86b86a7735bp-1,
+    -0x1.3b2101a115e42p-1,
+    -0x1.3abb4948c01b7p-1,
+    -0x1.3a558f621b7a7p-1,
+    -0x1.39efd3ed5f361p-1,
+    -0x1.398a16eac2833p-1,
+    -0x1.3924585ab3cbbp-1,
+    -0x1.38be983d6a448p-1,
+    -0x1.3858d6931d229p-1,
+    -0x1.37f3135c7204ap-1,
+    -0x1.378d4e99d7548p-1,
+    -0x1.3727884b84473p-1,
+    -0x1.36c1c071e7468p-1,
+    -0x1.365bf70d6ebc4p-1,
+    -0x1.35f62c1e51dd7p-1,
+    -0x1.35905fa490aap-1,
+    -0x1.352a91a0d0c0cp-1,
+    -0x1.34c4c213b7c07p-1,
+    -0x1.345ef0fd45a91p-1,
+    -0x1.33f91e5de8e48p-1,
+    -0x1.33934a360fdcap-1,
+    -0x1.332d7485f1c65p-1,
+    -0x1.32c79d4dfd0b7p-1,
+    -0x1.3261c48e68e0ep-1,
+    -0x1.31fbea476c7bap-1,
+    -0x1.31960e79ad7a6p-1,
+    -0x1.313031259a471p-1,
+    -0x1.30ca524b6a169p-1,
+    -0x1.306471eb541ddp-1,
+    -0x1.2ffe9005c6c6ap-1,
+    -0x1.2f98ac9b307afp-1,
+    -0x1.2f32c7ab913abp-1,
+    -0x1.2ecce137576fcp-1,
+    -0x1.2e66f93f28b8ep-1,
+    -0x1.2e010fc33c4bp-1,
+    -0x1.2d9b24c3c95bp-1,
+    -0x1.2d3538413e52dp-1,
+    -0x1.2ccf4a3c099c4p-1,
+    -0x1.2c695ab499a12p-1,
+    -0x1.2c0369ab25967p-1,
+    -0x1.2b9d771fad7c2p-1,
+    -0x1.2b3783129fbc1p-1,
+    -0x1.2ad18d84a1f5p-1,
+    -0x1.2a6b9675eb5bfp-1,
+    -0x1.2a059de6b325cp-1,
+    -0x1.299fa3d767bc4p-1,
+    -0x1.2939a84840546p-1,
+    -0x1.28d3ab39ab58p-1,
+    -0x1.286dacac1731p-1,
+    -0x1.2807ac9fbb144p-1,
+    -0x1.27a1ab15056bap-1,
+    -0x1.273ba80c2d6c1p-1,
+    -0x1.26d5a3856a4a7p-1,
+    -0x1.266f9d812a70bp-1,
+    -0x1.260995ffdc489p-1,
+    -0x1.25a38d01b7071p-1,
+    -0x1.253d8286f1e11p-1,
+    -0x1.24d7769032756p-1,
+    -0x1.2471691de72ddp-1,
+    -0x1.240b5a30100a7p-1,
+    -0x1.23a549c6e4402p-1,
+    -0x1.233f37e3096dap-1,
+    -0x1.22d92484b6c7ep-1,
+    -0x1.22730fabec4efp-1,
+    -0x1.220cf9594fa18p-1,
+    -0x1.21a6e18d4f298p-1,
+    -0x1.2140c848221bdp-1,
+    -0x1.20daad89ffad6p-1,
+    -0x1.207491535648p-1,
+    -0x1.200e73a45d20bp-1,
+    -0x1.1fa8547d4b6c5p-1,
+    -0x1.1f4233de8f94bp-1,
+    -0x1.1edc11c89803cp-1,
+    -0x1.1e75ee3bd3235p-1,
+    -0x1.1e0fc93878284p-1,
+    -0x1.1da9a2bebe479p-1,
+    -0x1.1d437acea5813p-1,
+    -0x1.1cdd5168d373fp-1,
+    -0x1.1c77268dedbe9p-1,
+    -0x1.1c10fa3dbd2c3p-1,
+    -0x1.1baacc78b026ap-1,
+    -0x1.1b449d3f3517cp-1,
+    -0x1.1ade6c91ba696p-1,
+    -0x1.1a783a70ae856p-1,
+    -0x1.1a1206dc116bcp-1,
+    -0x1.19abd1d41a516p-1,
+    -0x1.19459b5937a03p-1,
+    -0x1.18df636bd7c1fp-1,
+    -0x1.18792a0c31ebap-1,
+    -0x1.1812ef3a7d523p-1,
+    -0x1.17acb2f7285f7p-1,
+    -0x1.17467542a17d3p-1,
+    -0x1.16e0361ce8ab8p-1,
+    -0x1.1679f5866c543p-1,
+    -0x1.1613b37fd2161p-1,
+    -0x1.15ad700919f12p-1,
+    -0x1.15472b227b1a4p-1,
+    -0x1.14e0e4cc9b304p-1,
+    -0x1.147a9d077a332p-1,
+    -0x1.141453d34f57cp-1,
+    -0x1.13ae0930c03cfp-1,
+    -0x1.1347bd200417ap-1,
+    -0x1.12e16fa1521ccp-1,
+    -0x1.127b20b4e1813p-1,
+    -0x1.1214d05b20aedp-1,
+    -0x1.11ae7e947e0f8p-1,
+    -0x1.11482b60f9a34p-1,
+    -0x1.10e1d6c101d3ep-1,
+    -0x1.107b80b5050b4p-1,
+    -0x1.1015293d3a7e4p-1,
+    -0x1.0faed05a1096cp-1,
+    -0x1.0f48760b8754dp-1,
+    -0x1.0ee21a520d224p-1,
+    -0x1.0e7bbd2e1068ep-1,
+    -0x1.0e155e9f9128bp-1,
+    -0x1.0daefea6fdcb9p-1,
+    -0x1.0d489d44c4bb6p-1,
+    -0x1.0ce23a795461fp-1,
+    -0x1.0c7bd644e3f43p-1,
+    -0x1.0c1570a773722p-1,
+    -0x1.0baf09a17145ap-1,
+    -0x1.0b48a13314a39p-1,
+    -0x1.0ae2375ccbf5dp-1,
+    -0x1.0a7bcc1f05a64p-1,
+    -0x1.0a155f79c1b4dp-1,
+    -0x1.09aef16d6e8b7p-1,
+    -0x1.094881fa435fp-1,
+    -0x1.08e21120ae995p-1,
+    -0x1.087b9ee11ea44p-1,
+    -0x1.08152b3b937fep-1,
+    -0x1.07aeb63044611p-1,
+    -0x1.07483fbf9fb1ap-1,
+    -0x1.06e1c7ea13db7p-1,
+    -0x1.067b4eb00f486p-1,
+    -0x1.0614d41191f87p-1,
+    -0x1.05ae580ed3208p-1,
+    -0x1.0547daa8412a8p-1,
+    -0x1.04e15bde134b5p-1,
+    -0x1.047adbb0b7eccp-1,
+    -0x1.04145a206643dp-1,
+    -0x1.03add72d55856p-1,
+    -0x1.034752d7f41b4p-1,
+    -0x1.02e0cd20b06f6p-1,
+    -0x1.027a46078a81bp-1,
+    -0x1.0213bd8cb9872p-1,
+    -0x1.01ad33b0abe99p-1,
+    -0x1.0146a87361a9p-1,
+    -0x1.00e01bd580643p-1,
+    -0x1.00798dd77685p-1,
+    -0x1.0012fe797b405p-1,
+    -0x1.ff58db771d2c6p-2,
+    -0x1.fe8bb73bcf771p-2,
+    -0x1.fdbe9041ea345p-2,
+    -0x1.fcf16689dbce1p-2,
+    -0x1.fc243a148118p-2,
+    -0x1.fb570ae2b6e5cp-2,
+    -0x1.fa89d8f55a0b2p-2,
+    -0x1.f9bca44bfc1e3p-2,
+    -0x1.f8ef6ce779f2bp-2,
+    -0x1.f82232c8b05c5p-2,
+    -0x1.f754f5ef9f5bp-2,
+    -0x1.f687b65d23c29p-2,
+    -0x1.f5ba7411abfccp-2,
+    -0x1.f4ed2f0da6737p-2,
+    -0x1.f41fe75181908p-2,
+    -0x1.f3529cde88918p-2,
+    -0x1.f2854fb529e04p-2,
+    -0x1.f1b7ffd5657ccp-2,
+    -0x1.f0eaad40183acp-2,
+    -0x1.f01d57f5b0841p-2,
+    -0x1.ef4ffff70b2c6p-2,
+    -0x1.ee82a544969d9p-2,
+    -0x1.edb547dec1417p-2,
+    -0x1.ece7e7c667ebcp-2,
+    -0x1.ec1a84fbf9065p-2,
+    -0x1.eb4d1f7fe2fbp-2,
+    -0x1.ea7fb7529433ap-2,
+    -0x1.e9b24c747b1a1p-2,
+    -0x1.e8e4dee674821p-2,
+    -0x1.e8176ea8eed56p-2,
+    -0x1.e749fbbc587dfp-2,
+    -0x1.e67c86218e4f6p-2,
+    -0x1.e5af0dd8feb3ap-2,
+    -0x1.e4e192e2a9aaap-2,
+    -0x1.e414153f6c081p-2,
+    -0x1.e34694f0229fbp-2,
+    -0x1.e27911f4cd717p-2,
+    -0x1.e1ab8c4eb7bafp-2,
+    -0x1.e0de03fe4fe6p-2,
+    -0x1.e010790395f2ap-2,
+    -0x1.df42eb5f66b48p-2,
+    -0x1.de755b1230958p-2,
+    -0x1.dda7c81c61ff7p-2,
+    -0x1.dcda327e695c3p-2,
+    -0x1.dc0c9a3991e95p-2,
+    -0x1.db3eff4ddba6cp-2,
+    -0x1.da7161bb46949p-2,
+    -0x1.d9a3c1831df05p-2,
+    -0x1.d8d61ea5d023dp-2,
+    -0x1.d8087923cb98fp-2,
+    -0x1.d73ad0fd7eb98p-2,
+    -0x1.d66d263357ef6p-2,
+    -0x1.d59f78c6340e4p-2,
+    -0x1.d4d1c8b6818p-2,
+    -0x1.d4041604aeae7p-2,
+    -0x1.d33660b1986d5p-2,
+    -0x1.d268a8bd3ebc9p-2,
+    -0x1.d19aee2810061p-2,
+    -0x1.d0cd30f2e91d9p-2,
+    -0x1.cfff711dca03p-2,
+    -0x1.cf31aea9fdf3fp-2,
+    -0x1.ce63e997f35a4p-2,
+    -0x1.cd9621e8189fcp-2,
+    -0x1.ccc8579b4a982p-2,
+    -0x1.cbfa8ab189437p-2,
+    -0x1.cb2cbb2b430b8p-2,
+    -0x1.ca5ee90954c4p-2,
+    -0x1.c991144c2cd6dp-2,
+    -0x1.c8c33cf3cb43fp-2,
+    -0x1.c7f563010cdf1p-2,
+    -0x1.c7278674ce7bep-2,
+    -0x1.c659a74f7e844p-2,
+    -0x1.c58bc5911cf83p-2,
+    -0x1.c4bde13a86ab6p-2,
+    -0x1.c3effa4c98718p-2,
+    -0x1.c32210c7524aap-2,
+    -0x1.c25424ab22a09p-2,
+    -0x1.c18635f8e647p-2,
+    -0x1.c0b844b10ba7cp-2,
+    -0x1.bfea50d392c2ep-2,
+    -0x1.bf1c5a61c6d5ep-2,
+    -0x1.be4e615c164aap-2,
+    -0x1.bd8065c281212p-2,
+    -0x1.bcb26795e42d2p-2,
+    -0x1.bbe466d6add86p-2,
+    -0x1.bb1663854c8cdp-2,
+    -0x1.ba485da22eb44p-2,
+    -0x1.b97a552e31226p-2,
+    -0x1.b8ac4a29c2411p-2,
+    -0x1.b7de3c94e2105p-2,
+    -0x1.b7102c706d63dp-2,
+    -0x1.b64219bcd2a56p-2,
+    -0x1.b574047a803efp-2,
+    -0x1.b4a5ecaa53042p-2,
+    -0x1.b3d7d24c4af4fp-2,
+    -0x1.b309b560d67b4p-2,
+    -0x1.b23b95e8d26adp-2,
+    -0x1.b16d73e51b974p-2,
+    -0x1.b09f4f55b2009p-2,
+    -0x1.afd1283b0410ap-2,
+    -0x1.af02fe95ee9b2p-2,
+    -0x1.ae34d266e009fp-2,
+    -0x1.ad66a3ae46c6fp-2,
+    -0x1.ac98726c913bfp-2,
+    -0x1.abca3ea22dd2cp-2,
+    -0x1.aafc084f8af54p-2,
+    -0x1.aa2dcf75170d5p-2,
+    -0x1.a95f94134084cp-2,
+    -0x1.a891562a75c57p-2,
+    -0x1.a7c315bb93a32p-2,
+    -0x1.a6f4d2c776f17p-2,
+    -0x1.a6268d4e1fb06p-2,
+    -0x1.a558454ffc49dp-2,
+    -0x1.a489facd7b27ap-2,
+    -0x1.a3bbadc70ab3ap-2,
+    -0x1.a2ed5e3d1957bp-2,
+    -0x1.a21f0c3083e78p-2,
+    -0x1.a150b7a22736cp-2,
+    -0x1.a082609203457p-2,
+    -0x1.9fb40700867d6p-2,
+    -0x1.9ee5aaee1f488p-2,
+    -0x1.9e174c5b3c10ap-2,
+    -0x1.9d48eb484b3f9p-2,
+    -0x1.9c7a87b5bb3f3p-2,
+    -0x1.9bac21a3fa796p-2,
+    -0x1.9addb913e5c1dp-2,
+    -0x1.9a0f4e0659ec3p-2,
+    -0x1.9940e07b56f88p-2,
+    -0x1.98727072dce6cp-2,
+    -0x1.97a3fdedc88abp-2,
+    -0x1.96d588ecf6b7fp-2,
+    -0x1.96071170676e9p-2,
+    -0x1.95389778f7823p-2,
+    -0x1.946a1b07155cbp-2,
+    -0x1.939b9c1ac0fe2p-2,
+    -0x1.92cd1ab468d05p-2,
+    -0x1.91fe96d4e9a6fp-2,
+    -0x1.9130107cb1ebdp-2,
+    -0x1.906187ac3008ep-2,
+    -0x1.8f92fc63d267fp-2,
+    -0x1.8ec46ea39908fp-2,
+    -0x1.8df5de6ccf298p-2,
+    -0x1.8d274bbfe3337p-2,
+    -0x1.8c58b69cd526dp-2,
+    -0x1.8b8a1f04136d6p-2,
+    -0x1.8abb84f67adaep-2,
+    -0x1.89ece87479d93p-2,
+    -0x1.891e497e10685p-2,
+    -0x1.884fa81489c5cp-2,
+    -0x1.87810437e5f19p-2,
+    -0x1.86b25de824ebbp-2,
+    -0x1.85e3b5262387ep-2,
+    -0x1.851509f2be99cp-2,
+    -0x1.84465c4df6216p-2,
+    -0x1.8377ac37ca1ecp-2,
+    -0x1.82a8f9b185cf7p-2,
+    -0x1.81da44bb979d4p-2,
+    -0x1.810b8d55ff883p-2,
+    -0x1.803cd3819a64p-2,
+    -0x1.7f6e173ed69a8p-2,
+    -0x1.7e9f588db42bbp-2,
+    -0x1.7dd0976f0feb4p-2,
+    -0x1.7d01d3e358431p-2,
+    -0x1.7c330deafb9cfp-2,
+    -0x1.7b6445866862cp-2,
+    -0x1.7a957ab59e948p-2,
+    -0x1.79c6ad797b05ep-2,
+    -0x1.78f7ddd26c20cp-2,
+    -0x1.78290bc0e04efp-2,
+    -0x1.775a3745b4643p-2,
+    -0x1.768b6060e8607p-2,
+    -0x1.75bc8712eaadap-2,
+    -0x1.74edab5c981f6p-2,
+    -0x1.741ecd3df0b5bp-2,
+    -0x1.734fecb762da7p-2,
+    -0x1.728109c95cf78p-2,
+    -0x1.71b224744d76bp-2,
+    -0x1.70e33cb9112bbp-2,
+    -0x1.7014529816806p-2,
+    -0x1.6f4566115d74cp-2,
+    -0x1.6e7677255472bp-2,
+    -0x1.6da785d546b7bp-2,
+    -0x1.6cd892213443dp-2,
+    -0x1.6c099c091d17p-2,
+    -0x1.6b3aa38d6f9b2p-2,
+    -0x1.6a6ba8ae9a3ap-2,
+    -0x1.699cab6d79c76p-2,
+    -0x1.68cdabca7cad1p-2,
+    -0x1.67fea9c61154fp-2,
+    -0x1.672fa560a628ep-2,
+    -0x1.66609e9aa992bp-2,
+    -0x1.6591957489fc4p-2,
+    -0x1.64c289eeb5cf6p-2,
+    -0x1.63f37c099b75fp-2,
+    -0x1.63246bc53aeffp-2,
+    -0x1.6255592202a73p-2,
+    -0x1.61864420cf6f7p-2,
+    -0x1.60b72cc27e1c6p-2,
+    -0x1.5fe813070eaep-2,
+    -0x1.5f18f6eeef8e2p-2,
+    -0x1.5e49d87a8f26ap-2,
+    -0x1.5d7ab7aa5be16p-2,
+    -0x1.5cab947ec4283p-2,
+    -0x1.5bdc6ef83664fp-2,
+    -0x1.5b0d47178f6b5p-2,
+    -0x1.5a3e1cdc60d18p-2,
+    -0x1.596ef047876b3p-2,
+    -0x1.589fc159e00cp-2,
+    -0x1.57d090136ab4p-2,
+    -0x1.57015c7495cd1p-2,
+    -0x1.5632267dcfc1p-2,
+    -0x1.5562ee2f86f9bp-2,
+    -0x1.5493b38a29e0fp-2,
+    -0x1.53c4768e26e0ap-2,
+    -0x1.52f5373b7df8cp-2,
+    -0x1.5225f5929d932p-2,
+    -0x1.5156b19462838p-2,
+    -0x1.50876b41a99d8p-2,
+    -0x1.4fb8229a72e13p-2,
+    -0x1.4ee8d79f2cb87p-2,
+    -0x1.4e198a50458d1p-2,
+    -0x1.4d4a3aadbd5f1p-2,
+    -0x1.4c7ae8b871022p-2,
+    -0x1.4bab9470cee02p-2,
+    -0x1.4adc3dd74562ep-2,
+    -0x1.4a0ce4ec42f44p-2,
+    -0x1.493d89b035fe2p-2,
+    -0x1.486e2c238cea5p-2,
+    -0x1.479ecc4647b8dp-2,
+    -0x1.46cf6a19433d6p-2,
+    -0x1.4600059cede1dp-2,
+    -0x1.45309ed147a62p-2,
+    -0x1.446135b6bef43p-2,
+    -0x1.4391ca4e309fap-2,
+    -0x1.42c25c980b126p-2,
+    -0x1.41f2ec944e4c6p-2,
+    -0x1.41237a43d7216p-2,
+    -0x1.405405a713fb3p-2,
+    -0x1.3f848ebe04d9dp-2,
+    -0x1.3eb5158918272p-2,
+    -0x1.3de59a08bc4cfp-2,
+    -0x1.3d161c3d5fb52p-2,
+    -0x1.3c469c27df336p-2,
+    -0x1.3b7719c8a9319p-2,
+    -0x1.3aa7951f4f45dp-2,
+    -0x1.39d80e2cae43ep-2,
+    -0x1.390884f1a2ff6p-2,
+    -0x1.3838f96e2d786p-2,
+    -0x1.37696ba2bc18bp-2,
+    -0x1.3699db8fbd4a3p-2,
+    -0x1.35ca49359f76bp-2,
+    -0x1.34fab494629e4p-2,
+    -0x1.342b1dace3948p-2,
+    -0x1.335b847f90c35p-2,
+    -0x1.328be90c6a2acp-2,
+    -0x1.31bc4b544c9e7p-2,
+    -0x1.30ecab57a6884p-2,
+    -0x1.301d091677e83p-2,
+    -0x1.2f4d64912f281p-2,
+    -0x1.2e7dbdc83ab1cp-2,
+    -0x1.2dae14bc08ef2p-2,
+    -0x1.2cde696d76b3ep-2,
+    -0x1.2c0ebbdcf269ep-2,
+    -0x1.2b3f0c0a7c111p-2,
+    -0x1.2a6f59f613a98p-2,
+    -0x1.299fa5a09606dp-2,
+    -0x1.28cfef0adffccp-2,
+    -0x1.28003634f18b5p-2,
+    -0x1.27307b1ecab28p-2,
+    -0x1.2660bdc8d9dc3p-2,
+    -0x1.2590fe33fbdcp-2,
+    -0x1.24c13c609f1bep-2,
+    -0x1.23f1784ec39bcp-2,
+    -0x1.2321b1fed7c58p-2,
+    -0x1.2251e971b86cdp-2,
+    -0x1.21821ea7d3fb9p-2,
+    -0x1.20b251a0bc07ep-2,
+    -0x1.1fe2825cdefbap-2,
+    -0x1.1f12b0dd88145p-2,
+    -0x1.1e42dd22b752p-2,
+    -0x1.1d73072c6cb4ap-2,
+    -0x1.1ca32efb850ffp-2,
+    -0x1.1bd35490dd37ap-2,
+    -0x1.1b0377ec752bbp-2,
+    -0x1.1a33990e4cec1p-2,
+    -0x1.1963b7f6d2e2bp-2,
+    -0x1.1893d4a675796p-2,
+    -0x1.17c3ef1da31ap-2,
+    -0x1.16f4075cca2e6p-2,
+    -0x1.16241d6459206p-2,
+    -0x1.155431344ffp-2,
+    -0x1.148442cd8b70fp-2,
+    -0x1.13b45230e876ep-2,
+    -0x1.12e45f5df898p-2,
+    -0x1.12146a552a3e2p-2,
+    -0x1.114473175a3cfp-2,
+    -0x1.107479a488948p-2,
+    -0x1.0fa47dfd23aeap-2,
+    -0x1.0ed48022085fp-2,
+    -0x1.0e04801336a5ap-2,
+    -0x1.0d347dd0ae829p-2,
+    -0x1.0c64795b4cc97p-2,
+    -0x1.0b9472b37fe42p-2,
+    -0x1.0ac469d947d2ap-2,
+    -0x1.09f45ecd12fedp-2,
+    -0x1.0924518fbe3c6p-2,
+    -0x1.08544221498b4p-2,
+    -0x1.0784308223556p-2,
+    -0x1.06b41cb3286e7p-2,
+    -0x1.05e406b3ea6c9p-2,
+    -0x1.0513ee84d7b99p-2,
+    -0x1.0443d426cd293p-2,
+    -0x1.0373b79a39254p-2,
+    -0x1.02a398df8a17ap-2,
+    -0x1.01d377f6c0005p-2,
+    -0x1.010354e049493p-2,
+    -0x1.00332f9c945c1p-2,
+    -0x1.fec610581f45ap-3,
+    -0x1.fd25bd1e530e9p-3,
+    -0x1.fb85658ca0e6ap-3,
+    -0x1.f9e509a3e5a18p-3,
+    -0x1.f844a964213f3p-3,
+    -0x1.f6a444ce30937p-3,
+    -0x1.f503dbe2f071ep-3,
+    -0x1.f3636ea33dae4p-3,
+    -0x1.f1c2fd0ff51c4p-3,
+    -0x1.f022872916bbep-3,
+    -0x1.ee820cf05c348p-3,
+    -0x1.ece18e66a259ep-3,
+    -0x1.eb410b8be92bfp-3,
+    -0x1.e9a084610d7e7p-3,
+    -0x1.e7fff8e6ec251p-3,
+    -0x1.e65f691e61f38p-3,
+    -0x1.e4bed5084bbd8p-3,
+    -0x1.e31e3ca58656bp-3,
+    -0x1.e17d9ff611bf2p-3,
+    -0x1.dfdcfefacaca7p-3,
+    -0x1.de3c59b56b201p-3,
+    -0x1.dc9bb026cf93cp-3,
+    -0x1.dafb024ef8257p-3,
+    -0x1.d95a502de4d52p-3,
+    -0x1.d7b999c472769p-3,
+    -0x1.d618df145ab12p-3,
+    -0x1.d478201e7a588p-3,
+    -0x1.d2d75ce2d16cbp-3,
+    -0x1.d13695615fedbp-3,
+    -0x1.cf95c99bdf82fp-3,
+    -0x1.cdf4f99409d3cp-3,
+    -0x1.cc542549dee03p-3,
+    -0x1.cab34cbd5ea84p-3,
+    -0x1.c9126fef65ffap-3,
+    -0x1.c7718ee0d1bap-3,
+    -0x1.c5d0a9927eab2p-3,
+    -0x1.c42fc00549a6bp-3,
+    -0x1.c28ed23a0f805p-3,
+    -0x1.c0ede030d0381p-3,
+    -0x1.bf4ce9ea68a1ap-3,
+    -0x1.bdabef6892647p-3,
+    -0x1.bc0af0ab4d807p-3,
+    -0x1.ba69edb376c96p-3,
+    -0x1.b8c8e681eb12fp-3,
+    -0x1.b727db16aa5d1p-3,
+    -0x1.b586cb72917b8p-3,
+    -0x1.b3e5b7967d42p-3,
+    -0x1.b2449f834a843p-3,
+    -0x1.b0a38339d615dp-3,
+    -0x1.af0262bafcca8p-3,
+    -0x1.ad613e06bea25p-3,
+    -0x1.abc0151df870fp-3,
+    -0x1.aa1ee80263ddcp-3,
+    -0x1.a87db6b400e8dp-3,
+    -0x1.a6dc8133ac65cp-3,
+    -0x1.a53b478243285p-3,
+    -0x1.a39a099fc5308p-3,
+    -0x1.a1f8c78c327e5p-3,
+    -0x1.a057814a218cdp-3,
+    -0x1.9eb636da6f2fcp-3,
+    -0x1.9d14e83c3e936p-3,
+    -0x1.9b7395706c8b6p-3,
+    -0x1.99d23e78b2bf3p-3,
+    -0x1.9830e355ee029p-3,
+    -0x1.968f84074181bp-3,
+    -0x1.94ee208e66e41p-3,
+    -0x1.934cb8ec3afd5p-3,
+    -0x1.91ab4d20bdcd8p-3,
+    -0x1.9009dd2da8fcp-3,
+    -0x1.8e686912fc88dp-3,
+    -0x1.8cc6f0d0b873fp-3,
+    -0x1.8b2574689664cp-3,
+    -0x1.8983f3db732efp-3,
+    -0x1.87e26f294ed29p-3,
+    -0x1.8640e65306234p-3,
+    -0x1.849f595975f4cp-3,
+    -0x1.82fdc83d7b1acp-3,
+    -0x1.815c32fff269p-3,
+    -0x1.7fba99a0dbdf7p-3,
+    -0x1.7e18fc211451cp-3,
+    -0x1.7c775a817893bp-3,
+    -0x1.7ad5b4c2e578fp-3,
+    -0x1.79340ae55b018p-3,
+    -0x1.77925ce9b6011p-3,
+    -0x1.75f0aad1b01fp-3,
+    -0x1.744ef49d495b6p-3,
+    -0x1.72ad3a4d5e89dp-3,
+    -0x1.710b7be1efaa6p-3,
+    -0x1.6f69b95bd990cp-3,
+    -0x1.6dc7f2bcd5e45p-3,
+    -0x1.6c262804e4a51p-3,
+    -0x1.6a84593405d3p-3,
+    -0x1.68e2864b1641ep-3,
+    -0x1.6740af4af2c55p-3,
+    -0x1.659ed4355504cp-3,
+    -0x1.63fcf50b19d3fp-3,
+    -0x1.625b11cb645f2p-3,
+    -0x1.60b92a77117ap-3,
+    -0x1.5f173f0efdf84p-3,
+    -0x1.5d754f9406adap-3,
+    -0x1.5bd35c07086dcp-3,
+    -0x1.5a3164680338bp-3,
+    -0x1.588f68b7d3e22p-3,
+    -0x1.56ed68f7573dcp-3,
+    -0x1.554b65276a1f5p-3,
+    -0x1.53a95d49c62e2p-3,
+    -0x1.5207515e6b6a4p-3,
+    -0x1.5065416559d3bp-3,
+    -0x1.4ec32d5f6e3e2p-3,
+    -0x1.4d21154d857d4p-3,
+    -0x1.4b7ef92f9f911p-3,
+    -0x1.49dcd906994d5p-3,
+    -0x1.483ab4d34f85ap-3,
+    -0x1.46988c969f0dcp-3,
+    -0x1.44f66052418d1p-3,
+    -0x1.435430055a2fep-3,
+    -0x1.41b1fbb0c5c9ep-3,
+    -0x1.400fc355612ecp-3,
+    -0x1.3e6d86f32c5e8p-3,
+    -0x1.3ccb468be1009p-3,
+    -0x1.3b2902205be8ap-3,
+    -0x1.3986b9b09d16bp-3,
+    -0x1.37e46d3ca48acp-3,
+    -0x1.36421cc54f188p-3,
+    -0x1.349fc84c56675p-3,
+    -0x1.32fd6fd2974afp-3,
+    -0x1.315b135811c36p-3,
+    -0x1.2fb8b2dda2a45p-3,
+    -0x1.2e164e6349edbp-3,
+    -0x1.2c73e5e9079f9p-3,
+    -0x1.2ad1797172351p-3,
+    -0x1.292f08fc89ae2p-3,
+    -0x1.278c948a4e0adp-3,
+    -0x1.25ea1c1b9c1ecp-3,
+    -0x1.24479fb150bdbp-3,
+    -0x1.22a51f4c48bb5p-3,
+    -0x1.21029aec8417ap-3,
+    -0x1.1f601293bc7a1p-3,
+    -0x1.1dbd8641f1e29p-3,
+    -0x1.1c1af5f724512p-3,
+    -0x1.1a7861b50d6d3p-3,
+    -0x1.18d5c97c8a0a7p-3,
+    -0x1.17332d4d9a28ep-3,
+    -0x1.15908d283dc88p-3,
+    -0x1.13ede90e2e90cp-3,
+    -0x1.124b40ff6c819p-3,
+    -0x1.10a894fbf79afp-3,
+    -0x1.0f05e50589845p-3,
+    -0x1.0d63311c223dbp-3,
+    -0x1.0bc079409e9acp-3,
+    -0x1.0a1dbd74b842ep-3,
+    -0x1.087afdb86f362p-3,
+    -0x1.06d83a0bc3747p-3,
+    -0x1.053572706ea54p-3,
+    -0x1.0392a6e670c89p-3,
+    -0x1.01efd76dc9de5p-3,
+    -0x1.004d0408338dfp-3,
+    -0x1.fd54596b5baefp-4,
+    -0x1.fa0ea2ec7175dp-4,
+    -0x1.f6c8e4971bbf4p-4,
+    -0x1.f3831e6d1432ap-4,
+    -0x1.f03d506e5acffp-4,
+    -0x1.ecf77a9ca93eap-4,
+    -0x1.e9b19cf9b9262p-4,
+    -0x1.e66bb7858a866p-4,
+    -0x1.e325ca41d706cp-4,
+    -0x1.dfdfd530584ebp-4,
+    -0x1.dc99d852c805ap-4,
+    -0x1.d953d3a9262b8p-4,
+    -0x1.d60dc73372c06p-4,
+    -0x1.d2c7b2f52113p-4,
+    -0x1.cf8196efeacacp-4,
+    -0x1.cc3b7323cfe7bp-4,
+    -0x1.c8f54790d069dp-4,
+    -0x1.c5af143a5f9fep-4,
+    -0x1.c268d92237315p-4,
+    -0x1.bf229648571e1p-4,
+    -0x1.bbdc4bacbf663p-4,
+    -0x1.b895f95129b11p-4,
+    -0x1.b54f9f39094d8p-4,
+    -0x1.b2093d645e3b8p-4,
+    -0x1.aec2d3d3287b1p-4,
+    -0x1.ab7c6288db5bp-4,
+    -0x1.a835e9873082bp-4,
+    -0x1.a4ef68cc6e4abp-4,
+    -0x1.a1a8e05c0801ep-4,
+    -0x1.9e625037b74fap-4,
+    -0x1.9b1bb85dc28c8p-4,
+    -0x1.97d518d19d075p-4,
+    -0x1.948e719500678p-4,
+    -0x1.9147c2a7ecad1p-4,
+    -0x1.8e010c0c1b7f6p-4,
+    -0x1.8aba4dc18cde7p-4,
+    -0x1.877387c840ca4p-4,
+    -0x1.842cba23aa91ap-4,
+    -0x1.80e5e4d73d835p-4,
+    -0x1.7d9f07e13ff7fp-4,
+    -0x1.7a5823436b96fp-4,
+    -0x1.7711370133af1p-4,
+    -0x1.73ca431a98406p-4,
+    -0x1.7083478ddfa37p-4,
+    -0x1.6d3c445cc37fap-4,
+    -0x1.69f5398c70cb3p-4,
+    -0x1.66ae271b2ddebp-4,
+    -0x1.63670d08faba2p-4,
+    -0x1.601feb594aac5p-4,
+    -0x1.5cd8c20dd75cap-4,
+    -0x1.59919126a0cb1p-4,
+    -0x1.564a58a5609f1p-4,
+    -0x1.5303188bd08p-4,
+    -0x1.4fbbd0d9f06dep-4,
+    -0x1.4c7481917a102p-4,
+    -0x1.492d2ab4270e2p-4,
+    -0x1.45e5cc41f767dp-4,
+    -0x1.429e663ca4c4bp-4,
+    -0x1.3f56f8a5e8cc1p-4,
+    -0x1.3c0f837dc37ep-4,
+    -0x1.38c806c5ee81ep-4,
+    -0x1.35808280237f1p-4,
+    -0x1.3238f6ae1c1dp-4,
+    -0x1.2ef1634fd85bbp-4,
+    -0x1.2ba9c86711e28p-4,
+    -0x1.286225f58258ep-4,
+    -0x1.251a7bfb29bedp-4,
+    -0x1.21d2ca79c1bbap-4,
+    -0x1.1e8b117303f6dp-4,
+    -0x1.1b4350e6f0705p-4,
+    -0x1.17fb88d740cf9p-4,
+    -0x1.14b3b945aebbfp-4,
+    -0x1.116be2323a357p-4,
+    -0x1.0e24039e9ce38p-4,
+    -0x1.0adc1d8c906d8p-4,
+    -0x1.07942ffdce7adp-4,
+    -0x1.044c3af2570b7p-4,
+    -0x1.01043e6be3c6dp-4,
+    -0x1.fb7874d85ca8ap-5,
+    -0x1.f4e85de66d67fp-5,
+    -0x1.ee5838056d1a5p-5,
+    -0x1.e7c803355bbfcp-5,
+    -0x1.e137bf79aca7p-5,
+    -0x1.daa76cd5d31efp-5,
+    -0x1.d4170b4d42765p-5,
+    -0x1.cd869adffaad2p-5,
+    -0x1.c6f61b916f124p-5,
+    -0x1.c0658d6512f46p-5,
+    -0x1.b9d4f05ae6539p-5,
+    -0x1.b34444765c7eap-5,
+    -0x1.acb389bae8c45p-5,
+    -0x1.a622c02bfe738p-5,
+    -0x1.9f91e7c99d8c2p-5,
+    -0x1.99010093c60e3p-5,
+    -0x1.92700a915e975p-5,
+    -0x1.8bdf05c267278p-5,
+    -0x1.854df226dfbebp-5,
+    -0x1.7ebccfc5aefa9p-5,
+    -0x1.782b9e9ed4db1p-5,
+    -0x1.719a5eb251603p-5,
+    -0x1.6b0910070b279p-5,
+    -0x1.6477b29d02313p-5,
+    -0x1.5de64674367d1p-5,
+    -0x1.5754cb938ea8cp-5,
+    -0x1.50c341fb0ab45p-5,
+    -0x1.4a31a9ae1dee8p-5,
+    -0x1.43a002b03ba62p-5,
+    -0x1.3d0e4d0163db3p-5,
+    -0x1.367c88a1968dbp-5,
+    -0x1.2feab594470c7p-5,
+    -0x1.2958d3e05bf5p-5,
+    -0x1.22c6e385d5476p-5,
+    -0x1.1c34e484b303ap-5,
+    -0x1.15a2d6e068788p-5,
+    -0x1.0f10ba9c68f4dp-5,
+    -0x1.087e8fb8b4789p-5,
+    -0x1.01ec5638be528p-5,
+    -0x1.f6b41c3ff3a3p-6,
+    -0x1.e98f6edccdebp-6,
+    -0x1.dc6aa44ef21abp-6,
+    -0x1.cf45bc966032p-6,
+    -0x1.c220b7b9fece9p-6,
+    -0x1.b4fb95c79b2b9p-6,
+    -0x1.a7d656bf35491p-6,
+    -0x1.9ab0faa0cd27p-6,
+    -0x1.8d8b81734962fp-6,
+    -0x1.8065eb36a9fcfp-6,
+    -0x1.734037f1d5929p-6,
+    -0x1.661a67abb2c17p-6,
+    -0x1.58f47a6b28272p-6,
+    -0x1.4bce703035c3bp-6,
+    -0x1.3ea848fadb971p-6,
+    -0x1.318204d8e6dc8p-6,
+    -0x1.245ba3d13e319p-6,
+    -0x1.173525dcfaf8ap-6,
+    -0x1.0a0e8b0303cf5p-6,
+    -0x1.f9cfa6947ea68p-7,
+    -0x1.df81fd732844p-7,
+    -0x1.c5341aafd1b25p-7,
+    -0x1.aae5fe4a7af18p-7,
+    -0x1.9097a850f13cbp-7,
+    -0x1.764918c33493fp-7,
+    -0x1.5bfa4faf12326p-7,
+    -0x1.41ab4d148a181p-7,
+    -0x1.275c110169803p-7,
+    -0x1.0d0c9b837da5fp-7,
+    -0x1.e579d9358d129p-8,
+    -0x1.b0da08c5bd414p-8,
+    -0x1.7c39c5b78bd7fp-8,
+    -0x1.4799100af8d6ap-8,
+    -0x1.12f7e7db9eb3cp-8,
+    -0x1.bcac9a52fade9p-9,
+    -0x1.5368805793ecp-9,
+    -0x1.d447038a111f8p-10,
+    -0x1.01bb3d36b193cp-10,
+    -0x1.796d748ee73ecp-13,
+    0x1.46c350c8d9c87p-11,
+    0x1.75f2c7ac2bd07p-10,
+    0x1.2442d76b7b01ap-9,
+    0x1.8d8d2ebb30d19p-9,
+    0x1.f6d869c53758p-9,
+    0x1.301244292cd42p-8,
+    0x1.64b8c515b16abp-8,
+    0x1.995fb7a8296fcp-8,
+    0x1.ce071bc4fa6cep-8,
+    0x1.015778a844f5ep-7,
+    0x1.1bab9c256bf62p-7,
+    0x1.35fff859f2374p-7,
+    0x1.50548d380a7e1p-7,
+    0x1.6aa95ab1e78f5p-7,
+    0x1.84fe60b9bc2fdp-7,
+    0x1.9f539f41bb246p-7,
+    0x1.b9a91649e46d1p-7,
+    0x1.d3fec5d23809dp-7,
+    0x1.ee54adcce8bf7p-7,
+    0x1.0455671614a96p-6,
+    0x1.11809377fce1ep-6,
+    0x1.1eabdc05466bap-6,
+    0x1.2bd740b70aa9p-6,
+    0x1.3902c18d499ap-6,
+    0x1.462e5e811ca11p-6,
+    0x1.535a178b9d20ap-6,
+    0x1.6085ecaccb18ap-6,
+    0x1.6db1dde4a6891p-6,
+    0x1.7addeb2c48d46p-6,
+    0x1.880a1475e4bf5p-6,
+    0x1.953659c17a49fp-6,
+    0x1.a262bb0f09743p-6,
+    0x1.af8f3857aba08p-6,
+    0x1.bcbbd19b60ceep-6,
+    0x1.c9e886d34261cp-6,
+    0x1.d71557f869bb8p-6,
+    0x1.e442450ad6dc2p-6,
+    0x1.f16f4e03a326p-6,
+    0x1.fe9c72dbe7fb9p-6,
+    0x1.05e4d9c9d2ae6p-5,
+    0x1.0c7b88156da4dp-5,
+    0x1.1312444d51925p-5,
+    0x1.19a90e6e0b281p-5,
+    0x1.203fe67427174p-5,
+    0x1.26d6cc5fa55fep-5,
+    0x1.2d6dc0308601fp-5,
+    0x1.3404c1dfe25fdp-5,
+    0x1.3a9bd16dba799p-5,
+    0x1.4132eed69b005p-5,
+    0x1.47ca1a1710a55p-5,
+    0x1.4e6153328eb76p-5,
+    0x1.54f89a25a1e7bp-5,
+    0x1.5b8feeecd6e77p-5,
+    0x1.622751882db6ap-5,
+    0x1.68bec1f0bfb7bp-5,
+    0x1.6f5640268cea9p-5,
+    0x1.75edcc29954f5p-5,
+    0x1.7c8565f2f2485p-5,
+    0x1.831d0d82a3d59p-5,
+    0x1.89b4c2d8a9f71p-5,
+    0x1.904c85f1915ep-5,
+    0x1.96e456cd5a0a7p-5,
+    0x1.9d7c356890ad8p-5,
+    0x1.a41421bfc1f87p-5,
+    0x1.aaac1bd2edeb4p-5,
+    0x1.b144239ea1372p-5,
+    0x1.b7dc3922dbdcp-5,
+    0x1.be745c5c2a8b3p-5,
+    0x1.c50c8d4719f5dp-5,
+    0x1.cba4cbe3aa1bep-5,
+    0x1.d23d1831dafd7p-5,
+    0x1.d8d5722e394bap-5,
+    0x1.df6dd9d1de68ep-5,
+    0x1.e6064f1cca553p-5,
+    0x1.ec9ed20efd109p-5,
+    0x1.f33762a8769bp-5,
+    0x1.f9d000e5c3a5cp-5,
+    0x1.0034565ffec99p-4,
+    0x1.0380b31b9231ap-4,
+    0x1.06cd16a59c0bp-4,
+    0x1.0a1980fe1c55bp-4,
+    0x1.0d65f2219fc2fp-4,
+    0x1.10b26a102652bp-4,
+    0x1.13fee8c9b005p-4,
+    0x1.174b6e4c83327p-4,
+    0x1.1a97fa989fdbp-4,
+    0x1.1de48dac4c575p-4,
+    0x1.21312785cefffp-4,
+    0x1.247dc8236e2d8p-4,
+    0x1.27ca6f8529ep-4,
+    0x1.2b171da948701p-4,
+    0x1.2e63d28fc9ddbp-4,
+    0x1.31b08e38ae28dp-4,
+    0x1.34fd50a08202bp-4,
+    0x1.384a19c7456b5p-4,
+    0x1.3b96e9acf862bp-4,
+    0x1.3ee3c04fe1416p-4,
+    0x1.42309dae466p-4,
+    0x1.457d81c827be9p-4,
+    0x1.48ca6c9bcbb5bp-4,
+    0x1.4c175e27789dfp-4,
+    0x1.4f64566b2e776p-4,
+    0x1.52b15566ed41fp-4,
+    0x1.55fe5b18fb564p-4,
+    0x1.594b677f9f0cep-4,
+    0x1.5c987a9ad865ep-4,
+    0x1.5fe59468edb9dp-4,
+    0x1.6332b4e825615p-4,
+    0x1.667fdc187f5c5p-4,
+    0x1.69cd09f9fbaaep-4,
+    0x1.6d1a3e8ae0a59p-4,
+    0x1.706779c974a5p-4,
+    0x1.73b4bbb3fe01dp-4,
+    0x1.7702044a7cbcp-4,
+    0x1.7a4f538cf0d38p-4,
+    0x1.7d9ca979a0a0fp-4,
+    0x1.80ea060ed27cfp-4,
+    0x1.8437694c86678p-4,
+    0x1.8784d332bc60ap-4,
+    0x1.8ad243bfbac0ep-4,
+    0x1.8e1fbaf1c7e0ep-4,
+    0x1.916d38c72a194p-4,
+    0x1.94babd3e27c29p-4,
+    0x1.98084856c0dcdp-4,
+    0x1.9b55da10f568p-4,
+    0x1.9ea3726cc5642p-4,
+    0x1.a1f111687729dp-4,
+    0x1.a53eb7025111bp-4,
+    0x1.a88c633a531bbp-4,
+    0x1.abda160ec3a07p-4,
+    0x1.af27cf7de8f89p-4,
+    0x1.b2758f87c3241p-4,
+    0x1.b5c3562a987b8p-4,
+    0x1.b911236668feep-4,
+    0x1.bc5ef73b34ae3p-4,
+    0x1.bfacd1a741e21p-4,
+    0x1.c2fab2a8d6f32p-4,
+    0x1.c6489a3e3a39fp-4,
+    0x1.c99688676bb68p-4,
+    0x1.cce47d22b1c17p-4,
+    0x1.d03278700c5abp-4,
+    0x1.d3807a4dc1dafp-4,
+    0x1.d6ce82ba189acp-4,
+    0x1.da1c91b6ca418p-4,
+    0x1.dd6aa7421d27dp-4,
+    0x1.e0b8c35a57a64p-4,
+    0x1.e406e5fdc0158p-4,
+    0x1.e7550f2c56758p-4,
+    0x1.eaa33ee61ac64p-4,
+    0x1.edf1752799b8fp-4,
+    0x1.f13fb1f0d34dap-4,
+    0x1.f48df541c7844p-4,
+    0x1.f7dc3f18bcb57p-4,
+    0x1.fb2a8f75b2e13p-4,
+    0x1.fe78e656f0602p-4,
+    0x1.00e3a1dd5dc56p-3,
+    0x1.028ad3d08a30ap-3,
+    0x1.04320904fd71cp-3,
+    0x1.05d94179dab51p-3,
+    0x1.07807d2e4526dp-3,
+    0x1.0927bc215ff36p-3,
+    0x1.0acefe532b1abp-3,
+    0x1.0c7643c3a69cdp-3,
+    0x1.0e1d8c71f5a6p-3,
+    0x1.0fc4d85e18364p-3,
+    0x1.116c27873179fp-3,
+    0x1.131379ec649d5p-3,
+    0x1.14bacf8db1a06p-3,
+    0x1.1662286a3baf6p-3,
+    0x1.1809848202ca6p-3,
+    0x1.19b0e3d506f16p-3,
+    0x1.1b5846618e7cfp-3,
+    0x1.1cffac27996d1p-3,
+    0x1.1ea7152727c1dp-3,
+    0x1.204e815f5ca77p-3,
+    0x1.21f5f0d0381dfp-3,
+    0x1.239d6378dd51ap-3,
+    0x1.2544d9586f6edp-3,
+    0x1.26ec526eee758p-3,
+    0x1.2893cebb7d91fp-3,
+    0x1.2a3b4e3e1cc43p-3,
+    0x1.2be2d0f5ef388p-3,
+    0x1.2d8a56e2181b3p-3,
+    0x1.2f31e003744p-3,
+    0x1.30d96c5926d33p-3,
+    0x1.3280fbe253011p-3,
+    0x1.34288e9e1bf5fp-3,
+    0x1.35d0248c81b1cp-3,
+    0x1.3777bdad84349p-3,
+    0x1.391f5a0046aabp-3,
+    0x1.3ac6f984c9141p-3,
+    0x1.3c6e9c3a2e9d1p-3,
+    0x1.3e16421f9a71fp-3,
+    0x1.3fbdeb350c92bp-3,
+    0x1.41659779a82bap-3,
+    0x1.430d46ec90691p-3,
+    0x1.44b4f98dc54bp-3,
+    0x1.465caf5d46d17p-3,
+    0x1.4804685b14fc6p-3,
+    0x1.49ac248652f81p-3,
+    0x1.4b53e3de23f0ep-3,
+    0x1.4cfba661ab131p-3,
+    0x1.4ea36c100b8afp-3,
+    0x1.504b34ea222c3p-3,
+    0x1.51f300efeef6dp-3,
+    0x1.539ad01fb8437p-3,
+    0x1.5542a278a13e6p-3,
+    0x1.56ea77fb86bb5p-3,
+    0x1.589250a78be68p-3,
+    0x1.5a3a2c7bd3ec5p-3,
+    0x1.5be20b785eccbp-3,
+    0x1.5d89ed9c4fb4p-3,
+    0x1.5f31d2e7a6a23p-3,
+    0x1.60d9bb5986c39p-3,
+    0x1.6281a6f1f0182p-3,
+    0x1.642995b0e29fep-3,
+    0x1.65d18794a4b37p-3,
+    0x1.67797c9c597f1p-3,
+    0x1.692174c8ddd68p-3,
+    0x1.6ac9701a31b9cp-3,
+    0x1.6c716e8e9b816p-3,
+    0x1.6e1970253e59bp-3,
+    0x1.6fc174def7166p-3,
+    0x1.71697cbae8e3cp-3,
+    0x1.731187b836ee2p-3,
+    0x1.74b995d7be093p-3,
+    0x1.7661a717c48d9p-3,
+    0x1.7809bb776da79p-3,
+    0x1.79b1d2f7962adp-3,
+    0x1.7b59ed976143bp-3,
+    0x1.7d020b55f21e7p-3,
+    0x1.7eaa2c3348bb1p-3,
+    0x1.8052502e8845fp-3,
+    0x1.81fa7747b0bfp-3,
+    0x1.83a2a17de5529p-3,
+    0x1.854aced0492cep-3,
+    0x1.86f2ff3fb921bp-3,
+    0x1.889b32cb585d5p-3,
+    0x1.8a4369724a0cp-3,
+    0x1.8beba333b15a2p-3,
+    0x1.8d93e00f8e47ap-3,
+    0x1.8f3c2005e0d49p-3,
+    0x1.90e46315cc2d3p-3,
+    0x1.928ca93f50518p-3,
+    0x1.9434f281906ddp-3,
+    0x1.95dd3edbafae7p-3,
+    0x1.97858e4dae135p-3,
+    0x1.992de0d78b9c8p-3,
+    0x1.9ad636786b765p-3,
+    0x1.9c7e8f2f70cdp-3,
+    0x1.9e26eafc9ba09p-3,
+    0x1.9fcf49dfebf11p-3,
+    0x1.a177abd884eacp-3,
+    0x1.a32010e589b9fp-3,
+    0x1.a4c87906fa5eap-3,
+    0x1.a670e43cd6d8dp-3,
+    0x1.a81952864254dp-3,
+    0x1.a9c1c3e25ffeep-3,
+    0x1.ab6a38512fd71p-3,
+    0x1.ad12afd1d509ap-3,
+    0x1.aebb2a644f96ap-3,
+    0x1.b063a8089f7ep-3,
+    0x1.b20c28bd0b186p-3,
+    0x1.b3b4ac819265cp-3,
+    0x1.b55d33571239dp-3,
+    0x1.b705bd3cadc0ep-3,
+    0x1.b8ae4a30ab539p-3,
+    0x1.ba56da330af1dp-3,
+    0x1.bbff6d43cc9bbp-3,
+    0x1.bda80362137d7p-3,
+    0x1.bf509c8ddf972p-3,
+    0x1.c0f938c65415p-3,
+    0x1.c2a1d80b70f71p-3,
+    0x1.c44a7a5d363d6p-3,
+    0x1.c5f31fbac7143p-3,
+    0x1.c79bc82346a7cp-3,
+    0x1.c9447395d8247p-3,
+    0x1.caed2213585dfp-3,
+    0x1.cc95d39aea809p-3,
+    0x1.ce3e882bb1b89p-3,
+    0x1.cfe73fc5ae05fp-3,
+    0x1.d18ffa6802951p-3,
+    0x1.d338b812af65ep-3,
+    0x1.d4e178c5b4786p-3,
+    0x1.d68a3c8034f8ep-3,
+    0x1.d83303415413bp-3,
+    0x1.d9dbcd0911c8dp-3,
+    0x1.db8499d691449p-3,
+    0x1.dd2d69a9d286ep-3,
+    0x1.ded63c82d58fdp-3,
+    0x1.e07f125fe0b7fp-3,
+    0x1.e227eb40f3ff5p-3,
+    0x1.e3d0c7260f65ep-3,
+    0x1.e579a60f32ebap-3,
+    0x1.e72287fb81bcep-3,
+    0x1.e8cb6ce942324p-3,
+    0x1.ea7454d9511f7p-3,
+    0x1.ec1d3fcbae847p-3,
+    0x1.edc62dbf7d8d8p-3,
+    0x1.ef6f1eb3e167p-3,
+    0x1.f11812a8da10ep-3,
+    0x1.f2c1099e678b3p-3,
+    0x1.f46a0393ad023p-3,
+    0x1.f6130087cda23p-3,
+    0x1.f7bc0079ec978p-3,
+    0x1.f965036ae6b5dp-3,
+    0x1.fb0e0959df297p-3,
+    0x1.fcb71245f91ebp-3,
+    0x1.fe601e2f34959p-3,
+    0x1.0004968ac8c7p-2,
+    0x1.00d91f7c88041p-2,
+    0x1.01ada9ebfb2e3p-2,
+    0x1.028235d8b3db9p-2,
+    0x1.0356c34320761p-2,
+    0x1.042b522ad293dp-2,
+    0x1.04ffe28f5bcbp-2,
+    0x1.05d474712a857p-2,
+    0x1.06a907cfd0594p-2,
+    0x1.077d9caadedcap-2,
+    0x1.08523301e7a5bp-2,
+    0x1.0926cad4eab47p-2,
+    0x1.09fb6423e808fp-2,
+    0x1.0acffeee71394p-2,
+    0x1.0ba49b3486457p-2,
+    0x1.0c7938f5b8c3ap-2,
+    0x1.0d4dd8319a4ap-2,
+    0x1.0e2278e82ad88p-2,
+    0x1.0ef71b196a6f3p-2,
+    0x1.0fcbbec5590ep-2,
+    0x1.10a063eb884b2p-2,
+    0x1.11750a8b89bcbp-2,
+    0x1.1249b2a4eef8ep-2,
+    0x1.131e5c37b7ffbp-2,
+    0x1.13f30744533afp-2,
+    0x1.14c7b3c9e3d6fp-2,
+    0x1.159c61c7fb69ep-2,
+    0x1.1671113f085d9p-2,
+    0x1.1745c22e9c482p-2,
+    0x1.181a749648bfcp-2,
+    0x1.18ef28760dc47p-2,
+    0x1.19c3ddcdeb563p-2,
+    0x1.1a98949d730b2p-2,
+    0x1.1b6d4ce4a4e34p-2,
+    0x1.1c4206a31274cp-2,
+    0x1.1d16c1d84d55cp-2,
+    0x1.1deb7e84c3f02p-2,
+    0x1.1ec03ca807dap-2,
+    0x1.1f94fc41aaa99p-2,
+    0x1.2069bd513df4fp-2,
+    0x1.213e7fd6c1bc1p-2,
+    0x1.221343d235ffp-2,
+    0x1.22e809432c53fp-2,
+    0x1.23bcd029a4badp-2,
+    0x1.2491988530c9dp-2,
+    0x1.25666255d080ep-2,
+    0x1.263b2d9b83e01p-2,
+    0x1.270ffa55dc7d8p-2,
+    0x1.27e4c8846bef6p-2,
+    0x1.28b998273235ap-2,
+    0x1.298e693e2f505p-2,
+    0x1.2a633bc8f4d59p-2,
+    0x1.2b380fc7145b8p-2,
+    0x1.2c0ce5388de22p-2,
+    0x1.2ce1bc1d61698p-2,
+    0x1.2db694752087bp-2,
+    0x1.2e8b6e3fcb3ccp-2,
+    0x1.2f60497cf31edp-2,
+    0x1.3035262c29c41p-2,
+    0x1.310a044d6f2c7p-2,
+    0x1.31dee3e0c358p-2,
+    0x1.32b3c4e62646cp-2,
+    0x1.3388a75d298ecp-2,
+    0x1.345d8b455ec64p-2,
+    0x1.3532709ec5ed3p-2,
+    0x1.360757695f039p-2,
+    0x1.36dc3fa4bb9f9p-2,
+    0x1.37b129506d575p-2,
+    0x1.3886146c742aep-2,
+    0x1.395b00f8d01a3p-2,
+    0x1.3a2feef512bb6p-2,
+    0x1.3b04de60cda4ap-2,
+    0x1.3bd9cf3c00d5fp-2,
+    0x1.3caec186ac4f5p-2,
+    0x1.3d83b54061a6ep-2,
+    0x1.3e58aa6920dcbp-2,
+    0x1.3f2da100e9f0bp-2,
+    0x1.400299074e791p-2,
+    0x1.40d7927be00bfp-2,
+    0x1.41ac8d5e9ea95p-2,
+    0x1.428189af8a513p-2,
+    0x1.4356876e3499cp-2,
+    0x1.442b869a9d83p-2,
+    0x1.4500873456a3p-2,
+    0x1.45d5893af19p-2,
+    0x1.46aa8cae6e49fp-2,
+    0x1.477f918eccd0ep-2,
+    0x1.485497db9ebaep-2,
+    0x1.49299f94759e3p-2,
+    0x1.49fea8b9517acp-2,
+    0x1.4ad3b34a32509p-2,
+    0x1.4ba8bf47181fap-2,
+    0x1.4c7dccb002e7fp-2,
+    0x1.4d52db84843fbp-2,
+    0x1.4e27ebc42dbdp-2,
+    0x1.4efcfd6e90f6p-2,
+    0x1.4fd21083adeacp-2,
+    0x1.50a72503849b3p-2,
+    0x1.517c3aeda69d8p-2,
+    0x1.5251524213f1bp-2,
+    0x1.53266b005e2dep-2,
+    0x1.53fb852885521p-2,
+    0x1.54d0a0ba895e4p-2,
+    0x1.55a5bdb5fbe8ap-2,
+    0x1.567adc1a6e875p-2,
+    0x1.574ffbe7e13a5p-2,
+    0x1.58251d1e5401ap-2,
+    0x1.58fa3fbd58736p-2,
+    0x1.59cf63c4ee8f9p-2,
+    0x1.5aa48934a7ec6p-2,
+    0x1.5b79b00c161ffp-2,
+    0x1.5c4ed84ba7942p-2,
+    0x1.5d2401f2eddf1p-2,
+    0x1.5df92d017a96fp-2,
+    0x1.5ece5977bc259p-2,
+    0x1.5fa38754d5b74p-2,
+    0x1.6078b698c74cp-2,
+    0x1.614de74390e3dp-2,
+    0x1.62231954c414ep-2,
+    0x1.62f84ccc60df2p-2,
+    0x1.63cd81a9f8d8cp-2,
+    0x1.64a2b7ed8c01cp-2,
+    0x1.6577ef96abf04p-2,
+    0x1.664d28a558a44p-2,
+    0x1.67226319921dcp-2,
+    0x1.67f79ef2e9f2fp-2,
+    0x1.68ccdc316023dp-2,
+    0x1.69a21ad486468p-2,
+    0x1.6a775adbedf12p-2,
+    0x1.6b4c9c479723bp-2,
+    0x1.6c21df1781de4p-2,
+    0x1.6cf7234bae20cp-2,
+    0x1.6dcc68e3ad816p-2,
+    0x1.6ea1afdf11964p-2,
+    0x1.6f76f83dda5f7p-2,
+    0x1.704c420007dcep-2,
+    0x1.71218d252ba4bp-2,
+    0x1.71f6d9ad45b6fp-2,
+    0x1.72cc27985613ap-2,
+    0x1.73a176e57fe7p-2,
+    0x1.7476c794c3312p-2,
+    0x1.754c19a68e5bdp-2,
+    0x1.76216d1a04935p-2,
+    0x1.76f6c1eeb76dep-2,
+    0x1.77cc182515554p-2,
+    0x1.78a16fbd1e498p-2,
+    0x1.7976c8b663e0dp-2,
+    0x1.7a4c231077b14p-2,
+    0x1.7b217ecb59baep-2,
+    0x1.7bf6dbe69b93dp-2,
+    0x1.7ccc3a623d3c1p-2,
+    0x1.7da19a3e3eb3ap-2,
+    0x1.7e76fb7a3190ap-2,
+    0x1.7f4c5e1615d32p-2,
+    0x1.8021c2117d114p-2,
+    0x1.80f7276bf8e12p-2,
+    0x1.81cc8e25f7acap-2,
+    0x1.82a1f63f7973cp-2,
+    0x1.83775fb7a162cp-2,
+    0x1.844cca8e6f79bp-2,
+    0x1.852236c3e3b89p-2,
+    0x1.85f7a4578fb58p-2,
+    0x1.86cd13490506ap-2,
+    0x1.87a2839843acp-2,
+    0x1.8877f5454ba59p-2,
+    0x1.894d68501cf36p-2,
+    0x1.8a22dcb8b7956p-2,
+    0x1.8af8527e3eb7ep-2,
+    0x1.8bcdc9a043f11p-2,
+    0x1.8ca3421f35aacp-2,
+    0x1.8d78bbfb13e4fp-2,
+    0x1.8e4e373301ccp-2,
+    0x1.8f23b3c6ff5fep-2,
+    0x1.8ff931b77b0a6p-2,
+    0x1.90ceb1040661bp-2,
+    0x1.91a431ac32fcp-2,
+    0x1.9279b3af926f7p-2,
+    0x1.934f370e24bcp-2,
+    0x1.9424bbc7e9e1ap-2,
+    0x1.94fa41dc73769p-2,
+    0x1.95cfc94bc17acp-2,
+    0x1.96a55215d3ee3p-2,
+    0x1.977adc3a3c671p-2,
+    0x1.985067b88c7b8p-2,
+    0x1.9925f490c42b8p-2,
+    0x1.99fb82c2e3771p-2,
+    0x1.9ad1124eea5e3p-2,
+    0x1.9ba6a3346a771p-2,
+    0x1.9c7c3572f557dp-2,
+    0x1.9d51c90a8b007p-2,
+    0x1.9e275dfb2b70fp-2,
+    0x1.9efcf444d6a94p-2,
+    0x1.9fd28be71e3fap-2,
+    0x1.a0a824e193ca2p-2,
+    0x1.a17dbf343748dp-2,
+    0x1.a2535adf08bbbp-2,
+    0x1.a328f7e199b8ep-2,
+    0x1.a3fe963b7bd68p-2,
+    0x1.a4d435ecaf14ap-2,
+    0x1.a5a9d6f533733p-2,
+    0x1.a67f79549a886p-2,
+    0x1.a7551d0ae4543p-2,
+    0x1.a82ac21810d6ap-2,
+    0x1.a900687bb1a5dp-2,
+    0x1.a9d61035c6c1dp-2,
+    0x1.aaabb946502a9p-2,
+    0x1.ab8163acdf764p-2,
+    0x1.ac570f6897d12p-2,
+    0x1.ad2cbc79e7a51p-2,
+    0x1.ae026ae0cef21p-2,
+    0x1.aed81a9cdf4e5p-2,
+    0x1.afadcbae18b9cp-2,
+    0x1.b0837e140cca9p-2,
+    0x1.b15931cebb80cp-2,
+    0x1.b22ee6ddb6728p-2,
+    0x1.b3049d40fd9fcp-2,
+    0x1.b3da54f891088p-2,
+    0x1.b4b00e040242fp-2,
+    0x1.b585c863514f1p-2,
+    0x1.b65b84167e2cdp-2,
+    0x1.b731411d1a727p-2,
+    0x1.b806ff76b7b6p-2,
+    0x1.b8dcbf2355f79p-2,
+    0x1.b9b28022f5371p-2,
+    0x1.ba884275270abp-2,
+    0x1.bb5e0619eb727p-2,
+    0x1.bc33cb11426e5p-2,
+    0x1.bd09915a4f2aap-2,
+    0x1.bddf58f511a75p-2,
+    0x1.beb521e1f84e5p-2,
+    0x1.bf8aec2094b5bp-2,
+    0x1.c060b7b07873bp-2,
+    0x1.c1368491a3884p-2,
+    0x1.c20c52c415f36p-2,
+    0x1.c2e22247614b3p-2,
+    0x1.c3b7f31b1725ep-2,
+    0x1.c48dc53f37837p-2,
+    0x1.c56398b3c263ep-2,
+    0x1.c6396d78b7c73p-2,
+    0x1.c70f438da9439p-2,
+    0x1.c7e51af296d8fp-2,
+    0x1.c8baf3a7121d8p-2,
+    0x1.c990cdaaaca76p-2,
+    0x1.ca66a8fdd4e07p-2,
+    0x1.cb3c85a01c5edp-2,
+    0x1.cc12639114b8ap-2,
+    0x1.cce842d0bdedfp-2,
+    0x1.cdbe235f17febp-2,
+    0x1.ce94053c22eafp-2,
+    0x1.cf69e8677048dp-2,
+    0x1.d03fcce091ae7p-2,
+    0x1.d115b2a7871bep-2,
+    0x1.d1eb99bc50911p-2,
+    0x1.d2c1821e7fa43p-2,
+    0x1.d3976bce14553p-2,
+    0x1.d46d56cb0ea42p-2,
+    0x1.d543431500272p-2,
+    0x1.d61930ab7a746p-2,
+    0x1.d6ef1f8e7d8bep-2,
+    0x1.d7c50fbe096d9p-2,
+    0x1.d89b0139afafap-2,
+    0x1.d970f40170521p-2,
+    0x1.da46e8154b54ep-2,
+    0x1.db1cdd74d24e3p-2,
+    0x1.dbf2d41f96d43p-2,
+    0x1.dcc8cc160750cp-2,
+    0x1.dd9ec557b559fp-2,
+    0x1.de74bfe43285fp-2,
+    0x1.df4abbbbed3eap-2,
+    0x1.e020b8de771a2p-2,
+    0x1.e0f6b74b61aeap-2,
+    0x1.e1ccb702acfc2p-2,
+    0x1.e2a2b803ea98cp-2,
+    0x1.e378ba4f1a848p-2,
+    0x1.e44ebde43cbf6p-2,
+    0x1.e524c2c2e2df8p-2,
+    0x1.e5fac8eb0ce4ep-2,
+    0x1.e6d0d05cbacf9p-2,
+    0x1.e7a6d9177e35ap-2,
+    0x1.e87ce31ae8ad5p-2,
+    0x1.e952ee66fa369p-2,
+    0x1.ea28fafbb2d16p-2,
+    0x1.eaff08d8a413fp-2,
+    0x1.ebd517fdcdfe3p-2,
+    0x1.ecab286b30903p-2,
+    0x1.ed813a205d601p-2,
+    0x1.ee574d1d546ddp-2,
+    0x1.ef2d616215b97p-2,
+    0x1.f00376ee32d91p-2,
+    0x1.f0d98dc13d62ep-2,
+    0x1.f1afa5db3556ep-2,
+    0x1.f285bf3c1ab51p-2,
+    0x1.f35bd9e3ed7d6p-2,
+    0x1.f431f5d23f461p-2,
+    0x1.f5081306a1a53p-2,
+    0x1.f5de3181149adp-2,
+    0x1.f6b451419826ep-2,
+    0x1.f78a72482c497p-2,
+    0x1.f86094946298ap-2,
+    0x1.f936b825ccaa9p-2,
+    0x1.fa0cdcfc6a7f5p-2,
+    0x1.fae303183c16dp-2,
+    0x1.fbb92a7941712p-2,
+    0x1.fc8f531f0c246p-2,
+    0x1.fd657d092dc6bp-2,
+    0x1.fe3ba837a6581p-2,
+    0x1.ff11d4aa75d88p-2,
+    0x1.ffe802619c48p-2,
+    0x1.005f18ae559e6p-1,
+    0x1.00ca30cdd15b6p-1,
+    0x1.0135498f415bp-1,
+    0x1.01a062f237336p-1,
+    0x1.020b7cf6b2e48p-1,
+    0x1.0276979cb46e6p-1,
+    0x1.02e1b2e43bd1p-1,
+    0x1.034ccecd490c7p-1,
+    0x1.03b7eb57a4ebbp-1,
+    0x1.042308831839ep-1,
+    0x1.048e264fa2f6fp-1,
+    0x1.04f944bd4522fp-1,
+    0x1.056463cbc788fp-1,
+    0x1.05cf837b2a28fp-1,
+    0x1.063aa3cb35cep-1,
+    0x1.06a5c4bbea782p-1,
+    0x1.0710e64d48275p-1,
+    0x1.077c087f17a6ap-1,
+    0x1.07e72b5158f61p-1,
+    0x1.08524ec40c15ap-1,
+    0x1.08bd72d6f9d07p-1,
+    0x1.09289789eaf18p-1,
+    0x1.0993bcdcdf78ep-1,
+    0x1.09fee2cfd7669p-1,
+    0x1.0a6a0962d2ba8p-1,
+    0x1.0ad53095d174cp-1,
+    0x1.0b4058689c606p-1,
+    0x1.0bab80dafc487p-1,
+    0x1.0c16a9ecf12cfp-1,
+    0x1.0c81d39e43d8fp-1,
+    0x1.0cecfdeef44c7p-1,
+    0x1.0d5828df02877p-1,
+    0x1.0dc3546e37551p-1,
+    0x1.0e2e809cc9ea3p-1,
+    0x1.0e99ad6a8311ep-1,
+    0x1.0f04dad72b974p-1,
+    0x1.0f7008e2c37a5p-1,
+    0x1.0fdb378d13862p-1,
+    0x1.104666d61bbaap-1,
+    0x1.10b196bddc17ep-1,
+    0x1.111cc744549dep-1,
+    0x1.1187f8694e17bp-1,
+    0x1.11f32a2c91506p-1,
+    0x1.125e5c8e1e48p-1,
+    0x1.12c98f8df4fe8p-1,
+    0x1.1334c32bde3efp-1,
+    0x1.139ff767da096p-1,
+    0x1.140b2c41e85dcp-1,
+    0x1.147661b9d2073p-1,
+    0x1.14e197cf9705ap-1,
+    0x1.154cce8337592p-1,
+    0x1.15b805d47bcccp-1,
+    0x1.16233dc32d2b9p-1,
+    0x1.168e764f4b759p-1,
+    0x1.16f9af78d6aacp-1,
+    0x1.1764e93fcecb2p-1,
+    0x1.17d023a3fca1cp-1,
+    0x1.183b5ea528f9cp-1,
+    0x1.18a69a438b08p-1,
+    0x1.1911d67eeb979p-1,
+    0x1.197d135713739p-1,
+    0x1.19e850cc39d0ep-1,
+    0x1.1a538ede277aap-1,
+    0x1.1abecd8ca53bep-1,
+    0x1.1b2a0cd7b314ap-1,
+    0x1.1b954cbf5104ep-1,
+    0x1.1c008d4347d7bp-1,
+    0x1.1c6bce63978d1p-1,
+    0x1.1cd710204025p-1,
+    0x1.1d4252790a6a9p-1,
+    0x1.1dad956df65dcp-1,
+    0x1.1e18d8feccc9bp-1,
+    0x1.1e841d2b8dae5p-1,
+    0x1.1eef61f4390bbp-1,
+    0x1.1f5aa75897acdp-1,
+    0x1.1fc5ed58a991cp-1,
+    0x1.203133f46eba7p-1,
+    0x1.209c7b2baff2p-1,
+    0x1.2107c2fe6d387p-1,
+    0x1.21730b6c6f58dp-1,
+    0x1.21de54757f1e3p-1,
+    0x1.22499e19d3bd8p-1,
+    0x1.22b4e8593601ep-1,
+    0x1.23203333a5eb4p-1,
+    0x1.238b7ea92379ap-1,
+    0x1.23f6cab977782p-1,
+    0x1.24621764a1e6bp-1,
+    0x1.24cd64aa6b907p-1,
+    0x1.2538b28ad4755p-1,
+    0x1.25a40105dc956p-1,
+    0x1.260f501b4cbbbp-1,
+    0x1.267a9fcb24e84p-1,
+    0x1.26e5f0152de62p-1,
+    0x1.275140f967b55p-1,
+    0x1.27bc9277d255dp-1,
+    0x1.2827e4903692bp-1,
+    0x1.28933742946cp-1,
+    0x1.28fe8a8eebe1bp-1,
+    0x1.2969de7505bedp-1,
+    0x1.29d532f4aace8p-1,
+    0x1.2a40880e1245ap-1,
+    0x1.2aabddc104ef5p-1,
+    0x1.2b17340d4b96ap-1,
+    0x1.2b828af31d708p-1,
+    0x1.2bede2724347fp-1,
+    0x1.2c593a8a85e81p-1,
+    0x1.2cc4933be550fp-1,
+    0x1.2d2fec8661828p-1,
+    0x1.2d9b4669fa7ccp-1,
+    0x1.2e06a0e6790acp-1,
+    0x1.2e71fbfbdd2c8p-1,
+    0x1.2edd57aa26e2p-1,
+    0x1.2f48b3f0e7c17p-1,
+    0x1.2fb410d01fcadp-1,
+    0x1.301f6e480633p-1,
+    0x1.308acc5863c52p-1,
+    0x1.30f62b01014c4p-1,
+    0x1.31618a41dec86p-1,
+    0x1.31ccea1afc398p-1,
+    0x1.32384a8c226abp-1,
+    0x1.32a3ab95515bfp-1,
+    0x1.330f0d36890d4p-1,
+    0x1.337a6f6f9249bp-1,
+    0x1.33e5d2406d114p-1,
+    0x1.345135a91964p-1,
+    0x1.34bc99a9600cfp-1,
+    0x1.3527fe4109d73p-1,
+    0x1.3593637016c2bp-1,
+    0x1.35fec936be047p-1,
+    0x1.366a2f94c8678p-1,
+    0x1.36d59689feb6ep-1,
+    0x1.3740fe1660f2ap-1,
+    0x1.37ac6639b7e5dp-1,
+    0x1.3817cef403907p-1,
+    0x1.3883384543f29p-1,
+    0x1.38eea22d790c2p-1,
+    0x1.395a0cac6ba83p-1,
+    0x1.39c577c1e491dp-1,
+    0x1.3a30e36e1afep-1,
+    0x1.3a9c4fb0d7b7cp-1,
+    0x1.3b07bc89e38a3p-1,
+    0x1.3b7329f975aa3p-1,
+    0x1.3bde97ff56e2ep-1,
+    0x1.3c4a069b4fff5p-1,
+    0x1.3cb575cd60ff8p-1,
+    0x1.3d20e59589e37p-1,
+    0x1.3d8c55f3caab1p-1,
+    0x1.3df7c6e7ec219p-1,
+    0x1.3e633871b711fp-1,
+    0x1.3eceaa912b7c3p-1,
+    0x1.3f3a1d4649605p-1,
+    0x1.3fa5909110be6p-1,
+    0x1.401104714a616p-1,
+    0x1.407c78e6f6496p-1,
+    0x1.40e7edf214765p-1,
+    0x1.415363926db35p-1,
+    0x1.41bed9c802006p-1,
+    0x1.422a50929a288p-1,
+    0x1.4295c7f2362bcp-1,
+    0x1.43013fe6d60a2p-1,
+    0x1.436cb870428ebp-1,
+    0x1.43d8318e7bb97p-1,
+    0x1.4443ab414a558p-1,
+    0x1.44af2588ae62dp-1,
+    0x1.451aa064a7e16p-1,
+    0x1.45861bd536d14p-1,
+    0x1.45f197da23fd7p-1,
+    0x1.465d147338311p-1,
+    0x1.46c891a0aaa1p-1,
+    0x1.47340f6244186p-1,
+    0x1.479f8db804973p-1,
+    0x1.480b0ca1ec1d6p-1,
+    0x1.48768c1f8c412p-1,
+    0x1.48e20c30e5028p-1,
+    0x1.494d8cd62d965p-1,
+    0x1.49b90e0f2ec7cp-1,
+    0x1.4a248fdbb161dp-1,
+    0x1.4a90123bb5648p-1,
+    0x1.4afb952f3acfdp-1,
+    0x1.4b6718b641a3dp-1,
+    0x1.4bd29cd092ab8p-1,
+    0x1.4c3e217df6b2p-1,
+    0x1.4ca9a6be6db75p-1,
+    0x1.4d152c922ef05p-1,
+    0x1.4d80b2f903282p-1,
+    0x1.4dec39f2b329dp-1,
+    0x1.4e57c17f3ef56p-1,
+    0x1.4ec3499e6f55ep-1,
+    0x1.4f2ed250444b5p-1,
+    0x1.4f9a5b94bdd5bp-1,
+    0x1.5005e56bdbf5p-1,
+    0x1.50716fd567745p-1,
+    0x1.50dcfad16053bp-1,
+    0x1.5148865fc6931p-1,
+    0x1.51b4128062fd8p-1,
+    0x1.521f9f3335931p-1,
+    0x1.528b2c78071edp-1,
+    0x1.52f6ba4ea06bdp-1,
+    0x1.536248b738aefp-1,
+    0x1.53cdd7b1cfe84p-1,
+    0x1.5439673e2ee2dp-1,
+    0x1.54a4f75c1e69bp-1,
+    0x1.5510880b9e7cep-1,
+    0x1.557c194caf1c6p-1,
+    0x1.55e7ab1f19135p-1,
+    0x1.56533d82dc61ap-1,
+    0x1.56bed077f9075p-1,
+    0x1.572a63fe6f046p-1,
+    0x1.5795f8160723fp-1,
+    0x1.58018cbe8a311p-1,
+    0x1.586d21f82f60ap-1,
+    0x1.58d8b7c2f6b2bp-1,
+    0x1.59444e1e71bd6p-1,
+    0x1.59afe50aa080bp-1,
+    0x1.5a1b7c8782fc9p-1,
+    0x1.5a87149519311p-1,
+    0x1.5af2ad33631e3p-1,
+    0x1.5b5e4661f25a2p-1,
+    0x1.5bc9e020c6e4dp-1,
+    0x1.5c357a7017f33p-1,
+    0x1.5ca1154fae505p-1,
+    0x1.5d0cb0bf52c75p-1,
+    0x1.5d784cbf05582p-1,
+    0x1.5de3e94ec602dp-1,
+    0x1.5e4f866e94c75p-1,
+    0x1.5ebb241e3a70cp-1,
+    0x1.5f26c25d7fca3p-1,
+    0x1.5f92612c64d3ap-1,
+    0x1.5ffe008ae98d1p-1,
+    0x1.6069a0790df68p-1,
+    0x1.60d540f6d20ffp-1,
+    0x1.6140e203fea47p-1,
+    0x1.61ac83a05c7f1p-1,
+    0x1.621825cc22d4cp-1,
+    0x1.6283c88751a58p-1,
+    0x1.62ef6bd17a878p-1,
+    0x1.635b0faa9d7acp-1,
+    0x1.63c6b412ba7f3p-1,
+    0x1.643259099a5ffp-1,
+    0x1.649dfe8f3d1cfp-1,
+    0x1.6509a4a3a2b64p-1,
+    0x1.65754b46cb2bep-1,
+    0x1.65e0f2787f48ep-1,
+    0x1.664c9a38bf0d4p-1,
+    0x1.66b842878a79p-1,
+    0x1.6723eb64aa573p-1,
+    0x1.678f94cfe772ep-1,
+    0x1.67fb3ec941cc2p-1,
+    0x1.6866e950f097dp-1,
+    0x1.68d29466bca1p-1,
+    0x1.693e400a6eb2dp-1,
+    0x1.69a9ec3c06cd3p-1,
+    0x1.6a1598fb84f03p-1,
+    0x1.6a814648b1e6dp-1,
+    0x1.6aecf4238db12p-1,
+    0x1.6b58a28c184f2p-1,
+    0x1.6bc451821a8bep-1,
+    0x1.6c30010594676p-1,
+    0x1.6c9bb11685e1ap-1,
+    0x1.6d0761b4b7c5bp-1,
+    0x1.6d7312e02a139p-1,
+    0x1.6ddec498dccb4p-1,
+    0x1.6e4a76de98b7dp-1,
+    0x1.6eb629b15dd95p-1,
+    0x1.6f21dd10f4facp-1,
+    0x1.6f8d90fd5e1c3p-1,
+    0x1.6ff94576993d9p-1,
+    0x1.7064fa7c6f2ap-1,
+    0x1.70d0b00edfe18p-1,
+    0x1.713c662deb641p-1,
+    0x1.71a81cd991b1ap-1,
+    0x1.7213d4119b955p-1,
+    0x1.727f8bd6090f2p-1,
+    0x1.72eb4426da1f1p-1,
+    0x1.7356fd03d7903p-1,
+    0x1.73c2b66cca2dap-1,
+    0x1.742e7061b1f75p-1,
+    0x1.749a2ae2c6223p-1,
+    0x1.7505e5efcf795p-1,
+    0x1.7571a18896c7dp-1,
+    0x1.75dd5dad1c0dap-1,
+    0x1.76491a5d5f4adp-1,
+    0x1.76b4d799294a7p-1,
+    0x1.772095607a0c8p-1,
+    0x1.778c53b35190fp-1,
+    0x1.77f8129178a2ep-1,
+    0x1.7863d1faef425p-1,
+    0x1.78cf91efb56f4p-1,
+    0x1.793b526f93f4cp-1,
+    0x1.79a7137a8ad2dp-1,
+    0x1.7a12d5109a098p-1,
+    0x1.7a7e97318a63dp-1,
+    0x1.7aea59dd5be1cp-1,
+    0x1.7b561d140e836p-1,
+    0x1.7bc1e0d56b13bp-1,
+    0x1.7c2da5217192cp-1,
+    0x1.7c9969f822008p-1,
+    0x1.7d052f5945281p-1,
+    0x1.7d70f544db097p-1,
+    0x1.7ddcbbbae3a4ap-1,
+    0x1.7e4882bb27c4ap-1,
+    0x1.7eb44a457034ap-1,
+    0x1.7f201259f4298p-1,
+    0x1.7f8bdaf8b3a34p-1,
+    0x1.7ff7a421776cfp-1,
+    0x1.80636dd40851ap-1,
+    0x1.80cf381066515p-1,
+    0x1.813b02d6916c1p-1,
+    0x1.81a6ce2689a1dp-1,
+    0x1.82129a0017bdbp-1,
+    0x1.827e6663048abp-1,
+    0x1.82ea334f873ddp-1,
+    0x1.835600c568a22p-1,
+    0x1.83c1cec4a8b7ap-1,
+    0x1.842d9d4d477e4p-1,
+    0x1.84996c5f0dc12p-1,
+    0x1.85053bf9fb804p-1,
+    0x1.85710c1dd986bp-1,
+    0x1.85dcdccaa7d48p-1,
+    0x1.8648ae006669ap-1,
+    0x1.86b47fbf15461p-1,
+    0x1.87205206b469dp-1,
+    0x1.878c24d6d56b1p-1,
+    0x1.87f7f82f7849cp-1,
+    0x1.8863cc10d43aep-1,
+    0x1.88cfa07ab2097p-1,
+    0x1.893b756cda809p-1,
+    0x1.89a74ae74da04p-1,
+    0x1.8a1320ea0b687p-1,
+    0x1.8a7ef774dca44p-1,
+    0x1.8aeace87c153bp-1,
+    0x1.8b56a622f0abbp-1,
+    0x1.8bc27e4633775p-1,
+    0x1.8c2e56f15281ap-1,
+    0x1.8c9a30241695cp-1,
+    0x1.8d0609de7fb3ap-1,
+    0x1.8d71e420c5103p-1,
+    0x1.8dddbeeaaf769p-1,
+    0x1.8e499a3c07b1cp-1,
+    0x1.8eb57614cdc1dp-1,
+    0x1.8f21527501a6bp-1,
+    0x1.8f8d2f5ca3607p-1,
+    0x1.8ff90ccb7bba2p-1,
+    0x1.9064eac18ab3bp-1,
+    0x1.90d0c93ed04d3p-1,
+    0x1.913ca8431551bp-1,
+    0x1.91a887ce59c13p-1,
+    0x1.921467e06666cp-1,
+    0x1.928048793b426p-1,
+    0x1.92ec2998d8542p-1,
+    0x1.93580b3f0667p-1,
+    0x1.93c3ed6bc57bp-1,
+    0x1.942fd01f15903p-1,
+    0x1.949bb358f6a68p-1,
+    0x1.9507971931891p-1,
+    0x1.95737b5fc637dp-1,
+    0x1.95df602cb4b2dp-1,
+    0x1.964b457fc5c52p-1,
+    0x1.96b72b58f96ebp-1,
+    0x1.972311b8187aap-1,
+    0x1.978ef89d22e8fp-1,
+    0x1.97fae00818b9ap-1,
+    0x1.9866c7f8c2b7dp-1,
+    0x1.98d2b06f58186p-1,
+    0x1.993e996bd8db4p-1,
+    0x1.99aa82edd696bp-1,
+    0x1.9a166cf5514aap-1,
+    0x1.9a82578248f72p-1,
+    0x1.9aee4294bd9c2p-1,
+    0x1.9b5a2e2c7804cp-1,
+    0x1.9bc61a4940fcp-1,
+    0x1.9c3206eb4fb6ep-1,
+    0x1.9c9df4126d007p-1,
+    0x1.9d09e1be98d8bp-1,
+    0x1.9d75cfefd33f9p-1,
+    0x1.9de1bea5e5003p-1,
+    0x1.9e4dade0ce1a9p-1,
+    0x1.9eb99da08e8ebp-1,
+    0x1.9f258de5265c9p-1,
+    0x1.9f917eae5e4f4p-1,
+    0x1.9ffd6ffbff31ep-1,
+    0x1.a06961ce09046p-1,
+    0x1.a0d554247bc6dp-1,
+    0x1.a14146ff57792p-1,
+    0x1.a1ad3a5e9c1b5p-1,
+    0x1.a2192e4212788p-1,
+    0x1.a28522a9835bcp-1,
+    0x1.a2f1179525f9fp-1,
+    0x1.a35d0d04c31e3p-1,
+    0x1.a3c902f823939p-1,
+    0x1.a434f96f7e8fp-1,
+    0x1.a4a0f06a9cdb9p-1,
+    0x1.a50ce7e97e794p-1,
+    0x1.a578dfec23681p-1,
+    0x1.a5e4d87254731p-1,
+    0x1.a650d17bda656p-1,
+    0x1.a6bccb08b53efp-1,
+    0x1.a728c5191c34bp-1,
+    0x1.a794bfacd811cp-1,
+    0x1.a800bac3b1a12p-1,
+    0x1.a86cb65da8e2ep-1,
+    0x1.a8d8b27abdd6fp-1,
+    0x1.a944af1af07d6p-1,
+    0x1.a9b0ac3e09a14p-1,
+    0x1.aa1ca9e409429p-1,
+    0x1.aa88a80cef614p-1,
+    0x1.aaf4a6b884c87p-1,
+    0x1.ab60a5e6c9782p-1,
+    0x1.abcca597863b7p-1,
+    0x1.ac38a5cabb125p-1,
+    0x1.aca4a68067fccp-1,
+    0x1.ad10a7b88cfacp-1,
+    0x1.ad7ca9732a0c5p-1,
+    0x1.ade8abb007fc9p-1,
+    0x1.ae54ae6eef968p-1,
+    0x1.aec0b1afe0da3p-1,
+    0x1.af2cb57312fc8p-1,
+    0x1.af98b9b84ec89p-1,
+    0x1.b004be7f5d097p-1,
+    0x1.b070c3c83dbf2p-1,
+    0x1.b0dcc992b9b4bp-1,
+    0x1.b148cfded0ea2p-1,
+    0x1.b1b4d6acba945p-1,
+    0x1.b220ddfc3f7e6p-1,
+    0x1.b28ce5cd28737p-1,
+    0x1.b2f8ee1f75737p-1,
+    0x1.b364f6f3267e6p-1,
+    0x1.b3d100483b944p-1,
+    0x1.b43d0a1e7d803p-1,
+    0x1.b4a91475ec422p-1,
+    0x1.b5151f4e87da1p-1,
+    0x1.b5812aa819132p-1,
+    0x1.b5ed368268b86p-1,
+    0x1.b65942dd76c9dp-1,
+    0x1.b6c54fb97a7c5p-1,
+    0x1.b7315d163c9bp-1,
+    0x1.b79d6af385f0fp-1,
+    0x1.b8097951567e2p-1,
+    0x1.b875882fe5778p-1,
+    0x1.b8e1978efba82p-1,
+    0x1.b94da76e61db1p-1,
+    0x1.b9b9b7ce18105p-1,
+    0x1.ba25c8ae1e47fp-1,
+    0x1.ba91da0e7481ep-1,
+    0x1.bafdebeee3893p-1,
+    0x1.bb69fe4f3429p-1,
+    0x1.bbd6112f66615p-1,
+    0x1.bc42248fb167p-1,
+    0x1.bcae386fde053p-1,
+    0x1.bd1a4ccfb506ep-1,
+    0x1.bd8661af366c2p-1,
+    0x1.bdf2770e6234fp-1,
+    0x1.be5e8ced38615p-1,
+    0x1.becaa34b81bc5p-1,
+    0x1.bf36ba293e45fp-1,
+    0x1.bfa2d1866dfe3p-1,
+    0x1.c00ee962d9b02p-1,
+    0x1.c07b01be815bcp-1,
+    0x1.c0e71a992dcc3p-1,
+    0x1.c15333f2df016p-1,
+    0x1.c1bf4dcb94fb6p-1,
+    0x1.c22b68234fba2p-1,
+    0x1.c29782fa0f3dap-1,
+    0x1.c3039e4f9c51p-1,
+    0x1.c36fba23f6f44p-1,
+    0x1.c3dbd676e7f27p-1,
+    0x1.c447f3486f4b8p-1,
+    0x1.c4b410988cff8p-1,
+    0x1.c5202e6709d98p-1,
+    0x1.c58c4cb3e5d98p-1,
+    0x1.c5f86b7f20ff8p-1,
+    0x1.c6648ac8bb4b8p-1,
+    0x1.c6d0aa907d88ap-1,
+    0x1.c73ccad667b6dp-1,
+    0x1.c7a8eb9a79d61p-1,
+    0x1.c8150cdc7cb17p-1,
+    0x1.c8812e9c7049p-1,
+    0x1.c8ed50da549cbp-1,
+    0x1.c9597395f277ap-1,
+    0x1.c9c596cf49d9dp-1,
+    0x1.ca31ba865ac33p-1,
+    0x1.ca9ddebaedfeep-1,
+    0x1.cb0a036d038cep-1,
+    0x1.cb76289c9b6d3p-1,
+    0x1.cbe24e49b59fcp-1,
+    0x1.cc4e74741aefcp-1,
+    0x1.ccba9b1bcb5d2p-1,
+    0x1.cd26c240c6e7ep-1,
+    0x1.cd92e9e2d65b1p-1,
+    0x1.cdff1201f9b6bp-1,
+    0x1.ce6b3a9df9c5ep-1,
+    0x1.ced763b6d6889p-1,
+    0x1.cf438d4c8ffecp-1,
+    0x1.cfafb75f26288p-1,
+    0x1.d01be1ee9905cp-1,
+    0x1.d0880cfab161ap-1,
+    0x1.d0f438836f3c2p-1,
+    0x1.d16064889b604p-1,
+    0x1.d1cc910a35ce1p-1,
+    0x1.d238be083e859p-1,
+    0x1.d2a4eb827e51dp-1,
+    0x1.d3111978f532dp-1,
+    0x1.d37d47eba3289p-1,
+    0x1.d3e976da88331p-1,
+    0x1.d455a6456d1d6p-1,
+    0x1.d4c1d62c51e79p-1,
+    0x1.d52e068f36919p-1,
+    0x1.d59a376de3e67p-1,
+    0x1.d60668c859e64p-1,
+    0x1.d6729a9e9890fp-1,
+    0x1.d6deccf068b1ap-1,
+    0x1.d74affbdca485p-1,
+    0x1.d7b73306bd54fp-1,
+    0x1.d82366cb41d79p-1,
+    0x1.d88f9b0b209b4p-1,
+    0x1.d8fbcfc6226b1p-1,
+    0x1.d96804fc7e7bfp-1,
+    0x1.d9d43aae34cddp-1,
+    0x1.da4070db0e2bdp-1,
+    0x1.daaca782d3611p-1,
+    0x1.db18dea5846d8p-1,
+    0x1.db85164321512p-1,
+    0x1.dbf14e5baa0bfp-1,
+    0x1.dc5d86ef1e9ep-1,
+    0x1.dcc9bffd47d25p-1,
+    0x1.dd35f985ee74p-1,
+    0x1.dda2338949b7fp-1,
+    0x1.de0e6e07599e3p-1,
+    0x1.de7aa8ffe6f1cp-1,
+    0x1.dee6e472ba7dcp-1,
+    0x1.df53205fd4423p-1,
+    0x1.dfbf5cc7343f1p-1,
+    0x1.e02b99a8a33f7p-1,
+    0x1.e097d70458784p-1,
+    0x1.e10414da1cb49p-1,
+    0x1.e1705329b8bf7p-1,
+    0x1.e1dc91f363cddp-1,
+    0x1.e248d136e6aacp-1,
+    0x1.e2b510f441565p-1,
+    0x1.e321512b73d07p-1,
+    0x1.e38d91dc46e43p-1,
+    0x1.e3f9d306ba91ap-1,
+    0x1.e46614aaced8bp-1,
+    0x1.e4d256c84c848p-1,
+    0x1.e53e995f33951p-1,
+    0x1.e5aadc6f840a5p-1,
+    0x1.e6171ff906af6p-1,
+    0x1.e68363fbbb844p-1,
+    0x1.e6efa877a288fp-1,
+    0x1.e75bed6c84888p-1,
+    0x1.e7c832da6182fp-1,
+    0x1.e83478c139784p-1,
+    0x1.e8a0bf20d5338p-1,
+    0x1.e90d05f934b4cp-1,
+    0x1.e9794d4a57fbfp-1,
+    0x1.e9e595143f091p-1,
+    0x1.ea51dd56e9dc2p-1,
+    0x1.eabe261221404p-1,
+    0x1.eb2a6f45ae007p-1,
+    0x1.eb96b8f1c751bp-1,
+    0x1.ec03031635ff1p-1,
+    0x1.ec6f4db2c2d39p-1,
+    0x1.ecdb98c7a5043p-1,
+    0x1.ed47e454dc90fp-1,
+    0x1.edb4305a3244ep-1,
+    0x1.ee207cd76eeb1p-1,
+    0x1.ee8cc9cc92838p-1,
+    0x1.eef917399d0e3p-1,
+    0x1.ef65651e8e8b2p-1,
+    0x1.efd1b37b66fa5p-1,
+    0x1.f03e024fef26dp-1,
+    0x1.f0aa519befdbcp-1,
+    0x1.f116a15fa04ep-1,
+    0x1.f182f19b007d9p-1,
+    0x1.f1ef424da200ap-1,
+    0x1.f25b937784d73p-1,
+    0x1.f2c7e518e0362p-1,
+    0x1.f33437317ce89p-1,
+    0x1.f3a089c15aee7p-1,
+    0x1.f40cdcc87a47dp-1,
+    0x1.f47930466c8adp-1,
+    0x1.f4e5843b31b77p-1,
+    0x1.f551d8a70102ap-1,
+    0x1.f5be2d89da6c6p-1,
+    0x1.f62a82e386bfcp-1,
+    0x1.f696d8b3cec7dp-1,
+    0x1.f7032efab284ap-1,
+    0x1.f76f85b831f62p-1,
+    0x1.f7dbdcec4d1c5p-1,
+    0x1.f8483496ccc25p-1,
+    0x1.f8b48cb7b0e81p-1,
+    0x1.f920e54ef98dap-1,
+    0x1.f98d3e5c6f7ep-1,
+    0x1.f9f997e012b94p-1,
+    0x1.fa65f1d9e33f6p-1,
+    0x1.fad24c49e1105p-1,
+    0x1.fb3ea7300c2c2p-1,
+    0x1.fbab028c2d5dep-1,
+    0x1.fc175e5e0d70ap-1,
+    0x1.fc83baa5ac646p-1,
+    0x1.fcf017630a392p-1,
+    0x1.fd5c749626eeep-1,
+    0x1.fdc8d23f0285ap-1,
+    0x1.fe35305d65c88p-1,
+    0x1.fea18ef150b77p-1,
+    0x1.ff0dedfac3527p-1,
+    0x1.ff7a4d798664ap-1,
+    0x1.ffe6ad6d99edfp-1,
+    0x1.002986eb7ef73p+0,
+    0x1.005fb75ad933p+0,
+    0x1.0095e804c00ffp+0,
+    0x1.00cc18e917f38p+0,
+    0x1.01024a07e0ddcp+0,
+    0x1.01387b611aceap+0,
+    0x1.016eacf4c5c63p+0,
+    0x1.01a4dec2e1c46p+0,
+    0x1.01db10cb6ec94p+0,
+    0x1.0211430e513a5p+0,
+    0x1.0247758b6d7d1p+0,
+    0x1.027da842df2cp+0,
+    0x1.02b3db34a6472p+0,
+    0x1.02ea0e60a734p+0,
+    0x1.032041c6c6582p+0,
+    0x1.0356756703b38p+0,
+    0x1.038ca9415f463p+0,
+    0x1.03c2dd55bd75bp+0,
+    0x1.03f911a41e41fp+0,
+    0x1.042f462c81abp+0,
+    0x1.04657aeee7b0ep+0,
+    0x1.049bafeb50539p+0,
+    0x1.04d1e5219ff89p+0,
+    0x1.05081a91d69ffp+0,
+    0x1.053e503bf449ap+0,
+    0x1.0574861fdd5b3p+0,
+    0x1.05aabc3d91d4ap+0,
+    0x1.05e0f29511b5fp+0,
+    0x1.061729264164bp+0,
+    0x1.064d5ff120e0ep+0,
+    0x1.068396f5b02a7p+0,
+    0x1.06b9ce33ef417p+0,
+    0x1.06f005abde25ep+0,
+    0x1.07263d5d45a2cp+0,
+    0x1.075c754825b82p+0,
+    0x1.0792ad6c9a008p+0,
+    0x1.07c8e5ca86e15p+0,
+    0x1.07ff1e61d0c03p+0,
+    0x1.0835573293379p+0,
+    0x1.086b903cce477p+0,
+    0x1.08a1c98066555p+0,
+    0x1.08d802fd3fc6cp+0,
+    0x1.090e3cb35a9bcp+0,
+    0x1.094476a2b6d45p+0,
+    0x1.097ab0cb54707p+0,
+    0x1.09b0eb2d33702p+0,
+    0x1.09e725c83838fp+0,
+    0x1.0a1d609c62caep+0,
+    0x1.0a539ba9978b7p+0,
+    0x1.0a89d6efd67aap+0,
+    0x1.0ac0126f1f987p+0,
+    0x1.0af64e2772e4fp+0,
+    0x1.0b2c8a18d0601p+0,
+    0x1.0b62c6431c6f6p+0,
+    0x1.0b9902a63b786p+0,
+    0x1.0bcf3f422d7b2p+0,
+    0x1.0c057c170e12p+0,
+    0x1.0c3bb924c1a2ap+0,
+    0x1.0c71f66b2c928p+0,
+    0x1.0ca833ea4ee1ap+0,
+    0x1.0cde71a2289p+0,
+    0x1.0d14af92b99dap+0,
+    0x1.0d4aedbc020a8p+0,
+    0x1.0d812c1de63c3p+0,
+    0x1.0db76ab86632ap+0,
+    0x1.0deda98b81edep+0,
+    0x1.0e23e8971dd37p+0,
+    0x1.0e5a27db39e36p+0,
+    0x1.0e906757d61dap+0,
+    0x1.0ec6a70cd6e7cp+0,
+    0x1.0efce6fa3c41cp+0,
+    0x1.0f332720062b9p+0,
+    0x1.0f69677e190adp+0,
+    0x1.0f9fa8149079fp+0,
+    0x1.0fd5e8e350de7p+0,
+    0x1.100c29ea3e9dep+0,
+    0x1.10426b297552cp+0,
+    0x1.1078aca0d9629p+0,
+    0x1.10aeee506acd5p+0,
+    0x1.10e530382993p+0,
+    0x1.111b7257fa193p+0,
+    0x1.1151b4afdc5fdp+0,
+    0x1.1187f73fd066fp+0,
+    0x1.11be3a07ba941p+0,
+    0x1.11f47d079ae73p+0,
+    0x1.122ac03f71606p+0,
+    0x1.126103af22651p+0,
+    0x1.12974756adf55p+0,
+    0x1.12cd8b3614112p+0,
+    0x1.1303cf4d54b88p+0,
+    0x1.133a139c6feb7p+0,
+    0x1.137058234a0f7p+0,
+    0x1.13a69ce1c78a1p+0,
+    0x1.13dce1d7e85b5p+0,
+    0x1.14132705c81dbp+0,
+    0x1.14496c6b4b36bp+0,
+    0x1.147fb208560bep+0,
+    0x1.14b5f7dd0437bp+0,
+    0x1.14ec3de93a1fap+0,
+    0x1.1522842cdc295p+0,
+    0x1.1558caa805ef2p+0,
+    0x1.158f115ab7712p+0,
+    0x1.15c55844b97a6p+0,
+    0x1.15fb9f660c0aep+0,
+    0x1.1631e6becabd1p+0,
+    0x1.16682e4ed9f68p+0,
+    0x1.169e761639b73p+0,
+    0x1.16d4be14e9ff2p+0,
+    0x1.170b064acf33dp+0,
+    0x1.17414eb7e9554p+0,
+    0x1.1777975c1cc91p+0,
+    0x1.17ade037698f3p+0,
+    0x1.17e42949cfa7ap+0,
+    0x1.181a72934f126p+0,
+    0x1.1850bc13e7cf7p+0,
+    0x1.188705cb7e445p+0,
+    0x1.18bd4fba12711p+0,
+    0x1.18f399dfa455bp+0,
+    0x1.1929e43c1857bp+0,
+    0x1.19602ecf6e771p+0,
+    0x1.19967999a6b3ep+0,
+    0x1.19ccc49aa5739p+0,
+    0x1.1a030fd26ab63p+0,
+    0x1.1a395b40f67bcp+0,
+    0x1.1a6fa6e648c44p+0,
+    0x1.1aa5f2c245f53p+0,
+    0x1.1adc3ed4ee0eap+0,
+    0x1.1b128b1e41108p+0,
+    0x1.1b48d79e23606p+0,
+    0x1.1b7f245494fe5p+0,
+    0x1.1bb5714195ea4p+0,
+    0x1.1bebbe6526243p+0,
+    0x1.1c220bbf2a11ap+0,
+    0x1.1c58594fa1b2ap+0,
+    0x1.1c8ea7168d073p+0,
+    0x1.1cc4f513d074dp+0,
+    0x1.1cfb43476bfb8p+0,
+    0x1.1d3191b15f9b4p+0,
+    0x1.1d67e051ab542p+0,
+    0x1.1d9e2f284f261p+0,
+    0x1.1dd47e352f76ap+0,
+    0x1.1e0acd7830ab5p+0,
+    0x1.1e411cf16e5eap+0,
+    0x1.1e776ca0e8909p+0,
+    0x1.1eadbc86680c3p+0,
+    0x1.1ee40ca1ecd18p+0,
+    0x1.1f1a5cf3927bp+0,
+    0x1.1f50ad7b3d6e3p+0,
+    0x1.1f86fe38edab1p+0,
+    0x1.1fbd4f2ca331ap+0,
+    0x1.1ff3a05642677p+0,
+    0x1.2029f1b5cb4c7p+0,
+    0x1.2060434b3de0bp+0,
+    0x1.209695167e89bp+0,
+    0x1.20cce7178d477p+0,
+    0x1.2103394e6a1ap+0,
+    0x1.21398bbaf966ep+0,
+    0x1.216fde5d3b2ep+0,
+    0x1.21a631352f6f7p+0,
+    0x1.21dc8442d62b3p+0,
+    0x1.2212d7862f614p+0,
+    0x1.22492aff1f773p+0,
+    0x1.227f7ead8ad28p+0,
+    0x1.22b5d2918d0dap+0,
+    0x1.22ec26ab2628ap+0,
+    0x1.23227afa3a89p+0,
+    0x1.2358cf7eae944p+0,
+    0x1.238f2438824a7p+0,
+    0x1.23c57927d146p+0,
+    0x1.23fbce4c7fec8p+0,
+    0x1.243223a672a37p+0,
+    0x1.24687935a96adp+0,
+    0x1.249ecefa2442bp+0,
+    0x1.24d524f3e32bp+0,
+    0x1.250b7b22e623cp+0,
+    0x1.2541d18711928p+0,
+    0x1.2578282065774p+0,
+    0x1.25ae7eeee1d2p+0,
+    0x1.25e4d5f26b084p+0,
+    0x1.261b2d2b011a1p+0,
+    0x1.26518498a4076p+0,
+    0x1.2687dc3b3835cp+0,
+    0x1.26be3412bda53p+0,
+    0x1.26f48c1f4ff03p+0,
+    0x1.272ae460d37c4p+0,
+    0x1.27613cd72caefp+0,
+    0x1.279795825b883p+0,
+    0x1.27cdee6260081p+0,
+    0x1.280447773a2e9p+0,
+    0x1.283aa0c0ce613p+0,
+    0x1.2870fa3f01058p+0,
+    0x1.28a753f1edb5fp+0,
+    0x1.28ddadd994728p+0,
+    0x1.291407f5d9a0cp+0,
+    0x1.294a6246bd40bp+0,
+    0x1.2980bccc3f525p+0,
+    0x1.29b71786443b2p+0,
+    0x1.29ed7274cbfb3p+0,
+    0x1.2a23cd97d6927p+0,
+    0x1.2a5a28ef48667p+0,
+    0x1.2a90847b21774p+0,
+    0x1.2ac6e03b61c4dp+0,
+    0x1.2afd3c30094f2p+0,
+    0x1.2b339858fc7bbp+0,
+    0x1.2b69f4b63b4a9p+0,
+    0x1.2ba05147c5bbcp+0,
+    0x1.2bd6ae0d8034cp+0,
+    0x1.2c0d0b076ab59p+0,
+    0x1.2c436835853e4p+0,
+    0x1.2c79c597cfcecp+0,
+    0x1.2cb0232e4a671p+0,
+    0x1.2ce680f8d96ccp+0,
+    0x1.2d1cdef77cdfdp+0,
+    0x1.2d533d2a34c04p+0,
+    0x1.2d899b90e5739p+0,
+    0x1.2dbffa2b8ef9dp+0,
+    0x1.2df658fa3152fp+0,
+    0x1.2e2cb7fcb0e48p+0,
+    0x1.2e6317330dae8p+0,
+    0x1.2e99769d634b7p+0,
+    0x1.2ecfd63b9620dp+0,
+    0x1.2f06360d8a943p+0,
+    0x1.2f3c961340a58p+0,
+    0x1.2f72f64cb854dp+0,
+    0x1.2fa956b9f1a22p+0,
+    0x1.2fdfb75ad0f2fp+0,
+    0x1.3016182f56474p+0,
+    0x1.304c7937819f2p+0,
+    0x1.3082da73376p+0,
+    0x1.30b93be27789fp+0,
+    0x1.30ef9d85421cfp+0,
+    0x1.3125ff5b9719p+0,
+    0x1.315c61655ae3bp+0,
+    0x1.3192c3a28d7cfp+0,
+    0x1.31c926132ee4dp+0,
+    0x1.31ff88b72380dp+0,
+    0x1.3235eb8e6b50fp+0,
+    0x1.326c4e9906553p+0,
+    0x1.32a2b1d6f48d9p+0,
+    0x1.32d9154835fa1p+0,
+    0x1.330f78ecaf004p+0,
+    0x1.3345dcc44405ap+0,
+    0x1.337c40cf10a4bp+0,
+    0x1.33b2a50d14dd6p+0,
+    0x1.33e9097e35155p+0,
+    0x1.341f6e22714c7p+0,
+    0x1.3455d2f9ade85p+0,
+    0x1.348c3803eae8fp+0,
+    0x1.34c29d41284e5p+0,
+    0x1.34f902b166186p+0,
+    0x1.352f6854a4473p+0,
+    0x1.3565ce2ac7405p+0,
+    0x1.359c3433cf03bp+0,
+    0x1.35d29a6f9ff6ep+0,
+    0x1.360900de3a19fp+0,
+    0x1.363f677f9d6cdp+0,
+    0x1.3675ce53c9ef8p+0,
+    0x1.36ac355abfa2p+0,
+    0x1.36e29c9462e9dp+0,
+    0x1.37190400b3c7p+0,
+    0x1.374f6b9fb2399p+0,
+    0x1.3785d37142a7p+0,
+    0x1.37bc3b75650f5p+0,
+    0x1.37f2a3ac19729p+0,
+    0x1.38290c1544364p+0,
+    0x1.385f74b100f4dp+0,
+    0x1.3895dd7f4fae4p+0,
+    0x1.38cc467ff92dbp+0,
+    0x1.3902afb2fd731p+0,
+    0x1.393919185c7e7p+0,
+    0x1.396f82b0164fcp+0,
+    0x1.39a5ec7a2ae71p+0,
+    0x1.39dc56767ea9ep+0,
+    0x1.3a12c0a511983p+0,
+    0x1.3a492b05e3b2p+0,
+    0x1.3a7f9598f4f75p+0,
+    0x1.3ab6005e45682p+0,
+    0x1.3aec6b55b96ap+0,
+    0x1.3b22d67f35627p+0,
+    0x1.3b5941dab9517p+0,
+    0x1.3b8fad6860d18p+0,
+    0x1.3bc619282be2ap+0,
+    0x1.3bfc8519e34fep+0,
+    0x1.3c32f13d87194p+0,
+    0x1.3c695d93173ebp+0,
+    0x1.3c9fca1a93c04p+0,
+    0x1.3cd636d3fc9dfp+0,
+    0x1.3d0ca3bf363d5p+0,
+    0x1.3d4310dc409e5p+0,
+    0x1.3d797e2b1bc1p+0,
+    0x1.3dafebabc7a55p+0,
+    0x1.3de6595e28b0dp+0,
+    0x1.3e1cc7423ee38p+0,
+    0x1.3e5335580a3d7p+0,
+    0x1.3e89a39f6f241p+0,
+    0x1.3ec012186d977p+0,
+    0x1.3ef680c305979p+0,
+    0x1.3f2cef9f37246p+0,
+    0x1.3f635eace6a38p+0,
+    0x1.3f99cdec1414ep+0,
+    0x1.3fd03d5cbf788p+0,
+    0x1.4006acfecd33fp+0,
+    0x1.403d1cd23d473p+0,
+    0x1.40738cd72b4cbp+0,
+    0x1.40a9fd0d7baap+0,
+    0x1.40e06d7512c4bp+0,
+    0x1.4116de0df09cbp+0,
+    0x1.414d4ed815321p+0,
+    0x1.4183bfd38084cp+0,
+    0x1.41ba310016fa5p+0,
+    0x1.41f0a25dd892cp+0,
+    0x1.422713ecc54e1p+0,
+    0x1.425d85acdd2c5p+0,
+    0x1.4293f79e0492fp+0,
+    0x1.42ca69c03b82p+0,
+    0x1.4300dc1381f98p+0,
+    0x1.43374e97bc5efp+0,
+    0x1.436dc14d064cdp+0,
+    0x1.43a434335fc31p+0,
+    0x1.43daa74a918cdp+0,
+    0x1.44111a929baa1p+0,
+    0x1.44478e0b99b54p+0,
+    0x1.447e01b57013fp+0,
+    0x1.44b47590032bbp+0,
+    0x1.44eae99b52fc7p+0,
+    0x1.45215dd75f864p+0,
+    0x1.4557d24428c91p+0,
+    0x1.458e46e1aec4fp+0,
+    0x1.45c4bbafd5df6p+0,
+    0x1.45fb30ae9e186p+0,
+    0x1.4631a5de076ffp+0,
+    0x1.46681b3df64bap+0,
+    0x1.469e90ce6aab7p+0,
+    0x1.46d5068f648f5p+0,
+    0x1.470b7c80e3f75p+0,
+    0x1.4741f2a2e8e37p+0,
+    0x1.477868f557b93p+0,
+    0x1.47aedf7830789p+0,
+    0x1.47e5562b7321ap+0,
+    0x1.481bcd0f0419ep+0,
+    0x1.48524422e3614p+0,
+    0x1.4888bb6710f7dp+0,
+    0x1.48bf32db71432p+0,
+    0x1.48f5aa8004432p+0,
+    0x1.492c2254c9f7ep+0,
+    0x1.49629a59c2615p+0,
+    0x1.4999128eed7f8p+0,
+    0x1.49cf8af42fb7fp+0,
+    0x1.4a060389890aap+0,
+    0x1.4a3c7c4ef9779p+0,
+    0x1.4a72f54480fecp+0,
+    0x1.4aa96e6a0405cp+0,
+    0x1.4adfe7bf66f21p+0,
+    0x1.4b166144c55e3p+0,
+    0x1.4b4cdafa1f4a2p+0,
+    0x1.4b8354df591b6p+0,
+    0x1.4bb9cef472d1fp+0,
+    0x1.4bf0493950d36p+0,
+    0x1.4c26c3adf31fbp+0,
+    0x1.4c5d3e5259b6ep+0,
+    0x1.4c93b9268498fp+0,
+    0x1.4cca342a73c5ep+0,
+    0x1.4d00af5e0ba33p+0,
+    0x1.4d372ac14c30fp+0,
+    0x1.4d6da654356f1p+0,
+    0x1.4da42216abc33p+0,
+    0x1.4dda9e08af2d4p+0,
+    0x1.4e111a2a3fad4p+0,
+    0x1.4e47967b5d433p+0,
+    0x1.4e7e12fc07ef1p+0,
+    0x1.4eb48fac24167p+0,
+    0x1.4eeb0c8b961edp+0,
+    0x1.4f21899a5e083p+0,
+    0x1.4f5806d8976d1p+0,
+    0x1.4f8e844626b2fp+0,
+    0x1.4fc501e30bd9ep+0,
+    0x1.4ffb7faf46e1dp+0,
+    0x1.5031fdaabc305p+0,
+    0x1.50687bd56bc56p+0,
+    0x1.509efa2f55a1p+0,
+    0x1.50d578b85e28bp+0,
+    0x1.510bf770855c8p+0,
+    0x1.51427657cb3c6p+0,
+    0x1.5178f56e2fc86p+0,
+    0x1.51af74b3b3007p+0,
+    0x1.51e5f428394a2p+0,
+    0x1.521c73cbc2a57p+0,
+    0x1.5252f39e3377fp+0,
+    0x1.5289739f8bc1ap+0,
+    0x1.52bff3cfcb828p+0,
+    0x1.52f6742ef2ba8p+0,
+    0x1.532cf4bd0169bp+0,
+    0x1.53637579dbf59p+0,
+    0x1.5399f665825e3p+0,
+    0x1.53d0777ff4a38p+0,
+    0x1.5406f8c932c58p+0,
+    0x1.543d7a412129cp+0,
+    0x1.5473fbe7bfd04p+0,
+    0x1.54aa7dbd0eb9p+0,
+    0x1.54e0ffc0f2499p+0,
+    0x1.551781f36a81ep+0,
+    0x1.554e04547762p+0,
+    0x1.558486e418e9ep+0,
+    0x1.55bb09a24f199p+0,
+    0x1.55f18c8efe569p+0,
+    0x1.56280faa26a0ep+0,
+    0x1.565e92f3c7f88p+0,
+    0x1.5695166bc6c3p+0,
+    0x1.56cb9a1223005p+0,
+    0x1.57021de6dcb08p+0,
+    0x1.5738a1e9f3d39p+0,
+    0x1.576f261b4ccfp+0,
+    0x1.57a5aa7ae7a2dp+0,
+    0x1.57dc2f08c44f1p+0,
+    0x1.5812b3c4c7394p+0,
+    0x1.584938aef0616p+0,
+    0x1.587fbdc73fc77p+0,
+    0x1.58b6430db56b6p+0,
+    0x1.58ecc882514d4p+0,
+    0x1.59234e24f7d2ap+0,
+    0x1.5959d3f5a8fb7p+0,
+    0x1.599059f464c7cp+0,
+    0x1.59c6e0210f9d1p+0,
+    0x1.59fd667ba97b6p+0,
+    0x1.5a33ed043262bp+0,
+    0x1.5a6a73baaa53p+0,
+    0x1.5aa0fa9f114c5p+0,
+    0x1.5ad781b14bb43p+0,
+    0x1.5b0e08f1598aap+0,
+    0x1.5b44905f3acfap+0,
+    0x1.5b7b17fad3e8bp+0,
+    0x1.5bb19fc424d5dp+0,
+    0x1.5be827bb2d971p+0,
+    0x1.5c1eafdfd291fp+0,
+    0x1.5c55383213c66p+0,
+    0x1.5c8bc0b20ccefp+0,
+    0x1.5cc2495fa2112p+0,
+    0x1.5cf8d23ab7f27p+0,
+    0x1.5d2f5b434e72fp+0,
+    0x1.5d65e47965929p+0,
+    0x1.5d9c6ddcfd516p+0,
+    0x1.5dd2f76e15af5p+0,
+    0x1.5e09812c9311fp+0,
+    0x1.5e400b1875795p+0,
+    0x1.5e769531bce56p+0,
+    0x1.5ead1f784dbbap+0,
+    0x1.5ee3a9ec27fc2p+0,
+    0x1.5f1a348d4ba6ep+0,
+    0x1.5f50bf5bb8bbep+0,
+    0x1.5f874a576f3b1p+0,
+    0x1.5fbdd580538a1p+0,
+    0x1.5ff460d665a8dp+0,
+    0x1.602aec59a5975p+0,
+    0x1.60617809f7bb2p+0,
+    0x1.609803e75c144p+0,
+    0x1.60ce8ff1d2a2bp+0,
+    0x1.61051c295b667p+0,
+    0x1.613ba88ddac5p+0,
+    0x1.6172351f50be7p+0,
+    0x1.61a8c1ddbd52cp+0,
+    0x1.61df4ec904e77p+0,
+    0x1.6215dbe14316fp+0,
+    0x1.624c69265c46dp+0,
+    0x1.6282f69834dcap+0,
+    0x1.62b98436e872dp+0,
+    0x1.62f0120277096p+0,
+    0x1.63269ffac505ep+0,
+    0x1.635d2e1fb6cddp+0,
+    0x1.6393bc7167fbbp+0,
+    0x1.63ca4aefd88f8p+0,
+    0x1.6400d99aeceecp+0,
+    0x1.64376872a5197p+0,
+    0x1.646df776e5752p+0,
+    0x1.64a486a7ae01dp+0,
+    0x1.64db1604febf8p+0,
+    0x1.6511a58ed7ae3p+0,
+    0x1.6548354538cdep+0,
+    0x1.657ec52806842p+0,
+    0x1.65b5553740d0ep+0,
+    0x1.65ebe572e7b43p+0,
+    0x1.662275dadf939p+0,
+    0x1.6659066f286fp+0,
+    0x1.668f972fc2468p+0,
+    0x1.66c6281c917fap+0,
+    0x1.66fcb935961a6p+0,
+    0x1.67334a7aebb13p+0,
+    0x1.6769dbec76a99p+0,
+    0x1.67a06d8a1b692p+0,
+    0x1.67d6ff53f58a4p+0,
+    0x1.680d9149e9729p+0,
+    0x1.6844236bf722p+0,
+    0x1.687ab5ba1e989p+0,
+    0x1.68b14834443bdp+0,
+    0x1.68e7dada680bcp+0,
+    0x1.691e6dac8a086p+0,
+    0x1.695500aaaa31bp+0,
+    0x1.698b93d4aced4p+0,
+    0x1.69c2272a923bp+0,
+    0x1.69f8baac5a1bp+0,
+    0x1.6a2f4e59e8f2cp+0,
+    0x1.6a65e2335a5cbp+0,
+    0x1.6a9c763892be7p+0,
+    0x1.6ad30a69767d7p+0,
+    0x1.6b099ec621343p+0,
+    0x1.6b40334e92e2cp+0,
+    0x1.6b76c802afee9p+0,
+    0x1.6bad5ce25cbd4p+0,
+    0x1.6be3f1edb4e93p+0,
+    0x1.6c1a8724b8727p+0,
+    0x1.6c511c874bbe8p+0,
+    0x1.6c87b2155332fp+0,
+    0x1.6cbe47cececfcp+0,
+    0x1.6cf4ddb3da2f7p+0,
+    0x1.6d2b73c459b78p+0,
+    0x1.6d620a0031cd7p+0,
+    0x1.6d98a0677e0bcp+0,
+    0x1.6dcf36fa3e727p+0,
+    0x1.6e05cdb85767p+0,
+    0x1.6e3c64a1ad4f1p+0,
+    0x1.6e72fbb6402a9p+0,
+    0x1.6ea992f62b93fp+0,
+    0x1.6ee02a6153f0cp+0,
+    0x1.6f16c1f79da69p+0,
+    0x1.6f4d59b9244fdp+0,
+    0x1.6f83f1a5e7ec8p+0,
+    0x1.6fba89bdcce23p+0,
+    0x1.6ff12200b7967p+0,
+    0x1.7027ba6ea8093p+0,
+    0x1.705e5307b9d4fp+0,
+    0x1.7094ebcbd15f3p+0,
+    0x1.70cb84bad30d8p+0,
+    0x1.71021dd4bedfep+0,
+    0x1.7138b71994d65p+0,
+    0x1.716f508954f0dp+0,
+    0x1.71a5ea23ff2f6p+0,
+    0x1.71dc83e99392p+0,
+    0x1.72131dd9f67e3p+0,
+    0x1.7249b7f527f4p+0,
+    0x1.7280523b27f36p+0,
+    0x1.72b6ecabdae1ep+0,
+    0x1.72ed874740bf8p+0,
+    0x1.7324220d598c5p+0,
+    0x1.735abcfe25484p+0,
+    0x1.739158198858dp+0,
+    0x1.73c7f35f82be1p+0,
+    0x1.73fe8ed01478p+0,
+    0x1.74352a6b3d86ap+0,
+    0x1.746bc630fde9ep+0,
+    0x1.74a262213a076p+0,
+    0x1.74d8fe3bf1df1p+0,
+    0x1.750f9a8109d68p+0,
+    0x1.754636f081edbp+0,
+    0x1.757cd38a5a24ap+0,
+    0x1.75b3704e927b5p+0,
+    0x1.75ea0d3d2af1cp+0,
+    0x1.7620aa5607ed7p+0,
+    0x1.76574799296e7p+0,
+    0x1.768de5068f74bp+0,
+    0x1.76c4829e3a004p+0,
+    0x1.76fb20600d76ap+0,
+    0x1.7731be4c09d7dp+0,
+    0x1.77685c622f23dp+0,
+    0x1.779efaa261c03p+0,
+    0x1.77d5990cbd476p+0,
+    0x1.780c37a141b96p+0,
+    0x1.7842d65fd37bcp+0,
+    0x1.7879754856f41p+0,
+    0x1.78b0145acc224p+0,
+    0x1.78e6b39733065p+0,
+    0x1.791d52fd8ba05p+0,
+    0x1.7953f28dd5f03p+0,
+    0x1.798a9247f65b8p+0,
+    0x1.79c1322bece24p+0,
+    0x1.79f7d239b9847p+0,
+    0x1.7a2e72715c421p+0,
+    0x1.7a6512d2b980ap+0,
+    0x1.7a9bb35dd1403p+0,
+    0x1.7ad25412a380bp+0,
+    0x1.7b08f4f114a7bp+0,
+    0x1.7b3f95f924b54p+0,
+    0x1.7b76372ad3a95p+0,
+    0x1.7bacd8862183ep+0,
+    0x1.7be37a0b0e44fp+0,
+    0x1.7c1a1bb999ec8p+0,
+    0x1.7c50bd91a8e02p+0,
+    0x1.7c875f931f855p+0,
+    0x1.7cbe01be19769p+0,
+    0x1.7cf4a41296b3ep+0,
+    0x1.7d2b46907ba2cp+0,
+    0x1.7d61e937c8433p+0,
+    0x1.7d988c0860facp+0,
+    0x1.7dcf2f0245c97p+0,
+    0x1.7e05d22576af4p+0,
+    0x1.7e3c7571f3ac3p+0,
+    0x1.7e7318e7bcc04p+0,
+    0x1.7ea9bc86b651p+0,
+    0x1.7ee0604ee05e6p+0,
+    0x1.7f1704403ae87p+0,
+    0x1.7f4da85ac5ef2p+0,
+    0x1.7f844c9e65d81p+0,
+    0x1.7fbaf10b1aa33p+0,
+    0x1.7ff195a0e4508p+0,
+    0x1.80283a5fa7459p+0,
+    0x1.805edf4763825p+0,
+    0x1.8095845834a14p+0,
+    0x1.80cc2991ff07fp+0,
+    0x1.8102cef4a71bfp+0,
+    0x1.813974804877ap+0,
+    0x1.81701a34c780ap+0,
+    0x1.81a6c0122436ep+0,
+    0x1.81dd66185e9a6p+0,
+    0x1.82140c475b10bp+0,
+    0x1.824ab29f1999dp+0,
+    0x1.8281591f9a35cp+0,
+    0x1.82b7ffc8c14a1p+0,
+    0x1.82eea69a8ed6bp+0,
+    0x1.83254d951e762p+0,
+    0x1.835bf4b8548dfp+0,
+    0x1.83929c041583ap+0,
+    0x1.83c9437861573p+0,
+    0x1.83ffeb153808ap+0,
+    0x1.843692da9997fp+0,
+    0x1.846d3ac886053p+0,
+    0x1.84a3e2defd505p+0,
+    0x1.84da8b1de3dedp+0,
+    0x1.851133851e165p+0,
+    0x1.8547dc14c7914p+0,
+    0x1.857e84cce04f9p+0,
+    0x1.85b52dad4cb6ep+0,
+    0x1.85ebd6b60cc72p+0,
+    0x1.86227fe720805p+0,
+    0x1.865929406c48p+0,
+    0x1.868fd2c1f01e3p+0,
+    0x1.86c67c6bac02ep+0,
+    0x1.86fd263d845bap+0,
+    0x1.8733d03779286p+0,
+    0x1.876a7a598a693p+0,
+    0x1.87a124a3b81ep+0,
+    0x1.87d7cf160246ep+0,
+    0x1.880e79b068e3dp+0,
+    0x1.88452472d05a5p+0,
+    0x1.887bcf5d38aa6p+0,
+    0x1.88b27a6fa1d4p+0,
+    0x1.88e925a9f03ccp+0,
+    0x1.891fd10c23e4ap+0,
+    0x1.89567c963ccb9p+0,
+    0x1.898d28483af1ap+0,
+    0x1.89c3d42202bc5p+0,
+    0x1.89fa8023942bbp+0,
+    0x1.8a312c4cef3fbp+0,
+    0x1.8a67d89e13f86p+0,
+    0x1.8a9e85170255bp+0,
+    0x1.8ad531b79ebd3p+0,
+    0x1.8b0bde7fe92eep+0,
+    0x1.8b428b6fe1aacp+0,
+    0x1.8b7938876c965p+0,
+    0x1.8bafe5c689f1ap+0,
+    0x1.8be6932d39bcap+0,
+    0x1.8c1d40bb7bf76p+0,
+    0x1.8c53ee7150a1ep+0,
+    0x1.8c8a9c4e9c21ap+0,
+    0x1.8cc14a535e76ap+0,
+    0x1.8cf7f87f7c067p+0,
+    0x1.8d2ea6d2f4d1p+0,
+    0x1.8d65554de470ep+0,
+    0x1.8d9c03f02f4b8p+0,
+    0x1.8dd2b2b9d560fp+0,
+    0x1.8e0961aad6b13p+0,
+    0x1.8e4010c317a1cp+0,
+    0x1.8e76c0029832bp+0,
+    0x1.8ead6f695863fp+0,
+    0x1.8ee41ef73c9b1p+0,
+    0x1.8f1aceac44d81p+0,
+    0x1.8f517e88711afp+0,
+    0x1.8f882e8bc163bp+0,
+    0x1.8fbedeb635b25p+0,
+    0x1.8ff58f07b26c5p+0,
+    0x1.902c3f803791cp+0,
+    0x1.9062f01fc5229p+0,
+    0x1.9099a0e65b1edp+0,
+    0x1.90d051d3ddecp+0,
+    0x1.910702e84d8a2p+0,
+    0x1.913db423a9f93p+0,
+    0x1.91746585d79ecp+0,
+    0x1.91ab170ed67adp+0,
+    0x1.91e1c8bea68d6p+0,
+    0x1.92187a9547d66p+0,
+    0x1.924f2c92ba55ep+0,
+    0x1.9285deb6fe0bep+0,
+    0x1.92bc9101f75dep+0,
+    0x1.92f343738ab17p+0,
+    0x1.9329f60bd3a11p+0,
+    0x1.9360a8cad22cbp+0,
+    0x1.93975bb06ab9ep+0,
+    0x1.93ce0ebc9d48ap+0,
+    0x1.9404c1ef69d8fp+0,
+    0x1.943b7548b4d06p+0,
+    0x1.947228c87e2eep+0,
+    0x1.94a8dc6ec5f48p+0,
+    0x1.94df903b7086cp+0,
+    0x1.9516442e99801p+0,
+    0x1.954cf84840e08p+0,
+    0x1.9583ac884b0d9p+0,
+    0x1.95ba60ee9c6cdp+0,
+    0x1.95f1157b34fe4p+0,
+    0x1.9627ca2e305c5p+0,
+    0x1.965e7f0772ec9p+0,
+    0x1.96953406e1148p+0,
+    0x1.96cbe92c966eap+0,
+    0x1.97029e7892faep+0,
+    0x1.973953eabb1eep+0,
+    0x1.97700982f3402p+0,
+    0x1.97a6bf413b5eap+0,
+    0x1.97dd7525af14dp+0,
+    0x1.98142b3032c84p+0,
+    0x1.984ae160aade8p+0,
+    0x1.988197b732f2p+0,
+    0x1.98b84e33cb02cp+0,
+    0x1.98ef04d657764p+0,
+    0x1.9925bb9ed84c9p+0,
+    0x1.995c728d31eb3p+0,
+    0x1.999329a164522p+0,
+    0x1.99c9e0db6f816p+0,
+    0x1.9a00983b5378fp+0,
+    0x1.9a374fc11038ep+0,
+    0x1.9a6e076c8a26ap+0,
+    0x1.9aa4bf3dc1424p+0,
+    0x1.9adb7734b58bcp+0,
+    0x1.9b122f5167032p+0,
+    0x1.9b48e793d5a85p+0,
+    0x1.9b7f9ffbe5e0fp+0,
+    0x1.9bb658897c128p+0,
+    0x1.9bed113cb3d77p+0,
+    0x1.9c23ca158d2fdp+0,
+    0x1.9c5a8313ec811p+0,
+    0x1.9c913c37d1cb4p+0,
+    0x1.9cc7f5813d0e6p+0,
+    0x1.9cfeaef012bp+0,
+    0x1.9d35688452b02p+0,
+    0x1.9d6c223dfd0ebp+0,
+    0x1.9da2dc1d11cbcp+0,
+    0x1.9dd9962190e74p+0,
+    0x1.9e10504b5ec6cp+0,
+    0x1.9e470a9a7b6a5p+0,
+    0x1.9e7dc50ee6d1ep+0,
+    0x1.9eb47fa88563p+0,
+    0x1.9eeb3a67571dap+0,
+    0x1.9f21f54b5c01dp+0,
+    0x1.9f58b054940f9p+0,
+    0x1.9f8f6b82ff46ep+0,
+    0x1.9fc626d6820d4p+0,
+    0x1.9ffce24f1c62bp+0,
+    0x1.a0339decce474p+0,
+    0x1.a06a59af97baep+0,
+    0x1.a0a115975d232p+0,
+    0x1.a0d7d1a41e8p+0,
+    0x1.a10e8dd5dbd18p+0,
+    0x1.a1454a2c9517ap+0,
+    0x1.a17c06a84a526p+0,
+    0x1.a1b2c348dfe75p+0,
+    0x1.a1e9800e55d66p+0,
+    0x1.a2203cf890852p+0,
+    0x1.a256fa078ff3ap+0,
+    0x1.a28db73b6fbc4p+0,
+    0x1.a2c4749414449p+0,
+    0x1.a2fb321161f22p+0,
+    0x1.a331efb3745f6p+0,
+    0x1.a368ad7a4b8c5p+0,
+    0x1.a39f6b65cbde8p+0,
+    0x1.a3d62975d9bb8p+0,
+    0x1.a40ce7aa75234p+0,
+    0x1.a443a603b9b04p+0,
+    0x1.a47a64818bc8p+0,
+    0x1.a4b12323eb6a8p+0,
+    0x1.a4e7e1ead897dp+0,
+    0x1.a51ea0d637b57p+0,
+    0x1.a5555fe608c36p+0,
+    0x1.a58c1f1a4bc1ap+0,
+    0x1.a5c2de7300b03p+0,
+    0x1.a5f99df00bf49p+0,
+    0x1.a6305d916d8edp+0,
+    0x1.a6671d57257eep+0,
+    0x1.a69ddd41182a6p+0,
+    0x1.a6d49d4f612bbp+0,
+    0x1.a70b5d81e4e86p+0,
+    0x1.a7421dd8a3608p+0,
+    0x1.a778de539c94p+0,
+    0x1.a7af9ef2b4e87p+0,
+    0x1.a7e65fb5ec5dcp+0,
+    0x1.a81d209d42f4p+0,
+    0x1.a853e1a8b8ab3p+0,
+    0x1.a88aa2d831e8dp+0,
+    0x1.a8c1642baeacfp+0,
+    0x1.a8f825a32ef78p+0,
+    0x1.a92ee73eb2c88p+0,
+    0x1.a965a8fe3a2p+0,
+    0x1.a99c6ae1c4fdfp+0,
+    0x1.a9d32ce937c7ep+0,
+    0x1.aa09ef1476e36p+0,
+    0x1.aa40b1639deaep+0,
+    0x1.aa7773d6acde6p+0,
+    0x1.aaae366d88236p+0,
+    0x1.aae4f9282fb9fp+0,
+    0x1.ab1bbc06a3a2p+0,
+    0x1.ab527f08c8413p+0,
+    0x1.ab89422e9d977p+0,
+    0x1.abc0057823a4cp+0,
+    0x1.abf6c8e53ecebp+0,
+    0x1.ac2d8c760aafbp+0,
+    0x1.ac64502a8747cp+0,
+    0x1.ac9b140298fc7p+0,
+    0x1.acd1d7fe24334p+0,
+    0x1.ad089c1d28ec4p+0,
+    0x1.ad3f605fc2c1dp+0,
+    0x1.ad7624c5d6199p+0,
+    0x1.adace94f62f37p+0,
+    0x1.ade3adfc694f8p+0,
+    0x1.ae1a72cccd934p+0,
+    0x1.ae5137c08fbebp+0,
+    0x1.ae87fcd7afd1dp+0,
+    0x1.aebec21212322p+0,
+    0x1.aef5876fb6dfbp+0,
+    0x1.af2c4cf0b974fp+0,
+    0x1.af631294fe576p+0,
+    0x1.af99d85c69ec9p+0,
+    0x1.afd09e4717cfp+0,
+    0x1.b0076454ec643p+0,
+    0x1.b03e2a85cc11bp+0,
+    0x1.b074f0d9d271fp+0,
+    0x1.b0abb750ff84fp+0,
+    0x1.b0e27deb534acp+0,
+    0x1.b11944a8b228dp+0,
+    0x1.b1500b890084cp+0,
+    0x1.b186d28c59f9p+0,
+    0x1.b1bd99b2be858p+0,
+    0x1.b1f460fc128fep+0,
+    0x1.b22b28683a7dap+0,
+    0x1.b261eff7364ecp+0,
+    0x1.b298b7a9219dbp+0,
+    0x1.b2cf7f7de0dp+0,
+    0x1.b306477573e5bp+0,
+    0x1.b33d0f8fdadecp+0,
+    0x1.b373d7ccfa20cp+0,
+    0x1.b3aaa02cd1abap+0,
+    0x1.b3e168af617f7p+0,
+    0x1.b4183154a99c2p+0,
+    0x1.b44efa1caa01cp+0,
+    0x1.b485c3074715dp+0,
+    0x1.b4bc8c1480d85p+0,
+    0x1.b4f3554457495p+0,
+    0x1.b52a1e96aece4p+0,
+    0x1.b560e80b87673p+0,
+    0x1.b597b1a2e1142p+0,
+    0x1.b5ce7b5cbbd51p+0,
+    0x1.b605453917a9fp+0,
+    0x1.b63c0f37d8f86p+0,
+    0x1.b672d958ffc05p+0,
+    0x1.b6a9a39c8c01dp+0,
+    0x1.b6e06e027dbcdp+0,
+    0x1.b717388ad4f15p+0,
+    0x1.b74e03357604ep+0,
+    0x1.b784ce0260f78p+0,
+    0x1.b7bb98f17a2ecp+0,
+    0x1.b7f26402c1aaap+0,
+    0x1.b8292f3653059p+0,
+    0x1.b85ffa8c12a51p+0,
+    0x1.b896c60400893p+0,
+    0x1.b8cd919e1cb1ep+0,
+    0x1.b9045d5a4b84cp+0,
+    0x1.b93b29388d01cp+0,
+    0x1.b971f538e128ep+0,
+    0x1.b9a8c15b2c5fbp+0,
+    0x1.b9df8d9f6ea63p+0,
+    0x1.ba165a05c396dp+0,
+    0x1.ba4d268e0f971p+0,
+    0x1.ba83f338370c9p+0,
+    0x1.babac00439f74p+0,
+    0x1.baf18cf218573p+0,
+    0x1.bb285a01d22c5p+0,
+    0x1.bb5f27336776ap+0,
+    0x1.bb95f486d8363p+0,
+    0x1.bbccc1fc08d08p+0,
+    0x1.bc038f92f9459p+0,
+    0x1.bc3a5d4ba9956p+0,
+    0x1.bc712b25fe257p+0,
+    0x1.bca7f92212904p+0,
+    0x1.bcdec73fe6d5dp+0,
+    0x1.bd15957f43c14p+0,
+    0x1.bd4c63e029528p+0,
+    0x1.bd833262b324p+0,
+    0x1.bdba0106c59b6p+0,
+    0x1.bdf0cfcc60b89p+0,
+    0x1.be279eb3847b9p+0,
+    0x1.be5e6dbc1549fp+0,
+    0x1.be953ce61323bp+0,
+    0x1.becc0c317e08cp+0,
+    0x1.bf02db9e55f93p+0,
+    0x1.bf39ab2c9af5p+0,
+    0x1.bf707adc3161bp+0,
+    0x1.bfa74aad193f5p+0,
+    0x1.bfde1a9f528ddp+0,
+    0x1.c014eab2dd4d4p+0,
+    0x1.c04bbae7b97d9p+0,
+    0x1.c0828b3dcb845p+0,
+    0x1.c0b95bb4f7c71p+0,
+    0x1.c0f02c4d3e45cp+0,
+    0x1.c126fd06ba9aep+0,
+    0x1.c15dcde1512cp+0,
+    0x1.c1949edd01f91p+0,
+    0x1.c1cb6ff9cd022p+0,
+    0x1.c202413796acbp+0,
+    0x1.c23912967a934p+0,
+    0x1.c26fe4165d1b5p+0,
+    0x1.c2a6b5b722aa7p+0,
+    0x1.c2dd8778e6db1p+0,
+    0x1.c314595ba9ad3p+0,
+    0x1.c34b2b5f4f866p+0,
+    0x1.c381fd83d866ap+0,
+    0x1.c3b8cfc9444dfp+0,
+    0x1.c3efa22f77a1dp+0,
+    0x1.c42674b672624p+0,
+    0x1.c45d475e348f5p+0,
+    0x1.c4941a26be28fp+0,
+    0x1.c4caed0ff394bp+0,
+    0x1.c501c019d4d29p+0,
+    0x1.c53893447d7d1p+0,
+    0x1.c56f668fd1f9bp+0,
+    0x1.c5a639fbb6adfp+0,
+    0x1.c5dd0d882b99ep+0,
+    0x1.c613e13530bd7p+0,
+    0x1.c64ab502c618bp+0,
+    0x1.c68188f0ebabap+0,
+    0x1.c6b85cff85dbcp+0,
+    0x1.c6ef312e94a91p+0,
+    0x1.c726057e18139p+0,
+    0x1.c75cd9ee101b4p+0,
+    0x1.c793ae7e7cc03p+0,
+    0x1.c7ca832f4267dp+0,
+    0x1.c801580061123p+0,
+    0x1.c8382cf1d8bf5p+0,
+    0x1.c86f0203a96f3p+0,
+    0x1.c8a5d735b7875p+0,
+    0x1.c8dcac880307cp+0,
+    0x1.c91381fa8bf07p+0,
+    0x1.c94a578d36a6fp+0,
+    0x1.c9812d40032b4p+0,
+    0x1.c9b80312f17d6p+0,
+    0x1.c9eed906019d5p+0,
+    0x1.ca25af19338b1p+0,
+    0x1.ca5c854c8746ap+0,
+    0x1.ca935b9ffcdp+0,
+    0x1.caca3213788ccp+0,
+    0x1.cb0108a6dee26p+0,
+    0x1.cb37df5a4b6b5p+0,
+    0x1.cb6eb62dbe27ap+0,
+    0x1.cba58d211b7cdp+0,
+    0x1.cbdc643447d07p+0,
+    0x1.cc133b6743228p+0,
+    0x1.cc4a12ba290d7p+0,
+    0x1.cc80ea2cddf6dp+0,
+    0x1.ccb7c1bf61deap+0,
+    0x1.ccee9971b4c4dp+0,
+    0x1.cd257143bb0fp+0,
+    0x1.cd5c49359057ap+0,
+    0x1.cd93214719043p+0,
+    0x1.cdc9f978397a4p+0,
+    0x1.ce00d1c90d544p+0,
+    0x1.ce37aa3994924p+0,
+    0x1.ce6e82c9b399cp+0,
+    0x1.cea55b796a6acp+0,
+    0x1.cedc3448b9054p+0,
+    0x1.cf130d3783cecp+0,
+    0x1.cf49e645cac75p+0,
+    0x1.cf80bf738deefp+0,
+    0x1.cfb798c0cd459p+0,
+    0x1.cfee722d88cb4p+0,
+    0x1.d0254bb9a4e58p+0,
+    0x1.d05c256521945p+0,
+    0x1.d092ff2ffed7cp+0,
+    0x1.d0c9d91a21154p+0,
+    0x1.d100b323884cep+0,
+    0x1.d1378d4c347eap+0,
+    0x1.d16e679425aa8p+0,
+    0x1.d1a541fb5bd08p+0,
+    0x1.d1dc1c81d6f09p+0,
+    0x1.d212f7277b705p+0,
+    0x1.d249d1ec494fbp+0,
+    0x1.d280acd0408ecp+0,
+    0x1.d2b787d34593p+0,
+    0x1.d2ee62f5585c7p+0,
+    0x1.d3253e3678eb1p+0,
+    0x1.d35c1996a73eep+0,
+    0x1.d392f515e357ep+0,
+    0x1.d3c9d0b42d361p+0,
+    0x1.d400ac71693efp+0,
+    0x1.d437884d97729p+0,
+    0x1.d46e6448b7d0fp+0,
+    0x1.d4a54062aebf9p+0,
+    0x1.d4dc1c9b7c3e7p+0,
+    0x1.d512f8f3204d9p+0,
+    0x1.d549d5699aecfp+0,
+    0x1.d580b1feec1cap+0,
+    0x1.d5b78eb2f8421p+0,
+    0x1.d5ee6b85bf5d5p+0,
+    0x1.d6254877416e6p+0,
+    0x1.d65c25877e754p+0,
+    0x1.d69302b67671fp+0,
+    0x1.d6c9e0040dc9fp+0,
+    0x1.d700bd70447d4p+0,
+    0x1.d7379afb1a8bfp+0,
+    0x1.d76e78a4745b8p+0,
+    0x1.d7a5566c51ebfp+0,
+    0x1.d7dc3452b33d4p+0,
+    0x1.d8131257984f7p+0,
+    0x1.d849f07b01228p+0,
+    0x1.d880cebcd21cp+0,
+    0x1.d8b7ad1d0b3bep+0,
+    0x1.d8ee8b9bac823p+0,
+    0x1.d9256a38b5eeep+0,
+    0x1.d95c48f42782p+0,
+    0x1.d99327cde5a11p+0,
+    0x1.d9ca06c5f04c1p+0,
+    0x1.da00e5dc47831p+0,
+    0x1.da37c510cfab8p+0,
+    0x1.da6ea46388c57p+0,
+    0x1.daa583d48e6b6p+0,
+    0x1.dadc6363c502cp+0,
+    0x1.db13431110f13p+0,
+    0x1.db4a22dc8dd12p+0,
+    0x1.db8102c620081p+0,
+    0x1.dbb7e2cdc796p+0,
+    0x1.dbeec2f3847bp+0,
+    0x1.dc25a3373b1c9p+0,
+    0x1.dc5c839907152p+0,
+    0x1.dc936418e864cp+0,
+    0x1.dcca44b6c370fp+0,
+    0x1.dd0125727c9f3p+0,
+    0x1.dd38064c13ef9p+0,
+    0x1.dd6ee74389621p+0,
+    0x1.dda5c858dcf6ap+0,
+    0x1.dddca98c0ead5p+0,
+    0x1.de138add02ebap+0,
+    0x1.de4a6c4bd54c1p+0,
+    0x1.de814dd885ce9p+0,
+    0x1.deb82f82dd3e4p+0,
+    0x1.deef114adb9b2p+0,
+    0x1.df25f3309c7fap+0,
+    0x1.df5cd53404515p+0,
+    0x1.df93b75513103p+0,
+    0x1.dfca9993c8bc4p+0,
+    0x1.e0017bf009bbp+0,
+    0x1.e0385e69d60c7p+0,
+    0x1.e06f41012db0ap+0,
+    0x1.e0a623b610a78p+0,
+    0x1.e0dd06887ef12p+0,
+    0x1.e113e978788d7p+0,
+    0x1.e14acc85e1e2p+0,
+    0x1.e181afb09f546p+0,
+    0x1.e1b892f8cc7fp+0,
+    0x1.e1ef765e6961ep+0,
+    0x1.e22659e15a628p+0,
+    0x1.e25d3d819f80fp+0,
+    0x1.e294213f38bd3p+0,
+    0x1.e2cb051a26173p+0,
+    0x1.e301e9124bf48p+0,
+    0x1.e338cd27aa553p+0,
+    0x1.e36fb15a41393p+0,
+    0x1.e3a695a9f5061p+0,
+    0x1.e3dd7a16e1564p+0,
+    0x1.e4145ea10629cp+0,
+    0x1.e44b434847e62p+0,
+    0x1.e482280c8af0ep+0,
+    0x1.e4b90cedcf4a1p+0,
+    0x1.e4eff1ec308c2p+0,
+    0x1.e526d707931c9p+0,
+    0x1.e55dbc3ff6fb6p+0,
+    0x1.e594a1955c28ap+0,
+    0x1.e5cb8707a709dp+0,
+    0x1.e6026c96d79efp+0,
+    0x1.e6395242ede8p+0,
+    0x1.e670380be9e5p+0,
+    0x1.e6a71df1cb95fp+0,
+    0x1.e6de03f477606p+0,
+    0x1.e714ea13ed444p+0,
+    0x1.e74bd0502d41ap+0,
+    0x1.e782b6a937587p+0,
+    0x1.e7b99d1f0b88cp+0,
+    0x1.e7f083b18e381p+0,
+    0x1.e8276a60bf667p+0,
+    0x1.e85e512c83795p+0,
+    0x1.e8953814da70cp+0,
+    0x1.e8cc1f19dfe73p+0,
+    0x1.e903063b78423p+0,
+    0x1.e939ed79a381cp+0,
+    0x1.e970d4d461a5ep+0,
+    0x1.e9a7bc4b97141p+0,
+    0x1.e9dea3df43cc6p+0,
+    0x1.ea158b8f67cecp+0,
+    0x1.ea4c735c031b4p+0,
+    0x1.ea835b4515b1dp+0,
+    0x1.eaba434a83f8p+0,
+    0x1.eaf12b6c4deddp+0,
+    0x1.eb2813aa73934p+0,
+    0x1.eb5efc04d94dep+0,
+    0x1.eb95e47b7f1dap+0,
+    0x1.ebcccd0e809dp+0,
+    0x1.ec03b5bdddccp+0,
+    0x1.ec3a9e895f75cp+0,
+    0x1.ec718771059a3p+0,
+    0x1.eca87074ebd3dp+0,
+    0x1.ecdf5994f6882p+0,
+    0x1.ed1642d125b72p+0,
+    0x1.ed4d2c297960dp+0,
+    0x1.ed84159dd5eacp+0,
+    0x1.edbaff2e3b54fp+0,
+    0x1.edf1e8daa99f6p+0,
+    0x1.ee28d2a320ca1p+0,
+    0x1.ee5fbc87853a8p+0,
+    0x1.ee96a687d6f0bp+0,
+    0x1.eecd90a431872p+0,
+    0x1.ef047adc79636p+0,
+    0x1.ef3b653092eafp+0,
+    0x1.ef724fa07e1ddp+0,
+    0x1.efa93a2c3afcp+0,
+    0x1.efe024d3c9858p+0,
+    0x1.f0170f9729ba5p+0,
+    0x1.f04dfa765b9a7p+0,
+    0x1.f084e5715f25ep+0,
+    0x1.f0bbd08818c22p+0,
+    0x1.f0f2bbba886f4p+0,
+    0x1.f129a708ae2d4p+0,
+    0x1.f16092726e61ap+0,
+    0x1.f1977df7c90c6p+0,
+    0x1.f1ce6998be2d8p+0,
+    0x1.f20555554dc51p+0,
+    0x1.f23c412d77d3p+0,
+    0x1.f2732d2120bcep+0,
+    0x1.f2aa19304882bp+0,
+    0x1.f2e1055aef246p+0,
+    0x1.f317f1a0f9079p+0,
+    0x1.f34ede0281c6bp+0,
+    0x1.f385ca7f8961bp+0,
+    0x1.f3bcb717f43e3p+0,
+    0x1.f3f3a3cba6c1bp+0,
+    0x1.f42a909aa0ec3p+0,
+    0x1.f4617d84fe582p+0,
+    0x1.f4986a8aa36b1p+0,
+    0x1.f4cf57ab9025p+0,
+    0x1.f50644e7c486p+0,
+    0x1.f53d323f24f38p+0,
+    0x1.f5741fb1b16d9p+0,
+    0x1.f5ab0d3f69f42p+0,
+    0x1.f5e1fae84e874p+0,
+    0x1.f618e8ac5f26fp+0,
+    0x1.f64fd68b8038bp+0,
+    0x1.f686c485b1bc8p+0,
+    0x1.f6bdb29af3b26p+0,
+    0x1.f6f4a0cb461a6p+0,
+    0x1.f72b8f16a8f47p+0,
+    0x1.f7627d7d00a62p+0,
+    0x1.f7996bfe4d2f7p+0,
+    0x1.f7d05a9a8e905p+0,
+    0x1.f8074951c4c8dp+0,
+    0x1.f83e3823d43e8p+0,
+    0x1.f8752710bcf15p+0,
+    0x1.f8ac16187ee14p+0,
+    0x1.f8e3053b1a0e6p+0,
+    0x1.f919f4788e78ap+0,
+    0x1.f950e3d0c0859p+0,
+    0x1.f987d343b0353p+0,
+    0x1.f9bec2d15d878p+0,
+    0x1.f9f5b279ace21p+0,
+    0x1.fa2ca23c9e44ep+0,
+    0x1.fa63921a4d4a6p+0,
+    0x1.fa9a82129e581p+0,
+    0x1.fad17225916ep+0,
+    0x1.fb086253268c3p+0,
+    0x1.fb3f529b42182p+0,
+    0x1.fb7642fde411dp+0,
+    0x1.fbad337b0c794p+0,
+    0x1.fbe42412bb4e8p+0,
+    0x1.fc1b14c4d4f7p+0,
+    0x1.fc5205915972dp+0,
+    0x1.fc88f67848c1fp+0,
+    0x1.fcbfe779a2e46p+0,
+    0x1.fcf6d89567da2p+0,
+    0x1.fd2dc9cb7c08bp+0,
+    0x1.fd64bb1bdf702p+0,
+    0x1.fd9bac8692106p+0,
+    0x1.fdd29e0b93e98p+0,
+    0x1.fe098faac961p+0,
+    0x1.fe4081643276ep+0,
+    0x1.fe777337cf2b2p+0,
+    0x1.feae65259f7dcp+0,
+    0x1.fee5572da36ecp+0,
+    0x1.ff1c494fbf63ap+0,
+    0x1.ff533b8bf35c7p+0,
+    0x1.ff8a2de23f593p+0,
+    0x1.ffc12052a359dp+0,
+    0x1.fff812dd1f5e6p+0,
+    0x1.001782c0cbe63p+1,
+    0x1.0032fc200651fp+1,
+    0x1.004e758c3ef26p+1,
+    0x1.0069ef0575c79p+1,
+    0x1.0085688baad18p+1,
+    0x1.00a0e21ed042fp+1,
+    0x1.00bc5bbee61bdp+1,
+    0x1.00d7d56bec5c3p+1,
+    0x1.00f34f25d536ep+1,
+    0x1.010ec8eca0abdp+1,
+    0x1.012a42c05c884p+1,
+    0x1.0145bca0fafefp+1,
+    0x1.0161368e6e42ap+1,
+    0x1.017cb088b6536p+1,
+    0x1.01982a8fe0fe6p+1,
+    0x1.01b3a4a3ee43ap+1,
+    0x1.01cf1ec4c288bp+1,
+    0x1.01ea98f25dcd9p+1,
+    0x1.0206132ccddf8p+1,
+    0x1.02218d7404f13p+1,
+    0x1.023d07c80302bp+1,
+    0x1.02588228c814p+1,
+    0x1.0273fc964657ep+1,
+    0x1.028f77108b9b9p+1,
+    0x1.02aaf19797df1p+1,
+    0x1.02c66c2b4f87ep+1,
+    0x1.02e1e6cbb2961p+1,
+    0x1.02fd6178ced6dp+1,
+    0x1.0318dc32a44a2p+1,
+    0x1.033456f92522cp+1,
+    0x1.034fd1cc43938p+1,
+    0x1.036b4cac0d699p+1,
+    0x1.0386c79882a5p+1,
+    0x1.03a2429195789p+1,
+    0x1.03bdbd9745e43p+1,
+    0x1.03d938a993e7fp+1,
+    0x1.03f4b3c871b69p+1,
+    0x1.04102ef3df501p+1,
+    0x1.042baa2bdcb47p+1,
+    0x1.0447257069e3bp+1,
+    0x1.0462a0c186dddp+1,
+    0x1.047e1c1f25d5ap+1,
+    0x1.0499978946cb1p+1,
+    0x1.04b512ffe9be2p+1,
+    0x1.04d08e830eaedp+1,
+    0x1.04ec0a12b59d3p+1,
+    0x1.050785aede893p+1,
+    0x1.052301577ba5ap+1,
+    0x1.053e7d0c8cf27p+1,
+    0x1.0559f8ce126fbp+1,
+    0x1.0575749bfe502p+1,
+    0x1.0590f0765093cp+1,
+    0x1.05ac6c5d093a9p+1,
+    0x1.05c7e85028449p+1,
+    0x1.05e3644fadb1cp+1,
+    0x1.05fee05b99822p+1,
+    0x1.061a5c73dde87p+1,
+    0x1.0635d8987ae4bp+1,
+    0x1.065154c97076ep+1,
+    0x1.066cd106b0d1dp+1,
+    0x1.06884d503bf57p+1,
+    0x1.06a3c9a611e1dp+1,
+    0x1.06bf46083296ep+1,
+    0x1.06dac2769e14bp+1,
+    0x1.06f63ef1545b3p+1,
+    0x1.0711bb78479d3p+1,
+    0x1.072d380b77dabp+1,
+    0x1.0748b4aae513bp+1,
+    0x1.076431568f483p+1,
+    0x1.077fae0e76783p+1,
+    0x1.079b2ad28cd67p+1,
+    0x1.07b6a7a2d262fp+1,
+    0x1.07d2247f471dbp+1,
+    0x1.07eda167dd397p+1,
+    0x1.08091e5c94b64p+1,
+    0x1.08249b5d7b615p+1,
+    0x1.0840186a836d6p+1,
+    0x1.085b95839f0d4p+1,
+    0x1.087712a8dc0e2p+1,
+    0x1.08928fda3a701p+1,
+    0x1.08ae0d17ac65dp+1,
+    0x1.08c98a6131ef5p+1,
+    0x1.08e507b6bd3f6p+1,
+    0x1.090085184e56p+1,
+    0x1.091c0285f3007p+1,
+    0x1.09377fff9d717p+1,
+    0x1.0952fd854da9p+1,
+    0x1.096e7b1703a72p+1,
+    0x1.0989f8b4b19eap+1,
+    0x1.09a5765e578f7p+1,
+    0x1.09c0f413f5799p+1,
+    0x1.09dc71d58b5dp+1,
+    0x1.09f7efa31939dp+1,
+    0x1.0a136d7c9142bp+1,
+    0x1.0a2eeb61f377bp+1,
+    0x1.0a4a69533fd8dp+1,
+    0x1.0a65e7506898dp+1,
+    0x1.0a8165597b84ep+1,
+    0x1.0a9ce36e789d1p+1,
+    0x1.0ab8618f52142p+1,
+    0x1.0ad3dfbc07ea1p+1,
+    0x1.0aef5df48c51ap+1,
+    0x1.0b0adc38df4adp+1,
+    0x1.0b265a890ea2ep+1,
+    0x1.0b41d8e50c8c9p+1,
+    0x1.0b5d574ccb3abp+1,
+    0x1.0b78d5c0587a7p+1,
+    0x1.0b94543fb44bdp+1,
+    0x1.0bafd2cad0e1ap+1,
+    0x1.0bcb5161ae3bdp+1,
+    0x1.0be6d0044c5a7p+1,
+    0x1.0c024eb29d704p+1,
+    0x1.0c1dcd6ca17d4p+1,
+    0x1.0c394c3258816p+1,
+    0x1.0c54cb03c27cbp+1,
+    0x1.0c7049e0df6f3p+1,
+    0x1.0c8bc8c9a18bap+1,
+    0x1.0ca747be08d2p+1,
+    0x1.0cc2c6be15425p+1,
+    0x1.0cde45c9c6dcap+1,
+    0x1.0cf9c4e11da0ep+1,
+    0x1.0d154404198f1p+1,
+    0x1.0d30c332acd9fp+1,
+    0x1.0d4c426cd7819p+1,
+    0x1.0d67c1b29985ep+1,
+    0x1.0d834103e519bp+1,
+    0x1.0d9ec060ba3dp+1,
+    0x1.0dba3fc918efcp+1,
+    0x1.0dd5bf3d0132p+1,
+    0x1.0df13ebc7303cp+1,
+    0x1.0e0cbe476e64fp+1,
+    0x1.0e283dddf355ap+1,
+    0x1.0e43bd7ff4089p+1,
+    0x1.0e5f3d2d62b09p+1,
+    0x1.0e7abce64d1adp+1,
+    0x1.0e963caab3475p+1,
+    0x1.0eb1bc7a8768dp+1,
+    0x1.0ecd3c55c97f5p+1,
+    0x1.0ee8bc3c798aep+1,
+    0x1.0f043c2e978b7p+1,
+    0x1.0f1fbc2c15b3dp+1,
+    0x1.0f3b3c34f403fp+1,
+    0x1.0f56bc49327bep+1,
+    0x1.0f723c68d11b9p+1,
+    0x1.0f8dbc93cfe31p+1,
+    0x1.0fa93cca21052p+1,
+    0x1.0fc4bd0bc481cp+1,
+    0x1.0fe03d58ba58fp+1,
+    0x1.0ffbbdb1028abp+1,
+    0x1.10173e149d17p+1,
+    0x1.1032be837c30ap+1,
+    0x1.104e3efd9fd79p+1,
+    0x1.1069bf83080bdp+1,
+    0x1.10854013a7003p+1,
+    0x1.10a0c0af8a81ep+1,
+    0x1.10bc4156b290ep+1,
+    0x1.10d7c209116p+1,
+    0x1.10f342c6a6ef4p+1,
+    0x1.110ec38f65715p+1,
+    0x1.112a44634ce64p+1,
+    0x1.1145c5426b1b5p+1,
+    0x1.1161462cb2434p+1,
+    0x1.117cc7221490dp+1,
+    0x1.119848229fd14p+1,
+    0x1.11b3c92e54048p+1,
+    0x1.11cf4a45235d6p+1,
+    0x1.11eacb670ddbfp+1,
+    0x1.12064c9413802p+1,
+    0x1.1221cdcc267cbp+1,
+    0x1.123d4f0f46d1bp+1,
+    0x1.1258d05d824c5p+1,
+    0x1.127451b6cb1f5p+1,
+    0x1.128fd31b137d8p+1,
+    0x1.12ab548a69341p+1,
+    0x1.12c6d604cc431p+1,
+    0x1.12e2578a2edd3p+1,
+    0x1.12fdd91a91028p+1,
+    0x1.13195ab5e4e5cp+1,
+    0x1.1334dc5c2a86fp+1,
+    0x1.13505e0d6fb35p+1,
+    0x1.136bdfc9a69dap+1,
+    0x1.13876190cf45ep+1,
+    0x1.13a2e362e9ac1p+1,
+    0x1.13be653fe802fp+1,
+    0x1.13d9e727ca4a9p+1,
+    0x1.13f5691a9082ep+1,
+    0x1.1410eb183aabep+1,
+    0x1.142c6d20c8c5ap+1,
+    0x1.1447ef343ad01p+1,
+    0x1.1463715282fep+1,
+    0x1.147ef37ba14f6p+1,
+    0x1.149a75af95c44p+1,
+    0x1.14b5f7ee528f6p+1,
+    0x1.14d17a37d7b0cp+1,
+    0x1.14ecfc8c25286p+1,
+    0x1.15087eeb3af64p+1,
+    0x1.15240155191a6p+1,
+    0x1.153f83c9bf94cp+1,
+    0x1.155b06492e656p+1,
+    0x1.157688d357bfp+1,
+    0x1.15920b682dd46p+1,
+    0x1.15ad8e07be72dp+1,
+    0x1.15c910b2099a4p+1,
+    0x1.15e49367017d7p+1,
+    0x1.16001626a61c7p+1,
+    0x1.161b98f0f7773p+1,
+    0x1.16371bc5f58dcp+1,
+    0x1.16529ea5a0601p+1,
+    0x1.166e218fea20fp+1,
+    0x1.1689a484d2d06p+1,
+    0x1.16a527845a6e6p+1,
+    0x1.16c0aa8e732dbp+1,
+    0x1.16dc2da32adb9p+1,
+    0x1.16f7b0c28178p+1,
+    0x1.171333ec6935cp+1,
+    0x1.172eb720e214dp+1,
+    0x1.174a3a5fde47fp+1,
+    0x1.1765bda95dcf3p+1,
+    0x1.178140fd6e77cp+1,
+    0x1.179cc45c02746p+1,
+    0x1.17b847c50bf7ep+1,
+    0x1.17d3cb3898cf8p+1,
+    0x1.17ef4eb6a8fb3p+1,
+    0x1.180ad23f2eadcp+1,
+    0x1.182655d229e73p+1,
+    0x1.1841d96f9aa77p+1,
+    0x1.185d5d1773215p+1,
+    0x1.1878e0c9b354dp+1,
+    0x1.18946486690f3p+1,
+    0x1.18afe84d86833p+1,
+    0x1.18cb6c1f0bb0dp+1,
+    0x1.18e6effaf8981p+1,
+    0x1.190273e13f6bcp+1,
+    0x1.191df7d1e02bdp+1,
+    0x1.19397bccdad84p+1,
+    0x1.1954ffd22f712p+1,
+    0x1.197083e1d0292p+1,
+    0x1.198c07fbbd005p+1,
+    0x1.19a78c2003c3ep+1,
+    0x1.19c3104e96a6ap+1,
+    0x1.19de948767db5p+1,
+    0x1.19fa18ca852f2p+1,
+    0x1.1a159d17eea22p+1,
+    0x1.1a31216f96671p+1,
+    0x1.1a4ca5d17c7dfp+1,
+    0x1.1a682a3d93198p+1,
+    0x1.1a83aeb3da39cp+1,
+    0x1.1a9f33345fabfp+1,
+    0x1.1abab7bf15a2ep+1,
+    0x1.1ad63c53fc1e8p+1,
+    0x1.1af1c0f3131edp+1,
+    0x1.1b0d459c4cd6ap+1,
+    0x1.1b28ca4fa945ep+1,
+    0x1.1b444f0d286cap+1,
+    0x1.1b5fd3d4ca4adp+1,
+    0x1.1b7b58a68ee08p+1,
+    0x1.1b96dd82762dap+1,
+    0x1.1bb262687265p+1,
+    0x1.1bcde7588386ap+1,
+    0x1.1be96c52a9928p+1,
+    0x1.1c04f156d6bb6p+1,
+    0x1.1c20766518ce8p+1,
+    0x1.1c3bfb7d6fcbep+1,
+    0x1.1c57809fcde64p+1,
+    0x1.1c7305cc331dap+1,
+    0x1.1c8e8b0291a4cp+1,
+    0x1.1caa1042e97bbp+1,
+    0x1.1cc5958d486fap+1,
+    0x1.1ce11ae1a0b35p+1,
+    0x1.1cfca03fe4799p+1,
+    0x1.1d1825a8218fap+1,
+    0x1.1d33ab1a57f57p+1,
+    0x1.1d4f309679dddp+1,
+    0x1.1d6ab61c8748bp+1,
+    0x1.1d863bac80362p+1,
+    0x1.1da1c14664a62p+1,
+    0x1.1dbd46ea26cb7p+1,
+    0x1.1dd8cc97c6a61p+1,
+    0x1.1df4524f4436p+1,
+    0x1.1e0fd8109f7b4p+1,
+    0x1.1e2b5ddbd875dp+1,
+    0x1.1e46e3b0e1587p+1,
+    0x1.1e62698fba233p+1,
+    0x1.1e7def7862d6p+1,
+    0x1.1e99756adb70ep+1,
+    0x1.1eb4fb6723f3ep+1,
+    0x1.1ed0816d3c5efp+1,
+    0x1.1eec077d16e4ep+1,
+    0x1.1f078d96b385ap+1,
+    0x1.1f2313ba12414p+1,
+    0x1.1f3e99e7254a8p+1,
+    0x1.1f5a201deca16p+1,
+    0x1.1f75a65e6845ep+1,
+    0x1.1f912ca89838p+1,
+    0x1.1facb2fc7c77cp+1,
+    0x1.1fc8395a15052p+1,
+    0x1.1fe3bfc161e02p+1,
+    0x1.1fff4632553b8p+1,
+    0x1.201accacef174p+1,
+    0x1.203653312f736p+1,
+    0x1.2051d9bf0882bp+1,
+    0x1.206d60567a452p+1,
+    0x1.2088e6f784bacp+1,
+    0x1.20a46da227e39p+1,
+    0x1.20bff45663bf8p+1,
+    0x1.20db7b14384eap+1,
+    0x1.20f701dba590ep+1,
+    0x1.211288ac9db91p+1,
+    0x1.212e0f8720c73p+1,
+    0x1.2149966b2ebb4p+1,
+    0x1.21651d58b9c8p+1,
+    0x1.2180a44fcfbabp+1,
+    0x1.219c2b5070935p+1,
+    0x1.21b7b25a8e84ap+1,
+    0x1.21d3396e1bc16p+1,
+    0x1.21eec08b1849ap+1,
+    0x1.220a47b191ea9p+1,
+    0x1.2225cee17ad6fp+1,
+    0x1.2241561ad30edp+1,
+    0x1.225cdd5d9a922p+1,
+    0x1.227864a9c393bp+1,
+    0x1.2293ebff5be0bp+1,
+    0x1.22af735e63793p+1,
+    0x1.22cafac6cc8fep+1,
+    0x1.22e682389724dp+1,
+    0x1.230209b3b56acp+1,
+    0x1.231d91382761bp+1,
+    0x1.233918c5fad6ep+1,
+    0x1.2354a05d21fd1p+1,
+    0x1.237027fd8f07p+1,
+    0x1.238bafa74fc1fp+1,
+    0x1.23a7375a642dep+1,
+    0x1.23c2bf16be7dap+1,
+    0x1.23de46dc5eb12p+1,
+    0x1.23f9ceab44c86p+1,
+    0x1.2415568362f63p+1,
+    0x1.2430de64b93a9p+1,
+    0x1.244c664f5562bp+1,
+    0x1.2467ee4329a16p+1,
+    0x1.2483764035f69p+1,
+    0x1.249efe467a625p+1,
+    0x1.24ba8655e9176p+1,
+    0x1.24d60e6e8215cp+1,
+    0x1.24f19690455d7p+1,
+    0x1.250d1ebb32ee7p+1,
+    0x1.2528a6ef4ac8cp+1,
+    0x1.25442f2c7f1f2p+1,
+    0x1.255fb772cff19p+1,
+    0x1.257b3fc24b0d5p+1,
+    0x1.2596c81ae2a52p+1,
+    0x1.25b2507c88ebdp+1,
+    0x1.25cdd8e73de15p+1,
+    0x1.25e9615b0185bp+1,
+    0x1.2604e9d7d3d8fp+1,
+    0x1.2620725db4dbp+1,
+    0x1.263bfaeca48bfp+1,
+    0x1.26578384a2ebbp+1,
+    0x1.26730c25a22d1p+1,
+    0x1.268e94cfa2501p+1,
+    0x1.26aa1d82a354bp+1,
+    0x1.26c5a63ea53afp+1,
+    0x1.26e12f03a802cp+1,
+    0x1.26fcb7d19ddfp+1,
+    0x1.271840a886cfap+1,
+    0x1.2733c98862d4ap+1,
+    0x1.274f527131eep+1,
+    0x1.276adb62e64e8p+1,
+    0x1.2786645d7ff63p+1,
+    0x1.27a1ed610cb24p+1,
+    0x1.27bd766d7eb58p+1,
+    0x1.27d8ff82c832ap+1,
+    0x1.27f488a0f6f6fp+1,
+    0x1.281011c80b026p+1,
+    0x1.282b9af7f687cp+1,
+    0x1.28472430b9871p+1,
+    0x1.2862ad7246331p+1,
+    0x1.287e36bc9c8bcp+1,
+    0x1.2899c00fca5e5p+1,
+    0x1.28b5496bc1ddap+1,
+    0x1.28d0d2d08309ap+1,
+    0x1.28ec5c3e0de25p+1,
+    0x1.2907e5b4549a7p+1,
+    0x1.29236f3364ff4p+1,
+    0x1.293ef8bb3f10cp+1,
+    0x1.295a824bd501bp+1,
+    0x1.29760be51904ep+1,
+    0x1.299195870b1a5p+1,
+    0x1.29ad1f31b90f3p+1,
+    0x1.29c8a8e515165p+1,
+    0x1.29e432a11f2fap+1,
+    0x1.29ffbc65d75b3p+1,
+    0x1.2a1b46333d99p+1,
+    0x1.2a36d00951e9p+1,
+    0x1.2a5259e8067ep+1,
+    0x1.2a6de3cf5b58p+1,
+    0x1.2a896dbf5077p+1,
+    0x1.2aa4f7b7d80dcp+1,
+    0x1.2ac081b8f21c5p+1,
+    0x1.2adc0bc2ac6fep+1,
+    0x1.2af795d4f93b3p+1,
+    0x1.2b131fefd87e4p+1,
+    0x1.2b2eaa134a391p+1,
+    0x1.2b4a343f409e7p+1,
+    0x1.2b65be73bbae5p+1,
+    0x1.2b8148b0bb68cp+1,
+    0x1.2b9cd2f63fcdbp+1,
+    0x1.2bb85d4448dd3p+1,
+    0x1.2bd3e79ad6974p+1,
+    0x1.2bef71f9db2e9p+1,
+    0x1.2c0afc6156a33p+1,
+    0x1.2c2686d148f52p+1,
+    0x1.2c421149b2246p+1,
+    0x1.2c5d9bca9230fp+1,
+    0x1.2c792653db4d9p+1,
+    0x1.2c94b0e58d7a4p+1,
+    0x1.2cb03b7fa8b7p+1,
+    0x1.2ccbc6222d03dp+1,
+    0x1.2ce750cd1a60cp+1,
+    0x1.2d02db8063008p+1,
+    0x1.2d1e663c06e31p+1,
+    0x1.2d39f10006088p+1,
+    0x1.2d557bcc6070cp+1,
+    0x1.2d7106a1161bep+1,
+    0x1.2d8c917e193cap+1,
+    0x1.2da81c6369d2fp+1,
+    0x1.2dc3a75107deep+1,
+    0x1.2ddf3246f3607p+1,
+    0x1.2dfabd452c57ap+1,
+    0x1.2e16484bb2c46p+1,
+    0x1.2e31d35a78d98p+1,
+    0x1.2e4d5e717e97p+1,
+    0x1.2e68e990c3fcep+1,
+    0x1.2e8474b83b3dfp+1,
+    0x1.2e9fffe7f2276p+1,
+    0x1.2ebb8b1fe8b93p+1,
+    0x1.2ed7166011262p+1,
+    0x1.2ef2a1a86b6e4p+1,
+    0x1.2f0e2cf8f7918p+1,
+    0x1.2f29b851a7c2bp+1,
+    0x1.2f4543b27c01cp+1,
+    0x1.2f60cf1b821cp+1,
+    0x1.2f7c5a8cac442p+1,
+    0x1.2f97e605ecacfp+1,
+    0x1.2fb371875123bp+1,
+    0x1.2fcefd10d9a86p+1,
+    0x1.2fea88a2786dbp+1,
+    0x1.3006143c2d73bp+1,
+    0x1.30219fddf8ba6p+1,
+    0x1.303d2b87da41cp+1,
+    0x1.3058b739c43cap+1,
+    0x1.307442f3b6aafp+1,
+    0x1.308fceb5b18cbp+1,
+    0x1.30ab5a7fb4e1ep+1,
+    0x1.30c6e651c0aa9p+1,
+    0x1.30e2722bc7197p+1,
+    0x1.30fdfe0dc82e9p+1,
+    0x1.311989f7c3e9ep+1,
+    0x1.313515e9ba4b7p+1,
+    0x1.3150a1e3ab533p+1,
+    0x1.316c2de597013p+1,
+    0x1.3187b9ef7d556p+1,
+    0x1.31a3460150829p+1,
+    0x1.31bed21b1088cp+1,
+    0x1.31da5e3cbd67fp+1,
+    0x1.31f5ea664952ep+1,
+    0x1.32117697b4499p+1,
+    0x1.322d02d0fe4cp+1,
+    0x1.32488f12275a4p+1,
+    0x1.32641b5b2f744p+1,
+    0x1.327fa7ac169ap+1,
+    0x1.329b3404dccb8p+1,
+    0x1.32b6c065743b8p+1,
+    0x1.32d24ccddcea1p+1,
+    0x1.32edd93e16d72p+1,
+    0x1.330965b62202cp+1,
+    0x1.3324f235fe6cep+1,
+    0x1.33407ebd9e485p+1,
+    0x1.335c0b4d01951p+1,
+    0x1.337797e428532p+1,
+    0x1.3393248312827p+1,
+    0x1.33aeb129c0231p+1,
+    0x1.33ca3dd82367cp+1,
+    0x1.33e5ca8e3c508p+1,
+    0x1.3401574c0add5p+1,
+    0x1.341ce4118f0e3p+1,
+    0x1.343870dec8e32p+1,
+    0x1.3453fdb3aa8efp+1,
+    0x1.346f8a9034119p+1,
+    0x1.348b1774656bp+1,
+    0x1.34a6a4603e9b5p+1,
+    0x1.34c23153bfa27p+1,
+    0x1.34ddbe4ee8806p+1,
+    0x1.34f94b51ab67fp+1,
+    0x1.3514d85c08592p+1,
+    0x1.3530656dff53ep+1,
+    0x1.354bf28790584p+1,
+    0x1.35677fa8bb664p+1,
+    0x1.35830cd172b0ap+1,
+    0x1.359e9a01b6376p+1,
+    0x1.35ba273985fa8p+1,
+    0x1.35d5b478e1fap+1,
+    0x1.35f141bfca35dp+1,
+    0x1.360ccf0e30e0dp+1,
+    0x1.36285c6415fafp+1,
+    0x1.3643e9c179843p+1,
+    0x1.365f77265b7cap+1,
+    0x1.367b0492bbe43p+1,
+    0x1.369692068cedap+1,
+    0x1.36b21f81dc664p+1,
+    0x1.36cdad04aa4ep+1,
+    0x1.36e93a8ee8d7ap+1,
+    0x1.3704c8208a35fp+1,
+    0x1.372055b98e68fp+1,
+    0x1.373be35a033dep+1,
+    0x1.37577101dae77p+1,
+    0x1.3772feb11565bp+1,
+    0x1.378e8c67b2b8ap+1,
+    0x1.37aa1a25b2e04p+1,
+    0x1.37c5a7eb15dc9p+1,
+    0x1.37e135b7cde05p+1,
+    0x1.37fcc38bdaeb8p+1,
+    0x1.381851673cfe2p+1,
+    0x1.3833df49f4184p+1,
+    0x1.384f6d33f26c9p+1,
+    0x1.386afb2537fb1p+1,
+    0x1.3886891dd2911p+1,
+    0x1.38a2171db4614p+1,
+    0x1.38bda524cf9e7p+1,
+    0x1.38d933333215dp+1,
+    0x1.38f4c148dbc77p+1,
+    0x1.39104f65bee6p+1,
+    0x1.392bdd89db719p+1,
+    0x1.39476bb5316a2p+1,
+    0x1.3962f9e7c0cfbp+1,
+    0x1.397e88217bd5p+1,
+    0x1.399a1662627a1p+1,
+    0x1.39b5a4aa828c2p+1,
+    0x1.39d132f9ce3dfp+1,
+    0x1.39ecc15037c24p+1,
+    0x1.3a084fadbf191p+1,
+    0x1.3a23de12720fap+1,
+    0x1.3a3f6c7e50a5fp+1,
+    0x1.3a5afaf14d0edp+1,
+    0x1.3a76896b674a3p+1,
+    0x1.3a9217ec918aep+1,
+    0x1.3aada674cbd0ep+1,
+    0x1.3ac9350423e96p+1,
+    0x1.3ae4c39a8c073p+1,
+    0x1.3b005238042a4p+1,
+    0x1.3b1be0dc8c52ap+1,
+    0x1.3b376f8816b31p+1,
+    0x1.3b52fe3aa34b9p+1,
+    0x1.3b6e8cf4321c2p+1,
+    0x1.3b8a1bb4d0f1fp+1,
+    0x1.3ba5aa7c71ffdp+1,
+    0x1.3bc1394b07789p+1,
+    0x1.3bdcc8209f296p+1,
+    0x1.3bf856fd2b45p+1,
+    0x1.3c13e5e0abcb7p+1,
+    0x1.3c2f74cb20bcbp+1,
+    0x1.3c4b03bc8a18dp+1,
+    0x1.3c6692b4e7dfcp+1,
+    0x1.3c8221b42c444p+1,
+    0x1.3c9db0ba57466p+1,
+    0x1.3cb93fc768e62p+1,
+    0x1.3cd4cedb61237p+1,
+    0x1.3cf05df63ffe6p+1,
+    0x1.3d0bed180576ep+1,
+    0x1.3d277c40a3bfcp+1,
+    0x1.3d430b701ad9p+1,
+    0x1.3d5e9aa66ac2ap+1,
+    0x1.3d7a29e385af6p+1,
+    0x1.3d95b927796c8p+1,
+    0x1.3db1487245fap+1,
+    0x1.3dccd7c3dd8aap+1,
+    0x1.3de8671c401e6p+1,
+    0x1.3e03f67b6db54p+1,
+    0x1.3e1f85e1664f4p+1,
+    0x1.3e3b154e1c1f3p+1,
+    0x1.3e56a4c18f25p+1,
+    0x1.3e72343bbf60cp+1,
+    0x1.3e8dc3bcacd26p+1,
+    0x1.3ea953445779fp+1,
+    0x1.3ec4e2d2b18a2p+1,
+    0x1.3ee07267bb03p+1,
+    0x1.3efc020381b1dp+1,
+    0x1.3f1791a605968p+1,
+    0x1.3f33214f2b16ap+1,
+    0x1.3f4eb0fef2323p+1,
+    0x1.3f6a40b568b67p+1,
+    0x1.3f85d0728ea36p+1,
+    0x1.3fa16036562bcp+1,
+    0x1.3fbcf000bf4f9p+1,
+    0x1.3fd87fd1ca0edp+1,
+    0x1.3ff40fa9689c4p+1,
+    0x1.400f9f879af7fp+1,
+    0x1.402b2f6c6121dp+1,
+    0x1.4046bf57bb19ep+1,
+    0x1.40624f49a8e03p+1,
+    0x1.407ddf422a74bp+1,
+    0x1.40996f413fd76p+1,
+    0x1.40b4ff46db3b1p+1,
+    0x1.40d08f52fc9fcp+1,
+    0x1.40ec1f65a4056p+1,
+    0x1.4107af7ed16cp+1,
+    0x1.41233f9e84d3ap+1,
+    0x1.413ecfc4b06fp+1,
+    0x1.415a5ff1543e2p+1,
+    0x1.4175f0247041p+1,
+    0x1.4191805e04779p+1,
+    0x1.41ad109e10e1ep+1,
+    0x1.41c8a0e4957ffp+1,
+    0x1.41e4313184849p+1,
+    0x1.41ffc184ddefbp+1,
+    0x1.421b51dea1c15p+1,
+    0x1.4236e23ecff97p+1,
+    0x1.425272a568982p+1,
+    0x1.426e03125dd01p+1,
+    0x1.42899385afa15p+1,
+    0x1.42a523ff5e0bdp+1,
+    0x1.42c0b47f690fap+1,
+    0x1.42dc4505d0accp+1,
+    0x1.42f7d59294e32p+1,
+    0x1.43136625b5b2dp+1,
+    0x1.432ef6bf254e8p+1,
+    0x1.434a875ee3b64p+1,
+    0x1.43661804f0ea1p+1,
+    0x1.4381a8b13f1cbp+1,
+    0x1.439d3963dc1b6p+1,
+    0x1.43b8ca1cc7e62p+1,
+    0x1.43d45adbf4afbp+1,
+    0x1.43efeba162781p+1,
+    0x1.440b7c6d113f5p+1,
+    0x1.44270d3ef3382p+1,
+    0x1.44429e1708629p+1,
+    0x1.445e2ef55e8bdp+1,
+    0x1.4479bfd9e7e6ap+1,
+    0x1.449550c496a5dp+1,
+    0x1.44b0e1b578969p+1,
+    0x1.44cc72ac8db8fp+1,
+    0x1.44e803a9c83fbp+1,
+    0x1.450394ad282acp+1,
+    0x1.451f25b6ad7a3p+1,
+    0x1.453ab6c6582ep+1,
+    0x1.455647dc28463p+1,
+    0x1.4571d8f81dc2bp+1,
+    0x1.458d6a1a2ad65p+1,
+    0x1.45a8fb424f812p+1,
+    0x1.45c48c708bc31p+1,
+    0x1.45e01da4df9c2p+1,
+    0x1.45fbaedf4b0c5p+1,
+    0x1.4617401fc0466p+1,
+    0x1.4632d1663f4a5p+1,
+    0x1.464e62b2c8183p+1,
+    0x1.4669f4055aaffp+1,
+    0x1.4685855df711ap+1,
+    0x1.46a116bc9d3d3p+1,
+    0x1.46bca8214d32ap+1,
+    0x1.46d8398bf924cp+1,
+    0x1.46f3cafca1139p+1,
+    0x1.470f5c7344ffp+1,
+    0x1.472aedefd719ep+1,
+    0x1.47467f7265317p+1,
+    0x1.476210faef45bp+1,
+    0x1.477da28967895p+1,
+    0x1.4799341dcdfc6p+1,
+    0x1.47b4c5b8229eep+1,
+    0x1.47d057586570dp+1,
+    0x1.47ebe8fe88a5p+1,
+    0x1.48077aaa8c3b6p+1,
+    0x1.48230c5c7033fp+1,
+    0x1.483e9e14348ebp+1,
+    0x1.485a2fd1d94bbp+1,
+    0x1.4875c1955e6aep+1,
+    0x1.4891535ec3ec4p+1,
+    0x1.48ace52dfc02ap+1,
+    0x1.48c8770306adfp+1,
+    0x1.48e408dde3ee4p+1,
+    0x1.48ff9abe93c38p+1,
+    0x1.491b2ca508608p+1,
+    0x1.4936be9141c54p+1,
+    0x1.495250834dbfp+1,
+    0x1.496de27b1e808p+1,
+    0x1.49897478b409cp+1,
+    0x1.49a5067c0e5abp+1,
+    0x1.49c098851fa63p+1,
+    0x1.49dc2a93e7ec3p+1,
+    0x1.49f7bca8672cbp+1,
+    0x1.4a134ec29d67bp+1,
+    0x1.4a2ee0e28a9d3p+1,
+    0x1.4a4a73082ecd3p+1,
+    0x1.4a66053389f7cp+1,
+    0x1.4a8197648e4f9p+1,
+    0x1.4a9d299b3bd4ap+1,
+    0x1.4ab8bbd79287p+1,
+    0x1.4ad44e199266ap+1,
+    0x1.4aefe0613b739p+1,
+    0x1.4b0b72ae7fe09p+1,
+    0x1.4b2705015fad9p+1,
+    0x1.4b429759dadaap+1,
+    0x1.4b5e29b7f167cp+1,
+    0x1.4b79bc1ba354fp+1,
+    0x1.4b954e84f0a22p+1,
+    0x1.4bb0e0f3d94f6p+1,
+    0x1.4bcc73684f8f7p+1,
+    0x1.4be805e253625p+1,
+    0x1.4c039861e4c8p+1,
+    0x1.4c1f2ae703c08p+1,
+    0x1.4c3abd71b04bep+1,
+    0x1.4c565001dc9cdp+1,
+    0x1.4c71e29788b35p+1,
+    0x1.4c8d7532b48f7p+1,
+    0x1.4ca907d360312p+1,
+    0x1.4cc49a798b986p+1,
+    0x1.4ce02d2536c54p+1,
+    0x1.4cfbbfd661b7bp+1,
+    0x1.4d17528cfea28p+1,
+    0x1.4d32e5490d85ap+1,
+    0x1.4d4e780a8e612p+1,
+    0x1.4d6a0ad17367cp+1,
+    0x1.4d859d9dca66cp+1,
+    0x1.4da1306f935e1p+1,
+    0x1.4dbcc346c0808p+1,
+    0x1.4dd8562351ce1p+1,
+    0x1.4df3e9054746cp+1,
+    0x1.4e0f7beca0ea9p+1,
+    0x1.4e2b0ed950ec5p+1,
+    0x1.4e46a1cb574bfp+1,
+    0x1.4e6234c2c1d6bp+1,
+    0x1.4e7dc7bf82bf5p+1,
+    0x1.4e995ac19a05dp+1,
+    0x1.4eb4edc907aa4p+1,
+    0x1.4ed080d5bddf5p+1,
+    0x1.4eec13e7bca51p+1,
+    0x1.4f07a6ff03fb7p+1,
+    0x1.4f233a1b93e28p+1,
+    0x1.4f3ecd3d6c5a3p+1,
+    0x1.4f5a60648d629p+1,
+    0x1.4f75f390f6fbap+1,
+    0x1.4f9186c2a9255p+1,
+    0x1.4fad19f996127p+1,
+    0x1.4fc8ad35bdc3p+1,
+    0x1.4fe440772037p+1,
+    0x1.4fffd3bdafa13p+1,
+    0x1.501b670979cedp+1,
+    0x1.5036fa5a7ebfep+1,
+    0x1.50528db0b0a72p+1,
+    0x1.506e210c0f849p+1,
+    0x1.5089b46c9b583p+1,
+    0x1.50a547d25422p+1,
+    0x1.50c0db3d2c14dp+1,
+    0x1.50dc6ead23309p+1,
+    0x1.50f8022239755p+1,
+    0x1.5113959c6ee3p+1,
+    0x1.512f291bc379bp+1,
+    0x1.514abca037395p+1,
+    0x1.51665029ca21fp+1,
+    0x1.5181e3b86e664p+1,
+    0x1.519d774c24065p+1,
+    0x1.51b90ae4eb022p+1,
+    0x1.51d49e82c359bp+1,
+    0x1.51f03225ad0cfp+1,
+    0x1.520bc5cda81bfp+1,
+    0x1.5227597aa6b97p+1,
+    0x1.5242ed2ca8e57p+1,
+    0x1.525e80e3ae9ffp+1,
+    0x1.527a149fb7e8fp+1,
+    0x1.5295a860c4c08p+1,
+    0x1.52b13c26c7595p+1,
+    0x1.52cccff1cd80ap+1,
+    0x1.52e863c1d7367p+1,
+    0x1.5303f796d6ad8p+1,
+    0x1.531f8b70cbe5ep+1,
+    0x1.533b1f4fa9124p+1,
+    0x1.5356b3336e32bp+1,
+    0x1.5372471c29147p+1,
+    0x1.538ddb09cbea3p+1,
+    0x1.53a96efc56b4p+1,
+    0x1.53c502f3c971ep+1,
+    0x1.53e096f02423cp+1,
+    0x1.53fc2af166c9bp+1,
+    0x1.5417bef783967p+1,
+    0x1.543353027a8ap+1,
+    0x1.544ee7124ba46p+1,
+    0x1.546a7b26f6e59p+1,
+    0x1.54860f407c4d9p+1,
+    0x1.54a1a35edbdc6p+1,
+    0x1.54bd37821592p+1,
+    0x1.54d8cbaa1ba13p+1,
+    0x1.54f45fd6ee09fp+1,
+    0x1.550ff4088ccc4p+1,
+    0x1.552b883ef7e83p+1,
+    0x1.55471c7a2f5dbp+1,
+    0x1.5562b0ba255f9p+1,
+    0x1.557e44fed9edcp+1,
+    0x1.5599d9484d085p+1,
+    0x1.55b56d967eaf3p+1,
+    0x1.55d101e96ee27p+1,
+    0x1.55ec96411da2p+1,
+    0x1.56082a9d8aedfp+1,
+    0x1.5623befea8f9p+1,
+    0x1.563f536477c33p+1,
+    0x1.565ae7cef74c8p+1,
+    0x1.56767c3e2794ep+1,
+    0x1.569210b2089c6p+1,
+    0x1.56ada52a8c95dp+1,
+    0x1.56c939a7b3812p+1,
+    0x1.56e4ce297d5e5p+1,
+    0x1.570062afea2d6p+1,
+    0x1.571bf73af9ee5p+1,
+    0x1.57378bcaaca12p+1,
+    0x1.5753205f0245ep+1,
+    0x1.576eb4f7fadc8p+1,
+    0x1.578a49958897cp+1,
+    0x1.57a5de37ab77bp+1,
+    0x1.57c172de637c4p+1,
+    0x1.57dd0789b0a58p+1,
+    0x1.57f89c3992f36p+1,
+    0x1.581430edfc98bp+1,
+    0x1.582fc5a6ed957p+1,
+    0x1.584b5a6465e99p+1,
+    0x1.5866ef2665952p+1,
+    0x1.588283ecec982p+1,
+    0x1.589e18b7faf29p+1,
+    0x1.58b9ad8782d73p+1,
+    0x1.58d5425b8446p+1,
+    0x1.58f0d7340d0c4p+1,
+    0x1.590c6c110f5cbp+1,
+    0x1.592800f28b375p+1,
+    0x1.594395d8809c2p+1,
+    0x1.595f2ac2e1bdep+1,
+    0x1.597abfb1ae9cap+1,
+    0x1.599654a4e7385p+1,
+    0x1.59b1e99c8b90fp+1,
+    0x1.59cd7e989ba69p+1,
+    0x1.59e9139917792p+1,
+    0x1.5a04a89dff08ap+1,
+    0x1.5a203da752552p+1,
+    0x1.5a3bd2b503916p+1,
+    0x1.5a5767c712bd5p+1,
+    0x1.5a72fcdd7fd9p+1,
+    0x1.5a8e91f83d173p+1,
+    0x1.5aaa271758452p+1,
+    0x1.5ac5bc3ad162cp+1,
+    0x1.5ae151629aa2ep+1,
+    0x1.5afce68eb4058p+1,
+    0x1.5b187bbf1d8aap+1,
+    0x1.5b3410f3d7324p+1,
+    0x1.5b4fa62ce0fc6p+1,
+    0x1.5b6b3b6a3ae9p+1,
+    0x1.5b86d0abd72aep+1,
+    0x1.5ba265f1b5c21p+1,
+    0x1.5bbdfb3bd6ae8p+1,
+    0x1.5bd9908a39f03p+1,
+    0x1.5bf525dcdf872p+1,
+    0x1.5c10bb33b9a62p+1,
+    0x1.5c2c508ed61a6p+1,
+    0x1.5c47e5ee34e3fp+1,
+    0x1.5c637b51c8358p+1,
+    0x1.5c7f10b9900f2p+1,
+    0x1.5c9aa6258c70cp+1,
+    0x1.5cb63b95af8d3p+1,
+    0x1.5cd1d109f9647p+1,
+    0x1.5ced668277c3cp+1,
+    0x1.5d08fbff1cdddp+1,
+    0x1.5d24917fe8b2bp+1,
+    0x1.5d402704db426p+1,
+    0x1.5d5bbc8df48cep+1,
+    0x1.5d77521b34923p+1,
+    0x1.5d92e7ac8d851p+1,
+    0x1.5dae7d41ff658p+1,
+    0x1.5dca12db8a338p+1,
+    0x1.5de5a8792def2p+1,
+    0x1.5e013e1aea985p+1,
+    0x1.5e1cd3c0c02f1p+1,
+    0x1.5e38696aaeb36p+1,
+    0x1.5e53ff18a8581p+1,
+    0x1.5e6f94caad1d1p+1,
+    0x1.5e8b2a80bd027p+1,
+    0x1.5ea6c03ad8082p+1,
+    0x1.5ec255f8fe2e3p+1,
+    0x1.5eddebbb21a75p+1,
+    0x1.5ef981815040dp+1,
+    0x1.5f15174b89faap+1,
+    0x1.5f30ad19c1079p+1,
+    0x1.5f4c42ebf567ap+1,
+    0x1.5f67d8c2271adp+1,
+    0x1.5f836e9c4853ep+1,
+    0x1.5f9f047a5912dp+1,
+    0x1.5fba9a5c6724ep+1,
+    0x1.5fd6304264bcdp+1,
+    0x1.5ff1c62c51daap+1,
+    0x1.600d5c1a2e7e5p+1,
+    0x1.6028f20bfaa7ep+1,
+    0x1.60448801b6575p+1,
+    0x1.60601dfb53bf6p+1,
+    0x1.607bb3f8d2e02p+1,
+    0x1.609749fa33b98p+1,
+    0x1.60b2dfff764b8p+1,
+    0x1.60ce76089a963p+1,
+    0x1.60ea0c15a0998p+1,
+    0x1.6105a22688558p+1,
+    0x1.6121383b43fcep+1,
+    0x1.613cce53d38fbp+1,
+    0x1.61586470370dfp+1,
+    0x1.6173fa906e779p+1,
+    0x1.618f90b479ccap+1,
+    0x1.61ab26dc590d2p+1,
+    0x1.61c6bd080c39p+1,
+    0x1.61e2533785831p+1,
+    0x1.61fde96ac4eb5p+1,
+    0x1.62197fa1ca71cp+1,
+    0x1.623515dc96166p+1,
+    0x1.6250ac1b27d93p+1,
+    0x1.626c425d71ecfp+1,
+    0x1.6287d8a37451bp+1,
+    0x1.62a36eed3cd4ap+1,
+    0x1.62bf053abda88p+1,
+    0x1.62da9b8bf6cd5p+1,
+    0x1.62f631e0e8432p+1,
+    0x1.6311c839843cap+1,
+    0x1.632d5e95d8871p+1,
+    0x1.6348f4f5e5228p+1,
+    0x1.63648b599c41ap+1,
+    0x1.638021c0fde48p+1,
+    0x1.639bb82c0a0b1p+1,
+    0x1.63b74e9ac0b56p+1,
+    0x1.63d2e50d21e37p+1,
+    0x1.63ee7b831fc7fp+1,
+    0x1.640a11fcba62fp+1,
+    0x1.6425a879ff81bp+1,
+    0x1.64413efae156fp+1,
+    0x1.645cd57f52157p+1,
+    0x1.64786c075f8a7p+1,
+    0x1.6494029309b5fp+1,
+    0x1.64af992242cabp+1,
+    0x1.64cb2fb51895fp+1,
+    0x1.64e6c64b8b17bp+1,
+    0x1.65025ce58c82bp+1,
+    0x1.651df3830f09bp+1,
+    0x1.65398a2412accp+1,
+    0x1.655520c8a5391p+1,
+    0x1.6570b770c6aeap+1,
+    0x1.658c4e1c69404p+1,
+    0x1.65a7e4cb8cedep+1,
+    0x1.65c37b7e31b79p+1,
+    0x1.65df1234579d4p+1,
+    0x1.65faa8edfe9efp+1,
+    0x1.66163fab18ef7p+1,
+    0x1.6631d66bb45cp+1,
+    0x1.664d6d2fd0e49p+1,
+    0x1.666903f760bbfp+1,
+    0x1.66849ac263e22p+1,
+    0x1.66a03190da572p+1,
+    0x1.66bbc862b64dbp+1,
+    0x1.66d75f37f7c5dp+1,
+    0x1.66f2f610ac8ccp+1,
+    0x1.670e8cecc6d54p+1,
+    0x1.672a23cc469f5p+1,
+    0x1.6745baaf2beafp+1,
+    0x1.6761519576b82p+1,
+    0x1.677ce87f2706ep+1,
+    0x1.67987f6c2f09fp+1,
+    0x1.67b4165c9c8e9p+1,
+    0x1.67cfad506f94cp+1,
+    0x1.67eb44479a4f5p+1,
+    0x1.6806db421cbe3p+1,
+    0x1.6822723fe9143p+1,
+    0x1.683e0940ff515p+1,
+    0x1.6859a0456d42cp+1,
+    0x1.6875374d32e88p+1,
+    0x1.6890ce5842756p+1,
+    0x1.68ac65669be96p+1,
+    0x1.68c7fc783f447p+1,
+    0x1.68e3938d2c86ap+1,
+    0x1.68ff2aa563affp+1,
+    0x1.691ac1c0d6f32p+1,
+    0x1.693658df86503p+1,
+    0x1.6951f00171c72p+1,
+    0x1.696d87269957fp+1,
+    0x1.69891e4efd02ap+1,
+    0x1.69a4b57a9cc73p+1,
+    0x1.69c04ca978a5ap+1,
+    0x1.69dbe3db909dfp+1,
+    0x1.69f77b10e4b02p+1,
+    0x1.6a131249670efp+1,
+    0x1.6a2ea98517ba6p+1,
+    0x1.6a4a40c3f6b27p+1,
+    0x1.6a65d80603f73p+1,
+    0x1.6a816f4b3f889p+1,
+    0x1.6a9d06939b996p+1,
+    0x1.6ab89ddf18299p+1,
+    0x1.6ad4352db5393p+1,
+    0x1.6aefcc7f72c83p+1,
+    0x1.6b0b63d450d6ap+1,
+    0x1.6b26fb2c4f647p+1,
+    0x1.6b4292876e71bp+1,
+    0x1.6b5e29e5adfe6p+1,
+    0x1.6b79c1470e0a7p+1,
+    0x1.6b9558ab80c8bp+1,
+    0x1.6bb0f01306392p+1,
+    0x1.6bcc877d9e5bcp+1,
+    0x1.6be81eeb49309p+1,
+    0x1.6c03b65c06b79p+1,
+    0x1.6c1f4dcfc9238p+1,
+    0x1.6c3ae54690746p+1,
+    0x1.6c567cc06a777p+1,
+    0x1.6c72143d572cbp+1,
+    0x1.6c8dabbd48c6ep+1,
+    0x1.6ca943403f46p+1,
+    0x1.6cc4dac62cdcep+1,
+    0x1.6ce0724f118b7p+1,
+    0x1.6cfc09dafb1efp+1,
+    0x1.6d17a169e9976p+1,
+    0x1.6d3338fbcf279p+1,
+    0x1.6d4ed090abcf7p+1,
+    0x1.6d6a68287f8f1p+1,
+    0x1.6d85ffc33c993p+1,
+    0x1.6da19760f0bbp+1,
+    0x1.6dbd2f019bf49p+1,
+    0x1.6dd8c6a530789p+1,
+    0x1.6df45e4bae471p+1,
+    0x1.6e0ff5f515601p+1,
+    0x1.6e2b8da165c39p+1,
+    0x1.6e4725509f718p+1,
+    0x1.6e62bd02c269fp+1,
+    0x1.6e7e54b7ceacep+1,
+    0x1.6e99ec6fb66d1p+1,
+    0x1.6eb5842a79aa8p+1,
+    0x1.6ed11be826327p+1,
+    0x1.6eecb3a8ae37ap+1,
+    0x1.6f084b6c03ecdp+1,
+    0x1.6f23e332351f5p+1,
+    0x1.6f3f7afb41cf1p+1,
+    0x1.6f5b12c71c2edp+1,
+    0x1.6f76aa95c43e9p+1,
+    0x1.6f92426739fe6p+1,
+    0x1.6fadda3b7d6e3p+1,
+    0x1.6fc972128e8e1p+1,
+    0x1.6fe509ec6d5dfp+1,
+    0x1.7000a1c919dddp+1,
+    0x1.701c39a8940dcp+1,
+    0x1.7037d18adbedbp+1,
+    0x1.7053696fe3b07p+1,
+    0x1.706f0157ab55fp+1,
+    0x1.708a994232de4p+1,
+    0x1.70a6312f7a496p+1,
+    0x1.70c1c91f81975p+1,
+    0x1.70dd61123afacp+1,
+    0x1.70f8f907a673cp+1,
+    0x1.711490ffd1cf9p+1,
+    0x1.713028fabd0e3p+1,
+    0x1.714bc0f85a626p+1,
+    0x1.716758f8a9cc2p+1,
+    0x1.7182f0fb9d7e3p+1,
+    0x1.719e890135789p+1,
+    0x1.71ba21097f888p+1,
+    0x1.71d5b9147baep+1,
+    0x1.71f151221c1bep+1,
+    0x1.720ce93260d21p+1,
+    0x1.7228814549d09p+1,
+    0x1.7244195ad7176p+1,
+    0x1.725fb17308a69p+1,
+    0x1.727b498dd0b0dp+1,
+    0x1.7296e1ab2f363p+1,
+    0x1.72b279cb3203ep+1,
+    0x1.72ce11edd919ep+1,
+    0x1.72e9aa1316abp+1,
+    0x1.7305423aeab74p+1,
+    0x1.7320da65553e9p+1,
+    0x1.733c72924873cp+1,
+    0x1.73580ac1c456dp+1,
+    0x1.7373a2f3d6b5p+1,
+    0x1.738f3b2871c1p+1,
+    0x1.73aad35f957aep+1,
+    0x1.73c66b994fafep+1,
+    0x1.73e203d59292cp+1,
+    0x1.73fd9c1450564p+1,
+    0x1.7419345596c7ap+1,
+    0x1.7434cc9965e6ep+1,
+    0x1.745064dfafe6cp+1,
+    0x1.746bfd2874c74p+1,
+    0x1.74879573b4886p+1,
+    0x1.74a32dc16f2a3p+1,
+    0x1.74bec611a4acap+1,
+    0x1.74da5e64550fbp+1,
+    0x1.74f5f6b980536p+1,
+    0x1.75118f1118aa8p+1,
+    0x1.752d276b1e15p+1,
+    0x1.7548bfc79e602p+1,
+    0x1.756458268bbebp+1,
+    0x1.757ff087e630ap+1,
+    0x1.759b88ebadb6p+1,
+    0x1.75b72151d4818p+1,
+    0x1.75d2b9ba68607p+1,
+    0x1.75ee52256952cp+1,
+    0x1.7609ea92c98b4p+1,
+    0x1.762583028909fp+1,
+    0x1.76411b74a7cedp+1,
+    0x1.765cb3e925d9ep+1,
+    0x1.76784c60032b1p+1,
+    0x1.7693e4d93fc27p+1,
+    0x1.76af7d54dbap+1,
+    0x1.76cb15d2c8f68p+1,
+    0x1.76e6ae5307c5fp+1,
+    0x1.770246d5980e5p+1,
+    0x1.771ddf5a79cfap+1,
+    0x1.773977e1ad09ep+1,
+    0x1.7755106b31bd1p+1,
+    0x1.7770a8f707e94p+1,
+    0x1.778c418521c12p+1,
+    0x1.77a7da158d11fp+1,
+    0x1.77c372a849dbbp+1,
+    0x1.77df0b3d4a512p+1,
+    0x1.77faa3d48e725p+1,
+    0x1.78163c6e163f3p+1,
+    0x1.7831d509e1b7dp+1,
+    0x1.784d6da7f0dc2p+1,
+    0x1.7869064835defp+1,
+    0x1.78849eeab0c03p+1,
+    0x1.78a0378f6f4d3p+1,
+    0x1.78bbd03663b8ap+1,
+    0x1.78d768df8e029p+1,
+    0x1.78f3018aee2bp+1,
+    0x1.790e9a388431fp+1,
+    0x1.792a32e850175p+1,
+    0x1.7945cb9a440dfp+1,
+    0x1.7961644e6015dp+1,
+    0x1.797cfd04b1fc3p+1,
+    0x1.799895bd39c11p+1,
+    0x1.79b42e77e9973p+1,
+    0x1.79cfc734c17e9p+1,
+    0x1.79eb5ff3c1773p+1,
+    0x1.7a06f8b4dbb3dp+1,
+    0x1.7a22917810347p+1,
+    0x1.7a3e2a3d6cc65p+1,
+    0x1.7a59c304f1697p+1,
+    0x1.7a755bce90509p+1,
+    0x1.7a90f49a497bcp+1,
+    0x1.7aac8d681ceafp+1,
+    0x1.7ac826380a9e2p+1,
+    0x1.7ae3bf0a12956p+1,
+    0x1.7aff57de27036p+1,
+    0x1.7b1af0b455b56p+1,
+    0x1.7b36898c9eab7p+1,
+    0x1.7b522266f4184p+1,
+    0x1.7b6dbb4355fbep+1,
+    0x1.7b895421c4564p+1,
+    0x1.7ba4ed023f277p+1,
+    0x1.7bc085e4c66f7p+1,
+    0x1.7bdc1ec95a2e3p+1,
+    0x1.7bf7b7afec968p+1,
+    0x1.7c1350987da86p+1,
+    0x1.7c2ee9831b311p+1,
+    0x1.7c4a826fb7634p+1,
+    0x1.7c661b5e523fp+1,
+    0x1.7c81b44eebc45p+1,
+    0x1.7c9d4d4183f33p+1,
+    0x1.7cb8e6361acbap+1,
+    0x1.7cd47f2ca2806p+1,
+    0x1.7cf018251b117p+1,
+    0x1.7d0bb11f924c1p+1,
+    0x1.7d274a1c08304p+1,
+    0x1.7d42e31a6ef0cp+1,
+    0x1.7d5e7c1ac68dap+1,
+    0x1.7d7a151d0f06dp+1,
+    0x1.7d95ae21485c5p+1,
+    0x1.7db1472764c0ep+1,
+    0x1.7dcce02f64349p+1,
+    0x1.7de8793954849p+1,
+    0x1.7e04124535b0ep+1,
+    0x1.7e1fab52f9ec5p+1,
+    0x1.7e3b4462a136dp+1,
+    0x1.7e56dd742b907p+1,
+    0x1.7e72768798f92p+1,
+    0x1.7e8e0f9ce970fp+1,
+    0x1.7ea9a8b40f2a9p+1,
+    0x1.7ec541cd0a261p+1,
+    0x1.7ee0dae7e830bp+1,
+    0x1.7efc7404a94a6p+1,
+    0x1.7f180d233fa5fp+1,
+    0x1.7f33a643ab436p+1,
+    0x1.7f4f3f65ec22bp+1,
+    0x1.7f6ad88a0243dp+1,
+    0x1.7f8671afdfd9ap+1,
+    0x1.7fa20ad784e41p+1,
+    0x1.7fbda400ff305p+1,
+    0x1.7fd93d2c4ebe7p+1,
+    0x1.7ff4d65965c13p+1,
+    0x1.80106f8844389p+1,
+    0x1.802c08b8ea249p+1,
+    0x1.8047a1eb57854p+1,
+    0x1.80633b1f8c5a9p+1,
+    0x1.807ed4557ad74p+1,
+    0x1.809a6d8d30c89p+1,
+    0x1.80b606c6ae2e8p+1,
+    0x1.80d1a001e53bep+1,
+    0x1.80ed393ed5f0ap+1,
+    0x1.8108d27d804ccp+1,
+    0x1.81246bbde4505p+1,
+    0x1.8140050001fb4p+1,
+    0x1.815b9e43d94dap+1,
+    0x1.817737896a476p+1,
+    0x1.8192d0d0b4e88p+1,
+    0x1.81ae6a19ab63dp+1,
+    0x1.81ca03644db95p+1,
+    0x1.81e59cb0a9b63p+1,
+    0x1.820135feb18d4p+1,
+    0x1.821ccf4e653e7p+1,
+    0x1.8238689fc4c9dp+1,
+    0x1.825401f2c2622p+1,
+    0x1.826f9b476bd4ap+1,
+    0x1.828b349dc1215p+1,
+    0x1.82a6cdf5b47afp+1,
+    0x1.82c2674f45e17p+1,
+    0x1.82de00aa7554ep+1,
+    0x1.82f99a0742d54p+1,
+    0x1.83153365ae629p+1,
+    0x1.8330ccc5b7fcdp+1,
+    0x1.834c66275fa4p+1,
+    0x1.8367ff8aa5582p+1,
+    0x1.838398ef89193p+1,
+    0x1.839f32560ae73p+1,
+    0x1.83bacbbe1cf4fp+1,
+    0x1.83d66527bf426p+1,
+    0x1.83f1fe92f1cf8p+1,
+    0x1.840d97ffb49c6p+1,
+    0x1.8429316e07a8fp+1,
+    0x1.8444caddeaf53p+1,
+    0x1.8460644f5e812p+1,
+    0x1.847bfdc2547f9p+1,
+    0x1.84979736dabdbp+1,
+    0x1.84b330acf13b9p+1,
+    0x1.84ceca248a2bep+1,
+    0x1.84ea639da58ebp+1,
+    0x1.8505fd184363fp+1,
+    0x1.8521969463abbp+1,
+    0x1.853d30120665fp+1,
+    0x1.8558c9912b92ap+1,
+    0x1.85746311d331dp+1,
+    0x1.858ffc93ef764p+1,
+    0x1.85ab9617805ffp+1,
+    0x1.85c72f9c93bc1p+1,
+    0x1.85e2c9231bbd7p+1,
+    0x1.85fe62ab18641p+1,
+    0x1.8619fc3489affp+1,
+    0x1.863595bf6fa11p+1,
+    0x1.86512f4bca377p+1,
+    0x1.866cc8d99973p+1,
+    0x1.86886268dd53dp+1,
+    0x1.86a3fbf9880cbp+1,
+    0x1.86bf958b999d9p+1,
+    0x1.86db2f1f12067p+1,
+    0x1.86f6c8b3f1475p+1,
+    0x1.8712624a37603p+1,
+    0x1.872dfbe1e4512p+1,
+    0x1.8749957af81a1p+1,
+    0x1.87652f1572bbp+1,
+    0x1.8780c8b15433fp+1,
+    0x1.879c624e9c84ep+1,
+    0x1.87b7fbed4baddp+1,
+    0x1.87d3958d53e19p+1,
+    0x1.87ef2f2eb5201p+1,
+    0x1.880ac8d16f696p+1,
+    0x1.8826627582bd7p+1,
+    0x1.8841fc1aef1c5p+1,
+    0x1.885d95c1b485fp+1,
+    0x1.88792f69d2fa6p+1,
+    0x1.8894c9134a799p+1,
+    0x1.88b062be1b039p+1,
+    0x1.88cbfc6a36cb2p+1,
+    0x1.88e796179dd03p+1,
+    0x1.89032fc65012dp+1,
+    0x1.891ec9764d93p+1,
+    0x1.893a63279650cp+1,
+    0x1.8955fcda2a4c1p+1,
+    0x1.8971968e0984ep+1,
+    0x1.898d304333fb4p+1,
+    0x1.89a8c9f9a9af3p+1,
+    0x1.89c463b16aa0bp+1,
+    0x1.89dffd6a69028p+1,
+    0x1.89fb9724a4d4ap+1,
+    0x1.8a1730e02be45p+1,
+    0x1.8a32ca9cf0645p+1,
+    0x1.8a4e645af254ap+1,
+    0x1.8a69fe1a31b54p+1,
+    0x1.8a8597daae863p+1,
+    0x1.8aa1319c68c77p+1,
+    0x1.8abccb5f52abdp+1,
+    0x1.8ad865237a008p+1,
+    0x1.8af3fee8dec58p+1,
+    0x1.8b0f98af732d9p+1,
+    0x1.8b2b32773738cp+1,
+    0x1.8b46cc402ae7p+1,
+    0x1.8b62660a4e385p+1,
+    0x1.8b7dffd5a12ccp+1,
+    0x1.8b9999a223c44p+1,
+    0x1.8bb5336fd5feep+1,
+    0x1.8bd0cd3eb7dc9p+1,
+    0x1.8bec670ec95d5p+1,
+    0x1.8c0800dffcb3fp+1,
+    0x1.8c239ab251e07p+1,
+    0x1.8c3f3485d6bp+1,
+    0x1.8c5ace5a7d557p+1,
+    0x1.8c76683045d0cp+1,
+    0x1.8c9202073021ep+1,
+    0x1.8cad9bdf3c48ep+1,
+    0x1.8cc935b86a45cp+1,
+    0x1.8ce4cf92ba187p+1,
+    0x1.8d00696e2bc1p+1,
+    0x1.8d1c034ab1723p+1,
+    0x1.8d379d284b2cp+1,
+    0x1.8d53370706bbbp+1,
+    0x1.8d6ed0e6e4213p+1,
+    0x1.8d8a6ac7d58f5p+1,
+    0x1.8da604a9db061p+1,
+    0x1.8dc19e8cf4857p+1,
+    0x1.8ddd3871220d7p+1,
+    0x1.8df8d256639e1p+1,
+    0x1.8e146c3cb9375p+1,
+    0x1.8e300624150cp+1,
+    0x1.8e4ba00c771c1p+1,
+    0x1.8e6739f5ed34cp+1,
+    0x1.8e82d3e077561p+1,
+    0x1.8e9e6dcc07b2cp+1,
+    0x1.8eba07b89e4adp+1,
+    0x1.8ed5a1a63b1e5p+1,
+    0x1.8ef13b94de2d3p+1,
+    0x1.8f0cd58487777p+1,
+    0x1.8f286f7536fd2p+1,
+    0x1.8f440966ecbe3p+1,
+    0x1.8f5fa3599aed7p+1,
+    0x1.8f7b3d4d4f581p+1,
+    0x1.8f96d74209fe1p+1,
+    0x1.8fb27137bd124p+1,
+    0x1.8fce0b2e68949p+1,
+    0x1.8fe9a5260c851p+1,
+    0x1.90053f1ea8e3cp+1,
+    0x1.9020d9183db09p+1,
+    0x1.903c7312caeb9p+1,
+    0x1.90580d0e5094bp+1,
+    0x1.9073a70aceacp+1,
+    0x1.908f410845317p+1,
+    0x1.90aadb06b4251p+1,
+    0x1.90c675060db9ap+1,
+    0x1.90e20f0651ef2p+1,
+    0x1.90fda9078e92cp+1,
+    0x1.91194309b5d75p+1,
+    0x1.9134dd0cc7bcdp+1,
+    0x1.91507710c4434p+1,
+    0x1.916c1115ab6aap+1,
+    0x1.9187ab1b7d32fp+1,
+    0x1.91a34522399c3p+1,
+    0x1.91bedf29e0a66p+1,
+    0x1.91da793264844p+1,
+    0x1.91f6133bd3031p+1,
+    0x1.9211ad462c22dp+1,
+    0x1.922d475162164p+1,
+    0x1.9248e15d74dd6p+1,
+    0x1.92647b6a64783p+1,
+    0x1.9280157830e6bp+1,
+    0x1.929baf86da28fp+1,
+    0x1.92b74996603eep+1,
+    0x1.92d2e3a6c3288p+1,
+    0x1.92ee7db802e5dp+1,
+    0x1.930a17ca1f76dp+1,
+    0x1.9325b1dd18db9p+1,
+    0x1.93414bf0e146cp+1,
+    0x1.935ce60578b87p+1,
+    0x1.9378801aecfddp+1,
+    0x1.93941a313049ap+1,
+    0x1.93afb448429bfp+1,
+    0x1.93cb4e6023f4bp+1,
+    0x1.93e6e878d453fp+1,
+    0x1.9402829253b9ap+1,
+    0x1.941e1caca225dp+1,
+    0x1.9439b6c7bf987p+1,
+    0x1.945550e3ac119p+1,
+    0x1.9470eb0067912p+1,
+    0x1.948c851de449fp+1,
+    0x1.94a81f3c223cp+1,
+    0x1.94c3b95b2f348p+1,
+    0x1.94df537b0b338p+1,
+    0x1.94faed9ba86bcp+1,
+    0x1.951687bd06dd3p+1,
+    0x1.953221df2687ep+1,
+    0x1.954dbc02076bdp+1,
+    0x1.95695625a989p+1,
+    0x1.9584f04a0cdf7p+1,
+    0x1.95a08a6f316f1p+1,
+    0x1.95bc2495096acp+1,
+    0x1.95d7bebb94d27p+1,
+    0x1.95f358e2e1735p+1,
+    0x1.960ef30aef4d7p+1,
+    0x1.962a8d33b0939p+1,
+    0x1.9646275d2545bp+1,
+    0x1.9661c1874d63ep+1,
+    0x1.967d5bb228ee1p+1,
+    0x1.9698f5ddc5b17p+1,
+    0x1.96b4900a15e0ep+1,
+    0x1.96d02a370baf1p+1,
+    0x1.96ebc464b4e94p+1,
+    0x1.97075e93118f7p+1,
+    0x1.9722f8c213d46p+1,
+    0x1.973e92f1c9856p+1,
+    0x1.975a2d2232a26p+1,
+    0x1.9775c753415e2p+1,
+    0x1.97916184f5b8ap+1,
+    0x1.97acfbb74fb1fp+1,
+    0x1.97c895ea5d174p+1,
+    0x1.97e4301e1de89p+1,
+    0x1.97ffca528458ap+1,
+    0x1.981b648790678p+1,
+    0x1.9836febd42152p+1,
+    0x1.985298f38b945p+1,
+    0x1.986e332a6ce51p+1,
+    0x1.9889cd61f3d49p+1,
+    0x1.98a5679a2062dp+1,
+    0x1.98c101d2f28fep+1,
+    0x1.98dc9c0c5c8e8p+1,
+    0x1.98f836465e5eap+1,
+    0x1.9913d08105cd9p+1,
+    0x1.992f6abc450ep+1,
+    0x1.994b04f81c2p+1,
+    0x1.99669f3498d0cp+1,
+    0x1.99823971ad531p+1,
+    0x1.999dd3af4bd9bp+1,
+    0x1.99b96ded8231ep+1,
+    0x1.99d5082c505b9p+1,
+    0x1.99f0a26bb656dp+1,
+    0x1.9a0c3cabb423ap+1,
+    0x1.9a27d6ec3bf4cp+1,
+    0x1.9a43712d5b977p+1,
+    0x1.9a5f0b6f130bap+1,
+    0x1.9a7aa5b154842p+1,
+    0x1.9a963ff42000fp+1,
+    0x1.9ab1da3775821p+1,
+    0x1.9acd747b55078p+1,
+    0x1.9ae90ebfbe914p+1,
+    0x1.9b04a904b21f5p+1,
+    0x1.9b20434a2fb1bp+1,
+    0x1.9b3bdd9037486p+1,
+    0x1.9b5777d6c8e36p+1,
+    0x1.9b73121de482bp+1,
+    0x1.9b8eac658a265p+1,
+    0x1.9baa46adb9ce4p+1,
+    0x1.9bc5e0f665ad5p+1,
+    0x1.9be17b3f8dc37p+1,
+    0x1.9bfd15893fddep+1,
+    0x1.9c18afd37bfcap+1,
+    0x1.9c344a1e34527p+1,
+    0x1.9c4fe46968df5p+1,
+    0x1.9c6b7eb519a35p+1,
+    0x1.9c871901469e6p+1,
+    0x1.9ca2b34defd08p+1,
+    0x1.9cbe4d9b1539cp+1,
+    0x1.9cd9e7e8b6da1p+1,
+    0x1.9cf58236d4b17p+1,
+    0x1.9d111c856ebfep+1,
+    0x1.9d2cb6d477383p+1,
+    0x1.9d485123fbe79p+1,
+    0x1.9d63eb73fcce1p+1,
+    0x1.9d7f85c46c1e6p+1,
+    0x1.9d9b201557a5dp+1,
+    0x1.9db6ba66bf645p+1,
+    0x1.9dd254b8958cap+1,
+    0x1.9dedef0ada1edp+1,
+    0x1.9e09895d8d1aep+1,
+    0x1.9e2523b0ae80cp+1,
+    0x1.9e40be043e508p+1,
+    0x1.9e5c58583c8a1p+1,
+    0x1.9e77f2aca92d8p+1,
+    0x1.9e938d01843adp+1,
+    0x1.9eaf2756cdb1fp+1,
+    0x1.9ecac1ac8592fp+1,
+    0x1.9ee65c02abddcp+1,
+    0x1.9f01f65932c53p+1,
+    0x1.9f1d90b01a494p+1,
+    0x1.9f392b0770373p+1,
+    0x1.9f54c55f348efp+1,
+    0x1.9f705fb759835p+1,
+    0x1.9f8bfa0fdf145p+1,
+    0x1.9fa79468d30f3p+1,
+    0x1.9fc32ec227a6bp+1,
+    0x1.9fdec91bdcdadp+1,
+    0x1.9ffa6375f2ab9p+1,
+    0x1.a015fdd06918ep+1,
+    0x1.a031982b4022dp+1,
+    0x1.a04d328677c96p+1,
+    0x1.a068cce2100c9p+1,
+    0x1.a084673e08ec6p+1,
+    0x1.a0a0019a6268dp+1,
+    0x1.a0bb9bf70eb4ap+1,
+    0x1.a0d736541b9d1p+1,
+    0x1.a0f2d0b189222p+1,
+    0x1.a10e6b0f49769p+1,
+    0x1.a12a056d5c9a6p+1,
+    0x1.a1459fcbc28d9p+1,
+    0x1.a1613a2a891d6p+1,
+    0x1.a17cd489b049dp+1,
+    0x1.a1986ee92a45ap+1,
+    0x1.a1b40948f710ep+1,
+    0x1.a1cfa3a916ab8p+1,
+    0x1.a1eb3e0989158p+1,
+    0x1.a206d86a4e4eep+1,
+    0x1.a22272cb6657ap+1,
+    0x1.a23e0d2cd12fdp+1,
+    0x1.a259a78e8ed76p+1,
+    0x1.a27541f09f4e5p+1,
+    0x1.a290dc530294ap+1,
+    0x1.a2ac76b5aadd2p+1,
+    0x1.a2c811189827cp+1,
+    0x1.a2e3ab7bd841cp+1,
+    0x1.a2ff45df6b2b3p+1,
+    0x1.a31ae0434316cp+1,
+    0x1.a3367aa760048p+1,
+    0x1.a352150bcfc1ap+1,
+    0x1.a36daf708480ep+1,
+    0x1.a38949d57e425p+1,
+    0x1.a3a4e43acad32p+1,
+    0x1.a3c07ea05c662p+1,
+    0x1.a3dc190632fb4p+1,
+    0x1.a3f7b36c4e929p+1,
+    0x1.a4134dd2af2cp+1,
+    0x1.a42ee83954c7ap+1,
+    0x1.a44a82a03f656p+1,
+    0x1.a4661d076f055p+1,
+    0x1.a481b76ed5da2p+1,
+    0x1.a49d51d681b12p+1,
+    0x1.a4b8ec3e728a4p+1,
+    0x1.a4d486a69a985p+1,
+    0x1.a4f0210f07a89p+1,
+    0x1.a50bbb77b9bafp+1,
+    0x1.a52755e0a3024p+1,
+    0x1.a542f049c37e8p+1,
+    0x1.a55e8ab328fcep+1,
+    0x1.a57a251cd37d7p+1,
+    0x1.a595bf86b532fp+1,
+    0x1.a5b159f0ce1d5p+1,
+    0x1.a5ccf45b1e3cap+1,
+    0x1.a5e88ec5a590ep+1,
+    0x1.a6042930641a1p+1,
+    0x1.a61fc39b59d83p+1,
+    0x1.a63b5e0686cb3p+1,
+    0x1.a656f871eaf32p+1,
+    0x1.a67292dd865p+1,
+    0x1.a68e2d4958e1dp+1,
+    0x1.a6a9c7b562a89p+1,
+    0x1.a6c56221a3a43p+1,
+    0x1.a6e0fc8e1bd4cp+1,
+    0x1.a6fc96facb3a4p+1,
+    0x1.a7183167b1d4bp+1,
+    0x1.a733cbd4c1d6dp+1,
+    0x1.a74f6641fb40ap+1,
+    0x1.a76b00af6bdf6p+1,
+    0x1.a7869b1d13b31p+1,
+    0x1.a7a2358ae4ee7p+1,
+    0x1.a7bdcff8df918p+1,
+    0x1.a7d96a6711698p+1,
+    0x1.a7f504d56ca93p+1,
+    0x1.a8109f43f1509p+1,
+    0x1.a82c39b2ad2cdp+1,
+    0x1.a847d4219270dp+1,
+    0x1.a8636e90a11c8p+1,
+    0x1.a87f08ffd92fep+1,
+    0x1.a89aa36f3aaafp+1,
+    0x1.a8b63ddec58dbp+1,
+    0x1.a8d1d84e79d82p+1,
+    0x1.a8ed72be578a4p+1,
+    0x1.a9090d2e5ea41p+1,
+    0x1.a924a79e8f259p+1,
+    0x1.a940420ee90ecp+1,
+    0x1.a95bdc7f6c5fbp+1,
+    0x1.a97776f00b4b1p+1,
+    0x1.a9931160d39e2p+1,
+    0x1.a9aeabd1c558ep+1,
+    0x1.a9ca4642d2ae2p+1,
+    0x1.a9e5e0b4096b1p+1,
+    0x1.aa017b25698fbp+1,
+    0x1.aa1d1596e54ecp+1,
+    0x1.aa38b0087ca85p+1,
+    0x1.aa544a7a3d699p+1,
+    0x1.aa6fe4ec27928p+1,
+    0x1.aa8b7f5e2d55ep+1,
+    0x1.aaa719d04eb3cp+1,
+    0x1.aac2b4428bac1p+1,
+    0x1.aade4eb4e43edp+1,
+    0x1.aaf9e927586c1p+1,
+    0x1.ab158399f601p+1,
+    0x1.ab311e0cbcfdap+1,
+    0x1.ab4cb87f9f94bp+1,
+    0x1.ab6852f29dc64p+1,
+    0x1.ab83ed65b7924p+1,
+    0x1.ab9f87d8ecf8cp+1,
+    0x1.abbb224c3df9bp+1,
+    0x1.abd6bcbfaa951p+1,
+    0x1.abf2573332cafp+1,
+    0x1.ac0df1a6d69b4p+1,
+    0x1.ac298c1a8838dp+1,
+    0x1.ac45268e47a3ap+1,
+    0x1.ac60c10222a8ep+1,
+    0x1.ac7c5b7619489p+1,
+    0x1.ac97f5ea2b82cp+1,
+    0x1.acb3905e59576p+1,
+    0x1.accf2ad2a2c68p+1,
+    0x1.aceac546fa02dp+1,
+    0x1.ad065fbb5f0c6p+1,
+    0x1.ad21fa2fdfb06p+1,
+    0x1.ad3d94a47beeep+1,
+    0x1.ad592f1925fa9p+1,
+    0x1.ad74c98dddd38p+1,
+    0x1.ad906402b146fp+1,
+    0x1.adabfe77a054dp+1,
+    0x1.adc798ec9d2ffp+1,
+    0x1.ade33361a7d84p+1,
+    0x1.adfecdd6ce1b1p+1,
+    0x1.ae1a684c022b1p+1,
+    0x1.ae3602c144085p+1,
+    0x1.ae519d3693b2dp+1,
+    0x1.ae6d37abf12a9p+1,
+    0x1.ae88d2216a3ccp+1,
+    0x1.aea46c96f11c3p+1,
+    0x1.aec0070c85c8dp+1,
+    0x1.aedba1822842bp+1,
+    0x1.aef73bf7d889dp+1,
+    0x1.af12d66d969e2p+1,
+    0x1.af2e70e3627fbp+1,
+    0x1.af4a0b593c2e8p+1,
+    0x1.af65a5cf23aa9p+1,
+    0x1.af81404518f3dp+1,
+    0x1.af9cdabb1c0a5p+1,
+    0x1.afb875312cee1p+1,
+    0x1.afd40fa74b9fp+1,
+    0x1.afefaa1d781d3p+1,
+    0x1.b00b4493a49b6p+1,
+    0x1.b026df09dee6dp+1,
+    0x1.b042798026ff7p+1,
+    0x1.b05e13f67ce55p+1,
+    0x1.b079ae6ce0987p+1,
+    0x1.b09548e3444b9p+1,
+    0x1.b0b0e359a7febp+1,
+    0x1.b0cc7dd00bb1dp+1,
+    0x1.b0e818466f64fp+1,
+    0x1.b103b2bcd3181p+1,
+};
+
+extern const double f2[8192] = {
+    0x0p+0,
+    -0x1.7cf915d73de6fp-22,
+    -0x1.7cf915d73de6fp-20,
+    -0x1.ac98389225a3dp-19,
+    -0x1.7cf915d73de6fp-18,
+    -0x1.29a29910285c6p-17,
+    -0x1.ac98389225a3cp-17,
+    -0x1.23aeb4b8cb64dp-16,
+    -0x1.7cf915d73de6fp-16,
+    -0x1.e22b3fa46a585p-16,
+    -0x1.29a29910285c7p-15,
+    -0x1.682376a578845p-15,
+    -0x1.ac98389225a3dp-15,
+    -0x1.f700ded62fbafp-15,
+    -0x1.23aeb4b8cb64dp-14,
+    -0x1.4ed6ec322d67fp-14,
+    -0x1.7cf915d73de6ep-14,
+    -0x1.ae1531a7fce1ap-14,
+    -0x1.e22b3fa46a583p-14,
+    -0x1.0c9d9fe643255p-13,
+    -0x1.29a29910285c6p-13,
+    -0x1.48248b4fe4d16p-13,
+    -0x1.682376a578844p-13,
+    -0x1.899f5b10e3751p-13,
+    -0x1.ac98389225a3cp-13,
+    -0x1.d10e0f293f106p-13,
+    -0x1.f700ded62fbaep-13,
+    -0x1.0f3853cc7bd1bp-12,
+    -0x1.23aeb4b8cb64ep-12,
+    -0x1.38e392300697p-12,
+    -0x1.4ed6ec322d682p-12,
+    -0x1.6588c2bf3fd83p-12,
+    -0x1.7cf915d73de73p-12,
+    -0x1.9527e57a27952p-12,
+    -0x1.ae1531a7fce2p-12,
+    -0x1.c7c0fa60bdcdep-12,
+    -0x1.e22b3fa46a58bp-12,
+    -0x1.fd54017302827p-12,
+    -0x1.0c9d9fe643259p-11,
+    -0x1.1af07d587ad96p-11,
+    -0x1.29a29910285cbp-11,
+    -0x1.38b3f30d4baf7p-11,
+    -0x1.48248b4fe4d1bp-11,
+    -0x1.57f461d7f3c37p-11,
+    -0x1.682376a57884ap-11,
+    -0x1.78b1c9b873155p-11,
+    -0x1.899f5b10e3757p-11,
+    -0x1.9aec2aaec9a51p-11,
+    -0x1.ac98389225a43p-11,
+    -0x1.bea384baf772cp-11,
+    -0x1.d10e0f293f10dp-11,
+    -0x1.e3d7d7dcfc7e5p-11,
+    -0x1.f700ded62fbb5p-11,
+    -0x1.0544920a6c63ep-10,
+    -0x1.0f3853cc7bd1ep-10,
+    -0x1.195bb4b146279p-10,
+    -0x1.23aeb4b8cb65p-10,
+    -0x1.2e3153e30b8a3p-10,
+    -0x1.38e3923006972p-10,
+    -0x1.43c56f9fbc8bcp-10,
+    -0x1.4ed6ec322d682p-10,
+    -0x1.5a1807e7592c4p-10,
+    -0x1.6588c2bf3fd82p-10,
+    -0x1.71291cb9e16bcp-10,
+    -0x1.7cf915d73de71p-10,
+    -0x1.88f8ae17554a2p-10,
+    -0x1.9527e57a2794fp-10,
+    -0x1.a186bbffb4c78p-10,
+    -0x1.ae1531a7fce1dp-10,
+    -0x1.bad34672ffe3dp-10,
+    -0x1.c7c0fa60bdcd9p-10,
+    -0x1.d4de4d71369f1p-10,
+    -0x1.e22b3fa46a585p-10,
+    -0x1.efa7d0fa58f95p-10,
+    -0x1.fd5401730282p-10,
+    -0x1.0597e88733794p-9,
+    -0x1.0c9d9fe643255p-9,
+    -0x1.13bb26d6b0454p-9,
+    -0x1.1af07d587ad91p-9,
+    -0x1.223da36ba2e0cp-9,
+    -0x1.29a29910285c5p-9,
+    -0x1.311f5e460b4bcp-9,
+    -0x1.38b3f30d4baf1p-9,
+    -0x1.40605765e9864p-9,
+    -0x1.48248b4fe4d15p-9,
+    -0x1.50008ecb3d904p-9,
+    -0x1.57f461d7f3c3p-9,
+    -0x1.600004760769ap-9,
+    -0x1.682376a578842p-9,
+    -0x1.705eb86647128p-9,
+    -0x1.78b1c9b87314cp-9,
+    -0x1.811caa9bfc8aep-9,
+    -0x1.899f5b10e374ep-9,
+    -0x1.9239db1727d2cp-9,
+    -0x1.9aec2aaec9a48p-9,
+    -0x1.a3b649d7c8ea2p-9,
+    -0x1.ac98389225a39p-9,
+    -0x1.b591f6dddfd0ep-9,
+    -0x1.bea384baf7721p-9,
+    -0x1.c7cce2296c872p-9,
+    -0x1.d10e0f293f101p-9,
+    -0x1.da670bba6f0cep-9,
+    -0x1.e3d7d7dcfc7d9p-9,
+    -0x1.ed607390e7622p-9,
+    -0x1.f700ded62fba9p-9,
+    -0x1.005c8cd66ac36p-8,
+    -0x1.0544920a6c637p-8,
+    -0x1.0a387f071cbd7p-8,
+    -0x1.0f3853cc7bd16p-8,
+    -0x1.1444105a899f4p-8,
+    -0x1.195bb4b146271p-8,
+    -0x1.1e7f40d0b168cp-8,
+    -0x1.23aeb4b8cb646p-8,
+    -0x1.28ea10699419fp-8,
+    -0x1.2e3153e30b897p-8,
+    -0x1.33847f2531b2ep-8,
+    -0x1.38e3923006964p-8,
+    -0x1.3e4e8d038a339p-8,
+    -0x1.43c56f9fbc8adp-8,
+    -0x1.49483a049d9cp-8,
+    -0x1.4ed6ec322d672p-8,
+    -0x1.547186286bec3p-8,
+    -0x1.5a1807e7592b3p-8,
+    -0x1.5fca716ef5242p-8,
+    -0x1.6588c2bf3fd7p-8,
+    -0x1.6b52fbd83943dp-8,
+    -0x1.71291cb9e16a9p-8,
+    -0x1.770b2564384b4p-8,
+    -0x1.7cf915d73de5ep-8,
+    -0x1.82f2ee12f23a7p-8,
+    -0x1.88f8ae175548ep-8,
+    -0x1.8f0a55e467114p-8,
+    -0x1.9527e57a27939p-8,
+    -0x1.9b515cd88eep-8,
+    -0x1.a186bbff75474p-8,
+    -0x1.a7c802ee9f426p-8,
+    -0x1.ae1531a599bb8p-8,
+    -0x1.b46e4823be059p-8,
+    -0x1.bad3466835d49p-8,
+    -0x1.c1442c71ff352p-8,
+    -0x1.c7c0fa3ff8748p-8,
+    -0x1.ce49afd0d438bp-8,
+    -0x1.d4de4d231588bp-8,
+    -0x1.db7ed2350fcc4p-8,
+    -0x1.e22b3f04e2d42p-8,
+    -0x1.e8e3939076e2p-8,
+    -0x1.efa7cfd59c681p-8,
+    -0x1.f677f3d1f0416p-8,
+    -0x1.fd53ff82e799bp-8,
+    -0x1.021df972de0bp-7,
+    -0x1.0597e6fbb9e21p-7,
+    -0x1.0917c85a72896p-7,
+    -0x1.0c9d9d8d5d64bp-7,
+    -0x1.10296692bff8p-7,
+    -0x1.13bb2368c9f3cp-7,
+    -0x1.1752d40d9338dp-7,
+    -0x1.1af0787f1dd47p-7,
+    -0x1.1e9410bb57fc3p-7,
+    -0x1.223d9cc00e2a6p-7,
+    -0x1.25ed1c8afcf97p-7,
+    -0x1.29a29019c3407p-7,
+    -0x1.2d5df769f7e6bp-7,
+    -0x1.311f52791017ep-7,
+    -0x1.34e6a14465387p-7,
+    -0x1.38b3e3c93ad8fp-7,
+    -0x1.3c871a04c2ae9p-7,
+    -0x1.406043f412a6cp-7,
+    -0x1.443f619430cf6p-7,
+    -0x1.482472e213569p-7,
+    -0x1.4c0f77da94a2ep-7,
+    -0x1.5000707a79476p-7,
+    -0x1.53f75cbe641bbp-7,
+    -0x1.57f43ca2ea13bp-7,
+    -0x1.5bf71024825fdp-7,
+    -0x1.5fffd73f8869p-7,
+    -0x1.640e91f051a44p-7,
+    -0x1.6823403313c73p-7,
+    -0x1.6c3de203eeb3dp-7,
+    -0x1.705e775ee684ap-7,
+    -0x1.7485003feb7c9p-7,
+    -0x1.78b17ca2d216fp-7,
+    -0x1.7ce3ec835eef7p-7,
+    -0x1.811c4fdd44c6p-7,
+    -0x1.855aa6ac149f5p-7,
+    -0x1.899ef0eb4fa03p-7,
+    -0x1.8de92e9655323p-7,
+    -0x1.92395fa870e71p-7,
+    -0x1.968f841cda792p-7,
+    -0x1.9aeb9beeb9c2ep-7,
+    -0x1.9f4da7191cd35p-7,
+    -0x1.a3b5a596ec061p-7,
+    -0x1.a8239762fddb2p-7,
+    -0x1.ac977c781ceabp-7,
+    -0x1.b11154d0fff55p-7,
+    -0x1.b5912068360c5p-7,
+    -0x1.ba16df3844552p-7,
+    -0x1.bea2913b8e39dp-7,
+    -0x1.c334366c5d58fp-7,
+    -0x1.c7cbcec4eb715p-7,
+    -0x1.cc695a3f5c6e3p-7,
+    -0x1.d10cd8d5bc6b3p-7,
+    -0x1.d5b64a81ffb47p-7,
+    -0x1.da65af3e00ca7p-7,
+    -0x1.df1b07037e666p-7,
+    -0x1.e3d651cc2d556p-7,
+    -0x1.e8978f91ac912p-7,
+    -0x1.ed5ec04d7b53dp-7,
+    -0x1.f22be3f8ff0c3p-7,
+    -0x1.f6fefa8d85595p-7,
+    -0x1.fbd80404440abp-7,
+    -0x1.005b802b2d8e3p-6,
+    -0x1.02cdf7be6d554p-6,
+    -0x1.054368b85e7eep-6,
+    -0x1.07bbd315704bap-6,
+    -0x1.0a3736d2011e6p-6,
+    -0x1.0cb593ea6b621p-6,
+    -0x1.0f36ea5af8a3fp-6,
+    -0x1.11bb3a1fe6897p-6,
+    -0x1.144283356dc23p-6,
+    -0x1.16ccc597b919fp-6,
+    -0x1.195a0142e47acp-6,
+    -0x1.1bea3632faf11p-6,
+    -0x1.1e7d6464048f5p-6,
+    -0x1.21138bd1fb843p-6,
+    -0x1.23acac78cb1cap-6,
+    -0x1.2648c65458b1bp-6,
+    -0x1.28e7d9607abadp-6,
+    -0x1.2b89e598f7cf8p-6,
+    -0x1.2e2eeaf98d99ap-6,
+    -0x1.30d6e97defd71p-6,
+    -0x1.3381e121c9581p-6,
+    -0x1.362fd1e0b708fp-6,
+    -0x1.38e0bbb64aec5p-6,
+    -0x1.3b949e9e06271p-6,
+    -0x1.3e4b7a9362ec2p-6,
+    -0x1.41054f91cd8adp-6,
+    -0x1.43c21d94a56cbp-6,
+    -0x1.4681e4973e137p-6,
+    -0x1.4944a494e016fp-6,
+    -0x1.4c0a5d88cc1f5p-6,
+    -0x1.4ed30f6e37eabp-6,
+    -0x1.519eba404b53bp-6,
+    -0x1.546d5dfa1d571p-6,
+    -0x1.573efa96c0f9dp-6,
+    -0x1.5a1390113863p-6,
+    -0x1.5ceb1e6477d62p-6,
+    -0x1.5fc5a58b68acep-6,
+    -0x1.62a32580eb53p-6,
+    -0x1.65839e3fd2509p-6,
+    -0x1.68670fc2e83dcp-6,
+    -0x1.6b4d7a04edc7p-6,
+    -0x1.6e36dd008dc5p-6,
+    -0x1.712338b06a22cp-6,
+    -0x1.74128d0f1fd54p-6,
+    -0x1.7704da173af3ep-6,
+    -0x1.79fa1fc33daa2p-6,
+    -0x1.7cf25e0d9f39cp-6,
+    -0x1.7fed94f0c900ap-6,
+    -0x1.82ebc467137f2p-6,
+    -0x1.85ecec6ad23f8p-6,
+    -0x1.88f10cf646f08p-6,
+    -0x1.8bf82603af48fp-6,
+    -0x1.8f02378d3b1bcp-6,
+    -0x1.920f418d0a5c4p-6,
+    -0x1.951f43fd340ffp-6,
+    -0x1.98323ed7c2567p-6,
+    -0x1.9b483216ae71dp-6,
+    -0x1.9e611db3efa81p-6,
+    -0x1.a17d01a972557p-6,
+    -0x1.a49bddf10efe8p-6,
+    -0x1.a7bdb28491421p-6,
+    -0x1.aae27f5dbbd13p-6,
+    -0x1.ae0a447643791p-6,
+    -0x1.b13501c7d5172p-6,
+    -0x1.b462b74c139cfp-6,
+    -0x1.b79364fc8e246p-6,
+    -0x1.bac70ad2ced19p-6,
+    -0x1.bdfda8c84eeabp-6,
+    -0x1.c1373ed67ad06p-6,
+    -0x1.c473ccf6b6f35p-6,
+    -0x1.c7b353225cda7p-6,
+    -0x1.caf5d152ba24dp-6,
+    -0x1.ce3b47810f8bep-6,
+    -0x1.d183b5a68ee73p-6,
+    -0x1.d4cf1bbc60229p-6,
+    -0x1.d81d79bb9d46p-6,
+    -0x1.db6ecf9d566dcp-6,
+    -0x1.dec31d5a8dd25p-6,
+    -0x1.e21a62ec3cbe6p-6,
+    -0x1.e574a04b5192bp-6,
+    -0x1.e8d1d570adca7p-6,
+    -0x1.ec32025524fcfp-6,
+    -0x1.ef9526f183cf9p-6,
+    -0x1.f2fb433e850c3p-6,
+    -0x1.f6645734d696dp-6,
+    -0x1.f9d062cd1d659p-6,
+    -0x1.fd3f65ffef8cep-6,
+    -0x1.0058b062eb9cbp-5,
+    -0x1.0213298baa56p-5,
+    -0x1.03cf1e766c23p-5,
+    -0x1.058c8f1f67383p-5,
+    -0x1.074b7b82c9da5p-5,
+    -0x1.090be39cbcd94p-5,
+    -0x1.0acdc76961151p-5,
+    -0x1.0c9126e4cffccp-5,
+    -0x1.0e56020b20848p-5,
+    -0x1.101c58d8642bap-5,
+    -0x1.11e42b48a4818p-5,
+    -0x1.13ad7957e4a2bp-5,
+    -0x1.1578430221b7dp-5,
+    -0x1.174488435374ap-5,
+    -0x1.191249176c96fp-5,
+    -0x1.1ae1857a576dcp-5,
+    -0x1.1cb23d67fa501p-5,
+    -0x1.1e8470dc33262p-5,
+    -0x1.20581fd2dae24p-5,
+    -0x1.222d4a47c501cp-5,
+    -0x1.2403f036bf0e4p-5,
+    -0x1.25dc119b911c4p-5,
+    -0x1.27b5ae71fe4a7p-5,
+    -0x1.2990c6b5c04acp-5,
+    -0x1.2b6d5a628adb2p-5,
+    -0x1.2d4b69740f3e8p-5,
+    -0x1.2f2af3e5f6c82p-5,
+    -0x1.310bf9b3e15e5p-5,
+    -0x1.32ee7ad96c6c7p-5,
+    -0x1.34d2775230e6fp-5,
+    -0x1.36b7ef19bcd88p-5,
+    -0x1.389ee22b99d4dp-5,
+    -0x1.3a8750834f73bp-5,
+    -0x1.3c713a1c5d5dp-5,
+    -0x1.3e5c9ef239cbep-5,
+    -0x1.40497f0058017p-5,
+    -0x1.4237da42254aep-5,
+    -0x1.4427b0b30588bp-5,
+    -0x1.4619024e57a55p-5,
+    -0x1.480bcf0f75168p-5,
+    -0x1.4a0016f1b1dcdp-5,
+    -0x1.4bf5d9f05d822p-5,
+    -0x1.4ded1806bfa05p-5,
+    -0x1.4fe5d13017e18p-5,
+    -0x1.51e00567a1f7dp-5,
+    -0x1.53dbb4a8959d7p-5,
+    -0x1.55d8deee231bcp-5,
+    -0x1.57d78433734b5p-5,
+    -0x1.59d7a473a695bp-5,
+    -0x1.5bd93fa9db689p-5,
+    -0x1.5ddc55d127c2dp-5,
+    -0x1.5fe0e6e49ab16p-5,
+    -0x1.61e6f2df3dcc5p-5,
+    -0x1.63ee79bc1634cp-5,
+    -0x1.65f77b762219ep-5,
+    -0x1.6801f8085ab52p-5,
+    -0x1.6a0def6db1cf1p-5,
+    -0x1.6c1b61a1123e3p-5,
+    -0x1.6e2a4e9d5fe75p-5,
+    -0x1.703ab65d7bb53p-5,
+    -0x1.724c98dc3fa0cp-5,
+    -0x1.745ff6147eb11p-5,
+    -0x1.7674ce0104fb5p-5,
+    -0x1.788b209c9b9abp-5,
+    -0x1.7aa2ede204b89p-5,
+    -0x1.7cbc35cbfb8c6p-5,
+    -0x1.7ed6f855335ddp-5,
+    -0x1.80f335785980ap-5,
+    -0x1.8310ed3016d19p-5,
+    -0x1.85301f770cbc9p-5,
+    -0x1.8750cc47d63acp-5,
+    -0x1.8972f39d08d04p-5,
+    -0x1.8b969571358a5p-5,
+    -0x1.8dbbb1bee5866p-5,
+    -0x1.8fe2488099f1ep-5,
+    -0x1.920a59b0d0028p-5,
+    -0x1.9433e54a00f5fp-5,
+    -0x1.965eeb469d9afp-5,
+    -0x1.988b6ba10d539p-5,
+    -0x1.9ab96653b506ep-5,
+    -0x1.9ce8db58f5a3fp-5,
+    -0x1.9f19caab26ad2p-5,
+    -0x1.a14c344498b2cp-5,
+    -0x1.a380181f96d06p-5,
+    -0x1.a5b57636672bap-5,
+    -0x1.a7ec4e83477b3p-5,
+    -0x1.aa24a100717ep-5,
+    -0x1.ac5e6da81684p-5,
+    -0x1.ae99b47462e74p-5,
+    -0x1.b0d6755f7d8cfp-5,
+    -0x1.b314b06387665p-5,
+    -0x1.b554657a9af1dp-5,
+    -0x1.b795949ecabdfp-5,
+    -0x1.b9d83dca22e65p-5,
+    -0x1.bc1c60f6a992dp-5,
+    -0x1.be61fe1e5f764p-5,
+    -0x1.c0a9153b414b9p-5,
+    -0x1.c2f1a647455acp-5,
+    -0x1.c53bb13c587f3p-5,
+    -0x1.c7873614629ep-5,
+    -0x1.c9d434c94627cp-5,
+    -0x1.cc22ad54df98ep-5,
+    -0x1.ce729fb104fb1p-5,
+    -0x1.d0c40bd783e92p-5,
+    -0x1.d316f1c2230bfp-5,
+    -0x1.d56b516aa7107p-5,
+    -0x1.d7c12acacab7dp-5,
+    -0x1.da187ddc43cd5p-5,
+    -0x1.dc714a98c3a52p-5,
+    -0x1.decb90f9f2a5ep-5,
+    -0x1.e12750f9743ffp-5,
+    -0x1.e3848a90e5f02p-5,
+    -0x1.e5e33db9de412p-5,
+    -0x1.e8436a6defc5fp-5,
+    -0x1.eaa510a6a3a48p-5,
+    -0x1.ed08305d8087ep-5,
+    -0x1.ef6cc98c04ac5p-5,
+    -0x1.f1d2dc2ba75c4p-5,
+    -0x1.f43a6835d96f2p-5,
+    -0x1.f6a36da403cc8p-5,
+    -0x1.f90dec6f89683p-5,
+    -0x1.fb79e491c9bcfp-5,
+    -0x1.fde756041f4fap-5,
+    -0x1.002b205fed1d3p-4,
+    -0x1.0163525f23102p-4,
+    -0x1.029c40fc5399dp-4,
+    -0x1.03d5ec341fd56p-4,
+    -0x1.0510540324a69p-4,
+    -0x1.064b7865faf93p-4,
+    -0x1.078759593781ap-4,
+    -0x1.08c3f6d96df64p-4,
+    -0x1.0a0150e32dd62p-4,
+    -0x1.0b3f67730366cp-4,
+    -0x1.0c7e3a8578b24p-4,
+    -0x1.0dbdca1713cabp-4,
+    -0x1.0efe162457495p-4,
+    -0x1.103f1ea9c4c96p-4,
+    -0x1.1180e3a3d8f03p-4,
+    -0x1.12c3650f0d29ap-4,
+    -0x1.1406a2e7d6aa3p-4,
+    -0x1.154a9d2aa8e9dp-4,
+    -0x1.168f53d3f3e79p-4,
+    -0x1.17d4c6e024e81p-4,
+    -0x1.191af64ba734p-4,
+    -0x1.1a61e212e05f9p-4,
+    -0x1.1ba98a323481fp-4,
+    -0x1.1cf1eea6037b1p-4,
+    -0x1.1e3b0f6aa9f15p-4,
+    -0x1.1f84ec7c824fbp-4,
+    -0x1.20cf85d7e3882p-4,
+    -0x1.221adb7921d24p-4,
+    -0x1.2366ed5c8ceeap-4,
+    -0x1.24b3bb7e7223p-4,
+    -0x1.260145db1bfa9p-4,
+    -0x1.274f8c6ed206ap-4,
+    -0x1.289e8f35d89fp-4,
+    -0x1.29ee4e2c7023bp-4,
+    -0x1.2b3ec94ed5bbp-4,
+    -0x1.2c9000994391ap-4,
+    -0x1.2de1f407f09aap-4,
+    -0x1.2f34a39710501p-4,
+    -0x1.30880f42d46fbp-4,
+    -0x1.31dc37076a404p-4,
+    -0x1.33311ae0fbcf2p-4,
+    -0x1.3486bacbb0aeap-4,
+    -0x1.35dd16c3abbabp-4,
+    -0x1.37342ec50c95ep-4,
+    -0x1.388c02cbf0e6bp-4,
+    -0x1.39e492d473993p-4,
+    -0x1.3b3ddedaac9fap-4,
+    -0x1.3c97e6dab0b2ap-4,
+    -0x1.3df2aad090539p-4,
+    -0x1.3f4e2ab8584b4p-4,
+    -0x1.40aa668e13e59p-4,
+    -0x1.42075e4dcab5fp-4,
+    -0x1.436511f380186p-4,
+    -0x1.44c3817b342f8p-4,
+    -0x1.4622ace0e423fp-4,
+    -0x1.478294208a63ep-4,
+    -0x1.48e337361ee29p-4,
+    -0x1.4a44961d94dcdp-4,
+    -0x1.4ba6b0d2dc56p-4,
+    -0x1.4d098751e3558p-4,
+    -0x1.4e6d199694a95p-4,
+    -0x1.4fd1679cd6a88p-4,
+    -0x1.513671608dedbp-4,
+    -0x1.529c36dd9b9a7p-4,
+    -0x1.5402b80fdd18p-4,
+    -0x1.5569f4f32b58ap-4,
+    -0x1.56d1ed835d923p-4,
+    -0x1.583aa1bc47819p-4,
+    -0x1.59a41199b9aa3p-4,
+    -0x1.5b0e3d1781561p-4,
+    -0x1.5c79243168565p-4,
+    -0x1.5de4c6e336bf8p-4,
+    -0x1.5f512528b02f5p-4,
+    -0x1.60be3efd950ap-4,
+    -0x1.622c145da338dp-4,
+    -0x1.639aa54493eeap-4,
+    -0x1.6509f1ae1ce56p-4,
+    -0x1.6679f995f11c9p-4,
+    -0x1.67eabcf7c197bp-4,
+    -0x1.695c3bcf3c20ep-4,
+    -0x1.6ace761809cbbp-4,
+    -0x1.6c416bcdd130fp-4,
+    -0x1.6db51cec362edp-4,
+    -0x1.6f29896ed92abp-4,
+    -0x1.709eb15156527p-4,
+    -0x1.7214948f48968p-4,
+    -0x1.738b332445b1ep-4,
+    -0x1.75028d0bdfe6ap-4,
+    -0x1.767aa241a73b6p-4,
+    -0x1.77f372c127fe6p-4,
+    -0x1.796cfe85eb445p-4,
+    -0x1.7ae7458b77677p-4,
+    -0x1.7c6247cd5007ap-4,
+    -0x1.7dde0546f3cedp-4,
+    -0x1.7f5a7df3e069p-4,
+    -0x1.80d7b1cf8f8a2p-4,
+    -0x1.8255a0d575716p-4,
+    -0x1.83d44b0105205p-4,
+    -0x1.8553b04dada0cp-4,
+    -0x1.86d3d0b6db817p-4,
+    -0x1.8854ac37f817ap-4,
+    -0x1.89d642cc6841dp-4,
+    -0x1.8b58946f8ee26p-4,
+    -0x1.8cdba11ccaa46p-4,
+    -0x1.8e5f68cf7738cp-4,
+    -0x1.8fe3eb82ec58dp-4,
+    -0x1.9169293280802p-4,
+    -0x1.92ef21d985347p-4,
+    -0x1.9475d57349411p-4,
+    -0x1.95fd43fb18776p-4,
+    -0x1.97856d6c3ab0cp-4,
+    -0x1.990e51c1f48d4p-4,
+    -0x1.9a97f0f787b2fp-4,
+    -0x1.9c224b0832cddp-4,
+    -0x1.9dad5fef31509p-4,
+    -0x1.9f392fa7bab5fp-4,
+    -0x1.a0c5ba2d037ecp-4,
+    -0x1.a252ff7a3d713p-4,
+    -0x1.a3e0ff8a955ddp-4,
+    -0x1.a56fba5936d78p-4,
+    -0x1.a6ff2fe148fa4p-4,
+    -0x1.a88f601deeea4p-4,
+    -0x1.aa204b0a4a0f1p-4,
+    -0x1.abb1f0a177596p-4,
+    -0x1.ad4450de90807p-4,
+    -0x1.aed76bbcad002p-4,
+    -0x1.b06b4136e09bdp-4,
+    -0x1.b1ffd1483b9dep-4,
+    -0x1.b3951bebca986p-4,
+    -0x1.b52b211c97e1dp-4,
+    -0x1.b6c1e0d5aa975p-4,
+    -0x1.b8595b12051f9p-4,
+    -0x1.b9f18fcca726cp-4,
+    -0x1.bb8a7f008ce03p-4,
+    -0x1.bd2428a8b0045p-4,
+    -0x1.bebe8cc006538p-4,
+    -0x1.c059ab4181963p-4,
+    -0x1.c1f5842811597p-4,
+    -0x1.c392176ea2306p-4,
+    -0x1.c52f65101cb62p-4,
+    -0x1.c6cd6d07664c7p-4,
+    -0x1.c86c2f4f615bp-4,
+    -0x1.ca0babe2ed103p-4,
+    -0x1.cbabe2bce4a26p-4,
+    -0x1.cd4cd3d8200e9p-4,
+    -0x1.ceee7f2f7457cp-4,
+    -0x1.d090e4bdb3478p-4,
+    -0x1.d234047daaaf7p-4,
+    -0x1.d3d7de6a2527dp-4,
+    -0x1.d57c727dea4edp-4,
+    -0x1.d721c0b3be895p-4,
+    -0x1.d8c7c90662443p-4,
+    -0x1.da6e8b7092f26p-4,
+    -0x1.dc1607ed0b8bdp-4,
+    -0x1.ddbe3e7682919p-4,
+    -0x1.df672f07ac09dp-4,
+    -0x1.e110d99b3881bp-4,
+    -0x1.e2bb3e2bd351p-4,
+    -0x1.e4665cb42692p-4,
+    -0x1.e612352ed8279p-4,
+    -0x1.e7bec7968abb2p-4,
+    -0x1.e96c13e5de7b2p-4,
+    -0x1.eb1a1a176f5ebp-4,
+    -0x1.ecc8da25d7215p-4,
+    -0x1.ee78540baa493p-4,
+    -0x1.f02887c37ae19p-4,
+    -0x1.f1d97547d8ba5p-4,
+    -0x1.f38b1c934f2c3p-4,
+    -0x1.f53d7da066961p-4,
+    -0x1.f6f09869a31f7p-4,
+    -0x1.f8a46ce986f3dp-4,
+    -0x1.fa58fb1a8f885p-4,
+    -0x1.fc0e42f7365a2p-4,
+    -0x1.fdc44479f3698p-4,
+    -0x1.ff7aff9d3afe2p-4,
+    -0x1.00993a2dbeb3fp-3,
+    -0x1.01755157941e1p-3,
+    -0x1.0251c549526c7p-3,
+    -0x1.032e96002d6fdp-3,
+    -0x1.040bc37956fcep-3,
+    -0x1.04e94db1fe8d5p-3,
+    -0x1.05c734a752bc7p-3,
+    -0x1.06a5785680692p-3,
+    -0x1.078418bcb2961p-3,
+    -0x1.086315d711cafp-3,
+    -0x1.09426fa2c5322p-3,
+    -0x1.0a22261cf3773p-3,
+    -0x1.0b023942c06b8p-3,
+    -0x1.0be2a9114ea2cp-3,
+    -0x1.0cc37585be952p-3,
+    -0x1.0da49e9d2f7d3p-3,
+    -0x1.0e862454bf18bp-3,
+    -0x1.0f6806a989097p-3,
+    -0x1.104a4598a6f57p-3,
+    -0x1.112ce11f31454p-3,
+    -0x1.120fd93a3ea4dp-3,
+    -0x1.12f32de6e482cp-3,
+    -0x1.13d6df223631ep-3,
+    -0x1.14baece944a9dp-3,
+    -0x1.159f57392004p-3,
+    -0x1.16841e0ed69d5p-3,
+    -0x1.1769416774f67p-3,
+    -0x1.184ec1400554cp-3,
+    -0x1.19349d95911f3p-3,
+    -0x1.1a1ad6651fc0cp-3,
+    -0x1.1b016babb6692p-3,
+    -0x1.1be85d6659a92p-3,
+    -0x1.1ccfab920b96ap-3,
+    -0x1.1db7562bccaaep-3,
+    -0x1.1e9f5d309b631p-3,
+    -0x1.1f87c09d75bd7p-3,
+    -0x1.2070806f575dp-3,
+    -0x1.21599ca33969cp-3,
+    -0x1.22431536142d9p-3,
+    -0x1.232cea24de35dp-3,
+    -0x1.24171b6c8c33ap-3,
+    -0x1.2501a90a109ccp-3,
+    -0x1.25ec92fa5d089p-3,
+    -0x1.26d7d93a6112ap-3,
+    -0x1.27c37bc709fb2p-3,
+    -0x1.28af7a9d44242p-3,
+    -0x1.299bd5b9fa334p-3,
+    -0x1.2a888d1a14f1dp-3,
+    -0x1.2b75a0ba7acep-3,
+    -0x1.2c63109810f88p-3,
+    -0x1.2d50dcafbb44bp-3,
+    -0x1.2e3f04fe5bc99p-3,
+    -0x1.2f2d8980d243p-3,
+    -0x1.301c6a33fd2f3p-3,
+    -0x1.310ba714b96fdp-3,
+    -0x1.31fb401fe1aaep-3,
+    -0x1.32eb35524f68dp-3,
+    -0x1.33db86a8d9b72p-3,
+    -0x1.34cc342056a52p-3,
+    -0x1.35bd3db59a662p-3,
+    -0x1.36aea36577317p-3,
+    -0x1.37a0652cbe00cp-3,
+    -0x1.389283083dd2p-3,
+    -0x1.3984fcf4c3a7p-3,
+    -0x1.3a77d2ef1b246p-3,
+    -0x1.3b6b04f40dd3p-3,
+    -0x1.3c5e9300641e3p-3,
+    -0x1.3d527d10e3f62p-3,
+    -0x1.3e46c322524d1p-3,
+    -0x1.3f3b653172392p-3,
+    -0x1.4030633b04d44p-3,
+    -0x1.4125bd3bc9db6p-3,
+    -0x1.421b73307ecffp-3,
+    -0x1.43118515dfd61p-3,
+    -0x1.4407f2e8a716p-3,
+    -0x1.44febca58cbbfp-3,
+    -0x1.45f5e24947b6ap-3,
+    -0x1.46ed63d08cf8fp-3,
+    -0x1.47e541380f59ep-3,
+    -0x1.48dd7a7c8033ap-3,
+    -0x1.49d60f9a8fe24p-3,
+    -0x1.4acf008eed254p-3,
+    -0x1.4bc84d5644411p-3,
+    -0x1.4cc1f5ed3f9dfp-3,
+    -0x1.4dbbfa5087e7ap-3,
+    -0x1.4eb65a7cc4ebap-3,
+    -0x1.4fb1166e9bfc9p-3,
+    -0x1.50ac2e22b011dp-3,
+    -0x1.51a7a195a3a3cp-3,
+    -0x1.52a370c4172eep-3,
+    -0x1.539f9baaa992dp-3,
+    -0x1.549c2245f6f4dp-3,
+    -0x1.5599049299fd3p-3,
+    -0x1.5696428d2b97cp-3,
+    -0x1.5793dc324372cp-3,
+    -0x1.5891d17e77606p-3,
+    -0x1.5990226e5b765p-3,
+    -0x1.5a8ecefe81edfp-3,
+    -0x1.5b8dd72b7ba38p-3,
+    -0x1.5c8d3af1d737bp-3,
+    -0x1.5d8cfa4e21ce4p-3,
+    -0x1.5e8d153ce64fap-3,
+    -0x1.5f8d8bbaae46dp-3,
+    -0x1.608e5dc401827p-3,
+    -0x1.618f8b5566543p-3,
+    -0x1.6291146b6073p-3,
+    -0x1.6392f9027278p-3,
+    -0x1.649539171ce0cp-3,
+    -0x1.6597d4a5deed5p-3,
+    -0x1.669acbab3640fp-3,
+    -0x1.679e1e239e23dp-3,
+    -0x1.68a1cc0b9060fp-3,
+    -0x1.69a5d55f84a7ep-3,
+    -0x1.6aaa3a1bf18a3p-3,
+    -0x1.6baefa3d4afeep-3,
+    -0x1.6cb415c0037ffp-3,
+    -0x1.6db98ca08bcbp-3,
+    -0x1.6ebf5edb53601p-3,
+    -0x1.6fc58c6cc7c33p-3,
+    -0x1.70cc1551545cdp-3,
+    -0x1.71d2f98563186p-3,
+    -0x1.72da39055ca3cp-3,
+    -0x1.73e1d3cda751bp-3,
+    -0x1.74e9c9daa778fp-3,
+    -0x1.75f21b28bf54ap-3,
+    -0x1.76fac7b450a0bp-3,
+    -0x1.7803cf79babe1p-3,
+    -0x1.790d32755a72fp-3,
+    -0x1.7a16f0a38b47ep-3,
+    -0x1.7b210a00a7687p-3,
+    -0x1.7c2b7e8907635p-3,
+    -0x1.7d364e3901ab8p-3,
+    -0x1.7e41790cea985p-3,
+    -0x1.7f4cff0115041p-3,
+    -0x1.8058e011d26bep-3,
+    -0x1.81651c3b71b23p-3,
+    -0x1.8271b37a409bap-3,
+    -0x1.837ea5ca8ad13p-3,
+    -0x1.848bf3289a7edp-3,
+    -0x1.85999b90b7b4dp-3,
+    -0x1.86a79eff2946p-3,
+    -0x1.87b5fd70332aep-3,
+    -0x1.88c4b6e0189dbp-3,
+    -0x1.89d3cb4b1abcdp-3,
+    -0x1.8ae33aad78ca6p-3,
+    -0x1.8bf30503700cap-3,
+    -0x1.8d032a493c2d1p-3,
+    -0x1.8e13aa7b17389p-3,
+    -0x1.8f248595393fdp-3,
+    -0x1.9035bb93d8b7p-3,
+    -0x1.91474c732a757p-3,
+    -0x1.9259382f6136ep-3,
+    -0x1.936b7ec4ad9b2p-3,
+    -0x1.947e202f3ec55p-3,
+    -0x1.95911c6b427b2p-3,
+    -0x1.96a47374e3e7ap-3,
+    -0x1.97b825484d182p-3,
+    -0x1.98cc31e1a5de8p-3,
+    -0x1.99e0993d14306p-3,
+    -0x1.9af55b56bc273p-3,
+    -0x1.9c0a782ac09efp-3,
+    -0x1.9d1fefb542779p-3,
+    -0x1.9e35c1f260755p-3,
+    -0x1.9f4beede37bfdp-3,
+    -0x1.a0627674e3e1ep-3,
+    -0x1.a17958b27e6a6p-3,
+    -0x1.a29095931f4b7p-3,
+    -0x1.a3a82d12dcda9p-3,
+    -0x1.a4c01f2dcb712p-3,
+    -0x1.a5d86bdffd8c7p-3,
+    -0x1.a6f11325834e8p-3,
+    -0x1.a80a14fa6b9bfp-3,
+    -0x1.a923715ac3bc8p-3,
+    -0x1.aa3d2842967d3p-3,
+    -0x1.ab5739aded0e1p-3,
+    -0x1.ac71a598cf61fp-3,
+    -0x1.ad8c6bff43103p-3,
+    -0x1.aea78cdd4c13ap-3,
+    -0x1.afc3082eed298p-3,
+    -0x1.b0deddf026b3fp-3,
+    -0x1.b1fb0e1cf738cp-3,
+    -0x1.b31798b15b41ep-3,
+    -0x1.b4347da94dbc8p-3,
+    -0x1.b551bd00c7d94p-3,
+    -0x1.b66f56b3c06dcp-3,
+    -0x1.b78d4abe2cd28p-3,
+    -0x1.b8ab991c00249p-3,
+    -0x1.b9ca41c92c437p-3,
+    -0x1.bae944c1a1721p-3,
+    -0x1.bc08a2014d786p-3,
+    -0x1.bd2859841c819p-3,
+    -0x1.be486b45f97b5p-3,
+    -0x1.bf68d742ccf83p-3,
+    -0x1.c0899d767dce3p-3,
+    -0x1.c1aabddcf136bp-3,
+    -0x1.c2cc38720a6fp-3,
+    -0x1.c3ee0d31aaf8p-3,
+    -0x1.c5103c17b256ap-3,
+    -0x1.c632c51ffe339p-3,
+    -0x1.c755a84669bcap-3,
+    -0x1.c878e586ce82dp-3,
+    -0x1.c99c7cdd05193p-3,
+    -0x1.cac06e44e4761p-3,
+    -0x1.cbe4b9ba40f51p-3,
+    -0x1.cd095f38ecf5ep-3,
+    -0x1.ce2e5ebcb9f9fp-3,
+    -0x1.cf53b84177277p-3,
+    -0x1.d0796bc2f1497p-3,
+    -0x1.d19f793cf34ebp-3,
+    -0x1.d2c5e0ab4728p-3,
+    -0x1.d3eca209b42b8p-3,
+    -0x1.d513bd5400522p-3,
+    -0x1.d63b3285eff8p-3,
+    -0x1.d763019b44de9p-3,
+    -0x1.d88b2a8fbecb5p-3,
+    -0x1.d9b3ad5f1ca5ap-3,
+    -0x1.dadc8a051af97p-3,
+    -0x1.dc05c07d74177p-3,
+    -0x1.dd2f50c3e0b37p-3,
+    -0x1.de593ad418243p-3,
+    -0x1.df837ea9d082cp-3,
+    -0x1.e0ae1c40bd4dap-3,
+    -0x1.e1d913948f68ap-3,
+    -0x1.e30464a0f65a5p-3,
+    -0x1.e4300f619fccfp-3,
+    -0x1.e55c13d237ae6p-3,
+    -0x1.e68871ee68106p-3,
+    -0x1.e7b529b1d9a74p-3,
+    -0x1.e8e23b1832cc4p-3,
+    -0x1.ea0fa61d17fc6p-3,
+    -0x1.eb3d6abc2bb8ap-3,
+    -0x1.ec6b88f10ea5ep-3,
+    -0x1.ed9a00b75f4d3p-3,
+    -0x1.eec8d20abb793p-3,
+    -0x1.eff7fce6be1a5p-3,
+    -0x1.f127814700c3cp-3,
+    -0x1.f2575f271a8dcp-3,
+    -0x1.f3879682a172cp-3,
+    -0x1.f4b8275529122p-3,
+    -0x1.f5e9119a42ef8p-3,
+    -0x1.f71a554d7f313p-3,
+    -0x1.f84bf26a6bc21p-3,
+    -0x1.f97de8ec952fdp-3,
+    -0x1.fab038cf85ec7p-3,
+    -0x1.fbe2e20ec60ebp-3,
+    -0x1.fd15e4a5dc8fap-3,
+    -0x1.fe4940904dadep-3,
+    -0x1.ff7cf5c99bcbbp-3,
+    -0x1.00588226a3f72p-2,
+    -0x1.00f2b60b68eeap-2,
+    -0x1.018d1690db828p-2,
+    -0x1.0227a3b4b97afp-2,
+    -0x1.02c25d74bfa22p-2,
+    -0x1.035d43cea9d4p-2,
+    -0x1.03f856c032bfp-2,
+    -0x1.049396471463p-2,
+    -0x1.052f026107d1bp-2,
+    -0x1.05ca9b0bc51ecp-2,
+    -0x1.0666604503109p-2,
+    -0x1.0702520a781e2p-2,
+    -0x1.079e7059d9a0cp-2,
+    -0x1.083abb30dbc41p-2,
+    -0x1.08d7328d31a5fp-2,
+    -0x1.0973d66c8d85ep-2,
+    -0x1.0a10a6cca0b56p-2,
+    -0x1.0aada3ab1bd75p-2,
+    -0x1.0b4acd05ae60fp-2,
+    -0x1.0be822da06d96p-2,
+    -0x1.0c85a525d2c9ep-2,
+    -0x1.0d2353e6beed2p-2,
+    -0x1.0dc12f1a772fap-2,
+    -0x1.0e5f36bea6602p-2,
+    -0x1.0efd6ad0f5fffp-2,
+    -0x1.0f9bcb4f0ec21p-2,
+    -0x1.103a583698bacp-2,
+    -0x1.10d911853ad0bp-2,
+    -0x1.1177f7389b1c3p-2,
+    -0x1.1217094e5f06ep-2,
+    -0x1.12b647c42a8d7p-2,
+    -0x1.1355b297a0ae7p-2,
+    -0x1.13f549c6637a5p-2,
+    -0x1.14950d4e1453p-2,
+    -0x1.1534fd2c537cap-2,
+    -0x1.15d5195ec07cfp-2,
+    -0x1.167561e2f9abfp-2,
+    -0x1.1715d6b69c837p-2,
+    -0x1.17b677d7458f4p-2,
+    -0x1.185745428ffddp-2,
+    -0x1.18f83ef6167eap-2,
+    -0x1.199964ef72d31p-2,
+    -0x1.1a3ab72c3d9edp-2,
+    -0x1.1adc35aa0e67dp-2,
+    -0x1.1b7de0667bb61p-2,
+    -0x1.1c1fb75f1b62dp-2,
+    -0x1.1cc1ba918229cp-2,
+    -0x1.1d63e9fb4417ep-2,
+    -0x1.1e064599f42c6p-2,
+    -0x1.1ea8cd6b2419p-2,
+    -0x1.1f4b816c64a17p-2,
+    -0x1.1fee619b45ab2p-2,
+    -0x1.20916df5568cap-2,
+    -0x1.2134a678250fcp-2,
+    -0x1.21d80b213e3fbp-2,
+    -0x1.227b9bee2e596p-2,
+    -0x1.231f58dc805c4p-2,
+    -0x1.23c341e9be599p-2,
+    -0x1.2467571371749p-2,
+    -0x1.250b98572231bp-2,
+    -0x1.25b005b257f7bp-2,
+    -0x1.26549f2298b05p-2,
+    -0x1.26f964a56986dp-2,
+    -0x1.279e56384ec83p-2,
+    -0x1.284373d8cc12fp-2,
+    -0x1.28e8bd8463c7fp-2,
+    -0x1.298e3338973a6p-2,
+    -0x1.2a33d4f2e70ebp-2,
+    -0x1.2ad9a2b0d2abep-2,
+    -0x1.2b7f9c6fd86b1p-2,
+    -0x1.2c25c22d75f6dp-2,
+    -0x1.2ccc13e727dbfp-2,
+    -0x1.2d72919a69e8cp-2,
+    -0x1.2e193b44b69e2p-2,
+    -0x1.2ec010e3873fap-2,
+    -0x1.2f67127454a1ap-2,
+    -0x1.300e3ff4969a8p-2,
+    -0x1.30b59961c3c34p-2,
+    -0x1.315d1eb951f63p-2,
+    -0x1.3204cff8b5c07p-2,
+    -0x1.32acad1d62719p-2,
+    -0x1.3354b624caea1p-2,
+    -0x1.33fceb0c610c7p-2,
+    -0x1.34a54bd1957dbp-2,
+    -0x1.354dd871d8246p-2,
+    -0x1.35f690ea97b97p-2,
+    -0x1.369f753941f7cp-2,
+    -0x1.3748855b436ccp-2,
+    -0x1.37f1c14e0807p-2,
+    -0x1.389b290efaf6ap-2,
+    -0x1.3944bc9b863e2p-2,
+    -0x1.39ee7bf11272fp-2,
+    -0x1.3a98670d07ab7p-2,
+    -0x1.3b427deccd1p-2,
+    -0x1.3becc08dc89b5p-2,
+    -0x1.3c972eed5efacp-2,
+    -0x1.3d41c908f3ed8p-2,
+    -0x1.3dec8eddea35p-2,
+    -0x1.3e978069a3d3ep-2,
+    -0x1.3f429da9821e5p-2,
+    -0x1.3fede69ae4fb7p-2,
+    -0x1.40995b3b2b546p-2,
+    -0x1.4144fb87b3241p-2,
+    -0x1.41f0c77dd9b6ep-2,
+    -0x1.429cbf1afb0bdp-2,
+    -0x1.4348e25c71d48p-2,
+    -0x1.43f5313f98044p-2,
+    -0x1.44a1abc1c6706p-2,
+    -0x1.454e51e0552ffp-2,
+    -0x1.45fb23989b2c4p-2,
+    -0x1.46a820e7ee708p-2,
+    -0x1.475549cba4396p-2,
+    -0x1.48029e4110a6p-2,
+    -0x1.48b01e458697dp-2,
+    -0x1.495dc9d65832p-2,
+    -0x1.4a0ba0f0d64a4p-2,
+    -0x1.4ab9a3925078dp-2,
+    -0x1.4b67d1b815e6dp-2,
+    -0x1.4c162b5f74bf6p-2,
+    -0x1.4cc4b085b9f02p-2,
+    -0x1.4d73612831a86p-2,
+    -0x1.4e223d4426e9ap-2,
+    -0x1.4ed144d6e3b77p-2,
+    -0x1.4f8077ddb0c81p-2,
+    -0x1.502fd655d5d3ep-2,
+    -0x1.50df603c9a141p-2,
+    -0x1.518f158f4364ap-2,
+    -0x1.523ef64b16b39p-2,
+    -0x1.52ef026d58108p-2,
+    -0x1.539f39f34a3dep-2,
+    -0x1.544f9cda2ef03p-2,
+    -0x1.55002b1f471d6p-2,
+    -0x1.55b0e4bfd25e5p-2,
+    -0x1.5661c9b90f8d4p-2,
+    -0x1.5712da083c869p-2,
+    -0x1.57c415aa9608dp-2,
+    -0x1.58757c9d57c4ap-2,
+    -0x1.59270eddbc8c9p-2,
+    -0x1.59d8cc68fe353p-2,
+    -0x1.5a8ab53c55a4ep-2,
+    -0x1.5b3cc954fa946p-2,
+    -0x1.5bef08b023de6p-2,
+    -0x1.5ca1734b06d08p-2,
+    -0x1.5d540922d829bp-2,
+    -0x1.5e06ca34cbaacp-2,
+    -0x1.5eb9b67e13c73p-2,
+    -0x1.5f6ccdfbe2047p-2,
+    -0x1.602010ab66e9fp-2,
+    -0x1.60d37e89d220fp-2,
+    -0x1.618717945244bp-2,
+    -0x1.623adbc814d2ep-2,
+    -0x1.62eecb22462b5p-2,
+    -0x1.63a2e5a011a02p-2,
+    -0x1.64572b3ea1b4fp-2,
+    -0x1.650b9bfb1fef7p-2,
+    -0x1.65c037d2b4486p-2,
+    -0x1.6674fec286597p-2,
+    -0x1.6729f0c7bc9e8p-2,
+    -0x1.67df0ddf7c65dp-2,
+    -0x1.68945606e9d01p-2,
+    -0x1.6949c93b27c06p-2,
+    -0x1.69ff6779586b5p-2,
+    -0x1.6ab530be9d077p-2,
+    -0x1.6b6b250815adbp-2,
+    -0x1.6c214452e1592p-2,
+    -0x1.6cd78e9c1df72p-2,
+    -0x1.6d8e03e0e896ap-2,
+    -0x1.6e44a41e5d29p-2,
+    -0x1.6efb6f519671ep-2,
+    -0x1.6fb26577ae866p-2,
+    -0x1.7069868dbdbf2p-2,
+    -0x1.7120d290dbe5ep-2,
+    -0x1.71d8497e1ff6p-2,
+    -0x1.728feb529f8dcp-2,
+    -0x1.7347b80b6fac8p-2,
+    -0x1.73ffafa5a3f47p-2,
+    -0x1.74b7d21e4efap-2,
+    -0x1.75701f728214p-2,
+    -0x1.7628979f4dab3p-2,
+    -0x1.76e13aa1c12a6p-2,
+    -0x1.779a0876eafe6p-2,
+    -0x1.7853011bd836cp-2,
+    -0x1.790c248d95543p-2,
+    -0x1.79c572c92da9dp-2,
+    -0x1.7a7eebcbab6dp-2,
+    -0x1.7b388f9217e51p-2,
+    -0x1.7bf25e197b0bep-2,
+    -0x1.7cac575edbbdap-2,
+    -0x1.7d667b5f3fe87p-2,
+    -0x1.7e20ca17ac4ccp-2,
+    -0x1.7edb438524ec9p-2,
+    -0x1.7f95e7a4ac9c4p-2,
+    -0x1.8050b67345422p-2,
+    -0x1.810bafedefa6cp-2,
+    -0x1.81c6d411ab357p-2,
+    -0x1.828222db763bcp-2,
+    -0x1.833d9c484e38fp-2,
+    -0x1.83f940552fcep-2,
+    -0x1.84b50eff164eap-2,
+    -0x1.85710842fc009p-2,
+    -0x1.862d2c1dda6b2p-2,
+    -0x1.86e97a8ca9b86p-2,
+    -0x1.87a5f38c6153fp-2,
+    -0x1.88629719f78bbp-2,
+    -0x1.891f653261209p-2,
+    -0x1.89dc5dd291d5cp-2,
+    -0x1.8a9980f77c801p-2,
+    -0x1.8b56ce9e13261p-2,
+    -0x1.8c1446c346418p-2,
+    -0x1.8cd1e964059d8p-2,
+    -0x1.8d8fb67d3fb7cp-2,
+    -0x1.8e4dae0be22fep-2,
+    -0x1.8f0bd00cd9482p-2,
+    -0x1.8fca1c7d10747p-2,
+    -0x1.9088935971eb4p-2,
+    -0x1.9147349ee6c55p-2,
+    -0x1.9206004a573d2p-2,
+    -0x1.92c4f658aa7f6p-2,
+    -0x1.938416c6c69afp-2,
+    -0x1.944361919080fp-2,
+    -0x1.9502d6b5ec14cp-2,
+    -0x1.95c27630bc4bap-2,
+    -0x1.96823ffee2dd4p-2,
+    -0x1.9742341d40836p-2,
+    -0x1.98025288b4aa6p-2,
+    -0x1.98c29b3e1d913p-2,
+    -0x1.99830e3a58788p-2,
+    -0x1.9a43ab7a41d2dp-2,
+    -0x1.9b0472fab485cp-2,
+    -0x1.9bc564b88ad83p-2,
+    -0x1.9c8680b09dd38p-2,
+    -0x1.9d47c6dfc533cp-2,
+    -0x1.9e093742d7f67p-2,
+    -0x1.9ecad1d6abdbcp-2,
+    -0x1.9f8c96981586p-2,
+    -0x1.a04e8583e8a96p-2,
+    -0x1.a1109e96f7acdp-2,
+    -0x1.a1d2e1ce13d97p-2,
+    -0x1.a2954f260d9a4p-2,
+    -0x1.a357e69bb44c4p-2,
+    -0x1.a41aa82bd61efp-2,
+    -0x1.a4dd93d340045p-2,
+    -0x1.a5a0a98ebe2p-2,
+    -0x1.a663e95b1b08dp-2,
+    -0x1.a72753352018p-2,
+    -0x1.a7eae7199647bp-2,
+    -0x1.a8aea5054505p-2,
+    -0x1.a9728cf4f2af6p-2,
+    -0x1.aa369ee564886p-2,
+    -0x1.aafadad35e944p-2,
+    -0x1.abbf40bba4189p-2,
+    -0x1.ac83d09af72d8p-2,
+    -0x1.ad488a6e18edp-2,
+    -0x1.ae0d6e31c923ep-2,
+    -0x1.aed27be2c6714p-2,
+    -0x1.af97b37dce568p-2,
+    -0x1.b05d14ff9d375p-2,
+    -0x1.b122a064ee599p-2,
+    -0x1.b1e855aa7bf57p-2,
+    -0x1.b2ae34ccff54dp-2,
+    -0x1.b3743dc930746p-2,
+    -0x1.b43a709bc633p-2,
+    -0x1.b500cd4176817p-2,
+    -0x1.b5c753b6f6032p-2,
+    -0x1.b68e03f8f83ddp-2,
+    -0x1.b754de042fc9p-2,
+    -0x1.b81be1d54defp-2,
+    -0x1.b8e30f6902bcap-2,
+    -0x1.b9aa66bbfd012p-2,
+    -0x1.ba71e7caeacd4p-2,
+    -0x1.bb39929278e48p-2,
+    -0x1.bc01670f52bdp-2,
+    -0x1.bcc9653e230e5p-2,
+    -0x1.bd918d1b93627p-2,
+    -0x1.be59dea44c358p-2,
+    -0x1.bf2259d4f496ap-2,
+    -0x1.bfeafeaa32b6ap-2,
+    -0x1.c0b3cd20ab495p-2,
+    -0x1.c17cc53501e4dp-2,
+    -0x1.c245e6e3d970ap-2,
+    -0x1.c30f3229d3a6cp-2,
+    -0x1.c3d8a70391233p-2,
+    -0x1.c4a2456db0f56p-2,
+    -0x1.c56c0d64d1ad9p-2,
+    -0x1.c635fee5903f7p-2,
+    -0x1.c70019ec88416p-2,
+    -0x1.c7ca5e76541c3p-2,
+    -0x1.c894cc7f8da9bp-2,
+    -0x1.c95f6404cd66bp-2,
+    -0x1.ca2a2502aab21p-2,
+    -0x1.caf50f75bb8d9p-2,
+    -0x1.cbc0235a954c6p-2,
+    -0x1.cc8b60adcbb4cp-2,
+    -0x1.cd56c76bf1aebp-2,
+    -0x1.ce22579198c51p-2,
+    -0x1.ceee111b5105bp-2,
+    -0x1.cfb9f405a9ef9p-2,
+    -0x1.d086004d31b45p-2,
+    -0x1.d15235ee75089p-2,
+    -0x1.d21e94e5fff26p-2,
+    -0x1.d2eb1d305d0abp-2,
+    -0x1.d3b7ceca166b8p-2,
+    -0x1.d484a9afb492p-2,
+    -0x1.d551adddbe9e4p-2,
+    -0x1.d61edb50ba62dp-2,
+    -0x1.d6ec32052cc44p-2,
+    -0x1.d7b9b1f799898p-2,
+    -0x1.d8875b24833bdp-2,
+    -0x1.d9552d886b865p-2,
+    -0x1.da23291fd2874p-2,
+    -0x1.daf14de737ae4p-2,
+    -0x1.dbbf9bdb18ee1p-2,
+    -0x1.dc8e12f7f2cc3p-2,
+    -0x1.dd5cb33a40e02p-2,
+    -0x1.de2b7c9e7db38p-2,
+    -0x1.defa6f2122927p-2,
+    -0x1.dfc98abea74c2p-2,
+    -0x1.e098cf7382f13p-2,
+    -0x1.e1683d3c2b945p-2,
+    -0x1.e237d415161a9p-2,
+    -0x1.e30793fab5fcp-2,
+    -0x1.e3d77ce97d536p-2,
+    -0x1.e4a78edddd3d8p-2,
+    -0x1.e577c9d44589bp-2,
+    -0x1.e6482dc924e9cp-2,
+    -0x1.e718bab8e9116p-2,
+    -0x1.e7e9709ffe375p-2,
+    -0x1.e8ba4f7acfa43p-2,
+    -0x1.e98b5745c792dp-2,
+    -0x1.ea5c87fd4e61cp-2,
+    -0x1.eb2de19dcbd0dp-2,
+    -0x1.ebff6423a6a1dp-2,
+    -0x1.ecd10f8b44298p-2,
+    -0x1.eda2e3d1084fap-2,
+    -0x1.ee74e0f155dep-2,
+    -0x1.ef4706e88ea0ap-2,
+    -0x1.f01955b312e66p-2,
+    -0x1.f0ebcd4d41f07p-2,
+    -0x1.f1be6db379d24p-2,
+    -0x1.f29136e217c13p-2,
+    -0x1.f36428d57755bp-2,
+    -0x1.f4374389f34a3p-2,
+    -0x1.f50a86fbe50b8p-2,
+    -0x1.f5ddf327a4b95p-2,
+    -0x1.f6b188098995p-2,
+    -0x1.f785459de9434p-2,
+    -0x1.f8592be1186abp-2,
+    -0x1.f92d3acf6a154p-2,
+    -0x1.fa017265307eap-2,
+    -0x1.fad5d29ebcb4bp-2,
+    -0x1.fbaa5b785e28cp-2,
+    -0x1.fc7f0cee63bd4p-2,
+    -0x1.fd53e6fd1a982p-2,
+    -0x1.fe28e9a0cef12p-2,
+    -0x1.fefe14d5cbb2cp-2,
+    -0x1.ffd368985a7a3p-2,
+    -0x1.0054727262033p-1,
+    -0x1.00bf44dba7b4cp-1,
+    -0x1.012a2b862153fp-1,
+    -0x1.0195266ff15c3p-1,
+    -0x1.0200359739a9fp-1,
+    -0x1.026b58fa1b5b5p-1,
+    -0x1.02d69096b71f4p-1,
+    -0x1.0341dc6b2cee2p-1,
+    -0x1.03ad3c759c29ap-1,
+    -0x1.0418b0b4235cfp-1,
+    -0x1.04843924e0a45p-1,
+    -0x1.04efd5c5f17d3p-1,
+    -0x1.055b869572c64p-1,
+    -0x1.05c74b9180bf7p-1,
+    -0x1.063324b83741ap-1,
+    -0x1.069f1207b15f2p-1,
+    -0x1.070b137e096bdp-1,
+    -0x1.07772919592cbp-1,
+    -0x1.07e352d7b9f7bp-1,
+    -0x1.084f90b7447cp-1,
+    -0x1.08bbe2b61072dp-1,
+    -0x1.092848d23545fp-1,
+    -0x1.0994c309c9d05p-1,
+    -0x1.0a01515ae40eap-1,
+    -0x1.0a6df3c3998e7p-1,
+    -0x1.0adaaa41ff36bp-1,
+    -0x1.0b4774d42947bp-1,
+    -0x1.0bb453782b8a8p-1,
+    -0x1.0c21462c18da5p-1,
+    -0x1.0c8e4cee03932p-1,
+    -0x1.0cfb67bbfd627p-1,
+    -0x1.0d689694177eap-1,
+    -0x1.0dd5d9746247ep-1,
+    -0x1.0e43305aed976p-1,
+    -0x1.0eb09b45c8b78p-1,
+    -0x1.0f1e1a330243ep-1,
+    -0x1.0f8bad20a8398p-1,
+    -0x1.0ff9540cc7e6cp-1,
+    -0x1.10670ef56e032p-1,
+    -0x1.10d4ddd8a6af8p-1,
+    -0x1.1142c0b47d56p-1,
+    -0x1.11b0b786fcb24p-1,
+    -0x1.121ec24e2f00ep-1,
+    -0x1.128ce1081dcfdp-1,
+    -0x1.12fb13b2d2067p-1,
+    -0x1.13695a4c5415p-1,
+    -0x1.13d7b4d2ab75cp-1,
+    -0x1.14462343df14p-1,
+    -0x1.14b4a59df54c3p-1,
+    -0x1.15233bdef3cc4p-1,
+    -0x1.1591e604dfb34p-1,
+    -0x1.1600a40dbd993p-1,
+    -0x1.166f75f7913fep-1,
+    -0x1.16de5bc05df21p-1,
+    -0x1.174d5566262c2p-1,
+    -0x1.17bc62e6eba4p-1,
+    -0x1.182b8440afb06p-1,
+    -0x1.189ab97172c1ep-1,
+    -0x1.190a027734c9fp-1,
+    -0x1.19795f4ff503ap-1,
+    -0x1.19e8cff9b222fp-1,
+    -0x1.1a5854726a355p-1,
+    -0x1.1ac7ecb81aa97p-1,
+    -0x1.1b3798c8c03f4p-1,
+    -0x1.1ba758a257181p-1,
+    -0x1.1c172c42da96cp-1,
+    -0x1.1c8713a8454fdp-1,
+    -0x1.1cf70ed091609p-1,
+    -0x1.1d671db9b86f6p-1,
+    -0x1.1dd74061b3445p-1,
+    -0x1.1e4776c679c95p-1,
+    -0x1.1eb7c0e60398ep-1,
+    -0x1.1f281ebe475f6p-1,
+    -0x1.1f98904d3b79ep-1,
+    -0x1.20091590d577p-1,
+    -0x1.2079ae870a36dp-1,
+    -0x1.20ea5b2dcde2ep-1,
+    -0x1.215b1b8313fdfp-1,
+    -0x1.21cbef84cf8bfp-1,
+    -0x1.223cd730f292bp-1,
+    -0x1.22add2856ec8ap-1,
+    -0x1.231ee1803516p-1,
+    -0x1.2390041f35b44p-1,
+    -0x1.24013a6060265p-1,
+    -0x1.24728441a3488p-1,
+    -0x1.24e3e1c0ed802p-1,
+    -0x1.255552dc2c444p-1,
+    -0x1.25c6d7914c94fp-1,
+    -0x1.26386fde3acbap-1,
+    -0x1.26aa1bc0e2833p-1,
+    -0x1.271bdb372e981p-1,
+    -0x1.278dae3f09284p-1,
+    -0x1.27ff94d65b9b2p-1,
+    -0x1.28718efb0ec13p-1,
+    -0x1.28e39cab0adc3p-1,
+    -0x1.2955bde437972p-1,
+    -0x1.29c7f2a47bd67p-1,
+    -0x1.2a3a3ae9bda85p-1,
+    -0x1.2aac96b1e2cbap-1,
+    -0x1.2b1f05fad0014p-1,
+    -0x1.2b9188c2697b1p-1,
+    -0x1.2c041f06929cdp-1,
+    -0x1.2c76c8c52e4bp-1,
+    -0x1.2ce985fc1e8c2p-1,
+    -0x1.2d5c56a944cfdp-1,
+    -0x1.2dcf3aca820e9p-1,
+    -0x1.2e42325db63afp-1,
+    -0x1.2eb53d60c0d88p-1,
+    -0x1.2f285bd180947p-1,
+    -0x1.2f9b8dadd3755p-1,
+    -0x1.300ed2f396e2fp-1,
+    -0x1.30822ba0a77eap-1,
+    -0x1.30f597b2e14b1p-1,
+    -0x1.316917281f5cdp-1,
+    -0x1.31dca9fe3c691p-1,
+    -0x1.32505033125ebp-1,
+    -0x1.32c409c47a5e3p-1,
+    -0x1.3337d6b04d111p-1,
+    -0x1.33abb6f4623a9p-1,
+    -0x1.341faa8e90e76p-1,
+    -0x1.3493b17cafad3p-1,
+    -0x1.3507cbbc942bbp-1,
+    -0x1.357bf94c136bap-1,
+    -0x1.35f03a2901cf2p-1,
+    -0x1.36648e5133299p-1,
+    -0x1.36d8f5c27aaf7p-1,
+    -0x1.374d707aaa67ap-1,
+    -0x1.37c1fe7793eap-1,
+    -0x1.38369fb7080fep-1,
+    -0x1.38ab5436d6e45p-1,
+    -0x1.39201bf4cfa3dp-1,
+    -0x1.3994f6eec10c2p-1,
+    -0x1.3a09e522794bep-1,
+    -0x1.3a7ee68dc5cb8p-1,
+    -0x1.3af3fb2e730d2p-1,
+    -0x1.3b6923024d1bep-1,
+    -0x1.3bde5e071f3c7p-1,
+    -0x1.3c53ac3ab3edp-1,
+    -0x1.3cc90d9ad4e58p-1,
+    -0x1.3d3e82254b175p-1,
+    -0x1.3db409d7df04cp-1,
+    -0x1.3e29a4b05869bp-1,
+    -0x1.3e9f52ac7e3b9p-1,
+    -0x1.3f1513ca16b16p-1,
+    -0x1.3f8ae806e74b8p-1,
+    -0x1.4000cf60b4dbdp-1,
+    -0x1.4076c9d54345fp-1,
+    -0x1.40ecd76255cedp-1,
+    -0x1.4162f805af3c7p-1,
+    -0x1.41d92bbd117e9p-1,
+    -0x1.424f72863da68p-1,
+    -0x1.42c5cc5ef427p-1,
+    -0x1.433c3944f4d41p-1,
+    -0x1.43b2b935feab4p-1,
+    -0x1.44294c2fcfebdp-1,
+    -0x1.449ff23026362p-1,
+    -0x1.4516ab34be6c3p-1,
+    -0x1.458d773b5491cp-1,
+    -0x1.46045641a3ebfp-1,
+    -0x1.467b484567117p-1,
+    -0x1.46f24d4457c29p-1,
+    -0x1.4769653c2f685p-1,
+    -0x1.47e0902aa6a54p-1,
+    -0x1.4857ce0d7525fp-1,
+    -0x1.48cf1ee251a8dp-1,
+    -0x1.494682a6f27d3p-1,
+    -0x1.49bdf9590d43dp-1,
+    -0x1.4a3582f656bf2p-1,
+    -0x1.4aad1f7c82e33p-1,
+    -0x1.4b24cee944ddcp-1,
+    -0x1.4b9c913a4f558p-1,
+    -0x1.4c14666d53eb6p-1,
+    -0x1.4c8c4e8003c92p-1,
+    -0x1.4d0449700f2a6p-1,
+    -0x1.4d7c573b25b41p-1,
+    -0x1.4df477def64c9p-1,
+    -0x1.4e6cab592ee44p-1,
+    -0x1.4ee4f1a77cb4ep-1,
+    -0x1.4f5d4ac78c29ep-1,
+    -0x1.4fd5b6b70917ep-1,
+    -0x1.504e35739ec4bp-1,
+    -0x1.50c6c6faf7781p-1,
+    -0x1.513f6b4abcd31p-1,
+    -0x1.51b822609798ap-1,
+    -0x1.5230ec3a2fe5p-1,
+    -0x1.52a9c8d52cd66p-1,
+    -0x1.5322b82f34dc5p-1,
+    -0x1.539bba45ed804p-1,
+    -0x1.5414cf16fbec6p-1,
+    -0x1.548df6a004352p-1,
+    -0x1.550730dea9effp-1,
+    -0x1.55807dd08fc41p-1,
+    -0x1.55f9dd7357ba1p-1,
+    -0x1.56734fc4a3043p-1,
+    -0x1.56ecd4c212065p-1,
+    -0x1.57666c69449d8p-1,
+    -0x1.57e016b7d988fp-1,
+    -0x1.5859d3ab6ec97p-1,
+    -0x1.58d3a341a1a92p-1,
+    -0x1.594d85780eb3cp-1,
+    -0x1.59c77a4c51aeap-1,
+    -0x1.5a4181bc0578ep-1,
+    -0x1.5abb9bc4c41b6p-1,
+    -0x1.5b35c8642718p-1,
+    -0x1.5bb00797c72a3p-1,
+    -0x1.5c2a595d3c0f8p-1,
+    -0x1.5ca4bdb21d0e5p-1,
+    -0x1.5d1f349400576p-1,
+    -0x1.5d99be007b54dp-1,
+    -0x1.5e1459f522a29p-1,
+    -0x1.5e8f086f8a3dbp-1,
+    -0x1.5f09c96d4574cp-1,
+    -0x1.5f849cebe6905p-1,
+    -0x1.5fff82e8ff326p-1,
+    -0x1.607a7b622006bp-1,
+    -0x1.60f58654d8e2fp-1,
+    -0x1.6170a3beb925ap-1,
+    -0x1.61ebd39d4f472p-1,
+    -0x1.626715ee28e97p-1,
+    -0x1.62e26aaed2c09p-1,
+    -0x1.635dd1dcd8924p-1,
+    -0x1.63d94b75c5ad5p-1,
+    -0x1.6454d77724826p-1,
+    -0x1.64d075de7e6c2p-1,
+    -0x1.654c26a95c368p-1,
+    -0x1.65c7e9d54606cp-1,
+    -0x1.6643bf5fc2f43p-1,
+    -0x1.66bfa7465957bp-1,
+    -0x1.673ba1868eabep-1,
+    -0x1.67b7ae1de7952p-1,
+    -0x1.6833cd09e821p-1,
+    -0x1.68affe481366fp-1,
+    -0x1.692c41d5eb985p-1,
+    -0x1.69a897b0f247ap-1,
+    -0x1.6a24ffd6a858fp-1,
+    -0x1.6aa17a448d928p-1,
+    -0x1.6b1e06f820dc4p-1,
+    -0x1.6b9aa5eee08f7p-1,
+    -0x1.6c17572649c7bp-1,
+    -0x1.6c941a9bd8ea2p-1,
+    -0x1.6d10f04d09dcdp-1,
+    -0x1.6d8dd83757b7ap-1,
+    -0x1.6e0ad2583cac1p-1,
+    -0x1.6e87dead31b64p-1,
+    -0x1.6f04fd33af1bap-1,
+    -0x1.6f822de92c83p-1,
+    -0x1.6fff70cb20bcdp-1,
+    -0x1.707cc5d701c35p-1,
+    -0x1.70fa2d0a4492ap-1,
+    -0x1.7177a6625d58ap-1,
+    -0x1.71f531dcbf7cbp-1,
+    -0x1.7272cf76dd801p-1,
+    -0x1.72f07f2e2905cp-1,
+    -0x1.736e410012f23p-1,
+    -0x1.73ec14ea0b241p-1,
+    -0x1.7469fae980d34p-1,
+    -0x1.74e7f2fbe249ap-1,
+    -0x1.7565fd1e9d029p-1,
+    -0x1.75e4194f1dab3p-1,
+    -0x1.7662478acffa9p-1,
+    -0x1.76e087cf1ee93p-1,
+    -0x1.775eda197479bp-1,
+    -0x1.77dd3e6739e02p-1,
+    -0x1.785bb4b5d7825p-1,
+    -0x1.78da3d02b4c82p-1,
+    -0x1.7958d74b3843p-1,
+    -0x1.79d7838cc7a64p-1,
+    -0x1.7a5641c4c7d6dp-1,
+    -0x1.7ad511f09cdb5p-1,
+    -0x1.7b53f40da9ec2p-1,
+    -0x1.7bd2e819515b7p-1,
+    -0x1.7c51ee10f48d4p-1,
+    -0x1.7cd105f1f3f78p-1,
+    -0x1.7d502fb9af29fp-1,
+    -0x1.7dcf6b6584de1p-1,
+    -0x1.7e4eb8f2d2df4p-1,
+    -0x1.7ece185ef64a3p-1,
+    -0x1.7f4d89a74b25ep-1,
+    -0x1.7fcd0cc92cea6p-1,
+    -0x1.804ca1c1f611ep-1,
+    -0x1.80cc488efff0dp-1,
+    -0x1.814c012da31d1p-1,
+    -0x1.81cbcb9b374e6p-1,
+    -0x1.824ba7d513565p-1,
+    -0x1.82cb95d88d381p-1,
+    -0x1.834b95a2fa08bp-1,
+    -0x1.83cba731ade75p-1,
+    -0x1.844bca81fc444p-1,
+    -0x1.84cbff9137626p-1,
+    -0x1.854c465cb09e5p-1,
+    -0x1.85cc9ee1b8768p-1,
+    -0x1.864d091d9ea2fp-1,
+    -0x1.86cd850db1fd5p-1,
+    -0x1.874e12af4039ep-1,
+    -0x1.87ceb1ff966ddp-1,
+    -0x1.884f62fc0088fp-1,
+    -0x1.88d025a1c994ap-1,
+    -0x1.8950f9ee3bbc4p-1,
+    -0x1.89d1dfdea05ccp-1,
+    -0x1.8a52d7703fecdp-1,
+    -0x1.8ad3e0a061f52p-1,
+    -0x1.8b54fb6c4d084p-1,
+    -0x1.8bd627d146badp-1,
+    -0x1.8c5765cc93cb2p-1,
+    -0x1.8cd8b55b77bap-1,
+    -0x1.8d5a167b3569ap-1,
+    -0x1.8ddb89290ec6p-1,
+    -0x1.8e5d0d6244f4cp-1,
+    -0x1.8edea32417b65p-1,
+    -0x1.8f604a6bc60ccp-1,
+    -0x1.8fe203368e5b4p-1,
+    -0x1.9063cd81adcf9p-1,
+    -0x1.90e5a94a60e0dp-1,
+    -0x1.9167968de2b0ep-1,
+    -0x1.91e995496da32p-1,
+    -0x1.926ba57a3b2cdp-1,
+    -0x1.92edc71d83e4fp-1,
+    -0x1.936ffa307f5ccp-1,
+    -0x1.93f23eb0641f6p-1,
+    -0x1.9474949a67aa2p-1,
+    -0x1.94f6fbebbef37p-1,
+    -0x1.957974a19de3ep-1,
+    -0x1.95fbfeb9370ebp-1,
+    -0x1.967e9a2fbc688p-1,
+    -0x1.970147025ecffp-1,
+    -0x1.9784052e4e0ep-1,
+    -0x1.9806d4b0b91d5p-1,
+    -0x1.9889b586ce2ap-1,
+    -0x1.990ca7adba3abp-1,
+    -0x1.998fab22a908ap-1,
+    -0x1.9a12bfe2c5be1p-1,
+    -0x1.9a95e5eb3a4fdp-1,
+    -0x1.9b191d392fdc7p-1,
+    -0x1.9b9c65c9ce8c7p-1,
+    -0x1.9c1fbf9a3da9fp-1,
+    -0x1.9ca32aa7a3716p-1,
+    -0x1.9d26a6ef24f96p-1,
+    -0x1.9daa346de633p-1,
+    -0x1.9e2dd3210a50ep-1,
+    -0x1.9eb18305b3976p-1,
+    -0x1.9f35441903353p-1,
+    -0x1.9fb9165819928p-1,
+    -0x1.a03cf9c015ba5p-1,
+    -0x1.a0c0ee4e15f14p-1,
+    -0x1.a144f3ff375e2p-1,
+    -0x1.a1c90ad09612p-1,
+    -0x1.a24d32bf4d3fbp-1,
+    -0x1.a2d16bc877141p-1,
+    -0x1.a355b5e92cbe2p-1,
+    -0x1.a3da111e8666dp-1,
+    -0x1.a45e7d659b58ep-1,
+    -0x1.a4e2fabb81d15p-1,
+    -0x1.a567891d4ee74p-1,
+    -0x1.a5ec288816847p-1,
+    -0x1.a670d8f8ebac5p-1,
+    -0x1.a6f59a6ce05c6p-1,
+    -0x1.a77a6ce105a42p-1,
+    -0x1.a7ff50526bb4cp-1,
+    -0x1.a88444be2189ep-1,
+    -0x1.a9094a2134f1ap-1,
+    -0x1.a98e6078b2dbdp-1,
+    -0x1.aa1387c1a6f2dp-1,
+    -0x1.aa98bff91c12bp-1,
+    -0x1.ab1e091c1bda2p-1,
+    -0x1.aba36327af213p-1,
+    -0x1.ac28ce18dd8a7p-1,
+    -0x1.acae49ecadb2ap-1,
+    -0x1.ad33d6a025388p-1,
+    -0x1.adb9743048853p-1,
+    -0x1.ae3f229a1af41p-1,
+    -0x1.aec4e1da9f12p-1,
+    -0x1.af4ab1eed63e6p-1,
+    -0x1.afd092d3c0e28p-1,
+    -0x1.b05684865ddadp-1,
+    -0x1.b0dc8703ab2d8p-1,
+    -0x1.b1629a48a6028p-1,
+    -0x1.b1e8be524a2c7p-1,
+    -0x1.b26ef31d92a7bp-1,
+    -0x1.b2f538a7795acp-1,
+    -0x1.b37b8eecf6eecp-1,
+    -0x1.b401f5eb03367p-1,
+    -0x1.b4886d9e9487ap-1,
+    -0x1.b50ef604a069cp-1,
+    -0x1.b5958f1a1b468p-1,
+    -0x1.b61c38dbf859fp-1,
+    -0x1.b6a2f34729b2bp-1,
+    -0x1.b729be58a079p-1,
+    -0x1.b7b09a0d4ccf5p-1,
+    -0x1.b83786621dba6p-1,
+    -0x1.b8be835400b9ep-1,
+    -0x1.b94590dfe2578p-1,
+    -0x1.b9ccaf02ae1f2p-1,
+    -0x1.ba53ddb94e66ep-1,
+    -0x1.badb1d00acbe9p-1,
+    -0x1.bb626cd5b1689p-1,
+    -0x1.bbe9cd3543a17p-1,
+    -0x1.bc713e1c49489p-1,
+    -0x1.bcf8bf87a6e7dp-1,
+    -0x1.bd8051744032fp-1,
+    -0x1.be07f3def7b8p-1,
+    -0x1.be8fa6c4aed76p-1,
+    -0x1.bf176a2245c3fp-1,
+    -0x1.bf9f3df49bba6p-1,
+    -0x1.c02722388eb23p-1,
+    -0x1.c0af16eafb8cfp-1,
+    -0x1.c1371c08bdf69p-1,
+    -0x1.c1bf318eb0758p-1,
+    -0x1.c2475779ac6a8p-1,
+    -0x1.c2cf8dc68a00ap-1,
+    -0x1.c357d47220455p-1,
+    -0x1.c3e02b7944e8dp-1,
+    -0x1.c46892d8ccb53p-1,
+    -0x1.c4f10a8d8b2fp-1,
+    -0x1.c579929452ad5p-1,
+    -0x1.c6022ae9f4697p-1,
+    -0x1.c68ad38b407edp-1,
+    -0x1.c7138c7505db8p-1,
+    -0x1.c79c55a412104p-1,
+    -0x1.c8252f1531783p-1,
+    -0x1.c8ae18c52f48dp-1,
+    -0x1.c93712b0d5c99p-1,
+    -0x1.c9c01cd4edbdp-1,
+    -0x1.ca49372e3eff7p-1,
+    -0x1.cad261b98ff82p-1,
+    -0x1.cb5b9c73a5e8cp-1,
+    -0x1.cbe4e75944cd7p-1,
+    -0x1.cc6e42672f553p-1,
+    -0x1.ccf7ad9a2740ap-1,
+    -0x1.cd8128eeece37p-1,
+    -0x1.ce0ab4623f9b5p-1,
+    -0x1.ce944ff0dd50cp-1,
+    -0x1.cf1dfb9782872p-1,
+    -0x1.cfa7b752eacbfp-1,
+    -0x1.d031831fd06fp-1,
+    -0x1.d0bb5efaec6afp-1,
+    -0x1.d1454ae0f6a49p-1,
+    -0x1.d1cf46cea573dp-1,
+    -0x1.d25952c0ae527p-1,
+    -0x1.d2e36eb3c54d1p-1,
+    -0x1.d36d9aa49d132p-1,
+    -0x1.d3f7d68fe765ep-1,
+    -0x1.d48222725479cp-1,
+    -0x1.d50c7e489335ep-1,
+    -0x1.d596ea0f51738p-1,
+    -0x1.d62165c33b771p-1,
+    -0x1.d6abf160fc7f2p-1,
+    -0x1.d7368ce53e553p-1,
+    -0x1.d7c1384ca9a51p-1,
+    -0x1.d84bf393e5a57p-1,
+    -0x1.d8d6beb7988f1p-1,
+    -0x1.d96199b4671dcp-1,
+    -0x1.d9ec8486f4dfbp-1,
+    -0x1.da777f2be405dp-1,
+    -0x1.db02899fd55bep-1,
+    -0x1.db8da3df6838bp-1,
+    -0x1.dc18cde73ae51p-1,
+    -0x1.dca407b3ea44dp-1,
+    -0x1.dd2f51421225fp-1,
+    -0x1.ddbaaa8e4d10ep-1,
+    -0x1.de46139533b9ep-1,
+    -0x1.ded18c535d9fbp-1,
+    -0x1.df5d14c561039p-1,
+    -0x1.dfe8ace7d2d17p-1,
+    -0x1.e07454b746883p-1,
+    -0x1.e1000c304e612p-1,
+    -0x1.e18bd34f7b781p-1,
+    -0x1.e217aa115d63cp-1,
+    -0x1.e2a390728246p-1,
+    -0x1.e32f866f770afp-1,
+    -0x1.e3bb8c04c731cp-1,
+    -0x1.e447a12efc751p-1,
+    -0x1.e4d3c5ea9fa98p-1,
+    -0x1.e55ffa34383e6p-1,
+    -0x1.e5ec3e084c45fp-1,
+    -0x1.e678916360751p-1,
+    -0x1.e704f441f7fbcp-1,
+    -0x1.e79166a094bcbp-1,
+    -0x1.e81de87bb715ap-1,
+    -0x1.e8aa79cfddff2p-1,
+    -0x1.e9371a9986fccp-1,
+    -0x1.e9c3cad52e2cep-1,
+    -0x1.ea508a7f4e806p-1,
+    -0x1.eadd5994614b4p-1,
+    -0x1.eb6a3810de6cap-1,
+    -0x1.ebf725f13c4e6p-1,
+    -0x1.ec842331f03cep-1,
+    -0x1.ed112fcf6ddfbp-1,
+    -0x1.ed9e4bc627911p-1,
+    -0x1.ee2b77128df6cp-1,
+    -0x1.eeb8b1b110594p-1,
+    -0x1.ef45fb9e1c743p-1,
+    -0x1.efd354d61ea61p-1,
+    -0x1.f060bd5582377p-1,
+    -0x1.f0ee3518b05d4p-1,
+    -0x1.f17bbc1c1126ap-1,
+    -0x1.f209525c0b6d4p-1,
+    -0x1.f296f7d504466p-1,
+    -0x1.f324ac835f524p-1,
+    -0x1.f3b270637eb41p-1,
+    -0x1.f4404371c2f26p-1,
+    -0x1.f4ce25aa8b0ecp-1,
+    -0x1.f55c170a3495dp-1,
+    -0x1.f5ea178d1bb6ep-1,
+    -0x1.f678272f9b148p-1,
+    -0x1.f70645ee0ba49p-1,
+    -0x1.f79473c4c54f1p-1,
+    -0x1.f822b0b01de85p-1,
+    -0x1.f8b0fcac69df8p-1,
+    -0x1.f93f57b5fc06ep-1,
+    -0x1.f9cdc1c925c3dp-1,
+    -0x1.fa5c3ae236febp-1,
+    -0x1.faeac2fd7e12fp-1,
+    -0x1.fb795a1747eeep-1,
+    -0x1.fc08002bdf85p-1,
+    -0x1.fc96b5378e628p-1,
+    -0x1.fd2579369ca7ap-1,
+    -0x1.fdb44c2550dfap-1,
+    -0x1.fe432dffefd19p-1,
+    -0x1.fed21ec2bcf7p-1,
+    -0x1.ff611e69f9f54p-1,
+    -0x1.fff02cf1e6bd2p-1,
+    -0x1.003fa52b6104fp+0,
+    -0x1.00873b4a64556p+0,
+    -0x1.00ced8d41af8fp+0,
+    -0x1.01167dc6a1ba8p+0,
+    -0x1.015e2a2014b25p+0,
+    -0x1.01a5ddde8f128p+0,
+    -0x1.01ed99002b1b2p+0,
+    -0x1.02355b8302756p+0,
+    -0x1.027d25652dc0ap+0,
+    -0x1.02c4f6a4c4cdep+0,
+    -0x1.030ccf3fdec38p+0,
+    -0x1.0354af3491ddap+0,
+    -0x1.039c9680f3862p+0,
+    -0x1.03e4852318686p+0,
+    -0x1.042c7b19141a1p+0,
+    -0x1.04747860f992p+0,
+    -0x1.04bc7cf8daf4bp+0,
+    -0x1.050488dec960cp+0,
+    -0x1.054c9c10d5424p+0,
+    -0x1.0594b68d0e0b1p+0,
+    -0x1.05dcd85182473p+0,
+    -0x1.0625015c3fc7dp+0,
+    -0x1.066d31ab53588p+0,
+    -0x1.06b5693cc8f24p+0,
+    -0x1.06fda80eabcf9p+0,
+    -0x1.0745ee1f0650ep+0,
+    -0x1.078e3b6be1b4dp+0,
+    -0x1.07d68ff346876p+0,
+    -0x1.081eebb33c7a5p+0,
+    -0x1.08674ea9ca457p+0,
+    -0x1.08afb8d4f59e9p+0,
+    -0x1.08f82a32c39ccp+0,
+    -0x1.0940a2c138396p+0,
+    -0x1.0989227e568b9p+0,
+    -0x1.09d1a96820f3ep+0,
+    -0x1.0a1a377c98d0fp+0,
+    -0x1.0a62ccb9bea74p+0,
+    -0x1.0aab691d91d57p+0,
+    -0x1.0af40ca610c43p+0,
+    -0x1.0b3cb75139396p+0,
+    -0x1.0b85691d07f13p+0,
+    -0x1.0bce220778c56p+0,
+    -0x1.0c16e20e86723p+0,
+    -0x1.0c5fa9302afd2p+0,
+    -0x1.0ca8776a5f81cp+0,
+    -0x1.0cf14cbb1c256p+0,
+    -0x1.0d3a2920580b8p+0,
+    -0x1.0d830c98094dap+0,
+    -0x1.0dcbf72025037p+0,
+    -0x1.0e14e8b69f821p+0,
+    -0x1.0e5de1596c10dp+0,
+    -0x1.0ea6e1067cf9p+0,
+    -0x1.0eefe7bbc38dfp+0,
+    -0x1.0f38f57730509p+0,
+    -0x1.0f820a36b2c3dp+0,
+    -0x1.0fcb25f839293p+0,
+    -0x1.101448b9b0ebfp+0,
+    -0x1.105d727906855p+0,
+    -0x1.10a6a3342548bp+0,
+    -0x1.10efdae8f7af4p+0,
+    -0x1.11391995674c1p+0,
+    -0x1.11825f375c889p+0,
+    -0x1.11cbabccbed03p+0,
+    -0x1.1214ff53749c4p+0,
+    -0x1.125e59c963603p+0,
+    -0x1.12a7bb2c6f79bp+0,
+    -0x1.12f1237a7c3c8p+0,
+    -0x1.133a92b16bfa5p+0,
+    -0x1.138408cf200bp+0,
+    -0x1.13cd85d178b49p+0,
+    -0x1.141709b655232p+0,
+    -0x1.1460947b93556p+0,
+    -0x1.14aa261f10876p+0,
+    -0x1.14f3be9ea8cf9p+0,
+    -0x1.153d5df83712fp+0,
+    -0x1.1587042995307p+0,
+    -0x1.15d0b1309c1cfp+0,
+    -0x1.161a650b23af8p+0,
+    -0x1.16641fb70281dp+0,
+    -0x1.16ade1320e2f8p+0,
+    -0x1.16f7a97a1b1ebp+0,
+    -0x1.1741788cfcffp+0,
+    -0x1.178b4e688612dp+0,
+    -0x1.17d52b0a87aa9p+0,
+    -0x1.181f0e70d1d92p+0,
+    -0x1.1868f89933a3ap+0,
+    -0x1.18b2e9817aed6p+0,
+    -0x1.18fce127745c3p+0,
+    -0x1.1946df88ebap+0,
+    -0x1.1990e4a3ab3fp+0,
+    -0x1.19daf0757cd14p+0,
+    -0x1.1a2502fc2889bp+0,
+    -0x1.1a6f1c357551ep+0,
+    -0x1.1ab93c1f29313p+0,
+    -0x1.1b0362b708d1bp+0,
+    -0x1.1b4d8ffad7c3dp+0,
+    -0x1.1b97c3e8587a1p+0,
+    -0x1.1be1fe7d4c555p+0,
+    -0x1.1c2c3fb773651p+0,
+    -0x1.1c7687948c8b3p+0,
+    -0x1.1cc0d61255603p+0,
+    -0x1.1d0b2b2e8a76ap+0,
+    -0x1.1d5586e6e6fbfp+0,
+    -0x1.1d9fe93924ffcp+0,
+    -0x1.1dea5222fd546p+0,
+    -0x1.1e34c1a227967p+0,
+    -0x1.1e7f37b45a58ap+0,
+    -0x1.1ec9b4574aa5p+0,
+    -0x1.1f143788ac7b7p+0,
+    -0x1.1f5ec1463276ep+0,
+    -0x1.1fa9518d8e048p+0,
+    -0x1.1ff3e85c6f582p+0,
+    -0x1.203e85b08573ep+0,
+    -0x1.208929877e08ap+0,
+    -0x1.20d3d3df057dep+0,
+    -0x1.211e84b4c6d5ep+0,
+    -0x1.21693c066bd97p+0,
+    -0x1.21b3f9d19d23cp+0,
+    -0x1.21febe1401d3p+0,
+    -0x1.224988cb3fe7cp+0,
+    -0x1.229459f4fbfd4p+0,
+    -0x1.22df318ed95d9p+0,
+    -0x1.232a0f9679e99p+0,
+    -0x1.2374f4097e2ccp+0,
+    -0x1.23bfdee585618p+0,
+    -0x1.240ad0282d68cp+0,
+    -0x1.2455c7cf12da2p+0,
+    -0x1.24a0c5d7d0f01p+0,
+    -0x1.24ebca4001af8p+0,
+    -0x1.2536d5053d945p+0,
+    -0x1.2581e6251ba18p+0,
+    -0x1.25ccfd9d3180dp+0,
+    -0x1.26181b6b13531p+0,
+    -0x1.26633f8c5403ap+0,
+    -0x1.26ae69fe84fccp+0,
+    -0x1.26f99abf365f8p+0,
+    -0x1.2744d1cbf6b02p+0,
+    -0x1.27900f225319ap+0,
+    -0x1.27db52bfd759ep+0,
+    -0x1.28269ca20d961p+0,
+    -0x1.2871ecc67ea5fp+0,
+    -0x1.28bd432ab1f04p+0,
+    -0x1.29089fcc2d76ap+0,
+    -0x1.295402a875861p+0,
+    -0x1.299f6bbd0d0e6p+0,
+    -0x1.29eadb07758a5p+0,
+    -0x1.2a3650852eac5p+0,
+    -0x1.2a81cc33b6adcp+0,
+    -0x1.2acd4e108a9a7p+0,
+    -0x1.2b18d61925d19p+0,
+    -0x1.2b64644b0211ap+0,
+    -0x1.2baff8a3979c3p+0,
+    -0x1.2bfb93205ccaap+0,
+    -0x1.2c4733bec6d4bp+0,
+    -0x1.2c92da7c4921dp+0,
+    -0x1.2cde87565564ep+0,
+    -0x1.2d2a3a4a5bff5p+0,
+    -0x1.2d75f355cb9a5p+0,
+    -0x1.2dc1b2761171dp+0,
+    -0x1.2e0d77a898f17p+0,
+    -0x1.2e5942eacbdc2p+0,
+    -0x1.2ea5143a12585p+0,
+    -0x1.2ef0eb93d2dbbp+0,
+    -0x1.2f3cc8f572434p+0,
+    -0x1.2f88ac5c539f9p+0,
+    -0x1.2fd495c5d844dp+0,
+    -0x1.3020852f601a2p+0,
+    -0x1.306c7a96491e7p+0,
+    -0x1.30b875f7efb8p+0,
+    -0x1.31047751ae80ap+0,
+    -0x1.31507ea0de1a2p+0,
+    -0x1.319c8be2d5d12p+0,
+    -0x1.31e89f14ead68p+0,
+    -0x1.3234b83470d22p+0,
+    -0x1.3280d73eb987fp+0,
+    -0x1.32ccfc3114cbcp+0,
+    -0x1.33192708d0d88p+0,
+    -0x1.336557c33a20dp+0,
+    -0x1.33b18e5d9b5eep+0,
+    -0x1.33fdcad53d254p+0,
+    -0x1.344a0d27661e5p+0,
+    -0x1.349655515b243p+0,
+    -0x1.34e2a3505f703p+0,
+    -0x1.352ef721b4045p+0,
+    -0x1.357b50c2980e3p+0,
+    -0x1.35c7b03048d34p+0,
+    -0x1.3614156801d0cp+0,
+    -0x1.36608066fc83dp+0,
+    -0x1.36acf12a703a3p+0,
+    -0x1.36f967af92a8bp+0,
+    -0x1.3745e3f39748dp+0,
+    -0x1.379265f3afa3ep+0,
+    -0x1.37deedad0b731p+0,
+    -0x1.382b7b1cd8102p+0,
+    -0x1.38780e4040cd3p+0,
+    -0x1.38c4a7146f045p+0,
+    -0x1.391145968a1b6p+0,
+    -0x1.395de9c3b7313p+0,
+    -0x1.39aa939919842p+0,
+    -0x1.39f74313d2035p+0,
+    -0x1.3a43f830ffa5fp+0,
+    -0x1.3a90b2edbfp+0,
+    -0x1.3add73472ab57p+0,
+    -0x1.3b2a393a5b16fp+0,
+    -0x1.3b7704c46639cp+0,
+    -0x1.3bc3d5e2603f2p+0,
+    -0x1.3c10ac915ac15p+0,
+    -0x1.3c5d88ce65729p+0,
+    -0x1.3caa6a968d5a8p+0,
+    -0x1.3cf751e6dd495p+0,
+    -0x1.3d443ebc5dfb6p+0,
+    -0x1.3d91311415bdfp+0,
+    -0x1.3dde28eb08971p+0,
+    -0x1.3e2b263e38494p+0,
+    -0x1.3e78290aa3fc6p+0,
+    -0x1.3ec5314d487d2p+0,
+    -0x1.3f123f032058ap+0,
+    -0x1.3f5f522923759p+0,
+    -0x1.3fac6abc476f4p+0,
+    -0x1.3ff988b97f366p+0,
+    -0x1.4046ac1dbb704p+0,
+    -0x1.4093d4e5ea633p+0,
+    -0x1.40e1030ef78afp+0,
+    -0x1.412e3695cc143p+0,
+    -0x1.417b6f774e495p+0,
+    -0x1.41c8adb061e5fp+0,
+    -0x1.4215f13de82acp+0,
+    -0x1.42633a1cbfb9dp+0,
+    -0x1.42b08849c4ca1p+0,
+    -0x1.42fddbc1d0a05p+0,
+    -0x1.434b3481b9ab6p+0,
+    -0x1.4398928653cf1p+0,
+    -0x1.43e5f5cc700d2p+0,
+    -0x1.44335e50dcacep+0,
+    -0x1.4480cc106546fp+0,
+    -0x1.44ce3f07d26a5p+0,
+    -0x1.451bb733e9fb5p+0,
+    -0x1.456934916ec89p+0,
+    -0x1.45b6b71d20c28p+0,
+    -0x1.46043ed3bd075p+0,
+    -0x1.4651cbb1fd9b8p+0,
+    -0x1.469f5db499ad5p+0,
+    -0x1.46ecf4d845358p+0,
+    -0x1.473a9119b17e5p+0,
+    -0x1.478832758c8ccp+0,
+    -0x1.47d5d8e881302p+0,
+    -0x1.4823846f3745ep+0,
+    -0x1.4871350653524p+0,
+    -0x1.48beeaaa76bbdp+0,
+    -0x1.490ca5583f97dp+0,
+    -0x1.495a650c48dap+0,
+    -0x1.49a829c32a18ep+0,
+    -0x1.49f5f37977f5p+0,
+    -0x1.4a43c22bc332cp+0,
+    -0x1.4a9195d6992d7p+0,
+    -0x1.4adf6e76840afp+0,
+    -0x1.4b2d4c080a7c3p+0,
+    -0x1.4b7b2e87aff0ap+0,
+    -0x1.4bc915f1f3d3fp+0,
+    -0x1.4c170243524c9p+0,
+    -0x1.4c64f37843b86p+0,
+    -0x1.4cb2e98d3cf0bp+0,
+    -0x1.4d00e47eaf163p+0,
+    -0x1.4d4ee44907991p+0,
+    -0x1.4d9ce8e8afe5ep+0,
+    -0x1.4deaf25a0e1bbp+0,
+    -0x1.4e3900998451dp+0,
+    -0x1.4e8713a370605p+0,
+    -0x1.4ed52b742ca62p+0,
+    -0x1.4f2348080ef7ap+0,
+    -0x1.4f71695b69985p+0,
+    -0x1.4fbf8f6a8acfcp+0,
+    -0x1.500dba31bc829p+0,
+    -0x1.505be9ad4469dp+0,
+    -0x1.50aa1dd963f72p+0,
+    -0x1.50f856b258989p+0,
+    -0x1.514694345b68cp+0,
+    -0x1.5194d65ba0fb9p+0,
+    -0x1.51e31d245981fp+0,
+    -0x1.5231688ab0626p+0,
+    -0x1.527fb88acc6cdp+0,
+    -0x1.52ce0d20d07d3p+0,
+    -0x1.531c6648da69bp+0,
+    -0x1.536ac3ff03bd3p+0,
+    -0x1.53b9263f6095bp+0,
+    -0x1.54078d060052bp+0,
+    -0x1.5455f84eedd5p+0,
+    -0x1.54a468162ea43p+0,
+    -0x1.54f2dc57c3a55p+0,
+    -0x1.5541550fa809p+0,
+    -0x1.558fd239d235bp+0,
+    -0x1.55de53d2339fbp+0,
+    -0x1.562cd9d4b7df8p+0,
+    -0x1.567b643d45443p+0,
+    -0x1.56c9f307bd033p+0,
+    -0x1.5718862ffab18p+0,
+    -0x1.57671db1d427bp+0,
+    -0x1.57b5b989197a2p+0,
+    -0x1.580459b194a98p+0,
+    -0x1.5852fe270a459p+0,
+    -0x1.58a1a6e538aaap+0,
+    -0x1.58f053e7d86cfp+0,
+    -0x1.593f052a9b9ddp+0,
+    -0x1.598dbaa92e56cp+0,
+    -0x1.59dc745f36524p+0,
+    -0x1.5a2b324852946p+0,
+    -0x1.5a79f4601bd22p+0,
+    -0x1.5ac8baa223fa4p+0,
+    -0x1.5b178509f660fp+0,
+    -0x1.5b66539317707p+0,
+    -0x1.5bb526390451bp+0,
+    -0x1.5c03fcf7335f9p+0,
+    -0x1.5c52d7c913bb9p+0,
+    -0x1.5ca1b6aa0cdecp+0,
+    -0x1.5cf099957ee54p+0,
+    -0x1.5d3f8086c2bdcp+0,
+    -0x1.5d8e6b7928f4p+0,
+    -0x1.5ddd5a67fa7b3p+0,
+    -0x1.5e2c4d4e77f37p+0,
+    -0x1.5e7b4427d9f92p+0,
+    -0x1.5eca3eef50c1cp+0,
+    -0x1.5f193da003c0cp+0,
+    -0x1.5f6840351255dp+0,
+    -0x1.5fb746a992b76p+0,
+    -0x1.600650f8924dap+0,
+    -0x1.60555f1d14ccbp+0,
+    -0x1.60a4711214979p+0,
+    -0x1.60f386d282cc2p+0,
+    -0x1.6142a05946cfep+0,
+    -0x1.6191bda13dc56p+0,
+    -0x1.61e0dea53a8cp+0,
+    -0x1.6230036005886p+0,
+    -0x1.627f2bcc5c0dcp+0,
+    -0x1.62ce57e4f1342p+0,
+    -0x1.631d87a46c5f4p+0,
+    -0x1.636cbb0569962p+0,
+    -0x1.63bbf20279434p+0,
+    -0x1.640b2c961f823p+0,
+    -0x1.645a6abad4a29p+0,
+    -0x1.64a9ac6b03fa4p+0,
+    -0x1.64f8f1a10c194p+0,
+    -0x1.65483a573db3bp+0,
+    -0x1.65978687dc508p+0,
+    -0x1.65e6d62d1da2cp+0,
+    -0x1.6636294128b35p+0,
+    -0x1.66857fbe15c91p+0,
+    -0x1.66d4d99dee05cp+0,
+    -0x1.672436daab1a8p+0,
+    -0x1.6773976e36719p+0,
+    -0x1.67c2fb5268839p+0,
+    -0x1.6812628108845p+0,
+    -0x1.6861ccf3cc8e7p+0,
+    -0x1.68b13aa458168p+0,
+    -0x1.6900ab8c3c2a7p+0,
+    -0x1.69501fa4f571ap+0,
+    -0x1.699f96e7ec905p+0,
+    -0x1.69ef114e75f7bp+0,
+    -0x1.6a3e8ed1cfc28p+0,
+    -0x1.6a8e0f6b21e07p+0,
+    -0x1.6add93137cd1p+0,
+    -0x1.6b2d19c3d9009p+0,
+    -0x1.6b7ca37515da7p+0,
+    -0x1.6bcc301ff8a71p+0,
+    -0x1.6c1bbfbd2b2ecp+0,
+    -0x1.6c6b52453aa01p+0,
+    -0x1.6cbae7b0961ebp+0,
+    -0x1.6d0a7ff78d91dp+0,
+    -0x1.6d5a1b125056dp+0,
+    -0x1.6da9b8f8eb61p+0,
+    -0x1.6df959a347f85p+0,
+    -0x1.6e48fd09283c7p+0,
+    -0x1.6e98a32226a97p+0,
+    -0x1.6ee84be5b365bp+0,
+    -0x1.6f37f74b11539p+0,
+    -0x1.6f87a549545dp+0,
+    -0x1.6fd755d75c69cp+0,
+    -0x1.702708ebd4712p+0,
+    -0x1.7076be7d2c56bp+0,
+    -0x1.70c6768195b8cp+0,
+    -0x1.711630eeff023p+0,
+    -0x1.7165edbb0d72ap+0,
+    -0x1.71b5acdb16db8p+0,
+    -0x1.72056e441a6a5p+0,
+    -0x1.725531eab6dccp+0,
+    -0x1.72a4f7c32288dp+0,
+    -0x1.72f4bfc11ece8p+0,
+    -0x1.734489d7e6ee9p+0,
+    -0x1.739455fa2120fp+0,
+    -0x1.73e42419c76fbp+0,
+    -0x1.7433f4280bb83p+0,
+    -0x1.7483c61532d5cp+0,
+    -0x1.74d399d09a2e9p+0,
+    -0x1.75236f49402a1p+0,
+    -0x1.7573466e146d9p+0,
+    -0x1.75c31f2e0378fp+0,
+    -0x1.7612f977f5ebep+0,
+    -0x1.7662d53ad1db4p+0,
+    -0x1.76b2b2657875ep+0,
+    -0x1.770290e6c8ab3p+0,
+    -0x1.775270ad9b62dp+0,
+    -0x1.77a251a8c6e1dp+0,
+    -0x1.77f233c71db4cp+0,
+    -0x1.784216f76f96p+0,
+    -0x1.7891fb2889222p+0,
+    -0x1.78e1e04931713p+0,
+    -0x1.7931c6482d7b5p+0,
+    -0x1.7981ad143cb3fp+0,
+    -0x1.79d1949c1c62fp+0,
+    -0x1.7a217cce86475p+0,
+    -0x1.7a71659a2f51fp+0,
+    -0x1.7ac14eedc96dcp+0,
+    -0x1.7b1138b8027ap+0,
+    -0x1.7b6122e784996p+0,
+    -0x1.7bb10d6af77fcp+0,
+    -0x1.7c00f830fe71dp+0,
+    -0x1.7c50e32837aaap+0,
+    -0x1.7ca0ce3f4p+0,
+    -0x1.7cf0b964aebd1p+0,
+    -0x1.7d40a48718ed9p+0,
+    -0x1.7d908f950e225p+0,
+    -0x1.7de07a7d19871p+0,
+    -0x1.7e30652dc5ce9p+0,
+    -0x1.7e804f9597fd2p+0,
+    -0x1.7ed039a312211p+0,
+    -0x1.7f202344b26a9p+0,
+    -0x1.7f700c68f2b2bp+0,
+    -0x1.7fbff4fe49babp+0,
+    -0x1.800fdcf32ae6cp+0,
+    -0x1.805fc43605dcap+0,
+    -0x1.80afaab545f8dp+0,
+    -0x1.80ff905f534e7p+0,
+    -0x1.814f7522919d8p+0,
+    -0x1.819f58ed6146ep+0,
+    -0x1.81ef3bae1db76p+0,
+    -0x1.823f1d5320f2dp+0,
+    -0x1.828efdcabf9fdp+0,
+    -0x1.82dedd0349cc7p+0,
+    -0x1.832ebaeb0cf7fp+0,
+    -0x1.837e97705300ep+0,
+    -0x1.83ce728162986p+0,
+    -0x1.841e4c0c7e067p+0,
+    -0x1.846e23ffe4daap+0,
+    -0x1.84bdfa49d1b89p+0,
+    -0x1.850dced87bc1p+0,
+    -0x1.855da19a1687dp+0,
+    -0x1.85ad727cd1242p+0,
+    -0x1.85fd416ed7779p+0,
+    -0x1.864d0e5e51d8fp+0,
+    -0x1.869cd93964242p+0,
+    -0x1.86eca1ee2dcep+0,
+    -0x1.873c686acd479p+0,
+    -0x1.878c2c9d5b92bp+0,
+    -0x1.87dbee73ed8p+0,
+    -0x1.882baddc9488ep+0,
+    -0x1.887b6ac55e1acp+0,
+    -0x1.88cb251c54166p+0,
+    -0x1.891adccf7bc5fp+0,
+    -0x1.896a91ccd85dcp+0,
+    -0x1.89ba440267a14p+0,
+    -0x1.8a09f35e24e6bp+0,
+    -0x1.8a599fce0788ap+0,
+    -0x1.8aa94940026a8p+0,
+    -0x1.8af8efa204ab9p+0,
+    -0x1.8b4892e1f96d2p+0,
+    -0x1.8b9832edc8794p+0,
+    -0x1.8be7cfb3546abp+0,
+    -0x1.8c3769207e74dp+0,
+    -0x1.8c86ff232208fp+0,
+    -0x1.8cd691a9193dp+0,
+    -0x1.8d2620a037c4p+0,
+    -0x1.8d75abf64eccp+0,
+    -0x1.8dc533992b22p+0,
+    -0x1.8e14b77695daap+0,
+    -0x1.8e64377c54226p+0,
+    -0x1.8eb3b39825caap+0,
+    -0x1.8f032bb7c86d4p+0,
+    -0x1.8f529fc8f6e7dp+0,
+    -0x1.8fa20fb9669afp+0,
+    -0x1.8ff17b76ca8a2p+0,
+    -0x1.9040e2eed149cp+0,
+    -0x1.9090460f24ac1p+0,
+    -0x1.90dfa4c56bd2ap+0,
+    -0x1.912efeff49e33p+0,
+    -0x1.917e54aa5d82ap+0,
+    -0x1.91cda5b441402p+0,
+    -0x1.921cf20a8b3p+0,
+    -0x1.926c399ad0748p+0,
+    -0x1.92bb7c52a0934p+0,
+    -0x1.930aba1f874d9p+0,
+    -0x1.9359f2ef0c491p+0,
+    -0x1.93a926aeb202p+0,
+    -0x1.93f8554bf9935p+0,
+    -0x1.94477eb45ec2dp+0,
+    -0x1.9496a2d55acb8p+0,
+    -0x1.94e5c19c60fc6p+0,
+    -0x1.9534daf6e171p+0,
+    -0x1.9583eed2483f2p+0,
+    -0x1.95d2fd1bfef98p+0,
+    -0x1.962205c16a74bp+0,
+    -0x1.967108afeb221p+0,
+    -0x1.96c005d4dd891p+0,
+    -0x1.970efd1d9b2b1p+0,
+    -0x1.975dee7779f5p+0,
+    -0x1.97acd9cfc91d4p+0,
+    -0x1.97fbbf13d794ep+0,
+    -0x1.984a9e30ef66cp+0,
+    -0x1.989977145748cp+0,
+    -0x1.98e849ab50879p+0,
+    -0x1.993715e31804ep+0,
+    -0x1.9985dba8e788dp+0,
+    -0x1.99d49ae9f49cp+0,
+    -0x1.9a235393711ebp+0,
+    -0x1.9a7205928b8bcp+0,
+    -0x1.9ac0b0d46e1bp+0,
+    -0x1.9b0f55463e22p+0,
+    -0x1.9b5df2d51f39fp+0,
+    -0x1.9bac896e2ea0fp+0,
+    -0x1.9bfb18fe8628p+0,
+    -0x1.9c49a1733c908p+0,
+    -0x1.9c9822b962f33p+0,
+    -0x1.9ce69cbe08a08p+0,
+    -0x1.9d350f6e38a78p+0,
+    -0x1.9d837ab6faca1p+0,
+    -0x1.9dd1de85518c9p+0,
+    -0x1.9e203ac63be0bp+0,
+    -0x1.9e6e8f66b4f3fp+0,
+    -0x1.9ebcdc53b34f1p+0,
+    -0x1.9f0b217a29535p+0,
+    -0x1.9f595ec70616cp+0,
+    -0x1.9fa7942734c15p+0,
+    -0x1.9ff5c1879b597p+0,
+    -0x1.a043e6d51d767p+0,
+    -0x1.a09203fc99d79p+0,
+    -0x1.a0e018eaec9d4p+0,
+    -0x1.a12e258cece85p+0,
+    -0x1.a17c29cf6d231p+0,
+    -0x1.a1ca259f3b707p+0,
+    -0x1.a21818e92250ep+0,
+    -0x1.a2660399fd89bp+0,
+    -0x1.a2b3e59ffa717p+0,
+    -0x1.a301beee112f6p+0,
+    -0x1.a34f8f7acb0b7p+0,
+    -0x1.a39d573e7f6b9p+0,
+    -0x1.a3eb163292319p+0,
+    -0x1.a438cc511e4cfp+0,
+    -0x1.a4867994c6b4ap+0,
+    -0x1.a4d41df898184p+0,
+    -0x1.a521b977f4f71p+0,
+    -0x1.a56f4c0e86e7bp+0,
+    -0x1.a5bcd5b834119p+0,
+    -0x1.a60a567116947p+0,
+    -0x1.a657ce357654fp+0,
+    -0x1.a6a53d01c3266p+0,
+    -0x1.a6f2a2d290fcdp+0,
+    -0x1.a73fffa493e8bp+0,
+    -0x1.a78d53749d1b8p+0,
+    -0x1.a7da9e3f98842p+0,
+    -0x1.a827e0028a522p+0,
+    -0x1.a87518ba8d5d3p+0,
+    -0x1.a8c24864d0d76p+0,
+    -0x1.a90f6efe9723ep+0,
+    -0x1.a95c8c8534a12p+0,
+    -0x1.a9a9a0f60e49fp+0,
+    -0x1.a9f6ac4e9885ap+0,
+    -0x1.aa43ae8c5679ap+0,
+    -0x1.aa90a7acd8dfbp+0,
+    -0x1.aadd97adbd3b8p+0,
+    -0x1.ab2a7e8cad85ap+0,
+    -0x1.ab775c475eed8p+0,
+    -0x1.abc430db91be4p+0,
+    -0x1.ac10fc4710cf7p+0,
+    -0x1.ac5dbe87b097p+0,
+    -0x1.acaa779b4edep+0,
+    -0x1.acf7277fd2399p+0,
+    -0x1.ad43ce3329e33p+0,
+    -0x1.ad906bb34d065p+0,
+    -0x1.addcfffe3aa05p+0,
+    -0x1.ae298b11f92f9p+0,
+    -0x1.ae760cec96242p+0,
+    -0x1.aec2858c25c42p+0,
+    -0x1.af0ef4eec2d69p+0,
+    -0x1.af5b5b128ff48p+0,
+    -0x1.afa7b7f5bd25ap+0,
+    -0x1.aff40b9684756p+0,
+    -0x1.b04055f3261e8p+0,
+    -0x1.b08c9709e81c1p+0,
+    -0x1.b0d8ced91588dp+0,
+    -0x1.b124fd5efeca8p+0,
+    -0x1.b1712299f948fp+0,
+    -0x1.b1bd3e885f1e5p+0,
+    -0x1.b20951288f629p+0,
+    -0x1.b2555a78edb48p+0,
+    -0x1.b2a15a77e245ap+0,
+    -0x1.b2ed5123d994ap+0,
+    -0x1.b3393e7b446dap+0,
+    -0x1.b385227c97e5cp+0,
+    -0x1.b3d0fd264d222p+0,
+    -0x1.b41cce76e11ffp+0,
+    -0x1.b468966cd4ea2p+0,
+    -0x1.b4b45506ad461p+0,
+    -0x1.b5000a42f2c16p+0,
+    -0x1.b54bb620315ccp+0,
+    -0x1.b597589cf88ddp+0,
+    -0x1.b5e2f1b7db7cbp+0,
+    -0x1.b62e816f70791p+0,
+    -0x1.b67a07c2513bbp+0,
+    -0x1.b6c584af1aca9p+0,
+    -0x1.b710f8346d4b6p+0,
+    -0x1.b75c6250ec116p+0,
+    -0x1.b7a7c3033d4ffp+0,
+    -0x1.b7f31a4a0a4e3p+0,
+    -0x1.b83e6823ff1f8p+0,
+    -0x1.b889ac8fcac36p+0,
+    -0x1.b8d4e78c1ef5bp+0,
+    -0x1.b9201917b032dp+0,
+    -0x1.b96b413135c55p+0,
+    -0x1.b9b65fd769948p+0,
+    -0x1.ba01750908147p+0,
+    -0x1.ba4c80c4d0422p+0,
+    -0x1.ba978309839f7p+0,
+    -0x1.bae27bd5e60b5p+0,
+    -0x1.bb2d6b28bdf19p+0,
+    -0x1.bb785100d3ddcp+0,
+    -0x1.bbc32d5cf2e44p+0,
+    -0x1.bc0e003be850ep+0,
+    -0x1.bc58c99c83971p+0,
+    -0x1.bca3897d967bap+0,
+    -0x1.bcee3fddf4d52p+0,
+    -0x1.bd38ecbc7499cp+0,
+    -0x1.bd839017ede55p+0,
+    -0x1.bdce29ef3ac3cp+0,
+    -0x1.be18ba41375abp+0,
+    -0x1.be63410cc1ef8p+0,
+    -0x1.beadbe50ba99cp+0,
+    -0x1.bef8320c03613p+0,
+    -0x1.bf429c3d803d8p+0,
+    -0x1.bf8cfce41700ap+0,
+    -0x1.bfd753feaf52dp+0,
+    -0x1.c021a18c3294cp+0,
+    -0x1.c06be58b8c115p+0,
+    -0x1.c0b61ffba8bep+0,
+    -0x1.c10050db774cap+0,
+    -0x1.c14a7829e8379p+0,
+    -0x1.c19495e5eda7ap+0,
+    -0x1.c1deaa0e7b647p+0,
+    -0x1.c228b4a286e02p+0,
+    -0x1.c272b5a1071bcp+0,
+    -0x1.c2bcad08f4a12p+0,
+    -0x1.c3069ad9499eep+0,
+    -0x1.c3507f1101d25p+0,
+    -0x1.c39a59af1a89bp+0,
+    -0x1.c3e42ab292726p+0,
+    -0x1.c42df21a69ce9p+0,
+    -0x1.c477afe5a2519p+0,
+    -0x1.c4c164133f11cp+0,
+    -0x1.c50b0ea2449c9p+0,
+    -0x1.c554af91b8e0cp+0,
+    -0x1.c59e46e0a341fp+0,
+    -0x1.c5e7d48e0c791p+0,
+    -0x1.c6315898fe868p+0,
+    -0x1.c67ad30084c5fp+0,
+    -0x1.c6c443c3ac03fp+0,
+    -0x1.c70daae1825eap+0,
+    -0x1.c75708591717ap+0,
+    -0x1.c7a05c297abbfp+0,
+    -0x1.c7e9a651bf103p+0,
+    -0x1.c832e6d0f71a6p+0,
+    -0x1.c87c1da6372fep+0,
+    -0x1.c8c54ad094df9p+0,
+    -0x1.c90e6e4f26e1fp+0,
+    -0x1.c957882105172p+0,
+    -0x1.c9a09845489ccp+0,
+    -0x1.c9e99ebb0bb23p+0,
+    -0x1.ca329b8169a89p+0,
+    -0x1.ca7b8e977ef8ap+0,
+    -0x1.cac477fc6936fp+0,
+    -0x1.cb0d57af471ddp+0,
+    -0x1.cb562daf388b1p+0,
+    -0x1.cb9ef9fb5e686p+0,
+    -0x1.cbe7bc92daa59p+0,
+    -0x1.cc307574d03a3p+0,
+    -0x1.cc7924a06331bp+0,
+    -0x1.ccc1ca14b8af3p+0,
+    -0x1.cd0a65d0f6c7ep+0,
+    -0x1.cd52f7d4449dp+0,
+    -0x1.cd9b801dca39cp+0,
+    -0x1.cde3feacb0bd3p+0,
+    -0x1.ce2c7380224e6p+0,
+    -0x1.ce74de974a044p+0,
+    -0x1.cebd3ff153de2p+0,
+    -0x1.cf05978d6cd34p+0,
+    -0x1.cf4de56ac2d4ep+0,
+    -0x1.cf96298884b48p+0,
+    -0x1.cfde63e5e23dap+0,
+    -0x1.d02694820c17fp+0,
+    -0x1.d06ebb5c33d17p+0,
+    -0x1.d0b6d8738be22p+0,
+    -0x1.d0feebc747bc1p+0,
+    -0x1.d146f5569bafap+0,
+    -0x1.d18ef520bcd18p+0,
+    -0x1.d1d6eb24e1268p+0,
+    -0x1.d21ed7623f6e1p+0,
+    -0x1.d266b9d80f658p+0,
+    -0x1.d2ae9285898c9p+0,
+    -0x1.d2f66169e73f5p+0,
+    -0x1.d33e268462aa3p+0,
+    -0x1.d385e1d436b6p+0,
+    -0x1.d3cd93589f43bp+0,
+    -0x1.d4153b10d8ecbp+0,
+    -0x1.d45cd8fc2118ep+0,
+    -0x1.d4a46d19b5e2ap+0,
+    -0x1.d4ebf768d6468p+0,
+    -0x1.d53377e8c1fdbp+0,
+    -0x1.d57aee98b985ap+0,
+    -0x1.d5c25b77fe1c5p+0,
+    -0x1.d609be85d1ac8p+0,
+    -0x1.d65117c17701p+0,
+    -0x1.d698672a31973p+0,
+    -0x1.d6dfacbf45a12p+0,
+    -0x1.d726e87ff8016p+0,
+    -0x1.d76e1a6b8e5bp+0,
+    -0x1.d7b542814f09ap+0,
+    -0x1.d7fc60c081236p+0,
+    -0x1.d84375286c6fp+0,
+    -0x1.d88a7fb85957ep+0,
+    -0x1.d8d1806f90fep+0,
+    -0x1.d918774d5d33ep+0,
+    -0x1.d95f6451088e9p+0,
+    -0x1.d9a64779de41cp+0,
+    -0x1.d9ed20c72a23fp+0,
+    -0x1.da33f03838b25p+0,
+    -0x1.da7ab5cc5712ap+0,
+    -0x1.dac17182d3194p+0,
+    -0x1.db08235afb415p+0,
+    -0x1.db4ecb541ea4ap+0,
+    -0x1.db95696d8d03ap+0,
+    -0x1.dbdbfda696c99p+0,
+    -0x1.dc2287fe8cf64p+0,
+    -0x1.dc690874c11c9p+0,
+    -0x1.dcaf7f0885701p+0,
+    -0x1.dcf5ebb92cc2fp+0,
+    -0x1.dd3c4e860a8c2p+0,
+    -0x1.dd82a76e72e55p+0,
+    -0x1.ddc8f671ba79p+0,
+    -0x1.de0f3b8f367a9p+0,
+    -0x1.de5576c63cb63p+0,
+    -0x1.de9ba8162398dp+0,
+    -0x1.dee1cf7e42205p+0,
+    -0x1.df27ecfdefd54p+0,
+    -0x1.df6e009484dd1p+0,
+    -0x1.dfb40a4159fp+0,
+    -0x1.dffa0a03c8573p+0,
+    -0x1.e03fffdb29f08p+0,
+    -0x1.e085ebc6d91edp+0,
+    -0x1.e0cbcdc630c4p+0,
+    -0x1.e111a5d88c56cp+0,
+    -0x1.e15773fd47e0ap+0,
+    -0x1.e19d3833bfe61p+0,
+    -0x1.e1e2f27b517a7p+0,
+    -0x1.e228a2d35a3c1p+0,
+    -0x1.e26e493b385a3p+0,
+    -0x1.e2b3e5b24a80dp+0,
+    -0x1.e2f97837efd93p+0,
+    -0x1.e33f00cb881b5p+0,
+    -0x1.e3847f6c73802p+0,
+    -0x1.e3c9f41a12c3ap+0,
+    -0x1.e40f5ed3c714ep+0,
+    -0x1.e454bf98f233bp+0,
+    -0x1.e49a1668f65fp+0,
+    -0x1.e4df634336609p+0,
+    -0x1.e524a627155d7p+0,
+    -0x1.e569df13f7019p+0,
+    -0x1.e5af0e093f93cp+0,
+    -0x1.e5f4330653bdfp+0,
+    -0x1.e6394e0a98a13p+0,
+    -0x1.e67e5f1573d97p+0,
+    -0x1.e6c366264b81cp+0,
+    -0x1.e708633c86304p+0,
+    -0x1.e74d56578af5fp+0,
+    -0x1.e7923f76c14d1p+0,
+    -0x1.e7d71e999126ep+0,
+    -0x1.e81bf3bf62f7bp+0,
+    -0x1.e860bee79f9cep+0,
+    -0x1.e8a58011b061p+0,
+    -0x1.e8ea373cff07ap+0,
+    -0x1.e92ee468f5c18p+0,
+    -0x1.e9738794ff3c6p+0,
+    -0x1.e9b820c0868f1p+0,
+    -0x1.e9fcafeaf74f8p+0,
+    -0x1.ea413513bd6eep+0,
+    -0x1.ea85b03a45595p+0,
+    -0x1.eaca215dfbda4p+0,
+    -0x1.eb0e887e4e48p+0,
+    -0x1.eb52e59aaa4e3p+0,
+    -0x1.eb9738b27dfbcp+0,
+    -0x1.ebdb81c537e07p+0,
+    -0x1.ec1fc0d246e36p+0,
+    -0x1.ec63f5d91a5cdp+0,
+    -0x1.eca820d9220e2p+0,
+    -0x1.ecec41d1ce25fp+0,
+    -0x1.ed3058c28f33ep+0,
+    -0x1.ed7465aad63aep+0,
+    -0x1.edb8688a149d1p+0,
+    -0x1.edfc615fbc239p+0,
+    -0x1.ee40502b3efefp+0,
+    -0x1.ee8434ec0fbcep+0,
+    -0x1.eec80fa1a1563p+0,
+    -0x1.ef0be04b67231p+0,
+    -0x1.ef4fa6e8d4e6bp+0,
+    -0x1.ef9363795ec19p+0,
+    -0x1.efd715fc79377p+0,
+    -0x1.f01abe7199255p+0,
+    -0x1.f05e5cd833c96p+0,
+    -0x1.f0a1f12fbed11p+0,
+    -0x1.f0e57b77b046fp+0,
+    -0x1.f128fbaf7e81p+0,
+    -0x1.f16c71d6a0427p+0,
+    -0x1.f1afddec8cbd8p+0,
+    -0x1.f1f33ff0bb71ep+0,
+    -0x1.f23697e2a4289p+0,
+    -0x1.f279e5c1bf19dp+0,
+    -0x1.f2bd298d84dbp+0,
+    -0x1.f30063456e5cep+0,
+    -0x1.f34392e8f4e77p+0,
+    -0x1.f386b87792201p+0,
+    -0x1.f3c9d3f0c0093p+0,
+    -0x1.f40ce553f8fcbp+0,
+    -0x1.f44feca0b7afbp+0,
+    -0x1.f492e9d6772cap+0,
+    -0x1.f4d5dcf4b2d34p+0,
+    -0x1.f518c5fae65cbp+0,
+    -0x1.f55ba4e88dd54p+0,
+    -0x1.f59e79bd25acap+0,
+    -0x1.f5e144782a97dp+0,
+    -0x1.f624051919a73p+0,
+    -0x1.f666bb9f703a6p+0,
+    -0x1.f6a9680aac0c6p+0,
+    -0x1.f6ec0a5a4b495p+0,
+    -0x1.f72ea28dcc54dp+0,
+    -0x1.f77130a4ade5cp+0,
+    -0x1.f7b3b49e6f0e8p+0,
+    -0x1.f7f62e7a8f2cap+0,
+    -0x1.f8389e388de93p+0,
+    -0x1.f87b03d7eb488p+0,
+    -0x1.f8bd5f5827a24p+0,
+    -0x1.f8ffb0b8c389ap+0,
+    -0x1.f941f7f94008ep+0,
+    -0x1.f98435191e65cp+0,
+    -0x1.f9c66817e0317p+0,
+    -0x1.fa0890f507409p+0,
+    -0x1.fa4aafb015cbp+0,
+    -0x1.fa8cc4488e55fp+0,
+    -0x1.facecebdf3ac1p+0,
+    -0x1.fb10cf0fc8ef5p+0,
+    -0x1.fb52c53d917f4p+0,
+    -0x1.fb94b146d11a9p+0,
+    -0x1.fbd6932b0bc98p+0,
+    -0x1.fc186ae9c5df9p+0,
+    -0x1.fc5a388283f3cp+0,
+    -0x1.fc9bfbf4caec8p+0,
+    -0x1.fcddb5401fff9p+0,
+    -0x1.fd1f646408a62p+0,
+    -0x1.fd6109600aa6dp+0,
+    -0x1.fda2a433ac13bp+0,
+    -0x1.fde434de734a1p+0,
+    -0x1.fe25bb5fe6e6ep+0,
+    -0x1.fe6737b78dde6p+0,
+    -0x1.fea8a9e4ef625p+0,
+    -0x1.feea11e792e7dp+0,
+    -0x1.ff2b6fbf002b8p+0,
+    -0x1.ff6cc36abf376p+0,
+    -0x1.ffae0cea586ecp+0,
+    -0x1.ffef4c3d546c8p+0,
+    -0x1.001840b19e097p+1,
+    -0x1.0038d62dcc43ep+1,
+    -0x1.00596692f99ep+1,
+    -0x1.0079f1e0eaf04p+1,
+    -0x1.009a78176531bp+1,
+    -0x1.00baf9362d7c2p+1,
+    -0x1.00db753d090ep+1,
+    -0x1.00fbec2bbd4cap+1,
+    -0x1.011c5e020fbdep+1,
+    -0x1.013ccabfc6087p+1,
+    -0x1.015d3264a5efdp+1,
+    -0x1.017d94f0755c1p+1,
+    -0x1.019df262fa573p+1,
+    -0x1.01be4abbfb0fcp+1,
+    -0x1.01de9dfb3dd12p+1,
+    -0x1.01feec2089077p+1,
+    -0x1.021f352ba33d9p+1,
+    -0x1.023f791c531e2p+1,
+    -0x1.025fb7f25f797p+1,
+    -0x1.027ff1ad8f3f9p+1,
+    -0x1.02a0264da97d5p+1,
+    -0x1.02c055d2755c5p+1,
+    -0x1.02e0803bba2edp+1,
+    -0x1.0300a5893f66fp+1,
+    -0x1.0320c5bacc907p+1,
+    -0x1.0340e0d02954fp+1,
+    -0x1.0360f6c91d7fdp+1,
+    -0x1.038107a570fb1p+1,
+    -0x1.03a11364ebd09p+1,
+    -0x1.03c11a07562dep+1,
+    -0x1.03e11b8c78595p+1,
+    -0x1.040117f41ab9fp+1,
+    -0x1.04210f3e05d8ap+1,
+    -0x1.0441016a0258fp+1,
+    -0x1.0460ee77d8fb3p+1,
+    -0x1.0480d667529dap+1,
+    -0x1.04a0b938383a3p+1,
+    -0x1.04c096ea52e49p+1,
+    -0x1.04e06f7d6bda1p+1,
+    -0x1.050042f14c70fp+1,
+    -0x1.05201145be182p+1,
+    -0x1.053fda7a8a5f8p+1,
+    -0x1.055f9e8f7af66p+1,
+    -0x1.057f5d8459ab1p+1,
+    -0x1.059f1758f061ap+1,
+    -0x1.05becc0d0921dp+1,
+    -0x1.05de7ba06e094p+1,
+    -0x1.05fe2612e9544p+1,
+    -0x1.061dcb64455dfp+1,
+    -0x1.063d6b944c9d4p+1,
+    -0x1.065d06a2c99fep+1,
+    -0x1.067c9c8f87145p+1,
+    -0x1.069c2d5a4fc8bp+1,
+    -0x1.06bbb902ee9f1p+1,
+    -0x1.06db3f892e985p+1,
+    -0x1.06fac0ecdad3ep+1,
+    -0x1.071a3d2dbe8c3p+1,
+    -0x1.0739b44ba50f6p+1,
+    -0x1.0759264659cd5p+1,
+    -0x1.0778931da850cp+1,
+    -0x1.0797fad15c3e4p+1,
+    -0x1.07b75d614157fp+1,
+    -0x1.07d6bacd2375p+1,
+    -0x1.07f61314ce8d4p+1,
+    -0x1.081566380eb15p+1,
+    -0x1.0834b436b00fap+1,
+    -0x1.0853fd107eec6p+1,
+    -0x1.087340c547a4bp+1,
+    -0x1.08927f54d6b43p+1,
+    -0x1.08b1b8bef8adap+1,
+    -0x1.08d0ed037a3d5p+1,
+    -0x1.08f01c2228278p+1,
+    -0x1.090f461acf522p+1,
+    -0x1.092e6aed3cbafp+1,
+    -0x1.094d8a993d798p+1,
+    -0x1.096ca51e9eba2p+1,
+    -0x1.098bba7d2dc03p+1,
+    -0x1.09aacab4b7e78p+1,
+    -0x1.09c9d5c50aa8fp+1,
+    -0x1.09e8dbadf3991p+1,
+    -0x1.0a07dc6f40633p+1,
+    -0x1.0a26d808becf8p+1,
+    -0x1.0a45ce7a3cb9p+1,
+    -0x1.0a64bfc388158p+1,
+    -0x1.0a83abe46ef68p+1,
+    -0x1.0aa292dcbf827p+1,
+    -0x1.0ac174ac47f68p+1,
+    -0x1.0ae05152d6a8bp+1,
+    -0x1.0aff28d03a0adp+1,
+    -0x1.0b1dfb2440a69p+1,
+    -0x1.0b3cc84eb91a5p+1,
+    -0x1.0b5b904f721e4p+1,
+    -0x1.0b7a53263a808p+1,
+    -0x1.0b9910d2e129ep+1,
+    -0x1.0bb7c955351a2p+1,
+    -0x1.0bd67cad0562cp+1,
+    -0x1.0bf52ada2132p+1,
+    -0x1.0c13d3dc57cdp+1,
+    -0x1.0c3277b37892cp+1,
+    -0x1.0c51165f52f6fp+1,
+    -0x1.0c6fafdfb6852p+1,
+    -0x1.0c8e443472e0bp+1,
+    -0x1.0cacd35d57b9ep+1,
+    -0x1.0ccb5d5a34e2bp+1,
+    -0x1.0ce9e22ada41fp+1,
+    -0x1.0d0861cf17d75p+1,
+    -0x1.0d26dc46bdb74p+1,
+    -0x1.0d4551919c0d1p+1,
+    -0x1.0d63c1af831aep+1,
+    -0x1.0d822ca04337ap+1,
+    -0x1.0da09263acd2p+1,
+    -0x1.0dbef2f99067cp+1,
+    -0x1.0ddd4e61be923p+1,
+    -0x1.0dfba49c08019p+1,
+    -0x1.0e19f5a83d7efp+1,
+    -0x1.0e3841862fe44p+1,
+    -0x1.0e568835b0223p+1,
+    -0x1.0e74c9b68f434p+1,
+    -0x1.0e9306089e62dp+1,
+    -0x1.0eb13d2baeb21p+1,
+    -0x1.0ecf6f1f91791p+1,
+    -0x1.0eed9be41814cp+1,
+    -0x1.0f0bc37913fabp+1,
+    -0x1.0f29e5de56b17p+1,
+    -0x1.0f480313b1d46p+1,
+    -0x1.0f661b18f713bp+1,
+    -0x1.0f842dedf8395p+1,
+    -0x1.0fa23b9287243p+1,
+    -0x1.0fc0440675c7fp+1,
+    -0x1.0fde474996291p+1,
+    -0x1.0ffc455bba62fp+1,
+    -0x1.101a3e3cb49edp+1,
+    -0x1.103831ec571fbp+1,
+    -0x1.1056206a74427p+1,
+    -0x1.107409b6de71cp+1,
+    -0x1.1091edd168302p+1,
+    -0x1.10afccb9e413p+1,
+    -0x1.10cda67024c09p+1,
+    -0x1.10eb7af3fcfbep+1,
+    -0x1.11094a453f9adp+1,
+    -0x1.11271463bf7f1p+1,
+    -0x1.1144d94f4fa25p+1,
+    -0x1.11629907c311fp+1,
+    -0x1.1180538cecee3p+1,
+    -0x1.119e08dea06d3p+1,
+    -0x1.11bbb8fcb0d8ep+1,
+    -0x1.11d963e6f1911p+1,
+    -0x1.11f7099d36065p+1,
+    -0x1.1214aa1f51b64p+1,
+    -0x1.1232456d183a2p+1,
+    -0x1.124fdb865d3f2p+1,
+    -0x1.126d6c6af4804p+1,
+    -0x1.128af81ab1cd7p+1,
+    -0x1.12a87e9569144p+1,
+    -0x1.12c5ffdaee496p+1,
+    -0x1.12e37beb15754p+1,
+    -0x1.1300f2c5b2b8p+1,
+    -0x1.131e646a9a3cep+1,
+    -0x1.133bd0d9a049cp+1,
+    -0x1.1359381299388p+1,
+    -0x1.13769a155970cp+1,
+    -0x1.1393f6e1b56cp+1,
+    -0x1.13b14e7781b9bp+1,
+    -0x1.13cea0d692f9fp+1,
+    -0x1.13ebedfebdd9fp+1,
+    -0x1.140935efd7219p+1,
+    -0x1.142678a9b3a9ap+1,
+    -0x1.1443b62c285ccp+1,
+    -0x1.1460ee770a3a6p+1,
+    -0x1.147e218a2e4ffp+1,
+    -0x1.149b4f6569b99p+1,
+    -0x1.14b8780891ab6p+1,
+    -0x1.14d59b737b6a4p+1,
+    -0x1.14f2b9a5fc4fp+1,
+    -0x1.150fd29fe9c24p+1,
+    -0x1.152ce66119407p+1,
+    -0x1.1549f4e96055ep+1,
+    -0x1.1566fe3894a2ep+1,
+    -0x1.1584024e8bd66p+1,
+    -0x1.15a1012b1bb06p+1,
+    -0x1.15bdface1a01bp+1,
+    -0x1.15daef375cacp+1,
+    -0x1.15f7de66b9aacp+1,
+    -0x1.1614c85c07035p+1,
+    -0x1.1631ad171acep+1,
+    -0x1.164e8c97cb34dp+1,
+    -0x1.166b66ddee71cp+1,
+    -0x1.16883be95ad59p+1,
+    -0x1.16a50bb9e6bfp+1,
+    -0x1.16c1d64f689f9p+1,
+    -0x1.16de9ba9b6eccp+1,
+    -0x1.16fb5bc8a836ep+1,
+    -0x1.171816ac131e1p+1,
+    -0x1.1734cc53ce584p+1,
+    -0x1.17517cbfb0a86p+1,
+    -0x1.176e27ef90e33p+1,
+    -0x1.178acde345e94p+1,
+    -0x1.17a76e9aa6b03p+1,
+    -0x1.17c40a158a413p+1,
+    -0x1.17e0a053c7ae9p+1,
+    -0x1.17fd315536206p+1,
+    -0x1.1819bd19accd9p+1,
+    -0x1.183643a102fb1p+1,
+    -0x1.1852c4eb10018p+1,
+    -0x1.186f40f7ab496p+1,
+    -0x1.188bb7c6ac4d3p+1,
+    -0x1.18a82957ea905p+1,
+    -0x1.18c495ab3dacdp+1,
+    -0x1.18e0fcc07d4fdp+1,
+    -0x1.18fd5e9781324p+1,
+    -0x1.1919bb302118fp+1,
+    -0x1.1936128a34e08p+1,
+    -0x1.195264a5946c8p+1,
+    -0x1.196eb18217b56p+1,
+    -0x1.198af91f96c26p+1,
+    -0x1.19a73b7de9a9cp+1,
+    -0x1.19c3789ce8979p+1,
+    -0x1.19dfb07c6bc1bp+1,
+    -0x1.19fbe31c4b71ep+1,
+    -0x1.1a18107c5ffadp+1,
+    -0x1.1a34389c81c22p+1,
+    -0x1.1a505b7c893e4p+1,
+    -0x1.1a6c791c4ef07p+1,
+    -0x1.1a88917bab6dfp+1,
+    -0x1.1aa4a49a775ccp+1,
+    -0x1.1ac0b2788b6cdp+1,
+    -0x1.1adcbb15c05f1p+1,
+    -0x1.1af8be71ef09p+1,
+    -0x1.1b14bc8cf04c5p+1,
+    -0x1.1b30b5669d128p+1,
+    -0x1.1b4ca8fece5cep+1,
+    -0x1.1b6897555d36ap+1,
+    -0x1.1b84806a22bcfp+1,
+    -0x1.1ba0643cf81bbp+1,
+    -0x1.1bbc42cdb68ddp+1,
+    -0x1.1bd81c1c37591p+1,
+    -0x1.1bf3f02853d6p+1,
+    -0x1.1c0fbef1e56c3p+1,
+    -0x1.1c2b8878c592p+1,
+    -0x1.1c474cbccdc8cp+1,
+    -0x1.1c630bbdd7a4ap+1,
+    -0x1.1c7ec57bbcc7ap+1,
+    -0x1.1c9a79f656e1bp+1,
+    -0x1.1cb6292d7fb59p+1,
+    -0x1.1cd1d321110fp+1,
+    -0x1.1ced77d0e4c39p+1,
+    -0x1.1d09173cd4c0cp+1,
+    -0x1.1d24b164bb04dp+1,
+    -0x1.1d40464871931p+1,
+    -0x1.1d5bd5e7d27bbp+1,
+    -0x1.1d776042b7e4bp+1,
+    -0x1.1d92e558fbfcfp+1,
+    -0x1.1dae652a79044p+1,
+    -0x1.1dc9dfb709465p+1,
+    -0x1.1de554fe871fbp+1,
+    -0x1.1e00c500ccf5ep+1,
+    -0x1.1e1c2fbdb5432p+1,
+    -0x1.1e3795351a8dcp+1,
+    -0x1.1e52f566d76adp+1,
+    -0x1.1e6e5052c67b5p+1,
+    -0x1.1e89a5f8c2694p+1,
+    -0x1.1ea4f658a5ee7p+1,
+    -0x1.1ec041724bd78p+1,
+    -0x1.1edb87458f03p+1,
+    -0x1.1ef6c7d24a526p+1,
+    -0x1.1f12031858b71p+1,
+    -0x1.1f2d391795383p+1,
+    -0x1.1f4869cfdae11p+1,
+    -0x1.1f63954104caap+1,
+    -0x1.1f7ebb6aee1fep+1,
+    -0x1.1f99dc4d72198p+1,
+    -0x1.1fb4f7e86bf46p+1,
+    -0x1.1fd00e3bb7031p+1,
+    -0x1.1feb1f472eaa1p+1,
+    -0x1.20062b0aae56cp+1,
+    -0x1.2021318611827p+1,
+    -0x1.203c32b933b64p+1,
+    -0x1.20572ea3f0875p+1,
+    -0x1.2072254623949p+1,
+    -0x1.208d169fa88dfp+1,
+    -0x1.20a802b05b293p+1,
+    -0x1.20c2e978172a1p+1,
+    -0x1.20ddcaf6b86f1p+1,
+    -0x1.20f8a72c1ae09p+1,
+    -0x1.21137e181a69fp+1,
+    -0x1.212e4fba93028p+1,
+    -0x1.21491c1360b47p+1,
+    -0x1.2163e3225f93cp+1,
+    -0x1.217ea4e76bc16p+1,
+    -0x1.2199616261704p+1,
+    -0x1.21b418931cda1p+1,
+    -0x1.21ceca797a467p+1,
+    -0x1.21e97715560bp+1,
+    -0x1.22041e668c8c3p+1,
+    -0x1.221ec06cfa394p+1,
+    -0x1.22395d287b928p+1,
+    -0x1.2253f498ed1ep+1,
+    -0x1.226e86be2b6cep+1,
+    -0x1.228913981321p+1,
+    -0x1.22a39b2680eb4p+1,
+    -0x1.22be1d6951826p+1,
+    -0x1.22d89a6061ac1p+1,
+    -0x1.22f3120b8e3dep+1,
+    -0x1.230d846ab4164p+1,
+    -0x1.2327f17db01e8p+1,
+    -0x1.234259445f4bfp+1,
+    -0x1.235cbbbe9ea0cp+1,
+    -0x1.237718ec4b2ep+1,
+    -0x1.239170cd420e9p+1,
+    -0x1.23abc361606b7p+1,
+    -0x1.23c610a883776p+1,
+    -0x1.23e058a28873p+1,
+    -0x1.23fa9b4f4caap+1,
+    -0x1.2414d8aead78cp+1,
+    -0x1.242f10c08842ap+1,
+    -0x1.24494384ba78p+1,
+    -0x1.246370fb21921p+1,
+    -0x1.247d99239b16p+1,
+    -0x1.2497bbfe0497cp+1,
+    -0x1.24b1d98a3bb55p+1,
+    -0x1.24cbf1c81e1b8p+1,
+    -0x1.24e604b78982fp+1,
+    -0x1.250012585bad6p+1,
+    -0x1.251a1aaa726a6p+1,
+    -0x1.25341dadab926p+1,
+    -0x1.254e1b61e508cp+1,
+    -0x1.256813c6fcbddp+1,
+    -0x1.258206dcd0b1bp+1,
+    -0x1.259bf4a33eef7p+1,
+    -0x1.25b5dd1a25871p+1,
+    -0x1.25cfc04162979p+1,
+    -0x1.25e99e18d44fap+1,
+    -0x1.260376a058e51p+1,
+    -0x1.261d49d7ce929p+1,
+    -0x1.263717bf13a5ap+1,
+    -0x1.2650e056067bbp+1,
+    -0x1.266aa39c85772p+1,
+    -0x1.268461926f053p+1,
+    -0x1.269e1a37a1a21p+1,
+    -0x1.26b7cd8bfbd3fp+1,
+    -0x1.26d17b8f5c2dcp+1,
+    -0x1.26eb2441a1486p+1,
+    -0x1.2704c7a2a9c9bp+1,
+    -0x1.271e65b254617p+1,
+    -0x1.2737fe707fcd5p+1,
+    -0x1.275191dd0ad3ep+1,
+    -0x1.276b1ff7d4479p+1,
+    -0x1.2784a8c0bb0adp+1,
+    -0x1.279e2c379e0aep+1,
+    -0x1.27b7aa5c5c38p+1,
+    -0x1.27d1232ed48b5p+1,
+    -0x1.27ea96aee611ep+1,
+    -0x1.280404dc6fdcap+1,
+    -0x1.281d6db7510a9p+1,
+    -0x1.2836d13f68c96p+1,
+    -0x1.28502f74964cbp+1,
+    -0x1.28698856b8d64p+1,
+    -0x1.2882dbe5afb38p+1,
+    -0x1.289c2a215a38ep+1,
+    -0x1.28b5730997c2dp+1,
+    -0x1.28ceb69e47bb9p+1,
+    -0x1.28e7f4df49966p+1,
+    -0x1.29012dcc7cd14p+1,
+    -0x1.291a6165c0f75p+1,
+    -0x1.29338faaf5a17p+1,
+    -0x1.294cb89bfa6d8p+1,
+    -0x1.2965dc38af045p+1,
+    -0x1.297efa80f31d8p+1,
+    -0x1.29981374a678bp+1,
+    -0x1.29b12713a8dc7p+1,
+    -0x1.29ca355dda1a2p+1,
+    -0x1.29e33e531a0f3p+1,
+    -0x1.29fc41f348a4ep+1,
+    -0x1.2a15403e45d06p+1,
+    -0x1.2a2e3933f190dp+1,
+    -0x1.2a472cd42beb3p+1,
+    -0x1.2a601b1ed4f36p+1,
+    -0x1.2a790413ccc16p+1,
+    -0x1.2a91e7b2f37cfp+1,
+    -0x1.2aaac5fc2956cp+1,
+    -0x1.2ac39eef4e877p+1,
+    -0x1.2adc728c43549p+1,
+    -0x1.2af540d2e80aap+1,
+    -0x1.2b0e09c31d04fp+1,
+    -0x1.2b26cd5cc2a2ep+1,
+    -0x1.2b3f8b9fb9549p+1,
+    -0x1.2b58448be1953p+1,
+    -0x1.2b70f8211be0ep+1,
+    -0x1.2b89a65f48c09p+1,
+    -0x1.2ba24f4648ca3p+1,
+    -0x1.2bbaf2d5fc9d8p+1,
+    -0x1.2bd3910e44df6p+1,
+    -0x1.2bec29ef02437p+1,
+    -0x1.2c04bd78158c3p+1,
+    -0x1.2c1d4ba95f7f3p+1,
+    -0x1.2c35d482c0e6fp+1,
+    -0x1.2c4e58041aa0bp+1,
+    -0x1.2c66d62d4d8dep+1,
+    -0x1.2c7f4efe3a9b9p+1,
+    -0x1.2c97c276c2c0fp+1,
+    -0x1.2cb03096c7011p+1,
+    -0x1.2cc8995e2861ep+1,
+    -0x1.2ce0fcccc7fa4p+1,
+    -0x1.2cf95ae286ecp+1,
+    -0x1.2d11b39f465ap+1,
+    -0x1.2d2a0702e773dp+1,
+    -0x1.2d42550d4b75p+1,
+    -0x1.2d5a9dbe53a02p+1,
+    -0x1.2d72e115e140cp+1,
+    -0x1.2d8b1f13d5b21p+1,
+    -0x1.2da357b812516p+1,
+    -0x1.2dbb8b027886p+1,
+    -0x1.2dd3b8f2e9c61p+1,
+    -0x1.2debe18947909p+1,
+    -0x1.2e0404c5736c8p+1,
+    -0x1.2e1c22a74ee3cp+1,
+    -0x1.2e343b2ebb923p+1,
+    -0x1.2e4c4e5b9b16bp+1,
+    -0x1.2e645c2dcf1aep+1,
+    -0x1.2e7c64a539595p+1,
+    -0x1.2e9467c1bb8eap+1,
+    -0x1.2eac658337803p+1,
+    -0x1.2ec45de98eff8p+1,
+    -0x1.2edc50f4a3e8ep+1,
+    -0x1.2ef43ea4581f7p+1,
+    -0x1.2f0c26f88d8d8p+1,
+    -0x1.2f2409f126272p+1,
+    -0x1.2f3be78e03e87p+1,
+    -0x1.2f53bfcf08d85p+1,
+    -0x1.2f6b92b41707ap+1,
+    -0x1.2f83603d108c5p+1,
+    -0x1.2f9b2869d78a1p+1,
+    -0x1.2fb2eb3a4e2f8p+1,
+    -0x1.2fcaa8ae56af5p+1,
+    -0x1.2fe260c5d345fp+1,
+    -0x1.2ffa1380a639fp+1,
+    -0x1.3011c0deb1d6bp+1,
+    -0x1.302968dfd8748p+1,
+    -0x1.30410b83fc75bp+1,
+    -0x1.3058a8cb00485p+1,
+    -0x1.307040b4c65c9p+1,
+    -0x1.3087d341312e7p+1,
+    -0x1.309f60702342fp+1,
+    -0x1.30b6e8417f28ep+1,
+    -0x1.30ce6ab527772p+1,
+    -0x1.30e5e7cafecd7p+1,
+    -0x1.30fd5f82e7d08p+1,
+    -0x1.3114d1dcc532fp+1,
+    -0x1.312c3ed879b05p+1,
+    -0x1.3143a675e8032p+1,
+    -0x1.315b08b4f2f7cp+1,
+    -0x1.317265957d609p+1,
+    -0x1.3189bd176a16ep+1,
+    -0x1.31a10f3a9c00dp+1,
+    -0x1.31b85bfef60aap+1,
+    -0x1.31cfa3645b2a5p+1,
+    -0x1.31e6e56aae56fp+1,
+    -0x1.31fe2211d29d7p+1,
+    -0x1.32155959ab109p+1,
+    -0x1.322c8b421ac53p+1,
+    -0x1.3243b7cb04dap+1,
+    -0x1.325adef44c78bp+1,
+    -0x1.327200bdd4d1fp+1,
+    -0x1.32891d27811d3p+1,
+    -0x1.32a03431349dfp+1,
+    -0x1.32b745dad2a38p+1,
+    -0x1.32ce52243e7c5p+1,
+    -0x1.32e5590d5b859p+1,
+    -0x1.32fc5a960d247p+1,
+    -0x1.331356be36c12p+1,
+    -0x1.332a4d85bbcdbp+1,
+    -0x1.33413eec7fc63p+1,
+    -0x1.33582af2662b8p+1,
+    -0x1.336f1197528b8p+1,
+    -0x1.3385f2db287dp+1,
+    -0x1.339ccebdcb9ecp+1,
+    -0x1.33b3a53f1f916p+1,
+    -0x1.33ca765f08049p+1,
+    -0x1.33e1421d68addp+1,
+    -0x1.33f8087a254b9p+1,
+    -0x1.340ec97521a45p+1,
+    -0x1.3425850e41875p+1,
+    -0x1.343c3b4568c7fp+1,
+    -0x1.3452ec1a7b436p+1,
+    -0x1.3469978d5ce1cp+1,
+    -0x1.34803d9df1923p+1,
+    -0x1.3496de4c1d4acp+1,
+    -0x1.34ad7997c40b5p+1,
+    -0x1.34c40f80c9d9dp+1,
+    -0x1.34daa00712c02p+1,
+    -0x1.34f12b2a82d51p+1,
+    -0x1.3507b0eafe365p+1,
+    -0x1.351e314869069p+1,
+    -0x1.3534ac42a7786p+1,
+    -0x1.354b21d99dc33p+1,
+    -0x1.3561920d30239p+1,
+    -0x1.3577fcdd42dcep+1,
+    -0x1.358e6249ba3c7p+1,
+    -0x1.35a4c2527a979p+1,
+    -0x1.35bb1cf7684c8p+1,
+    -0x1.35d1723867bd5p+1,
+    -0x1.35e7c2155d563p+1,
+    -0x1.35fe0c8e2d8e2p+1,
+    -0x1.361451a2bce41p+1,
+    -0x1.362a9152efdedp+1,
+    -0x1.3640cb9eab065p+1,
+    -0x1.36570085d2ed6p+1,
+    -0x1.366d30084c2cbp+1,
+    -0x1.36835a25fb68fp+1,
+    -0x1.36997edec54bap+1,
+    -0x1.36af9e328e876p+1,
+    -0x1.36c5b8213bd4bp+1,
+    -0x1.36dbccaab1f1p+1,
+    -0x1.36f1dbced5a9ap+1,
+    -0x1.3707e58d8bcfdp+1,
+    -0x1.371de9e6b937ep+1,
+    -0x1.3733e8da42c2fp+1,
+    -0x1.3749e2680d5a2p+1,
+    -0x1.375fd68ffdeb8p+1,
+    -0x1.3775c551f9691p+1,
+    -0x1.378baeade4d0ep+1,
+    -0x1.37a192a3a526bp+1,
+    -0x1.37b771331f7a6p+1,
+    -0x1.37cd4a5c38e0ap+1,
+    -0x1.37e31e1ed6762p+1,
+    -0x1.37f8ec7add5b9p+1,
+    -0x1.380eb57032b99p+1,
+    -0x1.382478febbbdbp+1,
+    -0x1.383a37265da26p+1,
+    -0x1.384fefe6fda9p+1,
+    -0x1.3865a3408116ep+1,
+    -0x1.387b5132cd3d6p+1,
+    -0x1.3890f9bdc772bp+1,
+    -0x1.38a69ce15515p+1,
+    -0x1.38bc3a9d5b867p+1,
+    -0x1.38d1d2f1c0322p+1,
+    -0x1.38e765de688a1p+1,
+    -0x1.38fcf3633a072p+1,
+    -0x1.39127b801a2c4p+1,
+    -0x1.3927fe34ee843p+1,
+    -0x1.393d7b819ca2cp+1,
+    -0x1.3952f3660a1ebp+1,
+    -0x1.396865e21c94ap+1,
+    -0x1.397dd2f5b9aa3p+1,
+    -0x1.39933aa0c708fp+1,
+    -0x1.39a89ce32a646p+1,
+    -0x1.39bdf9bcc979ep+1,
+    -0x1.39d3512d8a09ep+1,
+    -0x1.39e8a33551dbcp+1,
+    -0x1.39fdefd406c3ap+1,
+    -0x1.3a1337098e99cp+1,
+    -0x1.3a2878d5cf3c5p+1,
+    -0x1.3a3db538ae925p+1,
+    -0x1.3a52ec321286ep+1,
+    -0x1.3a681dc1e10dp+1,
+    -0x1.3a7d49e8001b9p+1,
+    -0x1.3a9270a455b29p+1,
+    -0x1.3aa791f6c7d9bp+1,
+    -0x1.3abcaddf3ca2dp+1,
+    -0x1.3ad1c45d9a268p+1,
+    -0x1.3ae6d571c6829p+1,
+    -0x1.3afbe11ba7d87p+1,
+    -0x1.3b10e75b2455cp+1,
+    -0x1.3b25e830222bp+1,
+    -0x1.3b3ae39a878bap+1,
+    -0x1.3b4fd99a3ab71p+1,
+    -0x1.3b64ca2f21f19p+1,
+    -0x1.3b79b55923887p+1,
+    -0x1.3b8e9b1825d1p+1,
+    -0x1.3ba37b6c0f284p+1,
+    -0x1.3bb85654c5ec6p+1,
+    -0x1.3bcd2bd230867p+1,
+    -0x1.3be1fbe435647p+1,
+    -0x1.3bf6c68abafd5p+1,
+    -0x1.3c0b8bc5a7cefp+1,
+    -0x1.3c204b94e25d3p+1,
+    -0x1.3c3505f85131ep+1,
+    -0x1.3c49baefdaddbp+1,
+    -0x1.3c5e6a7b65fa4p+1,
+    -0x1.3c73149ad9234p+1,
+    -0x1.3c87b94e1af86p+1,
+    -0x1.3c9c589512281p+1,
+    -0x1.3cb0f26fa562dp+1,
+    -0x1.3cc586ddbb61p+1,
+    -0x1.3cda15df3ae2fp+1,
+    -0x1.3cee9f740ab11p+1,
+    -0x1.3d03239c11949p+1,
+    -0x1.3d17a2573662ap+1,
+    -0x1.3d2c1ba55ff67p+1,
+    -0x1.3d408f86752b1p+1,
+    -0x1.3d54fdfa5ce6bp+1,
+    -0x1.3d696700fe144p+1,
+    -0x1.3d7dca9a3fa6bp+1,
+    -0x1.3d9228c60895fp+1,
+    -0x1.3da681843fe5ep+1,
+    -0x1.3dbad4d4cc9d4p+1,
+    -0x1.3dcf22b795c5dp+1,
+    -0x1.3de36b2c82764p+1,
+    -0x1.3df7ae3379cc3p+1,
+    -0x1.3e0bebcc62e74p+1,
+    -0x1.3e2023f724ebfp+1,
+    -0x1.3e3456b3a705dp+1,
+    -0x1.3e488401d0694p+1,
+    -0x1.3e5cabe1884ebp+1,
+    -0x1.3e70ce52b5f78p+1,
+    -0x1.3e84eb5540abfp+1,
+    -0x1.3e9902e90fba3p+1,
+    -0x1.3ead150e0a767p+1,
+    -0x1.3ec121c4183aep+1,
+    -0x1.3ed5290b20678p+1,
+    -0x1.3ee92ae30a628p+1,
+    -0x1.3efd274bbd97bp+1,
+    -0x1.3f111e45217a2p+1,
+    -0x1.3f250fcf1d86ap+1,
+    -0x1.3f38fbe9993f1p+1,
+    -0x1.3f4ce2947c244p+1,
+    -0x1.3f60c3cfadbfdp+1,
+    -0x1.3f749f9b15a6ap+1,
+    -0x1.3f8875f69b723p+1,
+    -0x1.3f9c46e226bc3p+1,
+    -0x1.3fb0125d9f2a2p+1,
+    -0x1.3fc3d868ec687p+1,
+    -0x1.3fd79903f627ap+1,
+    -0x1.3feb542ea423p+1,
+    -0x1.3fff09e8de16p+1,
+    -0x1.4012ba328bc0fp+1,
+    -0x1.4026650b94ee1p+1,
+    -0x1.403a0a73e16d8p+1,
+    -0x1.404daa6b59128p+1,
+    -0x1.406144f1e3b92p+1,
+    -0x1.4074da0769447p+1,
+    -0x1.408869abd19d7p+1,
+    -0x1.409bf3df04b32p+1,
+    -0x1.40af78a0ea7b5p+1,
+    -0x1.40c2f7f16af3dp+1,
+    -0x1.40d671d06e1a9p+1,
+    -0x1.40e9e63ddbf55p+1,
+    -0x1.40fd55399c8fbp+1,
+    -0x1.4110bec397f88p+1,
+    -0x1.412422dbb6475p+1,
+    -0x1.41378181df9bcp+1,
+    -0x1.414adab5fc1d4p+1,
+    -0x1.415e2e77f3f36p+1,
+    -0x1.41717cc7af4c9p+1,
+    -0x1.4184c5a5165b3p+1,
+    -0x1.41980910115aap+1,
+    -0x1.41ab4708888d2p+1,
+    -0x1.41be7f8e643bp+1,
+    -0x1.41d1b2a18cb27p+1,
+    -0x1.41e4e041ea489p+1,
+    -0x1.41f8086f65596p+1,
+    -0x1.420b2b29e63f1p+1,
+    -0x1.421e48715561ap+1,
+    -0x1.423160459b2dp+1,
+    -0x1.424472a6a00f2p+1,
+    -0x1.42577f944c7dfp+1,
+    -0x1.426a870e88f33p+1,
+    -0x1.427d89153df0cp+1,
+    -0x1.429085a853fc4p+1,
+    -0x1.42a37cc7b3a39p+1,
+    -0x1.42b66e7345783p+1,
+    -0x1.42c95aaaf214dp+1,
+    -0x1.42dc416ea21afp+1,
+    -0x1.42ef22be3e301p+1,
+    -0x1.4301fe99aef9bp+1,
+    -0x1.4314d500dd294p+1,
+    -0x1.4327a5f3b176p+1,
+    -0x1.433a717214967p+1,
+    -0x1.434d377bef49dp+1,
+    -0x1.435ff8112a596p+1,
+    -0x1.4372b331ae915p+1,
+    -0x1.438568dd64c2cp+1,
+    -0x1.4398191435c4cp+1,
+    -0x1.43aac3d60a747p+1,
+    -0x1.43bd6922cbb4dp+1,
+    -0x1.43d008fa626edp+1,
+    -0x1.43e2a35cb7907p+1,
+    -0x1.43f53849b40a8p+1,
+    -0x1.4407c7c140d6ep+1,
+    -0x1.441a51c346f56p+1,
+    -0x1.442cd64faf67cp+1,
+    -0x1.443f55666335bp+1,
+    -0x1.4451cf074b6fep+1,
+    -0x1.44644332512aep+1,
+    -0x1.4476b1e75d826p+1,
+    -0x1.44891b265992dp+1,
+    -0x1.449b7eef2e82cp+1,
+    -0x1.44addd41c57a9p+1,
+    -0x1.44c0361e07acbp+1,
+    -0x1.44d28983de4c8p+1,
+    -0x1.44e4d77332954p+1,
+    -0x1.44f71febedc94p+1,
+    -0x1.450962edf92fcp+1,
+    -0x1.451ba0793e11ep+1,
+    -0x1.452dd88da5bedp+1,
+    -0x1.45400b2b198eap+1,
+    -0x1.4552385182dc6p+1,
+    -0x1.45646000cb092p+1,
+    -0x1.45768238db7edp+1,
+    -0x1.45889ef99da95p+1,
+    -0x1.459ab642faf69p+1,
+    -0x1.45acc814dcdd7p+1,
+    -0x1.45bed46f2cdaap+1,
+    -0x1.45d0db51d46dp+1,
+    -0x1.45e2dcbcbd194p+1,
+    -0x1.45f4d8afd06d1p+1,
+    -0x1.4606cf2af7f9p+1,
+    -0x1.4618c02e1d53cp+1,
+    -0x1.462aabb92a1bcp+1,
+    -0x1.463c91cc07ef9p+1,
+    -0x1.464e7266a075ap+1,
+    -0x1.46604d88dd5a6p+1,
+    -0x1.46722332a84d2p+1,
+    -0x1.4683f363eb055p+1,
+    -0x1.4695be1c8f3e3p+1,
+    -0x1.46a7835c7eb9p+1,
+    -0x1.46b94323a335p+1,
+    -0x1.46cafd71e67f6p+1,
+    -0x1.46dcb247326a4p+1,
+    -0x1.46ee61a370cbbp+1,
+    -0x1.47000b868b7bbp+1,
+    -0x1.4711aff06c585p+1,
+    -0x1.47234ee0fd488p+1,
+    -0x1.4734e85828364p+1,
+    -0x1.47467c55d7106p+1,
+    -0x1.47580ad9f3cbbp+1,
+    -0x1.476993e468631p+1,
+    -0x1.477b17751ed63p+1,
+    -0x1.478c958c0127dp+1,
+    -0x1.479e0e28f9629p+1,
+    -0x1.47af814bf1942p+1,
+    -0x1.47c0eef4d3ce2p+1,
+    -0x1.47d257238a252p+1,
+    -0x1.47e3b9d7feb6ap+1,
+    -0x1.47f517121ba71p+1,
+    -0x1.48066ed1cb1ffp+1,
+    -0x1.4817c116f74dap+1,
+    -0x1.48290de18a636p+1,
+    -0x1.483a55316e94ap+1,
+    -0x1.484b97068e1cap+1,
+    -0x1.485cd360d33c9p+1,
+    -0x1.486e0a402837bp+1,
+    -0x1.487f3ba477573p+1,
+    -0x1.4890678daaed2p+1,
+    -0x1.48a18dfbad4eap+1,
+    -0x1.48b2aeee68d4bp+1,
+    -0x1.48c3ca65c7db5p+1,
+    -0x1.48d4e061b4c77p+1,
+    -0x1.48e5f0e21a041p+1,
+    -0x1.48f6fbe6e1fep+1,
+    -0x1.4908016ff7271p+1,
+    -0x1.4919017d43f62p+1,
+    -0x1.4929fc0eb2e4fp+1,
+    -0x1.493af1242e763p+1,
+    -0x1.494be0bda1328p+1,
+    -0x1.495ccadaf5a49p+1,
+    -0x1.496daf7c165c1p+1,
+    -0x1.497e8ea0eded8p+1,
+    -0x1.498f684966ef7p+1,
+    -0x1.49a03c756bfe6p+1,
+    -0x1.49b10b24e7bfcp+1,
+    -0x1.49c1d457c4dbfp+1,
+    -0x1.49d2980dee006p+1,
+    -0x1.49e356474de06p+1,
+    -0x1.49f40f03cf343p+1,
+    -0x1.4a04c2435cb51p+1,
+    -0x1.4a157005e11f5p+1,
+    -0x1.4a26184b473b1p+1,
+    -0x1.4a36bb1379d38p+1,
+    -0x1.4a47585e63b5bp+1,
+    -0x1.4a57f02befb6bp+1,
+    -0x1.4a68827c08ae9p+1,
+    -0x1.4a790f4e997a4p+1,
+    -0x1.4a8996a38cfbdp+1,
+    -0x1.4a9a187ace171p+1,
+    -0x1.4aaa94d447b5fp+1,
+    -0x1.4abb0bafe4cb5p+1,
+    -0x1.4acb7d0d904cfp+1,
+    -0x1.4adbe8ed35349p+1,
+    -0x1.4aec4f4ebe7efp+1,
+    -0x1.4afcb0321730cp+1,
+    -0x1.4b0d0b972a50bp+1,
+    -0x1.4b1d617de2e76p+1,
+    -0x1.4b2db1e62c065p+1,
+    -0x1.4b3dfccff0c52p+1,
+    -0x1.4b4e423b1c3d4p+1,
+    -0x1.4b5e8227998d4p+1,
+    -0x1.4b6ebc9553d98p+1,
+    -0x1.4b7ef184364c6p+1,
+    -0x1.4b8f20f42c154p+1,
+    -0x1.4b9f4ae520646p+1,
+    -0x1.4baf6f56fe6c2p+1,
+    -0x1.4bbf8e49b167bp+1,
+    -0x1.4bcfa7bd24986p+1,
+    -0x1.4bdfbbb143414p+1,
+    -0x1.4befca25f8aa8p+1,
+    -0x1.4bffd31b30214p+1,
+    -0x1.4c0fd690d4f5ap+1,
+    -0x1.4c1fd486d27f9p+1,
+    -0x1.4c2fccfd141ap+1,
+    -0x1.4c3fbff38525p+1,
+    -0x1.4c4fad6a11057p+1,
+    -0x1.4c5f9560a3223p+1,
+    -0x1.4c6f77d726e72p+1,
+    -0x1.4c7f54cd87c61p+1,
+    -0x1.4c8f2c43b135dp+1,
+    -0x1.4c9efe398eaf1p+1,
+    -0x1.4caecaaf0bb08p+1,
+    -0x1.4cbe91a413c1dp+1,
+    -0x1.4cce5318926cap+1,
+    -0x1.4cde0f0c733b9p+1,
+    -0x1.4cedc57fa1bf3p+1,
+    -0x1.4cfd7672098ffp+1,
+    -0x1.4d0d21e396456p+1,
+    -0x1.4d1cc7d4337cp+1,
+    -0x1.4d2c6843ccd93p+1,
+    -0x1.4d3c03324e055p+1,
+    -0x1.4d4b989fa2acbp+1,
+    -0x1.4d5b288bb67ebp+1,
+    -0x1.4d6ab2f675319p+1,
+    -0x1.4d7a37dfca7b9p+1,
+    -0x1.4d89b747a219fp+1,
+    -0x1.4d99312de7cddp+1,
+    -0x1.4da8a59287606p+1,
+    -0x1.4db814756c9dap+1,
+    -0x1.4dc77dd68355bp+1,
+    -0x1.4dd6e1b5b7599p+1,
+    -0x1.4de64012f47d5p+1,
+    -0x1.4df598ee26a0fp+1,
+    -0x1.4e04ec4739a65p+1,
+    -0x1.4e143a1e196e5p+1,
+    -0x1.4e238272b1e3ep+1,
+    -0x1.4e32c544eef3dp+1,
+    -0x1.4e420294bc94cp+1,
+    -0x1.4e513a6206bdap+1,
+    -0x1.4e606cacb9681p+1,
+    -0x1.4e6f9974c090dp+1,
+    -0x1.4e7ec0ba083c8p+1,
+    -0x1.4e8de27c7c72cp+1,
+    -0x1.4e9cfebc093f2p+1,
+    -0x1.4eac15789ab04p+1,
+    -0x1.4ebb26b21cdc9p+1,
+    -0x1.4eca32687bdc9p+1,
+    -0x1.4ed9389ba3cacp+1,
+    -0x1.4ee8394b80ca8p+1,
+    -0x1.4ef73477ff043p+1,
+    -0x1.4f062a210a9f3p+1,
+    -0x1.4f151a468fcacp+1,
+    -0x1.4f2404e87abb3p+1,
+    -0x1.4f32ea06b7a3cp+1,
+    -0x1.4f41c9a132bfbp+1,
+    -0x1.4f50a3b7d8502p+1,
+    -0x1.4f5f784a94984p+1,
+    -0x1.4f6e475953df2p+1,
+    -0x1.4f7d10e4026efp+1,
+    -0x1.4f8bd4ea8c99ap+1,
+    -0x1.4f9a936cdeb33p+1,
+    -0x1.4fa94c6ae511bp+1,
+    -0x1.4fb7ffe48c13p+1,
+    -0x1.4fc6add9c0181p+1,
+    -0x1.4fd5564a6d86cp+1,
+    -0x1.4fe3f93680c8fp+1,
+    -0x1.4ff2969de6488p+1,
+    -0x1.50012e808a792p+1,
+    -0x1.500fc0de59ce9p+1,
+    -0x1.501e4db740c08p+1,
+    -0x1.502cd50b2bcccp+1,
+    -0x1.503b56da0776ep+1,
+    -0x1.5049d323c0477p+1,
+    -0x1.505849e842c81p+1,
+    -0x1.5066bb277b845p+1,
+    -0x1.507526e1570ecp+1,
+    -0x1.50838d15c1fadp+1,
+    -0x1.5091edc4a8e6p+1,
+    -0x1.50a048edf86dap+1,
+    -0x1.50ae9e919d333p+1,
+    -0x1.50bceeaf83dd1p+1,
+    -0x1.50cb394799149p+1,
+    -0x1.50d97e59c98afp+1,
+    -0x1.50e7bde601f37p+1,
+    -0x1.50f5f7ec2f025p+1,
+    -0x1.51042c6c3d70cp+1,
+    -0x1.51125b6619fdfp+1,
+    -0x1.512084d9b16fp+1,
+    -0x1.512ea8c6f08d1p+1,
+    -0x1.513cc72dc4203p+1,
+    -0x1.514ae00e18f76p+1,
+    -0x1.5158f367dbe4bp+1,
+    -0x1.5167013af9bfp+1,
+    -0x1.517509875f626p+1,
+    -0x1.51830c4cf9acap+1,
+    -0x1.5191098bb580bp+1,
+    -0x1.519f01437fc77p+1,
+    -0x1.51acf374456d9p+1,
+    -0x1.51bae01df35eep+1,
+    -0x1.51c8c740768e3p+1,
+    -0x1.51d6a8dbbbf04p+1,
+    -0x1.51e484efb07cdp+1,
+    -0x1.51f25b7c41366p+1,
+    -0x1.52002c815b20ap+1,
+    -0x1.520df7feeb442p+1,
+    -0x1.521bbdf4dea68p+1,
+    -0x1.52297e6322564p+1,
+    -0x1.52373949a362fp+1,
+    -0x1.5244eea84ee3p+1,
+    -0x1.52529e7f11f0ep+1,
+    -0x1.526048cdd9aefp+1,
+    -0x1.526ded9493409p+1,
+    -0x1.527b8cd32bc82p+1,
+    -0x1.528926899071fp+1,
+    -0x1.5296bab7ae6a4p+1,
+    -0x1.52a4495d72e15p+1,
+    -0x1.52b1d27acb0c7p+1,
+    -0x1.52bf560fa422dp+1,
+    -0x1.52ccd41beb5f9p+1,
+    -0x1.52da4c9f8e01dp+1,
+    -0x1.52e7bf9a7952bp+1,
+    -0x1.52f52d0c9a984p+1,
+    -0x1.530294f5df1e9p+1,
+    -0x1.530ff7563434ap+1,
+    -0x1.531d542d872e7p+1,
+    -0x1.532aab7bc564fp+1,
+    -0x1.5337fd40dc33p+1,
+    -0x1.5345497cb8f89p+1,
+    -0x1.5352902f491a8p+1,
+    -0x1.535fd15879ff9p+1,
+    -0x1.536d0cf839129p+1,
+    -0x1.537a430e73c06p+1,
+    -0x1.5387739b177a9p+1,
+    -0x1.53949e9e11b8p+1,
+    -0x1.53a1c4174ff15p+1,
+    -0x1.53aee406bfa43p+1,
+    -0x1.53bbfe6c4e532p+1,
+    -0x1.53c91347e981dp+1,
+    -0x1.53d622997eb5ep+1,
+    -0x1.53e32c60fb7ccp+1,
+    -0x1.53f0309e4d66p+1,
+    -0x1.53fd2f516204p+1,
+    -0x1.540a287a26f35p+1,
+    -0x1.54171c1889cd4p+1,
+    -0x1.54240a2c78314p+1,
+    -0x1.5430f2b5dfc1bp+1,
+    -0x1.543dd5b4ae24dp+1,
+    -0x1.544ab328d103p+1,
+    -0x1.54578b12360a8p+1,
+    -0x1.54645d70caf07p+1,
+    -0x1.54712a447d662p+1,
+    -0x1.547df18d3b23cp+1,
+    -0x1.548ab34af1e78p+1,
+    -0x1.54976f7d8f716p+1,
+    -0x1.54a4262501859p+1,
+    -0x1.54b0d74135ea2p+1,
+    -0x1.54bd82d21a6ap+1,
+    -0x1.54ca28d79cd55p+1,
+    -0x1.54d6c951aafdep+1,
+    -0x1.54e3644032badp+1,
+    -0x1.54eff9a321e6fp+1,
+    -0x1.54fc897a665c2p+1,
+    -0x1.550913c5edfb5p+1,
+    -0x1.55159885a6a75p+1,
+    -0x1.552217b97e45fp+1,
+    -0x1.552e916162c6fp+1,
+    -0x1.553b057d42182p+1,
+    -0x1.5547740d0a301p+1,
+    -0x1.5553dd10a9059p+1,
+    -0x1.556040880c924p+1,
+    -0x1.556c9e7322d2cp+1,
+    -0x1.5578f6d1d9cabp+1,
+    -0x1.558549a41f7c9p+1,
+    -0x1.559196e9e1efp+1,
+    -0x1.559ddea30f2e8p+1,
+    -0x1.55aa20cf954c9p+1,
+    -0x1.55b65d6f625b9p+1,
+    -0x1.55c2948264701p+1,
+    -0x1.55cec60889a67p+1,
+    -0x1.55daf201c01dp+1,
+    -0x1.55e7186df5f33p+1,
+    -0x1.55f3394d194d3p+1,
+    -0x1.55ff549f18546p+1,
+    -0x1.560b6a63e133p+1,
+    -0x1.56177a9b62166p+1,
+    -0x1.562385458935bp+1,
+    -0x1.562f8a6244c51p+1,
+    -0x1.563b89f182febp+1,
+    -0x1.564783f3321fap+1,
+    -0x1.5653786740691p+1,
+    -0x1.565f674d9c1e1p+1,
+    -0x1.566b50a63386ap+1,
+    -0x1.56773470f4efdp+1,
+    -0x1.568312adcea79p+1,
+    -0x1.568eeb5caefddp+1,
+    -0x1.569abe7d84499p+1,
+    -0x1.56a68c103ce1bp+1,
+    -0x1.56b25414c7242p+1,
+    -0x1.56be168b1170bp+1,
+    -0x1.56c9d3730a283p+1,
+    -0x1.56d58acc9fb07p+1,
+    -0x1.56e13c97c0753p+1,
+    -0x1.56ece8d45ae63p+1,
+    -0x1.56f88f825d723p+1,
+    -0x1.570430a1b68edp+1,
+    -0x1.570fcc3254b4dp+1,
+    -0x1.571b62342660bp+1,
+    -0x1.5726f2a71a112p+1,
+    -0x1.57327d8b1e48bp+1,
+    -0x1.573e02e0218bep+1,
+    -0x1.574982a612634p+1,
+    -0x1.5754fcdcdf596p+1,
+    -0x1.5760718476fcbp+1,
+    -0x1.576be09cc7debp+1,
+    -0x1.57774a25c098bp+1,
+    -0x1.5782ae1f4fc62p+1,
+    -0x1.578e0c8964036p+1,
+    -0x1.57996563ebf0bp+1,
+    -0x1.57a4b8aed6308p+1,
+    -0x1.57b0066a11691p+1,
+    -0x1.57bb4e958c43ap+1,
+    -0x1.57c6913135717p+1,
+    -0x1.57d1ce3cfba5ap+1,
+    -0x1.57dd05b8cd946p+1,
+    -0x1.57e837a499f5fp+1,
+    -0x1.57f364004f846p+1,
+    -0x1.57fe8acbdcfdcp+1,
+    -0x1.5809ac0731223p+1,
+    -0x1.5814c7b23ab5bp+1,
+    -0x1.581fddcce87f7p+1,
+    -0x1.582aee57294e4p+1,
+    -0x1.5835f950ebf32p+1,
+    -0x1.5840feba1f3fp+1,
+    -0x1.584bfe92b204ep+1,
+    -0x1.5856f8da931f9p+1,
+    -0x1.5861ed91b16bfp+1,
+    -0x1.586cdcb7fbc8ep+1,
+    -0x1.5877c64d611c1p+1,
+    -0x1.5882aa51d04a7p+1,
+    -0x1.588d88c5383bbp+1,
+    -0x1.589861a787da9p+1,
+    -0x1.58a334f8ae18cp+1,
+    -0x1.58ae02b899e8p+1,
+    -0x1.58b8cae73a3fep+1,
+    -0x1.58c38d847e171p+1,
+    -0x1.58ce4a9054693p+1,
+    -0x1.58d9020aac39cp+1,
+    -0x1.58e3b3f3748b6p+1,
+    -0x1.58ee604a9c639p+1,
+    -0x1.58f9071012caep+1,
+    -0x1.5903a843c6d0bp+1,
+    -0x1.590e43e5a7838p+1,
+    -0x1.5918d9f5a3f6cp+1,
+    -0x1.59236a73ab44dp+1,
+    -0x1.592df55fac841p+1,
+    -0x1.59387ab996d0ep+1,
+    -0x1.5942fa81594b8p+1,
+    -0x1.594d74b6e31a5p+1,
+    -0x1.5957e95a235f9p+1,
+    -0x1.5962586b09449p+1,
+    -0x1.596cc1e983f87p+1,
+    -0x1.597725d582ab7p+1,
+    -0x1.5981842ef48fbp+1,
+    -0x1.598bdcf5c8de5p+1,
+    -0x1.59963029eecf8p+1,
+    -0x1.59a07dcb559f6p+1,
+    -0x1.59aac5d9ec8eep+1,
+    -0x1.59b50855a2e13p+1,
+    -0x1.59bf453e67dd4p+1,
+    -0x1.59c97c942acb2p+1,
+    -0x1.59d3ae56daf4cp+1,
+    -0x1.59ddda8667ab1p+1,
+    -0x1.59e80122c03efp+1,
+    -0x1.59f2222bd4086p+1,
+    -0x1.59fc3da192613p+1,
+    -0x1.5a065383eaa44p+1,
+    -0x1.5a1063d2cc316p+1,
+    -0x1.5a1a6e8e266c5p+1,
+    -0x1.5a2473b5e8b7ep+1,
+    -0x1.5a2e734a027cdp+1,
+    -0x1.5a386d4a6323ep+1,
+    -0x1.5a4261b6fa1ccp+1,
+    -0x1.5a4c508fb6da2p+1,
+    -0x1.5a5639d488d1ap+1,
+    -0x1.5a601d855f77fp+1,
+    -0x1.5a69fba22a499p+1,
+    -0x1.5a73d42ad8c82p+1,
+    -0x1.5a7da71f5a732p+1,
+    -0x1.5a87747f9ecd4p+1,
+    -0x1.5a913c4b955aep+1,
+    -0x1.5a9afe832da59p+1,
+    -0x1.5aa4bb26573bbp+1,
+    -0x1.5aae723501adbp+1,
+    -0x1.5ab823af1c901p+1,
+    -0x1.5ac1cf9497793p+1,
+    -0x1.5acb75e562035p+1,
+    -0x1.5ad516a16bcadp+1,
+    -0x1.5adeb1c8a47p+1,
+    -0x1.5ae8475afb943p+1,
+    -0x1.5af1d75860d9ap+1,
+    -0x1.5afb61c0c3e7ap+1,
+    -0x1.5b04e694146b5p+1,
+    -0x1.5b0e65d24215fp+1,
+    -0x1.5b17df7b3c97ap+1,
+    -0x1.5b21538ef3a69p+1,
+    -0x1.5b2ac20d56f8dp+1,
+    -0x1.5b342af6564a8p+1,
+    -0x1.5b3d8e49e157bp+1,
+    -0x1.5b46ec07e7e36p+1,
+    -0x1.5b50443059b1bp+1,
+    -0x1.5b5996c326859p+1,
+    -0x1.5b62e3c03e2cp+1,
+    -0x1.5b6c2b279071fp+1,
+    -0x1.5b756cf90d274p+1,
+    -0x1.5b7ea934a41dep+1,
+    -0x1.5b87dfda452bcp+1,
+    -0x1.5b9110e9e028bp+1,
+    -0x1.5b9a3c6364f09p+1,
+    -0x1.5ba36246c3602p+1,
+    -0x1.5bac8293eb554p+1,
+    -0x1.5bb59d4accb2bp+1,
+    -0x1.5bbeb26b57613p+1,
+    -0x1.5bc7c1f57b4d7p+1,
+    -0x1.5bd0cbe928632p+1,
+    -0x1.5bd9d0464e93fp+1,
+    -0x1.5be2cf0cddd08p+1,
+    -0x1.5bebc83cc60d8p+1,
+    -0x1.5bf4bbd5f7448p+1,
+    -0x1.5bfda9d861712p+1,
+    -0x1.5c069243f492ep+1,
+    -0x1.5c0f7518a0ab4p+1,
+    -0x1.5c18525655bfdp+1,
+    -0x1.5c2129fd03d71p+1,
+    -0x1.5c29fc0c9af98p+1,
+    -0x1.5c32c8850b367p+1,
+    -0x1.5c3b8f66449c6p+1,
+    -0x1.5c4450b0373ccp+1,
+    -0x1.5c4d0c62d32bfp+1,
+    -0x1.5c55c27e08853p+1,
+    -0x1.5c5e7301c762ep+1,
+    -0x1.5c671dedffe35p+1,
+    -0x1.5c6fc342a229cp+1,
+    -0x1.5c7862ff9e5a7p+1,
+    -0x1.5c80fd24e49abp+1,
+    -0x1.5c8991b26513bp+1,
+    -0x1.5c9220a80ff09p+1,
+    -0x1.5c9aaa05d561ap+1,
+    -0x1.5ca32dcba59bdp+1,
+    -0x1.5cababf970d46p+1,
+    -0x1.5cb4248f273f7p+1,
+    -0x1.5cbc978cb91b1p+1,
+    -0x1.5cc504f216a54p+1,
+    -0x1.5ccd6cbf301fp+1,
+    -0x1.5cd5cef3f5cb6p+1,
+    -0x1.5cde2b9057f16p+1,
+    -0x1.5ce6829446d8fp+1,
+    -0x1.5ceed3ffb2ccp+1,
+    -0x1.5cf71fd28c1b9p+1,
+    -0x1.5cff660cc3177p+1,
+    -0x1.5d07a6ae48139p+1,
+    -0x1.5d0fe1b70b68bp+1,
+    -0x1.5d181726fd70cp+1,
+    -0x1.5d2046fe0e868p+1,
+    -0x1.5d28713c2f08cp+1,
+    -0x1.5d3095e14f585p+1,
+    -0x1.5d38b4ed5fdaep+1,
+    -0x1.5d40ce6050fb2p+1,
+    -0x1.5d48e23a1324dp+1,
+    -0x1.5d50f07a96c39p+1,
+    -0x1.5d58f921cc451p+1,
+    -0x1.5d60fc2fa41efp+1,
+    -0x1.5d68f9a40ec8dp+1,
+    -0x1.5d70f17efcba4p+1,
+    -0x1.5d78e3c05e6bdp+1,
+    -0x1.5d80d068245b2p+1,
+    -0x1.5d88b7763f0aap+1,
+    -0x1.5d9098ea9efddp+1,
+    -0x1.5d9874c534b93p+1,
+    -0x1.5da04b05f0c63p+1,
+    -0x1.5da81bacc3b34p+1,
+    -0x1.5dafe6b99e0edp+1,
+    -0x1.5db7ac2c70654p+1,
+    -0x1.5dbf6c052b4bp+1,
+    -0x1.5dc72643bf595p+1,
+    -0x1.5dcedae81d279p+1,
+    -0x1.5dd689f235511p+1,
+    -0x1.5dde3361f8771p+1,
+    -0x1.5de5d737573edp+1,
+    -0x1.5ded7572424b9p+1,
+    -0x1.5df50e12aa439p+1,
+    -0x1.5dfca1187fcfp+1,
+    -0x1.5e042e83b39ap+1,
+    -0x1.5e0bb6543652cp+1,
+    -0x1.5e133889f8ab6p+1,
+    -0x1.5e1ab524eb571p+1,
+    -0x1.5e222c24ff0aep+1,
+    -0x1.5e299d8a2483dp+1,
+    -0x1.5e3109544c7ffp+1,
+    -0x1.5e386f8367bb5p+1,
+    -0x1.5e3fd01766f8fp+1,
+    -0x1.5e472b103afdcp+1,
+    -0x1.5e4e806dd48fcp+1,
+    -0x1.5e55d0302479ep+1,
+    -0x1.5e5d1a571b8b1p+1,
+    -0x1.5e645ee2aa903p+1,
+    -0x1.5e6b9dd2c25a2p+1,
+    -0x1.5e72d72753becp+1,
+    -0x1.5e7a0ae04f94ep+1,
+    -0x1.5e8138fda6b46p+1,
+    -0x1.5e88617f49fap+1,
+    -0x1.5e8f84652a468p+1,
+    -0x1.5e96a1af3879ap+1,
+    -0x1.5e9db95d657a2p+1,
+    -0x1.5ea4cb6fa22fbp+1,
+    -0x1.5eabd7e5df801p+1,
+    -0x1.5eb2dec00e57ep+1,
+    -0x1.5eb9dffe1fa6cp+1,
+    -0x1.5ec0dba004606p+1,
+    -0x1.5ec7d1a5ad795p+1,
+    -0x1.5ecec20f0be73p+1,
+    -0x1.5ed5acdc10a38p+1,
+    -0x1.5edc920caca9cp+1,
+    -0x1.5ee371a0d0f9ap+1,
+    -0x1.5eea4b986e947p+1,
+    -0x1.5ef11ff3767fcp+1,
+    -0x1.5ef7eeb1d9c21p+1,
+    -0x1.5efeb7d38962bp+1,
+    -0x1.5f057b58766d3p+1,
+    -0x1.5f0c394091eefp+1,
+    -0x1.5f12f18bccf94p+1,
+    -0x1.5f19a43a189e9p+1,
+    -0x1.5f20514b65f32p+1,
+    -0x1.5f26f8bfa6125p+1,
+    -0x1.5f2d9a96ca166p+1,
+    -0x1.5f3436d0c31cap+1,
+    -0x1.5f3acd6d82445p+1,
+    -0x1.5f415e6cf8b0bp+1,
+    -0x1.5f47e9cf1787p+1,
+    -0x1.5f4e6f93cff05p+1,
+    -0x1.5f54efbb1316ep+1,
+    -0x1.5f5b6a44d225ep+1,
+    -0x1.5f61df30fe4d7p+1,
+    -0x1.5f684e7f88c29p+1,
+    -0x1.5f6eb83062bb7p+1,
+    -0x1.5f751c437d6e2p+1,
+    -0x1.5f7b7ab8ca11bp+1,
+    -0x1.5f81d39039e22p+1,
+    -0x1.5f8826c9be207p+1,
+    -0x1.5f8e7465480ebp+1,
+    -0x1.5f94bc62c8eedp+1,
+    -0x1.5f9afec23204cp+1,
+    -0x1.5fa13b83749c7p+1,
+    -0x1.5fa772a68203cp+1,
+    -0x1.5fada42b4b88ap+1,
+    -0x1.5fb3d011c279ep+1,
+    -0x1.5fb9f659d82a7p+1,
+    -0x1.5fc017037def1p+1,
+    -0x1.5fc6320ea520ap+1,
+    -0x1.5fcc477b3f19ep+1,
+    -0x1.5fd257493d389p+1,
+    -0x1.5fd8617890d98p+1,
+    -0x1.5fde66092b606p+1,
+    -0x1.5fe464fafe32ep+1,
+    -0x1.5fea5e4dfab7cp+1,
+    -0x1.5ff052021259ap+1,
+    -0x1.5ff6401736843p+1,
+    -0x1.5ffc288d58a42p+1,
+    -0x1.60020b646a29fp+1,
+    -0x1.6007e89c5c884p+1,
+    -0x1.600dc0352135bp+1,
+    -0x1.6013922ea9aadp+1,
+    -0x1.60195e88e7631p+1,
+    -0x1.601f2543cbd91p+1,
+    -0x1.6024e65f488e4p+1,
+    -0x1.602aa1db4f062p+1,
+    -0x1.603057b7d0c52p+1,
+    -0x1.603607f4bf53bp+1,
+    -0x1.603bb2920c3b3p+1,
+    -0x1.6041578fa9052p+1,
+    -0x1.6046f6ed873dep+1,
+    -0x1.604c90ab987bbp+1,
+    -0x1.605224c9ce50fp+1,
+    -0x1.6057b3481a51fp+1,
+    -0x1.605d3c266e161p+1,
+    -0x1.6062bf64bb3b9p+1,
+    -0x1.60683d02f35eap+1,
+    -0x1.606db501081c9p+1,
+    -0x1.6073275eeb19ap+1,
+    -0x1.6078941c8df8fp+1,
+    -0x1.607dfb39e261cp+1,
+    -0x1.60835cb6d9ff3p+1,
+    -0x1.6088b893667a6p+1,
+    -0x1.608e0ecf79808p+1,
+    -0x1.60935f6b04c3bp+1,
+    -0x1.6098aa65f9f6fp+1,
+    -0x1.609defc04ace6p+1,
+    -0x1.60a32f79e9021p+1,
+    -0x1.60a86992c64c1p+1,
+    -0x1.60ad9e0ad46a4p+1,
+    -0x1.60b2cce2051bcp+1,
+    -0x1.60b7f6184a208p+1,
+    -0x1.60bd19ad953c8p+1,
+    -0x1.60c237a1d8359p+1,
+    -0x1.60c74ff504d4cp+1,
+    -0x1.60cc62a70ce1ep+1,
+    -0x1.60d16fb7e22bep+1,
+    -0x1.60d6772776839p+1,
+    -0x1.60db78f5bbbacp+1,
+    -0x1.60e07522a3a65p+1,
+    -0x1.60e56bae201a1p+1,
+    -0x1.60ea5c9822f0cp+1,
+    -0x1.60ef47e09e073p+1,
+    -0x1.60f42d87833a1p+1,
+    -0x1.60f90d8cc4673p+1,
+    -0x1.60fde7f053704p+1,
+    -0x1.6102bcb22239fp+1,
+    -0x1.61078bd222affp+1,
+    -0x1.610c555046bbdp+1,
+    -0x1.6111192c80475p+1,
+    -0x1.6115d766c14p+1,
+    -0x1.611a8ffefb958p+1,
+    -0x1.611f42f5213b6p+1,
+    -0x1.6123f04924263p+1,
+    -0x1.612897faf64b8p+1,
+    -0x1.612d3a0a89a4dp+1,
+    -0x1.6131d677d02dbp+1,
+    -0x1.61366d42bbe6ap+1,
+    -0x1.613afe6b3ed41p+1,
+    -0x1.613f89f14af86p+1,
+    -0x1.61440fd4d2591p+1,
+    -0x1.61489015c6fd8p+1,
+    -0x1.614d0ab41af02p+1,
+    -0x1.61517fafc03a5p+1,
+    -0x1.6155ef08a8eb7p+1,
+    -0x1.615a58bec712dp+1,
+    -0x1.615ebcd20cc6cp+1,
+    -0x1.61631b426c1e9p+1,
+    -0x1.6167740fd72f9p+1,
+    -0x1.616bc73a4015p+1,
+    -0x1.617014c198e92p+1,
+    -0x1.61745ca5d3ca4p+1,
+    -0x1.61789ee6e2db7p+1,
+    -0x1.617cdb84b841p+1,
+    -0x1.6181127f461f1p+1,
+    -0x1.618543d67e9adp+1,
+    -0x1.61896f8a53de7p+1,
+    -0x1.618d959ab818fp+1,
+    -0x1.6191b6079d7a8p+1,
+    -0x1.6195d0d0f6343p+1,
+    -0x1.6199e5f6b47a1p+1,
+    -0x1.619df578ca7e3p+1,
+    -0x1.61a1ff572a77ap+1,
+    -0x1.61a60391c6a46p+1,
+    -0x1.61aa0228913e6p+1,
+    -0x1.61adfb1b7c84bp+1,
+    -0x1.61b1ee6a7ab64p+1,
+    -0x1.61b5dc157e18p+1,
+    -0x1.61b9c41c78eddp+1,
+    -0x1.61bda67f5d7fcp+1,
+    -0x1.61c1833e1e199p+1,
+    -0x1.61c55a58ad053p+1,
+    -0x1.61c92bcefc906p+1,
+    -0x1.61ccf7a0ff0e1p+1,
+    -0x1.61d0bdcea6d2p+1,
+    -0x1.61d47e57e6301p+1,
+    -0x1.61d8393caf7ep+1,
+    -0x1.61dbee7cf5179p+1,
+    -0x1.61df9e18a9548p+1,
+    -0x1.61e3480fbe92ap+1,
+    -0x1.61e6ec622731ap+1,
+    -0x1.61ea8b0fd5922p+1,
+    -0x1.61ee2418bc19fp+1,
+    -0x1.61f1b77ccd329p+1,
+    -0x1.61f5453bfb43bp+1,
+    -0x1.61f8cd5638b9p+1,
+    -0x1.61fc4fcb7802p+1,
+    -0x1.61ffcc9bab8c6p+1,
+    -0x1.620343c6c5c9bp+1,
+    -0x1.6206b54cb92f7p+1,
+    -0x1.620a212d78313p+1,
+    -0x1.620d8768f5468p+1,
+    -0x1.6210e7ff22ebep+1,
+    -0x1.621442eff39ebp+1,
+    -0x1.6217983b59dd8p+1,
+    -0x1.621ae7e1482acp+1,
+    -0x1.621e31e1b109dp+1,
+    -0x1.6221763c86ff3p+1,
+    -0x1.6224b4f1bc933p+1,
+    -0x1.6227ee0144504p+1,
+    -0x1.622b216b10c3cp+1,
+    -0x1.622e4f2f1479p+1,
+    -0x1.6231774d41ff6p+1,
+    -0x1.623499c58beb2p+1,
+    -0x1.6237b697e4d19p+1,
+    -0x1.623acdc43f481p+1,
+    -0x1.623ddf4a8de5dp+1,
+    -0x1.6240eb2ac349p+1,
+    -0x1.6243f164d20eep+1,
+    -0x1.6246f1f8acd6bp+1,
+    -0x1.6249ece6463ebp+1,
+    -0x1.624ce22d90ebfp+1,
+    -0x1.624fd1ce7f85ap+1,
+    -0x1.6252bbc904b2fp+1,
+    -0x1.6255a01d131dp+1,
+    -0x1.62587eca9d73ep+1,
+    -0x1.625b57d19665bp+1,
+    -0x1.625e2b31f0a17p+1,
+    -0x1.6260f8eb9edd3p+1,
+    -0x1.6263c0fe93cd1p+1,
+    -0x1.6266836ac226p+1,
+    -0x1.626940301ca41p+1,
+    -0x1.626bf74e96023p+1,
+    -0x1.626ea8c620fe5p+1,
+    -0x1.62715496b0578p+1,
+    -0x1.6273fac036ccap+1,
+    -0x1.62769b42a71eap+1,
+    -0x1.6279361df4167p+1,
+    -0x1.627bcb52107dfp+1,
+    -0x1.627e5adeef1cfp+1,
+    -0x1.6280e4c482c26p+1,
+    -0x1.62836902be3fp+1,
+    -0x1.6285e7999462ap+1,
+    -0x1.62886088f7fb2p+1,
+    -0x1.628ad3d0dbde4p+1,
+    -0x1.628d417132e5dp+1,
+    -0x1.628fa969efe69p+1,
+    -0x1.62920bbb05bb3p+1,
+    -0x1.6294686467417p+1,
+    -0x1.6296bf66075ap+1,
+    -0x1.629910bfd8e49p+1,
+    -0x1.629b5c71cec6dp+1,
+    -0x1.629da27bdbe57p+1,
+    -0x1.629fe2ddf328p+1,
+    -0x1.62a21d9807783p+1,
+    -0x1.62a452aa0bc28p+1,
+    -0x1.62a68213f2f2ap+1,
+    -0x1.62a8abd5affa2p+1,
+    -0x1.62aacfef35c98p+1,
+    -0x1.62acee6077545p+1,
+    -0x1.62af072967903p+1,
+    -0x1.62b11a49f9767p+1,
+    -0x1.62b327c22001bp+1,
+    -0x1.62b52f91ce2d6p+1,
+    -0x1.62b731b8f6f9p+1,
+    -0x1.62b92e378d64ep+1,
+    -0x1.62bb250d84728p+1,
+    -0x1.62bd163acf275p+1,
+    -0x1.62bf01bf6089bp+1,
+    -0x1.62c0e79b2ba1p+1,
+    -0x1.62c2c7ce2378ap+1,
+    -0x1.62c4a2583b1cdp+1,
+    -0x1.62c67739659bp+1,
+    -0x1.62c8467196047p+1,
+    -0x1.62ca1000bf6c7p+1,
+    -0x1.62cbd3e6d4e94p+1,
+    -0x1.62cd9223c9903p+1,
+    -0x1.62cf4ab7907c7p+1,
+    -0x1.62d0fda21cc83p+1,
+    -0x1.62d2aae36190cp+1,
+    -0x1.62d4527b51f45p+1,
+    -0x1.62d5f469e112p+1,
+    -0x1.62d790af020dp+1,
+    -0x1.62d9274aa80a7p+1,
+    -0x1.62dab83cc6328p+1,
+    -0x1.62dc43854fac5p+1,
+    -0x1.62ddc92437a4fp+1,
+    -0x1.62df491971488p+1,
+    -0x1.62e0c364efc6p+1,
+    -0x1.62e23806a64e9p+1,
+    -0x1.62e3a6fe88173p+1,
+    -0x1.62e5104c8855ep+1,
+    -0x1.62e673f09a40ap+1,
+    -0x1.62e7d1eab10f7p+1,
+    -0x1.62e92a3ac0004p+1,
+    -0x1.62ea7ce0ba4d1p+1,
+    -0x1.62ebc9dc9335ep+1,
+    -0x1.62ed112e3dfc8p+1,
+    -0x1.62ee52d5ade2fp+1,
+    -0x1.62ef8ed2d62dp+1,
+    -0x1.62f0c525aa24ap+1,
+    -0x1.62f1f5ce1d0fbp+1,
+    -0x1.62f320cc223ap+1,
+    -0x1.62f4461facf17p+1,
+    -0x1.62f565c8b084cp+1,
+    -0x1.62f67fc72046cp+1,
+    -0x1.62f7941aef8b3p+1,
+    -0x1.62f8a2c411a5fp+1,
+    -0x1.62f9abc279ebbp+1,
+    -0x1.62faaf161bb62p+1,
+    -0x1.62fbacbeea631p+1,
+    -0x1.62fca4bcd94e3p+1,
+    -0x1.62fd970fdbd62p+1,
+    -0x1.62fe83b7e55bap+1,
+    -0x1.62ff6ab4e9424p+1,
+    -0x1.63004c06daecbp+1,
+    -0x1.630127adadc39p+1,
+    -0x1.6301fda9552e8p+1,
+    -0x1.6302cdf9c4981p+1,
+    -0x1.6303989eef6bep+1,
+    -0x1.63045d98c9169p+1,
+    -0x1.63051ce74509ap+1,
+    -0x1.6305d68a56ba8p+1,
+    -0x1.63068a81f19cdp+1,
+    -0x1.630738ce0927p+1,
+    -0x1.6307e16e90d09p+1,
+    -0x1.630884637c12p+1,
+    -0x1.630921acbe67cp+1,
+    -0x1.6309b94a4b505p+1,
+    -0x1.630a4b3c164d1p+1,
+    -0x1.630ad78212dd7p+1,
+    -0x1.630b5e1c3484dp+1,
+    -0x1.630bdf0a6ecb9p+1,
+    -0x1.630c5a4cb53ap+1,
+    -0x1.630ccfe2fb568p+1,
+    -0x1.630d3fcd34ad8p+1,
+    -0x1.630daa0b54cb4p+1,
+    -0x1.630e0e9d4f421p+1,
+    -0x1.630e6d8317a33p+1,
+    -0x1.630ec6bca182ep+1,
+    -0x1.630f1a49e0767p+1,
+    -0x1.630f682ac8141p+1,
+    -0x1.630fb05f4bf51p+1,
+    -0x1.630ff2e75fb1ap+1,
+    -0x1.63102fc2f6e7ep+1,
+    -0x1.631066f205351p+1,
+    -0x1.631098747e3a6p+1,
+    -0x1.6310c44a559cep+1,
+    -0x1.6310ea737effcp+1,
+    -0x1.63110aefee092p+1,
+    -0x1.631125bf96602p+1,
+    -0x1.63113ae26badep+1,
+    -0x1.63114a5861a15p+1,
+    -0x1.631154216be5ap+1,
+    -0x1.6311583d7e2bdp+1,
+    -0x1.631156ac8c26ep+1,
+    -0x1.63114f6e8989ep+1,
+    -0x1.631142836a08dp+1,
+    -0x1.63112feb215bbp+1,
+    -0x1.631117a5a33b7p+1,
+    -0x1.6310f9b2e362p+1,
+    -0x1.6310d612d58d6p+1,
+    -0x1.6310acc56d7c7p+1,
+    -0x1.63107dca9eef2p+1,
+    -0x1.631049225da95p+1,
+    -0x1.63100ecc9d6fep+1,
+    -0x1.630fcec95207bp+1,
+    -0x1.630f89186f36bp+1,
+    -0x1.630f3db9e8c6bp+1,
+    -0x1.630eecadb2838p+1,
+    -0x1.630e95f3c03cep+1,
+    -0x1.630e398c05c3ap+1,
+    -0x1.630dd77676e88p+1,
+    -0x1.630d6fb3077d6p+1,
+    -0x1.630d0241ab57ep+1,
+    -0x1.630c8f22564edp+1,
+    -0x1.630c1654fc39fp+1,
+    -0x1.630b97d990f4ep+1,
+    -0x1.630b13b0085c5p+1,
+    -0x1.630a89d8564dfp+1,
+    -0x1.6309fa526eab8p+1,
+    -0x1.6309651e45579p+1,
+    -0x1.6308ca3bce34cp+1,
+    -0x1.630829aafd26cp+1,
+    -0x1.6307836bc6162p+1,
+    -0x1.6306d77e1cef7p+1,
+    -0x1.630625e1f59d4p+1,
+    -0x1.63056e97440d2p+1,
+    -0x1.6304b19dfc2d9p+1,
+    -0x1.6303eef611ee4p+1,
+    -0x1.6303269f79429p+1,
+    -0x1.6302589a261f1p+1,
+    -0x1.630184e60c794p+1,
+    -0x1.6300ab83204a8p+1,
+    -0x1.62ffcc71558d5p+1,
+    -0x1.62fee7b0a03c2p+1,
+    -0x1.62fdfd40f4527p+1,
+    -0x1.62fd0d2245cfap+1,
+    -0x1.62fc175488b51p+1,
+    -0x1.62fb1bd7b1073p+1,
+    -0x1.62fa1aabb2c85p+1,
+    -0x1.62f913d081feep+1,
+    -0x1.62f8074612b53p+1,
+    -0x1.62f6f50c58f48p+1,
+    -0x1.62f5dd2348cc4p+1,
+    -0x1.62f4bf8ad6499p+1,
+    -0x1.62f39c42f579dp+1,
+    -0x1.62f2734b9a6e5p+1,
+    -0x1.62f144a4b9395p+1,
+    -0x1.62f0104e45efp+1,
+    -0x1.62eed64834a9bp+1,
+    -0x1.62ed9692797f9p+1,
+    -0x1.62ec512d088ccp+1,
+    -0x1.62eb0617d5ef8p+1,
+    -0x1.62e9b552d5c5ep+1,
+    -0x1.62e85eddfc2f2p+1,
+    -0x1.62e702b93d4d5p+1,
+    -0x1.62e5a0e48d41ap+1,
+    -0x1.62e4395fe0333p+1,
+    -0x1.62e2cc2b2a482p+1,
+    -0x1.62e159465fa98p+1,
+    -0x1.62dfe0b174815p+1,
+    -0x1.62de626c5cfacp+1,
+    -0x1.62dcde770d44cp+1,
+    -0x1.62db54d1798f6p+1,
+    -0x1.62d9c57b960aap+1,
+    -0x1.62d8307556e78p+1,
+    -0x1.62d695beb05c1p+1,
+    -0x1.62d4f55796a24p+1,
+    -0x1.62d34f3ffdf1fp+1,
+    -0x1.62d1a377da853p+1,
+    -0x1.62cff1ff2094ep+1,
+    -0x1.62ce3ad5c460fp+1,
+    -0x1.62cc7dfbba2b4p+1,
+    -0x1.62cabb70f635bp+1,
+    -0x1.62c8f3356cc22p+1,
+    -0x1.62c7254912148p+1,
+    -0x1.62c551abda768p+1,
+    -0x1.62c3785dba2e2p+1,
+    -0x1.62c1995ea5862p+1,
+    -0x1.62bfb4ae90c85p+1,
+    -0x1.62bdca4d70417p+1,
+    -0x1.62bbda3b38407p+1,
+    -0x1.62b9e477dd17fp+1,
+    -0x1.62b7e903531bbp+1,
+    -0x1.62b5e7dd8ea07p+1,
+    -0x1.62b3e10683fdfp+1,
+    -0x1.62b1d47e2789ep+1,
+    -0x1.62afc2446d9dfp+1,
+    -0x1.62adaa594a97dp+1,
+    -0x1.62ab8cbcb2d33p+1,
+    -0x1.62a9696e9aaebp+1,
+    -0x1.62a7406ef68afp+1,
+    -0x1.62a511bdbacbap+1,
+    -0x1.62a2dd5adbd35p+1,
+    -0x1.62a0a3464e0aap+1,
+    -0x1.629e638005d92p+1,
+    -0x1.629c1e07f7a86p+1,
+    -0x1.6299d2de17e0fp+1,
+    -0x1.629782025af17p+1,
+    -0x1.62952b74b5475p+1,
+    -0x1.6292cf351b532p+1,
+    -0x1.62906d4381875p+1,
+    -0x1.628e059fdc597p+1,
+    -0x1.628b984a203cfp+1,
+    -0x1.6289254241a84p+1,
+    -0x1.6286ac883513ep+1,
+    -0x1.62842e1beefc4p+1,
+    -0x1.6281a9fd63decp+1,
+    -0x1.627f202c8838dp+1,
+    -0x1.627c90a95088dp+1,
+    -0x1.6279fb73b1512p+1,
+    -0x1.6277608b9f152p+1,
+    -0x1.6274bff10e583p+1,
+    -0x1.627219a3f39ebp+1,
+    -0x1.626f6da44370ep+1,
+    -0x1.626cbbf1f2591p+1,
+    -0x1.626a048cf4e5ap+1,
+    -0x1.626747753fa5dp+1,
+    -0x1.626484aac728dp+1,
+    -0x1.6261bc2d7ffdfp+1,
+    -0x1.625eedfd5eb58p+1,
+    -0x1.625c1a1a57e3bp+1,
+    -0x1.62594084601dcp+1,
+    -0x1.6256613b6bf9dp+1,
+    -0x1.62537c3f70123p+1,
+    -0x1.625091906101fp+1,
+    -0x1.624da12e33654p+1,
+    -0x1.624aab18dbdb6p+1,
+    -0x1.6247af504f016p+1,
+    -0x1.6244add481776p+1,
+    -0x1.6241a6a567df9p+1,
+    -0x1.623e99c2f6dffp+1,
+    -0x1.623b872d231fap+1,
+    -0x1.62386ee3e146cp+1,
+    -0x1.623550e726005p+1,
+    -0x1.62322d36e5f65p+1,
+    -0x1.622f03d315d8ep+1,
+    -0x1.622bd4bbaa56p+1,
+    -0x1.62289ff0981bbp+1,
+    -0x1.62256571d3dbfp+1,
+    -0x1.6222253f524acp+1,
+    -0x1.621edf59081fp+1,
+    -0x1.621b93beea0dbp+1,
+    -0x1.62184270eccfcp+1,
+    -0x1.6214eb6f05223p+1,
+    -0x1.62118eb927bfdp+1,
+    -0x1.620e2c4f49669p+1,
+    -0x1.620ac4315ed55p+1,
+    -0x1.6207565f5cccp+1,
+    -0x1.6203e2d9380e7p+1,
+    -0x1.6200699ee5618p+1,
+    -0x1.61fceab0598ap+1,
+    -0x1.61f9660d894dcp+1,
+    -0x1.61f5dbb669769p+1,
+    -0x1.61f24baaeed05p+1,
+    -0x1.61eeb5eb0e29bp+1,
+    -0x1.61eb1a76bc4f8p+1,
+    -0x1.61e7794dee118p+1,
+    -0x1.61e3d27098407p+1,
+    -0x1.61e025deafae1p+1,
+    -0x1.61dc739829301p+1,
+    -0x1.61d8bb9cf99d2p+1,
+    -0x1.61d4fded15cdp+1,
+    -0x1.61d13a88729a5p+1,
+    -0x1.61cd716f04dddp+1,
+    -0x1.61c9a2a0c1741p+1,
+    -0x1.61c5ce1d9d3dcp+1,
+    -0x1.61c1f3e58d198p+1,
+    -0x1.61be13f885e8fp+1,
+    -0x1.61ba2e567c8eap+1,
+    -0x1.61b642ff65ee3p+1,
+    -0x1.61b251f336ef3p+1,
+    -0x1.61ae5b31e47a3p+1,
+    -0x1.61aa5ebb6378dp+1,
+    -0x1.61a65c8fa8d78p+1,
+    -0x1.61a254aea981dp+1,
+    -0x1.619e47185a694p+1,
+    -0x1.619a33ccb07d5p+1,
+    -0x1.61961acba0ad8p+1,
+    -0x1.6191fc151fed5p+1,
+    -0x1.618dd7a923322p+1,
+    -0x1.6189ad879f748p+1,
+    -0x1.61857db089aacp+1,
+    -0x1.61814823d6ce7p+1,
+    -0x1.617d0ce17bd9ep+1,
+    -0x1.6178cbe96dc88p+1,
+    -0x1.6174853ba199cp+1,
+    -0x1.617038d80c4dfp+1,
+    -0x1.616be6bea2e67p+1,
+    -0x1.61678eef5a68ap+1,
+    -0x1.6163316a27dacp+1,
+    -0x1.615ece2f00433p+1,
+    -0x1.615a653dd8a85p+1,
+    -0x1.6155f696a6115p+1,
+    -0x1.615182395d899p+1,
+    -0x1.614d0825f41e5p+1,
+    -0x1.6148885c5ee0cp+1,
+    -0x1.614402dc92e23p+1,
+    -0x1.613f77a68530ep+1,
+    -0x1.613ae6ba2adfp+1,
+    -0x1.613650177903cp+1,
+    -0x1.6131b3be64b66p+1,
+    -0x1.612d11aee30c1p+1,
+    -0x1.612869e8e91ffp+1,
+    -0x1.6123bc6c6c0c3p+1,
+    -0x1.611f093960edfp+1,
+    -0x1.611a504fbce35p+1,
+    -0x1.611591af750b8p+1,
+    -0x1.6110cd587e889p+1,
+    -0x1.610c034ace7aap+1,
+    -0x1.610733865a05dp+1,
+    -0x1.61025e0b16532p+1,
+    -0x1.60fd82d8f88b9p+1,
+    -0x1.60f8a1eff5d55p+1,
+    -0x1.60f3bb50035a5p+1,
+    -0x1.60eecef91649ap+1,
+    -0x1.60e9dceb23d24p+1,
+    -0x1.60e4e52621213p+1,
+    -0x1.60dfe7aa03696p+1,
+    -0x1.60dae476bfdbep+1,
+    -0x1.60d5db8c4baa9p+1,
+    -0x1.60d0ccea9c0e7p+1,
+    -0x1.60cbb891a63e7p+1,
+    -0x1.60c69e815f718p+1,
+    -0x1.60c17eb9bce28p+1,
+    -0x1.60bc593ab3cd5p+1,
+    -0x1.60b72e04396eep+1,
+    -0x1.60b1fd1643071p+1,
+    -0x1.60acc670c5d4cp+1,
+    -0x1.60a78a13b71ccp+1,
+    -0x1.60a247ff0c21ep+1,
+    -0x1.609d0032ba27p+1,
+    -0x1.6097b2aeb672fp+1,
+    -0x1.60925f72f64e8p+1,
+    -0x1.608d067f6f057p+1,
+    -0x1.6087a7d415e18p+1,
+    -0x1.60824370e02f8p+1,
+    -0x1.607cd955c33d4p+1,
+    -0x1.60776982b4596p+1,
+    -0x1.6071f3f7a8d6bp+1,
+    -0x1.606c78b49608ep+1,
+    -0x1.6066f7b971439p+1,
+    -0x1.606171062fdb9p+1,
+    -0x1.605be49ac7298p+1,
+    -0x1.605652772c871p+1,
+    -0x1.6050ba9b554dep+1,
+    -0x1.604b1d0736d8ap+1,
+    -0x1.604579bac685ep+1,
+    -0x1.603fd0b5f9b55p+1,
+    -0x1.603a21f8c5c68p+1,
+    -0x1.60346d83201a2p+1,
+    -0x1.602eb354fe14ap+1,
+    -0x1.6028f36e551bbp+1,
+    -0x1.60232dcf1a95dp+1,
+    -0x1.601d627743ec9p+1,
+    -0x1.60179166c6878p+1,
+    -0x1.6011ba9d97d22p+1,
+    -0x1.600bde1bad3bfp+1,
+    -0x1.6005fbe0fc317p+1,
+    -0x1.600013ed7a1f2p+1,
+    -0x1.5ffa26411c768p+1,
+    -0x1.5ff432dbd8acfp+1,
+    -0x1.5fee39bda436p+1,
+    -0x1.5fe83ae674881p+1,
+    -0x1.5fe236563f1a9p+1,
+    -0x1.5fdc2c0cf965fp+1,
+    -0x1.5fd61c0a98e58p+1,
+    -0x1.5fd0064f1312bp+1,
+    -0x1.5fc9eada5d69fp+1,
+    -0x1.5fc3c9ac6d69ap+1,
+    -0x1.5fbda2c538941p+1,
+    -0x1.5fb77624b46bap+1,
+    -0x1.5fb143cad6709p+1,
+    -0x1.5fab0bb794295p+1,
+    -0x1.5fa4cdeae31b1p+1,
+    -0x1.5f9e8a64b8ce4p+1,
+    -0x1.5f9841250acc1p+1,
+    -0x1.5f91f22bce9dcp+1,
+    -0x1.5f8b9d78f9cdap+1,
+    -0x1.5f85430c81e9fp+1,
+    -0x1.5f7ee2e65c81fp+1,
+    -0x1.5f787d067f25ep+1,
+    -0x1.5f72116cdf68ep+1,
+    -0x1.5f6ba01972dc4p+1,
+    -0x1.5f65290c2f153p+1,
+    -0x1.5f5eac4509acdp+1,
+    -0x1.5f5829c3f83a4p+1,
+    -0x1.5f51a188f056cp+1,
+    -0x1.5f4b1393e79a6p+1,
+    -0x1.5f447fe4d3a45p+1,
+    -0x1.5f3de67baa14ap+1,
+    -0x1.5f37475860887p+1,
+    -0x1.5f30a27aec9fep+1,
+    -0x1.5f29f7e343fd1p+1,
+    -0x1.5f2347915c45p+1,
+    -0x1.5f1c91852b1acp+1,
+    -0x1.5f15d5bea6246p+1,
+    -0x1.5f0f143dc30ap+1,
+    -0x1.5f084d0277779p+1,
+    -0x1.5f01800cb9192p+1,
+    -0x1.5efaad5c7d98ap+1,
+    -0x1.5ef3d4f1baa62p+1,
+    -0x1.5eecf6cc65f08p+1,
+    -0x1.5ee612ec7528dp+1,
+    -0x1.5edf2951ddfep+1,
+    -0x1.5ed839fc96231p+1,
+    -0x1.5ed144ec934fep+1,
+    -0x1.5eca4a21cb3c6p+1,
+    -0x1.5ec3499c339e8p+1,
+    -0x1.5ebc435bc2321p+1,
+    -0x1.5eb537606cb1p+1,
+    -0x1.5eae25aa28d54p+1,
+    -0x1.5ea70e38ec5cap+1,
+    -0x1.5e9ff10cad07p+1,
+    -0x1.5e98ce2560973p+1,
+    -0x1.5e91a582fcce1p+1,
+    -0x1.5e8a7725776f6p+1,
+    -0x1.5e83430cc64p+1,
+    -0x1.5e7c0938df05bp+1,
+    -0x1.5e74c9a9b78a4p+1,
+    -0x1.5e6d845f45987p+1,
+    -0x1.5e6639597efb1p+1,
+    -0x1.5e5ee898597cdp+1,
+    -0x1.5e57921bcae98p+1,
+    -0x1.5e5035e3c910cp+1,
+    -0x1.5e48d3f049c46p+1,
+    -0x1.5e416c4142d9p+1,
+    -0x1.5e39fed6aa206p+1,
+    -0x1.5e328bb0756d4p+1,
+    -0x1.5e2b12ce9a993p+1,
+    -0x1.5e2394310f7bep+1,
+    -0x1.5e1c0fd7c9ecfp+1,
+    -0x1.5e1485c2bfc8p+1,
+    -0x1.5e0cf5f1e6e9cp+1,
+    -0x1.5e056065352ecp+1,
+    -0x1.5dfdc51ca074bp+1,
+    -0x1.5df624181e9c2p+1,
+    -0x1.5dee7d57a5849p+1,
+    -0x1.5de6d0db2b13bp+1,
+    -0x1.5ddf1ea2a52cfp+1,
+    -0x1.5dd766ae09b4p+1,
+    -0x1.5dcfa8fd4e906p+1,
+    -0x1.5dc7e59069ab9p+1,
+    -0x1.5dc01c6750f21p+1,
+    -0x1.5db84d81fa4e6p+1,
+    -0x1.5db078e05baep+1,
+    -0x1.5da89e826aff7p+1,
+    -0x1.5da0be681e322p+1,
+    -0x1.5d98d8916b388p+1,
+    -0x1.5d90ecfe48031p+1,
+    -0x1.5d88fbaeaa853p+1,
+    -0x1.5d8104a288b46p+1,
+    -0x1.5d7907d9d889p+1,
+    -0x1.5d7105548ff97p+1,
+    -0x1.5d68fd12a4ff2p+1,
+    -0x1.5d60ef140d957p+1,
+    -0x1.5d58db58bfbacp+1,
+    -0x1.5d50c1e0b16b7p+1,
+    -0x1.5d48a2abd8a6dp+1,
+    -0x1.5d407dba2b6d3p+1,
+    -0x1.5d38530b9fbffp+1,
+    -0x1.5d3022a02ba45p+1,
+    -0x1.5d27ec77c520bp+1,
+    -0x1.5d1fb092623b5p+1,
+    -0x1.5d176eeff8fa7p+1,
+    -0x1.5d0f27907f657p+1,
+    -0x1.5d06da73eb877p+1,
+    -0x1.5cfe879a336ccp+1,
+    -0x1.5cf62f034d219p+1,
+    -0x1.5cedd0af2eb33p+1,
+    -0x1.5ce56c9dce32dp+1,
+    -0x1.5cdd02cf21b2ap+1,
+    -0x1.5cd493431f44dp+1,
+    -0x1.5ccc1df9bcfc9p+1,
+    -0x1.5cc3a2f2f0f11p+1,
+    -0x1.5cbb222eb13a7p+1,
+    -0x1.5cb29bacf3f0dp+1,
+    -0x1.5caa0f6daf2d6p+1,
+    -0x1.5ca17d70d90c3p+1,
+    -0x1.5c98e5b667a77p+1,
+    -0x1.5c90483e511c3p+1,
+    -0x1.5c87a5088b899p+1,
+    -0x1.5c7efc150d11ap+1,
+    -0x1.5c764d63cbd48p+1,
+    -0x1.5c6d98f4bdf52p+1,
+    -0x1.5c64dec7d997bp+1,
+    -0x1.5c5c1edd14e13p+1,
+    -0x1.5c53593465faap+1,
+    -0x1.5c4a8dcdc30ep+1,
+    -0x1.5c41bca922455p+1,
+    -0x1.5c38e5c679cbap+1,
+    -0x1.5c300925bfcfep+1,
+    -0x1.5c2726c6ea81fp+1,
+    -0x1.5c1e3ea9f011ep+1,
+    -0x1.5c1550cec6afap+1,
+    -0x1.5c0c5d35648b2p+1,
+    -0x1.5c0363ddbfd56p+1,
+    -0x1.5bfa64c7cec34p+1,
+    -0x1.5bf15ff3878bap+1,
+    -0x1.5be85560e0687p+1,
+    -0x1.5bdf450fcf91ap+1,
+    -0x1.5bd62f004b41fp+1,
+    -0x1.5bcd133249b55p+1,
+    -0x1.5bc3f1a5c1289p+1,
+    -0x1.5bbaca5aa7db9p+1,
+    -0x1.5bb19d50f40c3p+1,
+    -0x1.5ba86a889bfb3p+1,
+    -0x1.5b9f320195eb8p+1,
+    -0x1.5b95f3bbd822cp+1,
+    -0x1.5b8cafb758e4dp+1,
+    -0x1.5b8365f40e787p+1,
+    -0x1.5b7a1671ef258p+1,
+    -0x1.5b70c130f134bp+1,
+    -0x1.5b6766310af2bp+1,
+    -0x1.5b5e057232ac4p+1,
+    -0x1.5b549ef45eac3p+1,
+    -0x1.5b4b32b785433p+1,
+    -0x1.5b41c0bb9cbffp+1,
+    -0x1.5b3849009b722p+1,
+    -0x1.5b2ecb8677af6p+1,
+    -0x1.5b25484d27c97p+1,
+    -0x1.5b1bbf54a217p+1,
+    -0x1.5b12309cdcedap+1,
+    -0x1.5b089c25cea6p+1,
+    -0x1.5aff01ef6d99cp+1,
+    -0x1.5af561f9b0238p+1,
+    -0x1.5aebbc448ca0ep+1,
+    -0x1.5ae210cff96d8p+1,
+    -0x1.5ad85f9bece7fp+1,
+    -0x1.5acea8a85d6fbp+1,
+    -0x1.5ac4ebf541657p+1,
+    -0x1.5abb29828f2dbp+1,
+    -0x1.5ab161503d2dfp+1,
+    -0x1.5aa7935e41cbdp+1,
+    -0x1.5a9dbfac936ccp+1,
+    -0x1.5a93e63b28775p+1,
+    -0x1.5a8a0709f756p+1,
+    -0x1.5a802218f6744p+1,
+    -0x1.5a7637681c3dap+1,
+    -0x1.5a6c46f75f1e8p+1,
+    -0x1.5a6250c6b5867p+1,
+    -0x1.5a5854d615e2ep+1,
+    -0x1.5a4e532576a54p+1,
+    -0x1.5a444bb4ce42fp+1,
+    -0x1.5a3a3e84132e7p+1,
+    -0x1.5a302b933bdb1p+1,
+    -0x1.5a2612e23ec35p+1,
+    -0x1.5a1bf471125f8p+1,
+    -0x1.5a11d03fad27p+1,
+    -0x1.5a07a64e05923p+1,
+    -0x1.59fd769c121d8p+1,
+    -0x1.59f34129c9464p+1,
+    -0x1.59e905f7218acp+1,
+    -0x1.59dec504116c5p+1,
+    -0x1.59d47e508f6a4p+1,
+    -0x1.59ca31dc9206ep+1,
+    -0x1.59bfdfa80fc58p+1,
+    -0x1.59b587b2ff2a7p+1,
+    -0x1.59ab29fd56bdfp+1,
+    -0x1.59a0c6870d084p+1,
+    -0x1.59965d50188eap+1,
+    -0x1.598bee586fda5p+1,
+    -0x1.598179a00978ap+1,
+    -0x1.5976ff26dbf4bp+1,
+    -0x1.596c7eecdddccp+1,
+    -0x1.5961f8f205c1p+1,
+    -0x1.59576d364a34ap+1,
+    -0x1.594cdbb9a1c8dp+1,
+    -0x1.5942447c0310bp+1,
+    -0x1.5937a77d649d7p+1,
+    -0x1.592d04bdbd045p+1,
+    -0x1.59225c3d02df5p+1,
+    -0x1.5917adfb2cc8ap+1,
+    -0x1.590cf9f831577p+1,
+    -0x1.590240340726cp+1,
+    -0x1.58f780aea4d5bp+1,
+    -0x1.58ecbb6801006p+1,
+    -0x1.58e1f0601242dp+1,
+    -0x1.58d71f96cf3d3p+1,
+    -0x1.58cc490c2e917p+1,
+    -0x1.58c16cc026e4cp+1,
+    -0x1.58b68ab2aeda1p+1,
+    -0x1.58aba2e3bd176p+1,
+    -0x1.58a0b5534843cp+1,
+    -0x1.5895c20147063p+1,
+    -0x1.588ac8edb006bp+1,
+    -0x1.587fca1879f14p+1,
+    -0x1.5874c5819b72dp+1,
+    -0x1.5869bb290b385p+1,
+    -0x1.585eab0ebfeedp+1,
+    -0x1.58539532b0443p+1,
+    -0x1.58487994d2ea6p+1,
+    -0x1.583d58351e945p+1,
+    -0x1.5832311389f4fp+1,
+    -0x1.582704300bbf2p+1,
+    -0x1.581bd18a9aa6dp+1,
+    -0x1.581099232d63ep+1,
+    -0x1.58055af9baaf3p+1,
+    -0x1.57fa170e3941ap+1,
+    -0x1.57eecd609fd5p+1,
+    -0x1.57e37df0e5274p+1,
+    -0x1.57d828befff71p+1,
+    -0x1.57cccdcae7036p+1,
+    -0x1.57c16d14910bfp+1,
+    -0x1.57b6069bf4d3ap+1,
+    -0x1.57aa9a61091b2p+1,
+    -0x1.579f2863c4a65p+1,
+    -0x1.5793b0a41e3ap+1,
+    -0x1.578833220c9aep+1,
+    -0x1.577cafdd868ecp+1,
+    -0x1.577126d682e05p+1,
+    -0x1.5765980cf85d4p+1,
+    -0x1.575a0380ddce6p+1,
+    -0x1.574e69322a016p+1,
+    -0x1.5742c920d3c3p+1,
+    -0x1.5737234cd1e2ep+1,
+    -0x1.572b77b61b31bp+1,
+    -0x1.571fc65ca6813p+1,
+    -0x1.57140f406aa5fp+1,
+    -0x1.570852615e72ap+1,
+    -0x1.56fc8fbf78bcep+1,
+    -0x1.56f0c75ab05b7p+1,
+    -0x1.56e4f932fc24ep+1,
+    -0x1.56d9254852f0dp+1,
+    -0x1.56cd4b9aab9acp+1,
+    -0x1.56c16c29fcff7p+1,
+    -0x1.56b586f63dfb6p+1,
+    -0x1.56a99bff656c2p+1,
+    -0x1.569dab456a325p+1,
+    -0x1.5691b4c8432c7p+1,
+    -0x1.5685b887e73d1p+1,
+    -0x1.5679b6844d4acp+1,
+    -0x1.566daebd6c38fp+1,
+    -0x1.5661a1333aeb4p+1,
+    -0x1.56558de5b0492p+1,
+    -0x1.564974d4c33b1p+1,
+    -0x1.563d56006aa9ap+1,
+    -0x1.563131689d7e4p+1,
+    -0x1.5625070d52a65p+1,
+    -0x1.5618d6ee81106p+1,
+    -0x1.560ca10c1faadp+1,
+    -0x1.5600656625642p+1,
+    -0x1.55f423fc892bbp+1,
+    -0x1.55e7dccf41f4p+1,
+    -0x1.55db8fde46ae7p+1,
+    -0x1.55cf3d298e526p+1,
+    -0x1.55c2e4b10fd53p+1,
+    -0x1.55b68674c22c4p+1,
+    -0x1.55aa22749c51p+1,
+    -0x1.559db8b0953dcp+1,
+    -0x1.55914928a3ecdp+1,
+    -0x1.5584d3dcbf588p+1,
+    -0x1.557858ccde7c4p+1,
+    -0x1.556bd7f8f8576p+1,
+    -0x1.555f516103ea2p+1,
+    -0x1.5552c504f834dp+1,
+    -0x1.554632e4cc38dp+1,
+    -0x1.55399b0076fa5p+1,
+    -0x1.552cfd57ef7bap+1,
+    -0x1.552059eb2cc2p+1,
+    -0x1.5513b0ba25d4bp+1,
+    -0x1.550701c4d1bdfp+1,
+    -0x1.54fa4d0b2786p+1,
+    -0x1.54ed928d1e382p+1,
+    -0x1.54e0d24aace06p+1,
+    -0x1.54d40c43ca8b2p+1,
+    -0x1.54c740786e458p+1,
+    -0x1.54ba6ee88f20bp+1,
+    -0x1.54ad9794242ddp+1,
+    -0x1.54a0ba7b247c2p+1,
+    -0x1.5493d79d8720bp+1,
+    -0x1.5486eefb432ebp+1,
+    -0x1.547a00944fb95p+1,
+    -0x1.546d0c68a3d7ap+1,
+    -0x1.5460127836a1dp+1,
+    -0x1.545312c2ff30fp+1,
+    -0x1.54460d48f4a11p+1,
+    -0x1.5439020a0e0c5p+1,
+    -0x1.542bf106428fdp+1,
+    -0x1.541eda3d89499p+1,
+    -0x1.5411bdafd957ap+1,
+    -0x1.54049b5d29d91p+1,
+    -0x1.53f7734571f0fp+1,
+    -0x1.53ea4568a8c35p+1,
+    -0x1.53dd11c6c5742p+1,
+    -0x1.53cfd85fbf287p+1,
+    -0x1.53c299338d084p+1,
+    -0x1.53b5544226398p+1,
+    -0x1.53a8098b81e53p+1,
+    -0x1.539ab90f97354p+1,
+    -0x1.538d62ce5d53cp+1,
+    -0x1.538006c7cb6bap+1,
+    -0x1.5372a4fbd8abdp+1,
+    -0x1.53653d6a7c444p+1,
+    -0x1.5357d013ad64dp+1,
+    -0x1.534a5cf7633d6p+1,
+    -0x1.533ce41594ffp+1,
+    -0x1.532f656e39de8p+1,
+    -0x1.5321e1014911cp+1,
+    -0x1.531456ceb9ceap+1,
+    -0x1.5306c6d6834bp+1,
+    -0x1.52f931189cbddp+1,
+    -0x1.52eb9594fd61cp+1,
+    -0x1.52ddf44b9c72dp+1,
+    -0x1.52d04d3c712ccp+1,
+    -0x1.52c2a06772cb6p+1,
+    -0x1.52b4edcc988b9p+1,
+    -0x1.52a7356bd9ae1p+1,
+    -0x1.529977452d74ap+1,
+    -0x1.528bb3588b213p+1,
+    -0x1.527de9a5e9f56p+1,
+    -0x1.52701a2d4134p+1,
+    -0x1.526244ee8822ep+1,
+    -0x1.525469e9b605bp+1,
+    -0x1.5246891ec2244p+1,
+    -0x1.5238a28da3ca4p+1,
+    -0x1.522ab63652415p+1,
+    -0x1.521cc418c4d54p+1,
+    -0x1.520ecc34f2cfcp+1,
+    -0x1.5200ce8ad37d8p+1,
+    -0x1.51f2cb1a5e2d3p+1,
+    -0x1.51e4c1e38a308p+1,
+    -0x1.51d6b2e64ed71p+1,
+    -0x1.51c89e22a3738p+1,
+    -0x1.51ba83987f599p+1,
+    -0x1.51ac6347d9dddp+1,
+    -0x1.519e3d30aa57dp+1,
+    -0x1.51901152e81d4p+1,
+    -0x1.5181dfae8a86cp+1,
+    -0x1.5173a84388edfp+1,
+    -0x1.51656b11daac5p+1,
+    -0x1.51572819771c8p+1,
+    -0x1.5148df5a559d1p+1,
+    -0x1.513a90d46d8d8p+1,
+    -0x1.512c3c87b64d6p+1,
+    -0x1.511de274273c5p+1,
+    -0x1.510f8299b7b9dp+1,
+    -0x1.51011cf85f266p+1,
+    -0x1.50f2b19014e69p+1,
+    -0x1.50e44060d05fdp+1,
+    -0x1.50d5c96a88f8bp+1,
+    -0x1.50c74cad361aap+1,
+    -0x1.50b8ca28cf2d2p+1,
+    -0x1.50aa41dd4b9abp+1,
+    -0x1.509bb3caa2cdap+1,
+    -0x1.508d1ff0cc2e9p+1,
+    -0x1.507e864fbf2bdp+1,
+    -0x1.506fe6e77332fp+1,
+    -0x1.506141b7dfb44p+1,
+    -0x1.505296c0fc213p+1,
+    -0x1.5043e602bfeb3p+1,
+    -0x1.50352f7d2283ap+1,
+    -0x1.502673301b5cep+1,
+    -0x1.5017b11ba1ed6p+1,
+    -0x1.5008e93fadac7p+1,
+    -0x1.4ffa1b9c36117p+1,
+    -0x1.4feb48313294ap+1,
+    -0x1.4fdc6efe9ab17p+1,
+    -0x1.4fcd900465e13p+1,
+    -0x1.4fbeab428ba03p+1,
+    -0x1.4fafc0b9036bcp+1,
+    -0x1.4fa0d067c4c13p+1,
+    -0x1.4f91da4ec71eep+1,
+    -0x1.4f82de6e0207p+1,
+    -0x1.4f73dcc56cfcdp+1,
+    -0x1.4f64d554ff83ap+1,
+    -0x1.4f55c81cb11eap+1,
+    -0x1.4f46b51c79522p+1,
+    -0x1.4f379c544fa66p+1,
+    -0x1.4f287dc42ba39p+1,
+    -0x1.4f19596c04cfep+1,
+    -0x1.4f0a2f4bd2b7ap+1,
+    -0x1.4efaff638ce5p+1,
+    -0x1.4eebc9b32ae22p+1,
+    -0x1.4edc8e3aa43d4p+1,
+    -0x1.4ecd4cf9f0858p+1,
+    -0x1.4ebe05f1074ap+1,
+    -0x1.4eaeb91fe01bp+1,
+    -0x1.4e9f6686728bap+1,
+    -0x1.4e900e24b62dp+1,
+    -0x1.4e80affaa2935p+1,
+    -0x1.4e714c082f53ap+1,
+    -0x1.4e61e24d54041p+1,
+    -0x1.4e5272ca083dbp+1,
+    -0x1.4e42fd7e4397ap+1,
+    -0x1.4e338269fdacp+1,
+    -0x1.4e24018d2e15dp+1,
+    -0x1.4e147ae7cc703p+1,
+    -0x1.4e04ee79d0572p+1,
+    -0x1.4df55c433169dp+1,
+    -0x1.4de5c443e7463p+1,
+    -0x1.4dd6267be9904p+1,
+    -0x1.4dc682eb2fea1p+1,
+    -0x1.4db6d991b1f59p+1,
+    -0x1.4da72a6f6757dp+1,
+    -0x1.4d97758447b3dp+1,
+    -0x1.4d87bad04aafap+1,
+    -0x1.4d77fa5367f22p+1,
+    -0x1.4d68340d97236p+1,
+    -0x1.4d5867fecfee4p+1,
+    -0x1.4d48962709fbcp+1,
+    -0x1.4d38be863cf7dp+1,
+    -0x1.4d28e11c608f5p+1,
+    -0x1.4d18fde96c703p+1,
+    -0x1.4d0914ed584b7p+1,
+    -0x1.4cf926281bcfep+1,
+    -0x1.4ce93199aeaf7p+1,
+    -0x1.4cd93742089dp+1,
+    -0x1.4cc93721214b7p+1,
+    -0x1.4cb93136f06eap+1,
+    -0x1.4ca925836dbe7p+1,
+    -0x1.4c99140690f2cp+1,
+    -0x1.4c88fcc051c15p+1,
+    -0x1.4c78dfb0a7e61p+1,
+    -0x1.4c68bcd78b1acp+1,
+    -0x1.4c589434f3193p+1,
+    -0x1.4c4865c8d79f4p+1,
+    -0x1.4c383193306bbp+1,
+    -0x1.4c27f793f53d5p+1,
+    -0x1.4c17b7cb1dd2ep+1,
+    -0x1.4c077238a1ec3p+1,
+    -0x1.4bf726dc794cp+1,
+    -0x1.4be6d5b69bb32p+1,
+    -0x1.4bd67ec700e64p+1,
+    -0x1.4bc6220da0ae1p+1,
+    -0x1.4bb5bf8a72d06p+1,
+    -0x1.4ba5573d6f12ep+1,
+    -0x1.4b94e9268d3f5p+1,
+    -0x1.4b847545c5205p+1,
+    -0x1.4b73fb9b0e80ap+1,
+    -0x1.4b637c26612bep+1,
+    -0x1.4b52f6e7b4f0dp+1,
+    -0x1.4b426bdf019c1p+1,
+    -0x1.4b31db0c3efd5p+1,
+    -0x1.4b21446f64e53p+1,
+    -0x1.4b10a8086b246p+1,
+    -0x1.4b0005d7498c8p+1,
+    -0x1.4aef5ddbf7f33p+1,
+    -0x1.4adeb0166e2efp+1,
+    -0x1.4acdfc86a4157p+1,
+    -0x1.4abd432c917a5p+1,
+    -0x1.4aac84082e372p+1,
+    -0x1.4a9bbf1972247p+1,
+    -0x1.4a8af460551dep+1,
+    -0x1.4a7a23dccefffp+1,
+    -0x1.4a694d8ed7a74p+1,
+    -0x1.4a58717666f05p+1,
+    -0x1.4a478f9374b8ap+1,
+    -0x1.4a36a7e5f8e1dp+1,
+    -0x1.4a25ba6deb4d5p+1,
+    -0x1.4a14c72b43dabp+1,
+    -0x1.4a03ce1dfa6f6p+1,
+    -0x1.49f2cf4606eefp+1,
+    -0x1.49e1caa3613cdp+1,
+    -0x1.49d0c03601408p+1,
+    -0x1.49bfaffddee27p+1,
+    -0x1.49ae99faf20b2p+1,
+    -0x1.499d7e2d32a3p+1,
+    -0x1.498c5c9498938p+1,
+    -0x1.497b35311bca1p+1,
+    -0x1.496a0802b4352p+1,
+    -0x1.4958d50959c31p+1,
+    -0x1.49479c4504624p+1,
+    -0x1.49365db5ac022p+1,
+    -0x1.4925195b48951p+1,
+    -0x1.4913cf35d20b9p+1,
+    -0x1.49027f454058ep+1,
+    -0x1.48f129898b716p+1,
+    -0x1.48dfce02ab4a7p+1,
+    -0x1.48ce6cb097dc7p+1,
+    -0x1.48bd0593491dbp+1,
+    -0x1.48ab98aab7078p+1,
+    -0x1.489a25f6d9944p+1,
+    -0x1.4888ad77a8bf3p+1,
+    -0x1.48772f2d1c869p+1,
+    -0x1.4865ab172ce6cp+1,
+    -0x1.48542135d1dep+1,
+    -0x1.484291890369ap+1,
+    -0x1.4830fc10b98cep+1,
+    -0x1.481f60ccec49p+1,
+    -0x1.480dbfbd939f4p+1,
+    -0x1.47fc18e2a793ep+1,
+    -0x1.47ea6c3c20293p+1,
+    -0x1.47d8b9c9f5656p+1,
+    -0x1.47c7018c1f52ap+1,
+    -0x1.47b5438295f81p+1,
+    -0x1.47a37fad515dp+1,
+    -0x1.4791b60c498cap+1,
+    -0x1.477fe69f76932p+1,
+    -0x1.476e1166d07c9p+1,
+    -0x1.475c36624f554p+1,
+    -0x1.474a5591eb2a4p+1,
+    -0x1.47386ef59c0ccp+1,
+    -0x1.4726828d5a0eep+1,
+    -0x1.471490591d41cp+1,
+    -0x1.47029858ddb49p+1,
+    -0x1.46f09a8c937c6p+1,
+    -0x1.46de96f436ad5p+1,
+    -0x1.46cc8d8fbf5e8p+1,
+    -0x1.46ba7e5f25a7fp+1,
+    -0x1.46a8696261a1dp+1,
+    -0x1.46964e996b642p+1,
+    -0x1.46842e043b07fp+1,
+    -0x1.467207a2c8a95p+1,
+    -0x1.465fdb750c626p+1,
+    -0x1.464da97afe502p+1,
+    -0x1.463b71b49690ap+1,
+    -0x1.46293421cd42ep+1,
+    -0x1.4616f0c29a89ep+1,
+    -0x1.4604a796f688ap+1,
+    -0x1.45f2589ed95f2p+1,
+    -0x1.45e003da3b306p+1,
+    -0x1.45cda94914215p+1,
+    -0x1.45bb48eb5c59fp+1,
+    -0x1.45a8e2c10c003p+1,
+    -0x1.459676ca1b3d1p+1,
+    -0x1.45840506823a8p+1,
+    -0x1.45718d7639226p+1,
+    -0x1.455f1019381ebp+1,
+    -0x1.454c8cef775a5p+1,
+    -0x1.453a03f8ef043p+1,
+    -0x1.45277535974b4p+1,
+    -0x1.4514e0a5685b6p+1,
+    -0x1.450246485a647p+1,
+    -0x1.44efa61e659a6p+1,
+    -0x1.44dd0027822fp+1,
+    -0x1.44ca5463a8563p+1,
+    -0x1.44b7a2d2d041dp+1,
+    -0x1.44a4eb74f227bp+1,
+    -0x1.44922e4a0641bp+1,
+    -0x1.447f6b5204c6ap+1,
+    -0x1.446ca28ce5ed4p+1,
+    -0x1.4459d3faa1f08p+1,
+    -0x1.4446ff9b310c2p+1,
+    -0x1.4434256e8b7bep+1,
+    -0x1.44214574a97bap+1,
+    -0x1.440e5fad83482p+1,
+    -0x1.43fb741911222p+1,
+    -0x1.43e882b74b4b6p+1,
+    -0x1.43d58b882a05ap+1,
+    -0x1.43c28e8ba592ap+1,
+    -0x1.43af8bc1b6343p+1,
+    -0x1.439c832a542dp+1,
+    -0x1.438974c577c3cp+1,
+    -0x1.43766093193f2p+1,
+    -0x1.4363469330e2fp+1,
+    -0x1.435026c5b6f6ep+1,
+    -0x1.433d012aa3c6ap+1,
+    -0x1.4329d5c1ef9bdp+1,
+    -0x1.4316a48b92c32p+1,
+    -0x1.43036d87858a4p+1,
+    -0x1.42f030b5c03edp+1,
+    -0x1.42dcee163b2e8p+1,
+    -0x1.42c9a5a8eea7fp+1,
+    -0x1.42b6576dd2fcbp+1,
+    -0x1.42a30364e07c7p+1,
+    -0x1.428fa98e0f79ep+1,
+    -0x1.427c49e958497p+1,
+    -0x1.4268e476b342ep+1,
+    -0x1.4255793618babp+1,
+    -0x1.4242082781058p+1,
+    -0x1.422e914ae47bep+1,
+    -0x1.421b14a03b777p+1,
+    -0x1.420792277e51ap+1,
+    -0x1.41f409e0a5651p+1,
+    -0x1.41e07bcba90f5p+1,
+    -0x1.41cce7e881abep+1,
+    -0x1.41b94e3727994p+1,
+    -0x1.41a5aeb79336fp+1,
+    -0x1.41920969bce48p+1,
+    -0x1.417e5e4d9d027p+1,
+    -0x1.416aad632bf44p+1,
+    -0x1.4156f6aa621b7p+1,
+    -0x1.41433a2337dc7p+1,
+    -0x1.412f77cda59ccp+1,
+    -0x1.411bafa9a3c2cp+1,
+    -0x1.4107e1b72ab8p+1,
+    -0x1.40f40df632e3dp+1,
+    -0x1.40e03466b4b0cp+1,
+    -0x1.40cc5508a88a2p+1,
+    -0x1.40b86fdc06db6p+1,
+    -0x1.40a484e0c81p+1,
+    -0x1.40909416e4945p+1,
+    -0x1.407c9d7e54d7cp+1,
+    -0x1.4068a1171147bp+1,
+    -0x1.40549ee112549p+1,
+    -0x1.404096dc5070bp+1,
+    -0x1.402c8908c4117p+1,
+    -0x1.4018756665a92p+1,
+    -0x1.40045bf52daa3p+1,
+    -0x1.3ff03cb5148aep+1,
+    -0x1.3fdc17a612c29p+1,
+    -0x1.3fc7ecc820c88p+1,
+    -0x1.3fb3bc1b37152p+1,
+    -0x1.3f9f859f4e23ap+1,
+    -0x1.3f8b49545e6d6p+1,
+    -0x1.3f77073a606eap+1,
+    -0x1.3f62bf514ca4bp+1,
+    -0x1.3f4e71991b8cdp+1,
+    -0x1.3f3a1e11c5a54p+1,
+    -0x1.3f25c4bb436f4p+1,
+    -0x1.3f1165958d6a2p+1,
+    -0x1.3efd00a09c181p+1,
+    -0x1.3ee895dc67fc5p+1,
+    -0x1.3ed42548e99a2p+1,
+    -0x1.3ebfaee61975bp+1,
+    -0x1.3eab32b3f0163p+1,
+    -0x1.3e96b0b26600ep+1,
+    -0x1.3e8228e173bdep+1,
+    -0x1.3e6d9b4111d68p+1,
+    -0x1.3e5907d138d3dp+1,
+    -0x1.3e446e91e1401p+1,
+    -0x1.3e2fcf8303a96p+1,
+    -0x1.3e1b2aa4989ddp+1,
+    -0x1.3e067ff698a8ap+1,
+    -0x1.3df1cf78fc57fp+1,
+    -0x1.3ddd192bbc3bep+1,
+    -0x1.3dc85d0ed0e78p+1,
+    -0x1.3db39b2232ecp+1,
+    -0x1.3d9ed365dadc7p+1,
+    -0x1.3d8a05d9c14bp+1,
+    -0x1.3d75327ddecfap+1,
+    -0x1.3d6059522c008p+1,
+    -0x1.3d4b7a56a173ap+1,
+    -0x1.3d36958b37c22p+1,
+    -0x1.3d21aaefe783p+1,
+    -0x1.3d0cba84a9506p+1,
+    -0x1.3cf7c44975c54p+1,
+    -0x1.3ce2c83e457dap+1,
+    -0x1.3ccdc66311189p+1,
+    -0x1.3cb8beb7d1331p+1,
+    -0x1.3ca3b13c7e6c3p+1,
+    -0x1.3c8e9df11160ep+1,
+    -0x1.3c7984d582b23p+1,
+    -0x1.3c6465e9cb05p+1,
+    -0x1.3c4f412de2fb6p+1,
+    -0x1.3c3a16a1c3374p+1,
+    -0x1.3c24e645645eap+1,
+    -0x1.3c0fb018bf187p+1,
+    -0x1.3bfa741bcc0bap+1,
+    -0x1.3be5324e83e02p+1,
+    -0x1.3bcfeab0df40ep+1,
+    -0x1.3bba9d42d6d5cp+1,
+    -0x1.3ba54a046346cp+1,
+    -0x1.3b8ff0f57d3fcp+1,
+    -0x1.3b7a92161d6eap+1,
+    -0x1.3b652d663c845p+1,
+    -0x1.3b4fc2e5d32eap+1,
+    -0x1.3b3a5294da1b8p+1,
+    -0x1.3b24dc7349fccp+1,
+    -0x1.3b0f60811b855p+1,
+    -0x1.3af9debe4767fp+1,
+    -0x1.3ae4572ac6578p+1,
+    -0x1.3acec9c69107ep+1,
+    -0x1.3ab93691a02ffp+1,
+    -0x1.3aa39d8bec847p+1,
+    -0x1.3a8dfeb56ebd3p+1,
+    -0x1.3a785a0e1f93p+1,
+    -0x1.3a62af95f7bfbp+1,
+    -0x1.3a4cff4cf0001p+1,
+    -0x1.3a374933010eep+1,
+    -0x1.3a218d4823a9ep+1,
+    -0x1.3a0bcb8c508fdp+1,
+    -0x1.39f603ff807f7p+1,
+    -0x1.39e036a1ac378p+1,
+    -0x1.39ca6372cc77dp+1,
+    -0x1.39b48a72da031p+1,
+    -0x1.399eaba1cd9ap+1,
+    -0x1.3988c6ffa0005p+1,
+    -0x1.3972dc8c49facp+1,
+    -0x1.395cec47c44fp+1,
+    -0x1.3946f63207c5cp+1,
+    -0x1.3930fa4b0d25bp+1,
+    -0x1.391af892cd387p+1,
+    -0x1.3904f10940c7bp+1,
+    -0x1.38eee3ae609a3p+1,
+    -0x1.38d8d082257a9p+1,
+    -0x1.38c2b78488377p+1,
+    -0x1.38ac98b5819d7p+1,
+    -0x1.389674150a7b4p+1,
+    -0x1.388049a31b9e7p+1,
+    -0x1.386a195faddabp+1,
+    -0x1.3853e34aba019p+1,
+    -0x1.383da76438e4bp+1,
+    -0x1.382765ac23589p+1,
+    -0x1.38111e22722fep+1,
+    -0x1.37fad0c71e403p+1,
+    -0x1.37e47d9a206p+1,
+    -0x1.37ce249b7166p+1,
+    -0x1.37b7c5cb0a28ap+1,
+    -0x1.37a16128e37f9p+1,
+    -0x1.378af6b4f6464p+1,
+    -0x1.3774866f3b593p+1,
+    -0x1.375e1057ab94fp+1,
+    -0x1.3747946e3fd61p+1,
+    -0x1.373112b2f0f91p+1,
+    -0x1.371a8b25b7db7p+1,
+    -0x1.3703fdc68d5eap+1,
+    -0x1.36ed6a956a642p+1,
+    -0x1.36d6d19247cb7p+1,
+    -0x1.36c032bd1e7a1p+1,
+    -0x1.36a98e15e7537p+1,
+    -0x1.3692e39c9b3bp+1,
+    -0x1.367c335133174p+1,
+    -0x1.36657d33a7cc9p+1,
+    -0x1.364ec143f2427p+1,
+    -0x1.3637ff820b624p+1,
+    -0x1.362137edec186p+1,
+    -0x1.360a6a878d4e5p+1,
+    -0x1.35f3974ee7ed7p+1,
+    -0x1.35dcbe43f4e32p+1,
+    -0x1.35c5df66ad1dcp+1,
+    -0x1.35aefab7098bbp+1,
+    -0x1.35981035031b6p+1,
+    -0x1.35811fe092bc2p+1,
+    -0x1.356a29b9b1605p+1,
+    -0x1.35532dc057f85p+1,
+    -0x1.353c2bf47f776p+1,
+    -0x1.3525245620d1ep+1,
+    -0x1.350e16e534fd2p+1,
+    -0x1.34f703a1b4f18p+1,
+    -0x1.34dfea8b99a54p+1,
+    -0x1.34c8cba2dc10cp+1,
+    -0x1.34b1a6e7752a3p+1,
+    -0x1.349a7c595deafp+1,
+    -0x1.34834bf88f4e5p+1,
+    -0x1.346c15c502528p+1,
+    -0x1.3454d9beaff2cp+1,
+    -0x1.343d97e5912a6p+1,
+    -0x1.342650399ef8ap+1,
+    -0x1.340f02bad25dcp+1,
+    -0x1.33f7af69245bp+1,
+    -0x1.33e056448df48p+1,
+    -0x1.33c8f74d082b8p+1,
+    -0x1.33b192828c015p+1,
+    -0x1.339a27e5127bp+1,
+    -0x1.3382b774949eep+1,
+    -0x1.336b41310b731p+1,
+    -0x1.3353c51a6ffdcp+1,
+    -0x1.333c4330bb462p+1,
+    -0x1.3324bb73e6566p+1,
+    -0x1.330d2de3ea36ap+1,
+    -0x1.32f59a80bff21p+1,
+    -0x1.32de014a6095dp+1,
+    -0x1.32c66240c532p+1,
+    -0x1.32aebd63e6d3cp+1,
+    -0x1.329712b3be883p+1,
+    -0x1.327f623045607p+1,
+    -0x1.3267abd9746e9p+1,
+    -0x1.324fefaf44c3bp+1,
+    -0x1.32382db1af6eep+1,
+    -0x1.322065e0ad854p+1,
+    -0x1.3208983c381aep+1,
+    -0x1.31f0c4c44845dp+1,
+    -0x1.31d8eb78d71a3p+1,
+    -0x1.31c10c59ddafp+1,
+    -0x1.31a92767551d4p+1,
+    -0x1.31913ca13681p+1,
+    -0x1.31794c077af36p+1,
+    -0x1.3161559a1b8d5p+1,
+    -0x1.31495959116bdp+1,
+    -0x1.3131574455acfp+1,
+    -0x1.31194f5be16eap+1,
+    -0x1.3101419fadcefp+1,
+    -0x1.30e92e0fb3ecdp+1,
+    -0x1.30d114abecea4p+1,
+    -0x1.30b8f57451e74p+1,
+    -0x1.30a0d068dc06bp+1,
+    -0x1.3088a589846cap+1,
+    -0x1.307074d6443dfp+1,
+    -0x1.30583e4f14a29p+1,
+    -0x1.304001f3eec07p+1,
+    -0x1.3027bfc4cbbf8p+1,
+    -0x1.300f77c1a4c5bp+1,
+    -0x1.2ff729ea72fbep+1,
+    -0x1.2fded63f2f8c1p+1,
+    -0x1.2fc67cbfd3a11p+1,
+    -0x1.2fae1d6c5868cp+1,
+    -0x1.2f95b844b70fp+1,
+    -0x1.2f7d4d48e8c2cp+1,
+    -0x1.2f64dc78e6b3cp+1,
+    -0x1.2f4c65d4aa11fp+1,
+    -0x1.2f33e95c2c0d2p+1,
+    -0x1.2f1b670f65d64p+1,
+    -0x1.2f02deee50a11p+1,
+    -0x1.2eea50f8e59f6p+1,
+    -0x1.2ed1bd2f1e062p+1,
+    -0x1.2eb92390f30bp+1,
+    -0x1.2ea0841e5de3fp+1,
+    -0x1.2e87ded757c7ap+1,
+    -0x1.2e6f33bbd9efep+1,
+    -0x1.2e5682cbdd948p+1,
+    -0x1.2e3dcc075bf05p+1,
+    -0x1.2e250f6e4e3fp+1,
+    -0x1.2e0c4d00adbc5p+1,
+    -0x1.2df384be73a41p+1,
+    -0x1.2ddab6a79933p+1,
+    -0x1.2dc1e2bc17a8ep+1,
+    -0x1.2da908fbe8437p+1,
+    -0x1.2d90296704436p+1,
+    -0x1.2d7743fd64ea6p+1,
+    -0x1.2d5e58bf037b3p+1,
+    -0x1.2d4567abd93b8p+1,
+    -0x1.2d2c70c3df6fp+1,
+    -0x1.2d1374070f5b7p+1,
+    -0x1.2cfa717562447p+1,
+    -0x1.2ce1690ed170bp+1,
+    -0x1.2cc85ad35627ep+1,
+    -0x1.2caf46c2e9b2ap+1,
+    -0x1.2c962cdd855cap+1,
+    -0x1.2c7d0d23226f8p+1,
+    -0x1.2c63e793ba37ep+1,
+    -0x1.2c4abc2f46036p+1,
+    -0x1.2c318af5bf1fap+1,
+    -0x1.2c1853e71eda4p+1,
+    -0x1.2bff17035e81ep+1,
+    -0x1.2be5d44a77681p+1,
+    -0x1.2bcc8bbc62dc7p+1,
+    -0x1.2bb33d591a319p+1,
+    -0x1.2b99e92096bb1p+1,
+    -0x1.2b808f12d1cc8p+1,
+    -0x1.2b672f2fc4ba6p+1,
+    -0x1.2b4dc97768dc4p+1,
+    -0x1.2b345de9b787cp+1,
+    -0x1.2b1aec86aa146p+1,
+    -0x1.2b01754e39d8ap+1,
+    -0x1.2ae7f84060311p+1,
+    -0x1.2ace755d16784p+1,
+    -0x1.2ab4eca45607ap+1,
+    -0x1.2a9b5e161839cp+1,
+    -0x1.2a81c9b2566d2p+1,
+    -0x1.2a682f790a013p+1,
+    -0x1.2a4e8f6a2c556p+1,
+    -0x1.2a34e985b6c94p+1,
+    -0x1.2a1b3dcba2bc5p+1,
+    -0x1.2a018c3be98fp+1,
+    -0x1.29e7d4d684a5cp+1,
+    -0x1.29ce179b6d65p+1,
+    -0x1.29b4548a9d2e4p+1,
+    -0x1.299a8ba40d65ep+1,
+    -0x1.2980bce7b7725p+1,
+    -0x1.2966e85594bdp+1,
+    -0x1.294d0ded9ead5p+1,
+    -0x1.29332dafceadbp+1,
+    -0x1.2919479c1e287p+1,
+    -0x1.28ff5bb286861p+1,
+    -0x1.28e569f30134ep+1,
+    -0x1.28cb725d87a14p+1,
+    -0x1.28b174f21337ap+1,
+    -0x1.289771b09d675p+1,
+    -0x1.287d68991f9dbp+1,
+    -0x1.286359ab934b2p+1,
+    -0x1.284944e7f1e0ep+1,
+    -0x1.282f2a4e34d05p+1,
+    -0x1.281509de558bdp+1,
+    -0x1.27fae3984d88ap+1,
+    -0x1.27e0b77c163a2p+1,
+    -0x1.27c68589a9169p+1,
+    -0x1.27ac4dc0ff954p+1,
+    -0x1.27921022132d8p+1,
+    -0x1.2777ccacdd579p+1,
+    -0x1.275d8361578ebp+1,
+    -0x1.2743343f7b4c3p+1,
+    -0x1.2728df47420c4p+1,
+    -0x1.270e8478a54c3p+1,
+    -0x1.26f423d39e894p+1,
+    -0x1.26d9bd582740ap+1,
+    -0x1.26bf510638ef9p+1,
+    -0x1.26a4deddcd145p+1,
+    -0x1.268a66dedd311p+1,
+    -0x1.266fe90962c81p+1,
+    -0x1.2655655d57598p+1,
+    -0x1.263adbdab46b9p+1,
+    -0x1.26204c8173827p+1,
+    -0x1.2605b7518e215p+1,
+    -0x1.25eb1c4afdcc6p+1,
+    -0x1.25d07b6dbc0bcp+1,
+    -0x1.25b5d4b9c268ap+1,
+    -0x1.259b282f0a6c2p+1,
+    -0x1.258075cd8d9f6p+1,
+    -0x1.2565bd95458bap+1,
+    -0x1.254aff862bbafp+1,
+    -0x1.25303ba039bb7p+1,
+    -0x1.251571e3691b3p+1,
+    -0x1.24faa24fb3656p+1,
+    -0x1.24dfcce512292p+1,
+    -0x1.24c4f1a37ef98p+1,
+    -0x1.24aa108af3668p+1,
+    -0x1.248f299b69005p+1,
+    -0x1.24743cd4d95ap+1,
+    -0x1.24594a373e04ap+1,
+    -0x1.243e51c290954p+1,
+    -0x1.24235376caa4ep+1,
+    -0x1.24084f53e5c99p+1,
+    -0x1.23ed4559db986p+1,
+    -0x1.23d23588a5a76p+1,
+    -0x1.23b71fe03d908p+1,
+    -0x1.239c04609ceedp+1,
+    -0x1.2380e309bd5d5p+1,
+    -0x1.2365bbdb9877p+1,
+    -0x1.234a8ed627d7fp+1,
+    -0x1.232f5bf9651f1p+1,
+    -0x1.2314234549e95p+1,
+    -0x1.22f8e4b9cfd6cp+1,
+    -0x1.22dda056f0883p+1,
+    -0x1.22c2561ca59ecp+1,
+    -0x1.22a7060ae8bb5p+1,
+    -0x1.228bb021b37edp+1,
+    -0x1.22705460ff8b4p+1,
+    -0x1.2254f2c8c6868p+1,
+    -0x1.22398b5902178p+1,
+    -0x1.221e1e11abe53p+1,
+    -0x1.2202aaf2bd967p+1,
+    -0x1.21e731fc30d23p+1,
+    -0x1.21cbb32dff406p+1,
+    -0x1.21b02e88228bdp+1,
+    -0x1.2194a40a945d6p+1,
+    -0x1.217913b54e61p+1,
+    -0x1.215d7d884a439p+1,
+    -0x1.2141e18381b1dp+1,
+    -0x1.21263fa6ee58bp+1,
+    -0x1.210a97f289e62p+1,
+    -0x1.20eeea664e0bep+1,
+    -0x1.20d33702347ccp+1,
+    -0x1.20b77dc636eb9p+1,
+    -0x1.209bbeb24f0b2p+1,
+    -0x1.207ff9c6768e5p+1,
+    -0x1.20642f02a727ep+1,
+    -0x1.20485e66da8bbp+1,
+    -0x1.202c87f30a718p+1,
+    -0x1.2010aba730911p+1,
+    -0x1.1ff4c983469f4p+1,
+    -0x1.1fd8e1874653cp+1,
+    -0x1.1fbcf3b329686p+1,
+    -0x1.1fa10006e999ep+1,
+    -0x1.1f85068280a2fp+1,
+    -0x1.1f690725e8416p+1,
+    -0x1.1f4d01f11a33dp+1,
+    -0x1.1f30f6e410391p+1,
+    -0x1.1f14e5fec40fdp+1,
+    -0x1.1ef8cf412f76dp+1,
+    -0x1.1edcb2ab4c2dbp+1,
+    -0x1.1ec0903d13f74p+1,
+    -0x1.1ea467f680943p+1,
+    -0x1.1e8839d78bc82p+1,
+    -0x1.1e6c05e02f57cp+1,
+    -0x1.1e4fcc106507cp+1,
+    -0x1.1e338c68269ddp+1,
+    -0x1.1e1746e76de29p+1,
+    -0x1.1dfafb8e349cbp+1,
+    -0x1.1ddeaa5c7494dp+1,
+    -0x1.1dc2535227919p+1,
+    -0x1.1da5f66f475d9p+1,
+    -0x1.1d8993b3cdc78p+1,
+    -0x1.1d6d2b1fb49afp+1,
+    -0x1.1d50bcb2f5a38p+1,
+    -0x1.1d34486d8ab0bp+1,
+    -0x1.1d17ce4f6d923p+1,
+    -0x1.1cfb4e589814ap+1,
+    -0x1.1cdec88904079p+1,
+    -0x1.1cc23ce0ab3c9p+1,
+    -0x1.1ca5ab5f87882p+1,
+    -0x1.1c89140592bcfp+1,
+    -0x1.1c6c76d2c6af7p+1,
+    -0x1.1c4fd3c71d324p+1,
+    -0x1.1c332ae2901afp+1,
+    -0x1.1c167c25193ffp+1,
+    -0x1.1bf9c78eb278fp+1,
+    -0x1.1bdd0d1f55a05p+1,
+    -0x1.1bc04cd6fc8eap+1,
+    -0x1.1ba386b5a11e6p+1,
+    -0x1.1b86babb3d28p+1,
+    -0x1.1b69e8e7ca872p+1,
+    -0x1.1b4d113b43192p+1,
+    -0x1.1b3033b5a0be8p+1,
+    -0x1.1b135056dd54bp+1,
+    -0x1.1af6671ef2b94p+1,
+    -0x1.1ad9780ddacd9p+1,
+    -0x1.1abc83238f742p+1,
+    -0x1.1a9f88600a8f5p+1,
+    -0x1.1a8287c346019p+1,
+    -0x1.1a65814d3bad5p+1,
+    -0x1.1a4874fde5761p+1,
+    -0x1.1a2b62d53d423p+1,
+    -0x1.1a0e4ad33cf61p+1,
+    -0x1.19f12cf7de793p+1,
+    -0x1.19d409431bb3ep+1,
+    -0x1.19b6dfb4ee8e9p+1,
+    -0x1.1999b04d50f2ap+1,
+    -0x1.197c7b0c3ccc6p+1,
+    -0x1.195f3ff1ac064p+1,
+    -0x1.1941fefd988d9p+1,
+    -0x1.1924b82ffc4fap+1,
+    -0x1.19076b88d137ep+1,
+    -0x1.18ea19081137ap+1,
+    -0x1.18ccc0adb63e4p+1,
+    -0x1.18af6279ba3bp+1,
+    -0x1.1891fe6c17204p+1,
+    -0x1.18749484c6de4p+1,
+    -0x1.185724c3c3687p+1,
+    -0x1.1839af2906b3p+1,
+    -0x1.181c33b48ab24p+1,
+    -0x1.17feb266495b8p+1,
+    -0x1.17e12b3e3ca7p+1,
+    -0x1.17c39e3c5e8b1p+1,
+    -0x1.17a60b60a900ep+1,
+    -0x1.178872ab1602cp+1,
+    -0x1.176ad41b9f8afp+1,
+    -0x1.174d2fb23f93bp+1,
+    -0x1.172f856ef0174p+1,
+    -0x1.1711d551ab10dp+1,
+    -0x1.16f41f5a6a7fbp+1,
+    -0x1.16d663892863fp+1,
+    -0x1.16b8a1dddebcep+1,
+    -0x1.169ada588787cp+1,
+    -0x1.167d0cf91cc7bp+1,
+    -0x1.165f39bf987dep+1,
+    -0x1.164160abf4ab8p+1,
+    -0x1.162381be2b55cp+1,
+    -0x1.16059cf63681dp+1,
+    -0x1.15e7b2541031dp+1,
+    -0x1.15c9c1d7b26bfp+1,
+    -0x1.15abcb81173a5p+1,
+    -0x1.158dcf5038a42p+1,
+    -0x1.156fcd4510b08p+1,
+    -0x1.1551c55f99698p+1,
+    -0x1.1533b79fccd75p+1,
+    -0x1.1515a405a5051p+1,
+    -0x1.14f78a911bfeep+1,
+    -0x1.14d96b422bd1cp+1,
+    -0x1.14bb4618ce8dep+1,
+    -0x1.149d1b14fe415p+1,
+    -0x1.147eea36b4fc2p+1,
+    -0x1.1460b37deccc6p+1,
+    -0x1.144276ea9fc33p+1,
+    -0x1.1424347cc7f2ap+1,
+    -0x1.1405ec345f6cbp+1,
+    -0x1.13e79e1160448p+1,
+    -0x1.13c94a13c4901p+1,
+    -0x1.13aaf03b86636p+1,
+    -0x1.138c90889fd59p+1,
+    -0x1.136e2afb0afe9p+1,
+    -0x1.134fbf92c1f66p+1,
+    -0x1.13314e4fbed5p+1,
+    -0x1.1312d731fbb38p+1,
+    -0x1.12f45a3972adep+1,
+    -0x1.12d5d7661dde1p+1,
+    -0x1.12b74eb7f761p+1,
+    -0x1.1298c02ef954cp+1,
+    -0x1.127a2bcb1dd74p+1,
+    -0x1.125b918c5f068p+1,
+    -0x1.123cf172b7016p+1,
+    -0x1.121e4b7e1fe9ep+1,
+    -0x1.11ff9fae93dfep+1,
+    -0x1.11e0ee040d066p+1,
+    -0x1.11c2367e85814p+1,
+    -0x1.11a3791df7747p+1,
+    -0x1.1184b5e25d03fp+1,
+    -0x1.1165eccbb0539p+1,
+    -0x1.11471dd9eb883p+1,
+    -0x1.1128490d08cadp+1,
+    -0x1.11096e6502444p+1,
+    -0x1.10ea8de1d21a7p+1,
+    -0x1.10cba78372773p+1,
+    -0x1.10acbb49dd886p+1,
+    -0x1.108dc9350d78ep+1,
+    -0x1.106ed144fc739p+1,
+    -0x1.104fd379a4a64p+1,
+    -0x1.1030cfd3003ccp+1,
+    -0x1.1011c6510966p+1,
+    -0x1.0ff2b6f3ba51cp+1,
+    -0x1.0fd3a1bb0d2fdp+1,
+    -0x1.0fb486a6fc311p+1,
+    -0x1.0f9565b781894p+1,
+    -0x1.0f763eec976a4p+1,
+    -0x1.0f5712463808cp+1,
+    -0x1.0f37dfc45d9a9p+1,
+    -0x1.0f18a76702557p+1,
+    -0x1.0ef9692e206f3p+1,
+    -0x1.0eda2519b21dap+1,
+    -0x1.0ebadb29b1978p+1,
+    -0x1.0e9b8b5e19179p+1,
+    -0x1.0e7c35b6e2d88p+1,
+    -0x1.0e5cda3409122p+1,
+    -0x1.0e3d78d585ff1p+1,
+    -0x1.0e1e119b53dc2p+1,
+    -0x1.0dfea4856ce91p+1,
+    -0x1.0ddf3193cb628p+1,
+    -0x1.0dbfb8c669853p+1,
+    -0x1.0da03a1d4191ep+1,
+    -0x1.0d80b5984dca2p+1,
+    -0x1.0d612b37886fcp+1,
+    -0x1.0d419afaebc45p+1,
+    -0x1.0d2204e27209ap+1,
+    -0x1.0d0268ee15824p+1,
+    -0x1.0ce2c71dd073ep+1,
+    -0x1.0cc31f719d222p+1,
+    -0x1.0ca371e975d3cp+1,
+    -0x1.0c83be8554d05p+1,
+    -0x1.0c640545345f8p+1,
+    -0x1.0c4446290ec9ep+1,
+    -0x1.0c248130de5bp+1,
+    -0x1.0c04b65c9d5bap+1,
+    -0x1.0be4e5ac46145p+1,
+    -0x1.0bc50f1fd2d1ap+1,
+    -0x1.0ba532b73de13p+1,
+    -0x1.0b8550728190ap+1,
+    -0x1.0b656851982d7p+1,
+    -0x1.0b457a547c065p+1,
+    -0x1.0b25867b276dbp+1,
+    -0x1.0b058cc594b64p+1,
+    -0x1.0ae58d33be2f7p+1,
+    -0x1.0ac587c59e2bep+1,
+    -0x1.0aa57c7b2eff1p+1,
+    -0x1.0a856b546afc9p+1,
+    -0x1.0a6554514c78ep+1,
+    -0x1.0a453771cdcb8p+1,
+    -0x1.0a2514b5e94a1p+1,
+    -0x1.0a04ec1d994dp+1,
+    -0x1.09e4bda8d82ddp+1,
+    -0x1.09c48957a046p+1,
+    -0x1.09a44f29ebeefp+1,
+    -0x1.09840f1fb5834p+1,
+    -0x1.0963c938f7606p+1,
+    -0x1.09437d75abe1dp+1,
+    -0x1.09232bd5cd65fp+1,
+    -0x1.0902d459564c4p+1,
+    -0x1.08e2770040f43p+1,
+    -0x1.08c213ca87bd3p+1,
+    -0x1.08a1aab82506cp+1,
+    -0x1.08813bc913313p+1,
+    -0x1.0860c6fd4cap+1,
+    -0x1.08404c54cbb4ap+1,
+    -0x1.081fcbcf8ad37p+1,
+    -0x1.07ff456d8461ep+1,
+    -0x1.07deb92eb2c55p+1,
+    -0x1.07be271310642p+1,
+    -0x1.079d8f1a97a7bp+1,
+    -0x1.077cf14542f67p+1,
+    -0x1.075c4d930cb6cp+1,
+    -0x1.073ba403ef52ep+1,
+    -0x1.071af497e5364p+1,
+    -0x1.06fa3f4ee8cc4p+1,
+    -0x1.06d98428f4804p+1,
+    -0x1.06b8c32602be9p+1,
+    -0x1.0697fc460df67p+1,
+    -0x1.06772f8910955p+1,
+    -0x1.06565cef050b6p+1,
+    -0x1.06358477e5ca1p+1,
+    -0x1.0614a623ad429p+1,
+    -0x1.05f3c1f255e65p+1,
+    -0x1.05d2d7e3da278p+1,
+    -0x1.05b1e7f8347b7p+1,
+    -0x1.0590f22f5f556p+1,
+    -0x1.056ff689552bap+1,
+    -0x1.054ef50610756p+1,
+    -0x1.052deda58ba9fp+1,
+    -0x1.050ce067c140ap+1,
+    -0x1.04ebcd4cabb0ap+1,
+    -0x1.04cab45445724p+1,
+    -0x1.04a9957e8901ap+1,
+    -0x1.048870cb70dbp+1,
+    -0x1.0467463af777ap+1,
+    -0x1.044615cd1753cp+1,
+    -0x1.0424df81caec8p+1,
+    -0x1.0403a3590cc02p+1,
+    -0x1.03e26152d74fdp+1,
+    -0x1.03c1196f251acp+1,
+    -0x1.039fcbadf0a21p+1,
+    -0x1.037e780f34651p+1,
+    -0x1.035d1e92eae5dp+1,
+    -0x1.033bbf390ea78p+1,
+    -0x1.031a5a019a2e5p+1,
+    -0x1.02f8eeec88016p+1,
+    -0x1.02d77df9d2a5dp+1,
+    -0x1.02b6072974a2cp+1,
+    -0x1.02948a7b687d6p+1,
+    -0x1.027307efa8bdcp+1,
+    -0x1.02517f862fed1p+1,
+    -0x1.022ff13ef8946p+1,
+    -0x1.020e5d19fd3ddp+1,
+    -0x1.01ecc31738767p+1,
+    -0x1.01cb2336a4c96p+1,
+    -0x1.01a97d783cc4bp+1,
+    -0x1.0187d1dbfaf67p+1,
+    -0x1.01662061d9e9cp+1,
+    -0x1.01446909d42dap+1,
+    -0x1.0122abd3e4553p+1,
+    -0x1.0100e8c004f17p+1,
+    -0x1.00df1fce30957p+1,
+    -0x1.00bd50fe61d24p+1,
+    -0x1.009b7c50933bep+1,
+    -0x1.0079a1c4bf675p+1,
+    -0x1.0057c15ae0e9ap+1,
+    -0x1.0035db12f257dp+1,
+    -0x1.0013eeecee46fp+1,
+    -0x1.ffe3f9d19e99ep+0,
+    -0x1.ffa00a0d2007bp+0,
+    -0x1.ff5c0e8c560d3p+0,
+    -0x1.ff18074f35de7p+0,
+    -0x1.fed3f455b4a96p+0,
+    -0x1.fe8fd59fc7a4p+0,
+    -0x1.fe4bab2d640c3p+0,
+    -0x1.fe0774fe7f1bcp+0,
+    -0x1.fdc333130e10bp+0,
+    -0x1.fd7ee56b0624dp+0,
+    -0x1.fd3a8c065c981p+0,
+    -0x1.fcf626e506ac5p+0,
+    -0x1.fcb1b606f9a36p+0,
+    -0x1.fc6d396c2abf2p+0,
+    -0x1.fc28b1148f435p+0,
+    -0x1.fbe41d001c79dp+0,
+    -0x1.fb9f7d2ec7a87p+0,
+    -0x1.fb5ad1a0861afp+0,
+    -0x1.fb161a554d1f1p+0,
+    -0x1.fad1574d12029p+0,
+    -0x1.fa8c8887ca134p+0,
+    -0x1.fa47ae056aa0dp+0,
+    -0x1.fa02c7c5e901p+0,
+    -0x1.f9bdd5c93a857p+0,
+    -0x1.f978d80f5485fp+0,
+    -0x1.f933ce982c5c1p+0,
+    -0x1.f8eeb963b75f9p+0,
+    -0x1.f8a99871eae41p+0,
+    -0x1.f8646bc2bc493p+0,
+    -0x1.f81f335620ecap+0,
+    -0x1.f7d9ef2c0e2ffp+0,
+    -0x1.f7949f447970cp+0,
+    -0x1.f74f439f5812ap+0,
+    -0x1.f709dc3c9f7b4p+0,
+    -0x1.f6c4691c45101p+0,
+    -0x1.f67eea3e3e36bp+0,
+    -0x1.f6395fa28056ap+0,
+    -0x1.f5f3c94900dd7p+0,
+    -0x1.f5ae2731b534bp+0,
+    -0x1.f568795c92cbcp+0,
+    -0x1.f522bfc98f123p+0,
+    -0x1.f4dcfa789f719p+0,
+    -0x1.f4972969b95b5p+0,
+    -0x1.f4514c9cd248dp+0,
+    -0x1.f40b6411dfad9p+0,
+    -0x1.f3c56fc8d6fd1p+0,
+    -0x1.f37f6fc1adb2ap+0,
+    -0x1.f33963fc594bbp+0,
+    -0x1.f2f34c78cf459p+0,
+    -0x1.f2ad2937051dbp+0,
+    -0x1.f266fa36f0517p+0,
+    -0x1.f220bf7886603p+0,
+    -0x1.f1da78fbbccf3p+0,
+    -0x1.f19426c0891fdp+0,
+    -0x1.f14dc8c6e0d96p+0,
+    -0x1.f1075f0eb9852p+0,
+    -0x1.f0c0e99808ac6p+0,
+    -0x1.f07a6862c3d87p+0,
+    -0x1.f033db6ee0929p+0,
+    -0x1.efed42bc5466p+0,
+    -0x1.efa69e4b14e4p+0,
+    -0x1.ef5fee1b1799dp+0,
+    -0x1.ef19322c521abp+0,
+    -0x1.eed26a7eb9fbbp+0,
+    -0x1.ee8b971244d22p+0,
+    -0x1.ee44b7e6e8352p+0,
+    -0x1.edfdccfc99c1dp+0,
+    -0x1.edb6d6534f115p+0,
+    -0x1.ed6fd3eafdc0dp+0,
+    -0x1.ed28c5c39b696p+0,
+    -0x1.ece1abdd1daa4p+0,
+    -0x1.ec9a86377a247p+0,
+    -0x1.ec5354d2a6791p+0,
+    -0x1.ec0c17ae98493p+0,
+    -0x1.ebc4cecb4537fp+0,
+    -0x1.eb7d7a28a2f05p+0,
+    -0x1.eb3619c6a71d5p+0,
+    -0x1.eaeeada547641p+0,
+    -0x1.eaa735c4796f8p+0,
+    -0x1.ea5fb22432ecap+0,
+    -0x1.ea1822c4698a7p+0,
+    -0x1.e9d087a512fdep+0,
+    -0x1.e988e0c624f7fp+0,
+    -0x1.e9412e27952d8p+0,
+    -0x1.e8f96fc9594fap+0,
+    -0x1.e8b1a5ab67152p+0,
+    -0x1.e869cfcdb436fp+0,
+    -0x1.e821ee30366e1p+0,
+    -0x1.e7da00d2e3755p+0,
+    -0x1.e79207b5b10d8p+0,
+    -0x1.e74a02d894f38p+0,
+    -0x1.e701f23b84e84p+0,
+    -0x1.e6b9d5de76a89p+0,
+    -0x1.e671adc15ff74p+0,
+    -0x1.e62979e4369b2p+0,
+    -0x1.e5e13a46f060fp+0,
+    -0x1.e598eee9830f7p+0,
+    -0x1.e55097cbe46d8p+0,
+    -0x1.e50834ee0a47dp+0,
+    -0x1.e4bfc64fea673p+0,
+    -0x1.e4774bf17a9a5p+0,
+    -0x1.e42ec5d2b0b1fp+0,
+    -0x1.e3e633f3827ecp+0,
+    -0x1.e39d9653e5d37p+0,
+    -0x1.e354ecf3d088cp+0,
+    -0x1.e30c37d338735p+0,
+    -0x1.e2c376f2136bcp+0,
+    -0x1.e27aaa505746dp+0,
+    -0x1.e231d1edf9df1p+0,
+    -0x1.e1e8edcaf1113p+0,
+    -0x1.e19ffde732bbbp+0,
+    -0x1.e1570242b4c34p+0,
+    -0x1.e10dfadd6d087p+0,
+    -0x1.e0c4e7b7516fcp+0,
+    -0x1.e07bc8d057d9dp+0,
+    -0x1.e0329e28762d3p+0,
+    -0x1.dfe967bfa2526p+0,
+    -0x1.dfa02595d231ep+0,
+    -0x1.df56d7aafbb45p+0,
+    -0x1.df0d7dff14c42p+0,
+    -0x1.dec418921351cp+0,
+    -0x1.de7aa763ed49bp+0,
+    -0x1.de312a74989e7p+0,
+    -0x1.dde7a1c40b446p+0,
+    -0x1.dd9e0d523b3p+0,
+    -0x1.dd546d1f1e55bp+0,
+    -0x1.dd0ac12aaaa9fp+0,
+    -0x1.dcc10974d6232p+0,
+    -0x1.dc7745fd96bdap+0,
+    -0x1.dc2d76c4e271dp+0,
+    -0x1.dbe39bcaaf3e1p+0,
+    -0x1.db99b50ef322bp+0,
+    -0x1.db4fc291a4201p+0,
+    -0x1.db05c452b8368p+0,
+    -0x1.dabbba5225685p+0,
+    -0x1.da71a48fe1bdcp+0,
+    -0x1.da27830be33b4p+0,
+    -0x1.d9dd55c61feafp+0,
+    -0x1.d9931cbe8dd92p+0,
+    -0x1.d948d7f523121p+0,
+    -0x1.d8fe8769d5a1fp+0,
+    -0x1.d8b42b1c9b95p+0,
+    -0x1.d869c30d6af98p+0,
+    -0x1.d81f4f3c39e3ap+0,
+    -0x1.d7d4cfa8fe638p+0,
+    -0x1.d78a4453ae8f7p+0,
+    -0x1.d73fad3c407f8p+0,
+    -0x1.d6f50a62aa4bep+0,
+    -0x1.d6aa5bc6e20cap+0,
+    -0x1.d65fa168ddd9fp+0,
+    -0x1.d614db4893cep+0,
+    -0x1.d5ca0965fa08ep+0,
+    -0x1.d57f2bc106a6bp+0,
+    -0x1.d5344259afc97p+0,
+    -0x1.d4e94d2feb954p+0,
+    -0x1.d49e4c43b02e3p+0,
+    -0x1.d4533f94f3ba4p+0,
+    -0x1.d4082723ac657p+0,
+    -0x1.d3bd02efd055dp+0,
+    -0x1.d371d2f955b16p+0,
+    -0x1.d326974032a62p+0,
+    -0x1.d2db4fc45d64p+0,
+    -0x1.d28ffc85cc1afp+0,
+    -0x1.d2449d8474fbp+0,
+    -0x1.d1f932c04e34p+0,
+    -0x1.d1adbc394df8p+0,
+    -0x1.d16239ef6a7eep+0,
+    -0x1.d116abe299fc8p+0,
+    -0x1.d0cb1212d2aacp+0,
+    -0x1.d07f6c800ac59p+0,
+    -0x1.d033bb2a3888cp+0,
+    -0x1.cfe7fe1152303p+0,
+    -0x1.cf9c35354df7cp+0,
+    -0x1.cf506096221d5p+0,
+    -0x1.cf048033c4e4ap+0,
+    -0x1.ceb8940e2c8d9p+0,
+    -0x1.ce6c9c254f5dep+0,
+    -0x1.ce209879239d6p+0,
+    -0x1.cdd489099f93cp+0,
+    -0x1.cd886dd6b988dp+0,
+    -0x1.cd3c46e067c66p+0,
+    -0x1.ccf01426a09c2p+0,
+    -0x1.cca3d5a95a55cp+0,
+    -0x1.cc578b688b44fp+0,
+    -0x1.cc0b356429bb7p+0,
+    -0x1.cbbed39c2c07p+0,
+    -0x1.cb72661088812p+0,
+    -0x1.cb25ecc1357f9p+0,
+    -0x1.cad967ae2955fp+0,
+    -0x1.ca8cd6d75a59fp+0,
+    -0x1.ca403a3cbee93p+0,
+    -0x1.c9f391de4d615p+0,
+    -0x1.c9a6ddbbfc19ep+0,
+    -0x1.c95a1dd5c1708p+0,
+    -0x1.c90d522b93c4cp+0,
+    -0x1.c8c07abd69784p+0,
+    -0x1.c873978b38f28p+0,
+    -0x1.c826a894f897p+0,
+    -0x1.c7d9adda9ecd4p+0,
+    -0x1.c78ca75c21f8ep+0,
+    -0x1.c73f951978836p+0,
+    -0x1.c6f2771298d84p+0,
+    -0x1.c6a54d477962fp+0,
+    -0x1.c65817b81090ep+0,
+    -0x1.c60ad66454d59p+0,
+    -0x1.c5bd894c3ca06p+0,
+    -0x1.c570306fbe66cp+0,
+    -0x1.c522cbced0a01p+0,
+    -0x1.c4d55b6969c1dp+0,
+    -0x1.c487df3f803d6p+0,
+    -0x1.c43a57510a902p+0,
+    -0x1.c3ecc39dff336p+0,
+    -0x1.c39f242654a09p+0,
+    -0x1.c35178ea0157p+0,
+    -0x1.c303c1e8fbd2p+0,
+    -0x1.c2b5ff233a92fp+0,
+    -0x1.c2683098b41d1p+0,
+    -0x1.c21a56495ef3cp+0,
+    -0x1.c1cc7035319a3p+0,
+    -0x1.c17e7e5c2295cp+0,
+    -0x1.c13080be2871ap+0,
+    -0x1.c0e2775b39b51p+0,
+    -0x1.c09462334ced5p+0,
+    -0x1.c046414658a7ap+0,
+    -0x1.bff81494536d2p+0,
+    -0x1.bfa9dc1d33d32p+0,
+    -0x1.bf5b97e0f06abp+0,
+    -0x1.bf0d47df7fc32p+0,
+    -0x1.bebeec18d86d8p+0,
+    -0x1.be70848cf1031p+0,
+    -0x1.be22113bc01cep+0,
+    -0x1.bdd392253c4e1p+0,
+    -0x1.bd8507495c2fdp+0,
+    -0x1.bd3670a8165f4p+0,
+    -0x1.bce7ce41617f5p+0,
+    -0x1.bc992015342d3p+0,
+    -0x1.bc4a66238505fp+0,
+    -0x1.bbfba06c4aae9p+0,
+    -0x1.bbacceef7bcc2p+0,
+    -0x1.bb5df1ad0efdbp+0,
+    -0x1.bb0f08a4fae85p+0,
+    -0x1.bac013d73634fp+0,
+    -0x1.ba711343b7928p+0,
+    -0x1.ba2206ea75aa2p+0,
+    -0x1.b9d2eecb6724bp+0,
+    -0x1.b983cae682b33p+0,
+    -0x1.b9349b3bbf068p+0,
+    -0x1.b8e55fcb12c9ap+0,
+    -0x1.b896189474ad9p+0,
+    -0x1.b846c597db673p+0,
+    -0x1.b7f766d53db14p+0,
+    -0x1.b7a7fc4c9240cp+0,
+    -0x1.b75885fdcfcaap+0,
+    -0x1.b70903e8ed0bbp+0,
+    -0x1.b6b9760de0c2bp+0,
+    -0x1.b669dc6ca1ae8p+0,
+    -0x1.b61a3705268dfp+0,
+    -0x1.b5ca85d7661fep+0,
+    -0x1.b57ac8e357232p+0,
+    -0x1.b52b0028f0587p+0,
+    -0x1.b4db2ba82886ap+0,
+    -0x1.b48b4b60f6707p+0,
+    -0x1.b43b5f5350deap+0,
+    -0x1.b3eb677f2e9bfp+0,
+    -0x1.b39b63e486732p+0,
+    -0x1.b34b54834f2efp+0,
+    -0x1.b2fb395b7f9cp+0,
+    -0x1.b2ab126d0e8d1p+0,
+    -0x1.b25adfb7f2d0cp+0,
+    -0x1.b20aa13c2339cp+0,
+    -0x1.b1ba56f99696dp+0,
+    -0x1.b16a00f043bc9p+0,
+    -0x1.b1199f202181ap+0,
+    -0x1.b0c9318926beap+0,
+    -0x1.b078b82b4a522p+0,
+    -0x1.b02833068316bp+0,
+    -0x1.afd7a21ac7eafp+0,
+    -0x1.af8705680fa98p+0,
+    -0x1.af365cee5132ep+0,
+    -0x1.aee5a8ad8369ap+0,
+    -0x1.ae94e8a59d305p+0,
+    -0x1.ae441cd695697p+0,
+    -0x1.adf3454062f99p+0,
+    -0x1.ada261e2fccb3p+0,
+    -0x1.ad5172be59c4cp+0,
+    -0x1.ad0077d270d2dp+0,
+    -0x1.acaf711f38e1bp+0,
+    -0x1.ac5e5ea4a8d8p+0,
+    -0x1.ac0d4062b7a23p+0,
+    -0x1.abbc16595c30ap+0,
+    -0x1.ab6ae0888d79cp+0,
+    -0x1.ab199ef0427p+0,
+    -0x1.aac851907209cp+0,
+    -0x1.aa76f86913396p+0,
+    -0x1.aa25937a1cf74p+0,
+    -0x1.a9d422c3863dcp+0,
+    -0x1.a982a64546073p+0,
+    -0x1.a9311dff534dfp+0,
+    -0x1.a8df89f1a50e5p+0,
+    -0x1.a88dea1c324aap+0,
+    -0x1.a83c3e7ef2014p+0,
+    -0x1.a7ea8719db366p+0,
+    -0x1.a798c3ece4f04p+0,
+    -0x1.a746f4f806353p+0,
+    -0x1.a6f51a3b360b7p+0,
+    -0x1.a6a333b66b793p+0,
+    -0x1.a65141699d84cp+0,
+    -0x1.a5ff4354c3366p+0,
+    -0x1.a5ad3977d39e4p+0,
+    -0x1.a55b23d2c5cc9p+0,
+    -0x1.a509026590cb8p+0,
+    -0x1.a4b6d5302bab4p+0,
+    -0x1.a4649c328d7dfp+0,
+    -0x1.a412576cad57cp+0,
+    -0x1.a3c006de8252cp+0,
+    -0x1.a36daa8803852p+0,
+    -0x1.a31b42692808fp+0,
+    -0x1.a2c8ce81e6f45p+0,
+    -0x1.a2764ed237636p+0,
+    -0x1.a223c35a10743p+0,
+    -0x1.a1d12c196944dp+0,
+    -0x1.a17e891038f34p+0,
+    -0x1.a12bda3e769f9p+0,
+    -0x1.a0d91fa4196fdp+0,
+    -0x1.a086594118861p+0,
+    -0x1.a03387156b0a3p+0,
+    -0x1.9fe0a92108264p+0,
+    -0x1.9f8dbf63e7024p+0,
+    -0x1.9f3ac9ddfec22p+0,
+    -0x1.9ee7c88f4695fp+0,
+    -0x1.9e94bb77b5a98p+0,
+    -0x1.9e41a2974328ep+0,
+    -0x1.9dee7dede645ep+0,
+    -0x1.9d9b4d7b962e8p+0,
+    -0x1.9d4811404a16bp+0,
+    -0x1.9cf4c93bf9344p+0,
+    -0x1.9ca1756e9abd1p+0,
+    -0x1.9c4e15d825e9p+0,
+    -0x1.9bfaaa7891f5ep+0,
+    -0x1.9ba7334fd61b9p+0,
+    -0x1.9b53b05de991fp+0,
+    -0x1.9b0021a2c398cp+0,
+    -0x1.9aac871e5b71dp+0,
+    -0x1.9a58e0d0a85efp+0,
+    -0x1.9a052eb9a1a1ep+0,
+    -0x1.99b170d93e7c6p+0,
+    -0x1.995da72f76305p+0,
+    -0x1.9909d1bc40017p+0,
+    -0x1.98b5f07f933b6p+0,
+    -0x1.986203796729ep+0,
+    -0x1.980e0aa9b312bp+0,
+    -0x1.97ba06106e418p+0,
+    -0x1.9765f5ad90041p+0,
+    -0x1.9711d9810fa8p+0,
+    -0x1.96bdb18ae47d1p+0,
+    -0x1.96697dcb05d8dp+0,
+    -0x1.96153e416b0cep+0,
+    -0x1.95c0f2ee0b70fp+0,
+    -0x1.956c9bd0de5e8p+0,
+    -0x1.951838e9db2f4p+0,
+    -0x1.94c3ca38f93ccp+0,
+    -0x1.946f4fbe2fe0ap+0,
+    -0x1.941ac97976746p+0,
+    -0x1.93c6376ac453bp+0,
+    -0x1.9371999210e01p+0,
+    -0x1.931cefef53771p+0,
+    -0x1.92c83a82837c3p+0,
+    -0x1.9273794b9854fp+0,
+    -0x1.921eac4a8966dp+0,
+    -0x1.91c9d37f4e175p+0,
+    -0x1.9174eee9ddcdep+0,
+    -0x1.911ffe8a2ff81p+0,
+    -0x1.90cb02603bff4p+0,
+    -0x1.9075fa6bf950ep+0,
+    -0x1.9020e6ad5f567p+0,
+    -0x1.8fcbc724657f5p+0,
+    -0x1.8f769bd1033cfp+0,
+    -0x1.8f2164b33000cp+0,
+    -0x1.8ecc21cae33e2p+0,
+    -0x1.8e76d318146e5p+0,
+    -0x1.8e21789abb06cp+0,
+    -0x1.8dcc1252ce80dp+0,
+    -0x1.8d76a0404651ep+0,
+    -0x1.8d21226319f54p+0,
+    -0x1.8ccb98bb40e84p+0,
+    -0x1.8c760348b2aa2p+0,
+    -0x1.8c20620b66c02p+0,
+    -0x1.8bcab50354a9ap+0,
+    -0x1.8b74fc3073e5ep+0,
+    -0x1.8b1f3792bbfa2p+0,
+    -0x1.8ac9672a2467ap+0,
+    -0x1.8a738af6a4b5ap+0,
+    -0x1.8a1da2f8346d6p+0,
+    -0x1.89c7af2ecb18p+0,
+    -0x1.8971af9a6040dp+0,
+    -0x1.891ba43aeb78ep+0,
+    -0x1.88c58d10644d8p+0,
+    -0x1.886f6a1ac24fbp+0,
+    -0x1.88193b59fd0cbp+0,
+    -0x1.87c300ce0c17ap+0,
+    -0x1.876cba76e705ap+0,
+    -0x1.87166854856bdp+0,
+    -0x1.86c00a66dedf5p+0,
+    -0x1.8669a0adeaf74p+0,
+    -0x1.86132b29a150bp+0,
+    -0x1.85bca9d9f984bp+0,
+    -0x1.85661cbeeb325p+0,
+    -0x1.850f83d86dfaap+0,
+    -0x1.84b8df26797e9p+0,
+    -0x1.84622ea9055f3p+0,
+    -0x1.840b7260093d8p+0,
+    -0x1.83b4aa4b7cba9p+0,
+    -0x1.835dd66b57796p+0,
+    -0x1.8306f6bf9124fp+0,
+    -0x1.82b00b4821683p+0,
+    -0x1.82591404ffe8p+0,
+    -0x1.820210f6244f7p+0,
+    -0x1.81ab021b864b6p+0,
+    -0x1.8153e7751d88dp+0,
+    -0x1.80fcc102e1b6ap+0,
+    -0x1.80a58ec4ca89bp+0,
+    -0x1.804e50bacfb2ep+0,
+    -0x1.7ff706e4e8e91p+0,
+    -0x1.7f9fb1430de32p+0,
+    -0x1.7f484fd53651fp+0,
+    -0x1.7ef0e29b59ec6p+0,
+    -0x1.7e996995706d3p+0,
+    -0x1.7e41e4c371954p+0,
+    -0x1.7dea5425551f5p+0,
+    -0x1.7d92b7bb12c64p+0,
+    -0x1.7d3b0f84a24cdp+0,
+    -0x1.7ce35b81fb75cp+0,
+    -0x1.7c8b9bb315fddp+0,
+    -0x1.7c33d017e9a7dp+0,
+    -0x1.7bdbf8b06e3a8p+0,
+    -0x1.7b84157c9b828p+0,
+    -0x1.7b2c267c69469p+0,
+    -0x1.7ad42bafcf4d7p+0,
+    -0x1.7a7c2516c565dp+0,
+    -0x1.7a2412b1435e5p+0,
+    -0x1.79cbf47f40ffap+0,
+    -0x1.7973ca80b6187p+0,
+    -0x1.791b94b59a797p+0,
+    -0x1.78c3531de5f53p+0,
+    -0x1.786b05b990644p+0,
+    -0x1.7812ac88919b5p+0,
+    -0x1.77ba478ae173p+0,
+    -0x1.7761d6c077bfep+0,
+    -0x1.77095a294c5c7p+0,
+    -0x1.76b0d1c557256p+0,
+    -0x1.76583d948ff72p+0,
+    -0x1.75ff9d96eeae5p+0,
+    -0x1.75a6f1cc6b278p+0,
+    -0x1.754e3a34fd413p+0,
+    -0x1.74f576d09ce1ep+0,
+    -0x1.749ca79f41fp+0,
+    -0x1.7443cca0e44c2p+0,
+    -0x1.73eae5d57bdcbp+0,
+    -0x1.7391f33d008a2p+0,
+    -0x1.7338f4d76a3dp+0,
+    -0x1.72dfeaa4b0dfap+0,
+    -0x1.7286d4a4cc628p+0,
+    -0x1.722db2d7b4b21p+0,
+    -0x1.71d4853d61beap+0,
+    -0x1.717b4bd5cb74bp+0,
+    -0x1.712206a0e9c69p+0,
+    -0x1.70c8b59eb4a8ap+0,
+    -0x1.706f58cf240f5p+0,
+    -0x1.7015f0322ff0fp+0,
+    -0x1.6fbc7bc7d049cp+0,
+    -0x1.6f62fb8ffd122p+0,
+    -0x1.6f096f8aae466p+0,
+    -0x1.6eafd7b7dbdedp+0,
+    -0x1.6e5634177dd9cp+0,
+    -0x1.6dfc84a98c377p+0,
+    -0x1.6da2c96dfef83p+0,
+    -0x1.6d490264ce1c4p+0,
+    -0x1.6cef2f8df1a5dp+0,
+    -0x1.6c9550e9619d2p+0,
+    -0x1.6c3b667716067p+0,
+    -0x1.6be1703706e9fp+0,
+    -0x1.6b876e292c4bfp+0,
+    -0x1.6b2d604d7e368p+0,
+    -0x1.6ad346a3f4b5fp+0,
+    -0x1.6a79212c87d85p+0,
+    -0x1.6a1eefe72fb1cp+0,
+    -0x1.69c4b2d3e4507p+0,
+    -0x1.696a69f29dc28p+0,
+    -0x1.69101543541e1p+0,
+    -0x1.68b5b4c5ff794p+0,
+    -0x1.685b487a97e43p+0,
+    -0x1.6800d0611574fp+0,
+    -0x1.67a64c7970459p+0,
+    -0x1.674bbcc3a0762p+0,
+    -0x1.66f1213f9e20bp+0,
+    -0x1.669679ed615f4p+0,
+    -0x1.663bc6cce251ep+0,
+    -0x1.65e107de1914bp+0,
+    -0x1.65863d20fdc9ap+0,
+    -0x1.652b669588949p+0,
+    -0x1.64d0843bb199ap+0,
+    -0x1.6475961370fccp+0,
+    -0x1.641a9c1cbee3fp+0,
+    -0x1.63bf9657937b1p+0,
+    -0x1.636484c3e6ea3p+0,
+    -0x1.63096761b15f2p+0,
+    -0x1.62ae3e30eb07cp+0,
+    -0x1.625309318c0e2p+0,
+    -0x1.61f7c8638ca6p+0,
+    -0x1.619c7bc6e4fb5p+0,
+    -0x1.6141235b8d44p+0,
+    -0x1.60e5bf217db3dp+0,
+    -0x1.608a4f18ae82ap+0,
+    -0x1.602ed34117e45p+0,
+    -0x1.5fd34b9ab212ap+0,
+    -0x1.5f77b82575497p+0,
+    -0x1.5f1c18e159c48p+0,
+    -0x1.5ec06dce57bfap+0,
+    -0x1.5e64b6ec6776ap+0,
+    -0x1.5e08f43b81254p+0,
+    -0x1.5dad25bb9d095p+0,
+    -0x1.5d514b6cb3689p+0,
+    -0x1.5cf5654ebc88bp+0,
+    -0x1.5c997361b0a97p+0,
+    -0x1.5c3d75a588109p+0,
+    -0x1.5be16c1a3b05bp+0,
+    -0x1.5b8556bfc1d0ap+0,
+    -0x1.5b29359614bbp+0,
+    -0x1.5acd089d2c147p+0,
+    -0x1.5a70cfd50028bp+0,
+    -0x1.5a148b3d89495p+0,
+    -0x1.59b83ad6bfc7fp+0,
+    -0x1.595bdea09bf03p+0,
+    -0x1.58ff769b1613cp+0,
+    -0x1.58a302c626884p+0,
+    -0x1.58468321c5a93p+0,
+    -0x1.57e9f7adebcc3p+0,
+    -0x1.578d606a9146cp+0,
+    -0x1.5730bd57ae748p+0,
+    -0x1.56d40e753badp+0,
+    -0x1.567753c3314ddp+0,
+    -0x1.561a8d4187b66p+0,
+    -0x1.55bdbaf037464p+0,
+    -0x1.5560dccf385efp+0,
+    -0x1.5503f2de8367dp+0,
+    -0x1.54a6fd1e10c27p+0,
+    -0x1.5449fb8dd8d05p+0,
+    -0x1.53ecee2dd3fafp+0,
+    -0x1.538fd4fdfaabap+0,
+    -0x1.5332affe4547fp+0,
+    -0x1.52d57f2eac413p+0,
+    -0x1.5278428f2804cp+0,
+    -0x1.521afa1fb0fe2p+0,
+    -0x1.51bda5e03f98bp+0,
+    -0x1.516045d0cc41ep+0,
+    -0x1.5102d9f14f6efp+0,
+    -0x1.50a56241c1955p+0,
+    -0x1.5047dec21b245p+0,
+    -0x1.4fea4f7254916p+0,
+    -0x1.4f8cb4526655bp+0,
+    -0x1.4f2f0d6248f09p+0,
+    -0x1.4ed15aa1f4db6p+0,
+    -0x1.4e739c11628f6p+0,
+    -0x1.4e15d1b08a8bdp+0,
+    -0x1.4db7fb7f654cp+0,
+    -0x1.4d5a197deb513p+0,
+    -0x1.4cfc2bac151e9p+0,
+    -0x1.4c9e3209db376p+0,
+    -0x1.4c402c97361eep+0,
+    -0x1.4be21b541e585p+0,
+    -0x1.4b83fe408c68dp+0,
+    -0x1.4b25d55c78dbbp+0,
+    -0x1.4ac7a0a7dc38p+0,
+    -0x1.4a696022af0afp+0,
+    -0x1.4a0b13cce9e3bp+0,
+    -0x1.49acbba685516p+0,
+    -0x1.494e57af79e31p+0,
+    -0x1.48efe7e7c027fp+0,
+    -0x1.48916c4f50b12p+0,
+    -0x1.4832e4e62415ap+0,
+    -0x1.47d451ac32e8ap+0,
+    -0x1.4775b2a175c13p+0,
+    -0x1.471707c5e5326p+0,
+    -0x1.46b8511979d54p+0,
+    -0x1.46598e9c2c44ep+0,
+    -0x1.45fac04df51e4p+0,
+    -0x1.459be62ecd046p+0,
+    -0x1.453d003eac944p+0,
+    -0x1.44de0e7d8c6afp+0,
+    -0x1.447f10eb652b7p+0,
+    -0x1.442007882f74bp+0,
+    -0x1.43c0f253e3ebbp+0,
+    -0x1.4361d14e7b376p+0,
+    -0x1.4302a477edfebp+0,
+    -0x1.42a36bd034ea9p+0,
+    -0x1.4244275748a9ep+0,
+    -0x1.41e4d70d21e5ap+0,
+    -0x1.41857af1b946ap+0,
+    -0x1.41261305077ddp+0,
+    -0x1.40c69f47053e1p+0,
+    -0x1.40671fb7ab3a3p+0,
+    -0x1.40079456f225p+0,
+    -0x1.3fa7fd24d2b17p+0,
+    -0x1.3f485a2145925p+0,
+    -0x1.3ee8ab4c437c7p+0,
+    -0x1.3e88f0a5c52aap+0,
+    -0x1.3e292a2dc353ap+0,
+    -0x1.3dc957e436b46p+0,
+    -0x1.3d6979c918098p+0,
+    -0x1.3d098fdc6009dp+0,
+    -0x1.3ca99a1e07743p+0,
+    -0x1.3c49988e070f4p+0,
+    -0x1.3be98b2c579bcp+0,
+    -0x1.3b8971f8f1da7p+0,
+    -0x1.3b294cf3ce91fp+0,
+    -0x1.3ac91c1ce6851p+0,
+    -0x1.3a68df74327c7p+0,
+    -0x1.3a0896f9ab42cp+0,
+    -0x1.39a842ad49a2bp+0,
+    -0x1.3947e28f0666dp+0,
+    -0x1.38e7769eda59ep+0,
+    -0x1.3886fedcbe488p+0,
+    -0x1.38267b48ab055p+0,
+    -0x1.37c5ebe2995eep+0,
+    -0x1.376550aa8227ep+0,
+    -0x1.3704a9a05e2eep+0,
+    -0x1.36a3f6c426488p+0,
+    -0x1.36433815d34d4p+0,
+    -0x1.35e26d955e1bbp+0,
+    -0x1.35819742bf8c6p+0,
+    -0x1.3520b51df077dp+0,
+    -0x1.34bfc726e9bc8p+0,
+    -0x1.345ecd5da435p+0,
+    -0x1.33fdc7c218c1dp+0,
+    -0x1.339cb65440436p+0,
+    -0x1.333b991413964p+0,
+    -0x1.32da70018ba2dp+0,
+    -0x1.32793b1ca14d9p+0,
+    -0x1.3217fa654d79p+0,
+    -0x1.31b6addb89099p+0,
+    -0x1.3155557f4ce9bp+0,
+    -0x1.30f3f15091ffcp+0,
+    -0x1.3092814f51382p+0,
+    -0x1.3031057b83814p+0,
+    -0x1.2fcf7dd521c98p+0,
+    -0x1.2f6dea5c24ff4p+0,
+    -0x1.2f0c4b108612ep+0,
+    -0x1.2eaa9ff23dfabp+0,
+    -0x1.2e48e90145a71p+0,
+    -0x1.2de7263d96084p+0,
+    -0x1.2d8557a72816bp+0,
+    -0x1.2d237d3df4ccap+0,
+    -0x1.2cc19701f5245p+0,
+    -0x1.2c5fa4f32218p+0,
+    -0x1.2bfda71174a21p+0,
+    -0x1.2b9b9d5ce5becp+0,
+    -0x1.2b3987d56e704p+0,
+    -0x1.2ad7667b07b4dp+0,
+    -0x1.2a75394daa8eap+0,
+    -0x1.2a13004d4ffcp+0,
+    -0x1.29b0bb79f1013p+0,
+    -0x1.294e6ad386a44p+0,
+    -0x1.28ec0e5a09eb8p+0,
+    -0x1.2889a60d73ddp+0,
+    -0x1.282731edbd811p+0,
+    -0x1.27c4b1fadfe5cp+0,
+    -0x1.27622634d4153p+0,
+    -0x1.26ff8e9b931f8p+0,
+    -0x1.269ceb2f1616cp+0,
+    -0x1.263a3bef560d2p+0,
+    -0x1.25d780dc4c14bp+0,
+    -0x1.2574b9f5f13f8p+0,
+    -0x1.2511e73c3e9fap+0,
+    -0x1.24af08af2d474p+0,
+    -0x1.244c1e4eb64a7p+0,
+    -0x1.23e9281ad2c52p+0,
+    -0x1.238626137bd36p+0,
+    -0x1.23231838aa8b4p+0,
+    -0x1.22bffe8a5808cp+0,
+    -0x1.225cd9087d6bep+0,
+    -0x1.21f9a7b313daap+0,
+    -0x1.21966a8a1474fp+0,
+    -0x1.2133218d785abp+0,
+    -0x1.20cfccbd38b1fp+0,
+    -0x1.206c6c194e9cbp+0,
+    -0x1.2008ffa1b342cp+0,
+    -0x1.1fa587565fcc1p+0,
+    -0x1.1f4203374d5cap+0,
+    -0x1.1ede734475245p+0,
+    -0x1.1e7ad77dd04efp+0,
+    -0x1.1e172fe358067p+0,
+    -0x1.1db37c750576cp+0,
+    -0x1.1d4fbd32d1d1bp+0,
+    -0x1.1cebf21cb6452p+0,
+    -0x1.1c881b32ac04dp+0,
+    -0x1.1c243874ac46bp+0,
+    -0x1.1bc049e2b0407p+0,
+    -0x1.1b5c4f7cb128p+0,
+    -0x1.1af84942a8331p+0,
+    -0x1.1a9437348e999p+0,
+    -0x1.1a3019525d992p+0,
+    -0x1.19cbef9c0e6b9p+0,
+    -0x1.1967ba119a509p+0,
+    -0x1.190378b2fa89fp+0,
+    -0x1.189f2b8028596p+0,
+    -0x1.183ad2791d009p+0,
+    -0x1.17d66d9dd1c13p+0,
+    -0x1.1771fcee3fdd1p+0,
+    -0x1.170d806a6097dp+0,
+    -0x1.16a8f8122d3b2p+0,
+    -0x1.164463e59f0cap+0,
+    -0x1.15dfc3e4af58p+0,
+    -0x1.157b180f576aep+0,
+    -0x1.151660659092ep+0,
+    -0x1.14b19ce7541dap+0,
+    -0x1.144ccd949b58bp+0,
+    -0x1.13e7f26d5f91cp+0,
+    -0x1.13830b719a187p+0,
+    -0x1.131e18a144423p+0,
+    -0x1.12b919fc5760bp+0,
+    -0x1.12540f82cccb8p+0,
+    -0x1.11eef9349ddc1p+0,
+    -0x1.1189d711c3ecp+0,
+    -0x1.1124a91a3854dp+0,
+    -0x1.10bf6f4df47p+0,
+    -0x1.105a29acf1991p+0,
+    -0x1.0ff4d83729318p+0,
+    -0x1.0f8f7aec9496dp+0,
+    -0x1.0f2a11cd2d2a6p+0,
+    -0x1.0ec49cd8ec49cp+0,
+    -0x1.0e5f1c0fcb587p+0,
+    -0x1.0df98f71c3bbcp+0,
+    -0x1.0d93f6feced94p+0,
+    -0x1.0d2e52b6e6184p+0,
+    -0x1.0cc8a29a02e63p+0,
+    -0x1.0c62e6a81eac7p+0,
+    -0x1.0bfd1ee132d86p+0,
+    -0x1.0b974b4538d36p+0,
+    -0x1.0b316bd42a0cdp+0,
+    -0x1.0acb808dfff61p+0,
+    -0x1.0a658972b4006p+0,
+    -0x1.09ff86823f9d2p+0,
+    -0x1.099977bc9c3dbp+0,
+    -0x1.09335d21c3555p+0,
+    -0x1.08cd36b1ae5d6p+0,
+    -0x1.0867046c56cb2p+0,
+    -0x1.0800c651b619dp+0,
+    -0x1.079a7c61c5c6bp+0,
+    -0x1.0734269c7f4dp+0,
+    -0x1.06cdc501dc241p+0,
+    -0x1.06675791d5cf1p+0,
+    -0x1.0600de4c65cd4p+0,
+    -0x1.059a5931859ddp+0,
+    -0x1.0533c8412ec5fp+0,
+    -0x1.04cd2b7b5ac6dp+0,
+    -0x1.046682e00327bp+0,
+    -0x1.03ffce6f216fap+0,
+    -0x1.03990e28af1ffp+0,
+    -0x1.0332420ca5bfcp+0,
+    -0x1.02cb6a1afeda3p+0,
+    -0x1.02648653b4005p+0,
+    -0x1.01fd96b6bebf4p+0,
+    -0x1.01969b4418a81p+0,
+    -0x1.012f93fbbb47fp+0,
+    -0x1.00c880dda031fp+0,
+    -0x1.006161e9c0f91p+0,
+    -0x1.fff46e402e54fp-1,
+    -0x1.ff26010138b67p-1,
+    -0x1.fe577c169450ap-1,
+    -0x1.fd88df8034517p-1,
+    -0x1.fcba2b3e0be72p-1,
+    -0x1.fbeb5f500e4bap-1,
+    -0x1.fb1c7bb62eb0fp-1,
+    -0x1.fa4d80706055p-1,
+    -0x1.f97e6d7e9679dp-1,
+    -0x1.f8af42e0c4613p-1,
+    -0x1.f7e00096dd4d2p-1,
+    -0x1.f710a6a0d47f9p-1,
+    -0x1.f64134fe9d3a5p-1,
+    -0x1.f571abb02ac36p-1,
+    -0x1.f4a20ab570707p-1,
+    -0x1.f3d2520e61975p-1,
+    -0x1.f30281baf181dp-1,
+    -0x1.f23299bb1385cp-1,
+    -0x1.f1629a0ebafcdp-1,
+    -0x1.f09282b5db40cp-1,
+    -0x1.efc253b067ab4p-1,
+    -0x1.eef20cfe539a1p-1,
+    -0x1.ee21ae9f9276cp-1,
+    -0x1.ed51389417a3p-1,
+    -0x1.ec80aadbd68c6p-1,
+    -0x1.ebb00576c2a07p-1,
+    -0x1.eadf4864cf40ep-1,
+    -0x1.ea0e73a5efdb5p-1,
+    -0x1.e93d873a17e52p-1,
+    -0x1.e86c83213adfep-1,
+    -0x1.e79b675b4c40fp-1,
+    -0x1.e6ca33e83f7dfp-1,
+    -0x1.e5f8e8c808183p-1,
+    -0x1.e52785fa99894p-1,
+    -0x1.e4560b7fe7567p-1,
+    -0x1.e3847957e5093p-1,
+    -0x1.e2b2cf82862acp-1,
+    -0x1.e1e10dffbe448p-1,
+    -0x1.e10f34cf80dfep-1,
+    -0x1.e03d43f1c18a1p-1,
+    -0x1.df6b3b6673dc6p-1,
+    -0x1.de991b2d8b682p-1,
+    -0x1.ddc6e346fbc67p-1,
+    -0x1.dcf493b2b888cp-1,
+    -0x1.dc222c70b54c2p-1,
+    -0x1.db4fad80e5b1cp-1,
+    -0x1.da7d16e33d5edp-1,
+    -0x1.d9aa6897b0044p-1,
+    -0x1.d8d7a29e31475p-1,
+    -0x1.d804c4f6b4cdp-1,
+    -0x1.d731cfa12e468p-1,
+    -0x1.d65ec29d915ccp-1,
+    -0x1.d58b9debd1c4ep-1,
+    -0x1.d4b8618be337dp-1,
+    -0x1.d3e50d7db96e8p-1,
+    -0x1.d311a1c14821fp-1,
+    -0x1.d23e1e56830b1p-1,
+    -0x1.d16a833d5de6fp-1,
+    -0x1.d096d075cc7e4p-1,
+    -0x1.cfc305ffc292p-1,
+    -0x1.ceef23db33efp-1,
+    -0x1.ce1b2a081466p-1,
+    -0x1.cd47188657c3ep-1,
+    -0x1.cc72ef55f1c97p-1,
+    -0x1.cb9eae76d6479p-1,
+    -0x1.caca55e8f91eep-1,
+    -0x1.c9f5e5ac4e242p-1,
+    -0x1.c9215dc0c92c1p-1,
+    -0x1.c84cbe265e176p-1,
+    -0x1.c77806dd00bebp-1,
+    -0x1.c6a337e4a506cp-1,
+    -0x1.c5ce513d3ed82p-1,
+    -0x1.c4f952e6c21b6p-1,
+    -0x1.c4243ce122b91p-1,
+    -0x1.c34f0f2c549ddp-1,
+    -0x1.c279c9c84bc21p-1,
+    -0x1.c1a46cb4fc126p-1,
+    -0x1.c0cef7f2597b5p-1,
+    -0x1.bff96b8057f96p-1,
+    -0x1.bf23c75eeb8cep-1,
+    -0x1.be4e0b8e08364p-1,
+    -0x1.bd78380da1f5ep-1,
+    -0x1.bca24cddaccc4p-1,
+    -0x1.bbcc49fe1cb9cp-1,
+    -0x1.baf62f6ee5bebp-1,
+    -0x1.ba1ffd2ffbdf9p-1,
+    -0x1.b949b341532c9p-1,
+    -0x1.b87351a2dfae1p-1,
+    -0x1.b79cd85495785p-1,
+    -0x1.b6c6475668a38p-1,
+    -0x1.b5ef9ea84d47ep-1,
+    -0x1.b518de4a377dbp-1,
+    -0x1.b442063c1b5d1p-1,
+    -0x1.b36b167ded024p-1,
+    -0x1.b2940f0fa0955p-1,
+    -0x1.b1bceff12a367p-1,
+    -0x1.b0e5b9227e11ap-1,
+    -0x1.b00e6aa39053p-1,
+    -0x1.af370474551abp-1,
+    -0x1.ae5f8694c094bp-1,
+    -0x1.ad87f104c6f51p-1,
+    -0x1.acb043c45c7bbp-1,
+    -0x1.abd87ed3755c9p-1,
+    -0x1.ab00a23205cbcp-1,
+    -0x1.aa28ade002091p-1,
+    -0x1.a950a1dd5e4c8p-1,
+    -0x1.a8787e2a0ed9ep-1,
+    -0x1.a7a042c607f92p-1,
+    -0x1.a6c7efb13df21p-1,
+    -0x1.a5ef84eba50c8p-1,
+    -0x1.a517027531904p-1,
+    -0x1.a43e684dd7c92p-1,
+    -0x1.a365b6758c0eep-1,
+    -0x1.a28cecec42b14p-1,
+    -0x1.a1b40bb1f007fp-1,
+    -0x1.a0db12c68862cp-1,
+    -0x1.a002022a001d6p-1,
+    -0x1.9f28d9dc4b977p-1,
+    -0x1.9e4f99dd5f30ap-1,
+    -0x1.9d76422d2f488p-1,
+    -0x1.9c9cd2cbb042dp-1,
+    -0x1.9bc34bb8d68efp-1,
+    -0x1.9ae9acf496949p-1,
+    -0x1.9a0ff67ee4c33p-1,
+    -0x1.99362857b5825p-1,
+    -0x1.985c427efd459p-1,
+    -0x1.978244f4b0845p-1,
+    -0x1.96a82fb8c3b61p-1,
+    -0x1.95ce02cb2b564p-1,
+    -0x1.94f3be2bdbec2p-1,
+    -0x1.941961dac9f33p-1,
+    -0x1.933eedd7e9e6ep-1,
+    -0x1.92646223304e8p-1,
+    -0x1.9189bebc91a97p-1,
+    -0x1.90af03a40283p-1,
+    -0x1.8fd430d9776a7p-1,
+    -0x1.8ef9465ce4ef1p-1,
+    -0x1.8e1e442e3fa03p-1,
+    -0x1.8d432a4d7c10fp-1,
+    -0x1.8c67f8ba8ee08p-1,
+    -0x1.8b8caf756ca62p-1,
+    -0x1.8ab14e7e0a00fp-1,
+    -0x1.89d5d5d45b882p-1,
+    -0x1.88fa457855dedp-1,
+    -0x1.881e9d69edac1p-1,
+    -0x1.8742dda91797p-1,
+    -0x1.86670635c846ap-1,
+    -0x1.858b170ff4661p-1,
+    -0x1.84af103790ac4p-1,
+    -0x1.83d2f1ac91c83p-1,
+    -0x1.82f6bb6eec70ep-1,
+    -0x1.821a6d7e95554p-1,
+    -0x1.813e07db81304p-1,
+    -0x1.80618a85a4c0dp-1,
+    -0x1.7f84f57cf4c5ep-1,
+    -0x1.7ea848c165fe4p-1,
+    -0x1.7dcb8452ed28ep-1,
+    -0x1.7ceea8317f088p-1,
+    -0x1.7c11b45d106c1p-1,
+    -0x1.7b34a8d5961a4p-1,
+    -0x1.7a57859b04e1ep-1,
+    -0x1.797a4aad5189dp-1,
+    -0x1.789cf80c70e4cp-1,
+    -0x1.77bf8db857c96p-1,
+    -0x1.76e20bb0fb0e7p-1,
+    -0x1.760471f64f8e9p-1,
+    -0x1.7526c0884a306p-1,
+    -0x1.7448f766dfce8p-1,
+    -0x1.736b16920543ap-1,
+    -0x1.728d1e09af7a4p-1,
+    -0x1.71af0dcdd361p-1,
+    -0x1.70d0e5de65e25p-1,
+    -0x1.6ff2a63b5bdcep-1,
+    -0x1.6f144ee4aa3f3p-1,
+    -0x1.6e35dfda4607bp-1,
+    -0x1.6d57591c2428dp-1,
+    -0x1.6c78baaa39951p-1,
+    -0x1.6b9a04847b4adp-1,
+    -0x1.6abb36aade407p-1,
+    -0x1.69dc511d57786p-1,
+    -0x1.68fd53dbdbf5p-1,
+    -0x1.681e3ee660accp-1,
+    -0x1.673f123cdaa5fp-1,
+    -0x1.665fcddf3ef6bp-1,
+    -0x1.658071cd82a96p-1,
+    -0x1.64a0fe079ac46p-1,
+    -0x1.63c1728d7c51ep-1,
+    -0x1.62e1cf5f1c6c1p-1,
+    -0x1.6202147c702d2p-1,
+    -0x1.612241e56ca35p-1,
+    -0x1.6042579a06e8dp-1,
+    -0x1.5f62559a341bdp-1,
+    -0x1.5e823be5e95a6p-1,
+    -0x1.5da20a7d1bc69p-1,
+    -0x1.5cc1c15fc08e7p-1,
+    -0x1.5be1608dccd81p-1,
+    -0x1.5b00e80735d17p-1,
+    -0x1.5a2057cbf0a0ap-1,
+    -0x1.593fafdbf277bp-1,
+    -0x1.585ef037308c8p-1,
+    -0x1.577e18dda015p-1,
+    -0x1.569d29cf36473p-1,
+    -0x1.55bc230be858fp-1,
+    -0x1.54db0493ab804p-1,
+    -0x1.53f9ce6674f7p-1,
+    -0x1.531880843a03p-1,
+    -0x1.52371aecefe23p-1,
+    -0x1.51559da08bde5p-1,
+    -0x1.5074089f03453p-1,
+    -0x1.4f925be84b648p-1,
+    -0x1.4eb0977c598ap-1,
+    -0x1.4dcebb5b23038p-1,
+    -0x1.4cecc7849d1ebp-1,
+    -0x1.4c0abbf8bd2d5p-1,
+    -0x1.4b2898b7788d1p-1,
+    -0x1.4a465dc0c4939p-1,
+    -0x1.49640b1496a28p-1,
+    -0x1.4881a0b2e41f6p-1,
+    -0x1.479f1e9ba26fcp-1,
+    -0x1.46bc84cec6f93p-1,
+    -0x1.45d9d34c47215p-1,
+    -0x1.44f70a14184dap-1,
+    -0x1.441429262fe7bp-1,
+    -0x1.433130828364fp-1,
+    -0x1.424e20290832ep-1,
+    -0x1.416af819b3c6fp-1,
+    -0x1.4087b8547b8eap-1,
+    -0x1.3fa460d955036p-1,
+    -0x1.3ec0f1a835a29p-1,
+    -0x1.3ddd6ac112e99p-1,
+    -0x1.3cf9cc23e259cp-1,
+    -0x1.3c1615d099805p-1,
+    -0x1.3b3247c72ddebp-1,
+    -0x1.3a4e620794f63p-1,
+    -0x1.396a6491c457fp-1,
+    -0x1.38864f65b1954p-1,
+    -0x1.37a2228352337p-1,
+    -0x1.36bdddea9bc3bp-1,
+    -0x1.35d9819b83db4p-1,
+    -0x1.34f50d9600133p-1,
+    -0x1.341081da0610ap-1,
+    -0x1.332bde678b6ccp-1,
+    -0x1.3247233e85c0ap-1,
+    -0x1.3162505eeab16p-1,
+    -0x1.307d65c8afdc2p-1,
+    -0x1.2f98637bcae9ep-1,
+    -0x1.2eb349783187ap-1,
+    -0x1.2dce17bdd9627p-1,
+    -0x1.2ce8ce4cb8274p-1,
+    -0x1.2c036d24c3832p-1,
+    -0x1.2b1df445f127p-1,
+    -0x1.2a3863b036cfcp-1,
+    -0x1.2952bb638a324p-1,
+    -0x1.286cfb5fe10f7p-1,
+    -0x1.278723a531282p-1,
+    -0x1.26a1343370313p-1,
+    -0x1.25bb2d0a93eb9p-1,
+    -0x1.24d50e2a921bfp-1,
+    -0x1.23eed793608b3p-1,
+    -0x1.23088944f50ep-1,
+    -0x1.2222233f456d2p-1,
+    -0x1.213ba58247716p-1,
+    -0x1.2055100df0f36p-1,
+    -0x1.1f6e62e237cbcp-1,
+    -0x1.1e879dff11c74p-1,
+    -0x1.1da0c16474be9p-1,
+    -0x1.1cb9cd12568e5p-1,
+    -0x1.1bd2c108ad132p-1,
+    -0x1.1aeb9d476e2d9p-1,
+    -0x1.1a0461ce8fca3p-1,
+    -0x1.191d0e9e07cd7p-1,
+    -0x1.1835a3b5cc23ep-1,
+    -0x1.174e2115d2b22p-1,
+    -0x1.166686be11689p-1,
+    -0x1.157ed4ae7e3bap-1,
+    -0x1.14970ae70f1fcp-1,
+    -0x1.13af2967ba097p-1,
+    -0x1.12c7303074edp-1,
+    -0x1.11df1f4135befp-1,
+    -0x1.10f6f699f277ap-1,
+    -0x1.100eb63aa11b7p-1,
+    -0x1.0f265e2337a6bp-1,
+    -0x1.0e3dee53ac21bp-1,
+    -0x1.0d5566cbf498ap-1,
+    -0x1.0c6cc78c0717dp-1,
+    -0x1.0b841093d9ab7p-1,
+    -0x1.0a9b41e3625fcp-1,
+    -0x1.09b25b7a9740fp-1,
+    -0x1.08c95d596e5b5p-1,
+    -0x1.07e0477fddbf2p-1,
+    -0x1.06f719eddb8c6p-1,
+    -0x1.060dd4a35de33p-1,
+    -0x1.052477a05ad7dp-1,
+    -0x1.043b02e4c88a4p-1,
+    -0x1.035176709d1e9p-1,
+    -0x1.0267d243ceb8dp-1,
+    -0x1.017e165e537dp-1,
+    -0x1.009442c021934p-1,
+    -0x1.ff54aed25e5eep-2,
+    -0x1.fd80a8b2e4fb1p-2,
+    -0x1.fbac7321c363p-2,
+    -0x1.f9d80e1ee5eeap-2,
+    -0x1.f80379aa390dcp-2,
+    -0x1.f62eb5c3a9382p-2,
+    -0x1.f459c26b22e58p-2,
+    -0x1.f2849fa0928d8p-2,
+    -0x1.f0af4d63e4a7ep-2,
+    -0x1.eed9cbb505b46p-2,
+    -0x1.ed041a93e24a7p-2,
+    -0x1.eb2e3a0066f1bp-2,
+    -0x1.e95829fa80498p-2,
+    -0x1.e781ea821af14p-2,
+    -0x1.e5ab7b972370ap-2,
+    -0x1.e3d4dd398667p-2,
+    -0x1.e1fe0f69307bcp-2,
+    -0x1.e02712260e5e2p-2,
+    -0x1.de4fe5700cd53p-2,
+    -0x1.dc78894718905p-2,
+    -0x1.daa0fdab1e3ecp-2,
+    -0x1.d8c9429c0aaf9p-2,
+    -0x1.d6f15819cab1dp-2,
+    -0x1.d5193e244afcap-2,
+    -0x1.d340f4bb785f1p-2,
+    -0x1.d1687bdf3fb03p-2,
+    -0x1.cf8fd38f8dc6ep-2,
+    -0x1.cdb6fbcc4f821p-2,
+    -0x1.cbddf49571d88p-2,
+    -0x1.ca04bdeae1a91p-2,
+    -0x1.c82b57cc8bd2bp-2,
+    -0x1.c651c23a5d541p-2,
+    -0x1.c477fd34432bcp-2,
+    -0x1.c29e08ba2a40ap-2,
+    -0x1.c0c3e4cbff916p-2,
+    -0x1.bee99169b024ap-2,
+    -0x1.bd0f0e932908dp-2,
+    -0x1.bb345c4857646p-2,
+    -0x1.b9597a892845dp-2,
+    -0x1.b77e695588bbap-2,
+    -0x1.b5a328ad65ec2p-2,
+    -0x1.b3c7b890acedep-2,
+    -0x1.b1ec18ff4aef2p-2,
+    -0x1.b01049f92d262p-2,
+    -0x1.ae344b7e40c8fp-2,
+    -0x1.ac581d8e730dfp-2,
+    -0x1.aa7bc029b12b5p-2,
+    -0x1.a89f334fe8573p-2,
+    -0x1.a6c2770105cfdp-2,
+    -0x1.a4e58b3cf6eb2p-2,
+    -0x1.a3087003a8ef4p-2,
+    -0x1.a12b2555093ap-2,
+    -0x1.9f4dab3105314p-2,
+    -0x1.9d7001978a3aep-2,
+    -0x1.9b92288885bcap-2,
+    -0x1.99b42003e51c7p-2,
+    -0x1.97d5e80995c02p-2,
+    -0x1.95f78099850d8p-2,
+    -0x1.9418e9b3a0726p-2,
+    -0x1.923a2357d57c4p-2,
+    -0x1.905b2d8611b8ap-2,
+    -0x1.8e7c083e429d3p-2,
+    -0x1.8c9cb38055b79p-2,
+    -0x1.8abd2f4c389d2p-2,
+    -0x1.88dd7ba1d8e35p-2,
+    -0x1.86fd9881241fbp-2,
+    -0x1.851d85ea07e7bp-2,
+    -0x1.833d43dc71d8ap-2,
+    -0x1.815cd2584fa7cp-2,
+    -0x1.7f7c315d8efa7p-2,
+    -0x1.7d9b60ec1d8dcp-2,
+    -0x1.7bba6103e91eep-2,
+    -0x1.79d931a4df533p-2,
+    -0x1.77f7d2ceede7cp-2,
+    -0x1.7616448202a1bp-2,
+    -0x1.743486be0b4ep-2,
+    -0x1.72529982f5d19p-2,
+    -0x1.70707cd0aff96p-2,
+    -0x1.6e8e30a727926p-2,
+    -0x1.6cabb5064a897p-2,
+    -0x1.6ac909ee06cb5p-2,
+    -0x1.68e62f5e4a2cep-2,
+    -0x1.67032557029bp-2,
+    -0x1.651febd81e0a5p-2,
+    -0x1.633c82e18a6f8p-2,
+    -0x1.6158ea7335c74p-2,
+    -0x1.5f75228d0e26p-2,
+    -0x1.5d912b2f01886p-2,
+    -0x1.5bad0458fdeb1p-2,
+    -0x1.59c8ae0af1627p-2,
+    -0x1.57e42844c9f32p-2,
+    -0x1.55ff730675b98p-2,
+    -0x1.541a8e4fe2d9fp-2,
+    -0x1.52357a20ff78bp-2,
+    -0x1.50503679b9ba2p-2,
+    -0x1.4e6ac359ffca8p-2,
+    -0x1.4c8520c1bfeddp-2,
+    -0x1.4a9f4eb0e8507p-2,
+    -0x1.48b94d27671e9p-2,
+    -0x1.46d31c252aa43p-2,
+    -0x1.44ecbbaa212d6p-2,
+    -0x1.43062bb638ee4p-2,
+    -0x1.411f6c496032fp-2,
+    -0x1.3f387d63854f4p-2,
+    -0x1.3d515f04969f3p-2,
+    -0x1.3b6a112c82966p-2,
+    -0x1.398293db3790bp-2,
+    -0x1.379ae710a3ea1p-2,
+    -0x1.35b30accb6162p-2,
+    -0x1.33caff0f5c78dp-2,
+    -0x1.31e2c3d8858dap-2,
+    -0x1.2ffa59281fd83p-2,
+    -0x1.2e11befe19dc1p-2,
+    -0x1.2c28f55a621cdp-2,
+    -0x1.2a3ffc3ce71ep-2,
+    -0x1.2856d3a597633p-2,
+    -0x1.266d7b946177ep-2,
+    -0x1.2483f40933ff7p-2,
+    -0x1.229a3d03fd8d5p-2,
+    -0x1.20b05684acccbp-2,
+    -0x1.1ec6408b3068dp-2,
+    -0x1.1cdbfb1776f52p-2,
+    -0x1.1af186296f1cfp-2,
+    -0x1.1906e1c107936p-2,
+    -0x1.171c0dde2f13ap-2,
+    -0x1.15310a80d4709p-2,
+    -0x1.1345d7a8e6657p-2,
+    -0x1.115a755653ad4p-2,
+    -0x1.0f6ee3890b22fp-2,
+    -0x1.0d832240fba15p-2,
+    -0x1.0b97317e13eb8p-2,
+    -0x1.09ab114042dc5p-2,
+    -0x1.07bec1877756ap-2,
+    -0x1.05d24253a03d3p-2,
+    -0x1.03e593a4ac72ep-2,
+    -0x1.01f8b57a8ae26p-2,
+    -0x1.000ba7d52a8e3p-2,
+    -0x1.fc3cd568f4d25p-3,
+    -0x1.f861fc30d2eb8p-3,
+    -0x1.f486c401cd4d5p-3,
+    -0x1.f0ab2cdbc20cdp-3,
+    -0x1.eccf36be8f4edp-3,
+    -0x1.e8f2e1aa13383p-3,
+    -0x1.e5162d9e2bedbp-3,
+    -0x1.e1391a9ab7945p-3,
+    -0x1.dd5ba89f9450ep-3,
+    -0x1.d97dd7aca0583p-3,
+    -0x1.d59fa7c1ba0e9p-3,
+    -0x1.d1c118debfb89p-3,
+    -0x1.cde22b038fca8p-3,
+    -0x1.ca02de3008c87p-3,
+    -0x1.c623326409368p-3,
+    -0x1.c243279f6f98cp-3,
+    -0x1.be62bde21a736p-3,
+    -0x1.ba81f52be84a7p-3,
+    -0x1.b6a0cd7cb7a21p-3,
+    -0x1.b2bf46d4670e3p-3,
+    -0x1.aedd6132d5528p-3,
+    -0x1.aafb1c97e112dp-3,
+    -0x1.a718790369228p-3,
+    -0x1.a33576754c651p-3,
+    -0x1.9f5214ed69bdcp-3,
+    -0x1.9b6e546ba01p-3,
+    -0x1.978a34efce3f2p-3,
+    -0x1.93a5b679d32e7p-3,
+    -0x1.8fc0d9098dc15p-3,
+    -0x1.8bdb9c9edcebp-3,
+    -0x1.87f601399fce6p-3,
+    -0x1.841006d9b56e8p-3,
+    -0x1.8029ad7efcfep-3,
+    -0x1.7c42f52955afbp-3,
+    -0x1.785bddd89e86bp-3,
+    -0x1.7474678cb6b5bp-3,
+    -0x1.708c92457d8f2p-3,
+    -0x1.6ca45e02d2952p-3,
+    -0x1.68bbcac4951a3p-3,
+    -0x1.64d2d88aa470cp-3,
+    -0x1.60e98754e01aep-3,
+    -0x1.5cffd723277afp-3,
+    -0x1.5915c7f55a22fp-3,
+    -0x1.552b59cb57a4cp-3,
+    -0x1.51408ca4ff62cp-3,
+    -0x1.4d55608230eefp-3,
+    -0x1.4969d562cbeb2p-3,
+    -0x1.457deb46b009p-3,
+    -0x1.4191a22dbd29fp-3,
+    -0x1.3da4fa17d2ffap-3,
+    -0x1.39b7f304d13bcp-3,
+    -0x1.35ca8cf497cf9p-3,
+    -0x1.31dcc7e706ac5p-3,
+    -0x1.2deea3dbfd937p-3,
+    -0x1.2a0020d35c764p-3,
+    -0x1.26113ecd0355ep-3,
+    -0x1.2221fdc8d2334p-3,
+    -0x1.1e325dc6a91f7p-3,
+    -0x1.1a425ec6685bp-3,
+    -0x1.165200c7eff6ep-3,
+    -0x1.126143cb20041p-3,
+    -0x1.0e7027cfd8c31p-3,
+    -0x1.0a7eacd5fa54cp-3,
+    -0x1.068cd2dd65099p-3,
+    -0x1.029a99e5f941dp-3,
+    -0x1.fd5003df2ebbbp-4,
+    -0x1.f56a15f43f7cp-4,
+    -0x1.ed836a0ae5852p-4,
+    -0x1.e59c0022e1b78p-4,
+    -0x1.ddb3d83bf552cp-4,
+    -0x1.d5caf255e1374p-4,
+    -0x1.cde14e7066456p-4,
+    -0x1.c5f6ec8b45dc9p-4,
+    -0x1.be0bcca6417cp-4,
+    -0x1.b61feec11aa2dp-4,
+    -0x1.ae3352db92d01p-4,
+    -0x1.a645f8f56b82ep-4,
+    -0x1.9e57e10e663a7p-4,
+    -0x1.96690b264475ep-4,
+    -0x1.8e79773cc7d41p-4,
+    -0x1.86892551b2532p-4,
+    -0x1.7e981564c5b1bp-4,
+    -0x1.76a64775c3edep-4,
+    -0x1.6eb3bb846ec65p-4,
+    -0x1.66c071908858ep-4,
+    -0x1.5ecc6999d2e33p-4,
+    -0x1.56d7a3a010a2ep-4,
+    -0x1.4ee21fa303d59p-4,
+    -0x1.46ebdda26ed8ap-4,
+    -0x1.3ef4dd9e1468bp-4,
+    -0x1.36fd1f95b6e31p-4,
+    -0x1.2f04a38918a53p-4,
+    -0x1.270b6977fc8b6p-4,
+    -0x1.1f1171622571fp-4,
+    -0x1.1716bb4755d61p-4,
+    -0x1.0f1b472750941p-4,
+    -0x1.071f1501d8a82p-4,
+    -0x1.fe4449ad625c2p-5,
+    -0x1.ee48ed4b3b41ep-5,
+    -0x1.de4c14dcc2395p-5,
+    -0x1.ce4dc0617d7a2p-5,
+    -0x1.be4defd8f3fa7p-5,
+    -0x1.ae4ca342ac318p-5,
+    -0x1.9e49da9e2d55p-5,
+    -0x1.8e4595eafe9abp-5,
+    -0x1.7e3fd528a679cp-5,
+    -0x1.6e389856ac27dp-5,
+    -0x1.5e2fdf749759ap-5,
+    -0x1.4e25aa81f0825p-5,
+    -0x1.3e19f97e3f569p-5,
+    -0x1.2e0ccc690b8b2p-5,
+    -0x1.1dfe2341dd932p-5,
+    -0x1.0dedfe083d62cp-5,
+    -0x1.fbb8b97766da4p-6,
+    -0x1.db927eb78f4cfp-6,
+    -0x1.bb694bd00582fp-6,
+    -0x1.9b3d20bfdb607p-6,
+    -0x1.7b0dfd8622c9ep-6,
+    -0x1.5adbe221ee228p-6,
+    -0x1.3aa6ce92514aap-6,
+    -0x1.1a6ec2d65ea59p-6,
+    -0x1.f4677dda512d4p-7,
+    -0x1.b3eb85ab85fc2p-7,
+    -0x1.73699d1e817c7p-7,
+    -0x1.32e1c4316c6cdp-7,
+    -0x1.e4a7f5c4e1134p-8,
+    -0x1.6380825f6f1fp-8,
+    -0x1.c49a5c5dacebdp-9,
+    -0x1.8437e4bdaa441p-10,
+    0x1.01e8e51408b47p-11,
+    0x1.432826952e17ap-9,
+    0x1.22f6eacc7be5dp-8,
+    0x1.a465a32bd8339p-8,
+    0x1.12f01e3628461p-7,
+    0x1.53b35b48c6bf4p-7,
+    0x1.947c88cf98d2ep-7,
+    0x1.d54ba6cc6ed09p-7,
+    0x1.0b105aa08c83fp-6,
+    0x1.2b7dda17b3e42p-6,
+    0x1.4bee51cc95b0cp-6,
+    0x1.6c61c1c019928p-6,
+    0x1.8cd829f325b55p-6,
+    0x1.ad518a66a142ep-6,
+    0x1.cdcde31b72671p-6,
+    0x1.ee4d3412804bap-6,
+    0x1.0767bea6584ebp-5,
+    0x1.17aa5f6574453p-5,
+    0x1.27ee7c4706a02p-5,
+    0x1.3834154b81f68p-5,
+    0x1.487b2a7358df3p-5,
+    0x1.58c3bbbefdf11p-5,
+    0x1.690dc92ee383ap-5,
+    0x1.795952c37b2fcp-5,
+    0x1.89a6587d370d7p-5,
+    0x1.99f4da5c88761p-5,
+    0x1.aa44d861e0c32p-5,
+    0x1.ba96528db20c7p-5,
+    0x1.cae948e06dab9p-5,
+    0x1.db3dbb5a84ba6p-5,
+    0x1.eb93a9fc6852fp-5,
+    0x1.fbeb14c6894fap-5,
+    0x1.0621fddcabe63p-4,
+    0x1.0e4f2f6aa251dp-4,
+    0x1.167d1f0d6057fp-4,
+    0x1.1eabccc51de6dp-4,
+    0x1.26db389212ecap-4,
+    0x1.2f0b627477b6fp-4,
+    0x1.373c4a6c8433fp-4,
+    0x1.3f6df07a70321p-4,
+    0x1.47a0549e737fep-4,
+    0x1.4fd376d8c5ebcp-4,
+    0x1.580757299f249p-4,
+    0x1.603bf5913679cp-4,
+    0x1.6871520fc37a5p-4,
+    0x1.70a76ca57d75bp-4,
+    0x1.78de45529bfafp-4,
+    0x1.8115dc175639dp-4,
+    0x1.894e30f3e3424p-4,
+    0x1.918743e87a245p-4,
+    0x1.99c114f551fp-4,
+    0x1.a1fba41aa1b55p-4,
+    0x1.aa36f158a0843p-4,
+    0x1.b272fcaf856cbp-4,
+    0x1.baafc61f875f1p-4,
+    0x1.c2ed4da8dcec5p-4,
+    0x1.cb2b934bbce4ep-4,
+    0x1.d36a97085dba2p-4,
+    0x1.dbaa58def5bd9p-4,
+    0x1.e3ead8cfbb40ap-4,
+    0x1.ec2c16dae494ep-4,
+    0x1.f46e1300a80bdp-4,
+    0x1.fcb0cd413bf6fp-4,
+    0x1.027a22ce6b53fp-3,
+    0x1.069c3e09d7282p-3,
+    0x1.0abeb852fc615p-3,
+    0x1.0ee191a9f6088p-3,
+    0x1.1304ca0edf07p-3,
+    0x1.17286181d265cp-3,
+    0x1.1b4c5802eafe3p-3,
+    0x1.1f70ad924399dp-3,
+    0x1.2395622ff7022p-3,
+    0x1.27ba75dc2000ap-3,
+    0x1.2bdfe896d95efp-3,
+    0x1.3005ba603dd6ap-3,
+    0x1.342beb3867f1bp-3,
+    0x1.38527b1f7259ep-3,
+    0x1.3c796a1577993p-3,
+    0x1.40a0b81a92597p-3,
+    0x1.44c8652edd14cp-3,
+    0x1.48f0715272358p-3,
+    0x1.4d18dc856c25ep-3,
+    0x1.5141a6c7e5502p-3,
+    0x1.556ad019f81e8p-3,
+    0x1.5994587bbefb5p-3,
+    0x1.5dbe3fed5440fp-3,
+    0x1.61e8866ed21a4p-3,
+    0x1.66132c0052d1bp-3,
+    0x1.6a3e30a1f092p-3,
+    0x1.6e699453c5a5cp-3,
+    0x1.72955715ec27dp-3,
+    0x1.76c178e87e234p-3,
+    0x1.7aedf9cb95a31p-3,
+    0x1.7f1ad9bf4cb24p-3,
+    0x1.834818c3bd5bep-3,
+    0x1.8775b6d9019b1p-3,
+    0x1.8ba3b3ff333b7p-3,
+    0x1.8fd210366c283p-3,
+    0x1.9400cb7ec62cep-3,
+    0x1.982fe5d85b34cp-3,
+    0x1.9c5f5f4344fb9p-3,
+    0x1.a08f37bf9d3cep-3,
+    0x1.a4bf6f4d7de4p-3,
+    0x1.a8f005ed00ac9p-3,
+    0x1.ad20fb9e3f329p-3,
+    0x1.b152506152e23p-3,
+    0x1.b584043655576p-3,
+    0x1.b9b6171d602e1p-3,
+    0x1.bde889168cd29p-3,
+    0x1.c21b5a21f4d0dp-3,
+    0x1.c64e8a3fb1954p-3,
+    0x1.ca82196fdcabcp-3,
+    0x1.ceb607b28f70dp-3,
+    0x1.d2ea5507e331p-3,
+    0x1.d71f016ff138dp-3,
+    0x1.db540cead2d4cp-3,
+    0x1.df897778a1419p-3,
+    0x1.e3bf4119758c4p-3,
+    0x1.e7f569cd68f18p-3,
+    0x1.ec2bf19494aep-3,
+    0x1.f062d86f11beep-3,
+    0x1.f49a1e5cf9214p-3,
+    0x1.f8d1c35e64021p-3,
+    0x1.fd09c7736b5e6p-3,
+    0x1.00a1154e1411cp-2,
+    0x1.02bd766c599f6p-2,
+    0x1.04da071492cebp-2,
+    0x1.06f6c746cc0e7p-2,
+    0x1.0913b70311b58p-2,
+    0x1.0b30d6497032ap-2,
+    0x1.0d4e2519f3f48p-2,
+    0x1.0f6ba374a94a1p-2,
+    0x1.118951599c7a6p-2,
+    0x1.13a72ec8d9d47p-2,
+    0x1.15c53bc26dbefp-2,
+    0x1.17e378466488ep-2,
+    0x1.1a01e454ca794p-2,
+    0x1.1c207fedabcf3p-2,
+    0x1.1e3f4b1114b2p-2,
+    0x1.205e45bf1160cp-2,
+    0x1.227d6ff7ae1a8p-2,
+    0x1.249cc9baf7068p-2,
+    0x1.26bc5308f85cp-2,
+    0x1.28dc0be1be3a5p-2,
+    0x1.2afbf44554b8dp-2,
+    0x1.2d1c0c33c7eeep-2,
+    0x1.2f3c53ad23fbep-2,
+    0x1.315ccab1750f1p-2,
+    0x1.337d7140c728p-2,
+    0x1.359e475b26563p-2,
+    0x1.37bf4d009ea9p-2,
+    0x1.39e082313c184p-2,
+    0x1.3c01e6ed0aab6p-2,
+    0x1.3e237b34165ap-2,
+    0x1.40453f066b2bcp-2,
+    0x1.4267326415105p-2,
+    0x1.4489554d1fef6p-2,
+    0x1.46aba7c197b0dp-2,
+    0x1.48ce29c1883c7p-2,
+    0x1.4af0db4cfd7ap-2,
+    0x1.4d13bc6403514p-2,
+    0x1.4f36cd06a5a21p-2,
+    0x1.515a0d34f0348p-2,
+    0x1.537d7ceeeee07p-2,
+    0x1.55a11c34ad65fp-2,
+    0x1.57c4eb0637853p-2,
+    0x1.59e8e96399161p-2,
+    0x1.5c0d174cddd8ap-2,
+    0x1.5e3174c211851p-2,
+    0x1.605601c33fd39p-2,
+    0x1.627abe50747c4p-2,
+    0x1.649faa69bb2f5p-2,
+    0x1.66c4c60f1f855p-2,
+    0x1.68ea1140ad266p-2,
+    0x1.6b0f8bfe6fabp-2,
+    0x1.6d35364872bb8p-2,
+    0x1.6f5b101ec1e84p-2,
+    0x1.7181198168b9ep-2,
+    0x1.73a7527072c0ep-2,
+    0x1.75cdbaebeba57p-2,
+    0x1.77f452f3def02p-2,
+    0x1.7a1b1a885809dp-2,
+    0x1.7c4211a962731p-2,
+    0x1.7e69385709b46p-2,
+    0x1.80908e91594e7p-2,
+    0x1.82b814585ca9fp-2,
+    0x1.84dfc9ac1f3fap-2,
+    0x1.8707ae8cac706p-2,
+    0x1.892fc2fa0f95p-2,
+    0x1.8b5806f454067p-2,
+    0x1.8d807a7b851dcp-2,
+    0x1.8fa91d8fae33bp-2,
+    0x1.91d1f030daa14p-2,
+    0x1.93faf25f15bf6p-2,
+    0x1.9624241a6adfp-2,
+    0x1.984d8562e5394p-2,
+    0x1.9a77163890174p-2,
+    0x1.9ca0d69b76b22p-2,
+    0x1.9ecac68ba453p-2,
+    0x1.a0f4e609242b1p-2,
+    0x1.a31f351401639p-2,
+    0x1.a549b3ac4725ep-2,
+    0x1.a77461d2009b4p-2,
+    0x1.a99f3f8538ecfp-2,
+    0x1.abca4cc5fb445p-2,
+    0x1.adf5899452c2cp-2,
+    0x1.b020f5f04a71cp-2,
+    0x1.b24c91d9ed6acp-2,
+    0x1.b4785d5146b74p-2,
+    0x1.b6a458566170cp-2,
+    0x1.b8d082e94898dp-2,
+    0x1.bafcdd0a07293p-2,
+    0x1.bd2966b8a81b8p-2,
+    0x1.bf561ff536696p-2,
+    0x1.c18308bfbd0c9p-2,
+    0x1.c3b0211846febp-2,
+    0x1.c5dd68fedf398p-2,
+    0x1.c80ae07390aebp-2,
+    0x1.ca38877666382p-2,
+    0x1.cc665e076abfcp-2,
+    0x1.ce946426a9177p-2,
+    0x1.d0c299d42c114p-2,
+    0x1.d2f0ff0ffe96fp-2,
+    0x1.d51f93da2b7a9p-2,
+    0x1.d74e5832bd861p-2,
+    0x1.d97d4c19bf839p-2,
+    0x1.dbac6f8f3c353p-2,
+    0x1.dddbc2933e453p-2,
+    0x1.e00b4525d075cp-2,
+    0x1.e23af746fd88fp-2,
+    0x1.e46ad8f6d0213p-2,
+    0x1.e69aea3552e0dp-2,
+    0x1.e8cb2b0290821p-2,
+    0x1.eafb9b5e93a73p-2,
+    0x1.ed2c3b4966eabp-2,
+    0x1.ef5d0ac314e7p-2,
+    0x1.f18e09cba8368p-2,
+    0x1.f3bf38632b73cp-2,
+    0x1.f5f09689a9391p-2,
+    0x1.f822243f2c19p-2,
+    0x1.fa53e183be8e3p-2,
+    0x1.fc85ce576b234p-2,
+    0x1.feb7eaba3c52dp-2,
+    0x1.00751b561e53cp-1,
+    0x1.018e5916bb4ap-1,
+    0x1.02a7ae9efa419p-1,
+    0x1.03c11beee06fep-1,
+    0x1.04daa106730a5p-1,
+    0x1.05f43de5b7464p-1,
+    0x1.070df28cb2592p-1,
+    0x1.0827befb69787p-1,
+    0x1.0941a331e1d57p-1,
+    0x1.0a5b9f302095dp-1,
+    0x1.0b75b2f62ae6fp-1,
+    0x1.0c8fde8405ea7p-1,
+    0x1.0daa21d9b6c1dp-1,
+    0x1.0ec47cf7429aap-1,
+    0x1.0fdeefdcae966p-1,
+    0x1.10f97a89ffd2bp-1,
+    0x1.12141cff3b6d1p-1,
+    0x1.132ed73c66833p-1,
+    0x1.1449a941862ebp-1,
+    0x1.1564930e9f7d4p-1,
+    0x1.167f94a3b7848p-1,
+    0x1.179aae00d3524p-1,
+    0x1.18b5df25f7fc1p-1,
+    0x1.19d128132a8fcp-1,
+    0x1.1aec88c87022fp-1,
+    0x1.1c080145cdbf6p-1,
+    0x1.1d23918b486adp-1,
+    0x1.1e3f3998e52b1p-1,
+    0x1.1f5af96ea905fp-1,
+    0x1.2076d10c98fd3p-1,
+    0x1.2192c072ba06dp-1,
+    0x1.22aec7a111249p-1,
+    0x1.23cae697a3584p-1,
+    0x1.24e71d567597dp-1,
+    0x1.26036bdd8ce11p-1,
+    0x1.271fd22cee25fp-1,
+    0x1.283c50449e547p-1,
+    0x1.2958e624a25a9p-1,
+    0x1.2a7593ccff264p-1,
+    0x1.2b92593db9a58p-1,
+    0x1.2caf3676d6c63p-1,
+    0x1.2dcc2b785b766p-1,
+    0x1.2ee938424ca01p-1,
+    0x1.30065cd4af215p-1,
+    0x1.3123992f87e04p-1,
+    0x1.3240ed52dbbaep-1,
+    0x1.335e593eaf975p-1,
+    0x1.347bdcf3084fap-1,
+    0x1.3599786feab9fp-1,
+    0x1.36b72bb55bac7p-1,
+    0x1.37d4f6c35ffd6p-1,
+    0x1.38f2d999fc82ep-1,
+    0x1.3a10d43936131p-1,
+    0x1.3b2ee6a111842p-1,
+    0x1.3c4d10d193a83p-1,
+    0x1.3d6b52cac145bp-1,
+    0x1.3e89ac8c9f2acp-1,
+    0x1.3fa81e17321dap-1,
+    0x1.40c6a76a7eecap-1,
+    0x1.41e548868a5a1p-1,
+    0x1.4304016b59243p-1,
+    0x1.4422d218f0097p-1,
+    0x1.4541ba8f53c82p-1,
+    0x1.4660bace891ebp-1,
+    0x1.477fd2d694cb6p-1,
+    0x1.489f02a77b8c9p-1,
+    0x1.49be4a41421cbp-1,
+    0x1.4adda9a3ed2a3p-1,
+    0x1.4bfd20cf816b7p-1,
+    0x1.4d1cafc4038bp-1,
+    0x1.4e3c568178336p-1,
+    0x1.4f5c1507e41afp-1,
+    0x1.507beb574bec5p-1,
+    0x1.519bd96fb44dfp-1,
+    0x1.52bbdf5121e65p-1,
+    0x1.53dbfcfb995c2p-1,
+    0x1.54fc326f1f51cp-1,
+    0x1.561c7fabb85e1p-1,
+    0x1.573ce4b169238p-1,
+    0x1.585d61803644bp-1,
+    0x1.597df61824584p-1,
+    0x1.5a9ea27937fcdp-1,
+    0x1.5bbf66a375c52p-1,
+    0x1.5ce04296e23fep-1,
+    0x1.5e01365381fbdp-1,
+    0x1.5f2241d959879p-1,
+    0x1.604365286d71fp-1,
+    0x1.6164a040c249bp-1,
+    0x1.6285f3225c9d9p-1,
+    0x1.63a75dcd40fc4p-1,
+    0x1.64c8e04173f08p-1,
+    0x1.65ea7a7ef9f93p-1,
+    0x1.670c2c85d79d1p-1,
+    0x1.682df65611571p-1,
+    0x1.694fd7efaba21p-1,
+    0x1.6a71d152ab04ep-1,
+    0x1.6b93e27f13fa5p-1,
+    0x1.6cb60b74eaf96p-1,
+    0x1.6dd84c343478fp-1,
+    0x1.6efaa4bcf4effp-1,
+    0x1.701d150f30d15p-1,
+    0x1.713f9d2aec842p-1,
+    0x1.72623d102c775p-1,
+    0x1.7384f4bef512p-1,
+    0x1.74a7c4374ac33p-1,
+    0x1.75caab7931f1dp-1,
+    0x1.76edaa84af0cfp-1,
+    0x1.7810c159c6779p-1,
+    0x1.7933eff87c90ep-1,
+    0x1.7a573660d5b7ep-1,
+    0x1.7b7a9492d64bcp-1,
+    0x1.7c9e0a8e82abap-1,
+    0x1.7dc19853df36ap-1,
+    0x1.7ee53de2f047dp-1,
+    0x1.8008fb3bba2e7p-1,
+    0x1.812cd05e4141cp-1,
+    0x1.8250bd4a89d0ep-1,
+    0x1.8374c20098331p-1,
+    0x1.8498de8070b39p-1,
+    0x1.85bd12ca179dap-1,
+    0x1.86e15edd91486p-1,
+    0x1.8805c2bae1ff3p-1,
+    0x1.892a3e620e094p-1,
+    0x1.8a4ed1d319aap-1,
+    0x1.8b737d0e0918cp-1,
+    0x1.8c984012e098fp-1,
+    0x1.8dbd1ae1a46ddp-1,
+    0x1.8ee20d7a58cedp-1,
+    0x1.900717dd01fb5p-1,
+    0x1.912c3a09a42abp-1,
+    0x1.92517400439c6p-1,
+    0x1.9376c5c0e483dp-1,
+    0x1.949c2f4b8b107p-1,
+    0x1.95c1b0a03b71dp-1,
+    0x1.96e749bef9d76p-1,
+    0x1.980cfaa7ca70ap-1,
+    0x1.9932c35ab16d1p-1,
+    0x1.9a58a3d7b2fc2p-1,
+    0x1.9b7e9c1ed3496p-1,
+    0x1.9ca4ac3016746p-1,
+    0x1.9dcad40b80a4bp-1,
+    0x1.9ef113b115fap-1,
+    0x1.a0176b20da9bdp-1,
+    0x1.a13dda5ad2a5cp-1,
+    0x1.a264615f022f8p-1,
+    0x1.a38b002d6d50cp-1,
+    0x1.a4b1b6c618212p-1,
+    0x1.a5d8852906b86p-1,
+    0x1.a6ff6b563d2e2p-1,
+    0x1.a826694dbf9a1p-1,
+    0x1.a94d7f0f920ffp-1,
+    0x1.aa74ac9bb8978p-1,
+    0x1.ab9bf1f237409p-1,
+    0x1.acc34f131212dp-1,
+    0x1.adeac3fe4d1e1p-1,
+    0x1.af1250b3ec662p-1,
+    0x1.b039f533f3eaep-1,
+    0x1.b161b17e67ac3p-1,
+    0x1.b28985934ba9ep-1,
+    0x1.b3b17172a3e3ep-1,
+    0x1.b4d9751c7459fp-1,
+    0x1.b6019090c10cp-1,
+    0x1.b729c3cf8df9fp-1,
+    0x1.b8520ed8df1fbp-1,
+    0x1.b97a71acb86d3p-1,
+    0x1.baa2ec4b1dda6p-1,
+    0x1.bbcb7eb413574p-1,
+    0x1.bcf428e79cdbbp-1,
+    0x1.be1ceae5be53dp-1,
+    0x1.bf45c4ae7ba79p-1,
+    0x1.c06eb641d8bf2p-1,
+    0x1.c197bf9fd9827p-1,
+    0x1.c2c0e0c881d9ap-1,
+    0x1.c3ea19bbd5acbp-1,
+    0x1.c5136a79d8dfcp-1,
+    0x1.c63cd3028f4afp-1,
+    0x1.c7665355fcd26p-1,
+    0x1.c88feb74255a3p-1,
+    0x1.c9b99b5d0cba8p-1,
+    0x1.cae36310b6d37p-1,
+    0x1.cc0d428f27793p-1,
+    0x1.cd3739d8627c1p-1,
+    0x1.ce6148ec6bac4p-1,
+    0x1.cf8b6fcb46dap-1,
+    0x1.d0b5ae74f7d5ap-1,
+    0x1.d1e004e9826f5p-1,
+    0x1.d30a7328ea775p-1,
+    0x1.d434f93333bddp-1,
+    0x1.d55f9708620f2p-1,
+    0x1.d68a4ca8792bap-1,
+    0x1.d7b51a137cdbbp-1,
+    0x1.d8dfff4970dbap-1,
+    0x1.da0afc4a58e7dp-1,
+    0x1.db36111638c8ap-1,
+    0x1.dc613dad143a7p-1,
+    0x1.dd8c820eeef5bp-1,
+    0x1.deb7de3bccb2dp-1,
+    0x1.dfe35233b12a4p-1,
+    0x1.e10eddf6a0147p-1,
+    0x1.e23a81849d29cp-1,
+    0x1.e3663cddac1ecp-1,
+    0x1.e4921001d09bfp-1,
+    0x1.e5bdfaf10e51dp-1,
+    0x1.e6e9fdab68e8fp-1,
+    0x1.e8161830e411dp-1,
+    0x1.e9424a818371p-1,
+    0x1.ea6e949d4aab1p-1,
+    0x1.eb9af6843d709p-1,
+    0x1.ecc770365f661p-1,
+    0x1.edf401b3b42c3p-1,
+    0x1.ef20aafc3f639p-1,
+    0x1.f04d6c1004a8ep-1,
+    0x1.f17a44ef078cep-1,
+    0x1.f2a735994bac3p-1,
+    0x1.f3d43e0ed4a36p-1,
+    0x1.f5015e4fa6035p-1,
+    0x1.f62e965bc364ap-1,
+    0x1.f75be63330582p-1,
+    0x1.f8894dd5f0766p-1,
+    0x1.f9b6cd44074c5p-1,
+    0x1.fae4647d7862ap-1,
+    0x1.fc12138247423p-1,
+    0x1.fd3fda527773cp-1,
+    0x1.fe6db8ee0c803p-1,
+    0x1.ff9baf5509f04p-1,
+    0x1.0064dec3b9a66p+0,
+    0x1.00fbf1c2a60d5p+0,
+    0x1.019310a74be96p+0,
+    0x1.022a3b71acfbp+0,
+    0x1.02c17221cafeap+0,
+    0x1.0358b4b7a7b4bp+0,
+    0x1.03f0033344d7cp+0,
+    0x1.04875d94a4224p+0,
+    0x1.051ec3dbc754ap+0,
+    0x1.05b63608b0296p+0,
+    0x1.064db41b6059p+0,
+    0x1.06e53e13d99bfp+0,
+    0x1.077cd3f21da8cp+0,
+    0x1.081475b62e2ffp+0,
+    0x1.08ac23600ce82p+0,
+    0x1.0943dcefbb87dp+0,
+    0x1.09dba2653bbf8p+0,
+    0x1.0a7373c08f43cp+0,
+    0x1.0b0b5101b7c52p+0,
+    0x1.0ba33a28b6f82p+0,
+    0x1.0c3b2f358e8b6p+0,
+    0x1.0cd33028402b8p+0,
+    0x1.0d6b3d00cd85p+0,
+    0x1.0e0355bf38448p+0,
+    0x1.0e9b7a638216ap+0,
+    0x1.0f33aaedaca8p+0,
+    0x1.0fcbe75db9a52p+0,
+    0x1.10642fb3aab8bp+0,
+    0x1.10fc83ef81875p+0,
+    0x1.1194e4113fb9bp+0,
+    0x1.122d5018e6f46p+0,
+    0x1.12c5c80678e01p+0,
+    0x1.135e4bd9f7216p+0,
+    0x1.13f6db936360fp+0,
+    0x1.148f7732bf417p+0,
+    0x1.15281eb80c639p+0,
+    0x1.15c0d2234c68p+0,
+    0x1.1659917480ef7p+0,
+    0x1.16f25cabab9a9p+0,
+    0x1.178b33c8ce081p+0,
+    0x1.182416cbe9d0cp+0,
+    0x1.18bd05b500935p+0,
+    0x1.1956008413ee7p+0,
+    0x1.19ef0739257aep+0,
+    0x1.1a8819d436d56p+0,
+    0x1.1b2138554994ap+0,
+    0x1.1bba62bc5f4f7p+0,
+    0x1.1c53990979a29p+0,
+    0x1.1cecdb3c9a24cp+0,
+    0x1.1d862955c26acp+0,
+    0x1.1e1f8354f4096p+0,
+    0x1.1eb8e93a30957p+0,
+    0x1.1f525b0579a3bp+0,
+    0x1.1febd8b6d0c6fp+0,
+    0x1.2085624e378cp+0,
+    0x1.211ef7cbaf85cp+0,
+    0x1.21b8992f3a46fp+0,
+    0x1.22524678d95a6p+0,
+    0x1.22ebffa88e4bp+0,
+    0x1.2385c4be5aa99p+0,
+    0x1.241f95ba4001p+0,
+    0x1.24b9729c3fdc2p+0,
+    0x1.25535b645bcbdp+0,
+    0x1.25ed5012955aep+0,
+    0x1.268750a6ee103p+0,
+    0x1.27215d21676ccp+0,
+    0x1.27bb758202f77p+0,
+    0x1.285599c8c2392p+0,
+    0x1.28efc9f5a6b8bp+0,
+    0x1.298a0608b1f71p+0,
+    0x1.2a244e01e5793p+0,
+    0x1.2abea1e142cp+0,
+    0x1.2b5901a6cb507p+0,
+    0x1.2bf36d5280a96p+0,
+    0x1.2c8de4e46449dp+0,
+    0x1.2d28685c77b6bp+0,
+    0x1.2dc2f7babc6efp+0,
+    0x1.2e5d92ff33ef8p+0,
+    0x1.2ef83a29dfb56p+0,
+    0x1.2f92ed3ac13b8p+0,
+    0x1.302dac31d9f71p+0,
+    0x1.30c8770f2b62fp+0,
+    0x1.31634dd2b6fa2p+0,
+    0x1.31fe307c7e31bp+0,
+    0x1.32991f0c82829p+0,
+    0x1.33341982c561dp+0,
+    0x1.33cf1fdf48488p+0,
+    0x1.346a32220ca9ap+0,
+    0x1.3505504b13f84p+0,
+    0x1.35a07a5a5fad6p+0,
+    0x1.363bb04ff13c2p+0,
+    0x1.36d6f22bca157p+0,
+    0x1.37723fedeba88p+0,
+    0x1.380d9996575e6p+0,
+    0x1.38a8ff250ea63p+0,
+    0x1.3944709a12f1p+0,
+    0x1.39dfedf565adep+0,
+    0x1.3a7b77370845fp+0,
+    0x1.3b170c5efc266p+0,
+    0x1.3bb2ad6d42b83p+0,
+    0x1.3c4e5a61dd689p+0,
+    0x1.3cea133ccd9eap+0,
+    0x1.3d85d7fe14bf8p+0,
+    0x1.3e21a8a5b4306p+0,
+    0x1.3ebd8533ad567p+0,
+    0x1.3f596da80196dp+0,
+    0x1.3ff56202b256bp+0,
+    0x1.40916243c0fb4p+0,
+    0x1.412d6e6b2ee9ap+0,
+    0x1.41c98678fd86fp+0,
+    0x1.4265aa6d2e367p+0,
+    0x1.4301da47c2555p+0,
+    0x1.439e1608bb44cp+0,
+    0x1.443a5db01a62p+0,
+    0x1.44d6b13de10e4p+0,
+    0x1.457310b210a4cp+0,
+    0x1.460f7c0caa7ecp+0,
+    0x1.46abf34daff58p+0,
+    0x1.4748767522624p+0,
+    0x1.47e50583031e4p+0,
+    0x1.4881a0775382cp+0,
+    0x1.491e475214e91p+0,
+    0x1.49bafa1348aa6p+0,
+    0x1.4a57b8baf02p+0,
+    0x1.4af483490ca13p+0,
+    0x1.4b9159bd9f7f4p+0,
+    0x1.4c2e3c18aa0f8p+0,
+    0x1.4ccb2a5a2da34p+0,
+    0x1.4d6824822b8fcp+0,
+    0x1.4e052a90a5246p+0,
+    0x1.4ea23c859bae8p+0,
+    0x1.4f3f5a61107d6p+0,
+    0x1.4fdc842304e66p+0,
+    0x1.5079b9cb7a38cp+0,
+    0x1.5116fb5a71c1fp+0,
+    0x1.51b448cfeccd4p+0,
+    0x1.5251a22beca03p+0,
+    0x1.52ef076e7286p+0,
+    0x1.538c78977fcc1p+0,
+    0x1.5429f5a715bdcp+0,
+    0x1.54c77e9d35a09p+0,
+    0x1.55651379e0bddp+0,
+    0x1.5602b43d1858ep+0,
+    0x1.56a060e6ddb54p+0,
+    0x1.573e1977321c6p+0,
+    0x1.57dbddee16d19p+0,
+    0x1.5879ae4b8d165p+0,
+    0x1.59178a8f962c1p+0,
+    0x1.59b572ba33545p+0,
+    0x1.5a5366cb65d06p+0,
+    0x1.5af166c32ee1dp+0,
+    0x1.5b8f72a18fca1p+0,
+    0x1.5c2d8a6689c89p+0,
+    0x1.5ccbae121e16dp+0,
+    0x1.5d69dda44df45p+0,
+    0x1.5e08191d1aa08p+0,
+    0x1.5ea6607c8552ep+0,
+    0x1.5f44b3c28f43p+0,
+    0x1.5fe312ef39ae5p+0,
+    0x1.60817e0285cc6p+0,
+    0x1.611ff4fc74d2cp+0,
+    0x1.61be77dd07f6fp+0,
+    0x1.625d06a4406e7p+0,
+    0x1.62fba1521f6eep+0,
+    0x1.639a47e6a62dcp+0,
+    0x1.6438fa61d5e09p+0,
+    0x1.64d7b8c3afbcfp+0,
+    0x1.6576830c34f86p+0,
+    0x1.6615593b66c67p+0,
+    0x1.66b43b514654bp+0,
+    0x1.6753294dd4d4cp+0,
+    0x1.67f2233113743p+0,
+    0x1.689128fb03649p+0,
+    0x1.69303aaba5d19p+0,
+    0x1.69cf5842fbe4cp+0,
+    0x1.6a6e81c106c9dp+0,
+    0x1.6b0db725c7b25p+0,
+    0x1.6bacf8713fc9dp+0,
+    0x1.6c4c45a3703ap+0,
+    0x1.6ceb9ebc5a2a8p+0,
+    0x1.6d8b03bbfebdp+0,
+    0x1.6e2a74a25f193p+0,
+    0x1.6ec9f16f7c68bp+0,
+    0x1.6f697a2357d32p+0,
+    0x1.70090ebdf27a4p+0,
+    0x1.70a8af3f4d83ap+0,
+    0x1.71485ba76a111p+0,
+    0x1.71e813f649483p+0,
+    0x1.7287d82bec48bp+0,
+    0x1.7327a84854306p+0,
+    0x1.73c7844b821eep+0,
+    0x1.74676c357739ep+0,
+    0x1.7507600634a12p+0,
+    0x1.75a75fbdbb725p+0,
+    0x1.76476b5c0ccb2p+0,
+    0x1.76e782e129c76p+0,
+    0x1.7787a64d137cep+0,
+    0x1.7827d59fcb076p+0,
+    0x1.78c810d951829p+0,
+    0x1.796857f9a8044p+0,
+    0x1.7a08ab00cfa83p+0,
+    0x1.7aa909eec98a2p+0,
+    0x1.7b4974c396bdep+0,
+    0x1.7be9eb7f38574p+0,
+    0x1.7c8a6e21af7p+0,
+    0x1.7d2afcaafd1bfp+0,
+    0x1.7dcb971b226cep+0,
+    0x1.7e6c3d722074ap+0,
+    0x1.7f0cefaff845p+0,
+    0x1.7fadadd4aaefep+0,
+    0x1.804e77e039872p+0,
+    0x1.80ef4dd2a51c7p+0,
+    0x1.81902fabeebfcp+0,
+    0x1.82311d6c177aep+0,
+    0x1.82d21713205dcp+0,
+    0x1.83731ca10a783p+0,
+    0x1.84142e15d6d4p+0,
+    0x1.84b54b71867f2p+0,
+    0x1.855674b41a817p+0,
+    0x1.85f7a9dd93e2dp+0,
+    0x1.8698eaedf3b12p+0,
+    0x1.873a37e53af44p+0,
+    0x1.87db90c36ab23p+0,
+    0x1.887cf58883f0dp+0,
+    0x1.891e663487b6p+0,
+    0x1.89bfe2c77707cp+0,
+    0x1.8a616b4152ebfp+0,
+    0x1.8b02ffa21c687p+0,
+    0x1.8ba49fe9d4814p+0,
+    0x1.8c464c187c346p+0,
+    0x1.8ce8042e1483bp+0,
+    0x1.8d89c82a9e6d3p+0,
+    0x1.8e2b980e1af2ep+0,
+    0x1.8ecd73d88b12cp+0,
+    0x1.8f6f5b89efceap+0,
+    0x1.90114f224a22ap+0,
+    0x1.90b34ea19b0abp+0,
+    0x1.91555a07e388dp+0,
+    0x1.91f771552499p+0,
+    0x1.929994895f353p+0,
+    0x1.933bc3a494577p+0,
+    0x1.93ddfea6c4f9cp+0,
+    0x1.9480458ff2163p+0,
+    0x1.952298601ca4cp+0,
+    0x1.95c4f71745978p+0,
+    0x1.966761b56de67p+0,
+    0x1.9709d83a9689bp+0,
+    0x1.97ac5aa6c0733p+0,
+    0x1.984ee8f9ec992p+0,
+    0x1.98f183341bed8p+0,
+    0x1.999429554f666p+0,
+    0x1.9a36db5d87f3ep+0,
+    0x1.9ad9994cc6841p+0,
+    0x1.9b7c63230c07p+0,
+    0x1.9c1f38e05972dp+0,
+    0x1.9cc21a84afb78p+0,
+    0x1.9d6508100fc34p+0,
+    0x1.9e0801827a842p+0,
+    0x1.9eab06dbf0e64p+0,
+    0x1.9f4e181c73cfep+0,
+    0x1.9ff13544042dp+0,
+    0x1.a0945e52a2ebdp+0,
+    0x1.a137934850f87p+0,
+    0x1.a1dad4250f391p+0,
+    0x1.a27e20e8de97cp+0,
+    0x1.a3217993bffabp+0,
+    0x1.a3c4de25b44c1p+0,
+    0x1.a4684e9ebc701p+0,
+    0x1.a50bcafed94adp+0,
+    0x1.a5af53460bc69p+0,
+    0x1.a652e77454c76p+0,
+    0x1.a6f68789b52f9p+0,
+    0x1.a79a33862de13p+0,
+    0x1.a83deb69bfbe9p+0,
+    0x1.a8e1af346ba9fp+0,
+    0x1.a9857ee632856p+0,
+    0x1.aa295a7f15313p+0,
+    0x1.aacd41ff14879p+0,
+    0x1.ab7135663168dp+0,
+    0x1.ac1534b46cb52p+0,
+    0x1.acb93fe9c746cp+0,
+    0x1.ad5d570641fbfp+0,
+    0x1.ae017a09ddaefp+0,
+    0x1.aea5a8f49b3ep+0,
+    0x1.af49e3c67b816p+0,
+    0x1.afee2a7f7f4f5p+0,
+    0x1.b0927d1fa7804p+0,
+    0x1.b136dba6f4f24p+0,
+    0x1.b1db4615687dcp+0,
+    0x1.b27fbc6b02f8fp+0,
+    0x1.b3243ea7c53a3p+0,
+    0x1.b3c8cccbb017cp+0,
+    0x1.b46d66d6c465fp+0,
+    0x1.b5120cc902f32p+0,
+    0x1.b5b6bea26c93ap+0,
+    0x1.b65b7c63021dbp+0,
+    0x1.b700460ac465bp+0,
+    0x1.b7a51b99b43ap+0,
+    0x1.b849fd0fd26cep+0,
+    0x1.b8eeea6d1fccbp+0,
+    0x1.b993e3b19d2bdp+0,
+    0x1.ba38e8dd4b56ap+0,
+    0x1.baddf9f02b178p+0,
+    0x1.bb8316ea3d3adp+0,
+    0x1.bc283fcb8292ep+0,
+    0x1.bccd7493fbec2p+0,
+    0x1.bd72b543aa10ep+0,
+    0x1.be1801da8dcb9p+0,
+    0x1.bebd5a58a7e69p+0,
+    0x1.bf62bebdf92a5p+0,
+    0x1.c0082f0a82593p+0,
+    0x1.c0adab3e443bbp+0,
+    0x1.c15333593f9c3p+0,
+    0x1.c1f8c75b75431p+0,
+    0x1.c29e6744e5f2dp+0,
+    0x1.c34413159271dp+0,
+    0x1.c3e9cacd7b829p+0,
+    0x1.c48f8e6ca1eb7p+0,
+    0x1.c5355df3066cfp+0,
+    0x1.c5db3960a9c78p+0,
+    0x1.c68120b58cc19p+0,
+    0x1.c72713f1b01bap+0,
+    0x1.c7cd131514943p+0,
+    0x1.c8731e1fbae9bp+0,
+    0x1.c9193511a3da9p+0,
+    0x1.c9bf57ead0256p+0,
+    0x1.ca6586ab4088ap+0,
+    0x1.cb0bc152f5c2cp+0,
+    0x1.cbb207e1f0925p+0,
+    0x1.cc585a5831b3cp+0,
+    0x1.ccfeb8b5b9ddap+0,
+    0x1.cda522fa89cc6p+0,
+    0x1.ce4b9926a23cap+0,
+    0x1.cef21b3a03e4ep+0,
+    0x1.cf98a934af7fap+0,
+    0x1.d03f4316a5c17p+0,
+    0x1.d0e5e8dfe75eep+0,
+    0x1.d18c9a9075128p+0,
+    0x1.d23358284f90ep+0,
+    0x1.d2da21a7778c9p+0,
+    0x1.d380f70dedb81p+0,
+    0x1.d427d85bb2c61p+0,
+    0x1.d4cec590c7692p+0,
+    0x1.d575bead2c53dp+0,
+    0x1.d61cc3b0e238cp+0,
+    0x1.d6c3d49be9ca8p+0,
+    0x1.d76af16e43bb9p+0,
+    0x1.d8121a27f0beap+0,
+    0x1.d8b94ec8f1844p+0,
+    0x1.d9608f5146b71p+0,
+    0x1.da07dbc0f105bp+0,
+    0x1.daaf3417f11acp+0,
+    0x1.db56985647a4ep+0,
+    0x1.dbfe087bf54ebp+0,
+    0x1.dca58488fac6dp+0,
+    0x1.dd4d0c7d58b5fp+0,
+    0x1.ddf4a0590fc4bp+0,
+    0x1.de9c401c20a1bp+0,
+    0x1.df43ebc68bf5ap+0,
+    0x1.dfeba35852672p+0,
+    0x1.e09366d1749cfp+0,
+    0x1.e13b3631f33dbp+0,
+    0x1.e1e31179cefp+0,
+    0x1.e28af8a9085aap+0,
+    0x1.e332ebbfa0243p+0,
+    0x1.e3daeabd96f17p+0,
+    0x1.e482f5a2ed612p+0,
+    0x1.e52b0c6fa417ep+0,
+    0x1.e5d32f23bbba7p+0,
+    0x1.e67b5dbf34e78p+0,
+    0x1.e72398421041cp+0,
+    0x1.e7cbdeac4e68p+0,
+    0x1.e87430fdeffcfp+0,
+    0x1.e91c8f36f59f4p+0,
+    0x1.e9c4f9575ff1cp+0,
+    0x1.ea6d6f5f2f911p+0,
+    0x1.eb15f14e65181p+0,
+    0x1.ebbe7f2501217p+0,
+    0x1.ec6718e30448p+0,
+    0x1.ed0fbe886f268p+0,
+    0x1.edb870154257cp+0,
+    0x1.ee612d897e768p+0,
+    0x1.ef09f6e5241d8p+0,
+    0x1.efb2cc2833e79p+0,
+    0x1.f05bad52ae6f6p+0,
+    0x1.f1049a64944fdp+0,
+    0x1.f1ad935de621ap+0,
+    0x1.f256983ea4779p+0,
+    0x1.f2ffa906cfe89p+0,
+    0x1.f3a8c5b669076p+0,
+    0x1.f451ee4d706adp+0,
+    0x1.f4fb22cbe6a5cp+0,
+    0x1.f5a46331cc4efp+0,
+    0x1.f64daf7f21f94p+0,
+    0x1.f6f707b3e83b7p+0,
+    0x1.f7a06bd01fa66p+0,
+    0x1.f849dbd3c8c8fp+0,
+    0x1.f8f357bee432p+0,
+    0x1.f99cdf9172706p+0,
+    0x1.fa46734b7413p+0,
+    0x1.faf012ece9a8bp+0,
+    0x1.fb99be75d3c05p+0,
+    0x1.fc4375e632e8bp+0,
+    0x1.fced393e07b0cp+0,
+    0x1.fd97087d52a76p+0,
+    0x1.fe40e3a414596p+0,
+    0x1.feeacab24d4dcp+0,
+    0x1.ff94bda7fe116p+0,
+    0x1.001f5e4293989p+1,
+    0x1.007463a4e499fp+1,
+    0x1.00c96efaf2524p+1,
+    0x1.011e8044bd05p+1,
+    0x1.0173978244f7bp+1,
+    0x1.01c8b4b38a6cbp+1,
+    0x1.021dd7d88da68p+1,
+    0x1.027300f14eeaap+1,
+    0x1.02c82ffdce7b8p+1,
+    0x1.031d64fe0c9a8p+1,
+    0x1.03729ff209894p+1,
+    0x1.03c7e0d9c5893p+1,
+    0x1.041d27b540dbdp+1,
+    0x1.047274847bc29p+1,
+    0x1.04c7c747767efp+1,
+    0x1.051d1ffe31526p+1,
+    0x1.05727ea8ac7e6p+1,
+    0x1.05c7e346e8437p+1,
+    0x1.061d4dd8e4df1p+1,
+    0x1.0672be5ea291dp+1,
+    0x1.06c834d8219c2p+1,
+    0x1.071db145623b8p+1,
+    0x1.077333a664af7p+1,
+    0x1.07c8bbfb29357p+1,
+    0x1.081e4a43b00dp+1,
+    0x1.0873de7ff973ap+1,
+    0x1.08c978b005a8dp+1,
+    0x1.091f18d3d4e91p+1,
+    0x1.0974beeb677p+1,
+    0x1.09ca6af6bd7a1p+1,
+    0x1.0a201cf5d746cp+1,
+    0x1.0a75d4e8b512ap+1,
+    0x1.0acb92cf57192p+1,
+    0x1.0b2156a9bd95dp+1,
+    0x1.0b772077e8c45p+1,
+    0x1.0bccf039d8e01p+1,
+    0x1.0c22c5ef8e249p+1,
+    0x1.0c78a19908cc6p+1,
+    0x1.0cce8336490f2p+1,
+    0x1.0d246ac74f274p+1,
+    0x1.0d7a584c1b505p+1,
+    0x1.0dd04bc4adc4ep+1,
+    0x1.0e26453106bc7p+1,
+    0x1.0e7c449126709p+1,
+    0x1.0ed249e50d18ep+1,
+    0x1.0f28552cbaeeep+1,
+    0x1.0f7e6668302a2p+1,
+    0x1.0fd47d976d042p+1,
+    0x1.102a9aba71b38p+1,
+    0x1.1080bdd13e6ecp+1,
+    0x1.10d6e6dbd36f7p+1,
+    0x1.112d15da30ec3p+1,
+    0x1.11834acc571a9p+1,
+    0x1.11d985b246301p+1,
+    0x1.122fc68bfe626p+1,
+    0x1.12860d597fe6fp+1,
+    0x1.12dc5a1acaf37p+1,
+    0x1.1332accfdfbd7p+1,
+    0x1.13890578be7a7p+1,
+    0x1.13df641567602p+1,
+    0x1.1435c8a5daa3fp+1,
+    0x1.148c332a187a9p+1,
+    0x1.14e2a3a221159p+1,
+    0x1.15391a0df4a99p+1,
+    0x1.158f966d936b1p+1,
+    0x1.15e618c0fd8bbp+1,
+    0x1.163ca108333f2p+1,
+    0x1.16932f4334b6ep+1,
+    0x1.16e9c37202269p+1,
+    0x1.17405d949bbfcp+1,
+    0x1.1796fdab01b62p+1,
+    0x1.17eda3b5343a4p+1,
+    0x1.18444fb3337ccp+1,
+    0x1.189b01a4ffb13p+1,
+    0x1.18f1b98a99083p+1,
+    0x1.19487763ffb15p+1,
+    0x1.199f3b3133dc4p+1,
+    0x1.19f604f235b8ap+1,
+    0x1.1a4cd4a705761p+1,
+    0x1.1aa3aa4fa3443p+1,
+    0x1.1afa85ec0f52ap+1,
+    0x1.1b51677c49d0fp+1,
+    0x1.1ba84f0052eedp+1,
+    0x1.1bff3c782adbep+1,
+    0x1.1c562fe3d1c6bp+1,
+    0x1.1cad294347dbp+1,
+    0x1.1d0428968d476p+1,
+    0x1.1d5b2ddda23a7p+1,
+    0x1.1db2391886dfep+1,
+    0x1.1e094a473b655p+1,
+    0x1.1e606169bff66p+1,
+    0x1.1eb77e8014c0bp+1,
+    0x1.1f0ea18a39fp+1,
+    0x1.1f65ca882fb1ep+1,
+    0x1.1fbcf979f631fp+1,
+    0x1.20142e5f8d9dep+1,
+    0x1.206b6938f6205p+1,
+    0x1.20c2aa062fe3p+1,
+    0x1.2119f0c73b108p+1,
+    0x1.21713d7c17d68p+1,
+    0x1.21c89024c65fap+1,
+    0x1.221fe8c146d5ap+1,
+    0x1.2277475199622p+1,
+    0x1.22ceabd5be2ecp+1,
+    0x1.2326164db5654p+1,
+    0x1.237d86b97f2f3p+1,
+    0x1.23d4fd191bb65p+1,
+    0x1.242c796c8b235p+1,
+    0x1.2483fbb3cd9bep+1,
+    0x1.24db83eee348ap+1,
+    0x1.2533121dcc534p+1,
+    0x1.258aa64088e47p+1,
+    0x1.25e240571921ep+1,
+    0x1.2639e0617d335p+1,
+    0x1.2691865fb53e6p+1,
+    0x1.26e93251c16bdp+1,
+    0x1.2740e437a1e43p+1,
+    0x1.27989c1156cc5p+1,
+    0x1.27f059dee048ep+1,
+    0x1.28481da03e818p+1,
+    0x1.289fe755719bp+1,
+    0x1.28f7b6fe79b9fp+1,
+    0x1.294f8c9b57062p+1,
+    0x1.29a7682c09a44p+1,
+    0x1.29ff49b091b8p+1,
+    0x1.2a573128ef652p+1,
+    0x1.2aaf1e9522d05p+1,
+    0x1.2b0711f52c213p+1,
+    0x1.2b5f0b490b7c9p+1,
+    0x1.2bb70a90c1062p+1,
+    0x1.2c0f0fcc4ce18p+1,
+    0x1.2c671afbaf318p+1,
+    0x1.2cbf2c1ee815ep+1,
+    0x1.2d174335f7b15p+1,
+    0x1.2d6f6040de279p+1,
+    0x1.2dc7833f9b9c5p+1,
+    0x1.2e1fac3230325p+1,
+    0x1.2e77db189c094p+1,
+    0x1.2ed00ff2df43fp+1,
+    0x1.2f284ac0fa051p+1,
+    0x1.2f808b82ec6c6p+1,
+    0x1.2fd8d238b69c9p+1,
+    0x1.30311ee258b86p+1,
+    0x1.3089717fd2de9p+1,
+    0x1.30e1ca11252dep+1,
+    0x1.313a28964fc81p+1,
+    0x1.31928d0f52ccep+1,
+    0x1.31eaf77c2e5e1p+1,
+    0x1.324367dce29a5p+1,
+    0x1.329bde316fa07p+1,
+    0x1.32f45a79d5923p+1,
+    0x1.334cdcb6148e4p+1,
+    0x1.33a564e62cb27p+1,
+    0x1.33fdf30a1e1c8p+1,
+    0x1.34568721e8ea3p+1,
+    0x1.34af212d8d395p+1,
+    0x1.3507c12d0b27ap+1,
+    0x1.3560672062d2ep+1,
+    0x1.35b913079458dp+1,
+    0x1.3611c4e29fd73p+1,
+    0x1.366a7cb1856bcp+1,
+    0x1.36c33a7445345p+1,
+    0x1.371bfe2adf4eap+1,
+    0x1.3774c7d553d78p+1,
+    0x1.37cd9773a2e8bp+1,
+    0x1.38266d05cc9efp+1,
+    0x1.387f488bd118p+1,
+    0x1.38d82a05b070bp+1,
+    0x1.393111736ac2dp+1,
+    0x1.3989fed5002a2p+1,
+    0x1.39e2f22a70c07p+1,
+    0x1.3a3beb73bca19p+1,
+    0x1.3a94eab0e3e73p+1,
+    0x1.3aedefe1e6ad3p+1,
+    0x1.3b46fb06c50d6p+1,
+    0x1.3ba00c1f7f237p+1,
+    0x1.3bf9232c15083p+1,
+    0x1.3c52402c86d48p+1,
+    0x1.3cab6320d4a42p+1,
+    0x1.3d048c08fe8fdp+1,
+    0x1.3d5dbae504b07p+1,
+    0x1.3db6efb4e721cp+1,
+    0x1.3e102a78a5fc8p+1,
+    0x1.3e696b304158ap+1,
+    0x1.3ec2b1dbb94ddp+1,
+    0x1.3f1bfe7b0df3fp+1,
+    0x1.3f75510e3f62dp+1,
+    0x1.3fcea9954db24p+1,
+    0x1.4028081038fap+1,
+    0x1.40816c7f0151fp+1,
+    0x1.40dad6e1a6d1dp+1,
+    0x1.4134473829919p+1,
+    0x1.418dbd8289a8ep+1,
+    0x1.41e739c0c72eap+1,
+    0x1.4240bbf2e236ap+1,
+    0x1.429a4418dad7bp+1,
+    0x1.42f3d232b129bp+1,
+    0x1.434d664065435p+1,
+    0x1.43a70041f7388p+1,
+    0x1.4400a03767201p+1,
+    0x1.445a4620b510dp+1,
+    0x1.44b3f1fde11eap+1,
+    0x1.450da3ceeb5f4p+1,
+    0x1.45675b93d3e6ap+1,
+    0x1.45c1194c9aca8p+1,
+    0x1.461adcf9401edp+1,
+    0x1.4674a699c3f94p+1,
+    0x1.46ce762e266dcp+1,
+    0x1.47284bb667921p+1,
+    0x1.4782273287792p+1,
+    0x1.47dc08a28635cp+1,
+    0x1.4835f00663dddp+1,
+    0x1.488fdd5e20842p+1,
+    0x1.48e9d0a9bc3a7p+1,
+    0x1.4943c9e93712cp+1,
+    0x1.499dc91c911fep+1,
+    0x1.49f7ce43ca77bp+1,
+    0x1.4a51d95ee32cfp+1,
+    0x1.4aabea6ddb518p+1,
+    0x1.4b060170b2f74p+1,
+    0x1.4b601e676a302p+1,
+    0x1.4bba4152010dep+1,
+    0x1.4c146a3077a27p+1,
+    0x1.4c6e9902cdffap+1,
+    0x1.4cc8cdc904375p+1,
+    0x1.4d2308831a5b5p+1,
+    0x1.4d7d4931107d8p+1,
+    0x1.4dd78fd2e6aedp+1,
+    0x1.4e31dc689cfd1p+1,
+    0x1.4e8c2ef233792p+1,
+    0x1.4ee6876faa34ep+1,
+    0x1.4f40e5e101413p+1,
+    0x1.4f9b4a4638abfp+1,
+    0x1.4ff5b49f5086p+1,
+    0x1.505024ec48e04p+1,
+    0x1.50aa9b2d21c89p+1,
+    0x1.51051761db4fdp+1,
+    0x1.515f998a7586ep+1,
+    0x1.51ba21a6f07bap+1,
+    0x1.5214afb74c3dfp+1,
+    0x1.526f43bb88dbbp+1,
+    0x1.52c9ddb3a664cp+1,
+    0x1.53247d9fa4e7p+1,
+    0x1.537f237f84726p+1,
+    0x1.53d9cf534513cp+1,
+    0x1.5434811ae6d8p+1,
+    0x1.548f38d669cfp+1,
+    0x1.54e9f685ce05ap+1,
+    0x1.5544ba291388dp+1,
+    0x1.559f83c03a687p+1,
+    0x1.55fa534b42b16p+1,
+    0x1.565528ca2c6f9p+1,
+    0x1.56b0043cf7afep+1,
+    0x1.570ae5a3a4823p+1,
+    0x1.5765ccfe32f36p+1,
+    0x1.57c0ba4ca30f6p+1,
+    0x1.581bad8ef4e21p+1,
+    0x1.5876a6c528777p+1,
+    0x1.58d1a5ef3ddb5p+1,
+    0x1.592cab0d35199p+1,
+    0x1.5987b61f0e3e2p+1,
+    0x1.59e2c724c955p+1,
+    0x1.5a3dde1e666ap+1,
+    0x1.5a98fb0be589p+1,
+    0x1.5af41ded46bdfp+1,
+    0x1.5b4f46c28a14dp+1,
+    0x1.5baa758baf997p+1,
+    0x1.5c05aa48b757bp+1,
+    0x1.5c60e4f9a15b8p+1,
+    0x1.5cbc259e6dafdp+1,
+    0x1.5d176c371c5c9p+1,
+    0x1.5d72b8c3ad6cap+1,
+    0x1.5dce0b4420ebfp+1,
+    0x1.5e2963b876e56p+1,
+    0x1.5e84c220af60fp+1,
+    0x1.5ee0267cca698p+1,
+    0x1.5f3b90ccc80ap+1,
+    0x1.5f970110a84a6p+1,
+    0x1.5ff277486b358p+1,
+    0x1.604df37410d64p+1,
+    0x1.60a975939934bp+1,
+    0x1.6104fda7045aap+1,
+    0x1.61608bae52501p+1,
+    0x1.61bc1fa9831eep+1,
+    0x1.6217b99896cfp+1,
+    0x1.6273597b8d6a7p+1,
+    0x1.62ceff5266f9p+1,
+    0x1.632aab1d2384cp+1,
+    0x1.63865cdbc3158p+1,
+    0x1.63e2148e45b54p+1,
+    0x1.643dd234ab6aep+1,
+    0x1.649995cef43d7p+1,
+    0x1.64f55f5d2036cp+1,
+    0x1.65512edf2f5ddp+1,
+    0x1.65ad045521b98p+1,
+    0x1.6608dfbef753dp+1,
+    0x1.6664c11cb033ap+1,
+    0x1.66c0a86e4c5efp+1,
+    0x1.671c95b3cbdcbp+1,
+    0x1.677888ed2eb6dp+1,
+    0x1.67d4821a74f44p+1,
+    0x1.6830813b9e9afp+1,
+    0x1.688c8650abb0ep+1,
+    0x1.68e891599c3bfp+1,
+    0x1.6944a25670422p+1,
+    0x1.69a0b94727ca5p+1,
+    0x1.69fcd62bc2de9p+1,
+    0x1.6a58f9044185bp+1,
+    0x1.6ab521d0a3c5bp+1,
+    0x1.6b115090e9a49p+1,
+    0x1.6b6d854513283p+1,
+    0x1.6bc9bfed20569p+1,
+    0x1.6c26008911359p+1,
+    0x1.6c824718e5cb4p+1,
+    0x1.6cde939c9e1d9p+1,
+    0x1.6d3ae6143a316p+1,
+    0x1.6d973e7fba08bp+1,
+    0x1.6df39cdf1da89p+1,
+    0x1.6e5001326516dp+1,
+    0x1.6eac6b7990598p+1,
+    0x1.6f08dbb49f769p+1,
+    0x1.6f6551e39273fp+1,
+    0x1.6fc1ce0669569p+1,
+    0x1.701e501d24207p+1,
+    0x1.707ad827c2d69p+1,
+    0x1.70d76626457edp+1,
+    0x1.7133fa18ac1e4p+1,
+    0x1.719093fef6b6dp+1,
+    0x1.71ed33d9254d6p+1,
+    0x1.7249d9a737e8p+1,
+    0x1.72a685692e8bap+1,
+    0x1.7303371f093a4p+1,
+    0x1.735feec8c7f8cp+1,
+    0x1.73bcac666acc2p+1,
+    0x1.74196ff7f1b66p+1,
+    0x1.7476397d5cbb8p+1,
+    0x1.74d308f6abdd8p+1,
+    0x1.752fde63df214p+1,
+    0x1.758cb9c4f68bcp+1,
+    0x1.75e99b19f21fp+1,
+    0x1.76468262d1defp+1,
+    0x1.76a36f9f95cd8p+1,
+    0x1.770062d03deecp+1,
+    0x1.775d5bf4ca44ap+1,
+    0x1.77ba5b0d3ad32p+1,
+    0x1.781760198f9c4p+1,
+    0x1.78746b19c8a3ep+1,
+    0x1.78d17c0de5ec1p+1,
+    0x1.792e92f5e778cp+1,
+    0x1.798bafd1cd4cp+1,
+    0x1.79e8d2a19769bp+1,
+    0x1.7a45fb6545d2ep+1,
+    0x1.7aa32a1cd8888p+1,
+    0x1.7b005ec84f8e8p+1,
+    0x1.7b5d9967aae6ep+1,
+    0x1.7bbad9faea95bp+1,
+    0x1.7c1820820e9bdp+1,
+    0x1.7c756cfd16f95p+1,
+    0x1.7cd2bf6c03ae3p+1,
+    0x1.7d3017ced4ba7p+1,
+    0x1.7d8d76258a1e1p+1,
+};
+
+} // namespace CmosTable
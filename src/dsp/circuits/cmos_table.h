@@ -0,0 +1,21 @@
+#pragma once
+
+#include "cmos_model.h"
+#include <cstddef>
+
+// Tables of CmosModel::waveshaper, defined in cmos_table.cpp, which
+// tools/generate_cmos_table.cpp writes and which is checked in.
+namespace CmosTable
+{
+// Piecewise minimax cubics in the layout of PiecewisePolynomial::Table.
+// CMOS does not use them yet, orbital-bench times them against its table.
+extern const size_t num_cells;
+extern const float cells[];
+extern const float subcells[];
+
+// The curve at CmosModel::tableInput(i) with its first and second
+// antiderivatives (see AntiderivativeTable::integrate), for ADAA
+extern const float values[CmosModel::table_size];
+extern const double f1[CmosModel::table_size];
+extern const double f2[CmosModel::table_size];
+} // namespace CmosTable
@@ -1,9 +1,9 @@
 #pragma once
-#include "../maths/omega.h"
+#include "memoryless_circuit.h"
 #include <cmath>
 #include <juce_dsp/juce_dsp.h>
 
-class GermaniumDiode
+class GermaniumDiode : public MemorylessCircuit<GermaniumDiode>
 // Simulates a germanium diode clipper pair using the Shockley diode equation
 // for more referernce about this modelization, you can read about it in
 // the paper:
@@ -12,19 +12,21 @@ class GermaniumDiode
 // (2019.)
 // "FAST APPROXIMATION OF THE LAMBERT W FUNCTION FOR VIRTUAL ANALOG MODELLING"
 // https://dafx.de/paper-archive/2019/DAFx2019_paper_5.pdf
+//
+// With the bilinear integrator k6 = b1 - a1 * b0 is zero, so the capacitor
+// state never leaves zero and the clipper is a static curve of its input.
+// CircuitAntiderivatives tabulates that curve for ADAA.
 {
   public:
-    GermaniumDiode(float fs);
-    float processSample(float);
-    void process(const juce::dsp::ProcessContextReplacing<float>& context);
-    float omega(float);
-    void reset(float t_fs)
+    GermaniumDiode(float fs = 44100.0f);
+    void prepare(float fs);
+    void reset()
     {
-        fs = t_fs;
-        prev_v = 0.0f;
-        prev_p = k6 * prev_v;
     }
 
+    template <typename B>
+    typename B::Float processBatch(typename B::Float vin) const;
+
   private:
     // Fixed variables
     float c = 1e-8f;
@@ -33,10 +35,6 @@ class GermaniumDiode
     float v_t = 0.02585f;
     float v0 = 0.36694194229685273f;
 
-    // State variables
-    float prev_v;
-    float prev_p;
-
     // Main parameters
     float fs;
 
@@ -54,27 +52,12 @@ class GermaniumDiode
     float k6;
 };
 
-inline float GermaniumDiode::omega(float x)
+inline GermaniumDiode::GermaniumDiode(float t_fs)
 {
-    if (std::abs(x) > 1.5f)
-    {
-        return omega4(x);
-    }
-    else
-    {
-        float c0 = 0.5671432904097838f;
-        float c1 = 0.3618963236098023f;
-        float c2 = 0.0736778463779836f;
-        float c3 = -0.0013437346889135f;
-        float c4 = -0.0016355437889344f;
-        float c5 = 0.0002166542734346f;
-
-        return c0 + c1 * x + c2 * std::pow(x, 2.0f) + c3 * std::pow(x, 3.0f) +
-               c4 * std::pow(x, 4.0f) + c5 * std::pow(x, 5.0f);
-    }
+    prepare(t_fs);
 }
 
-inline GermaniumDiode::GermaniumDiode(float t_fs)
+inline void GermaniumDiode::prepare(float t_fs)
 {
     fs = t_fs;
 
@@ -87,42 +70,22 @@ inline GermaniumDiode::GermaniumDiode(float t_fs)
     k2 = (c * r) / crb_1;
     k3 = (i_s * r) / crb_1;
     k4 = 1 / v_t;
-    k5 = std::log((i_s * r) / crb_1 * v_t);
+    k5 = std::log((i_s * r) / (crb_1 * v_t));
     k6 = b1 - a1 * b0;
-
-    prev_v = 0.0f;
-    prev_p = k6 * prev_v;
+    jassert(k6 == 0.0f);
 }
 
-inline float GermaniumDiode::processSample(float vin)
+template <typename B>
+inline typename B::Float GermaniumDiode::processBatch(
+    typename B::Float vin
+) const
 {
-    if (std::abs(vin) < 0.1f)
-    {
-        float p = k6 * vin - a1 * prev_p;
-        prev_p = p;
-        prev_v = vin;
-        return vin;
-    }
-    float q = k1 * vin - prev_p;
-    float rt = (q > 0.0f) ? 1.0f : ((q < 0.0f) ? -1.0f : 0.0f); // sign function
-    float w = k2 * q + k3 * rt;
-    float vout = w - v_t * rt * omega(k4 * rt * w + k5);
-    float p = k6 * vout - a1 * prev_p;
-    prev_p = p;
-    prev_v = vout;
-    return vout / v0;
-}
-
-inline void GermaniumDiode::process(
-    const juce::dsp::ProcessContextReplacing<float>& context
-)
-{
-    auto& block = context.getOutputBlock();
-    const size_t num_samples = block.getNumSamples();
-
-    auto* ch = block.getChannelPointer(0);
-    for (size_t i = 0; i < num_samples; ++i)
-    {
-        ch[i] = processSample(ch[i]);
-    }
+    auto q = B::mul(B::set(k1), vin);
+    auto rt = FastMath::sign<B>(q);
+    auto w = B::add(B::mul(B::set(k2), q), B::mul(B::set(k3), rt));
+    auto x = B::add(B::mul(B::mul(B::set(k4), rt), w), B::set(k5));
+    auto vout = B::sub(
+        w, B::mul(B::mul(B::set(v_t), rt), FastMath::wrightOmega<B>(x))
+    );
+    return B::div(vout, B::set(v0));
 }
@@ -1,10 +1,11 @@
 #pragma once
 
+#include "memoryless_circuit.h"
 #include <algorithm>
 #include <cmath>
 #include <juce_dsp/juce_dsp.h>
 
-class JFET
+class JFET : public MemorylessCircuit<JFET>
 {
   public:
     JFET(float v, float g, float as)
@@ -18,10 +19,8 @@ class JFET
     {
     }
 
-    float processSample(float);
-
-    void processBlock(juce::AudioBuffer<float>& buffer, int numSamples);
-    void process(const juce::dsp::ProcessContextReplacing<float>& context);
+    template <typename B>
+    typename B::Float processBatch(typename B::Float x) const;
 
   private:
     float vp;
@@ -30,35 +29,25 @@ class JFET
     float asym;
 };
 
-inline float JFET::processSample(float x)
+template <typename B>
+inline typename B::Float JFET::processBatch(typename B::Float x) const
 {
-    const float c = (x < 0.0f) ? asym : 1.0f;
     const float xsat = vp + 1.0f / (2.0f * a);
     const float fsat = -1.0f / (4.0f * a) + 1.0f / (2.0f * a) + vp;
-    const float sgnx = (x < 0.0f) ? -1.0f : 1.0f;
-    const float absx = (x < 0.0f) ? -x : x;
-
-    // Cutoff zone
-    const float xc = (absx >= xsat) ? xsat : absx;
-    const float fc =
-        sgnx * (-a * c * (xc - vp) * (xc - vp) + c * (xc - vp) + vp) / fsat;
+    const auto inverse_fsat = B::set(1.0f / fsat);
+    const auto c = B::select(
+        B::less(x, B::set(0.0f)), B::set(asym), B::set(1.0f)
+    );
+    const auto absx = FastMath::abs<B>(x);
+
+    // Cutoff zone: sgnx * (-a c (xc - vp)^2 + c (xc - vp) + vp) / fsat
+    const auto xc = B::sub(B::min(absx, B::set(xsat)), B::set(vp));
+    auto fc = B::mul(c, B::sub(xc, B::mul(B::set(a), B::mul(xc, xc))));
+    fc = B::mul(B::add(fc, B::set(vp)), inverse_fsat);
+    fc = FastMath::flipSign<B>(fc, x);
 
     // Linear zone
-    const float fl = x / fsat;
-
-    return (absx < vp) ? fl : fc;
-}
+    const auto fl = B::mul(x, inverse_fsat);
 
-inline void JFET::process(
-    const juce::dsp::ProcessContextReplacing<float>& context
-)
-{
-    auto& block = context.getOutputBlock();
-    const size_t num_samples = block.getNumSamples();
-
-    auto* ch = block.getChannelPointer(0);
-    for (size_t i = 0; i < num_samples; ++i)
-    {
-        ch[i] = processSample(ch[i]);
-    }
+    return B::select(B::less(absx, B::set(vp)), fl, fc);
 }
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "../maths/fast_math.h"
+#include <cstddef>
+#include <juce_dsp/juce_dsp.h>
+
+// Block interface of the static waveshapers in this directory. A circuit
+// derives from MemorylessCircuit<Circuit> and implements its curve once,
+//
+//     template <typename B>
+//     typename B::Float processBatch(typename B::Float x) const;
+//
+// with the FastMath batch operations. processSample() and processBlock()
+// then share that kernel, run four samples at a time where SIMD is
+// available and one at a time for the rest, so a new engine built from
+// these circuits is vectorised without any code of its own.
+template <typename Circuit>
+class MemorylessCircuit
+{
+  public:
+    float processSample(float x) const
+    {
+        return self().template processBatch<FastMath::ScalarBatch>(x);
+    }
+
+    // in and out may be the same buffer
+    void processBlock(const float* in, float* out, size_t num_samples) const
+    {
+        size_t i = 0;
+#if ORBITAL_FAST_MATH_SIMD
+        using Simd = FastMath::SimdBatch;
+        for (; i + Simd::size <= num_samples; i += Simd::size)
+            Simd::store(
+                out + i, self().template processBatch<Simd>(Simd::load(in + i))
+            );
+#endif
+        for (; i < num_samples; ++i)
+            out[i] = processSample(in[i]);
+    }
+
+    void process(const juce::dsp::ProcessContextReplacing<float>& context)
+        const
+    {
+        auto& block = context.getOutputBlock();
+        for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+        {
+            auto* ch = block.getChannelPointer(channel);
+            processBlock(ch, ch, block.getNumSamples());
+        }
+    }
+
+  private:
+    const Circuit& self() const
+    {
+        return static_cast<const Circuit&>(*this);
+    }
+};
@@ -1,17 +1,17 @@
 #pragma once
-#include "../maths/omega.h"
+#include "memoryless_circuit.h"
 #include <cmath>
 
-class OpAmp
+class OpAmp : public MemorylessCircuit<OpAmp>
 {
   public:
     OpAmp()
     {
         C = 0.5f * vt * std::log(std::cosh(1.0f / vt));
     }
-    float processSample(float);
-    float omega(float);
-    float knee(float);
+
+    template <typename B>
+    typename B::Float processBatch(typename B::Float x) const;
 
   private:
     // Fixed variables
@@ -19,25 +19,28 @@ class OpAmp
     float C;
 };
 
-inline float OpAmp::processSample(float x)
+// Soft clipping using hyperbolic tangent, odd around zero. The curve reaches
+// 1 at x = 2 and is held there.
+template <typename B>
+inline typename B::Float OpAmp::processBatch(typename B::Float x) const
 {
-    // For large input, don't bother calculating the non-linearity
-    if (x > 2.0f)
-    {
-        return 1.0f;
-    }
-    else if (x < -2.0f)
-    {
-        return -1.0f;
-    }
-
-    // Soft clipping using hyperbolic tangent
-    if (x > 0.0f)
-    {
-        return 0.5f * x - 0.5f * vt * std::log(std::cosh((x - 1.0f) / vt)) + C;
-    }
-    else
-    {
-        return 0.5f * x + 0.5f * vt * std::log(std::cosh((-x - 1.0f) / vt)) - C;
-    }
+    auto x_abs = B::min(FastMath::abs<B>(x), B::set(2.0f));
+    // log(cosh(u)) = |u| + log(1 + exp(-2|u|)) - log(2), which stays in
+    // range for the large |u| of a small vt
+    auto u = FastMath::abs<B>(
+        B::mul(B::sub(x_abs, B::set(1.0f)), B::set(1.0f / vt))
+    );
+    auto log_cosh = B::add(
+        u, FastMath::log<B>(B::add(
+               B::set(1.0f), FastMath::exp<B>(B::mul(B::set(-2.0f), u))
+           ))
+    );
+    log_cosh = B::sub(log_cosh, B::set(0.693147180559945f));
+    auto y = B::add(
+        B::sub(
+            B::mul(B::set(0.5f), x_abs), B::mul(B::set(0.5f * vt), log_cosh)
+        ),
+        B::set(C)
+    );
+    return FastMath::flipSign<B>(y, x);
 }
@@ -1,26 +1,30 @@
 #pragma once
-#include "../maths/omega.h"
+#include "memoryless_circuit.h"
 #include <cmath>
 
-class OpAmp
+class OpAmp : public MemorylessCircuit<OpAmp>
 {
   public:
     OpAmp()
     {
+        using Scalar = FastMath::ScalarBatch;
         // Calculate v0 at initialization
-        v0 = vt * omega((bias + 1.0f) / vt) - 2.0f;
-        v1 = knee(x1);
+        v0 = vt * FastMath::wrightOmega<Scalar>((bias + 1.0f) / vt) - 2.0f;
+        v1 = knee<Scalar>(x1);
         // Numerical derivative of knee at x1
-        v1p = (knee(x1 + eps) - knee(x1 - eps)) / (2 * eps);
+        v1p = (knee<Scalar>(x1 + eps) - knee<Scalar>(x1 - eps)) / (2 * eps);
         // Calculate coefficients for cubic polynomial approximation
         a = (v1p * x1 - v1) / (2 * x1 * x1 * x1);
         b = (-v1p * x1 + 3 * v1) / (2 * x1);
     }
-    float processSample(float);
-    float omega(float);
-    float knee(float);
+
+    template <typename B>
+    typename B::Float processBatch(typename B::Float x) const;
 
   private:
+    template <typename B>
+    typename B::Float knee(typename B::Float x) const;
+
     // Fixed variables
     float bias = 1.02f;
     float vt = 0.0005f;
@@ -34,50 +38,28 @@ class OpAmp
     float b;
 };
 
-inline float OpAmp::omega(float x)
+template <typename B>
+inline typename B::Float OpAmp::knee(typename B::Float x) const
 {
-    if (std::abs(x) > 1.5f)
-    {
-        return omega4(x);
-    }
-    else
-    {
-        float c0 = 0.5671432904097838f;
-        float c1 = 0.3618963236098023f;
-        float c2 = 0.0736778463779836f;
-        float c3 = -0.0013437346889135f;
-        float c4 = -0.0016355437889344f;
-        float c5 = 0.0002166542734346f;
-
-        return c0 + c1 * x + c2 * std::pow(x, 2.0f) + c3 * std::pow(x, 3.0f) +
-               c4 * std::pow(x, 4.0f) + c5 * std::pow(x, 5.0f);
-    }
+    const auto inverse_vt = B::set(1.0f / vt);
+    auto expx = FastMath::exp<B>(B::mul(B::sub(B::set(0.0f), x), inverse_vt));
+    auto in_omega = B::mul(B::add(B::sub(B::set(bias), x), expx), inverse_vt);
+    auto vout = B::sub(
+        B::mul(B::set(vt), FastMath::wrightOmega<B>(in_omega)), expx
+    );
+    return B::div(B::sub(B::set(1.0f + v0), vout), B::set(1.0f + v0));
 }
 
-inline float OpAmp::knee(float x)
+// Odd around zero: a cubic below x1, the knee above it
+template <typename B>
+inline typename B::Float OpAmp::processBatch(typename B::Float x) const
 {
-    float expx = std::exp(-x / vt);
-    float in_omega = (-x + bias + expx) / vt;
-    float vout = vt * omega(in_omega) - expx;
-    return -(vout - 1.0f - v0) / (1.0f + v0);
-}
-
-inline float OpAmp::processSample(float x)
-{
-    float x_abs = std::abs(x);
-    float y;
-    if (x_abs >= x1)
-    {
-        y = knee(x_abs);
-    }
-    else
-    {
-        y = a * std::pow(x_abs, 3.0f) + b * x_abs;
-    }
-
-    if (x < 0.0f)
-        y = -y;
-    return y;
+    auto x_abs = FastMath::abs<B>(x);
+    auto cubic = B::mul(
+        x_abs, B::add(B::mul(B::set(a), B::mul(x_abs, x_abs)), B::set(b))
+    );
+    auto y = B::select(B::less(x_abs, B::set(x1)), cubic, knee<B>(x_abs));
+    return FastMath::flipSign<B>(y, x);
 }
 
 // inline float OpAmp::processSample(float x)
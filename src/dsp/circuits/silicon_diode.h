@@ -1,19 +1,21 @@
 #pragma once
-#include "../maths/omega.h"
+#include "memoryless_circuit.h"
 #include <cmath>
 
-class SiliconDiode
+// Single silicon diode clipper, same model as GermaniumDiode. With the
+// bilinear integrator k6 is zero and the capacitor state never leaves zero,
+// so CircuitAntiderivatives can tabulate the curve for ADAA.
+class SiliconDiode : public MemorylessCircuit<SiliconDiode>
 {
   public:
     SiliconDiode(float fs, bool positive);
-    float processSample(float);
-    float omega(float);
     void reset()
     {
-        prev_v = 0.0f;
-        prev_p = k6 * prev_v;
     }
 
+    template <typename B>
+    typename B::Float processBatch(typename B::Float vin) const;
+
   private:
     // Fixed variables
     float c = 1e-8f;
@@ -21,10 +23,6 @@ class SiliconDiode
     float i_s = 200e-9f;
     float v_t = 0.02585f;
 
-    // State variables
-    float prev_v;
-    float prev_p;
-
     // Main parameters
     float fs;
     bool positive;
@@ -43,27 +41,6 @@ class SiliconDiode
     float k6;
 };
 
-inline float SiliconDiode::omega(float x)
-{
-    if (std::abs(x) > 1.5f)
-    {
-        return omega4(x);
-    }
-    else
-    {
-        float c0 = 0.5671432904097838f;
-        float c1 = 0.3618963236098023f;
-        float c2 = 0.0736778463779836f;
-        float c3 = -0.0013437346889135f;
-        float c4 = -0.0016355437889344f;
-        float c5 = 0.0002166542734346f;
-
-        return c0 + c1 * x + c2 * std::pow(x, 2.0f) + c3 * std::pow(x, 3.0f) +
-               c4 * std::pow(x, 4.0f) + c5 * std::pow(x, 5.0f);
-        // return static_cast<float>(wrightomega_double(x));
-    }
-}
-
 inline SiliconDiode::SiliconDiode(float t_fs, bool t_positive)
 {
     fs = t_fs;
@@ -78,36 +55,27 @@ inline SiliconDiode::SiliconDiode(float t_fs, bool t_positive)
     k2 = (c * r) / crb_1;
     k3 = (i_s * r) / crb_1;
     k4 = 1 / v_t;
-    k5 = std::log((i_s * r) / crb_1 * v_t);
+    k5 = std::log((i_s * r) / (crb_1 * v_t));
     k6 = b1 - a1 * b0;
-
-    prev_v = 0.0f;
-    prev_p = k6 * prev_v;
+    jassert(k6 == 0.0f);
 }
 
-inline float SiliconDiode::processSample(float vin)
+// The other polarity and inputs below 0.1 pass through unchanged
+template <typename B>
+inline typename B::Float SiliconDiode::processBatch(typename B::Float vin) const
 {
-    if (positive && vin < 0.0f)
-    {
-        return vin;
-    }
-    else if (!positive && vin > 0.0f)
-    {
-        return vin;
-    }
-    if (std::abs(vin) < 0.1f)
-    {
-        float p = k6 * vin - a1 * prev_p;
-        prev_p = p;
-        prev_v = vin;
-        return vin;
-    }
-    float q = k1 * vin - prev_p;
-    float rt = (q > 0.0f) ? 1.0f : ((q < 0.0f) ? -1.0f : 0.0f); // sign function
-    float w = k2 * q + k3 * rt;
-    float vout = w - v_t * rt * omega(k4 * rt * w + k5);
-    float p = k6 * vout - a1 * prev_p;
-    prev_p = p;
-    prev_v = vout;
-    return vout;
+    auto q = B::mul(B::set(k1), vin);
+    auto rt = FastMath::sign<B>(q);
+    auto w = B::add(B::mul(B::set(k2), q), B::mul(B::set(k3), rt));
+    auto x = B::add(B::mul(B::mul(B::set(k4), rt), w), B::set(k5));
+    auto vout = B::sub(
+        w, B::mul(B::mul(B::set(v_t), rt), FastMath::wrightOmega<B>(x))
+    );
+
+    auto is_blocked = positive ? B::less(vin, B::set(0.0f))
+                               : B::less(B::set(0.0f), vin);
+    auto y = B::select(
+        B::less(FastMath::abs<B>(vin), B::set(0.1f)), vin, vout
+    );
+    return B::select(is_blocked, vin, y);
 }
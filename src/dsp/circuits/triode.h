@@ -1,13 +1,10 @@
-// triode.h
-// Single-file header-only implementation of the Triode class.
-// To use as a library, just #include this file.
-// To run the example, compile this file directly: g++ triode.h -o triode_sim
-// -std=c++17
-
 #pragma once
 #include <cmath>
-#include <iostream>
-#include <vector>
+#include <cstddef>
+
+// Wave digital model of a common-cathode triode stage (12AX7 with a bypassed
+// cathode resistor and coupling capacitors on the grid and plate), with the
+// triode solved in closed form.
 
 struct TriodeWaves
 {
@@ -19,20 +16,27 @@ struct TriodeWaves
 class Triode
 {
   public:
-    // Constructor
-    Triode(float fs);
+    Triode(float fs = 44100.0f)
+    {
+        prepare(fs);
+    }
+
+    // Computes the adaptor coefficients for the sample rate and starts from
+    // the DC operating point
+    void prepare(float fs);
     void initializeState();
     void reset()
     {
         initializeState();
     }
 
-    // Processes a block of samples (a vector)
-    // std::vector<float> process(const std::vector<float>& input);
-
-    // Processes a single sample
     float processSample(float inputSample);
 
+    // Same as processSample over a block, with the capacitor states kept in
+    // locals (registers) for the whole loop instead of going through memory
+    // on every sample. in and out may be the same buffer.
+    void processBlock(const float* in, float* out, size_t num_samples);
+
   private:
     // padding to bring -12dB to ~0dB
     float padding = -2.0f / 27.0f;
@@ -54,6 +58,10 @@ class Triode
     float wCk_s;
     float wCo_s;
 
+    // DC operating point of the cathode and plate capacitors
+    float wCk_0;
+    float wCo_0;
+
     // --- Pre-calculated Coefficients ---
     float wpg_kt, wpk_kt, wsp_kl, wpp_kt;
     float kTxCi, kTCk, kTCo, kT0;
@@ -63,10 +71,10 @@ class Triode
     float bk_bp, k_eta, k_delta, k_bp_s;
     float bp_ap_0, bp_ak_0;
 
-    TriodeWaves triode(float ag, float ak, float ap);
+    TriodeWaves triode(float ag, float ak, float ap) const;
 };
 
-inline Triode::Triode(float fs)
+inline void Triode::prepare(float fs)
 {
     float wVi_R = 1e-6f;
     float wCi_R = 1.0f / (2.0f * fs * Ci);
@@ -112,21 +120,17 @@ inline Triode::Triode(float fs)
                 (2.0f * Rk * k1 * k1 * kp2);
     float Vp0 = E - Rp / Rk * Vk0;
 
-    wCi_s = 0.0f;
-    wCk_s = Vk0;
-    wCo_s = Vp0;
+    wCk_0 = Vk0;
+    wCo_0 = Vp0;
+    initializeState();
 }
 
-// inline std::vector<float> Triode::process(const std::vector<float>& input)
-// {
-//     initializeState(); // Set initial DC operating point
-//     std::vector<float> output(input.size());
-//     for (size_t n = 0; n < input.size(); ++n)
-//     {
-//         output[n] = processSample(input[n]);
-//     }
-//     return output;
-// }
+inline void Triode::initializeState()
+{
+    wCi_s = 0.0f;
+    wCk_s = wCk_0;
+    wCo_s = wCo_0;
+}
 
 inline float Triode::processSample(float inputSample)
 {
@@ -146,7 +150,33 @@ inline float Triode::processSample(float inputSample)
     return padding * vout;
 }
 
-inline TriodeWaves Triode::triode(float ag, float ak, float ap)
+inline void Triode::processBlock(
+    const float* in, float* out, size_t num_samples
+)
+{
+    float ci = wCi_s;
+    float ck = wCk_s;
+    float co = wCo_s;
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        float xCi = in[i] + ci;
+        TriodeWaves waves =
+            triode(kTxCi * xCi, kTCk * ck, kTCo * co + kT0);
+
+        float vout = kyT * waves.bp + kyCo * co + ky0;
+
+        ci = kCiT * waves.bg + kCixCi * xCi + ci;
+        ck = waves.bk - wpk_kt * ck;
+        co = wsp_kl * waves.bp + kCoCo * co + kCo0;
+
+        out[i] = padding * vout;
+    }
+    wCi_s = ci;
+    wCk_s = ck;
+    wCo_s = co;
+}
+
+inline TriodeWaves Triode::triode(float ag, float ak, float ap) const
 {
     float bp, bk;
     float v1 = 0.5f * ap;
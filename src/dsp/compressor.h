@@ -1,7 +1,10 @@
 #pragma once
 
 #include "circuits/jfet.h"
+#include "control_rate.h"
+#include "filters/biquad_cascade.h"
 #include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
 #include <juce_dsp/juce_dsp.h>
 
 class Compressor : juce::dsp::ProcessorBase
@@ -13,8 +16,14 @@ class Compressor : juce::dsp::ProcessorBase
     ) override;
     void reset() override;
     void computeGainReductionOptometric(float& sample, float sampleRate);
-    void computeGainReductionFet(float& sample, float sampleRate);
+    void updateBallistics(
+        float attack_time, float release_time, float sampleRate
+    );
     void updateHPF();
+    void processSamples(
+        juce::dsp::AudioBlock<float>& block, size_t start, size_t length,
+        size_t num_channels, float sampleRate
+    );
     void applyLevel(juce::AudioBuffer<float>& buffer);
 
     void setHPF(float newHPF)
@@ -68,12 +77,18 @@ class Compressor : juce::dsp::ProcessorBase
         return gr_db;
     }
 
+    // Each input of the dual mono mode gets its own detector and envelope
+    static constexpr size_t max_channels = 2;
+
   private:
     juce::dsp::ProcessSpec processSpec{-1, 0, 0};
     int debugCounter = 0;
 
     void (Compressor::*gainFunction)(float&, float) = nullptr;
-    juce::dsp::IIR::Filter<float> hpf_filter;
+    // Sidechain filter of each detector, run sample by sample since it
+    // sees the compressed output
+    BiquadCascade<1, max_channels> hpf_filter;
+    ControlRate control_rate;
 
     // gui parameters
     int type;
@@ -93,9 +108,14 @@ class Compressor : juce::dsp::ProcessorBase
     // internal state of compressor
     float current_level = 0.0f;
     float current_level_db = 0.0f;
-    float envelope_state = 0.0f;
+    std::array<float, max_channels> envelope_state{};
+    // Ballistics coefficients, recomputed only when the times move
+    float ballistics_attack = -1.0f;
+    float ballistics_release = -1.0f;
+    float attack_coefficient = 0.0f;
+    float release_coefficient = 0.0f;
+    // Largest reduction of the last block on any channel, for metering
     float gr_db = 0.0f;
-    float gr = 1.0f;
     float width = 6.0f;
     // float attack = 0.0003f;
     // float release = 0.1f;
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+// Control-rate clock for knob-driven coefficients. While a module's smoothed
+// controls move, its blocks are split on a fixed grid of `interval` samples
+// and the coefficients are recomputed once per tick, whatever the host
+// block size. The grid carries over from one block to the next, so the cost
+// of a knob sweep is fixed per second of audio.
+class ControlRate
+{
+  public:
+    // Samples between coefficient updates at the plugin sample rate,
+    // oversampled modules scale it by their oversampling factor
+    static constexpr size_t default_interval = 32;
+
+    void prepare(size_t new_interval)
+    {
+        interval = std::max<size_t>(1, new_interval);
+        reset();
+    }
+
+    // The next modulated block starts with a tick
+    void reset()
+    {
+        countdown = 0;
+    }
+
+    size_t getInterval() const
+    {
+        return interval;
+    }
+
+    // Calls update() on each tick of the block and process(start, length)
+    // for the runs in between. Blocks without modulation are processed
+    // whole and the next modulated block starts with a fresh tick.
+    template <typename Update, typename Process>
+    void process(
+        size_t num_samples, bool is_modulating, Update&& update,
+        Process&& process
+    )
+    {
+        if (!is_modulating)
+        {
+            countdown = 0;
+            process((size_t)0, num_samples);
+            return;
+        }
+
+        size_t start = 0;
+        while (start < num_samples)
+        {
+            if (countdown == 0)
+            {
+                update();
+                countdown = interval;
+            }
+            size_t length = std::min(num_samples - start, countdown);
+            process(start, length);
+            start += length;
+            countdown -= length;
+        }
+    }
+
+  private:
+    size_t interval = default_interval;
+    size_t countdown = 0;
+};
@@ -1,5 +1,6 @@
 #include "eq.h"
 #include <algorithm>
+#include <cmath>
 
 #include <juce_audio_formats/juce_audio_formats.h>
 #include <juce_dsp/juce_dsp.h>
@@ -7,13 +8,10 @@
 void EQ::reset()
 {
     resetSmoothedValues();
-    low_shelf_filter.reset();
-    low_mid_filter.reset();
-    high_mid_filter.reset();
-    high_shelf_filter.reset();
-    lpf_filter_1.reset();
-    lpf_filter_2.reset();
+    filters.reset();
+    control_rate.reset();
     setCoefficients();
+    filters.rampToTargets(0);
 }
 
 void EQ::resetSmoothedValues()
@@ -53,90 +51,104 @@ void EQ::resetSmoothedValues()
 void EQ::prepare(const juce::dsp::ProcessSpec& spec)
 {
     processSpec = spec;
+    control_rate.prepare(ControlRate::default_interval);
+    buildCoefficientTables();
     resetSmoothedValues();
-    low_shelf_filter.prepare(spec);
-    low_mid_filter.prepare(spec);
-    high_mid_filter.prepare(spec);
-    high_shelf_filter.prepare(spec);
-    lpf_filter_1.prepare(spec);
-    lpf_filter_2.prepare(spec);
     reset();
 }
 
+bool EQ::isSmoothing() const
+{
+    return low_shelf_gain.isSmoothing() || low_shelf_freq.isSmoothing() ||
+           low_mid_freq.isSmoothing() || low_mid_q.isSmoothing() ||
+           low_mid_gain.isSmoothing() || high_mid_freq.isSmoothing() ||
+           high_mid_q.isSmoothing() || high_mid_gain.isSmoothing() ||
+           high_shelf_gain.isSmoothing() || high_shelf_freq.isSmoothing() ||
+           lpf_frequency.isSmoothing();
+}
+
+// Control-rate tick: advances the smoothing by one interval and glides the
+// filters to the new coefficients over that interval
+void EQ::updateCoefficients()
+{
+    const int interval = (int)control_rate.getInterval();
+    low_shelf_gain.skip(interval);
+    low_shelf_freq.skip(interval);
+    low_mid_freq.skip(interval);
+    low_mid_q.skip(interval);
+    low_mid_gain.skip(interval);
+    high_mid_freq.skip(interval);
+    high_mid_q.skip(interval);
+    high_mid_gain.skip(interval);
+    high_shelf_gain.skip(interval);
+    high_shelf_freq.skip(interval);
+    lpf_frequency.skip(interval);
+
+    setCoefficients();
+    filters.rampToTargets((size_t)interval);
+}
+
+// Frequency ranges of the parameters in parameters.h
+void EQ::buildCoefficientTables()
+{
+    const double sample_rate = processSpec.sampleRate;
+    low_shelf_table.build(sample_rate, 40.0f, 200.0f);
+    low_mid_table.build(sample_rate, 200.0f, 800.0f);
+    high_mid_table.build(sample_rate, 800.0f, 2500.0f);
+    high_shelf_table.build(sample_rate, 2000.0f, 8000.0f);
+    lpf_table.build(
+        "eq lpf", sample_rate, 1000.0f, 10000.0f,
+        [sample_rate](float frequency) {
+            return BiquadDesign::lowPass(sample_rate, frequency);
+        }
+    );
+}
+
+// Targets for the current smoothed values
 void EQ::setCoefficients()
 {
-    low_shelf_gain.skip((int)processSpec.maximumBlockSize);
-    low_shelf_freq.skip((int)processSpec.maximumBlockSize);
-    low_mid_freq.skip((int)processSpec.maximumBlockSize);
-    low_mid_q.skip((int)processSpec.maximumBlockSize);
-    low_mid_gain.skip((int)processSpec.maximumBlockSize);
-    high_mid_freq.skip((int)processSpec.maximumBlockSize);
-    high_mid_q.skip((int)processSpec.maximumBlockSize);
-    high_mid_gain.skip((int)processSpec.maximumBlockSize);
-    high_shelf_gain.skip((int)processSpec.maximumBlockSize);
-    high_shelf_freq.skip((int)processSpec.maximumBlockSize);
-    lpf_frequency.skip((int)processSpec.maximumBlockSize);
-
-    float current_low_shelf_gain = low_shelf_gain.getCurrentValue();
-    float current_low_shelf_freq = low_shelf_freq.getCurrentValue();
-    auto low_shelf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-            processSpec.sampleRate, current_low_shelf_freq, low_shelf_q,
-            current_low_shelf_gain
-        );
-    *low_shelf_filter.coefficients = *low_shelf_coefficients;
-
-    float current_low_mid_freq = low_mid_freq.getCurrentValue();
-    float current_low_mid_q = low_mid_q.getCurrentValue();
-    float current_low_mid_gain = low_mid_gain.getCurrentValue();
-    auto low_mid_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            processSpec.sampleRate, current_low_mid_freq, current_low_mid_q,
-            current_low_mid_gain
-        );
-    *low_mid_filter.coefficients = *low_mid_coefficients;
-
-    float current_high_mid_freq = high_mid_freq.getCurrentValue();
-    float current_high_mid_q = high_mid_q.getCurrentValue();
-    float current_high_mid_gain = high_mid_gain.getCurrentValue();
-    auto high_mid_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            processSpec.sampleRate, current_high_mid_freq, current_high_mid_q,
-            current_high_mid_gain
-        );
-    *high_mid_filter.coefficients = *high_mid_coefficients;
-
-    float current_high_shelf_gain = high_shelf_gain.getCurrentValue();
-    float current_high_shelf_freq = high_shelf_freq.getCurrentValue();
-    auto high_shelf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-            processSpec.sampleRate, current_high_shelf_freq, high_shelf_q,
-            current_high_shelf_gain
-        );
-    *high_shelf_filter.coefficients = *high_shelf_coefficients;
-
-    float current_lpf_frequency = lpf_frequency.getCurrentValue();
-    auto lpf_coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-        processSpec.sampleRate, current_lpf_frequency
+    filters.setSectionTarget(
+        low_shelf_section,
+        BiquadDesign::lowShelf(
+            low_shelf_table.lookup(low_shelf_freq.getCurrentValue()),
+            low_shelf_q, low_shelf_gain.getCurrentValue()
+        )
+    );
+    filters.setSectionTarget(
+        low_mid_section,
+        BiquadDesign::peak(
+            low_mid_table.lookup(low_mid_freq.getCurrentValue()),
+            low_mid_q.getCurrentValue(), low_mid_gain.getCurrentValue()
+        )
     );
-    *lpf_filter_1.coefficients = *lpf_coefficients;
-    *lpf_filter_2.coefficients = *lpf_coefficients;
+    filters.setSectionTarget(
+        high_mid_section,
+        BiquadDesign::peak(
+            high_mid_table.lookup(high_mid_freq.getCurrentValue()),
+            high_mid_q.getCurrentValue(), high_mid_gain.getCurrentValue()
+        )
+    );
+    filters.setSectionTarget(
+        high_shelf_section,
+        BiquadDesign::highShelf(
+            high_shelf_table.lookup(high_shelf_freq.getCurrentValue()),
+            high_shelf_q, high_shelf_gain.getCurrentValue()
+        )
+    );
+
+    auto lpf_coefficients = lpf_table.lookup(lpf_frequency.getCurrentValue());
+    filters.setSectionTarget(lpf_1_section, lpf_coefficients);
+    filters.setSectionTarget(lpf_2_section, lpf_coefficients);
 }
 
 void EQ::process(const juce::dsp::ProcessContextReplacing<float>& context)
 {
-    if (low_shelf_gain.isSmoothing() || low_shelf_freq.isSmoothing() ||
-        low_mid_freq.isSmoothing() || low_mid_q.isSmoothing() ||
-        low_mid_gain.isSmoothing() || high_mid_freq.isSmoothing() ||
-        high_mid_q.isSmoothing() || high_mid_gain.isSmoothing() ||
-        high_shelf_gain.isSmoothing() || high_shelf_freq.isSmoothing() ||
-        lpf_frequency.isSmoothing())
-        setCoefficients();
-
-    low_shelf_filter.process(context);
-    low_mid_filter.process(context);
-    high_mid_filter.process(context);
-    high_shelf_filter.process(context);
-    lpf_filter_1.process(context);
-    lpf_filter_2.process(context);
+    auto& block = context.getOutputBlock();
+    control_rate.process(
+        block.getNumSamples(), isSmoothing(), [this] { updateCoefficients(); },
+        [&](size_t start, size_t length) {
+            auto chunk = block.getSubBlock(start, length);
+            filters.process(juce::dsp::ProcessContextReplacing<float>(chunk));
+        }
+    );
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "control_rate.h"
+#include "filters/biquad_cascade.h"
+#include "filters/coefficient_table.h"
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
 
@@ -91,21 +94,32 @@ class EQ : juce::dsp::ProcessorBase
     }
 
     void setCoefficients();
+    void buildCoefficientTables();
+    void updateCoefficients();
+    bool isSmoothing() const;
 
   private:
     juce::dsp::ProcessSpec processSpec{-1, 0, 0};
 
-    juce::dsp::IIR::Filter<float> lpf_filter_1;
-    juce::dsp::IIR::Filter<float> lpf_filter_2;
-
-    juce::dsp::IIR::Filter<float> low_shelf_filter;
+    enum Section
+    {
+        low_shelf_section,
+        low_mid_section,
+        high_mid_section,
+        high_shelf_section,
+        lpf_1_section,
+        lpf_2_section,
+        num_sections
+    };
+    static constexpr size_t max_channels = 2;
+    BiquadCascade<num_sections, max_channels> filters;
+    ControlRate control_rate;
+
+    // Band frequencies, and the whole low pass design, tabulated on prepare
+    FrequencyTable low_shelf_table, low_mid_table, high_mid_table,
+        high_shelf_table;
+    CoefficientTable lpf_table;
     float low_shelf_q = 0.7f;
-
-    juce::dsp::IIR::Filter<float> low_mid_filter;
-
-    juce::dsp::IIR::Filter<float> high_mid_filter;
-
-    juce::dsp::IIR::Filter<float> high_shelf_filter;
     float high_shelf_q = 0.7f;
 
     float smoothing_time = 0.05f;
@@ -0,0 +1,588 @@
+#pragma once
+
+#include "biquad_design.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <juce_dsp/juce_dsp.h>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ORBITAL_BIQUAD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ORBITAL_BIQUAD_NEON 1
+#endif
+
+// A fixed chain of biquads run in a single pass per block, replacing a
+// series of juce::dsp::IIR::Filter calls that each sweep the whole buffer.
+//
+// Coefficients and state are stored per field (structure of arrays) and the
+// sections run in transposed direct form II, exactly like IIR::Filter. With
+// SSE2 or NEON, four consecutive sections share one register, one per lane:
+// at step t, lane k works on sample t - k and takes the output of lane k - 1
+// from the step before. The first and last steps of each block only update
+// the lanes that hold a real sample, so the output is the same as the plain
+// cascade, with no added latency. Unused lanes of the last group are unity
+// sections. Without SIMD each sample goes through every section in turn.
+//
+// Two channels, as in dual mono, share each register instead: the lanes
+// hold two consecutive sections of the left channel and the same two of the
+// right one, so cascades of one or two sections run both channels for the
+// price of one, and no cascade leaves lanes idle on padding sections.
+//
+// Each channel has its own state, all channels share the coefficients.
+// Coefficients can also glide to new targets, sample by sample, which is
+// how the control-rate updates of the modules avoid zipper noise.
+template <size_t NumSections, size_t NumChannels = 2>
+class BiquadCascade
+{
+  public:
+    static constexpr size_t num_sections = NumSections;
+    static constexpr size_t num_channels = NumChannels;
+
+    BiquadCascade()
+    {
+        for (size_t i = 0; i < padded_sections; ++i)
+            setSection(i, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f);
+        reset();
+    }
+
+    // Coefficients normalised by a0, applied straight away
+    void setSection(
+        size_t index, float b0, float b1, float b2, float a1, float a2
+    )
+    {
+        setSectionTarget(index, b0, b1, b2, a1, a2);
+        coefficients.b0[index] = b0;
+        coefficients.b1[index] = b1;
+        coefficients.b2[index] = b2;
+        coefficients.a1[index] = a1;
+        coefficients.a2[index] = a2;
+        increments.b0[index] = increments.b1[index] = increments.b2[index] =
+            increments.a1[index] = increments.a2[index] = 0.0f;
+    }
+
+    void setSection(size_t index, const BiquadCoefficients& c)
+    {
+        setSection(index, c.b0, c.b1, c.b2, c.a1, c.a2);
+    }
+
+    // Coefficients reached by the next rampToTargets()
+    void setSectionTarget(
+        size_t index, float b0, float b1, float b2, float a1, float a2
+    )
+    {
+        jassert(index < padded_sections);
+        targets.b0[index] = b0;
+        targets.b1[index] = b1;
+        targets.b2[index] = b2;
+        targets.a1[index] = a1;
+        targets.a2[index] = a2;
+    }
+
+    void setSectionTarget(size_t index, const BiquadCoefficients& c)
+    {
+        setSectionTarget(index, c.b0, c.b1, c.b2, c.a1, c.a2);
+    }
+
+    // Interpolates every section linearly to its target over the next
+    // num_samples, 0 jumps straight to the targets. Linear interpolation
+    // between two stable biquads stays stable, the (a1, a2) stability
+    // triangle being convex.
+    void rampToTargets(size_t num_samples)
+    {
+        ramp_remaining = num_samples;
+        if (num_samples == 0)
+        {
+            coefficients = targets;
+            return;
+        }
+        const float scale = 1.0f / (float)num_samples;
+        for (size_t k = 0; k < NumSections; ++k)
+        {
+            increments.b0[k] = (targets.b0[k] - coefficients.b0[k]) * scale;
+            increments.b1[k] = (targets.b1[k] - coefficients.b1[k]) * scale;
+            increments.b2[k] = (targets.b2[k] - coefficients.b2[k]) * scale;
+            increments.a1[k] = (targets.a1[k] - coefficients.a1[k]) * scale;
+            increments.a2[k] = (targets.a2[k] - coefficients.a2[k]) * scale;
+        }
+    }
+
+    bool isRamping() const
+    {
+        return ramp_remaining > 0;
+    }
+
+    void reset()
+    {
+        for (auto& channel : states)
+            channel = State();
+    }
+
+    void process(const juce::dsp::ProcessContextReplacing<float>& context)
+    {
+        auto& block = context.getOutputBlock();
+        const size_t channels = block.getNumChannels();
+        const size_t num_samples = block.getNumSamples();
+        jassert(channels <= NumChannels);
+
+        // Samples still inside a ramp take the per-sample scalar path
+        size_t start = 0;
+        if (ramp_remaining > 0)
+        {
+            start = std::min(num_samples, ramp_remaining);
+            for (size_t channel = 0; channel < channels; ++channel)
+                processRamp(
+                    states[channel], block.getChannelPointer(channel), start
+                );
+            advanceRamp(start);
+        }
+        if (start == num_samples)
+            return;
+
+#if ORBITAL_BIQUAD_SSE2 || ORBITAL_BIQUAD_NEON
+        if (channels == 2)
+        {
+            auto* left = block.getChannelPointer(0) + start;
+            auto* right = block.getChannelPointer(1) + start;
+            processPairs(left, right, num_samples - start);
+            snapToZero(states[0]);
+            snapToZero(states[1]);
+            return;
+        }
+#endif
+        for (size_t channel = 0; channel < channels; ++channel)
+            processChannel(
+                channel, block.getChannelPointer(channel) + start,
+                num_samples - start
+            );
+    }
+
+    void processChannel(size_t channel, float* samples, size_t num_samples)
+    {
+        auto& state = states[channel];
+#if ORBITAL_BIQUAD_SSE2 || ORBITAL_BIQUAD_NEON
+        for (size_t first = 0; first < NumSections; first += lanes)
+            processGroup(first, state, samples, num_samples);
+#else
+        processScalar(state, samples, num_samples);
+#endif
+        snapToZero(state);
+    }
+
+    // One sample of one channel, for filters inside a feedback loop. The
+    // caller then moves a running ramp on with stepRamp() once per sample
+    // for all channels, and calls snapToZero() at the end of the run.
+    float processSample(size_t channel, float x)
+    {
+        auto& state = states[channel];
+        const auto& c = coefficients;
+        for (size_t k = 0; k < NumSections; ++k)
+        {
+            float y = c.b0[k] * x + state.s1[k];
+            state.s1[k] = c.b1[k] * x - c.a1[k] * y + state.s2[k];
+            state.s2[k] = c.b2[k] * x - c.a2[k] * y;
+            x = y;
+        }
+        return x;
+    }
+
+    void stepRamp()
+    {
+        if (ramp_remaining > 0)
+            advanceRamp(1);
+    }
+
+    void snapToZero()
+    {
+        for (auto& state : states)
+            snapToZero(state);
+    }
+
+  private:
+    static constexpr size_t lanes = 4;
+    static constexpr size_t padded_sections =
+        (NumSections + lanes - 1) / lanes * lanes;
+    // Registers of the two channel path, two sections each
+    static constexpr size_t num_pairs = (NumSections + 1) / 2;
+
+    struct Coefficients
+    {
+        alignas(16) std::array<float, padded_sections> b0;
+        alignas(16) std::array<float, padded_sections> b1;
+        alignas(16) std::array<float, padded_sections> b2;
+        alignas(16) std::array<float, padded_sections> a1;
+        alignas(16) std::array<float, padded_sections> a2;
+    };
+
+    struct State
+    {
+        alignas(16) std::array<float, padded_sections> s1{};
+        alignas(16) std::array<float, padded_sections> s2{};
+    };
+
+    Coefficients coefficients;
+    Coefficients targets;
+    Coefficients increments;
+    size_t ramp_remaining = 0;
+    std::array<State, NumChannels> states;
+
+    // Same denormal guard as IIR::Filter
+    static void snapToZero(State& state)
+    {
+        for (size_t i = 0; i < padded_sections; ++i)
+        {
+            juce::dsp::util::snapToZero(state.s1[i]);
+            juce::dsp::util::snapToZero(state.s2[i]);
+        }
+    }
+
+    // Coefficients step by their increment after every sample
+    void processRamp(State& state, float* samples, size_t num_samples)
+    {
+        auto c = coefficients;
+        const auto& d = increments;
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            float x = samples[i];
+            for (size_t k = 0; k < NumSections; ++k)
+            {
+                float y = c.b0[k] * x + state.s1[k];
+                state.s1[k] = c.b1[k] * x - c.a1[k] * y + state.s2[k];
+                state.s2[k] = c.b2[k] * x - c.a2[k] * y;
+                x = y;
+
+                c.b0[k] += d.b0[k];
+                c.b1[k] += d.b1[k];
+                c.b2[k] += d.b2[k];
+                c.a1[k] += d.a1[k];
+                c.a2[k] += d.a2[k];
+            }
+            samples[i] = x;
+        }
+        snapToZero(state);
+    }
+
+    void advanceRamp(size_t num_samples)
+    {
+        ramp_remaining -= num_samples;
+        if (ramp_remaining == 0)
+        {
+            coefficients = targets;
+            return;
+        }
+        const float steps = (float)num_samples;
+        for (size_t k = 0; k < NumSections; ++k)
+        {
+            coefficients.b0[k] += increments.b0[k] * steps;
+            coefficients.b1[k] += increments.b1[k] * steps;
+            coefficients.b2[k] += increments.b2[k] * steps;
+            coefficients.a1[k] += increments.a1[k] * steps;
+            coefficients.a2[k] += increments.a2[k] * steps;
+        }
+    }
+
+    void processScalar(State& state, float* samples, size_t num_samples)
+    {
+        auto s1 = state.s1;
+        auto s2 = state.s2;
+        const auto& c = coefficients;
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            float x = samples[i];
+            for (size_t k = 0; k < NumSections; ++k)
+            {
+                float y = c.b0[k] * x + s1[k];
+                s1[k] = c.b1[k] * x - c.a1[k] * y + s2[k];
+                s2[k] = c.b2[k] * x - c.a2[k] * y;
+                x = y;
+            }
+            samples[i] = x;
+        }
+        state.s1 = s1;
+        state.s2 = s2;
+    }
+
+#if ORBITAL_BIQUAD_SSE2
+    using Vector = __m128;
+    static Vector zero() { return _mm_setzero_ps(); }
+    static Vector load(const float* p) { return _mm_load_ps(p); }
+    static void store(float* p, Vector v) { _mm_store_ps(p, v); }
+    static Vector add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+    static Vector sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+    static Vector mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+    static Vector select(Vector mask, Vector a, Vector b)
+    {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    }
+    // {x, v0, v1, v2}
+    static Vector shiftIn(float x, Vector v)
+    {
+        auto shifted = _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4));
+        return _mm_move_ss(shifted, _mm_set_ss(x));
+    }
+    static float lastLane(Vector v)
+    {
+        return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    // Lanes first_lane to last_lane set
+    static Vector laneMask(int first_lane, int last_lane)
+    {
+        auto lane = _mm_setr_epi32(0, 1, 2, 3);
+        auto above = _mm_cmpgt_epi32(lane, _mm_set1_epi32(first_lane - 1));
+        auto below = _mm_cmplt_epi32(lane, _mm_set1_epi32(last_lane + 1));
+        return _mm_castsi128_ps(_mm_and_si128(above, below));
+    }
+    // {p0, p1, p0, p1}
+    static Vector loadPair(const float* p)
+    {
+        auto pair = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)p);
+        return _mm_movelh_ps(pair, pair);
+    }
+    // {a0, a1, b0, b1}
+    static Vector loadPairs(const float* a, const float* b)
+    {
+        auto low = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)a);
+        return _mm_loadh_pi(low, (const __m64*)b);
+    }
+    static void storePairs(float* a, float* b, Vector v)
+    {
+        _mm_storel_pi((__m64*)a, v);
+        _mm_storeh_pi((__m64*)b, v);
+    }
+    // {left, v0, right, v2}
+    static Vector shiftInPairs(float left, float right, Vector v)
+    {
+        return _mm_unpacklo_ps(
+            _mm_setr_ps(left, right, 0.0f, 0.0f),
+            _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 0, 2, 0))
+        );
+    }
+    // {previous1, v0, previous3, v2}
+    static Vector shiftInPairs(Vector previous, Vector v)
+    {
+        auto odd_even = _mm_shuffle_ps(previous, v, _MM_SHUFFLE(2, 0, 3, 1));
+        return _mm_shuffle_ps(
+            odd_even, odd_even, _MM_SHUFFLE(3, 1, 2, 0)
+        );
+    }
+    static float lane1(Vector v)
+    {
+        return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+    }
+    // Lanes 0 and 2 set if even, 1 and 3 if odd
+    static Vector pairMask(bool even, bool odd)
+    {
+        return _mm_castsi128_ps(
+            _mm_setr_epi32(-(int)even, -(int)odd, -(int)even, -(int)odd)
+        );
+    }
+#elif ORBITAL_BIQUAD_NEON
+    using Vector = float32x4_t;
+    static Vector zero() { return vdupq_n_f32(0.0f); }
+    static Vector load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Vector v) { vst1q_f32(p, v); }
+    static Vector add(Vector a, Vector b) { return vaddq_f32(a, b); }
+    static Vector sub(Vector a, Vector b) { return vsubq_f32(a, b); }
+    static Vector mul(Vector a, Vector b) { return vmulq_f32(a, b); }
+    static Vector select(Vector mask, Vector a, Vector b)
+    {
+        return vbslq_f32(vreinterpretq_u32_f32(mask), a, b);
+    }
+    static Vector shiftIn(float x, Vector v)
+    {
+        return vextq_f32(vdupq_n_f32(x), v, 3);
+    }
+    static float lastLane(Vector v) { return vgetq_lane_f32(v, 3); }
+    static Vector laneMask(int first_lane, int last_lane)
+    {
+        const int32_t indices[4] = {0, 1, 2, 3};
+        auto lane = vld1q_s32(indices);
+        auto above = vcgeq_s32(lane, vdupq_n_s32(first_lane));
+        auto below = vcleq_s32(lane, vdupq_n_s32(last_lane));
+        return vreinterpretq_f32_u32(vandq_u32(above, below));
+    }
+    static Vector loadPair(const float* p)
+    {
+        auto pair = vld1_f32(p);
+        return vcombine_f32(pair, pair);
+    }
+    static Vector loadPairs(const float* a, const float* b)
+    {
+        return vcombine_f32(vld1_f32(a), vld1_f32(b));
+    }
+    static void storePairs(float* a, float* b, Vector v)
+    {
+        vst1_f32(a, vget_low_f32(v));
+        vst1_f32(b, vget_high_f32(v));
+    }
+    static Vector shiftInPairs(float left, float right, Vector v)
+    {
+        auto inputs = vsetq_lane_f32(right, vdupq_n_f32(left), 1);
+        return vzipq_f32(inputs, vuzpq_f32(v, v).val[0]).val[0];
+    }
+    static Vector shiftInPairs(Vector previous, Vector v)
+    {
+        auto odd = vuzpq_f32(previous, previous).val[1];
+        return vzipq_f32(odd, vuzpq_f32(v, v).val[0]).val[0];
+    }
+    static float lane1(Vector v) { return vgetq_lane_f32(v, 1); }
+    static Vector pairMask(bool even, bool odd)
+    {
+        const uint32_t e = even ? ~0u : 0u;
+        const uint32_t o = odd ? ~0u : 0u;
+        const uint32_t masks[4] = {e, o, e, o};
+        return vreinterpretq_f32_u32(vld1q_u32(masks));
+    }
+#endif
+
+#if ORBITAL_BIQUAD_SSE2 || ORBITAL_BIQUAD_NEON
+    // Runs sections first to first + 3 over the block, in place
+    void processGroup(
+        size_t first, State& state, float* samples, size_t num_samples
+    )
+    {
+        const auto& c = coefficients;
+        const Vector b0 = load(&c.b0[first]);
+        const Vector b1 = load(&c.b1[first]);
+        const Vector b2 = load(&c.b2[first]);
+        const Vector a1 = load(&c.a1[first]);
+        const Vector a2 = load(&c.a2[first]);
+        Vector s1 = load(&state.s1[first]);
+        Vector s2 = load(&state.s2[first]);
+        Vector y = zero();
+
+        // Lane k holds sample t - k, the group output is lane 3
+        auto step = [&](float x, Vector previous_y, Vector& new_s1,
+                        Vector& new_s2) {
+            Vector u = shiftIn(x, previous_y);
+            Vector out = add(mul(b0, u), s1);
+            new_s1 = add(sub(mul(b1, u), mul(a1, out)), s2);
+            new_s2 = sub(mul(b2, u), mul(a2, out));
+            return out;
+        };
+
+        const size_t n = num_samples;
+        const size_t fill = std::min(lanes - 1, n);
+        const size_t end = n + lanes - 1;
+        size_t t = 0;
+
+        // Lanes start one step after each other
+        for (; t < fill; ++t)
+        {
+            Vector new_s1, new_s2;
+            y = step(samples[t], y, new_s1, new_s2);
+            Vector mask = laneMask(std::max(0, (int)t - (int)n + 1), (int)t);
+            s1 = select(mask, new_s1, s1);
+            s2 = select(mask, new_s2, s2);
+        }
+        for (; t < n; ++t)
+        {
+            y = step(samples[t], y, s1, s2);
+            samples[t - (lanes - 1)] = lastLane(y);
+        }
+        // And finish one step after each other
+        for (; t < end; ++t)
+        {
+            Vector new_s1, new_s2;
+            y = step(0.0f, y, new_s1, new_s2);
+            Vector mask = laneMask((int)t - (int)n + 1, (int)t);
+            s1 = select(mask, new_s1, s1);
+            s2 = select(mask, new_s2, s2);
+            if (t >= lanes - 1)
+                samples[t - (lanes - 1)] = lastLane(y);
+        }
+
+        store(&state.s1[first], s1);
+        store(&state.s2[first], s2);
+    }
+
+    // Runs every section over both channels, in place. Register g holds
+    // sections 2g and 2g + 1, in lanes 0 and 1 for the left channel and 2
+    // and 3 for the right one. At step t, lanes 0 and 2 of it work on
+    // sample t - 2g and lanes 1 and 3 on sample t - 2g - 1, so each
+    // register takes the output of the one before from the previous step.
+    // Their dependency chains are independent within a step and overlap.
+    void processPairs(float* left, float* right, size_t num_samples)
+    {
+        Vector b0[num_pairs], b1[num_pairs], b2[num_pairs], a1[num_pairs],
+            a2[num_pairs], s1[num_pairs], s2[num_pairs], y[num_pairs];
+        const auto& c = coefficients;
+        for (size_t g = 0; g < num_pairs; ++g)
+        {
+            const size_t k = 2 * g;
+            b0[g] = loadPair(&c.b0[k]);
+            b1[g] = loadPair(&c.b1[k]);
+            b2[g] = loadPair(&c.b2[k]);
+            a1[g] = loadPair(&c.a1[k]);
+            a2[g] = loadPair(&c.a2[k]);
+            s1[g] = loadPairs(&states[0].s1[k], &states[1].s1[k]);
+            s2[g] = loadPairs(&states[0].s2[k], &states[1].s2[k]);
+            y[g] = zero();
+        }
+
+        // Last register first, so each one reads the output of the one
+        // before from the previous step
+        auto step = [&](float x_left, float x_right, auto&& update) {
+            for (size_t g = num_pairs; g-- > 0;)
+            {
+                Vector u = g == 0 ? shiftInPairs(x_left, x_right, y[0])
+                                  : shiftInPairs(y[g - 1], y[g]);
+                Vector out = add(mul(b0[g], u), s1[g]);
+                Vector new_s1 = add(sub(mul(b1[g], u), mul(a1[g], out)), s2[g]);
+                Vector new_s2 = sub(mul(b2[g], u), mul(a2[g], out));
+                update(g, new_s1, new_s2);
+                y[g] = out;
+            }
+        };
+        auto update_all = [&](size_t g, Vector new_s1, Vector new_s2) {
+            s1[g] = new_s1;
+            s2[g] = new_s2;
+        };
+
+        // Lanes start and finish one step after each other
+        const size_t n = num_samples;
+        const size_t latency = 2 * num_pairs - 1;
+        auto partial_step = [&](size_t t) {
+            float x_left = t < n ? left[t] : 0.0f;
+            float x_right = t < n ? right[t] : 0.0f;
+            step(x_left, x_right, [&](size_t g, Vector new_s1, Vector new_s2) {
+                const size_t first = 2 * g;
+                Vector mask = pairMask(
+                    first <= t && t < n + first,
+                    first + 1 <= t && t < n + first + 1
+                );
+                s1[g] = select(mask, new_s1, s1[g]);
+                s2[g] = select(mask, new_s2, s2[g]);
+            });
+            if (t >= latency)
+            {
+                left[t - latency] = lane1(y[num_pairs - 1]);
+                right[t - latency] = lastLane(y[num_pairs - 1]);
+            }
+        };
+
+        size_t t = 0;
+        for (; t < std::min(latency, n); ++t)
+            partial_step(t);
+        for (; t < n; ++t)
+        {
+            step(left[t], right[t], update_all);
+            left[t - latency] = lane1(y[num_pairs - 1]);
+            right[t - latency] = lastLane(y[num_pairs - 1]);
+        }
+        for (; t < n + latency; ++t)
+            partial_step(t);
+
+        for (size_t g = 0; g < num_pairs; ++g)
+        {
+            const size_t k = 2 * g;
+            storePairs(&states[0].s1[k], &states[1].s1[k], s1[g]);
+            storePairs(&states[0].s2[k], &states[1].s2[k], s2[g]);
+        }
+    }
+#endif
+};
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <juce_dsp/juce_dsp.h>
+
+// Second order section normalised by a0, first order filters have b2 and a2
+// set to zero
+struct BiquadCoefficients
+{
+    float b0 = 1.0f;
+    float b1 = 0.0f;
+    float b2 = 0.0f;
+    float a1 = 0.0f;
+    float a2 = 0.0f;
+
+    static BiquadCoefficients normalise(
+        float b0, float b1, float b2, float a0, float a1, float a2
+    )
+    {
+        float inverse_a0 = 1.0f / a0;
+        return {
+            b0 * inverse_a0, b1 * inverse_a0, b2 * inverse_a0,
+            a1 * inverse_a0, a2 * inverse_a0
+        };
+    }
+
+    // a + (b - a) * t, coefficient by coefficient
+    static BiquadCoefficients interpolate(
+        const BiquadCoefficients& a, const BiquadCoefficients& b, float t
+    )
+    {
+        return {
+            a.b0 + (b.b0 - a.b0) * t, a.b1 + (b.b1 - a.b1) * t,
+            a.b2 + (b.b2 - a.b2) * t, a.a1 + (b.a1 - a.a1) * t,
+            a.a2 + (b.a2 - a.a2) * t
+        };
+    }
+
+    // Overwrites the coefficients of an IIR::Filter in place. Only the first
+    // call on coefficients that are not second order yet resizes them, so
+    // this belongs in prepare() before any update from the audio thread.
+    void copyTo(juce::dsp::IIR::Coefficients<float>& target) const
+    {
+        if (target.coefficients.size() != 5)
+            target.coefficients.resize(5);
+        float* raw = target.getRawCoefficients();
+        raw[0] = b0;
+        raw[1] = b1;
+        raw[2] = b2;
+        raw[3] = a1;
+        raw[4] = a2;
+    }
+};
+
+// Filter designs returned by value, with the same formulas as the
+// IIR::Coefficients factories but without their reference-counted heap
+// objects, so that they can run on the audio thread while knobs move.
+namespace BiquadDesign
+{
+inline constexpr float inverse_root_two = 0.70710678118654752440f;
+
+// Cosine and sine of the angular frequency 2 pi f / fs, the only
+// transcendental part of the shelf and peak designs
+struct Frequency
+{
+    float cos_omega;
+    float sin_omega;
+
+    static Frequency at(double sample_rate, float frequency)
+    {
+        double omega = 2.0 * juce::MathConstants<double>::pi *
+                       std::max(frequency, 2.0f) / sample_rate;
+        return {(float)std::cos(omega), (float)std::sin(omega)};
+    }
+};
+
+inline BiquadCoefficients lowPass(
+    double sample_rate, float frequency, float q = inverse_root_two
+)
+{
+    float n = 1.0f / std::tan(
+                         juce::MathConstants<float>::pi * frequency /
+                         (float)sample_rate
+                     );
+    float n_squared = n * n;
+    float inverse_q = 1.0f / q;
+    float c1 = 1.0f / (1.0f + inverse_q * n + n_squared);
+    return {
+        c1, c1 * 2.0f, c1, c1 * 2.0f * (1.0f - n_squared),
+        c1 * (1.0f - inverse_q * n + n_squared)
+    };
+}
+
+inline BiquadCoefficients highPass(
+    double sample_rate, float frequency, float q = inverse_root_two
+)
+{
+    float n = std::tan(
+        juce::MathConstants<float>::pi * frequency / (float)sample_rate
+    );
+    float n_squared = n * n;
+    float inverse_q = 1.0f / q;
+    float c1 = 1.0f / (1.0f + inverse_q * n + n_squared);
+    return {
+        c1, c1 * -2.0f, c1, c1 * 2.0f * (n_squared - 1.0f),
+        c1 * (1.0f - inverse_q * n + n_squared)
+    };
+}
+
+inline BiquadCoefficients lowShelf(
+    Frequency frequency, float q, float gain_factor
+)
+{
+    float a = std::sqrt(std::max(0.0f, gain_factor));
+    float a_minus_1 = a - 1.0f;
+    float a_plus_1 = a + 1.0f;
+    float beta = frequency.sin_omega * std::sqrt(a) / q;
+    float a_minus_1_cos = a_minus_1 * frequency.cos_omega;
+    return BiquadCoefficients::normalise(
+        a * (a_plus_1 - a_minus_1_cos + beta),
+        a * 2.0f * (a_minus_1 - a_plus_1 * frequency.cos_omega),
+        a * (a_plus_1 - a_minus_1_cos - beta), a_plus_1 + a_minus_1_cos + beta,
+        -2.0f * (a_minus_1 + a_plus_1 * frequency.cos_omega),
+        a_plus_1 + a_minus_1_cos - beta
+    );
+}
+
+inline BiquadCoefficients highShelf(
+    Frequency frequency, float q, float gain_factor
+)
+{
+    float a = std::sqrt(std::max(0.0f, gain_factor));
+    float a_minus_1 = a - 1.0f;
+    float a_plus_1 = a + 1.0f;
+    float beta = frequency.sin_omega * std::sqrt(a) / q;
+    float a_minus_1_cos = a_minus_1 * frequency.cos_omega;
+    return BiquadCoefficients::normalise(
+        a * (a_plus_1 + a_minus_1_cos + beta),
+        a * -2.0f * (a_minus_1 + a_plus_1 * frequency.cos_omega),
+        a * (a_plus_1 + a_minus_1_cos - beta), a_plus_1 - a_minus_1_cos + beta,
+        2.0f * (a_minus_1 - a_plus_1 * frequency.cos_omega),
+        a_plus_1 - a_minus_1_cos - beta
+    );
+}
+
+inline BiquadCoefficients peak(Frequency frequency, float q, float gain_factor)
+{
+    float a = std::sqrt(std::max(0.0f, gain_factor));
+    float alpha = frequency.sin_omega / (q * 2.0f);
+    float c2 = -2.0f * frequency.cos_omega;
+    float alpha_times_a = alpha * a;
+    float alpha_over_a = alpha / a;
+    return BiquadCoefficients::normalise(
+        1.0f + alpha_times_a, c2, 1.0f - alpha_times_a, 1.0f + alpha_over_a,
+        c2, 1.0f - alpha_over_a
+    );
+}
+
+inline BiquadCoefficients lowShelf(
+    double sample_rate, float frequency, float q, float gain_factor
+)
+{
+    return lowShelf(Frequency::at(sample_rate, frequency), q, gain_factor);
+}
+
+inline BiquadCoefficients highShelf(
+    double sample_rate, float frequency, float q, float gain_factor
+)
+{
+    return highShelf(Frequency::at(sample_rate, frequency), q, gain_factor);
+}
+
+inline BiquadCoefficients peak(
+    double sample_rate, float frequency, float q, float gain_factor
+)
+{
+    return peak(Frequency::at(sample_rate, frequency), q, gain_factor);
+}
+} // namespace BiquadDesign
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "../shared_resources.h"
+#include "biquad_cascade.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+// Biquad coefficients of a knob-driven filter, designed at evenly spaced
+// knob positions when the module is prepared. Moving the knob then costs a
+// lookup and a linear interpolation between the two nearest designs instead
+// of a filter design with its tan, sin and sqrt calls. The interpolated
+// filter stays stable, since the stable region of (a1, a2) is convex.
+//
+// The designs only depend on the sample rate, so every instance of the
+// plugin shares the table of a given key through SharedResources. Until
+// build() the table holds identity filters.
+class CoefficientTable
+{
+  public:
+    // 0.02 apart over the 0 to 10 range of the amp knobs, which keeps the
+    // interpolated responses within 0.05 dB of the exact designs (the Helios
+    // era peak near 0 being the steepest)
+    static constexpr size_t num_points = 513;
+
+    // design(value) returns the BiquadCoefficients of the filter at value.
+    // The key names the design and its range, unique across modules.
+    template <typename Design>
+    void build(
+        const std::string& key, double sample_rate, float min_value,
+        float max_value, Design&& design
+    )
+    {
+        data = SharedResources::get<Data>(key, sample_rate, [&] {
+            Data table;
+            table.min_value = min_value;
+            table.max_value = max_value;
+            table.scale = (float)(num_points - 1) / (max_value - min_value);
+            for (size_t i = 0; i < num_points; ++i)
+            {
+                float value = min_value + (float)i / table.scale;
+                table.points[i] = design(value);
+            }
+            return table;
+        });
+    }
+
+    // Values outside the table are held at its ends
+    BiquadCoefficients lookup(float value) const
+    {
+        const Data& table = *data;
+        float position = (std::clamp(value, table.min_value, table.max_value) -
+                          table.min_value) *
+                         table.scale;
+        size_t index = std::min((size_t)position, num_points - 2);
+        return BiquadCoefficients::interpolate(
+            table.points[index], table.points[index + 1],
+            position - (float)index
+        );
+    }
+
+  private:
+    struct Data
+    {
+        std::array<BiquadCoefficients, num_points> points;
+        float min_value = 0.0f;
+        float max_value = 1.0f;
+        float scale = (float)(num_points - 1);
+    };
+
+    static std::shared_ptr<const Data> identity()
+    {
+        static const auto instance = std::make_shared<const Data>();
+        return instance;
+    }
+
+    std::shared_ptr<const Data> data = identity();
+};
+
+// Cosine and sine of the angular frequency 2 pi f / fs over a frequency
+// range, for filters with more controls than the frequency (EQ bands with
+// gain and Q), where the coefficients themselves cannot be tabulated in one
+// dimension. The rest of the RBJ designs in BiquadDesign is plain
+// arithmetic.
+class FrequencyTable
+{
+  public:
+    static constexpr size_t num_points = 257;
+
+    using Point = BiquadDesign::Frequency;
+
+    // Shared by every table of the same range and sample rate
+    void build(double sample_rate, float min_hz, float max_hz)
+    {
+        const auto key = "frequency " + std::to_string(min_hz) + " " +
+                         std::to_string(max_hz);
+        data = SharedResources::get<Data>(key, sample_rate, [&] {
+            Data table;
+            table.min_hz = min_hz;
+            table.max_hz = max_hz;
+            table.scale = (float)(num_points - 1) / (max_hz - min_hz);
+            for (size_t i = 0; i < num_points; ++i)
+            {
+                double hz = min_hz + (double)i / table.scale;
+                double omega = 2.0 * juce::MathConstants<double>::pi * hz /
+                               sample_rate;
+                table.points[i] = {
+                    (float)std::cos(omega), (float)std::sin(omega)
+                };
+            }
+            return table;
+        });
+    }
+
+    Point lookup(float hz) const
+    {
+        const Data& table = *data;
+        float position =
+            (std::clamp(hz, table.min_hz, table.max_hz) - table.min_hz) *
+            table.scale;
+        size_t index = std::min((size_t)position, num_points - 2);
+        float t = position - (float)index;
+        const auto& a = table.points[index];
+        const auto& b = table.points[index + 1];
+        return {
+            a.cos_omega + (b.cos_omega - a.cos_omega) * t,
+            a.sin_omega + (b.sin_omega - a.sin_omega) * t
+        };
+    }
+
+  private:
+    struct Data
+    {
+        std::array<Point, num_points> points{};
+        float min_hz = 0.0f;
+        float max_hz = 1.0f;
+        float scale = (float)(num_points - 1);
+    };
+
+    static std::shared_ptr<const Data> empty()
+    {
+        static const auto instance = std::make_shared<const Data>();
+        return instance;
+    }
+
+    std::shared_ptr<const Data> data = empty();
+};
@@ -1,4 +1,8 @@
-inline std::shared_ptr<juce::dsp::IIR::Coefficients<float>> makeDriveFilter(
+#pragma once
+
+#include "biquad_design.h"
+
+inline BiquadCoefficients makeDriveFilter(
     float fs, float f_hpf, float f_lpf, float gain
 )
 {
@@ -27,7 +31,5 @@ inline std::shared_ptr<juce::dsp::IIR::Coefficients<float>> makeDriveFilter(
     float b1 = 2.0f * (b0s - b2s * Ks) / a0;
     float b2 = (b2s * Ks - b1s * K + b0s) / a0;
 
-    return std::make_shared<juce::dsp::IIR::Coefficients<float>>(
-        b0, b1, b2, 1.0f, a1, a2
-    );
+    return {b0, b1, b2, a1, a2};
 }
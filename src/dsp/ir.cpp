@@ -9,7 +9,8 @@ void IRConvolver::reset()
 {
     convolution.reset();
     resetSmoothedValues();
-    loadIR();
+    if (type != loaded_type)
+        loadIR();
 }
 
 void IRConvolver::resetSmoothedValues()
@@ -29,6 +30,7 @@ void IRConvolver::prepare(const juce::dsp::ProcessSpec& spec)
     const size_t num_channels = spec.numChannels;
     const size_t num_samples = spec.maximumBlockSize;
     dry_buffer.setSize((int)num_channels, (int)num_samples, false, false, true);
+    convolution.prepare(spec);
     reset();
 }
 
@@ -36,11 +38,10 @@ void IRConvolver::process(
     const juce::dsp::ProcessContextReplacing<float>& context
 )
 {
+    // Only queues the new IR, the convolution engine swaps it in
+    // from its background thread
     if (type != loaded_type)
-    {
         loadIR();
-        loaded_type = type;
-    }
 
     auto& block = context.getOutputBlock();
     const size_t num_channels = block.getNumChannels();
@@ -73,5 +74,5 @@ void IRConvolver::loadIR()
         juce::dsp::Convolution::Trim::no, 0,
         juce::dsp::Convolution::Normalise::no
     );
-    convolution.prepare(processSpec);
+    loaded_type = type;
 }
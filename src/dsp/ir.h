@@ -35,6 +35,12 @@ class IRConvolver : juce::dsp::ProcessorBase
     {
         return filepath;
     }
+    double getTailLengthSeconds() const
+    {
+        if (processSpec.sampleRate <= 0.0)
+            return 0.0;
+        return convolution.getCurrentIRSize() / processSpec.sampleRate;
+    }
 
   private:
     juce::dsp::ProcessSpec processSpec{-1, 0, 0};
@@ -51,5 +57,9 @@ class IRConvolver : juce::dsp::ProcessorBase
     int type = 0;
     int loaded_type = -1;
 
-    juce::dsp::Convolution convolution;
+    // Every instance queues its IR loads on the same background thread,
+    // instead of each convolution starting its own
+    juce::SharedResourcePointer<juce::dsp::ConvolutionMessageQueue>
+        message_queue;
+    juce::dsp::Convolution convolution{*message_queue};
 };
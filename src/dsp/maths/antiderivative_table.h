@@ -0,0 +1,494 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ORBITAL_ADAA_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define ORBITAL_ADAA_NEON 1
+#endif
+
+// First and second antiderivatives of a uniformly sampled, linearly
+// interpolated waveshaper, for antiderivative anti-aliasing (ADAA).
+//
+// The antiderivatives are exact for the piecewise linear curve, so the
+// ADAA output converges to the plain table lookup for slow inputs. Outside
+// the table the curve is held at its end values, like the clamped lookup,
+// and the antiderivatives continue analytically. Everything is kept in
+// double: the ADAA quotients divide differences of F1/F2 by small input
+// steps.
+//
+// The table only points at the curve and its antiderivatives, which
+// integrate() fills ahead of time, so it can read arrays built into the
+// binary and initialise() does no numeric work.
+//
+// Two channels, as in dual mono, can run together with one channel in each
+// lane of a pair of doubles: the table reads stay per channel, the
+// antiderivative polynomials and the divisions are shared. Lanes whose
+// input step is too small for the quotient fall back to the scalar
+// expansions of the one channel path.
+//
+// Parker, Zavalishin & Le Bivic (2016), "Reducing the aliasing of
+// nonlinear waveshaping using continuous-time convolution", DAFx-16.
+class AntiderivativeTable
+{
+  public:
+    // Per-channel history of the ADAA filters
+    struct State
+    {
+        double x1 = 0.0;
+        double x2 = 0.0;
+        double f1_x1 = 0.0;
+        double f2_x1 = 0.0;
+        double d1_x1 = 0.0;
+    };
+
+    // F1[0] = F2[0] = 0 at min_input, then the exact integrals of each
+    // linear segment
+    static void integrate(
+        const float* values, size_t num_points, float min_input,
+        float max_input, double* f1, double* f2
+    )
+    {
+        const double step =
+            ((double)max_input - min_input) / (double)(num_points - 1);
+        f1[0] = 0.0;
+        f2[0] = 0.0;
+        for (size_t k = 0; k + 1 < num_points; ++k)
+        {
+            const double f_k = values[k];
+            const double f_k1 = values[k + 1];
+            f1[k + 1] = f1[k] + step * 0.5 * (f_k + f_k1);
+            f2[k + 1] =
+                f2[k] + step * f1[k] + step * step * (2.0 * f_k + f_k1) / 6.0;
+        }
+    }
+
+    // values, f1 and f2 hold num_points entries each and must outlive the
+    // table
+    void initialise(
+        const float* values, const double* values_f1,
+        const double* values_f2, size_t num_points, float min_input,
+        float max_input
+    )
+    {
+        f = values;
+        f1 = values_f1;
+        f2 = values_f2;
+        size = num_points;
+        min_value = min_input;
+        max_value = max_input;
+        step = ((double)max_input - min_input) / (double)(num_points - 1);
+        inv_step = 1.0 / step;
+    }
+
+    // Starts from a silent input, as after a reset
+    void reset(State& state) const
+    {
+        state = State();
+        if (f == nullptr)
+            return;
+        evaluate(0.0, state.f1_x1, state.f2_x1);
+        state.d1_x1 = state.f1_x1;
+    }
+
+    double evaluateCurve(double x) const
+    {
+        size_t k;
+        double t;
+        if (!locate(x, k, t))
+            return x <= min_value ? f[0] : f[size - 1];
+        return f[k] + t * ((double)f[k + 1] - f[k]);
+    }
+
+    double evaluateF1(double x) const
+    {
+        double value, unused;
+        evaluate(x, value, unused);
+        return value;
+    }
+
+    void evaluate(double x, double& value_f1, double& value_f2) const
+    {
+        size_t k;
+        double t;
+        if (!locate(x, k, t))
+        {
+            // Constant curve beyond the ends
+            size_t end = x <= min_value ? 0 : size - 1;
+            double d = x - (x <= min_value ? min_value : max_value);
+            value_f1 = f1[end] + f[end] * d;
+            value_f2 = f2[end] + f1[end] * d + 0.5 * f[end] * d * d;
+            return;
+        }
+        double slope = (double)f[k + 1] - f[k];
+        value_f1 = f1[k] + step * t * (f[k] + 0.5 * slope * t);
+        value_f2 = f2[k] + step * t * f1[k] +
+                   step * step * t * t * (0.5 * f[k] + slope * t / 6.0);
+    }
+
+    // y[n] = (F1(x[n]) - F1(x[n-1])) / (x[n] - x[n-1]), half a sample late
+    void processFirstOrder(State& state, float* samples, size_t num_samples)
+        const
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            double x = clampInput(samples[i]);
+            double value_f1 = evaluateF1(x);
+            double dx = x - state.x1;
+            double y = std::abs(dx) > epsilon
+                           ? (value_f1 - state.f1_x1) / dx
+                           : evaluateCurve(0.5 * (x + state.x1));
+            state.x1 = x;
+            state.f1_x1 = value_f1;
+            samples[i] = (float)y;
+        }
+    }
+
+    // Second order divided difference of F2, one sample late
+    void processSecondOrder(State& state, float* samples, size_t num_samples)
+        const
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            double x = clampInput(samples[i]);
+            double value_f1, value_f2;
+            evaluate(x, value_f1, value_f2);
+
+            double dx1 = x - state.x1;
+            double d1 = std::abs(dx1) > epsilon
+                            ? (value_f2 - state.f2_x1) / dx1
+                            : evaluateF1(0.5 * (x + state.x1));
+
+            double y;
+            double dx2 = x - state.x2;
+            if (std::abs(dx2) > epsilon)
+                y = 2.0 * (d1 - state.d1_x1) / dx2;
+            else
+                y = expandSecondOrder(x, state);
+
+            state.x2 = state.x1;
+            state.x1 = x;
+            state.f1_x1 = value_f1;
+            state.f2_x1 = value_f2;
+            state.d1_x1 = d1;
+            samples[i] = (float)y;
+        }
+    }
+
+    // Both channels at once, each on the history of its own state
+    void processFirstOrder(
+        State& left_state, State& right_state, float* left, float* right,
+        size_t num_samples
+    ) const
+    {
+#if ORBITAL_ADAA_SSE2 || ORBITAL_ADAA_NEON
+        Pair x1 = Pair::set(left_state.x1, right_state.x1);
+        Pair f1_x1 = Pair::set(left_state.f1_x1, right_state.f1_x1);
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            Pair x = clampInputs(Pair::load(&left[i], &right[i]));
+            Pair value_f1, value_f2;
+            evaluatePair(x, value_f1, value_f2);
+
+            Pair dx = Pair::sub(x, x1);
+            Pair y = Pair::div(Pair::sub(value_f1, f1_x1), dx);
+            double y_left = Pair::lane0(y);
+            double y_right = Pair::lane1(y);
+            int is_step = Pair::isAbove(dx, epsilon);
+            if ((is_step & 1) == 0)
+                y_left = evaluateCurve(
+                    0.5 * (Pair::lane0(x) + Pair::lane0(x1))
+                );
+            if ((is_step & 2) == 0)
+                y_right = evaluateCurve(
+                    0.5 * (Pair::lane1(x) + Pair::lane1(x1))
+                );
+
+            x1 = x;
+            f1_x1 = value_f1;
+            left[i] = (float)y_left;
+            right[i] = (float)y_right;
+        }
+        left_state.x1 = Pair::lane0(x1);
+        right_state.x1 = Pair::lane1(x1);
+        left_state.f1_x1 = Pair::lane0(f1_x1);
+        right_state.f1_x1 = Pair::lane1(f1_x1);
+#else
+        processFirstOrder(left_state, left, num_samples);
+        processFirstOrder(right_state, right, num_samples);
+#endif
+    }
+
+    void processSecondOrder(
+        State& left_state, State& right_state, float* left, float* right,
+        size_t num_samples
+    ) const
+    {
+#if ORBITAL_ADAA_SSE2 || ORBITAL_ADAA_NEON
+        Pair x1 = Pair::set(left_state.x1, right_state.x1);
+        Pair x2 = Pair::set(left_state.x2, right_state.x2);
+        Pair f1_x1 = Pair::set(left_state.f1_x1, right_state.f1_x1);
+        Pair f2_x1 = Pair::set(left_state.f2_x1, right_state.f2_x1);
+        Pair d1_x1 = Pair::set(left_state.d1_x1, right_state.d1_x1);
+        const Pair two = Pair::splat(2.0);
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            Pair x = clampInputs(Pair::load(&left[i], &right[i]));
+            Pair value_f1, value_f2;
+            evaluatePair(x, value_f1, value_f2);
+
+            Pair dx1 = Pair::sub(x, x1);
+            Pair d1 = Pair::div(Pair::sub(value_f2, f2_x1), dx1);
+            int is_step = Pair::isAbove(dx1, epsilon);
+            if (is_step != 3)
+            {
+                // Midpoint of the inputs where they did not move
+                auto x_mid = Pair::mul(Pair::splat(0.5), Pair::add(x, x1));
+                double d1_left = (is_step & 1) != 0
+                                     ? Pair::lane0(d1)
+                                     : evaluateF1(Pair::lane0(x_mid));
+                double d1_right = (is_step & 2) != 0
+                                      ? Pair::lane1(d1)
+                                      : evaluateF1(Pair::lane1(x_mid));
+                d1 = Pair::set(d1_left, d1_right);
+            }
+
+            Pair dx2 = Pair::sub(x, x2);
+            Pair y = Pair::div(Pair::mul(two, Pair::sub(d1, d1_x1)), dx2);
+            double y_left = Pair::lane0(y);
+            double y_right = Pair::lane1(y);
+            is_step = Pair::isAbove(dx2, epsilon);
+            if (is_step != 3)
+            {
+                // The expansions read the history before this sample
+                State history[2];
+                store(x1, x2, f1_x1, f2_x1, d1_x1, history[0], history[1]);
+                if ((is_step & 1) == 0)
+                    y_left = expandSecondOrder(Pair::lane0(x), history[0]);
+                if ((is_step & 2) == 0)
+                    y_right = expandSecondOrder(Pair::lane1(x), history[1]);
+            }
+
+            x2 = x1;
+            x1 = x;
+            f1_x1 = value_f1;
+            f2_x1 = value_f2;
+            d1_x1 = d1;
+            left[i] = (float)y_left;
+            right[i] = (float)y_right;
+        }
+        store(x1, x2, f1_x1, f2_x1, d1_x1, left_state, right_state);
+#else
+        processSecondOrder(left_state, left, num_samples);
+        processSecondOrder(right_state, right, num_samples);
+#endif
+    }
+
+  private:
+    static constexpr double epsilon = 1e-5;
+    static constexpr double input_margin = 1e3;
+
+    // Keeps inf and NaN (mapped to the low end) out of the history
+    double clampInput(double x) const
+    {
+        double low = min_value - input_margin;
+        double high = max_value + input_margin;
+        return x > low ? (x < high ? x : high) : low;
+    }
+
+    // Segment and position inside it, false outside the table
+    bool locate(double x, size_t& k, double& t) const
+    {
+        if (!(x > min_value && x < max_value))
+            return false;
+        double position = (x - min_value) * inv_step;
+        k = std::min((size_t)position, size - 2);
+        t = position - (double)k;
+        return true;
+    }
+
+    // Second order output when x[n] ~ x[n-2]: expands around their midpoint
+    // instead, from the history before x
+    double expandSecondOrder(double x, const State& state) const
+    {
+        double x_bar = 0.5 * (x + state.x2);
+        double delta = x_bar - state.x1;
+        if (std::abs(delta) > epsilon)
+        {
+            double f1_bar, f2_bar;
+            evaluate(x_bar, f1_bar, f2_bar);
+            return 2.0 / delta * (f1_bar + (state.f2_x1 - f2_bar) / delta);
+        }
+        return evaluateCurve(0.5 * (x_bar + state.x1));
+    }
+
+#if ORBITAL_ADAA_SSE2 || ORBITAL_ADAA_NEON
+    // Two doubles, one channel each
+    struct Pair
+    {
+#if ORBITAL_ADAA_SSE2
+        __m128d v;
+        static Pair set(double a, double b) { return {_mm_setr_pd(a, b)}; }
+        static Pair splat(double a) { return {_mm_set1_pd(a)}; }
+        static Pair load(const float* a, const float* b)
+        {
+            return {_mm_cvtps_pd(_mm_setr_ps(*a, *b, 0.0f, 0.0f))};
+        }
+        // maxpd returns its second operand, low, for NaN
+        static Pair clamp(Pair a, double low, double high)
+        {
+            return {_mm_min_pd(
+                _mm_max_pd(a.v, _mm_set1_pd(low)), _mm_set1_pd(high)
+            )};
+        }
+        static void truncate(Pair a, int* out)
+        {
+            auto i = _mm_cvttpd_epi32(a.v);
+            out[0] = _mm_cvtsi128_si32(i);
+            out[1] = _mm_cvtsi128_si32(_mm_srli_si128(i, 4));
+        }
+        static Pair add(Pair a, Pair b) { return {_mm_add_pd(a.v, b.v)}; }
+        static Pair sub(Pair a, Pair b) { return {_mm_sub_pd(a.v, b.v)}; }
+        static Pair mul(Pair a, Pair b) { return {_mm_mul_pd(a.v, b.v)}; }
+        static Pair div(Pair a, Pair b) { return {_mm_div_pd(a.v, b.v)}; }
+        static double lane0(Pair a) { return _mm_cvtsd_f64(a.v); }
+        static double lane1(Pair a)
+        {
+            return _mm_cvtsd_f64(_mm_unpackhi_pd(a.v, a.v));
+        }
+        // Bit 0 and 1 set where |a| > threshold, NaN differences included
+        // in neither
+        static int isAbove(Pair a, double threshold)
+        {
+            auto magnitude = _mm_andnot_pd(_mm_set1_pd(-0.0), a.v);
+            return _mm_movemask_pd(
+                _mm_cmpgt_pd(magnitude, _mm_set1_pd(threshold))
+            );
+        }
+#else
+        float64x2_t v;
+        static Pair set(double a, double b)
+        {
+            return {vsetq_lane_f64(b, vdupq_n_f64(a), 1)};
+        }
+        static Pair splat(double a) { return {vdupq_n_f64(a)}; }
+        static Pair load(const float* a, const float* b)
+        {
+            return set(*a, *b);
+        }
+        static Pair clamp(Pair a, double low, double high)
+        {
+            // vmaxnm picks low over NaN, as maxpd does on SSE2
+            return {vminq_f64(
+                vmaxnmq_f64(a.v, vdupq_n_f64(low)), vdupq_n_f64(high)
+            )};
+        }
+        static void truncate(Pair a, int* out)
+        {
+            auto i = vcvtq_s64_f64(a.v);
+            out[0] = (int)vgetq_lane_s64(i, 0);
+            out[1] = (int)vgetq_lane_s64(i, 1);
+        }
+        static Pair add(Pair a, Pair b) { return {vaddq_f64(a.v, b.v)}; }
+        static Pair sub(Pair a, Pair b) { return {vsubq_f64(a.v, b.v)}; }
+        static Pair mul(Pair a, Pair b) { return {vmulq_f64(a.v, b.v)}; }
+        static Pair div(Pair a, Pair b) { return {vdivq_f64(a.v, b.v)}; }
+        static double lane0(Pair a) { return vgetq_lane_f64(a.v, 0); }
+        static double lane1(Pair a) { return vgetq_lane_f64(a.v, 1); }
+        static int isAbove(Pair a, double threshold)
+        {
+            auto above = vcagtq_f64(a.v, vdupq_n_f64(threshold));
+            return (int)(vgetq_lane_u64(above, 0) & 1) |
+                   (int)(vgetq_lane_u64(above, 1) & 2);
+        }
+#endif
+    };
+
+    // clampInput() on both lanes, NaN included
+    Pair clampInputs(Pair x) const
+    {
+        return Pair::clamp(
+            x, min_value - input_margin, max_value + input_margin
+        );
+    }
+
+    // F1 and F2 of both inputs, without branches. The inputs are clamped to
+    // the table, the segment of each is read from its index, and the part
+    // beyond the ends (e) continues with the end value of the curve.
+    void evaluatePair(Pair x, Pair& value_f1, Pair& value_f2) const
+    {
+        auto x_c = Pair::clamp(x, min_value, max_value);
+        auto position = Pair::mul(
+            Pair::sub(x_c, Pair::splat(min_value)), Pair::splat(inv_step)
+        );
+        int k[2];
+        Pair::truncate(position, k);
+        const int last = (int)size - 2;
+        k[0] = std::min(k[0], last);
+        k[1] = std::min(k[1], last);
+
+        auto f_k = Pair::set(f[k[0]], f[k[1]]);
+        auto slope = Pair::mul(
+            Pair::sub(Pair::set(f[k[0] + 1], f[k[1] + 1]), f_k),
+            Pair::splat(inv_step)
+        );
+        auto f1_k = Pair::set(f1[k[0]], f1[k[1]]);
+        auto f2_k = Pair::set(f2[k[0]], f2[k[1]]);
+        auto start = Pair::add(
+            Pair::splat(min_value),
+            Pair::mul(Pair::set(k[0], k[1]), Pair::splat(step))
+        );
+        auto d = Pair::sub(x_c, start);
+        auto e = Pair::sub(x, x_c);
+        auto half = Pair::splat(0.5);
+
+        // Inside: f1 + d (f + s d / 2) and f2 + d f1 + d^2 (f / 2 + s d / 6)
+        auto s_d = Pair::mul(slope, d);
+        auto inside_f1 = Pair::add(
+            f1_k, Pair::mul(d, Pair::add(f_k, Pair::mul(half, s_d)))
+        );
+        auto inside_f2 = Pair::add(
+            Pair::add(f2_k, Pair::mul(d, f1_k)),
+            Pair::mul(
+                Pair::mul(d, d),
+                Pair::add(
+                    Pair::mul(half, f_k),
+                    Pair::mul(Pair::splat(1.0 / 6.0), s_d)
+                )
+            )
+        );
+        auto f_x_c = Pair::add(f_k, s_d);
+        value_f1 = Pair::add(inside_f1, Pair::mul(f_x_c, e));
+        value_f2 = Pair::add(
+            Pair::add(inside_f2, Pair::mul(inside_f1, e)),
+            Pair::mul(Pair::mul(half, f_x_c), Pair::mul(e, e))
+        );
+    }
+
+    static void store(
+        Pair x1, Pair x2, Pair f1_x1, Pair f2_x1, Pair d1_x1, State& left,
+        State& right
+    )
+    {
+        left = {Pair::lane0(x1), Pair::lane0(x2), Pair::lane0(f1_x1),
+                Pair::lane0(f2_x1), Pair::lane0(d1_x1)};
+        right = {Pair::lane1(x1), Pair::lane1(x2), Pair::lane1(f1_x1),
+                 Pair::lane1(f2_x1), Pair::lane1(d1_x1)};
+    }
+#endif
+
+    const float* f = nullptr;
+    const double* f1 = nullptr;
+    const double* f2 = nullptr;
+    size_t size = 0;
+    double min_value = 0.0;
+    double max_value = 0.0;
+    double step = 1.0;
+    double inv_step = 1.0;
+};
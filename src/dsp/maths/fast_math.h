@@ -0,0 +1,274 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ORBITAL_FAST_MATH_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ORBITAL_FAST_MATH_NEON 1
+#endif
+
+// Fast math shared by the circuit models: log2f_approx, pow2f_approx,
+// omega3 and omega4 from omega.h, and the Wright omega fit of the diode and
+// transistor models, over a batch of floats. The kernels are written once
+// against the batch operations and instantiated for four SIMD lanes (SSE2
+// or NEON, picked at compile time) and for single floats, which handle the
+// block tail and targets without SIMD. They keep the arithmetic of the
+// scalar functions, with the branches turned into selects: every lane
+// evaluates both sides of a branch.
+namespace FastMath
+{
+
+struct ScalarBatch
+{
+    using Float = float;
+    using Int = int32_t;
+    using Mask = bool;
+    static constexpr size_t size = 1;
+
+    static Float load(const float* p) { return *p; }
+    static void store(float* p, Float v) { *p = v; }
+    static Float set(float v) { return v; }
+    static Int setInt(int32_t v) { return v; }
+    static Float add(Float a, Float b) { return a + b; }
+    static Float sub(Float a, Float b) { return a - b; }
+    static Float mul(Float a, Float b) { return a * b; }
+    static Float div(Float a, Float b) { return a / b; }
+    static Float min(Float a, Float b) { return a < b ? a : b; }
+    static Float max(Float a, Float b) { return a > b ? a : b; }
+    static Mask less(Float a, Float b) { return a < b; }
+    static Float select(Mask m, Float a, Float b) { return m ? a : b; }
+    static Int truncate(Float v) { return (Int)v; }
+    static Float toFloat(Int v) { return (Float)v; }
+    static Int bits(Float v)
+    {
+        Int i;
+        std::memcpy(&i, &v, sizeof(i));
+        return i;
+    }
+    static Float fromBits(Int i)
+    {
+        Float v;
+        std::memcpy(&v, &i, sizeof(v));
+        return v;
+    }
+    static Int andInt(Int a, Int b) { return a & b; }
+    static Int orInt(Int a, Int b) { return a | b; }
+    static Int xorInt(Int a, Int b) { return a ^ b; }
+    static Int addInt(Int a, Int b) { return a + b; }
+    static Int subInt(Int a, Int b) { return a - b; }
+    static Int exponentToInt(Int v) { return v >> 23; }
+    static Int intToExponent(Int v) { return (Int)((uint32_t)v << 23); }
+};
+
+#if ORBITAL_FAST_MATH_SSE2
+#define ORBITAL_FAST_MATH_SIMD 1
+struct SimdBatch
+{
+    using Float = __m128;
+    using Int = __m128i;
+    using Mask = __m128;
+    static constexpr size_t size = 4;
+
+    static Float load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Float v) { _mm_storeu_ps(p, v); }
+    static Float set(float v) { return _mm_set1_ps(v); }
+    static Int setInt(int32_t v) { return _mm_set1_epi32(v); }
+    static Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static Float div(Float a, Float b) { return _mm_div_ps(a, b); }
+    static Float min(Float a, Float b) { return _mm_min_ps(a, b); }
+    static Float max(Float a, Float b) { return _mm_max_ps(a, b); }
+    static Mask less(Float a, Float b) { return _mm_cmplt_ps(a, b); }
+    static Float select(Mask m, Float a, Float b)
+    {
+        return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+    }
+    static Int truncate(Float v) { return _mm_cvttps_epi32(v); }
+    static Float toFloat(Int v) { return _mm_cvtepi32_ps(v); }
+    static Int bits(Float v) { return _mm_castps_si128(v); }
+    static Float fromBits(Int i) { return _mm_castsi128_ps(i); }
+    static Int andInt(Int a, Int b) { return _mm_and_si128(a, b); }
+    static Int orInt(Int a, Int b) { return _mm_or_si128(a, b); }
+    static Int xorInt(Int a, Int b) { return _mm_xor_si128(a, b); }
+    static Int addInt(Int a, Int b) { return _mm_add_epi32(a, b); }
+    static Int subInt(Int a, Int b) { return _mm_sub_epi32(a, b); }
+    static Int exponentToInt(Int v) { return _mm_srai_epi32(v, 23); }
+    static Int intToExponent(Int v) { return _mm_slli_epi32(v, 23); }
+};
+#elif ORBITAL_FAST_MATH_NEON
+#define ORBITAL_FAST_MATH_SIMD 1
+struct SimdBatch
+{
+    using Float = float32x4_t;
+    using Int = int32x4_t;
+    using Mask = uint32x4_t;
+    static constexpr size_t size = 4;
+
+    static Float load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Float v) { vst1q_f32(p, v); }
+    static Float set(float v) { return vdupq_n_f32(v); }
+    static Int setInt(int32_t v) { return vdupq_n_s32(v); }
+    static Float add(Float a, Float b) { return vaddq_f32(a, b); }
+    static Float sub(Float a, Float b) { return vsubq_f32(a, b); }
+    static Float mul(Float a, Float b) { return vmulq_f32(a, b); }
+    static Float div(Float a, Float b)
+    {
+#if defined(__aarch64__) || defined(_M_ARM64)
+        return vdivq_f32(a, b);
+#else
+        // Reciprocal estimate refined by two Newton steps
+        auto r = vrecpeq_f32(b);
+        r = vmulq_f32(r, vrecpsq_f32(b, r));
+        r = vmulq_f32(r, vrecpsq_f32(b, r));
+        return vmulq_f32(a, r);
+#endif
+    }
+    static Float min(Float a, Float b) { return vminq_f32(a, b); }
+    static Float max(Float a, Float b) { return vmaxq_f32(a, b); }
+    static Mask less(Float a, Float b) { return vcltq_f32(a, b); }
+    static Float select(Mask m, Float a, Float b)
+    {
+        return vbslq_f32(m, a, b);
+    }
+    static Int truncate(Float v) { return vcvtq_s32_f32(v); }
+    static Float toFloat(Int v) { return vcvtq_f32_s32(v); }
+    static Int bits(Float v) { return vreinterpretq_s32_f32(v); }
+    static Float fromBits(Int i) { return vreinterpretq_f32_s32(i); }
+    static Int andInt(Int a, Int b) { return vandq_s32(a, b); }
+    static Int orInt(Int a, Int b) { return vorrq_s32(a, b); }
+    static Int xorInt(Int a, Int b) { return veorq_s32(a, b); }
+    static Int addInt(Int a, Int b) { return vaddq_s32(a, b); }
+    static Int subInt(Int a, Int b) { return vsubq_s32(a, b); }
+    static Int exponentToInt(Int v) { return vshrq_n_s32(v, 23); }
+    static Int intToExponent(Int v) { return vshlq_n_s32(v, 23); }
+};
+#endif
+
+template <typename B>
+inline typename B::Float abs(typename B::Float x)
+{
+    return B::fromBits(B::andInt(B::bits(x), B::setInt(0x7fffffff)));
+}
+
+// y with its sign flipped where x is negative (sign bit set)
+template <typename B>
+inline typename B::Float flipSign(typename B::Float y, typename B::Float x)
+{
+    auto sign_bit = B::andInt(B::bits(x), B::setInt((int32_t)0x80000000));
+    return B::fromBits(B::xorInt(B::bits(y), sign_bit));
+}
+
+// +1, -1 or 0 for positive, negative or zero x
+template <typename B>
+inline typename B::Float sign(typename B::Float x)
+{
+    auto sign_bit = B::andInt(B::bits(x), B::setInt((int32_t)0x80000000));
+    auto one = B::fromBits(B::orInt(sign_bit, B::setInt(0x3f800000)));
+    return B::select(B::less(B::set(0.0f), abs<B>(x)), one, B::set(0.0f));
+}
+
+template <typename B>
+inline typename B::Float log2(typename B::Float x)
+{
+    auto i = B::bits(x);
+    auto ex = B::andInt(i, B::setInt(0x7f800000));
+    auto e = B::subInt(B::exponentToInt(ex), B::setInt(127));
+    auto m = B::fromBits(B::orInt(B::subInt(i, ex), B::setInt(0x3f800000)));
+    auto p = B::add(
+        B::set(-1.098865286222744f), B::mul(m, B::set(0.1640425613334452f))
+    );
+    p = B::mul(m, B::add(B::set(3.148297929334117f), B::mul(m, p)));
+    return B::add(B::sub(B::toFloat(e), B::set(2.213475204444817f)), p);
+}
+
+// Below -126 the result is flushed to zero, as in pow2f_approx. The integer
+// part is rounded towards minus infinity by stepping down the truncation of
+// negative inputs.
+template <typename B>
+inline typename B::Float pow2(typename B::Float x)
+{
+    // Keeps every lane inside the range of the integer conversion, above
+    // 128 the exponent saturates to infinity
+    auto clamped = B::min(B::max(x, B::set(-127.0f)), B::set(128.0f));
+    auto truncated = B::toFloat(B::truncate(clamped));
+    auto floor = B::select(
+        B::less(clamped, B::set(0.0f)), B::sub(truncated, B::set(1.0f)),
+        truncated
+    );
+    auto f = B::sub(clamped, floor);
+    auto v = B::fromBits(
+        B::intToExponent(B::addInt(B::truncate(floor), B::setInt(127)))
+    );
+    auto p = B::add(
+        B::set(0.2274112777602189f), B::mul(f, B::set(0.07944154167983575f))
+    );
+    p = B::add(B::set(0.6931471805599453f), B::mul(f, p));
+    p = B::add(B::set(1.0f), B::mul(f, p));
+    return B::select(
+        B::less(x, B::set(-126.0f)), B::set(0.0f), B::mul(v, p)
+    );
+}
+
+template <typename B>
+inline typename B::Float log(typename B::Float x)
+{
+    return B::mul(B::set(0.693147180559945f), log2<B>(x));
+}
+
+template <typename B>
+inline typename B::Float exp(typename B::Float x)
+{
+    return pow2<B>(B::mul(B::set(1.442695040888963f), x));
+}
+
+template <typename B>
+inline typename B::Float omega3(typename B::Float x)
+{
+    auto p = B::add(
+        B::set(4.775931364975583e-2f), B::mul(x, B::set(-1.314293149877800e-3f))
+    );
+    p = B::add(B::set(3.631952663804445e-1f), B::mul(x, p));
+    p = B::add(B::set(6.313183464296682e-1f), B::mul(x, p));
+    auto y = B::select(
+        B::less(x, B::set(8.0f)), p, B::sub(x, log<B>(x))
+    );
+    return B::select(B::less(x, B::set(-3.341459552768620f)), B::set(0.0f), y);
+}
+
+// One Newton-Raphson step on omega3
+template <typename B>
+inline typename B::Float omega4(typename B::Float x)
+{
+    auto y = omega3<B>(x);
+    return B::sub(
+        y,
+        B::div(
+            B::sub(y, exp<B>(B::sub(x, y))), B::add(y, B::set(1.0f))
+        )
+    );
+}
+
+// Wright omega as the diode and transistor models use it: a fifth order fit
+// around zero and omega4 further out
+template <typename B>
+inline typename B::Float wrightOmega(typename B::Float x)
+{
+    auto p = B::add(
+        B::set(-0.0016355437889344f), B::mul(x, B::set(0.0002166542734346f))
+    );
+    p = B::add(B::set(-0.0013437346889135f), B::mul(x, p));
+    p = B::add(B::set(0.0736778463779836f), B::mul(x, p));
+    p = B::add(B::set(0.3618963236098023f), B::mul(x, p));
+    p = B::add(B::set(0.5671432904097838f), B::mul(x, p));
+    return B::select(B::less(B::set(1.5f), abs<B>(x)), omega4<B>(x), p);
+}
+
+} // namespace FastMath
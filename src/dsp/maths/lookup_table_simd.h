@@ -0,0 +1,306 @@
+#pragma once
+
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ORBITAL_LUT_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) ||                                  \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define ORBITAL_LUT_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define ORBITAL_LUT_NEON 1
+#endif
+
+// Block evaluation of uniformly sampled lookup tables, shared by the CMOS
+// waveshaper and LookupTableTransformCubic. The batch operations also serve
+// the piecewise polynomials of piecewise_polynomial.h.
+//
+// The input is clamped to [min_input, max_input] and the segment index is
+// clamped to the last segment, so the end points interpolate to the first
+// and last table values without any branch or guard point. The same kernel
+// code is instantiated for a SIMD batch (AVX2, SSE2 or NEON, picked at
+// compile time) and for single floats, which handle the block tail and
+// targets without SIMD. NaN inputs evaluate to the first table value.
+namespace LookupTableSimd
+{
+
+struct Table
+{
+    const float* values = nullptr;
+    // Cubic only: slope at each point, already multiplied by the step size
+    const float* derivatives = nullptr;
+    float min_input = 0.0f;
+    float max_input = 0.0f;
+    // (num_points - 1) / (max_input - min_input)
+    float scale = 0.0f;
+    // num_points - 2, index of the last segment
+    float last_segment = 0.0f;
+
+    static Table make(
+        const float* values, const float* derivatives, size_t num_points,
+        float min_input, float max_input
+    )
+    {
+        Table table;
+        table.values = values;
+        table.derivatives = derivatives;
+        table.min_input = min_input;
+        table.max_input = max_input;
+        table.scale = (float)(num_points - 1) / (max_input - min_input);
+        table.last_segment = (float)(num_points - 2);
+        return table;
+    }
+};
+
+struct ScalarBatch
+{
+    using Float = float;
+    using Int = int;
+    static constexpr size_t size = 1;
+
+    static Float load(const float* p) { return *p; }
+    static void store(float* p, Float v) { *p = v; }
+    static Float set(float v) { return v; }
+    // Operand order matches minps/maxps: a NaN in a returns b
+    static Float min(Float a, Float b) { return a < b ? a : b; }
+    static Float max(Float a, Float b) { return a > b ? a : b; }
+    static Float add(Float a, Float b) { return a + b; }
+    static Float sub(Float a, Float b) { return a - b; }
+    static Float mul(Float a, Float b) { return a * b; }
+    static Int truncate(Float v) { return (Int)v; }
+    static Float toFloat(Int v) { return (Float)v; }
+    static Float gather(const float* table, Int index) { return table[index]; }
+    // The four floats at table + index, one record per lane
+    static void gatherRecords(
+        const float* table, Int index, Float& a, Float& b, Float& c, Float& d
+    )
+    {
+        a = table[index];
+        b = table[index + 1];
+        c = table[index + 2];
+        d = table[index + 3];
+    }
+};
+
+#if ORBITAL_LUT_AVX2
+#define ORBITAL_LUT_SIMD 1
+struct SimdBatch
+{
+    using Float = __m256;
+    using Int = __m256i;
+    static constexpr size_t size = 8;
+
+    static Float load(const float* p) { return _mm256_loadu_ps(p); }
+    static void store(float* p, Float v) { _mm256_storeu_ps(p, v); }
+    static Float set(float v) { return _mm256_set1_ps(v); }
+    static Float min(Float a, Float b) { return _mm256_min_ps(a, b); }
+    static Float max(Float a, Float b) { return _mm256_max_ps(a, b); }
+    static Float add(Float a, Float b) { return _mm256_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm256_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm256_mul_ps(a, b); }
+    static Int truncate(Float v) { return _mm256_cvttps_epi32(v); }
+    static Float toFloat(Int v) { return _mm256_cvtepi32_ps(v); }
+    static Float gather(const float* table, Int index)
+    {
+        return _mm256_i32gather_ps(table, index, 4);
+    }
+    static void gatherRecords(
+        const float* table, Int index, Float& a, Float& b, Float& c, Float& d
+    )
+    {
+        a = _mm256_i32gather_ps(table, index, 4);
+        b = _mm256_i32gather_ps(table + 1, index, 4);
+        c = _mm256_i32gather_ps(table + 2, index, 4);
+        d = _mm256_i32gather_ps(table + 3, index, 4);
+    }
+};
+#elif ORBITAL_LUT_SSE2
+#define ORBITAL_LUT_SIMD 1
+struct SimdBatch
+{
+    using Float = __m128;
+    using Int = __m128i;
+    static constexpr size_t size = 4;
+
+    static Float load(const float* p) { return _mm_loadu_ps(p); }
+    static void store(float* p, Float v) { _mm_storeu_ps(p, v); }
+    static Float set(float v) { return _mm_set1_ps(v); }
+    static Float min(Float a, Float b) { return _mm_min_ps(a, b); }
+    static Float max(Float a, Float b) { return _mm_max_ps(a, b); }
+    static Float add(Float a, Float b) { return _mm_add_ps(a, b); }
+    static Float sub(Float a, Float b) { return _mm_sub_ps(a, b); }
+    static Float mul(Float a, Float b) { return _mm_mul_ps(a, b); }
+    static Int truncate(Float v) { return _mm_cvttps_epi32(v); }
+    static Float toFloat(Int v) { return _mm_cvtepi32_ps(v); }
+    static Float gather(const float* table, Int index)
+    {
+        alignas(16) int i[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(i), index);
+        return _mm_setr_ps(table[i[0]], table[i[1]], table[i[2]], table[i[3]]);
+    }
+    // One load per record and a transpose instead of four gathers
+    static void gatherRecords(
+        const float* table, Int index, Float& a, Float& b, Float& c, Float& d
+    )
+    {
+        alignas(16) int i[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(i), index);
+        a = _mm_loadu_ps(table + i[0]);
+        b = _mm_loadu_ps(table + i[1]);
+        c = _mm_loadu_ps(table + i[2]);
+        d = _mm_loadu_ps(table + i[3]);
+        _MM_TRANSPOSE4_PS(a, b, c, d);
+    }
+};
+#elif ORBITAL_LUT_NEON
+#define ORBITAL_LUT_SIMD 1
+struct SimdBatch
+{
+    using Float = float32x4_t;
+    using Int = int32x4_t;
+    static constexpr size_t size = 4;
+
+    static Float load(const float* p) { return vld1q_f32(p); }
+    static void store(float* p, Float v) { vst1q_f32(p, v); }
+    static Float set(float v) { return vdupq_n_f32(v); }
+    // vminq/vmaxq propagate NaN, select explicitly to match minps/maxps
+    static Float min(Float a, Float b)
+    {
+        return vbslq_f32(vcltq_f32(a, b), a, b);
+    }
+    static Float max(Float a, Float b)
+    {
+        return vbslq_f32(vcgtq_f32(a, b), a, b);
+    }
+    static Float add(Float a, Float b) { return vaddq_f32(a, b); }
+    static Float sub(Float a, Float b) { return vsubq_f32(a, b); }
+    static Float mul(Float a, Float b) { return vmulq_f32(a, b); }
+    static Int truncate(Float v) { return vcvtq_s32_f32(v); }
+    static Float toFloat(Int v) { return vcvtq_f32_s32(v); }
+    static Float gather(const float* table, Int index)
+    {
+        int i[4];
+        vst1q_s32(i, index);
+        float v[4] = {table[i[0]], table[i[1]], table[i[2]], table[i[3]]};
+        return vld1q_f32(v);
+    }
+    static void gatherRecords(
+        const float* table, Int index, Float& a, Float& b, Float& c, Float& d
+    )
+    {
+        int i[4];
+        vst1q_s32(i, index);
+        auto r01 = vtrnq_f32(vld1q_f32(table + i[0]), vld1q_f32(table + i[1]));
+        auto r23 = vtrnq_f32(vld1q_f32(table + i[2]), vld1q_f32(table + i[3]));
+        a = vcombine_f32(vget_low_f32(r01.val[0]), vget_low_f32(r23.val[0]));
+        b = vcombine_f32(vget_low_f32(r01.val[1]), vget_low_f32(r23.val[1]));
+        c = vcombine_f32(vget_high_f32(r01.val[0]), vget_high_f32(r23.val[0]));
+        d = vcombine_f32(vget_high_f32(r01.val[1]), vget_high_f32(r23.val[1]));
+    }
+};
+#endif
+
+// Splits x into a segment index and the position t in [0, 1] inside it
+template <typename B>
+inline typename B::Int locate(
+    const Table& table, typename B::Float x, typename B::Float& t
+)
+{
+    auto min_input = B::set(table.min_input);
+    auto clamped = B::min(B::max(x, min_input), B::set(table.max_input));
+    auto position = B::mul(B::sub(clamped, min_input), B::set(table.scale));
+    auto index = B::truncate(B::min(position, B::set(table.last_segment)));
+    t = B::sub(position, B::toFloat(index));
+    return index;
+}
+
+template <typename B>
+struct Linear
+{
+    static typename B::Float evaluate(const Table& table, typename B::Float x)
+    {
+        typename B::Float t;
+        auto index = locate<B>(table, x, t);
+        auto y0 = B::gather(table.values, index);
+        auto y1 = B::gather(table.values + 1, index);
+        return B::add(y0, B::mul(t, B::sub(y1, y0)));
+    }
+};
+
+template <typename B>
+struct Cubic
+{
+    // Cubic Hermite interpolation:
+    // H(t) = (2t³ - 3t² + 1)y₀ + (t³ - 2t² + t)d₀ + (-2t³ + 3t²)y₁ + (t³ -
+    // t²)d₁
+    static typename B::Float evaluate(const Table& table, typename B::Float x)
+    {
+        typename B::Float t;
+        auto index = locate<B>(table, x, t);
+        auto y0 = B::gather(table.values, index);
+        auto y1 = B::gather(table.values + 1, index);
+        auto d0 = B::gather(table.derivatives, index);
+        auto d1 = B::gather(table.derivatives + 1, index);
+
+        auto t2 = B::mul(t, t);
+        auto t3 = B::mul(t2, t);
+        auto t2_minus_t3 = B::sub(t2, t3);
+
+        // h01 = 3t² - 2t³, h00 = 1 - h01
+        auto h01 = B::add(t2_minus_t3, B::add(t2_minus_t3, t2));
+        auto h00 = B::sub(B::set(1.0f), h01);
+        // h10 = t³ - 2t² + t, h11 = t³ - t²
+        auto h11 = B::sub(t3, t2);
+        auto h10 = B::add(B::sub(h11, t2), t);
+
+        auto y = B::add(B::mul(h00, y0), B::mul(h01, y1));
+        return B::add(y, B::add(B::mul(h10, d0), B::mul(h11, d1)));
+    }
+};
+
+// Evaluates num_samples values, input and output may be the same buffer
+template <template <typename> class Kernel>
+inline void processBlock(
+    const Table& table, const float* input, float* output, size_t num_samples
+)
+{
+    size_t i = 0;
+#if ORBITAL_LUT_SIMD
+    for (; i + SimdBatch::size <= num_samples; i += SimdBatch::size)
+        SimdBatch::store(
+            output + i,
+            Kernel<SimdBatch>::evaluate(table, SimdBatch::load(input + i))
+        );
+#endif
+    for (; i < num_samples; ++i)
+        output[i] = Kernel<ScalarBatch>::evaluate(table, input[i]);
+}
+
+inline float processLinear(const Table& table, float x)
+{
+    return Linear<ScalarBatch>::evaluate(table, x);
+}
+
+inline void processLinear(
+    const Table& table, const float* input, float* output, size_t num_samples
+)
+{
+    processBlock<Linear>(table, input, output, num_samples);
+}
+
+inline float processCubic(const Table& table, float x)
+{
+    return Cubic<ScalarBatch>::evaluate(table, x);
+}
+
+inline void processCubic(
+    const Table& table, const float* input, float* output, size_t num_samples
+)
+{
+    processBlock<Cubic>(table, input, output, num_samples);
+}
+
+} // namespace LookupTableSimd
@@ -1,8 +1,10 @@
 #pragma once
 
+#include "lookup_table_simd.h"
 #include <algorithm>
 #include <cmath>
 #include <functional>
+#include <type_traits>
 #include <vector>
 
 template <typename FloatType>
@@ -67,6 +69,10 @@ class LookupTableTransformCubic
         // Pre-calculate reciprocal for faster division
         range = maxInputValue - minInputValue;
         inv_range = (numPoints - 1) / range;
+
+        // Scale derivatives by step size for Hermite interpolation
+        for (auto& d : derivatives)
+            d *= step;
     }
 
     /**
@@ -102,13 +108,6 @@ class LookupTableTransformCubic
         FloatType d0 = derivatives[index];
         FloatType d1 = derivatives[index + 1];
 
-        // Calculate step size for this segment
-        FloatType h = range / (num_points - 1);
-
-        // Scale derivatives by step size for Hermite interpolation
-        d0 *= h;
-        d1 *= h;
-
         // Cubic Hermite interpolation
         // H(t) = (2t³ - 3t² + 1)y₀ + (t³ - 2t² + t)d₀ + (-2t³ + 3t²)y₁ + (t³
         // - t²)d₁
@@ -124,6 +123,33 @@ class LookupTableTransformCubic
         return h00 * y0 + h10 * d0 + h01 * y1 + h11 * d1;
     }
 
+    /**
+     * Processes a block of samples, with the SIMD kernel of
+     * lookup_table_simd.h for float tables.
+     *
+     * @param input The input values, may be the same buffer as output
+     * @param output The interpolated output values
+     * @param numSamples The number of samples to process
+     */
+    void processBlock(
+        const FloatType* input, FloatType* output, size_t numSamples
+    ) const
+    {
+        if constexpr (std::is_same_v<FloatType, float>)
+        {
+            auto view = LookupTableSimd::Table::make(
+                table.data(), derivatives.data(), num_points, min_value,
+                max_value
+            );
+            LookupTableSimd::processCubic(view, input, output, numSamples);
+        }
+        else
+        {
+            for (size_t i = 0; i < numSamples; ++i)
+                output[i] = processSample(input[i]);
+        }
+    }
+
   private:
     std::vector<FloatType> table;
     std::vector<FloatType> derivatives;
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "lookup_table_simd.h"
+#include <cstddef>
+
+// Piecewise cubic approximation of a waveshaper, with breakpoints placed by
+// the offline fitter of tools/minimax_fitter.h: long segments where the
+// curve is smooth or saturated, short ones around its knees. It replaces a
+// uniform table of thousands of points by a few kilobytes that stay in L1
+// cache.
+//
+// The segments are found in two uniform steps instead of a search. The
+// input range is split into num_cells cells, and each cell into as many
+// equal subcells as its finest segment needs, so no subcell straddles a
+// breakpoint. A cell record holds the offset of its first subcell record
+// and its number of subcells; a subcell record holds the cubic in
+// s = (x - subcell centre) / subcell width, with s in [-0.5, 0.5]. Both are
+// four floats, fetched with LookupTableSimd gatherRecords: no data
+// dependent branch and two table reads per sample. Inputs are clamped to
+// [min_input, max_input] and NaN evaluates at min_input, like the uniform
+// tables.
+namespace PiecewisePolynomial
+{
+
+inline constexpr size_t degree = 3;
+// Floats per cell and per subcell record
+inline constexpr size_t record_size = 4;
+
+struct Table
+{
+    // num_cells records of {first subcell offset, num subcells, 0, 0}, the
+    // offset counted in floats
+    const float* cells = nullptr;
+    // Coefficients of s^0 to s^3 for each subcell
+    const float* subcells = nullptr;
+    size_t num_cells = 0;
+    float min_input = 0.0f;
+    float max_input = 0.0f;
+    // num_cells / (max_input - min_input)
+    float scale = 0.0f;
+
+    static Table make(
+        const float* cells, const float* subcells, size_t num_cells,
+        float min_input, float max_input
+    )
+    {
+        Table table;
+        table.cells = cells;
+        table.subcells = subcells;
+        table.num_cells = num_cells;
+        table.min_input = min_input;
+        table.max_input = max_input;
+        table.scale = (float)num_cells / (max_input - min_input);
+        return table;
+    }
+};
+
+template <typename B>
+inline typename B::Float evaluate(const Table& table, typename B::Float x)
+{
+    const auto min_input = B::set(table.min_input);
+    x = B::min(B::max(x, min_input), B::set(table.max_input));
+    auto position = B::mul(B::sub(x, min_input), B::set(table.scale));
+    auto cell = B::truncate(
+        B::min(position, B::set((float)(table.num_cells - 1)))
+    );
+    auto fraction = B::sub(position, B::toFloat(cell));
+
+    const auto record_floats = B::set((float)record_size);
+    typename B::Float offset, num_subcells, unused_a, unused_b;
+    B::gatherRecords(
+        table.cells, B::truncate(B::mul(B::toFloat(cell), record_floats)),
+        offset, num_subcells, unused_a, unused_b
+    );
+    auto sub_position = B::mul(fraction, num_subcells);
+    auto subcell = B::toFloat(B::truncate(
+        B::min(sub_position, B::sub(num_subcells, B::set(1.0f)))
+    ));
+    auto s = B::sub(B::sub(sub_position, subcell), B::set(0.5f));
+
+    typename B::Float c0, c1, c2, c3;
+    B::gatherRecords(
+        table.subcells,
+        B::truncate(B::add(offset, B::mul(subcell, record_floats))), c0, c1,
+        c2, c3
+    );
+    auto y = B::add(c2, B::mul(s, c3));
+    y = B::add(c1, B::mul(s, y));
+    return B::add(c0, B::mul(s, y));
+}
+
+inline float process(const Table& table, float x)
+{
+    return evaluate<LookupTableSimd::ScalarBatch>(table, x);
+}
+
+// input and output may be the same buffer
+inline void process(
+    const Table& table, const float* input, float* output, size_t num_samples
+)
+{
+    size_t i = 0;
+#if ORBITAL_LUT_SIMD
+    using Simd = LookupTableSimd::SimdBatch;
+    for (; i + Simd::size <= num_samples; i += Simd::size)
+        Simd::store(output + i, evaluate<Simd>(table, Simd::load(input + i)));
+#endif
+    for (; i < num_samples; ++i)
+        output[i] = process(table, input[i]);
+}
+
+} // namespace PiecewisePolynomial
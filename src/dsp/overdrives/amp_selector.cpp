@@ -0,0 +1,159 @@
+#include "amp_selector.h"
+#include <algorithm>
+#include <cmath>
+
+#include <juce_dsp/juce_dsp.h>
+
+void AmpSelector::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    for (auto* model : models)
+        model->prepare(spec);
+
+    std::array<float, num_models> latencies = {
+        helios_model.getLatencyInSamples(),
+        borealis_model.getLatencyInSamples(),
+        nebula_model.getLatencyInSamples(),
+        pulsar_model.getLatencyInSamples()
+    };
+    latency = *std::max_element(latencies.begin(), latencies.end());
+    for (size_t model = 0; model < num_models; ++model)
+    {
+        delay_samples[model] = latency - latencies[model];
+        delays[model].prepare(spec);
+        delays[model].setMaximumDelayInSamples(
+            std::max(1, (int)std::ceil(delay_samples[model]))
+        );
+        delays[model].setDelay(delay_samples[model]);
+    }
+
+    fade_buffer.setSize(
+        (int)spec.numChannels, (int)spec.maximumBlockSize, false, false, true
+    );
+    fade.reset(spec.sampleRate, fade_time);
+    reset();
+}
+
+void AmpSelector::reset()
+{
+    if (pending_model >= 0)
+        active_model = pending_model;
+    pending_model = -1;
+    fading_model = -1;
+    fade.setCurrentAndTargetValue(1.0f);
+    resetModel(active_model);
+}
+
+void AmpSelector::resetModel(int model)
+{
+    models[(size_t)model]->reset();
+    delays[(size_t)model].reset();
+}
+
+void AmpSelector::setModel(int model)
+{
+    model = juce::jlimit(0, (int)num_models - 1, model);
+    if (model == active_model)
+    {
+        pending_model = -1;
+        return;
+    }
+
+    if (fading_model < 0)
+    {
+        startFade(model);
+        return;
+    }
+
+    if (model == fading_model)
+    {
+        // Back to the outgoing model before the fade ended: swap the roles
+        // and fade back from where the mix is
+        pending_model = -1;
+        fading_model = active_model;
+        active_model = model;
+        fade.setCurrentAndTargetValue(1.0f - fade.getCurrentValue());
+        fade.setTargetValue(1.0f);
+        return;
+    }
+
+    // Both models are still in the mix, a third one waits for the fade to
+    // end rather than cutting the outgoing one
+    pending_model = model;
+}
+
+void AmpSelector::startFade(int model)
+{
+    fading_model = active_model;
+    active_model = model;
+    resetModel(active_model);
+    fade.setCurrentAndTargetValue(0.0f);
+    fade.setTargetValue(1.0f);
+}
+
+void AmpSelector::processModel(
+    int model, juce::dsp::AudioBlock<float>& block
+)
+{
+    juce::dsp::ProcessContextReplacing<float> context(block);
+    models[(size_t)model]->process(context);
+    if (delay_samples[(size_t)model] <= 0.0f)
+        return;
+
+    // Sample by sample on the channels of the block, which may be fewer
+    // than the delay was prepared for: DelayLine::process requires the
+    // channel counts to match
+    auto& delay = delays[(size_t)model];
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        auto* ch = block.getChannelPointer(channel);
+        for (size_t i = 0; i < block.getNumSamples(); ++i)
+        {
+            delay.pushSample((int)channel, ch[i]);
+            ch[i] = delay.popSample((int)channel);
+        }
+    }
+}
+
+void AmpSelector::process(
+    const juce::dsp::ProcessContextReplacing<float>& context
+)
+{
+    auto& block = context.getOutputBlock();
+    if (fading_model < 0)
+    {
+        processModel(active_model, block);
+        return;
+    }
+
+    const size_t num_channels = block.getNumChannels();
+    const size_t num_samples = block.getNumSamples();
+    auto outgoing = juce::dsp::AudioBlock<float>(fade_buffer)
+                        .getSubsetChannelBlock(0, num_channels)
+                        .getSubBlock(0, num_samples);
+    outgoing.copyFrom(block);
+    processModel(fading_model, outgoing);
+    processModel(active_model, block);
+
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        float current_fade = fade.getNextValue();
+        for (size_t channel = 0; channel < num_channels; ++channel)
+        {
+            auto* ch = block.getChannelPointer(channel);
+            float out = outgoing.getChannelPointer(channel)[i];
+            ch[i] = out + (ch[i] - out) * current_fade;
+        }
+    }
+
+    // The outgoing model stops here and is reset when it is selected again.
+    // A selection made during the fade starts its own from here.
+    if (!fade.isSmoothing())
+    {
+        fading_model = -1;
+        if (pending_model >= 0)
+        {
+            startFade(pending_model);
+            pending_model = -1;
+        }
+    }
+}
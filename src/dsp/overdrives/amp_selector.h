@@ -0,0 +1,132 @@
+#pragma once
+
+#include "borealis.h"
+#include "helios.h"
+#include "nebula.h"
+#include "overdrive.h"
+#include "pulsar.h"
+#include <array>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+
+// The amp models behind the amp node. Every model is prepared up front and
+// receives every parameter change, but only the selected one is processed.
+// Changing the model resets the incoming one and crossfades to it, running
+// both models only for the length of the fade, so nothing is allocated or
+// rebuilt on the audio thread. Models with less latency than the slowest
+// one are delayed to match it, the reported latency stays the same.
+class AmpSelector : juce::dsp::ProcessorBase
+{
+  public:
+    // Same order as ampTypeChoices in parameters.h
+    enum Model
+    {
+        helios,
+        borealis,
+        nebula,
+        pulsar,
+        num_models
+    };
+
+    void prepare(const juce::dsp::ProcessSpec& spec) override;
+    void process(
+        const juce::dsp::ProcessContextReplacing<float>& context
+    ) override;
+    void reset() override;
+
+    // Called from the audio thread, starts the crossfade to the new model,
+    // or queues it while a crossfade is running
+    void setModel(int model);
+    int getModel() const
+    {
+        return active_model;
+    }
+
+    // Helios only, applied on the next prepare()
+    void setOversampling(size_t factor, bool linear_phase)
+    {
+        helios_model.setOversampling(factor, linear_phase);
+    }
+
+    float getLatencyInSamples() const
+    {
+        return latency;
+    }
+
+    void setLevel(float v)
+    {
+        for (auto* model : models)
+            model->setLevel(v);
+    }
+    void setMix(float v)
+    {
+        for (auto* model : models)
+            model->setMix(v);
+    }
+    void setDrive(float v)
+    {
+        for (auto* model : models)
+            model->setDrive(v);
+    }
+    void setAttack(float v)
+    {
+        for (auto* model : models)
+            model->setAttack(v);
+    }
+    void setGrunt(float v)
+    {
+        for (auto* model : models)
+            model->setGrunt(v);
+    }
+    void setEra(float v)
+    {
+        for (auto* model : models)
+            model->setEra(v);
+    }
+    void setCrossFrequency(float v)
+    {
+        for (auto* model : models)
+            model->setCrossFrequency(v);
+    }
+    void setBassFrequency(float v)
+    {
+        for (auto* model : models)
+            model->setBassFrequency(v);
+    }
+    // Applied to the latency on the next prepare()
+    void setAdaaOrder(int order)
+    {
+        for (auto* model : models)
+            model->setAdaaOrder(order);
+    }
+
+  private:
+    HeliosOverdrive helios_model;
+    BorealisOverdrive borealis_model;
+    NebulaOverdrive nebula_model;
+    PulsarOverdrive pulsar_model;
+    std::array<Overdrive*, num_models> models{
+        &helios_model, &borealis_model, &nebula_model, &pulsar_model
+    };
+
+    // ADAA makes the latencies fractional, Thiran keeps the compensation
+    // flat in magnitude
+    using CompensationDelay = juce::dsp::DelayLine<
+        float, juce::dsp::DelayLineInterpolationTypes::Thiran>;
+    std::array<CompensationDelay, num_models> delays;
+    std::array<float, num_models> delay_samples{};
+    float latency = 0.0f;
+    void processModel(int model, juce::dsp::AudioBlock<float>& block);
+    void resetModel(int model);
+
+    // The outgoing model runs on a copy of the input in fade_buffer, -1
+    // when no fade is in progress. fade goes from 0 to 1 (all incoming).
+    // A model selected during a fade waits in pending_model for it to end.
+    int active_model = helios;
+    int fading_model = -1;
+    int pending_model = -1;
+    void startFade(int model);
+    float fade_time = 0.05f;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> fade;
+    juce::AudioBuffer<float> fade_buffer;
+};
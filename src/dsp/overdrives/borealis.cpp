@@ -7,7 +7,11 @@
 void BorealisOverdrive::reset()
 {
     cmos.reset();
-    oversampler2x.reset();
+    low_delay.reset();
+    dry_delay.reset();
+    if (oversampler2x != nullptr)
+        oversampler2x->reset();
+    control_rate.reset();
     resetFilters();
     resetSmoothedValues();
     prepareFilters();
@@ -15,14 +19,9 @@ void BorealisOverdrive::reset()
 
 void BorealisOverdrive::resetFilters()
 {
-    pre_hpf.reset();
-    pre_lpf.reset();
-    lowmids_lpf.reset();
-    post_lpf.reset();
-    post_lpf2.reset();
-    x_hpf.reset();
-    bass_lpf.reset();
-    drive_filter.reset();
+    low_filters.reset();
+    high_filters.reset();
+    post_filters.reset();
 }
 
 void BorealisOverdrive::resetSmoothedValues()
@@ -45,8 +44,10 @@ void BorealisOverdrive::prepare(const juce::dsp::ProcessSpec& spec)
     oversampled_spec.sampleRate *= 2.0;
     process_spec = oversampled_spec;
 
-    oversampler2x.reset();
-    oversampler2x.initProcessing(static_cast<size_t>(spec.maximumBlockSize));
+    oversampler2x = makeOversampler(spec, 2);
+    control_rate.prepare(
+        ControlRate::default_interval * oversampler2x->getOversamplingFactor()
+    );
 
     high_buffer.setSize(
         (int)process_spec.numChannels, (int)process_spec.maximumBlockSize * 4,
@@ -58,77 +59,81 @@ void BorealisOverdrive::prepare(const juce::dsp::ProcessSpec& spec)
     );
 
     cmos.prepare();
+    low_delay.prepare(process_spec);
+    dry_delay.prepare(process_spec);
+    buildCoefficientTables();
     resetSmoothedValues();
     prepareFilters();
 }
 
 void BorealisOverdrive::prepareFilters()
 {
-    x_hpf.prepare(process_spec);
     updateXFilter();
-
-    bass_lpf.prepare(process_spec);
     updateLowFilter();
+    updateDriveFilter();
+
+    const double sample_rate = process_spec.sampleRate;
+    low_filters.setSection(
+        pre_hpf_section, BiquadDesign::highPass(sample_rate, pre_hpf_cutoff)
+    );
+    high_filters.setSection(
+        pre_lpf_section, BiquadDesign::lowPass(sample_rate, pre_lpf_cutoff)
+    );
+    post_filters.setSection(
+        post_lpf_section, BiquadDesign::lowPass(sample_rate, post_lpf_cutoff)
+    );
+    post_filters.setSection(
+        post_lpf2_section, BiquadDesign::lowPass(sample_rate, post_lpf2_cutoff)
+    );
+
+    low_filters.rampToTargets(0);
+    high_filters.rampToTargets(0);
+}
 
-    pre_hpf.prepare(process_spec);
-    auto pre_hpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeHighPass(
-            process_spec.sampleRate, pre_hpf_cutoff
-        );
-    *pre_hpf.coefficients = *pre_hpf_coefficients;
-
-    pre_lpf.prepare(process_spec);
-    auto pre_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, pre_lpf_cutoff
-        );
-    *pre_lpf.coefficients = *pre_lpf_coefficients;
-
-    lowmids_lpf.prepare(process_spec);
-    auto lowmids_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, lowmids_lpf_cutoff
-        );
-    *lowmids_lpf.coefficients = *lowmids_lpf_coefficients;
-
-    post_lpf.prepare(process_spec);
-    auto post_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, post_lpf_cutoff
-        );
-    *post_lpf.coefficients = *post_lpf_coefficients;
-
-    post_lpf2.prepare(process_spec);
-    auto post_lpf2_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, post_lpf2_cutoff
-        );
-    *post_lpf2.coefficients = *post_lpf2_coefficients;
+void BorealisOverdrive::buildCoefficientTables()
+{
+    const double sample_rate = process_spec.sampleRate;
+    x_table.build(
+        "borealis x", sample_rate, 250.0f, 1000.0f,
+        [sample_rate](float frequency) {
+            return BiquadDesign::highPass(sample_rate, frequency);
+        }
+    );
+    bass_table.build(
+        "borealis bass", sample_rate, 50.0f, 500.0f,
+        [sample_rate](float frequency) {
+            return BiquadDesign::lowPass(sample_rate, frequency);
+        }
+    );
+    drive_table.build(
+        "borealis drive", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designDriveFilter(value); }
+    );
 }
 
 void BorealisOverdrive::updateXFilter()
 {
-    float current_x_frequency = std::max(cross_frequency.getNextValue(), 1.0f);
-    auto x_coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(
-        process_spec.sampleRate, current_x_frequency
+    high_filters.setSectionTarget(
+        x_hpf_section, x_table.lookup(cross_frequency.getNextValue())
     );
-    *x_hpf.coefficients = *x_coefficients;
 }
 
 void BorealisOverdrive::updateLowFilter()
 {
-    float current_bass_frequency =
-        std::max(bass_frequency.getNextValue(), 1.0f);
-    auto bass_coefficients = juce::dsp::IIR::Coefficients<float>::makeLowPass(
-        process_spec.sampleRate, current_bass_frequency
+    low_filters.setSectionTarget(
+        bass_lpf_section, bass_table.lookup(bass_frequency.getNextValue())
     );
-    *bass_lpf.coefficients = *bass_coefficients;
 }
 
 void BorealisOverdrive::updateDriveFilter()
 {
-    float current_drive = drive.getCurrentValue();
+    high_filters.setSectionTarget(
+        drive_section, drive_table.lookup(drive.getCurrentValue())
+    );
+}
 
+BiquadCoefficients BorealisOverdrive::designDriveFilter(float current_drive)
+{
     // Set the frequency based on the grunt parameter
     float rolloff_frequency = 3200.0f;
     float drive_frequency = 209.0f;
@@ -139,71 +144,97 @@ void BorealisOverdrive::updateDriveFilter()
         min_gain_db + (max_gain_db - min_gain_db) * current_drive * 0.1f
     );
 
-    auto drive_filter_coefficients = makeDriveFilter(
+    return makeDriveFilter(
         (float)process_spec.sampleRate, drive_frequency, rolloff_frequency,
         drive_filter_gain
     );
-    *drive_filter.coefficients = *drive_filter_coefficients;
 }
 
-void BorealisOverdrive::process(
-    const juce::dsp::ProcessContextReplacing<float>& context
-)
+// Control-rate tick, see HeliosOverdrive::updateModulatedFilters
+void BorealisOverdrive::updateModulatedFilters()
 {
-
-    auto& block = context.getOutputBlock();
-    auto oversampled_block = oversampler2x.processSamplesUp(block);
-
-    const size_t num_samples = oversampled_block.getNumSamples();
-
+    const size_t interval = control_rate.getInterval();
     if (cross_frequency.isSmoothing())
     {
-        cross_frequency.skip((int)num_samples);
+        cross_frequency.skip((int)interval);
         updateXFilter();
     }
     if (bass_frequency.isSmoothing())
     {
-        bass_frequency.skip((int)num_samples);
+        bass_frequency.skip((int)interval);
         updateLowFilter();
     }
     if (drive.isSmoothing())
     {
-        drive.skip((int)num_samples);
+        drive.skip((int)interval);
         updateDriveFilter();
     }
+    low_filters.rampToTargets(interval);
+    high_filters.rampToTargets(interval);
+}
+
+void BorealisOverdrive::process(
+    const juce::dsp::ProcessContextReplacing<float>& context
+)
+{
+
+    auto& block = context.getOutputBlock();
+    const size_t num_channels = block.getNumChannels();
+    cmos.setAdaaOrder(adaa_order);
+    low_delay.setOrder(adaa_order);
+    dry_delay.setOrder(adaa_order);
+    auto oversampled_block = oversampler2x->processSamplesUp(block)
+                                 .getSubsetChannelBlock(0, num_channels);
+
+    const size_t num_samples = oversampled_block.getNumSamples();
 
     juce::dsp::AudioBlock<float> high_block(high_buffer);
     juce::dsp::AudioBlock<float> low_block(low_buffer);
-    auto high_sub = high_block.getSubBlock(0, num_samples);
-    auto low_sub = low_block.getSubBlock(0, num_samples);
+    auto high_sub = high_block.getSubsetChannelBlock(0, num_channels)
+                        .getSubBlock(0, num_samples);
+    auto low_sub = low_block.getSubsetChannelBlock(0, num_channels)
+                       .getSubBlock(0, num_samples);
     high_sub.copyFrom(oversampled_block);
     low_sub.copyFrom(oversampled_block);
 
-    // Process the low only
-    auto low_context = juce::dsp::ProcessContextReplacing<float>(low_sub);
-    pre_hpf.process(low_context);
-    bass_lpf.process(low_context);
-
-    // Process the highs only
-    auto high_context = juce::dsp::ProcessContextReplacing<float>(high_sub);
-    pre_lpf.process(high_context);
-    x_hpf.process(high_context);
-    drive_filter.process(high_context);
-    cmos.process(high_context);
-    post_lpf.process(high_context);
-    post_lpf2.process(high_context);
-
-    auto* ch = oversampled_block.getChannelPointer(0);
-    auto* low = low_sub.getChannelPointer(0);
-    auto* high = high_sub.getChannelPointer(0);
+    const bool is_modulating = cross_frequency.isSmoothing() ||
+                               bass_frequency.isSmoothing() ||
+                               drive.isSmoothing();
+    control_rate.process(
+        num_samples, is_modulating, [this] { updateModulatedFilters(); },
+        [&](size_t start, size_t length) {
+            // Process the low only
+            auto low_chunk = low_sub.getSubBlock(start, length);
+            low_filters.process(
+                juce::dsp::ProcessContextReplacing<float>(low_chunk)
+            );
+
+            // Process the highs only
+            auto high_chunk = high_sub.getSubBlock(start, length);
+            auto high_context =
+                juce::dsp::ProcessContextReplacing<float>(high_chunk);
+            high_filters.process(high_context);
+            cmos.process(high_context);
+            post_filters.process(high_context);
+        }
+    );
+
     for (size_t i = 0; i < num_samples; ++i)
     {
         float current_mix = mix.getNextValue();
         float current_level = level.getNextValue();
 
-        float dry = ch[i];
-        float od = low[i] + current_level * high[i];
-        ch[i] = od * current_mix + dry * (1.0f - current_mix);
+        for (size_t channel = 0; channel < num_channels; ++channel)
+        {
+            auto* ch = oversampled_block.getChannelPointer(channel);
+            float dry = dry_delay.processSample(channel, ch[i]);
+            float low = low_delay.processSample(
+                channel, low_sub.getChannelPointer(channel)[i]
+            );
+            float od =
+                low + current_level * high_sub.getChannelPointer(channel)[i];
+            ch[i] = od * current_mix + dry * (1.0f - current_mix);
+        }
     }
-    oversampler2x.processSamplesDown(block);
+    oversampler2x->processSamplesDown(block);
 }
@@ -1,9 +1,13 @@
 #pragma once
 
 #include "../circuits/cmos.h"
+#include "../control_rate.h"
+#include "../filters/biquad_cascade.h"
+#include "../filters/coefficient_table.h"
 #include "overdrive.h"
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include <memory>
 
 class BorealisOverdrive : public Overdrive
 {
@@ -20,6 +24,20 @@ class BorealisOverdrive : public Overdrive
     void updateXFilter();
     void updateDriveFilter();
     void updateLowFilter();
+    void updateModulatedFilters();
+    void buildCoefficientTables();
+    BiquadCoefficients designDriveFilter(float drive);
+
+    // The oversampler is built with integer latency, ADAA adds a fraction
+    // of a sample at the oversampled rate
+    float getLatencyInSamples() const
+    {
+        if (oversampler2x == nullptr)
+            return 0.0f;
+        return oversampler2x->getLatencyInSamples() +
+               getAdaaLatency() /
+                   (float)oversampler2x->getOversamplingFactor();
+    }
 
   private:
     juce::AudioBuffer<float> high_buffer;
@@ -27,33 +45,47 @@ class BorealisOverdrive : public Overdrive
 
     float x_output_padding = juce::Decibels::decibelsToGain(-20.0f);
 
-    juce::dsp::IIR::Filter<float> drive_filter;
+    // Bass band, and the overdriven band before and after the CMOS stage
+    enum LowSection
+    {
+        pre_hpf_section,
+        bass_lpf_section,
+        num_low_sections
+    };
+    enum HighSection
+    {
+        pre_lpf_section,
+        x_hpf_section,
+        drive_section,
+        num_high_sections
+    };
+    enum PostSection
+    {
+        post_lpf_section,
+        post_lpf2_section,
+        num_post_sections
+    };
+    BiquadCascade<num_low_sections, max_channels> low_filters;
+    BiquadCascade<num_high_sections, max_channels> high_filters;
+    BiquadCascade<num_post_sections, max_channels> post_filters;
+
+    // Crossover, bass and drive designs over their knob ranges
+    CoefficientTable x_table, bass_table, drive_table;
 
-    juce::dsp::IIR::Filter<float> pre_hpf;
     float pre_hpf_cutoff = 50.0f;
-
-    juce::dsp::IIR::Filter<float> pre_lpf;
     float pre_lpf_cutoff = 1590.0f;
-
-    juce::dsp::IIR::Filter<float> lowmids_lpf;
-    float lowmids_lpf_cutoff = 330.0f;
-
-    juce::dsp::IIR::Filter<float> x_hpf;
-    juce::dsp::IIR::Filter<float> bass_lpf;
-
-    juce::dsp::IIR::Filter<float> post_lpf;
     float post_lpf_cutoff = 4877.0f;
     float post_lpf_q = 1.0f;
-
-    juce::dsp::IIR::Filter<float> post_lpf2;
     float post_lpf2_cutoff = 3337.0f;
     float post_lpf2_q = 0.67f;
 
+    ControlRate control_rate;
+
     CMOS cmos = CMOS();
+    // The bass band and the dry signal, in line with the CMOS ADAA of the
+    // overdriven band
+    AdaaDelay low_delay, dry_delay;
 
-    juce::dsp::Oversampling<float> oversampler2x{
-        2, 2,
-        juce::dsp::Oversampling<float>::FilterType::filterHalfBandPolyphaseIIR,
-        true, false
-    };
+    // Built on prepare for the channels of the spec
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversampler2x;
 };
@@ -7,31 +7,51 @@
 void HeliosOverdrive::prepare(const juce::dsp::ProcessSpec& spec)
 {
     juce::dsp::ProcessSpec oversampled_spec = spec;
-    oversampled_spec.sampleRate *= (int)(2 * std::pow(2, oversampling_index));
+    oversampled_spec.sampleRate *= (double)(1 << oversampling_factor);
     process_spec = oversampled_spec;
 
-    for (auto oversampler : oversamplers)
+    if (oversampler == nullptr || built_factor != oversampling_factor ||
+        built_linear_phase != oversampling_linear_phase ||
+        built_block_size != spec.maximumBlockSize ||
+        built_num_channels != spec.numChannels)
     {
-        oversampler->reset();
+        using FilterType = juce::dsp::Oversampling<float>::FilterType;
+        oversampler = std::make_unique<juce::dsp::Oversampling<float>>(
+            (size_t)spec.numChannels, oversampling_factor,
+            oversampling_linear_phase
+                ? FilterType::filterHalfBandFIREquiripple
+                : FilterType::filterHalfBandPolyphaseIIR,
+            true, true
+        );
         oversampler->initProcessing(static_cast<size_t>(spec.maximumBlockSize));
+        built_factor = oversampling_factor;
+        built_linear_phase = oversampling_linear_phase;
+        built_block_size = spec.maximumBlockSize;
+        built_num_channels = spec.numChannels;
     }
+    oversampler->reset();
     vmt_buffer.setSize(
-        (int)process_spec.numChannels, (int)process_spec.maximumBlockSize * 16,
-        false, false, true
+        (int)process_spec.numChannels,
+        (int)process_spec.maximumBlockSize << oversampling_factor, false, false,
+        true
     );
     mu_amp.prepare(process_spec);
+    control_rate.prepare(ControlRate::default_interval << oversampling_factor);
     cmos.prepare();
+    dry_delay.prepare(process_spec);
+    buildCoefficientTables();
     resetSmoothedValues();
     prepareFilters();
 }
 
 void HeliosOverdrive::reset()
 {
-    oversampler2x.reset();
-    oversampler4x.reset();
-    oversampler8x.reset();
+    if (oversampler != nullptr)
+        oversampler->reset();
     mu_amp.reset();
     cmos.reset();
+    dry_delay.reset();
+    control_rate.reset();
     resetSmoothedValues();
     resetFilters();
     prepareFilters();
@@ -40,10 +60,8 @@ void HeliosOverdrive::reset()
 void HeliosOverdrive::resetFilters()
 {
     vmt_pre_lpf.reset();
-    vmt_pre_hpf.reset();
-    vmt_attack_shelf.reset();
-    vmt_grunt_filter.reset();
-    vmt_era_filter.reset();
+    vmt_pre_filters.reset();
+    vmt_post_filters.reset();
 }
 
 void HeliosOverdrive::resetSmoothedValues()
@@ -64,74 +82,106 @@ void HeliosOverdrive::resetSmoothedValues()
 
 void HeliosOverdrive::prepareFilters()
 {
-    vmt_attack_shelf.prepare(process_spec);
     updateAttackFilter();
-
-    vmt_drive_filter.prepare(process_spec);
     updateDriveFilter();
-
-    vmt_grunt_filter.prepare(process_spec);
     updateGruntFilter();
-
-    vmt_era_filter.prepare(process_spec);
     updateEraFilter();
 
-    vmt_pre_lpf.prepare(process_spec);
-    auto vmt_pre_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, pre_lpf_cutoff
-        );
-    *vmt_pre_lpf.coefficients = *vmt_pre_lpf_coefficients;
+    const double sample_rate = process_spec.sampleRate;
+    vmt_pre_lpf.setSection(
+        0, BiquadDesign::lowPass(sample_rate, pre_lpf_cutoff)
+    );
 
-    vmt_pre_hpf.prepare(process_spec);
-    auto vmt_pre_hpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeHighPass(
-            process_spec.sampleRate, pre_hpf_cutoff
-        );
-    *vmt_pre_hpf.coefficients = *vmt_pre_hpf_coefficients;
+    vmt_pre_filters.setSection(
+        pre_hpf_section, BiquadDesign::highPass(sample_rate, pre_hpf_cutoff)
+    );
+    vmt_pre_filters.setSection(
+        pre_peak_section,
+        BiquadDesign::peak(
+            sample_rate, 288.0f, 0.15f, juce::Decibels::decibelsToGain(-34.3f)
+        )
+    );
+    vmt_pre_filters.setSection(
+        pre_peak_2_section,
+        BiquadDesign::peak(
+            sample_rate, 65.0f, juce::Decibels::decibelsToGain(-3.5f), 0.4f
+        )
+    );
+    vmt_pre_filters.setSection(
+        pre_shelf_section,
+        BiquadDesign::lowShelf(
+            sample_rate, 1539.0f, juce::Decibels::decibelsToGain(-8.0f), 0.45f
+        )
+    );
 
-    vmt_pre_filter.prepare(process_spec);
-    auto vmt_pre_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            process_spec.sampleRate, 288.0f, 0.15f,
-            juce::Decibels::decibelsToGain(-34.3f)
-        );
-    *vmt_pre_filter.coefficients = *vmt_pre_coefficients;
+    vmt_post_filters.setSection(
+        post_lpf_2_section,
+        BiquadDesign::lowPass(
+            sample_rate, vmt_post_lpf_cutoff_2, vmt_post_lpf_q_2
+        )
+    );
+    vmt_post_filters.setSection(
+        post_lpf_3_section,
+        BiquadDesign::lowPass(
+            sample_rate, vmt_post_lpf_cutoff_3, vmt_post_lpf_q_3
+        )
+    );
 
-    vmt_pre_filter_2.prepare(process_spec);
-    auto vmt_pre_coefficients_2 =
-        juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-            process_spec.sampleRate, 65.0f,
-            juce::Decibels::decibelsToGain(-3.5f), 0.4f
-        );
-    *vmt_pre_filter_2.coefficients = *vmt_pre_coefficients_2;
+    vmt_pre_filters.rampToTargets(0);
+    vmt_post_filters.rampToTargets(0);
+}
 
-    vmt_pre_filter_3.prepare(process_spec);
-    auto vmt_pre_coefficients_3 =
-        juce::dsp::IIR::Coefficients<float>::makeLowShelf(
-            process_spec.sampleRate, 1539.0f,
-            juce::Decibels::decibelsToGain(-8.0f), 0.45f
-        );
-    *vmt_pre_filter_3.coefficients = *vmt_pre_coefficients_3;
+void HeliosOverdrive::buildCoefficientTables()
+{
+    const double sample_rate = process_spec.sampleRate;
+    attack_table.build(
+        "helios attack", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designAttackFilter(value); }
+    );
+    grunt_table.build(
+        "helios grunt", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designGruntFilter(value); }
+    );
+    era_table.build(
+        "helios era", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designEraFilter(value); }
+    );
+    drive_table.build(
+        "helios drive", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designDriveFilter(value); }
+    );
+}
 
-    vmt_post_filter_2.prepare(process_spec);
-    auto vmt_post_coefficients_2 =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, vmt_post_lpf_cutoff_2, vmt_post_lpf_q_2
-        );
-    *vmt_post_filter_2.coefficients = *vmt_post_coefficients_2;
+void HeliosOverdrive::updateAttackFilter()
+{
+    vmt_pre_filters.setSectionTarget(
+        attack_section, attack_table.lookup(attack.getCurrentValue())
+    );
+}
 
-    vmt_post_filter_3.prepare(process_spec);
-    auto vmt_post_coefficients_3 =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, vmt_post_lpf_cutoff_3, vmt_post_lpf_q_3
-        );
-    *vmt_post_filter_3.coefficients = *vmt_post_coefficients_3;
+void HeliosOverdrive::updateGruntFilter()
+{
+    vmt_pre_filters.setSectionTarget(
+        grunt_section, grunt_table.lookup(grunt.getCurrentValue())
+    );
 }
 
-void HeliosOverdrive::updateAttackFilter()
+void HeliosOverdrive::updateEraFilter()
+{
+    vmt_post_filters.setSectionTarget(
+        era_section, era_table.lookup(era.getCurrentValue())
+    );
+}
+
+void HeliosOverdrive::updateDriveFilter()
+{
+    vmt_pre_filters.setSectionTarget(
+        drive_section, drive_table.lookup(drive.getCurrentValue())
+    );
+}
+
+BiquadCoefficients HeliosOverdrive::designAttackFilter(float current_attack)
 {
-    float current_attack = attack.getCurrentValue();
     float attack_shelf_q = 0.7f;
     float min_frequency = 1540.0f;
     float max_frequency = 1540.0f;
@@ -143,30 +193,23 @@ void HeliosOverdrive::updateAttackFilter()
         min_gain_db + (max_gain_db - min_gain_db) * current_attack * 0.1f
     );
 
-    auto attack_shelf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeHighShelf(
-            process_spec.sampleRate, shelf_frequency, attack_shelf_q, shelf_gain
-        );
-    *vmt_attack_shelf.coefficients = *attack_shelf_coefficients;
+    return BiquadDesign::highShelf(
+        process_spec.sampleRate, shelf_frequency, attack_shelf_q, shelf_gain
+    );
 }
 
-void HeliosOverdrive::updateGruntFilter()
+BiquadCoefficients HeliosOverdrive::designGruntFilter(float current_grunt)
 {
-    float current_grunt = grunt.getCurrentValue();
     float min_frequency = 120.0f;
     float max_frequency = 506.0f;
     float frequency = min_frequency + (max_frequency - min_frequency) *
                                           (1.0f - current_grunt * 0.1f);
 
-    auto grunt_coefficients = juce::dsp::IIR::Coefficients<float>::makeHighPass(
-        process_spec.sampleRate, frequency
-    );
-    *vmt_grunt_filter.coefficients = *grunt_coefficients;
+    return BiquadDesign::highPass(process_spec.sampleRate, frequency);
 }
 
-void HeliosOverdrive::updateEraFilter()
+BiquadCoefficients HeliosOverdrive::designEraFilter(float current_era)
 {
-    float current_era = era.getCurrentValue();
     // float era = 1.0f - 0.099f * current_era;
 
     float c16 = 1e-9f;
@@ -180,16 +223,11 @@ void HeliosOverdrive::updateEraFilter()
         std::sqrt(c16 * c17 * r20 * req) / (c16 * (r20 + req) + c17 * r20);
     float g = c16 * (r20 + req) / (c16 * (r20 + req) + c17 * r20);
 
-    auto era_coefficients = juce::dsp::IIR::Coefficients<float>::makePeakFilter(
-        process_spec.sampleRate, f0, q, g
-    );
-    *vmt_era_filter.coefficients = *era_coefficients;
+    return BiquadDesign::peak(process_spec.sampleRate, f0, q, g);
 }
 
-void HeliosOverdrive::updateDriveFilter()
+BiquadCoefficients HeliosOverdrive::designDriveFilter(float current_drive)
 {
-    float current_drive = drive.getCurrentValue();
-
     float rolloff_frequency = 5000.0f;
     float drive_frequency = 30.0f;
 
@@ -200,62 +238,81 @@ void HeliosOverdrive::updateDriveFilter()
         min_gain_db + (max_gain_db - min_gain_db) * current_drive * 0.1f
     );
 
-    auto drive_filter_coefficients = makeDriveFilter(
+    return makeDriveFilter(
         (float)process_spec.sampleRate, drive_frequency, rolloff_frequency,
         drive_filter_gain
     );
-    *vmt_drive_filter.coefficients = *drive_filter_coefficients;
 }
 
-void HeliosOverdrive::process(
-    const juce::dsp::ProcessContextReplacing<float>& context
-)
+// Control-rate tick: advances the knob smoothing by one interval and glides
+// the filters to the new coefficients over that interval
+void HeliosOverdrive::updateModulatedFilters()
 {
-    auto& block = context.getOutputBlock();
-    auto* oversampler = oversamplers[oversampling_index];
-    auto oversampled_block = oversampler->processSamplesUp(block);
-
-    const size_t num_samples = oversampled_block.getNumSamples();
-
+    const size_t interval = control_rate.getInterval();
     if (attack.isSmoothing())
     {
-        attack.skip((int)num_samples);
+        attack.skip((int)interval);
         updateAttackFilter();
     }
     if (grunt.isSmoothing())
     {
-        grunt.skip((int)num_samples);
+        grunt.skip((int)interval);
         updateGruntFilter();
     }
     if (drive.isSmoothing())
     {
-        drive.skip((int)num_samples);
+        drive.skip((int)interval);
         updateDriveFilter();
     }
     if (era.isSmoothing())
     {
-        era.skip((int)num_samples);
+        era.skip((int)interval);
         updateEraFilter();
     }
+    vmt_pre_filters.rampToTargets(interval);
+    vmt_post_filters.rampToTargets(interval);
+}
+
+void HeliosOverdrive::process(
+    const juce::dsp::ProcessContextReplacing<float>& context
+)
+{
+    auto& block = context.getOutputBlock();
+    const size_t num_channels = block.getNumChannels();
+    cmos.setAdaaOrder(adaa_order);
+    dry_delay.setOrder(adaa_order);
+    auto oversampled_block = oversampler->processSamplesUp(block)
+                                 .getSubsetChannelBlock(0, num_channels);
+
+    const size_t num_samples = oversampled_block.getNumSamples();
 
     juce::dsp::AudioBlock<float> vmt_block(vmt_buffer);
-    auto vmt_sub = vmt_block.getSubBlock(0, num_samples);
+    auto vmt_sub = vmt_block.getSubsetChannelBlock(0, num_channels)
+                       .getSubBlock(0, num_samples);
     vmt_sub.copyFrom(oversampled_block);
 
-    auto vmt_context = juce::dsp::ProcessContextReplacing<float>(vmt_sub);
-    processVMT(vmt_context);
-
-    auto* ch = oversampled_block.getChannelPointer(0);
-    auto* vmt = vmt_sub.getChannelPointer(0);
+    const bool is_modulating = attack.isSmoothing() || grunt.isSmoothing() ||
+                               drive.isSmoothing() || era.isSmoothing();
+    control_rate.process(
+        num_samples, is_modulating, [this] { updateModulatedFilters(); },
+        [&](size_t start, size_t length) {
+            auto chunk = vmt_sub.getSubBlock(start, length);
+            processVMT(juce::dsp::ProcessContextReplacing<float>(chunk));
+        }
+    );
 
     for (size_t i = 0; i < num_samples; ++i)
     {
         float current_level = level.getNextValue();
         float current_mix = mix.getNextValue();
 
-        float dry = ch[i];
-        float od = vmt[i] * current_level;
-        ch[i] = current_mix * od + (1.0f - current_mix) * dry;
+        for (size_t channel = 0; channel < num_channels; ++channel)
+        {
+            auto* ch = oversampled_block.getChannelPointer(channel);
+            float dry = dry_delay.processSample(channel, ch[i]);
+            float od = vmt_sub.getChannelPointer(channel)[i] * current_level;
+            ch[i] = current_mix * od + (1.0f - current_mix) * dry;
+        }
     }
     oversampler->processSamplesDown(block);
 }
@@ -266,15 +323,7 @@ void HeliosOverdrive::processVMT(
 {
     vmt_pre_lpf.process(context);
     mu_amp.process(context);
-    vmt_pre_hpf.process(context);
-    vmt_pre_filter.process(context);
-    vmt_pre_filter_2.process(context);
-    vmt_pre_filter_3.process(context);
-    vmt_attack_shelf.process(context);
-    vmt_drive_filter.process(context);
-    vmt_grunt_filter.process(context);
+    vmt_pre_filters.process(context);
     cmos.process(context);
-    vmt_era_filter.process(context);
-    vmt_post_filter_2.process(context);
-    vmt_post_filter_3.process(context);
+    vmt_post_filters.process(context);
 }
@@ -1,9 +1,14 @@
 #pragma once
 
 #include "../circuits/cmos.h"
+#include "../control_rate.h"
+#include "../filters/biquad_cascade.h"
+#include "../filters/coefficient_table.h"
 #include "overdrive.h"
+#include <algorithm>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include <memory>
 
 class HeliosOverdrive : public Overdrive
 {
@@ -22,59 +27,89 @@ class HeliosOverdrive : public Overdrive
     void updateGruntFilter();
     void updateEraFilter();
     void updateDriveFilter();
+    void updateModulatedFilters();
+    void buildCoefficientTables();
+    BiquadCoefficients designAttackFilter(float attack);
+    BiquadCoefficients designGruntFilter(float grunt);
+    BiquadCoefficients designEraFilter(float era);
+    BiquadCoefficients designDriveFilter(float drive);
     void applyOverdrive(float& sample);
     void prepareFilters();
 
-  private:
-    juce::AudioBuffer<float> vmt_buffer;
+    // Selects 1x, 2x, 4x or 8x oversampling (factor 0 to 3) with half-band
+    // IIR or linear phase FIR filters, applied on the next prepare(). Only
+    // the selected oversampler is allocated, for the channels of the spec.
+    void setOversampling(size_t factor, bool linear_phase)
+    {
+        oversampling_factor = std::min(factor, max_oversampling_factor);
+        oversampling_linear_phase = linear_phase;
+    }
 
-    juce::dsp::IIR::Filter<float> vmt_pre_hpf;
-    float pre_hpf_cutoff = 70.0f;
+    // The oversampler is built with integer latency, ADAA adds a fraction
+    // of a sample at the oversampled rate
+    float getLatencyInSamples() const
+    {
+        if (oversampler == nullptr)
+            return 0.0f;
+        return oversampler->getLatencyInSamples() +
+               getAdaaLatency() /
+                   (float)oversampler->getOversamplingFactor();
+    }
 
-    juce::dsp::IIR::Filter<float> vmt_pre_lpf;
-    float pre_lpf_cutoff = 1540.0f;
+  private:
+    juce::AudioBuffer<float> vmt_buffer;
 
-    juce::dsp::IIR::Filter<float> era_filter;
-    juce::dsp::IIR::Filter<float> vmt_drive_filter;
-    juce::dsp::IIR::Filter<float> vmt_attack_shelf;
-    juce::dsp::IIR::Filter<float> vmt_grunt_filter;
-    juce::dsp::IIR::Filter<float> vmt_era_filter;
+    // Filters around the mu amp and CMOS stages, one cascade per run of
+    // consecutive filters
+    enum PreSection
+    {
+        pre_hpf_section,
+        pre_peak_section,
+        pre_peak_2_section,
+        pre_shelf_section,
+        attack_section,
+        drive_section,
+        grunt_section,
+        num_pre_sections
+    };
+    enum PostSection
+    {
+        era_section,
+        post_lpf_2_section,
+        post_lpf_3_section,
+        num_post_sections
+    };
+    BiquadCascade<1, max_channels> vmt_pre_lpf;
+    BiquadCascade<num_pre_sections, max_channels> vmt_pre_filters;
+    BiquadCascade<num_post_sections, max_channels> vmt_post_filters;
 
-    juce::dsp::IIR::Filter<float> vmt_pre_filter;
-    juce::dsp::IIR::Filter<float> vmt_pre_filter_2;
-    juce::dsp::IIR::Filter<float> vmt_pre_filter_3;
+    // Knob-driven designs, tabulated over the 0 to 10 knob range on prepare
+    CoefficientTable attack_table, grunt_table, era_table, drive_table;
 
-    juce::dsp::IIR::Filter<float> vmt_post_filter_2;
+    float pre_hpf_cutoff = 70.0f;
+    float pre_lpf_cutoff = 1540.0f;
     float vmt_post_lpf_cutoff_2 = 10730.0f;
     float vmt_post_lpf_q_2 = 0.46f;
-
-    juce::dsp::IIR::Filter<float> vmt_post_filter_3;
     float vmt_post_lpf_cutoff_3 = 2287.0f;
     float vmt_post_lpf_q_3 = 0.57f;
 
+    ControlRate control_rate;
+
     CMOS cmos = CMOS();
+    // The dry signal of the mix, in line with the CMOS ADAA
+    AdaaDelay dry_delay;
     juce::dsp::WaveShaper<float> mu_amp{
         // Adds second-order harmonics and ~+32dB gain
         [](float x) { return 63.0f * (x + 0.04f * (x * x - 1.0f)); }
     };
 
-    juce::dsp::Oversampling<float> oversampler2x{
-        2, 1,
-        juce::dsp::Oversampling<float>::FilterType::filterHalfBandPolyphaseIIR,
-        true, false
-    };
-    juce::dsp::Oversampling<float> oversampler4x{
-        2, 2,
-        juce::dsp::Oversampling<float>::FilterType::filterHalfBandPolyphaseIIR,
-        true, false
-    };
-    juce::dsp::Oversampling<float> oversampler8x{
-        2, 3,
-        juce::dsp::Oversampling<float>::FilterType::filterHalfBandPolyphaseIIR,
-        true, false
-    };
-    std::vector<juce::dsp::Oversampling<float>*> oversamplers = {
-        &oversampler2x, &oversampler4x, &oversampler8x
-    };
-    size_t oversampling_index = 0;
+    static constexpr size_t max_oversampling_factor = 3;
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversampler;
+    size_t oversampling_factor = 1;
+    bool oversampling_linear_phase = false;
+    // Settings the current oversampler was built with
+    size_t built_factor = 0;
+    bool built_linear_phase = false;
+    size_t built_block_size = 0;
+    juce::uint32 built_num_channels = 0;
 };
@@ -0,0 +1,243 @@
+#include "nebula.h"
+#include <algorithm>
+
+#include <juce_dsp/juce_dsp.h>
+
+void NebulaOverdrive::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    oversampler2x = makeOversampler(spec, 1);
+    const size_t factor = oversampler2x->getOversamplingFactor();
+    juce::dsp::ProcessSpec oversampled_spec = spec;
+    oversampled_spec.sampleRate *= (double)factor;
+    oversampled_spec.maximumBlockSize *= (juce::uint32)factor;
+    process_spec = oversampled_spec;
+
+    control_rate.prepare(ControlRate::default_interval * factor);
+
+    dry_buffer.setSize(
+        (int)process_spec.numChannels, (int)process_spec.maximumBlockSize,
+        false, false, true
+    );
+    drive_gains.assign(process_spec.maximumBlockSize, 1.0f);
+
+    for (auto* stage : {&first_stage, &second_stage})
+        for (auto& triode : *stage)
+            triode.prepare((float)process_spec.sampleRate);
+
+    buildCoefficientTables();
+    resetSmoothedValues();
+    prepareFilters();
+}
+
+void NebulaOverdrive::reset()
+{
+    if (oversampler2x != nullptr)
+        oversampler2x->reset();
+    control_rate.reset();
+    for (auto* stage : {&first_stage, &second_stage})
+        for (auto& triode : *stage)
+            triode.reset();
+    tone_stack.reset();
+    post_filters.reset();
+    resetSmoothedValues();
+    prepareFilters();
+}
+
+void NebulaOverdrive::resetSmoothedValues()
+{
+    level.reset(process_spec.sampleRate, smoothing_time);
+    level.setCurrentAndTargetValue(raw_level);
+    drive.reset(process_spec.sampleRate, smoothing_time);
+    drive.setCurrentAndTargetValue(raw_drive);
+    mix.reset(process_spec.sampleRate, smoothing_time);
+    mix.setCurrentAndTargetValue(raw_mix);
+    attack.reset(process_spec.sampleRate, smoothing_time);
+    attack.setCurrentAndTargetValue(raw_attack);
+    grunt.reset(process_spec.sampleRate, smoothing_time);
+    grunt.setCurrentAndTargetValue(raw_grunt);
+    era.reset(process_spec.sampleRate, smoothing_time);
+    era.setCurrentAndTargetValue(raw_era);
+}
+
+void NebulaOverdrive::prepareFilters()
+{
+    updateToneStack();
+    post_filters.setSection(
+        post_lpf_section,
+        BiquadDesign::lowPass(process_spec.sampleRate, post_lpf_cutoff)
+    );
+    tone_stack.rampToTargets(0);
+}
+
+void NebulaOverdrive::buildCoefficientTables()
+{
+    const double sample_rate = process_spec.sampleRate;
+    bass_table.build(
+        "nebula bass", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designBassFilter(value); }
+    );
+    mid_table.build(
+        "nebula mid", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designMidFilter(value); }
+    );
+    treble_table.build(
+        "nebula treble", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designTrebleFilter(value); }
+    );
+}
+
+// Knob at 5 is flat, 0 and 10 cut or boost by tone_range_db
+BiquadCoefficients NebulaOverdrive::designBassFilter(float bass)
+{
+    float gain = juce::Decibels::decibelsToGain(
+        tone_range_db * (bass - 5.0f) * 0.2f
+    );
+    return BiquadDesign::lowShelf(
+        process_spec.sampleRate, bass_frequency, BiquadDesign::inverse_root_two,
+        gain
+    );
+}
+
+BiquadCoefficients NebulaOverdrive::designMidFilter(float mid)
+{
+    float gain =
+        juce::Decibels::decibelsToGain(tone_range_db * (mid - 5.0f) * 0.2f);
+    return BiquadDesign::peak(
+        process_spec.sampleRate, mid_frequency, mid_q, gain
+    );
+}
+
+BiquadCoefficients NebulaOverdrive::designTrebleFilter(float treble)
+{
+    float gain = juce::Decibels::decibelsToGain(
+        tone_range_db * (treble - 5.0f) * 0.2f
+    );
+    return BiquadDesign::highShelf(
+        process_spec.sampleRate, treble_frequency,
+        BiquadDesign::inverse_root_two, gain
+    );
+}
+
+void NebulaOverdrive::updateToneStack()
+{
+    tone_stack.setSectionTarget(
+        bass_section, bass_table.lookup(grunt.getCurrentValue())
+    );
+    tone_stack.setSectionTarget(
+        mid_section, mid_table.lookup(era.getCurrentValue())
+    );
+    tone_stack.setSectionTarget(
+        treble_section, treble_table.lookup(attack.getCurrentValue())
+    );
+}
+
+// Control-rate tick, see HeliosOverdrive::updateModulatedFilters
+void NebulaOverdrive::updateModulatedFilters()
+{
+    const int interval = (int)control_rate.getInterval();
+    grunt.skip(interval);
+    era.skip(interval);
+    attack.skip(interval);
+    updateToneStack();
+    tone_stack.rampToTargets((size_t)interval);
+}
+
+// 0 to 30dB in front of the first triode
+float NebulaOverdrive::driveToGain(float current_drive)
+{
+    return juce::Decibels::decibelsToGain(3.0f * current_drive);
+}
+
+// Push-pull output stage: symmetric soft clipping, the [3/2] Pade
+// approximant of tanh, which reaches +-1 with a zero slope at +-3
+void NebulaOverdrive::applyPowerAmp(juce::dsp::AudioBlock<float>& block)
+{
+    for (size_t channel = 0; channel < block.getNumChannels(); ++channel)
+    {
+        auto* ch = block.getChannelPointer(channel);
+        for (size_t i = 0; i < block.getNumSamples(); ++i)
+        {
+            float x = std::clamp(ch[i] * power_amp_gain, -3.0f, 3.0f);
+            float x2 = x * x;
+            ch[i] = x * (27.0f + x2) / (27.0f + 9.0f * x2);
+        }
+    }
+}
+
+void NebulaOverdrive::process(
+    const juce::dsp::ProcessContextReplacing<float>& context
+)
+{
+    auto& block = context.getOutputBlock();
+    const size_t num_channels = block.getNumChannels();
+    auto oversampled_block = oversampler2x->processSamplesUp(block)
+                                 .getSubsetChannelBlock(0, num_channels);
+    const size_t num_samples = oversampled_block.getNumSamples();
+
+    auto dry_block = juce::dsp::AudioBlock<float>(dry_buffer)
+                         .getSubsetChannelBlock(0, num_channels)
+                         .getSubBlock(0, num_samples);
+    dry_block.copyFrom(oversampled_block);
+
+    // Preamp. The drive gain only needs a per-sample ramp while the knob
+    // moves, the triodes then run a whole channel at a time.
+    const bool is_drive_smoothing = drive.isSmoothing();
+    if (is_drive_smoothing)
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+            drive_gains[i] = driveToGain(drive.getNextValue());
+    }
+    const float drive_gain = driveToGain(drive.getCurrentValue());
+    for (size_t channel = 0; channel < num_channels; ++channel)
+    {
+        auto* ch = oversampled_block.getChannelPointer(channel);
+        if (is_drive_smoothing)
+            juce::FloatVectorOperations::multiply(
+                ch, drive_gains.data(), (int)num_samples
+            );
+        else
+            juce::FloatVectorOperations::multiply(
+                ch, drive_gain, (int)num_samples
+            );
+        first_stage[channel].processBlock(ch, ch, num_samples);
+        juce::FloatVectorOperations::multiply(
+            ch, interstage_gain, (int)num_samples
+        );
+        second_stage[channel].processBlock(ch, ch, num_samples);
+        juce::FloatVectorOperations::multiply(
+            ch, preamp_output_gain, (int)num_samples
+        );
+    }
+
+    const bool is_modulating =
+        grunt.isSmoothing() || era.isSmoothing() || attack.isSmoothing();
+    control_rate.process(
+        num_samples, is_modulating, [this] { updateModulatedFilters(); },
+        [&](size_t start, size_t length) {
+            auto chunk = oversampled_block.getSubBlock(start, length);
+            tone_stack.process(
+                juce::dsp::ProcessContextReplacing<float>(chunk)
+            );
+        }
+    );
+
+    applyPowerAmp(oversampled_block);
+    post_filters.process(
+        juce::dsp::ProcessContextReplacing<float>(oversampled_block)
+    );
+
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        float current_level = level.getNextValue();
+        float current_mix = mix.getNextValue();
+
+        for (size_t channel = 0; channel < num_channels; ++channel)
+        {
+            auto* ch = oversampled_block.getChannelPointer(channel);
+            float dry = dry_block.getChannelPointer(channel)[i];
+            float od = ch[i] * current_level;
+            ch[i] = current_mix * od + (1.0f - current_mix) * dry;
+        }
+    }
+    oversampler2x->processSamplesDown(block);
+}
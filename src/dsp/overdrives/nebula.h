@@ -0,0 +1,86 @@
+#pragma once
+
+#include "../circuits/triode.h"
+#include "../control_rate.h"
+#include "../filters/biquad_cascade.h"
+#include "../filters/coefficient_table.h"
+#include "overdrive.h"
+#include <array>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include <memory>
+#include <vector>
+
+// Tube amp: two wave digital triode stages for the preamp, a three band
+// tone stack and a push-pull power amp saturation, at 2x oversampling.
+// Grunt, era and attack are the bass, mid and treble of the tone stack.
+class NebulaOverdrive : public Overdrive
+{
+  public:
+    void prepare(const juce::dsp::ProcessSpec& spec) override;
+    void process(
+        const juce::dsp::ProcessContextReplacing<float>& context
+    ) override;
+    void reset() override;
+    void resetSmoothedValues();
+    void prepareFilters();
+    void updateToneStack();
+    void updateModulatedFilters();
+    void buildCoefficientTables();
+    BiquadCoefficients designBassFilter(float bass);
+    BiquadCoefficients designMidFilter(float mid);
+    BiquadCoefficients designTrebleFilter(float treble);
+    float driveToGain(float);
+    void applyPowerAmp(juce::dsp::AudioBlock<float>& block);
+
+    // Whole samples, the oversampler is built with integer latency
+    float getLatencyInSamples() const
+    {
+        return oversampler2x != nullptr ? oversampler2x->getLatencyInSamples()
+                                        : 0.0f;
+    }
+
+  private:
+    juce::AudioBuffer<float> dry_buffer;
+    std::vector<float> drive_gains;
+
+    // One triode per channel for each preamp stage
+    std::array<Triode, max_channels> first_stage;
+    std::array<Triode, max_channels> second_stage;
+    // The triode stages have about 12dB of gain, the output level of the
+    // first one is brought down before the second, and the second one's
+    // before the tone stack
+    float interstage_gain = juce::Decibels::decibelsToGain(-6.0f);
+    float preamp_output_gain = juce::Decibels::decibelsToGain(-18.0f);
+    float power_amp_gain = juce::Decibels::decibelsToGain(6.0f);
+
+    enum ToneSection
+    {
+        bass_section,
+        mid_section,
+        treble_section,
+        num_tone_sections
+    };
+    enum PostSection
+    {
+        post_lpf_section,
+        num_post_sections
+    };
+    BiquadCascade<num_tone_sections, max_channels> tone_stack;
+    BiquadCascade<num_post_sections, max_channels> post_filters;
+
+    // Tone stack designs over the 0 to 10 knob range, tabulated on prepare
+    CoefficientTable bass_table, mid_table, treble_table;
+
+    float bass_frequency = 100.0f;
+    float mid_frequency = 500.0f;
+    float mid_q = 0.7f;
+    float treble_frequency = 2500.0f;
+    float tone_range_db = 12.0f;
+    float post_lpf_cutoff = 6500.0f;
+
+    ControlRate control_rate;
+
+    // Built on prepare for the channels of the spec
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversampler2x;
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include <juce_dsp/juce_dsp.h>
+#include <memory>
 
 class Overdrive : public juce::dsp::ProcessorBase
 {
@@ -74,13 +75,94 @@ class Overdrive : public juce::dsp::ProcessorBase
         raw_drive = v;
     }
 
+    // Anti-aliasing of the CMOS stage, or of the diodes in Pulsar: 0 relies
+    // on oversampling alone, 1 and 2 add first or second order ADAA. It
+    // changes the latency, which the next prepare() accounts for.
+    void setAdaaOrder(int order)
+    {
+        adaa_order = juce::jlimit(0, 2, order);
+    }
+    // Half a sample per order, at the rate the ADAA runs at
+    float getAdaaLatency() const
+    {
+        return 0.5f * (float)adaa_order;
+    }
+
+    // Each input of the dual mono mode gets its own filter state. The
+    // oversamplers are built for the channels of the spec, so that Mono mode
+    // keeps a single one.
+    static constexpr int max_channels = 2;
+
   protected:
+    // Half-band IIR oversampler with integer latency over num_stages
+    // octaves, with one channel per channel of spec
+    static std::unique_ptr<juce::dsp::Oversampling<float>> makeOversampler(
+        const juce::dsp::ProcessSpec& spec, size_t num_stages
+    )
+    {
+        jassert(spec.numChannels <= (juce::uint32)max_channels);
+        auto oversampler = std::make_unique<juce::dsp::Oversampling<float>>(
+            (size_t)spec.numChannels, num_stages,
+            juce::dsp::Oversampling<float>::FilterType::
+                filterHalfBandPolyphaseIIR,
+            true, true
+        );
+        oversampler->initProcessing(static_cast<size_t>(spec.maximumBlockSize));
+        return oversampler;
+    }
+
+    // Delays a path that skips the ADAA stage, the dry signal or a clean
+    // band, by the ADAA latency so that it sums in line with the stage.
+    // Thiran for the half sample of first order.
+    class AdaaDelay
+    {
+      public:
+        void prepare(const juce::dsp::ProcessSpec& spec)
+        {
+            delay.prepare(spec);
+            delay.setMaximumDelayInSamples(2);
+            order = 0;
+            delay.setDelay(0.0f);
+        }
+        void reset()
+        {
+            delay.reset();
+        }
+        // Restarts from silence when the order changes
+        void setOrder(int new_order)
+        {
+            if (new_order == order)
+                return;
+            order = new_order;
+            delay.setDelay(0.5f * (float)order);
+            delay.reset();
+        }
+        float processSample(size_t channel, float x)
+        {
+            if (order == 0)
+                return x;
+            delay.pushSample((int)channel, x);
+            return delay.popSample((int)channel);
+        }
+
+      private:
+        juce::dsp::DelayLine<
+            float, juce::dsp::DelayLineInterpolationTypes::Thiran>
+            delay;
+        int order = 0;
+    };
+
+    // One filter per channel sharing a single set of coefficients
+    using Filter = juce::dsp::ProcessorDuplicator<
+        juce::dsp::IIR::Filter<float>, juce::dsp::IIR::Coefficients<float>>;
+
     juce::dsp::ProcessSpec process_spec{44100.0f, 512, 2};
     float smoothing_time = 0.05f;
 
     // gui parameters
     int type;
     bool bypass;
+    int adaa_order = 0;
     float raw_level, raw_drive, raw_mix, raw_attack, raw_grunt, raw_era,
         raw_cross_frequency, raw_bass_frequency, raw_mod, raw_aggro;
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear> level, drive,
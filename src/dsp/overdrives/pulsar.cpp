@@ -0,0 +1,262 @@
+#include "pulsar.h"
+#include <algorithm>
+#include <cmath>
+
+#include <juce_dsp/juce_dsp.h>
+
+void PulsarOverdrive::prepare(const juce::dsp::ProcessSpec& spec)
+{
+    process_spec = spec;
+
+    oversampler4x = makeOversampler(spec, 2);
+    control_rate.prepare(ControlRate::default_interval);
+
+    const size_t factor = oversampler4x->getOversamplingFactor();
+    dry_buffer.setSize(
+        (int)spec.numChannels, (int)spec.maximumBlockSize, false, false, true
+    );
+    drive_gains.assign(spec.maximumBlockSize * factor, 1.0f);
+    const double oversampled_rate = spec.sampleRate * (double)factor;
+    for (auto& clipper : clippers)
+        clipper.prepare((float)oversampled_rate);
+    clipper_antiderivatives.prepare(
+        clippers[0], "pulsar germanium", oversampled_rate, clipper_max_input,
+        clipper_table_size
+    );
+
+    const float latency = getLatencyInSamples();
+    dry_delay.prepare(spec);
+    dry_delay.setMaximumDelayInSamples(
+        std::max(1, (int)std::ceil(latency))
+    );
+    dry_delay.setDelay(latency);
+
+    buildCoefficientTables();
+    resetSmoothedValues();
+    prepareFilters();
+}
+
+void PulsarOverdrive::reset()
+{
+    if (oversampler4x != nullptr)
+        oversampler4x->reset();
+    control_rate.reset();
+    for (auto& clipper : clippers)
+        clipper.reset();
+    clipper_antiderivatives.reset();
+    dry_delay.reset();
+    pre_filters.reset();
+    tone_stack.reset();
+    resetSmoothedValues();
+    prepareFilters();
+}
+
+void PulsarOverdrive::resetSmoothedValues()
+{
+    // The drive ramps at the rate of the clipper, the rest at the plugin rate
+    const double oversampled_rate =
+        process_spec.sampleRate *
+        (double)oversampler4x->getOversamplingFactor();
+    level.reset(process_spec.sampleRate, smoothing_time);
+    level.setCurrentAndTargetValue(raw_level);
+    drive.reset(oversampled_rate, smoothing_time);
+    drive.setCurrentAndTargetValue(raw_drive);
+    mix.reset(process_spec.sampleRate, smoothing_time);
+    mix.setCurrentAndTargetValue(raw_mix);
+    attack.reset(process_spec.sampleRate, smoothing_time);
+    attack.setCurrentAndTargetValue(raw_attack);
+    grunt.reset(process_spec.sampleRate, smoothing_time);
+    grunt.setCurrentAndTargetValue(raw_grunt);
+    era.reset(process_spec.sampleRate, smoothing_time);
+    era.setCurrentAndTargetValue(raw_era);
+}
+
+void PulsarOverdrive::prepareFilters()
+{
+    pre_filters.setSection(
+        pre_hpf_section,
+        BiquadDesign::highPass(process_spec.sampleRate, pre_hpf_cutoff)
+    );
+    updateToneStack();
+    tone_stack.rampToTargets(0);
+}
+
+void PulsarOverdrive::buildCoefficientTables()
+{
+    const double sample_rate = process_spec.sampleRate;
+    bass_table.build(
+        "pulsar bass", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designBassFilter(value); }
+    );
+    mid_table.build(
+        "pulsar mid", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designMidFilter(value); }
+    );
+    tone_table.build(
+        "pulsar tone", sample_rate, 0.0f, 10.0f,
+        [this](float value) { return designToneFilter(value); }
+    );
+}
+
+// Knob at 5 is flat, 0 and 10 cut or boost by tone_range_db
+BiquadCoefficients PulsarOverdrive::designBassFilter(float bass)
+{
+    float gain = juce::Decibels::decibelsToGain(
+        tone_range_db * (bass - 5.0f) * 0.2f
+    );
+    return BiquadDesign::lowShelf(
+        process_spec.sampleRate, bass_frequency, BiquadDesign::inverse_root_two,
+        gain
+    );
+}
+
+BiquadCoefficients PulsarOverdrive::designMidFilter(float mid)
+{
+    float gain =
+        juce::Decibels::decibelsToGain(tone_range_db * (mid - 5.0f) * 0.2f);
+    return BiquadDesign::peak(
+        process_spec.sampleRate, mid_frequency, mid_q, gain
+    );
+}
+
+// Low pass swept exponentially from min_tone_cutoff to max_tone_cutoff
+BiquadCoefficients PulsarOverdrive::designToneFilter(float tone)
+{
+    float cutoff = min_tone_cutoff *
+                   std::pow(max_tone_cutoff / min_tone_cutoff, tone * 0.1f);
+    return BiquadDesign::lowPass(process_spec.sampleRate, cutoff);
+}
+
+void PulsarOverdrive::updateToneStack()
+{
+    tone_stack.setSectionTarget(
+        bass_section, bass_table.lookup(grunt.getCurrentValue())
+    );
+    tone_stack.setSectionTarget(
+        mid_section, mid_table.lookup(era.getCurrentValue())
+    );
+    tone_stack.setSectionTarget(
+        tone_section, tone_table.lookup(attack.getCurrentValue())
+    );
+}
+
+// Control-rate tick, see HeliosOverdrive::updateModulatedFilters
+void PulsarOverdrive::updateModulatedFilters()
+{
+    const int interval = (int)control_rate.getInterval();
+    grunt.skip(interval);
+    era.skip(interval);
+    attack.skip(interval);
+    updateToneStack();
+    tone_stack.rampToTargets((size_t)interval);
+}
+
+// 0 to 40dB in front of the clipper
+float PulsarOverdrive::driveToGain(float current_drive)
+{
+    return juce::Decibels::decibelsToGain(4.0f * current_drive);
+}
+
+// The drive gain only needs a per-sample ramp while the knob moves, the
+// clippers or their ADAA then run a whole channel at a time
+void PulsarOverdrive::applyFuzz(juce::dsp::AudioBlock<float>& block)
+{
+    const size_t num_channels = block.getNumChannels();
+    const size_t num_samples = block.getNumSamples();
+    const bool is_drive_smoothing = drive.isSmoothing();
+    if (is_drive_smoothing)
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+            drive_gains[i] = driveToGain(drive.getNextValue());
+    }
+    const float drive_gain = driveToGain(drive.getCurrentValue());
+    for (size_t channel = 0; channel < num_channels; ++channel)
+    {
+        auto* ch = block.getChannelPointer(channel);
+        if (is_drive_smoothing)
+            juce::FloatVectorOperations::multiply(
+                ch, drive_gains.data(), (int)num_samples
+            );
+        else
+            juce::FloatVectorOperations::multiply(
+                ch, drive_gain, (int)num_samples
+            );
+    }
+
+    // Dual mono runs both ADAA histories in the lanes of one register
+    const bool is_adaa = clipper_antiderivatives.getAdaaOrder() > 0;
+    if (is_adaa && num_channels == 2)
+        clipper_antiderivatives.processPair(
+            block.getChannelPointer(0), block.getChannelPointer(1),
+            num_samples
+        );
+    for (size_t channel = 0; channel < num_channels; ++channel)
+    {
+        auto* ch = block.getChannelPointer(channel);
+        if (!is_adaa)
+            clippers[channel].processBlock(ch, ch, num_samples);
+        else if (num_channels != 2)
+            clipper_antiderivatives.process(channel, ch, num_samples);
+        juce::FloatVectorOperations::multiply(
+            ch, fuzz_output_gain, (int)num_samples
+        );
+    }
+}
+
+void PulsarOverdrive::process(
+    const juce::dsp::ProcessContextReplacing<float>& context
+)
+{
+    auto& block = context.getOutputBlock();
+    const size_t num_channels = block.getNumChannels();
+    const size_t num_samples = block.getNumSamples();
+    clipper_antiderivatives.setAdaaOrder(adaa_order);
+
+    auto dry_block = juce::dsp::AudioBlock<float>(dry_buffer)
+                         .getSubsetChannelBlock(0, num_channels)
+                         .getSubBlock(0, num_samples);
+    // Channel by channel, the block has a single channel in Mono mode and
+    // DelayLine::process requires the channel count it was prepared with
+    for (size_t channel = 0; channel < num_channels; ++channel)
+    {
+        const auto* in = block.getChannelPointer(channel);
+        auto* dry = dry_block.getChannelPointer(channel);
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            dry_delay.pushSample((int)channel, in[i]);
+            dry[i] = dry_delay.popSample((int)channel);
+        }
+    }
+
+    pre_filters.process(context);
+    auto oversampled_block = oversampler4x->processSamplesUp(block)
+                                 .getSubsetChannelBlock(0, num_channels);
+    applyFuzz(oversampled_block);
+    oversampler4x->processSamplesDown(block);
+
+    const bool is_modulating =
+        grunt.isSmoothing() || era.isSmoothing() || attack.isSmoothing();
+    control_rate.process(
+        num_samples, is_modulating, [this] { updateModulatedFilters(); },
+        [&](size_t start, size_t length) {
+            auto chunk = block.getSubBlock(start, length);
+            tone_stack.process(
+                juce::dsp::ProcessContextReplacing<float>(chunk)
+            );
+        }
+    );
+
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        float current_level = level.getNextValue();
+        float current_mix = mix.getNextValue();
+
+        for (size_t channel = 0; channel < num_channels; ++channel)
+        {
+            auto* ch = block.getChannelPointer(channel);
+            float dry = dry_block.getChannelPointer(channel)[i];
+            float od = ch[i] * current_level;
+            ch[i] = current_mix * od + (1.0f - current_mix) * dry;
+        }
+    }
+}
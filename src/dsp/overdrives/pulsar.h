@@ -0,0 +1,101 @@
+#pragma once
+
+#include "../circuits/circuit_antiderivatives.h"
+#include "../circuits/germanium_diode.h"
+#include "../control_rate.h"
+#include "../filters/biquad_cascade.h"
+#include "../filters/coefficient_table.h"
+#include "overdrive.h"
+#include <array>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include <memory>
+#include <vector>
+
+// Germanium fuzz: a Shockley diode pair clipper at 4x oversampling, between
+// a fixed input high pass and a bass, mid and tone stack on the grunt, era
+// and attack knobs. Only the clipper runs at the oversampled rate, the
+// filters are linear and run at the plugin rate on either side of the
+// oversampler, and the dry signal is delayed by its latency for the mix.
+// The ADAA option applies to the clipper.
+class PulsarOverdrive : public Overdrive
+{
+  public:
+    void prepare(const juce::dsp::ProcessSpec& spec) override;
+    void process(
+        const juce::dsp::ProcessContextReplacing<float>& context
+    ) override;
+    void reset() override;
+    void resetSmoothedValues();
+    void prepareFilters();
+    void updateToneStack();
+    void updateModulatedFilters();
+    void buildCoefficientTables();
+    BiquadCoefficients designBassFilter(float bass);
+    BiquadCoefficients designMidFilter(float mid);
+    BiquadCoefficients designToneFilter(float tone);
+    float driveToGain(float);
+    void applyFuzz(juce::dsp::AudioBlock<float>& block);
+
+    // The oversampler is built with integer latency, ADAA adds a fraction
+    // of a sample at the oversampled rate
+    float getLatencyInSamples() const
+    {
+        if (oversampler4x == nullptr)
+            return 0.0f;
+        return oversampler4x->getLatencyInSamples() +
+               getAdaaLatency() /
+                   (float)oversampler4x->getOversamplingFactor();
+    }
+
+  private:
+    juce::AudioBuffer<float> dry_buffer;
+    std::vector<float> drive_gains;
+
+    // The clipper is memoryless, one per channel only keeps them independent
+    // of the channel count
+    std::array<GermaniumDiode, max_channels> clippers;
+    // The clipper curve with its antiderivatives, over the inputs the
+    // 40dB of drive can reach
+    CircuitAntiderivatives clipper_antiderivatives;
+    float clipper_max_input = 128.0f;
+    size_t clipper_table_size = 32768;
+    // The clipper output peaks around 0.6 at full drive
+    float fuzz_output_gain = juce::Decibels::decibelsToGain(6.0f);
+
+    enum PreSection
+    {
+        pre_hpf_section,
+        num_pre_sections
+    };
+    enum ToneSection
+    {
+        bass_section,
+        mid_section,
+        tone_section,
+        num_tone_sections
+    };
+    BiquadCascade<num_pre_sections, max_channels> pre_filters;
+    BiquadCascade<num_tone_sections, max_channels> tone_stack;
+
+    // Tone stack designs over the 0 to 10 knob range, tabulated on prepare
+    CoefficientTable bass_table, mid_table, tone_table;
+
+    float pre_hpf_cutoff = 40.0f;
+    float bass_frequency = 120.0f;
+    float mid_frequency = 700.0f;
+    float mid_q = 0.8f;
+    float tone_range_db = 12.0f;
+    float min_tone_cutoff = 800.0f;
+    float max_tone_cutoff = 10000.0f;
+
+    ControlRate control_rate;
+
+    // Thiran for the fractional part of the ADAA latency
+    using DryDelay = juce::dsp::DelayLine<
+        float, juce::dsp::DelayLineInterpolationTypes::Thiran>;
+    DryDelay dry_delay;
+
+    // Built on prepare for the channels of the spec
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversampler4x;
+};
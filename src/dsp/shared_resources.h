@@ -0,0 +1,77 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <typeindex>
+#include <utility>
+
+// Process-wide cache of the immutable tables the modules build in
+// prepare(), so that every plugin instance of a session shares them instead
+// of holding its own copy. A resource is identified by its type, a key and
+// the sample rate it was built for. The cache only keeps weak references:
+// a resource lives as long as one instance holds it, and the next get()
+// after the last one released it builds it again.
+//
+// get() takes a lock and may allocate, so it belongs in prepare(), never on
+// the audio thread. Reading a resource needs no lock, it is const.
+class SharedResources
+{
+  public:
+    // The resource of key at sample_rate, built by create() if no instance
+    // holds it. create() runs outside the lock, so two instances preparing
+    // at once may both build it, and the first one stored is kept.
+    template <typename T, typename Create>
+    static std::shared_ptr<const T> get(
+        const std::string& key, double sample_rate, Create&& create
+    )
+    {
+        const Key entry_key{std::type_index(typeid(T)), key, sample_rate};
+        if (auto resource = find<T>(entry_key))
+            return resource;
+
+        std::shared_ptr<const T> created =
+            std::make_shared<const T>(create());
+        std::lock_guard<std::mutex> lock(mutex());
+        auto& entry = entries()[entry_key];
+        if (auto resource = entry.lock())
+            return std::static_pointer_cast<const T>(resource);
+        entry = created;
+        pruneExpired();
+        return created;
+    }
+
+  private:
+    using Key = std::tuple<std::type_index, std::string, double>;
+
+    template <typename T>
+    static std::shared_ptr<const T> find(const Key& key)
+    {
+        std::lock_guard<std::mutex> lock(mutex());
+        auto it = entries().find(key);
+        if (it == entries().end())
+            return nullptr;
+        return std::static_pointer_cast<const T>(it->second.lock());
+    }
+
+    // Drops the entries of released resources, called with the lock held
+    static void pruneExpired()
+    {
+        for (auto it = entries().begin(); it != entries().end();)
+            it = it->second.expired() ? entries().erase(it) : std::next(it);
+    }
+
+    static std::mutex& mutex()
+    {
+        static std::mutex instance;
+        return instance;
+    }
+
+    static std::map<Key, std::weak_ptr<const void>>& entries()
+    {
+        static std::map<Key, std::weak_ptr<const void>> instance;
+        return instance;
+    }
+};
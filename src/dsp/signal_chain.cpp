@@ -0,0 +1,120 @@
+#include "signal_chain.h"
+
+SignalChain SignalChain::makeDefault()
+{
+    SignalChain chain;
+    for (int i = 0; i < num_nodes; ++i)
+        chain.steps[(size_t)i] = {(Node)i, serial};
+    chain.num_steps = num_nodes;
+    return chain;
+}
+
+bool SignalChain::fromString(const juce::String& text, SignalChain& chain)
+{
+    // Put spaces around the brackets so they tokenise on their own
+    auto spaced = text.replace("[", " [ ").replace("]", " ] ").replace(
+        "|", " | "
+    );
+    juce::StringArray tokens;
+    tokens.addTokens(spaced, " ", "");
+    tokens.removeEmptyStrings();
+
+    SignalChain parsed;
+    std::array<bool, num_nodes> used{};
+    Lane lane = serial;
+    bool had_parallel = false;
+
+    for (auto& token : tokens)
+    {
+        if (token == "[")
+        {
+            if (lane != serial || had_parallel)
+                return false;
+            lane = branch_a;
+            had_parallel = true;
+        }
+        else if (token == "|")
+        {
+            if (lane != branch_a)
+                return false;
+            lane = branch_b;
+        }
+        else if (token == "]")
+        {
+            if (lane == serial)
+                return false;
+            lane = serial;
+        }
+        else
+        {
+            int node = 0;
+            while (node < num_nodes && token != node_names[node])
+                ++node;
+            if (node == num_nodes || used[(size_t)node])
+                return false;
+
+            used[(size_t)node] = true;
+            parsed.steps[(size_t)parsed.num_steps++] = {(Node)node, lane};
+        }
+    }
+
+    if (lane != serial)
+        return false;
+
+    chain = parsed;
+    return true;
+}
+
+juce::String SignalChain::toString() const
+{
+    juce::String text;
+    Lane lane = serial;
+
+    for (int i = 0; i < num_steps; ++i)
+    {
+        const auto& step = steps[(size_t)i];
+        if (step.lane != serial && lane == serial)
+        {
+            text << "[ ";
+            if (step.lane == branch_b)
+                text << "| ";
+        }
+        else if (step.lane == branch_b && lane == branch_a)
+        {
+            text << "| ";
+        }
+        else if (step.lane == serial && lane != serial)
+        {
+            text << (lane == branch_a ? "| ] " : "] ");
+        }
+        text << node_names[step.node] << " ";
+        lane = step.lane;
+    }
+    if (lane != serial)
+        text << (lane == branch_a ? "| ]" : "]");
+    return text.trim();
+}
+
+juce::uint64 SignalChain::pack() const
+{
+    // 4 bits of node and 4 bits of lane per step, count in the top byte
+    juce::uint64 packed = (juce::uint64)num_steps << 56;
+    for (int i = 0; i < num_steps; ++i)
+    {
+        const auto& step = steps[(size_t)i];
+        packed |= (juce::uint64)((step.lane << 4) | step.node) << (8 * i);
+    }
+    return packed;
+}
+
+SignalChain SignalChain::unpack(juce::uint64 packed)
+{
+    SignalChain chain;
+    chain.num_steps = juce::jmin((int)(packed >> 56), (int)num_nodes);
+    for (int i = 0; i < chain.num_steps; ++i)
+    {
+        auto byte = (juce::uint8)(packed >> (8 * i));
+        chain.steps[(size_t)i] = {(Node)(byte & 0x0f), (Lane)(byte >> 4)};
+    }
+    return chain;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <juce_core/juce_core.h>
+
+// Order of the effect modules in processBlock, with at most one parallel
+// section split into two branches and blended back together.
+//
+// As text (stored in the "signal_chain" state property):
+//   "compressor amp eq chorus ir"            serial, the default
+//   "compressor [amp eq | ] chorus ir"        amp + EQ against a clean DI
+//   "[amp | compressor] eq ir"                amp against compressed DI
+// Modules left out of the string are not processed.
+//
+// A chain packs into a single 64 bit word so the audio thread can pick up
+// a new routing atomically at the start of a block.
+struct SignalChain
+{
+    enum Node : juce::uint8
+    {
+        compressor = 0,
+        amp,
+        eq,
+        chorus,
+        ir,
+        num_nodes
+    };
+
+    enum Lane : juce::uint8
+    {
+        serial = 0,
+        branch_a,
+        branch_b
+    };
+
+    struct Step
+    {
+        Node node = num_nodes;
+        Lane lane = serial;
+    };
+
+    static constexpr const char* node_names[num_nodes] = {
+        "compressor", "amp", "eq", "chorus", "ir"
+    };
+
+    std::array<Step, num_nodes> steps{};
+    int num_steps = 0;
+
+    static SignalChain makeDefault();
+
+    // Returns false and leaves chain untouched on malformed input
+    static bool fromString(const juce::String& text, SignalChain& chain);
+    juce::String toString() const;
+
+    juce::uint64 pack() const;
+    static SignalChain unpack(juce::uint64 packed);
+
+    // Nodes that process channel 0 only, or each input separately in dual
+    // mono
+    static bool isMonoNode(Node node)
+    {
+        return node == compressor || node == amp || node == eq;
+    }
+};
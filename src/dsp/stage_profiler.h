@@ -0,0 +1,142 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <juce_core/juce_core.h>
+
+// Per-stage timing of processBlock. The audio thread stamps each stage with
+// the high resolution tick counter and pushes one Frame per block into a
+// single-producer/single-consumer ring buffer, which the editor drains from
+// the message thread. Nothing here allocates or locks after construction.
+class StageProfiler
+{
+  public:
+    enum Stage
+    {
+        input_gain = 0,
+        tuner,
+        compressor,
+        overdrive,
+        amp_master,
+        eq,
+        chorus,
+        ir,
+        output_gain,
+        num_stages
+    };
+
+    static constexpr const char* stage_names[num_stages] = {
+        "Input", "Tuner", "Comp", "Amp",  "Master",
+        "EQ",    "Chorus", "IR",  "Output"
+    };
+
+    struct Frame
+    {
+        std::array<juce::int64, num_stages> stage_ticks{};
+        juce::int64 total_ticks = 0;
+        juce::int64 deadline_ticks = 0;
+    };
+
+    void prepare(double sample_rate)
+    {
+        ticks_per_sample =
+            (double)juce::Time::getHighResolutionTicksPerSecond() /
+            std::max(1.0, sample_rate);
+        resetCounters();
+    }
+
+    void resetCounters()
+    {
+        deadline_misses.store(0);
+        worst_block_load.store(0.0f);
+    }
+
+    //==========================================================================
+    // Audio thread
+    //==========================================================================
+    void beginBlock(int num_samples)
+    {
+        current = Frame();
+        current.deadline_ticks = (juce::int64)(ticks_per_sample * num_samples);
+        block_start = juce::Time::getHighResolutionTicks();
+        stage_start = block_start;
+    }
+
+    // Closes the current stage, the next one starts now
+    void endStage(Stage stage)
+    {
+        auto now = juce::Time::getHighResolutionTicks();
+        current.stage_ticks[(size_t)stage] += now - stage_start;
+        stage_start = now;
+    }
+
+    // Restarts the stage clock without charging the time to any stage,
+    // used for the glue code between stages
+    void skipStage()
+    {
+        stage_start = juce::Time::getHighResolutionTicks();
+    }
+
+    void endBlock()
+    {
+        current.total_ticks = juce::Time::getHighResolutionTicks() - block_start;
+        if (current.deadline_ticks <= 0)
+            return;
+
+        float load = (float)current.total_ticks / (float)current.deadline_ticks;
+        if (load > worst_block_load.load(std::memory_order_relaxed))
+            worst_block_load.store(load, std::memory_order_relaxed);
+        if (current.total_ticks > current.deadline_ticks)
+            deadline_misses.fetch_add(1, std::memory_order_relaxed);
+
+        // Drops the frame when the editor is not draining the queue
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite(1, start1, size1, start2, size2);
+        if (size1 > 0)
+        {
+            frames[(size_t)start1] = current;
+            fifo.finishedWrite(1);
+        }
+    }
+
+    //==========================================================================
+    // Message thread
+    //==========================================================================
+    template <typename Callback>
+    void popFrames(Callback&& callback)
+    {
+        int start1, size1, start2, size2;
+        fifo.prepareToRead(
+            fifo.getNumReady(), start1, size1, start2, size2
+        );
+        for (int i = 0; i < size1; ++i)
+            callback(frames[(size_t)(start1 + i)]);
+        for (int i = 0; i < size2; ++i)
+            callback(frames[(size_t)(start2 + i)]);
+        fifo.finishedRead(size1 + size2);
+    }
+
+    int getDeadlineMisses() const
+    {
+        return deadline_misses.load(std::memory_order_relaxed);
+    }
+    float getWorstBlockLoad() const
+    {
+        return worst_block_load.load(std::memory_order_relaxed);
+    }
+
+  private:
+    static constexpr int fifo_size = 512;
+
+    juce::AbstractFifo fifo{fifo_size};
+    std::array<Frame, fifo_size> frames;
+
+    std::atomic<int> deadline_misses{0};
+    std::atomic<float> worst_block_load{0.0f};
+
+    double ticks_per_sample = 0.0;
+    Frame current;
+    juce::int64 block_start = 0;
+    juce::int64 stage_start = 0;
+};
@@ -15,37 +15,22 @@ void OctaveVoice::prepare(const juce::dsp::ProcessSpec& spec)
     noise_gate.prepare(spec);
     noise_gate.setThreshold(-50.0f);
 
+    BiquadDesign::lowPass(spec.sampleRate, envelope_lpf_cutoff)
+        .copyTo(*envelope_lpf.coefficients);
     envelope_lpf.prepare(spec);
-    auto envelope_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            spec.sampleRate, envelope_lpf_cutoff
-        );
-    *envelope_lpf.coefficients = *envelope_lpf_coefficients;
 
-    pre_lpf.prepare(spec);
-    pre_lpf_2.prepare(spec);
-    pre_lpf_3.prepare(spec);
     auto pre_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            spec.sampleRate, pre_lpf_cutoff
-        );
-    *pre_lpf.coefficients = *pre_lpf_coefficients;
-    *pre_lpf_2.coefficients = *pre_lpf_coefficients;
-    *pre_lpf_3.coefficients = *pre_lpf_coefficients;
-
-    pre_hpf.prepare(spec);
-    auto pre_hpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeHighPass(
-            spec.sampleRate, pre_hpf_cutoff
-        );
-    *pre_hpf.coefficients = *pre_hpf_coefficients;
-
+        BiquadDesign::lowPass(spec.sampleRate, pre_lpf_cutoff);
+    for (size_t i = 0; i < 3; ++i)
+        pre_filters.setSection(i, pre_lpf_coefficients);
+    pre_filters.setSection(
+        3, BiquadDesign::highPass(spec.sampleRate, pre_hpf_cutoff)
+    );
+    pre_filters.reset();
+
+    BiquadDesign::lowPass(spec.sampleRate, post_lpf_cutoff)
+        .copyTo(*post_lpf.coefficients);
     post_lpf.prepare(od_spec);
-    auto post_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            spec.sampleRate, post_lpf_cutoff
-        );
-    *post_lpf.coefficients = *post_lpf_coefficients;
 }
 
 void OctaveVoice::reset()
@@ -59,10 +44,7 @@ void OctaveVoice::process(
     const juce::dsp::ProcessContextReplacing<float>& context
 )
 {
-    pre_lpf.process(context);
-    pre_lpf_2.process(context);
-    pre_lpf_3.process(context);
-    pre_hpf.process(context);
+    pre_filters.process(context);
     noise_gate.process(context);
 
     auto& block = context.getOutputBlock();
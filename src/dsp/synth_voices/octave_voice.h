@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../filters/biquad_cascade.h"
 #include <cmath>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
@@ -31,19 +32,16 @@ class OctaveVoice : juce::dsp::ProcessorBase
     juce::dsp::IIR::Filter<float> envelope_lpf;
     float envelope_lpf_cutoff = 0.443f / 0.001f;
 
-    juce::dsp::IIR::Filter<float> pre_lpf;
-    juce::dsp::IIR::Filter<float> pre_lpf_2;
-    juce::dsp::IIR::Filter<float> pre_lpf_3;
+    // Three low passes then a high pass, before oversampling
+    BiquadCascade<4, 1> pre_filters;
     float pre_lpf_cutoff = 330.0f;
-
-    juce::dsp::IIR::Filter<float> pre_hpf;
     float pre_hpf_cutoff = 30.0f;
 
     juce::dsp::IIR::Filter<float> post_lpf;
     float post_lpf_cutoff = 330.0f;
 
     juce::dsp::Oversampling<float> oversampler{
-        2, 2,
+        1, 2,
         juce::dsp::Oversampling<float>::FilterType::filterHalfBandPolyphaseIIR,
         true, false
     };
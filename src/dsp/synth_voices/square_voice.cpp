@@ -15,30 +15,21 @@ void SquareVoice::prepare(const juce::dsp::ProcessSpec& spec)
     );
 
     // prior to oversampling
-    pre_lpf.prepare(process_spec);
-    auto square_pre_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, pre_lpf_cutoff
-        );
-    *pre_lpf.coefficients = *square_pre_lpf_coefficients;
-
-    pre_hpf.prepare(process_spec);
-    auto square_pre_hpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeHighPass(
-            process_spec.sampleRate, pre_hpf_cutoff
-        );
-    *pre_hpf.coefficients = *square_pre_hpf_coefficients;
+    pre_filters.setSection(
+        0, BiquadDesign::highPass(process_spec.sampleRate, pre_hpf_cutoff)
+    );
+    pre_filters.setSection(
+        1, BiquadDesign::lowPass(process_spec.sampleRate, pre_lpf_cutoff)
+    );
+    pre_filters.reset();
 
     // with oversampling specs
     noise_gate.prepare(oversampled_spec);
     noise_gate.setThreshold(-50.0f);
 
+    BiquadDesign::lowPass(process_spec.sampleRate, post_lpf_cutoff)
+        .copyTo(*post_lpf.coefficients);
     post_lpf.prepare(oversampled_spec);
-    auto post_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, post_lpf_cutoff
-        );
-    *post_lpf.coefficients = *post_lpf_coefficients;
     reset();
 }
 
@@ -51,8 +42,7 @@ void SquareVoice::process(
     const juce::dsp::ProcessContextReplacing<float>& context
 )
 {
-    pre_hpf.process(context);
-    pre_lpf.process(context);
+    pre_filters.process(context);
 
     auto& block = context.getOutputBlock();
     auto os_block = oversampler.processSamplesUp(block);
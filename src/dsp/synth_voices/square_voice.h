@@ -1,5 +1,6 @@
 #pragma once
 
+#include "../filters/biquad_cascade.h"
 #include <cmath>
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
@@ -18,10 +19,9 @@ class SquareVoice : juce::dsp::ProcessorBase
     juce::dsp::ProcessSpec process_spec{44100.0f, 512, 2};
     juce::dsp::ProcessSpec oversampled_spec{44100.0f, 512, 2};
 
-    juce::dsp::IIR::Filter<float> pre_hpf;
+    // High pass then low pass, before oversampling
+    BiquadCascade<2, 1> pre_filters;
     float pre_hpf_cutoff = 30.0f;
-
-    juce::dsp::IIR::Filter<float> pre_lpf;
     float pre_lpf_cutoff = 330.0f;
 
     juce::dsp::IIR::Filter<float> post_lpf;
@@ -34,7 +34,7 @@ class SquareVoice : juce::dsp::ProcessorBase
     juce::dsp::NoiseGate<float> noise_gate = juce::dsp::NoiseGate<float>();
 
     juce::dsp::Oversampling<float> oversampler{
-        2, 2,
+        1, 2,
         juce::dsp::Oversampling<float>::FilterType::filterHalfBandPolyphaseIIR,
         true, false
     };
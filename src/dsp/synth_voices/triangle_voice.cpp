@@ -15,37 +15,25 @@ void TriangleVoice::prepare(const juce::dsp::ProcessSpec& spec)
     );
 
     // prior to oversampling
-    pre_lpf.prepare(process_spec);
-    auto triangle_pre_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, pre_lpf_cutoff
-        );
-    *pre_lpf.coefficients = *triangle_pre_lpf_coefficients;
-
-    pre_hpf.prepare(process_spec);
-    auto triangle_pre_hpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeHighPass(
-            process_spec.sampleRate, pre_hpf_cutoff
-        );
-    *pre_hpf.coefficients = *triangle_pre_hpf_coefficients;
+    pre_filters.setSection(
+        0, BiquadDesign::highPass(process_spec.sampleRate, pre_hpf_cutoff)
+    );
+    pre_filters.setSection(
+        1, BiquadDesign::lowPass(process_spec.sampleRate, pre_lpf_cutoff)
+    );
+    pre_filters.reset();
 
     // with oversampling specs
     noise_gate.prepare(oversampled_spec);
     noise_gate.setThreshold(-50.0f);
 
-    post_lpf.prepare(oversampled_spec);
-    auto post_lpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            process_spec.sampleRate, post_lpf_cutoff
-        );
-    *post_lpf.coefficients = *post_lpf_coefficients;
-
-    post_hpf.prepare(oversampled_spec);
-    auto post_hpf_coefficients =
-        juce::dsp::IIR::Coefficients<float>::makeHighPass(
-            process_spec.sampleRate, post_hpf_cutoff
-        );
-    *post_hpf.coefficients = *post_hpf_coefficients;
+    post_filters.setSection(
+        0, BiquadDesign::highPass(process_spec.sampleRate, post_hpf_cutoff)
+    );
+    post_filters.setSection(
+        1, BiquadDesign::lowPass(process_spec.sampleRate, post_lpf_cutoff)
+    );
+    post_filters.reset();
     reset();
 }
 
@@ -58,8 +46,7 @@ void TriangleVoice::process(
     const juce::dsp::ProcessContextReplacing<float>& context
 )
 {
-    pre_hpf.process(context);
-    pre_lpf.process(context);
+    pre_filters.process(context);
 
     auto& block = context.getOutputBlock();
     auto os_block = oversampler.processSamplesUp(block);
@@ -75,7 +62,6 @@ void TriangleVoice::process(
         ch[i] = triangle_signal;
     }
 
-    post_hpf.process(os_context);
-    post_lpf.process(os_context);
+    post_filters.process(os_context);
     oversampler.processSamplesDown(block);
 }
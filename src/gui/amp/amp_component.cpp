@@ -1,10 +1,13 @@
 #include "amp_component.h"
+#include "../../dsp/overdrives/amp_selector.h"
 #include "../colours.h"
 #include "../dimensions.h"
 #include "amp_dimensions.h"
 #include "amp_knobs_component.h"
 #include "designs/borealis.h"
 #include "designs/helios.h"
+#include "designs/nebula.h"
+#include "designs/pulsar.h"
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 
@@ -33,7 +36,45 @@ AmpComponent::AmpComponent(juce::AudioProcessorValueTreeState& params)
         is_cache_dirty = true;
         repaint();
     };
-    knobs_component.switchType();
+
+    // Amp model buttons, kept in sync with amp_type by the attachment
+    std::array<juce::ToggleButton*, AmpSelector::num_models> type_buttons = {
+        &helios_button, &borealis_button, &nebula_button, &pulsar_button
+    };
+    for (size_t model = 0; model < type_buttons.size(); ++model)
+    {
+        auto* button = type_buttons[model];
+        addAndMakeVisible(button);
+        button->setRadioGroupId(1, juce::dontSendNotification);
+        button->setClickingTogglesState(false);
+        button->onClick = [this, model]()
+        { type_attachment->setValueAsCompleteGesture((float)model); };
+    }
+    type_attachment = std::make_unique<juce::ParameterAttachment>(
+        *parameters.getParameter("amp_type"),
+        [this](float value) { switchType(juce::roundToInt(value)); }
+    );
+    type_attachment->sendInitialUpdate();
+}
+
+void AmpComponent::switchType(int model)
+{
+    selected_model = model;
+    helios_button.setToggleState(
+        model == AmpSelector::helios, juce::dontSendNotification
+    );
+    borealis_button.setToggleState(
+        model == AmpSelector::borealis, juce::dontSendNotification
+    );
+    nebula_button.setToggleState(
+        model == AmpSelector::nebula, juce::dontSendNotification
+    );
+    pulsar_button.setToggleState(
+        model == AmpSelector::pulsar, juce::dontSendNotification
+    );
+    knobs_component.switchType(model);
+    is_cache_dirty = true;
+    repaint();
 }
 
 AmpComponent::~AmpComponent()
@@ -42,7 +83,14 @@ AmpComponent::~AmpComponent()
 
 void AmpComponent::paintDesign(juce::Graphics& g, juce::Rectangle<float> bounds)
 {
-    paintDesignHelios(g, bounds, current_colour1, current_colour2);
+    if (selected_model == AmpSelector::borealis)
+        paintDesignBorealis(g, bounds, current_colour1, current_colour2);
+    else if (selected_model == AmpSelector::nebula)
+        paintDesignNebula(g, bounds, current_colour1, current_colour2);
+    else if (selected_model == AmpSelector::pulsar)
+        paintDesignPulsar(g, bounds, current_colour1, current_colour2);
+    else
+        paintDesignHelios(g, bounds, current_colour1, current_colour2);
 }
 
 void AmpComponent::paintBorder(
@@ -151,6 +199,12 @@ void AmpComponent::resized()
             )
             .reduced(GuiDimensions::PANEL_BORDER_THICKNESS)
     );
+    for (juce::ToggleButton* button :
+         {&pulsar_button, &nebula_button, &borealis_button, &helios_button})
+        button->setBounds(
+            title_bounds.removeFromRight(GuiDimensions::PANEL_TITLE_BAR_HEIGHT)
+                .reduced(GuiDimensions::PANEL_BORDER_THICKNESS)
+        );
 
     // Design area (upper half)
     auto design_bounds = bounds.removeFromTop(height / 2);
@@ -180,7 +234,7 @@ void AmpComponent::buildCache(
     current_colour1 = colour1;
     current_colour2 = colour2;
 
-    // Draw the Helios design into the cache
+    // Draw the selected model's design into the cache
     paintDesign(
         cache, juce::Rectangle<float>(
                    0, 0, design_bounds.getWidth(), design_bounds.getHeight()
@@ -14,8 +14,8 @@ class AmpComponent : public juce::Component
     ~AmpComponent() override;
 
     void setColours(juce::Colour, juce::Colour);
-    void initType();
-    void switchType(AmpType);
+    // Called by the amp_type attachment, see AmpSelector::Model
+    void switchType(int model);
 
     void resized() override;
 
@@ -38,26 +38,25 @@ class AmpComponent : public juce::Component
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment>
         bypass_attachment;
 
-    juce::Slider type_slider;
-    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>
-        type_slider_attachment;
-
     juce::Colour current_colour1;
     juce::Colour current_colour2;
 
     AmpType helios_type = {
-        "helios", ColourCodes::helios_yellow,
-        ColourCodes::helios_orange
+        "helios", ColourCodes::helios_yellow, ColourCodes::helios_orange
     };
-    // AmpType borealis_type = {
-    //     &borealis_button, "borealis", ColourCodes::blue1, ColourCodes::blue2
-    // };
-    // std::vector<AmpType> types = {helios_type, borealis_type};
-    // HeliosToggleButton helios_button = HeliosToggleButton(helios_type);
-    // BorealisToggleButton borealis_button = BorealisToggleButton(borealis_type);
-
-    // AmpType selected_type = types[0];
-    AmpType selected_type = helios_type;
+    AmpType borealis_type = {"borealis", ColourCodes::blue1, ColourCodes::blue2};
+    AmpType nebula_type = {
+        "nebula", ColourCodes::nebula_red, ColourCodes::nebula_violet
+    };
+    AmpType pulsar_type = {
+        "pulsar", ColourCodes::pulsar_green, ColourCodes::pulsar_orange
+    };
+    HeliosToggleButton helios_button = HeliosToggleButton(helios_type);
+    BorealisToggleButton borealis_button = BorealisToggleButton(borealis_type);
+    NebulaToggleButton nebula_button = NebulaToggleButton(nebula_type);
+    PulsarToggleButton pulsar_button = PulsarToggleButton(pulsar_type);
+    std::unique_ptr<juce::ParameterAttachment> type_attachment;
+    int selected_model = 0;
 
     // cache for paint
     // std::vector<juce::Point<float>> voronoi_sites;
@@ -1,4 +1,5 @@
 #include "amp_knobs_component.h"
+#include "../../dsp/overdrives/amp_selector.h"
 #include "../colours.h"
 #include "../dimensions.h"
 
@@ -30,15 +31,20 @@ void AmpKnobsComponent::resized()
     AmpKnob drive = current_knobs[0]; // drive
     drive.knob->setBounds(left_bounds);
 
-    // Right side: two rows of 3 knobs each
+    // Right side: two rows of up to 3 knobs each
     auto right_bounds = bounds;
+    const size_t num_bottom_knobs = 3;
+    const size_t num_top_knobs = current_knobs.size() - 1 - num_bottom_knobs;
 
-    // Top row: era, grunt, attack
+    // Top row: the model's tone controls, centred
     auto top_row_bounds =
         right_bounds.removeFromTop(right_bounds.getHeight() / 2);
     const int top_knob_box_size = top_row_bounds.getWidth() / 3;
+    top_row_bounds.reduce(
+        (int)(3 - num_top_knobs) * top_knob_box_size / 2, 0
+    );
 
-    for (size_t i = 1; i <= 3; ++i) // era, grunt, attack
+    for (size_t i = 1; i <= num_top_knobs; ++i)
     {
         AmpKnob knob = current_knobs[i];
         knob.knob->setBounds(top_row_bounds.removeFromLeft(top_knob_box_size));
@@ -47,7 +53,8 @@ void AmpKnobsComponent::resized()
     // Bottom row: level, mix, master
     const int bottom_knob_box_size = right_bounds.getWidth() / 3;
 
-    for (size_t i = 4; i <= 6; ++i) // level, mix, master
+    for (size_t i = current_knobs.size() - num_bottom_knobs;
+         i < current_knobs.size(); ++i)
     {
         AmpKnob knob = current_knobs[i];
         knob.knob->setBounds(right_bounds.removeFromLeft(bottom_knob_box_size));
@@ -70,8 +77,24 @@ void AmpKnobsComponent::switchColour(juce::Colour colour1, juce::Colour colour2)
     repaint();
 }
 
-void AmpKnobsComponent::switchType()
+void AmpKnobsComponent::switchType(int model)
 {
+    switch (model)
+    {
+    case AmpSelector::borealis:
+        current_knobs = borealis_knobs;
+        break;
+    case AmpSelector::nebula:
+        current_knobs = nebula_knobs;
+        break;
+    case AmpSelector::pulsar:
+        current_knobs = pulsar_knobs;
+        break;
+    default:
+        current_knobs = helios_knobs;
+        break;
+    }
+    slider_attachments.clear();
     resized();
     removeAllChildren();
     addAndMakeVisible(drag_tooltip);
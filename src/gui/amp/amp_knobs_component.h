@@ -23,7 +23,8 @@ class AmpKnobsComponent : public juce::Component
 
     void paint(juce::Graphics&) override;
     void resized() override;
-    void switchType();
+    // Shows the knobs of an amp model, see AmpSelector::Model
+    void switchType(int model);
     void switchColour(juce::Colour, juce::Colour);
 
   private:
@@ -45,18 +46,9 @@ class AmpKnobsComponent : public juce::Component
         std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>>
         slider_attachments;
 
-    std::vector<AmpKnob> knobs = {
-        {&drive_knob,           "overdrive_drive",         "drive"   },
-        {&era_knob,             "overdrive_era",           "era"     },
-        {&attack_knob,          "overdrive_attack",        "attack"  },
-        {&grunt_knob,           "overdrive_grunt",         "grunt"   },
-        {&bass_frequency_knob,  "overdrive_bass_frequency", "low pass"},
-        {&cross_frequency_knob, "overdrive_x_frequency",   "hi pass" },
-        {&level_knob,           "overdrive_level_db",      "level"   },
-        {&mix_knob,             "overdrive_mix",           "mix"     },
-        {&master_knob,          "amp_master",              "master"  },
-    };
-    std::vector<AmpKnob> current_knobs = {
+    // Drive first and the level, mix and master row last, the knobs in
+    // between go on the top row
+    std::vector<AmpKnob> helios_knobs = {
         {&drive_knob,  "overdrive_drive",    "drive" },
         {&era_knob,    "overdrive_era",      "era"   },
         {&grunt_knob,  "overdrive_grunt",    "grunt" },
@@ -65,6 +57,33 @@ class AmpKnobsComponent : public juce::Component
         {&mix_knob,    "overdrive_mix",      "mix"   },
         {&master_knob, "amp_master",         "master"},
     };
+    std::vector<AmpKnob> borealis_knobs = {
+        {&drive_knob,           "overdrive_drive",          "drive"   },
+        {&cross_frequency_knob, "overdrive_x_frequency",    "hi pass" },
+        {&bass_frequency_knob,  "overdrive_bass_frequency", "low pass"},
+        {&level_knob,           "overdrive_level_db",       "level"   },
+        {&mix_knob,             "overdrive_mix",            "mix"     },
+        {&master_knob,          "amp_master",               "master"  },
+    };
+    std::vector<AmpKnob> nebula_knobs = {
+        {&drive_knob,  "overdrive_drive",    "drive" },
+        {&grunt_knob,  "overdrive_grunt",    "bass"  },
+        {&era_knob,    "overdrive_era",      "mid"   },
+        {&attack_knob, "overdrive_attack",   "treble"},
+        {&level_knob,  "overdrive_level_db", "level" },
+        {&mix_knob,    "overdrive_mix",      "mix"   },
+        {&master_knob, "amp_master",         "master"},
+    };
+    std::vector<AmpKnob> pulsar_knobs = {
+        {&drive_knob,  "overdrive_drive",    "fuzz"  },
+        {&grunt_knob,  "overdrive_grunt",    "bass"  },
+        {&era_knob,    "overdrive_era",      "mid"   },
+        {&attack_knob, "overdrive_attack",   "tone"  },
+        {&level_knob,  "overdrive_level_db", "level" },
+        {&mix_knob,    "overdrive_mix",      "mix"   },
+        {&master_knob, "amp_master",         "master"},
+    };
+    std::vector<AmpKnob> current_knobs = helios_knobs;
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(AmpKnobsComponent)
 };
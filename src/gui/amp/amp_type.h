@@ -2,6 +2,8 @@
 #include "../colours.h"
 #include "designs/borealis.h"
 #include "designs/helios.h"
+#include "designs/nebula.h"
+#include "designs/pulsar.h"
 #include <juce_gui_basics/juce_gui_basics.h>
 
 struct AmpType
@@ -81,3 +83,73 @@ class BorealisToggleButton : public juce::ToggleButton
     juce::Colour colour1;
     juce::Colour colour2;
 };
+
+class NebulaToggleButton : public juce::ToggleButton
+{
+  public:
+    NebulaToggleButton(AmpType t)
+    {
+        colour1 = t.colour1;
+        colour2 = t.colour2;
+    }
+    ~NebulaToggleButton() override
+    {
+    }
+
+    void paint(juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds().toFloat();
+        juce::Colour c1;
+        juce::Colour c2;
+        if (getToggleState())
+        {
+            c1 = colour1;
+            c2 = colour2;
+        }
+        else
+        {
+            c1 = findColour(juce::ToggleButton::textColourId);
+            c2 = findColour(juce::ToggleButton::textColourId);
+        }
+        paintIconNebula(g, bounds, c1, c2);
+    }
+
+  private:
+    juce::Colour colour1;
+    juce::Colour colour2;
+};
+
+class PulsarToggleButton : public juce::ToggleButton
+{
+  public:
+    PulsarToggleButton(AmpType t)
+    {
+        colour1 = t.colour1;
+        colour2 = t.colour2;
+    }
+    ~PulsarToggleButton() override
+    {
+    }
+
+    void paint(juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds().toFloat();
+        juce::Colour c1;
+        juce::Colour c2;
+        if (getToggleState())
+        {
+            c1 = colour1;
+            c2 = colour2;
+        }
+        else
+        {
+            c1 = findColour(juce::ToggleButton::textColourId);
+            c2 = findColour(juce::ToggleButton::textColourId);
+        }
+        paintIconPulsar(g, bounds, c1, c2);
+    }
+
+  private:
+    juce::Colour colour1;
+    juce::Colour colour2;
+};
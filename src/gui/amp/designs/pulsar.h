@@ -0,0 +1,111 @@
+#pragma once
+#include "../../colours.h"
+#include <cmath>
+#include <juce_graphics/juce_graphics.h>
+
+inline void paintIconPulsar(
+    juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour c1,
+    juce::Colour c2
+)
+{
+    auto center = bounds.getCentre();
+    float maxRadius = bounds.getHeight() * 0.45f;
+    const float borderThickness = 2.0f;
+
+    g.setColour(juce::Colours::black);
+    g.fillEllipse(
+        center.x - maxRadius, center.y - maxRadius, maxRadius * 2.0f,
+        maxRadius * 2.0f
+    );
+
+    juce::ColourGradient gradient(
+        c1, center.x - maxRadius, center.y, // left side
+        c2, center.x + maxRadius, center.y, // right side
+        false                               // not radial, just linear
+    );
+    g.setGradientFill(gradient);
+    g.drawEllipse(
+        center.x - maxRadius, center.y - maxRadius, maxRadius * 2,
+        maxRadius * 2, borderThickness
+    );
+
+    maxRadius -= borderThickness * maxRadius * 0.03f;
+
+    juce::Path circlePath;
+    circlePath.addEllipse(
+        center.x - maxRadius, center.y - maxRadius, maxRadius * 2.0f,
+        maxRadius * 2.0f
+    );
+    g.reduceClipRegion(circlePath);
+
+    // Rings getting thinner away from the core
+    const int numRings = 5;
+    for (int i = numRings; i > 0; --i)
+    {
+        float proportion = (float)i / numRings;
+        float radius = maxRadius * proportion;
+        g.setColour(c1.interpolatedWith(c2, proportion));
+        g.drawEllipse(
+            center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f,
+            maxRadius * 0.08f * (1.0f - proportion) + 1.0f
+        );
+    }
+
+    // Core with the two beams across it
+    float coreRadius = maxRadius * 0.18f;
+    juce::ColourGradient coreGradient(
+        c2, center.x, center.y, c1, center.x + coreRadius, center.y, true
+    );
+    g.setGradientFill(coreGradient);
+    g.fillEllipse(
+        center.x - coreRadius, center.y - coreRadius, coreRadius * 2.0f,
+        coreRadius * 2.0f
+    );
+
+    juce::Path beams;
+    float beamWidth = coreRadius * 0.5f;
+    beams.addTriangle(
+        center.x - beamWidth, center.y, center.x + beamWidth, center.y,
+        center.x, center.y - maxRadius
+    );
+    beams.addTriangle(
+        center.x - beamWidth, center.y, center.x + beamWidth, center.y,
+        center.x, center.y + maxRadius
+    );
+    beams.applyTransform(
+        juce::AffineTransform::rotation(0.4f, center.x, center.y)
+    );
+    g.setGradientFill(gradient);
+    g.fillPath(beams);
+}
+
+inline void paintDesignPulsar(
+    juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour c1,
+    juce::Colour c2
+)
+{
+    juce::Graphics::ScopedSaveState state(g);
+
+    auto center = bounds.getCentre();
+
+    juce::Path boxPath;
+    boxPath.addRectangle(bounds);
+    g.reduceClipRegion(boxPath);
+
+    // Pulses spreading from the star, further apart as they travel
+    const int numPulses = 16;
+    float maxBackgroundRadius = bounds.getWidth() * 0.8f;
+
+    for (int i = 1; i <= numPulses; ++i)
+    {
+        float proportion = (float)i / numPulses;
+        float currentRadius = maxBackgroundRadius * proportion * proportion;
+
+        g.setColour(GuiColours::DEFAULT_INACTIVE_COLOUR);
+        g.drawEllipse(
+            center.x - currentRadius, center.y - currentRadius,
+            currentRadius * 2, currentRadius * 2, 1.0f
+        );
+    }
+    paintIconPulsar(g, bounds, c1, c2);
+}
@@ -39,6 +39,9 @@ juce::Colour const helios_orange = juce::Colour(138, 38, 27);
 
 juce::Colour const nebula_red = juce::Colour(191, 97, 106);
 juce::Colour const nebula_violet = juce::Colour(180, 142, 173);
+
+juce::Colour const pulsar_green = juce::Colour(163, 190, 140);
+juce::Colour const pulsar_orange = juce::Colour(208, 135, 112);
 } // namespace ColourCodes
 
 namespace GuiColours
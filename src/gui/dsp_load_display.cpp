@@ -0,0 +1,120 @@
+#include "dsp_load_display.h"
+#include "fonts.h"
+
+namespace
+{
+juce::Colour const stage_colours[StageProfiler::num_stages] = {
+    ColourCodes::white0,        ColourCodes::blue0,
+    ColourCodes::aurora_green,  ColourCodes::helios_yellow,
+    ColourCodes::aurora_orange, ColourCodes::blue2,
+    ColourCodes::aurora_violet, ColourCodes::blue3,
+    ColourCodes::white2
+};
+} // namespace
+
+DspLoadDisplay::DspLoadDisplay(StageProfiler& p) : profiler(p)
+{
+    startTimerHz(30);
+}
+
+DspLoadDisplay::~DspLoadDisplay()
+{
+    stopTimer();
+}
+
+void DspLoadDisplay::timerCallback()
+{
+    std::array<juce::int64, StageProfiler::num_stages> stage_ticks{};
+    juce::int64 total_ticks = 0;
+    juce::int64 deadline_ticks = 0;
+
+    profiler.popFrames(
+        [&](const StageProfiler::Frame& frame)
+        {
+            for (size_t i = 0; i < stage_ticks.size(); ++i)
+                stage_ticks[i] += frame.stage_ticks[i];
+            total_ticks += frame.total_ticks;
+            deadline_ticks += frame.deadline_ticks;
+        }
+    );
+
+    // Nothing processed since the last tick, keep the previous readout
+    if (deadline_ticks > 0)
+    {
+        const float smoothing = 0.2f;
+        for (size_t i = 0; i < stage_loads.size(); ++i)
+        {
+            float load = (float)stage_ticks[i] / (float)deadline_ticks;
+            stage_loads[i] += (load - stage_loads[i]) * smoothing;
+        }
+        float load = (float)total_ticks / (float)deadline_ticks;
+        total_load += (load - total_load) * smoothing;
+    }
+
+    worst_load = profiler.getWorstBlockLoad();
+    deadline_misses = profiler.getDeadlineMisses();
+    repaint();
+}
+
+void DspLoadDisplay::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+    auto bar = bounds.removeFromBottom(4.0f);
+
+    // Stacked bar, full width is 100% of the block duration
+    g.setColour(ColourCodes::grey0);
+    g.fillRect(bar);
+    float x = bar.getX();
+    for (size_t i = 0; i < stage_loads.size(); ++i)
+    {
+        float width = juce::jlimit(
+            0.0f, bar.getRight() - x, stage_loads[i] * bar.getWidth()
+        );
+        g.setColour(stage_colours[i]);
+        g.fillRect(x, bar.getY(), width, bar.getHeight());
+        x += width;
+    }
+
+    size_t heaviest = 0;
+    for (size_t i = 1; i < stage_loads.size(); ++i)
+        if (stage_loads[i] > stage_loads[heaviest])
+            heaviest = i;
+
+    auto top_line = bounds.removeFromTop(bounds.getHeight() / 2.0f);
+    g.setFont(Fonts::getFont(11.0f));
+    g.setColour(total_load > 0.8f ? ColourCodes::aurora_red
+                                  : ColourCodes::white0);
+    g.drawText(
+        "DSP " + juce::String(juce::roundToInt(total_load * 100.0f)) + "%  " +
+            StageProfiler::stage_names[heaviest] + " " +
+            juce::String(juce::roundToInt(stage_loads[heaviest] * 100.0f)) +
+            "%",
+        top_line, juce::Justification::centredLeft
+    );
+
+    g.setColour(deadline_misses > 0 ? ColourCodes::aurora_red
+                                    : ColourCodes::grey3);
+    g.drawText(
+        "max " + juce::String(juce::roundToInt(worst_load * 100.0f)) +
+            "%  miss " + juce::String(deadline_misses),
+        bounds, juce::Justification::centredLeft
+    );
+}
+
+void DspLoadDisplay::mouseDown(const juce::MouseEvent&)
+{
+    profiler.resetCounters();
+}
+
+void DspLoadDisplay::visibilityChanged()
+{
+    juce::MessageManager::callAsync(
+        [this]
+        {
+            if (isShowing())
+                startTimerHz(30);
+            else
+                stopTimer();
+        }
+    );
+}
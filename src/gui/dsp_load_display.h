@@ -0,0 +1,33 @@
+#pragma once
+
+#include "../dsp/stage_profiler.h"
+#include "colours.h"
+#include <juce_gui_basics/juce_gui_basics.h>
+
+// Small DSP load readout for the header: average load of the whole chain as
+// a stacked bar split by stage, the heaviest stage, the worst block since the
+// last reset and the number of blocks that missed their deadline. Clicking
+// resets the worst block and deadline miss counters.
+class DspLoadDisplay : public juce::Component, private juce::Timer
+{
+  public:
+    DspLoadDisplay(StageProfiler&);
+    ~DspLoadDisplay() override;
+
+    void paint(juce::Graphics&) override;
+    void mouseDown(const juce::MouseEvent&) override;
+    void visibilityChanged() override;
+
+  private:
+    void timerCallback() override;
+
+    StageProfiler& profiler;
+
+    // Smoothed load of each stage relative to the block duration
+    std::array<float, StageProfiler::num_stages> stage_loads{};
+    float total_load = 0.0f;
+    float worst_load = 0.0f;
+    int deadline_misses = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DspLoadDisplay)
+};
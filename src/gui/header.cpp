@@ -7,10 +7,10 @@
 
 Header::Header(
     juce::AudioProcessorValueTreeState& params, juce::Value& vin,
-    juce::Value& vout, SessionManager& sm
+    juce::Value& vout, SessionManager& sm, StageProfiler& profiler
 )
     : parameters(params), inputMeter(vin), outputMeter(vout),
-      sessionNameDisplay(sm), presetBar(sm)
+      sessionNameDisplay(sm), presetBar(sm), dspLoadDisplay(profiler)
 {
     addAndMakeVisible(inputMeter);
     addAndMakeVisible(outputMeter);
@@ -58,6 +58,7 @@ Header::Header(
     addAndMakeVisible(presetIconButtons);
     addAndMakeVisible(sessionNameDisplay);
     addAndMakeVisible(presetBar);
+    addAndMakeVisible(dspLoadDisplay);
 }
 
 Header::~Header()
@@ -144,6 +145,12 @@ void Header::resized()
     int const iconButtonsWidth = iconButtonSize * 4;
     int const sessionNameWidth = 140;
     int const innerPadding = 5;
+    int const dspLoadWidth = 110;
+
+    // DSP load readout next to the output gain
+    dspLoadDisplay.setBounds(
+        bounds.removeFromRight(dspLoadWidth).reduced(innerPadding, 0)
+    );
 
     int const controlsWidth = 5 * iconButtonSize + sessionNameWidth;
 
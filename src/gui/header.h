@@ -1,6 +1,7 @@
 #pragma once
 
 #include "colours.h"
+#include "dsp_load_display.h"
 #include "meter.h"
 #include "preset_bar.h"
 #include "preset_icon_buttons.h"
@@ -12,7 +13,7 @@
 class Header : public juce::Component
 {
   public:
-    Header(juce::AudioProcessorValueTreeState&, juce::Value&, juce::Value&, SessionManager&);
+    Header(juce::AudioProcessorValueTreeState&, juce::Value&, juce::Value&, SessionManager&, StageProfiler&);
     ~Header() override;
 
     void resized() override;
@@ -42,6 +43,7 @@ class Header : public juce::Component
     PresetIconButtons presetIconButtons;
     SessionNameDisplay sessionNameDisplay;
     PresetBar presetBar;
+    DspLoadDisplay dspLoadDisplay;
 
   public:
     std::function<void()> onTunerClicked;
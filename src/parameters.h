@@ -1,6 +1,25 @@
 #include "assets/ImpulseResponseBinaryMapping.h"
 #include <juce_dsp/juce_dsp.h>
 
+// Amp oversampling choices, see oversampling_settings in
+// plugin_audio_processor.cpp for the factor and filter of each
+inline const juce::StringArray oversamplingChoices{
+    "1x", "2x", "4x", "8x", "2x Linear Phase", "4x Linear Phase",
+    "8x Linear Phase"
+};
+
+// Amp models, in the order of AmpSelector::Model
+inline const juce::StringArray ampTypeChoices{
+    "Helios", "Borealis", "Nebula", "Pulsar"
+};
+
+inline juce::StringArray renderOversamplingChoices()
+{
+    juce::StringArray choices{"Same as Realtime"};
+    choices.addArray(oversamplingChoices);
+    return choices;
+}
+
 inline juce::AudioProcessorValueTreeState::ParameterLayout
 createParameterLayout()
 {
@@ -60,6 +79,9 @@ createParameterLayout()
         std::make_unique<juce::AudioParameterBool>(
             "amp_bypass", "Amp Bypass", false
         ),
+        std::make_unique<juce::AudioParameterChoice>(
+            "amp_type", "Amp Type", ampTypeChoices, 0
+        ),
         std::make_unique<juce::AudioParameterFloat>(
             "overdrive_level_db", "Overdrive Level dB",
             juce::NormalisableRange<float>(-48.0f, 6.0f, 0.1f, 1.0f), 0.0f
@@ -80,10 +102,31 @@ createParameterLayout()
             "overdrive_era", "Overdrive Era",
             juce::NormalisableRange<float>(0.0f, 10.0f, 0.01f), 5.0f
         ),
+        std::make_unique<juce::AudioParameterFloat>(
+            "overdrive_x_frequency", "Overdrive Crossover Frequency (Hz)",
+            juce::NormalisableRange<float>(250.0f, 1000.0f, 1.0f, 0.5f),
+            500.0f
+        ),
+        std::make_unique<juce::AudioParameterFloat>(
+            "overdrive_bass_frequency", "Overdrive Bass Frequency (Hz)",
+            juce::NormalisableRange<float>(50.0f, 500.0f, 1.0f, 0.5f), 250.0f
+        ),
         std::make_unique<juce::AudioParameterFloat>(
             "overdrive_mix", "Overdrive Mix",
             juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f), 0.5f
         ),
+        std::make_unique<juce::AudioParameterChoice>(
+            "overdrive_adaa", "Overdrive Anti-aliasing",
+            juce::StringArray{"Off", "1st Order", "2nd Order"}, 0
+        ),
+        std::make_unique<juce::AudioParameterChoice>(
+            "overdrive_oversampling", "Overdrive Oversampling",
+            oversamplingChoices, 1
+        ),
+        std::make_unique<juce::AudioParameterChoice>(
+            "overdrive_render_oversampling", "Overdrive Render Oversampling",
+            renderOversamplingChoices(), 0
+        ),
         std::make_unique<juce::AudioParameterBool>(
             "chorus_bypass", "Chorus Mix", false
         ),
@@ -118,6 +161,18 @@ createParameterLayout()
             "ir_level", "Impulse Response Level",
             juce::NormalisableRange<float>(-36.0f, 12.0f, 0.1f, 1.0f), -18.0f
         ),
+        std::make_unique<juce::AudioParameterFloat>(
+            "parallel_blend", "Parallel Blend",
+            juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f), 0.5f
+        ),
+        std::make_unique<juce::AudioParameterChoice>(
+            "bypass_mode", "Bypass Mode", juce::StringArray{"Reset", "Warm"},
+            0
+        ),
+        std::make_unique<juce::AudioParameterChoice>(
+            "input_mode", "Input Mode", juce::StringArray{"Mono", "Dual Mono"},
+            0
+        ),
         std::make_unique<juce::AudioParameterBool>(
             "synth_bypass", "Synth Bypass", true
         ),
@@ -1,186 +1,203 @@
 #include "plugin_audio_processor.h"
+#include <limits>
 
-void PluginAudioProcessor::setParameterValue(juce::String parameterID, float v)
+namespace
 {
-    if (parameterID == "compressor_attack")
-    {
-        compressor.setAttack(v);
-    }
-    else if (parameterID == "compressor_hpf")
-    {
-        compressor.setHPF(v);
-    }
-    else if (parameterID == "compressor_release")
-    {
-        compressor.setRelease(v);
-    }
-    else if (parameterID == "compressor_ratio")
-    {
-        compressor.setRatio(v);
-    }
-    else if (parameterID == "compressor_threshold")
-    {
-        compressor.setThresholdDecibels(v);
-    }
-    else if (parameterID == "compressor_level_db")
-    {
-        compressor.setLevel(juce::Decibels::decibelsToGain(v));
-    }
-    else if (parameterID == "compressor_mix")
-    {
-        float bv = juce::jlimit(0.0f, 1.0f, v);
-        compressor.setMix(bv);
-    }
-    // Overdrive
-    else if (parameterID == "overdrive_mix")
-    {
-        float bv = juce::jlimit(0.0f, 1.0f, v);
-        overdrive.setMix(bv);
-    }
-    else if (parameterID == "overdrive_level_db")
-    {
-        overdrive.setLevel(juce::Decibels::decibelsToGain(v));
-    }
-    else if (parameterID == "overdrive_drive")
-    {
-        float bv = juce::jlimit(0.0f, 10.0f, v);
-        overdrive.setDrive(bv);
-    }
-    else if (parameterID == "overdrive_attack")
-    {
-        overdrive.setAttack(v);
-    }
-    else if (parameterID == "overdrive_era")
-    {
-        overdrive.setEra(v);
-    }
-    else if (parameterID == "overdrive_grunt")
-    {
-        overdrive.setGrunt(v);
-    }
-    // EQ
-    else if (parameterID == "eq_low_shelf_gain")
-    {
-        float bv = juce::jlimit(-20.0f, 20.0f, v);
-        float dbv = juce::Decibels::decibelsToGain(bv);
-        eq.setLowShelfGain(dbv);
-    }
-    else if (parameterID == "eq_low_shelf_freq")
-    {
-        float bv = juce::jlimit(0.0f, 20000.0f, v);
-        eq.setLowShelfFreq(bv);
-    }
-    else if (parameterID == "eq_low_mid_freq")
-    {
-        float bv = juce::jlimit(200.0f, 800.0f, v);
-        eq.setLowMidFreq(bv);
-    }
-    else if (parameterID == "eq_low_mid_q")
-    {
-        float bv = juce::jlimit(0.1f, 4.0f, v);
-        eq.setLowMidQ(bv);
-    }
-    else if (parameterID == "eq_low_mid_gain")
-    {
-        float bv = juce::jlimit(-20.0f, 20.0f, v);
-        float dbv = juce::Decibels::decibelsToGain(bv);
-        eq.setLowMidGain(dbv);
-    }
-    else if (parameterID == "eq_high_mid_freq")
-    {
-        float bv = juce::jlimit(800.0f, 2500.0f, v);
-        eq.setHighMidFreq(bv);
-    }
-    else if (parameterID == "eq_high_mid_q")
-    {
-        float bv = juce::jlimit(0.1f, 4.0f, v);
-        eq.setHighMidQ(bv);
-    }
-    else if (parameterID == "eq_high_mid_gain")
-    {
-        float bv = juce::jlimit(-20.0f, 20.0f, v);
-        float dbv = juce::Decibels::decibelsToGain(bv);
-        eq.setHighMidGain(dbv);
-    }
-    else if (parameterID == "eq_high_shelf_gain")
-    {
-        float bv = juce::jlimit(-20.0f, 20.0f, v);
-        float dbv = juce::Decibels::decibelsToGain(bv);
-        eq.setHighShelfGain(dbv);
-    }
-    else if (parameterID == "eq_high_shelf_freq")
-    {
-        float bv = juce::jlimit(0.0f, 20000.0f, v);
-        eq.setHighShelfFreq(bv);
-    }
-    else if (parameterID == "eq_lpf")
-    {
-        float bv = juce::jlimit(1000.0f, 10000.0f, v);
-        eq.setLpfFreq(bv);
-    }
-    // Chorus
-    else if (parameterID == "chorus_mix")
-    {
-        float bv = juce::jlimit(0.0f, 1.0f, v);
-        chorus.setMix(bv);
-    }
-    else if (parameterID == "chorus_rate")
-    {
-        float bv = juce::jlimit(0.0f, 5.0f, v);
-        chorus.setRate(bv);
-    }
-    else if (parameterID == "chorus_crossover")
-    {
-        float bv = juce::jlimit(50.0f, 10000.0f, v);
-        chorus.setCrossover(bv);
-    }
-    else if (parameterID == "chorus_depth")
-    {
-        float bv = juce::jlimit(0.0f, 6.0f, v);
-        chorus.setDepth(bv);
-    }
-    // Impulse Response Convolver
-    else if (parameterID == "ir_mix")
-    {
-        float bv = juce::jlimit(0.0f, 1.0f, v);
-        irConvolver.setMix(bv);
-    }
-    else if (parameterID == "ir_level")
-    {
-        irConvolver.setLevel(juce::Decibels::decibelsToGain(v));
-    }
-    else if (parameterID == "ir_type")
-    {
-        irConvolver.setTypeFromIndex(static_cast<int>(v));
-    }
-    else if (parameterID == "synth_octave_level")
-    {
-        float dbv =
-            juce::Decibels::decibelsToGain(juce::jlimit(-100.0f, 6.0f, v));
-        synth_voices.setOctaveLevel(dbv);
-    }
-    else if (parameterID == "synth_square_level")
+constexpr float unbounded = std::numeric_limits<float>::max();
+
+inline float toGain(float db)
+{
+    return juce::Decibels::decibelsToGain(db);
+}
+} // namespace
+
+// Constant-initialised: the setters are captureless lambdas, so the whole
+// table is laid out at compile time and dispatch is a single indexed call.
+const std::array<
+    PluginAudioProcessor::ParameterEntry,
+    PluginAudioProcessor::num_parameter_slots>
+    PluginAudioProcessor::parameter_table = {{
+        // Compressor
+        {compressor_attack, "compressor_attack", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v) { p.compressor.setAttack(v); }},
+        {compressor_hpf, "compressor_hpf", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v) { p.compressor.setHPF(v); }},
+        {compressor_release, "compressor_release", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v) { p.compressor.setRelease(v); }},
+        {compressor_ratio, "compressor_ratio", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v) { p.compressor.setRatio(v); }},
+        {compressor_threshold, "compressor_threshold", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v)
+         { p.compressor.setThresholdDecibels(v); }},
+        {compressor_level_db, "compressor_level_db", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v)
+         { p.compressor.setLevel(toGain(v)); }},
+        {compressor_mix, "compressor_mix", 0.0f, 1.0f,
+         [](PluginAudioProcessor& p, float v) { p.compressor.setMix(v); }},
+        // Overdrive
+        {overdrive_mix, "overdrive_mix", 0.0f, 1.0f,
+         [](PluginAudioProcessor& p, float v) { p.overdrive.setMix(v); }},
+        {overdrive_level_db, "overdrive_level_db", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v)
+         { p.overdrive.setLevel(toGain(v)); }},
+        {overdrive_drive, "overdrive_drive", 0.0f, 10.0f,
+         [](PluginAudioProcessor& p, float v) { p.overdrive.setDrive(v); }},
+        {overdrive_attack, "overdrive_attack", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v) { p.overdrive.setAttack(v); }},
+        {overdrive_era, "overdrive_era", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v) { p.overdrive.setEra(v); }},
+        {overdrive_grunt, "overdrive_grunt", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v) { p.overdrive.setGrunt(v); }},
+        {overdrive_x_frequency, "overdrive_x_frequency", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v)
+         { p.overdrive.setCrossFrequency(v); }},
+        {overdrive_bass_frequency, "overdrive_bass_frequency", -unbounded,
+         unbounded, [](PluginAudioProcessor& p, float v)
+         { p.overdrive.setBassFrequency(v); }},
+        {amp_type, "amp_type", 0.0f, 3.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.overdrive.setModel(static_cast<int>(v)); }},
+        // EQ
+        {eq_low_shelf_gain, "eq_low_shelf_gain", -20.0f, 20.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.eq.setLowShelfGain(toGain(v)); }},
+        {eq_low_shelf_freq, "eq_low_shelf_freq", 0.0f, 20000.0f,
+         [](PluginAudioProcessor& p, float v) { p.eq.setLowShelfFreq(v); }},
+        {eq_low_mid_freq, "eq_low_mid_freq", 200.0f, 800.0f,
+         [](PluginAudioProcessor& p, float v) { p.eq.setLowMidFreq(v); }},
+        {eq_low_mid_q, "eq_low_mid_q", 0.1f, 4.0f,
+         [](PluginAudioProcessor& p, float v) { p.eq.setLowMidQ(v); }},
+        {eq_low_mid_gain, "eq_low_mid_gain", -20.0f, 20.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.eq.setLowMidGain(toGain(v)); }},
+        {eq_high_mid_freq, "eq_high_mid_freq", 800.0f, 2500.0f,
+         [](PluginAudioProcessor& p, float v) { p.eq.setHighMidFreq(v); }},
+        {eq_high_mid_q, "eq_high_mid_q", 0.1f, 4.0f,
+         [](PluginAudioProcessor& p, float v) { p.eq.setHighMidQ(v); }},
+        {eq_high_mid_gain, "eq_high_mid_gain", -20.0f, 20.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.eq.setHighMidGain(toGain(v)); }},
+        {eq_high_shelf_gain, "eq_high_shelf_gain", -20.0f, 20.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.eq.setHighShelfGain(toGain(v)); }},
+        {eq_high_shelf_freq, "eq_high_shelf_freq", 0.0f, 20000.0f,
+         [](PluginAudioProcessor& p, float v) { p.eq.setHighShelfFreq(v); }},
+        {eq_lpf, "eq_lpf", 1000.0f, 10000.0f,
+         [](PluginAudioProcessor& p, float v) { p.eq.setLpfFreq(v); }},
+        // Chorus
+        {chorus_mix, "chorus_mix", 0.0f, 1.0f,
+         [](PluginAudioProcessor& p, float v) { p.chorus.setMix(v); }},
+        {chorus_rate, "chorus_rate", 0.0f, 5.0f,
+         [](PluginAudioProcessor& p, float v) { p.chorus.setRate(v); }},
+        {chorus_crossover, "chorus_crossover", 50.0f, 10000.0f,
+         [](PluginAudioProcessor& p, float v) { p.chorus.setCrossover(v); }},
+        {chorus_depth, "chorus_depth", 0.0f, 6.0f,
+         [](PluginAudioProcessor& p, float v) { p.chorus.setDepth(v); }},
+        // Impulse Response Convolver
+        {ir_mix, "ir_mix", 0.0f, 1.0f,
+         [](PluginAudioProcessor& p, float v) { p.irConvolver.setMix(v); }},
+        {ir_level, "ir_level", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v)
+         { p.irConvolver.setLevel(toGain(v)); }},
+        {ir_type, "ir_type", -unbounded, unbounded,
+         [](PluginAudioProcessor& p, float v)
+         { p.irConvolver.setTypeFromIndex(static_cast<int>(v)); }},
+        // Synth voices
+        {synth_octave_level, "synth_octave_level", -100.0f, 6.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.synth_voices.setOctaveLevel(toGain(v)); }},
+        {synth_square_level, "synth_square_level", -100.0f, 6.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.synth_voices.setSquareLevel(toGain(v)); }},
+        {synth_triangle_level, "synth_triangle_level", -100.0f, 6.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.synth_voices.setTriangleLevel(toGain(v)); }},
+        {synth_raw_level, "synth_raw_level", -100.0f, 6.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.synth_voices.setRawLevel(toGain(v)); }},
+        {synth_master_level, "synth_master_level", -100.0f, 6.0f,
+         [](PluginAudioProcessor& p, float v)
+         { p.synth_voices.setMasterLevel(toGain(v)); }},
+    }};
+
+void PluginAudioProcessor::resolveParameterSlots()
+{
+    // The only place parameter IDs are compared, run once at construction
+    auto& all_parameters = getParameters();
+    parameter_slots.assign((size_t)all_parameters.size(), -1);
+
+    for (auto& entry : parameter_table)
     {
-        float dbv =
-            juce::Decibels::decibelsToGain(juce::jlimit(-100.0f, 6.0f, v));
-        synth_voices.setSquareLevel(dbv);
+        jassert((int)entry.slot == (int)(&entry - parameter_table.data()));
+        auto* parameter = parameters.getParameter(entry.id);
+        jassert(parameter != nullptr);
+        if (parameter == nullptr)
+            continue;
+
+        parameter_slots[(size_t)parameter->getParameterIndex()] = entry.slot;
+        slot_parameters[(size_t)entry.slot] = parameter;
+        parameter->addListener(this);
     }
-    else if (parameterID == "synth_triangle_level")
-    {
-        float dbv =
-            juce::Decibels::decibelsToGain(juce::jlimit(-100.0f, 6.0f, v));
-        synth_voices.setTriangleLevel(dbv);
+}
+
+void PluginAudioProcessor::setParameterValue(ParameterSlot slot, float v)
+{
+    const auto& entry = parameter_table[(size_t)slot];
+    entry.apply(*this, juce::jlimit(entry.min, entry.max, v));
+}
+
+void PluginAudioProcessor::parameterValueChanged(
+    int parameterIndex, float newValue
+)
+{
+    int slot = parameter_slots[(size_t)parameterIndex];
+    if (slot < 0)
+    {
+        // The amp setup reallocates or changes the latency, it is applied
+        // from the message thread on the next timer tick. Only a flag is
+        // set here: hosts may call this on the audio thread, where posting
+        // a message could lock or allocate.
+        for (auto* p : amp_setup_parameters)
+            if (p->getParameterIndex() == parameterIndex)
+                is_amp_setup_changed.store(true);
+        return;
     }
-    else if (parameterID == "synth_raw_level")
+
+    auto* parameter = slot_parameters[(size_t)slot];
+    pending_values[(size_t)slot].store(
+        parameter->convertFrom0to1(newValue), std::memory_order_relaxed
+    );
+    pending_slots.fetch_or(
+        (juce::uint64)1 << slot, std::memory_order_release
+    );
+}
+
+void PluginAudioProcessor::applyPendingParameters()
+{
+    // Called by the audio thread at the start of each block. Slots are
+    // applied in table order, whatever order the changes arrived in.
+    auto slots = pending_slots.exchange(0, std::memory_order_acquire);
+    for (int slot = 0; slots != 0; ++slot, slots >>= 1)
     {
-        float dbv =
-            juce::Decibels::decibelsToGain(juce::jlimit(-100.0f, 6.0f, v));
-        synth_voices.setRawLevel(dbv);
+        if ((slots & 1) != 0)
+            setParameterValue(
+                (ParameterSlot)slot,
+                pending_values[(size_t)slot].load(std::memory_order_relaxed)
+            );
     }
-    else if (parameterID == "synth_master_level")
-    {
-        float dbv =
-            juce::Decibels::decibelsToGain(juce::jlimit(-100.0f, 6.0f, v));
-        synth_voices.setMasterLevel(dbv);
+}
+
+void PluginAudioProcessor::prepareParameters()
+{
+    // Audio is stopped here, apply everything directly
+    pending_slots.store(0);
+    for (size_t slot = 0; slot < slot_parameters.size(); ++slot)
+    {
+        auto* parameter = slot_parameters[slot];
+        if (parameter != nullptr)
+            setParameterValue(
+                (ParameterSlot)slot,
+                parameter->convertFrom0to1(parameter->getValue())
+            );
     }
 }
@@ -4,6 +4,23 @@
 #include "plugin_audio_processor.h"
 #include <juce_dsp/juce_dsp.h>
 
+namespace
+{
+const juce::Identifier signal_chain_id("signal_chain");
+
+struct OversamplingSetting
+{
+    size_t factor;
+    bool linear_phase;
+};
+
+// Same order as oversamplingChoices in parameters.h
+constexpr OversamplingSetting oversampling_settings[] = {
+    {0, false}, {1, false}, {2, false}, {3, false},
+    {1, true},  {2, true},  {3, true},
+};
+} // namespace
+
 //==============================================================================
 PluginAudioProcessor::PluginAudioProcessor()
     : AudioProcessor(
@@ -42,19 +59,45 @@ PluginAudioProcessor::PluginAudioProcessor()
     compressor_bypass_parameter =
         parameters.getRawParameterValue("compressor_bypass");
     synth_bypass_parameter = parameters.getRawParameterValue("synth_bypass");
-
-    for (auto* p : getParameters())
-    {
-        if (auto* param = dynamic_cast<juce::RangedAudioParameter*>(p))
-        {
-            juce::String paramID = param->getParameterID();
-            parameters.addParameterListener(paramID, this);
-        }
-    }
+    parallel_blend_parameter =
+        parameters.getRawParameterValue("parallel_blend");
+    bypass_mode_parameter = parameters.getRawParameterValue("bypass_mode");
+    input_mode_parameter = parameters.getRawParameterValue("input_mode");
+    oversampling_parameter =
+        parameters.getRawParameterValue("overdrive_oversampling");
+    render_oversampling_parameter =
+        parameters.getRawParameterValue("overdrive_render_oversampling");
+    adaa_parameter = parameters.getRawParameterValue("overdrive_adaa");
+    amp_setup_parameters = {
+        parameters.getParameter("overdrive_oversampling"),
+        parameters.getParameter("overdrive_render_oversampling"),
+        parameters.getParameter("overdrive_adaa"),
+        parameters.getParameter("input_mode")
+    };
+    for (auto* p : amp_setup_parameters)
+        p->addListener(this);
+
+    node_bypass_parameters[SignalChain::compressor] =
+        compressor_bypass_parameter;
+    node_bypass_parameters[SignalChain::amp] = amp_bypass_parameter;
+    node_bypass_parameters[SignalChain::eq] = eq_bypass_parameter;
+    node_bypass_parameters[SignalChain::chorus] = chorus_bypass_parameter;
+    node_bypass_parameters[SignalChain::ir] = ir_bypass_parameter;
+    updateSignalChainFromState();
+
+    resolveParameterSlots();
+
+    startTimerHz(60);
 }
 
 PluginAudioProcessor::~PluginAudioProcessor()
 {
+    stopTimer();
+    for (auto* p : slot_parameters)
+        if (p != nullptr)
+            p->removeListener(this);
+    for (auto* p : amp_setup_parameters)
+        p->removeListener(this);
 }
 
 //==============================================================================
@@ -84,7 +127,10 @@ bool PluginAudioProcessor::isMidiEffect() const
 
 double PluginAudioProcessor::getTailLengthSeconds() const
 {
-    return 0.0;
+    // Cabinet IR and chorus delay line ring on after the input stops, the
+    // other stages only have short filter tails
+    return irConvolver.getTailLengthSeconds() +
+           chorus.getTailLengthSeconds();
 }
 
 int PluginAudioProcessor::getNumPrograms()
@@ -117,43 +163,6 @@ void PluginAudioProcessor::changeProgramName(
     juce::ignoreUnused(index, newName);
 }
 //==============================================================================
-void PluginAudioProcessor::parameterChanged(
-    const juce::String& parameterID, float newValue
-)
-{
-    setParameterValue(parameterID, newValue);
-}
-
-void PluginAudioProcessor::prepareParameters()
-{
-    // size_t amp_index = static_cast<size_t>(
-    //     parameters.getRawParameterValue("amp_type")->load()
-    // );
-
-    // iterate over all parameters to set their initial values
-    for (auto* p : getParameters())
-    {
-        if (auto* fparam = dynamic_cast<juce::AudioParameterFloat*>(p))
-        {
-            juce::String paramID = fparam->getParameterID();
-            float v = fparam->get();
-            setParameterValue(paramID, v);
-        }
-        else if (auto* cparam = dynamic_cast<juce::AudioParameterChoice*>(p))
-        {
-            juce::String paramID = cparam->getParameterID();
-            float v = cparam->getIndex();
-            setParameterValue(paramID, v);
-        }
-        else if (auto* rparam = dynamic_cast<juce::RangedAudioParameter*>(p))
-        {
-            juce::String paramID = rparam->getParameterID();
-            float v = rparam->getValue();
-            setParameterValue(paramID, v);
-        }
-    }
-}
-
 //==============================================================================
 void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
@@ -188,15 +197,59 @@ void PluginAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     startup_fade.setCurrentAndTargetValue(0.0f);
     startup_fade.setTargetValue(1.0f);
 
-    synth_voices.prepare(spec);
+    current_parallel_blend.reset(sampleRate, smoothing_time);
+    current_parallel_blend.setCurrentAndTargetValue(
+        parallel_blend_parameter->load()
+    );
+    branch_buffer.setSize(
+        (int)spec.numChannels, samplesPerBlock, false, false, true
+    );
+    bypass_buffer.setSize(
+        (int)spec.numChannels, samplesPerBlock, false, false, true
+    );
 
-    compressor.prepare(spec);
-    eq.prepare(spec);
+    // Start each node in its current state, without fading
+    for (size_t i = 0; i < node_fades.size(); ++i)
+    {
+        node_fades[i].reset(sampleRate, bypass_fade_time);
+        node_fades[i].setCurrentAndTargetValue(
+            node_bypass_parameters[i]->load() < 0.5f ? 1.0f : 0.0f
+        );
+        node_needs_reset[i] = false;
+        node_idle[i] = {};
+        warm_countdowns[i] = 0;
+    }
+    idle_hold_samples = (int)(idle_hold_time * sampleRate);
+    warm_interval_samples = (size_t)(warm_interval_time * sampleRate);
+
+    // The tuner and synth only ever see channel 0. The compressor and EQ
+    // keep state for both inputs of the dual mono mode but process a single
+    // channel otherwise. The amp is prepared for the channels of the input
+    // mode.
+    juce::dsp::ProcessSpec mono_spec = spec;
+    mono_spec.numChannels = 1;
+    juce::dsp::ProcessSpec dual_mono_spec = spec;
+    dual_mono_spec.numChannels = 2;
+    is_dual_mono = false;
+    chorus.setDualMono(false);
+
+    synth_voices.prepare(mono_spec);
+
+    compressor.prepare(dual_mono_spec);
+    eq.prepare(dual_mono_spec);
     irConvolver.prepare(spec);
     chorus.prepare(spec);
-    overdrive.prepare(spec);
-    pitch_detector.prepare(spec);
+    amp_spec = spec;
+    amp_spec.numChannels = getAmpNumChannels();
+    active_oversampling_choice = getOversamplingChoice();
+    active_adaa_order = getAdaaOrder();
+    configureOversampling();
+    pitch_detector.prepare(mono_spec);
+    profiler.prepare(sampleRate);
     prepareParameters();
+
+    // Start on the selected amp model rather than fading to it
+    overdrive.reset();
 }
 
 void PluginAudioProcessor::releaseResources()
@@ -242,6 +295,8 @@ void PluginAudioProcessor::processBlock(
     juce::ignoreUnused(midiMessages);
 
     juce::ScopedNoDenormals noDenormals;
+    profiler.beginBlock(buffer.getNumSamples());
+    applyPendingParameters();
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
     int num_samples = buffer.getNumSamples();
@@ -249,34 +304,35 @@ void PluginAudioProcessor::processBlock(
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear(i, 0, num_samples);
 
-    // Overwrite left channel of buffer with mono signal
-    auto* left = buffer.getReadPointer(0);
-    auto* right = buffer.getReadPointer(1);
-    auto* mono_left = buffer.getWritePointer(0);
-    auto* mono_right = buffer.getWritePointer(1);
-
-    for (int i = 0; i < num_samples; ++i)
-    {
-        mono_left[i] = left[i] + right[i];
-        mono_right[i] = 0.0f;
-    }
+    // Overwrite left channel of buffer with mono signal, the right channel
+    // is only filled again where the chain turns stereo
+    updateInputMode(totalNumInputChannels);
+    if (!is_dual_mono)
+        juce::FloatVectorOperations::add(
+            buffer.getWritePointer(0), buffer.getReadPointer(1), num_samples
+        );
 
     juce::dsp::AudioBlock<float> block(buffer);
-    juce::dsp::ProcessContextReplacing<float> context(block);
+    auto mono_block = block.getSingleChannelBlock(0);
+    juce::dsp::ProcessContextReplacing<float> mono_context(mono_block);
+    profiler.skipStage();
 
     float inputGainDb =
         juce::jlimit(-48.0f, 6.0f, input_gain_parameter->load());
     current_input_gain.setTargetValue(
         juce::Decibels::decibelsToGain(inputGainDb)
     );
-    current_input_gain.applyGain(buffer, num_samples);
+    if (is_dual_mono)
+        current_input_gain.applyGain(buffer, num_samples);
+    else
+        current_input_gain.applyGain(buffer.getWritePointer(0), num_samples);
     updateInputLevel(buffer);
+    profiler.endStage(StageProfiler::input_gain);
 
     if (!is_tuner_bypassed)
     {
-        float pitch = pitch_detector.getPitch(context);
-        currentPitch.setValue(pitch);
-        std::cout << "Detected Pitch: " << pitch << std::endl;
+        current_pitch.store(pitch_detector.getPitch(mono_context));
+        profiler.endStage(StageProfiler::tuner);
     }
     // else
     // {
@@ -284,62 +340,524 @@ void PluginAudioProcessor::processBlock(
     // }
 
     // if (synth_bypass_parameter->load() < 0.5f)
-    //     synth_voices.process(context);
+    //     synth_voices.process(mono_context);
+
+    processChain(block);
+    profiler.skipStage();
+
+    float outputGainDb =
+        juce::jlimit(-48.0f, 12.0f, output_gain_parameter->load());
+    current_output_gain.setTargetValue(
+        juce::Decibels::decibelsToGain(outputGainDb)
+    );
+    current_output_gain.applyGain(buffer, num_samples);
+
+    startup_fade.applyGain(buffer, num_samples);
+
+    updateOutputLevel(buffer);
+    profiler.endStage(StageProfiler::output_gain);
+    profiler.endBlock();
+}
+
+//==============================================================================
+// Process Block Helper functions
+//==============================================================================
 
-    if (compressor_bypass_parameter->load() < 0.5f)
+void PluginAudioProcessor::processChain(juce::dsp::AudioBlock<float>& block)
+{
+    // Routing changes land here, once per block
+    auto chain = SignalChain::unpack(packed_chain.load(std::memory_order_acquire));
+
+    juce::dsp::AudioBlock<float> branch =
+        juce::dsp::AudioBlock<float>(branch_buffer)
+            .getSubBlock(0, block.getNumSamples());
+
+    // The chain starts mono on channel 0, or with both inputs in dual mono
+    bool is_stereo = is_dual_mono;
+    bool is_branch_stereo = false;
+    bool in_parallel = false;
+    // Whether each lane already went through the amp and its latency
+    bool has_amp = false;
+    bool branch_has_amp = false;
+
+    for (int i = 0; i < chain.num_steps; ++i)
     {
-        compressor.process(context);
-        compressorGainReductionDb.setValue(compressor.getGainReductionDb());
+        const auto& step = chain.steps[(size_t)i];
+        if (step.lane != SignalChain::serial && !in_parallel)
+        {
+            // Branch B starts from the signal at the split point
+            branch.copyFrom(block);
+            is_branch_stereo = is_stereo;
+            branch_has_amp = has_amp;
+            in_parallel = true;
+        }
+        else if (step.lane == SignalChain::serial && in_parallel)
+        {
+            alignBranches(block, branch, has_amp, branch_has_amp);
+            mergeBranch(block, branch, is_stereo, is_branch_stereo);
+            in_parallel = false;
+        }
+
+        if (step.lane == SignalChain::branch_b)
+        {
+            processNode(step.node, branch, is_branch_stereo);
+            branch_has_amp |= step.node == SignalChain::amp;
+        }
+        else
+        {
+            processNode(step.node, block, is_stereo);
+            has_amp |= step.node == SignalChain::amp;
+        }
+    }
+    if (in_parallel)
+    {
+        alignBranches(block, branch, has_amp, branch_has_amp);
+        mergeBranch(block, branch, is_stereo, is_branch_stereo);
+    }
+    if (!has_amp)
+        delayBlock(chain_delay, block);
+
+    // Copy mono signal back to both left and right channels
+    if (!is_stereo)
+        block.getSingleChannelBlock(1).copyFrom(block.getSingleChannelBlock(0));
+}
+
+void PluginAudioProcessor::processNode(
+    SignalChain::Node node, juce::dsp::AudioBlock<float>& block,
+    bool& is_stereo
+)
+{
+    const size_t index = (size_t)node;
+    const bool is_enabled = node_bypass_parameters[index]->load() < 0.5f;
+    auto& fade = node_fades[index];
+    fade.setTargetValue(is_enabled ? 1.0f : 0.0f);
+
+    if (!fade.isSmoothing() && !is_enabled)
+    {
+        // Fully bypassed: either keep the state warm on a scratch copy of
+        // one block per warm interval, a fraction of the node's full cost,
+        // or skip the node and reset it before it comes back
+        if (bypass_mode_parameter->load() >= 0.5f)
+        {
+            const size_t num_samples = block.getNumSamples();
+            auto& countdown = warm_countdowns[index];
+            if (countdown <= num_samples)
+            {
+                auto scratch = juce::dsp::AudioBlock<float>(bypass_buffer)
+                                   .getSubBlock(0, num_samples);
+                scratch.copyFrom(block);
+                bool is_scratch_stereo = is_stereo;
+                matchNodeChannels(node, scratch, is_scratch_stereo);
+                runIdleGatedNode(node, scratch, is_scratch_stereo ? 2 : 1);
+                countdown = warm_interval_samples;
+            }
+            else
+            {
+                countdown -= num_samples;
+            }
+            node_needs_reset[index] = false;
+        }
+        else
+        {
+            node_needs_reset[index] = true;
+        }
+        if (node == SignalChain::amp)
+            delayBlock(amp_dry_delay, block);
+        return;
     }
 
-    if (amp_bypass_parameter->load() < 0.5f)
+    if (node_needs_reset[index])
     {
+        resetNode(node);
+        node_needs_reset[index] = false;
+    }
+    warm_countdowns[index] = 0;
+
+    matchNodeChannels(node, block, is_stereo);
+    const size_t num_samples = block.getNumSamples();
+    auto dry = juce::dsp::AudioBlock<float>(bypass_buffer)
+                   .getSubBlock(0, num_samples);
+    if (!fade.isSmoothing())
+    {
+        // Keep the amp's dry delay fed so a bypass fades from live history
+        if (node == SignalChain::amp && amp_latency > 0.0f)
+        {
+            dry.copyFrom(block);
+            delayBlock(amp_dry_delay, dry);
+        }
+        runIdleGatedNode(node, block, is_stereo ? 2 : 1);
+        return;
+    }
+
+    // Equal-power crossfade between the dry input and the processed output
+    const size_t num_channels = is_stereo ? 2 : 1;
+    dry.copyFrom(block);
+    if (node == SignalChain::amp)
+        delayBlock(amp_dry_delay, dry);
+    runNode(node, block);
+
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        float x = fade.getNextValue() * juce::MathConstants<float>::halfPi;
+        float wet_gain = std::sin(x);
+        float dry_gain = std::cos(x);
+        for (size_t ch = 0; ch < num_channels; ++ch)
+        {
+            auto* out = block.getChannelPointer(ch);
+            out[i] = wet_gain * out[i] + dry_gain * dry.getChannelPointer(ch)[i];
+        }
+    }
+}
+
+void PluginAudioProcessor::runIdleGatedNode(
+    SignalChain::Node node, juce::dsp::AudioBlock<float>& block,
+    size_t num_channels
+)
+{
+    // A node whose input and output stayed below the silence threshold for
+    // long enough is skipped until its input comes back. Checking the
+    // output too means tails (IR, chorus delay, filter ringing) have
+    // decayed before the node goes idle.
+    auto& idle = node_idle[(size_t)node];
+    float input_peak = getPeak(block, num_channels);
+    if (idle.is_idle)
+    {
+        if (input_peak < silence_threshold)
+            return;
+        idle.is_idle = false;
+        idle.silent_samples = 0;
+    }
+
+    runNode(node, block);
+
+    float output_peak = getPeak(block, num_channels);
+    if (input_peak < silence_threshold && output_peak < silence_threshold)
+    {
+        idle.silent_samples += (int)block.getNumSamples();
+        idle.is_idle = idle.silent_samples >= idle_hold_samples;
+    }
+    else
+    {
+        idle.silent_samples = 0;
+    }
+}
+
+float PluginAudioProcessor::getPeak(
+    const juce::dsp::AudioBlock<float>& block, size_t num_channels
+)
+{
+    float peak = 0.0f;
+    for (size_t ch = 0; ch < num_channels; ++ch)
+    {
+        auto range = juce::FloatVectorOperations::findMinAndMax(
+            block.getChannelPointer(ch), (int)block.getNumSamples()
+        );
+        peak = std::max(
+            peak, std::max(std::abs(range.getStart()), std::abs(range.getEnd()))
+        );
+    }
+    return peak;
+}
+
+void PluginAudioProcessor::matchNodeChannels(
+    SignalChain::Node node, juce::dsp::AudioBlock<float>& block,
+    bool& is_stereo
+)
+{
+    if (SignalChain::isMonoNode(node) && is_stereo && !is_dual_mono)
+    {
+        // Fold back to mono for the nodes that only process channel 0
+        auto* left = block.getChannelPointer(0);
+        auto* right = block.getChannelPointer(1);
+        for (size_t i = 0; i < block.getNumSamples(); ++i)
+            left[i] = 0.5f * (left[i] + right[i]);
+        is_stereo = false;
+    }
+    else if (!SignalChain::isMonoNode(node) && !is_stereo)
+    {
+        block.getSingleChannelBlock(1).copyFrom(block.getSingleChannelBlock(0)
+        );
+        is_stereo = true;
+    }
+}
+
+void PluginAudioProcessor::runNode(
+    SignalChain::Node node, juce::dsp::AudioBlock<float>& block
+)
+{
+    profiler.skipStage();
+
+    // Mono nodes only see channel 0, unless each input has its own lane
+    auto node_block = SignalChain::isMonoNode(node) && !is_dual_mono
+                          ? block.getSingleChannelBlock(0)
+                          : block;
+    juce::dsp::ProcessContextReplacing<float> context(node_block);
+    switch (node)
+    {
+    case SignalChain::compressor:
+        compressor.process(context);
+        compressor_gain_reduction_db.store(compressor.getGainReductionDb());
+        profiler.endStage(StageProfiler::compressor);
+        break;
+    case SignalChain::amp:
         overdrive.process(context);
+        profiler.endStage(StageProfiler::overdrive);
         current_amp_master_gain.setTargetValue(
             juce::Decibels::decibelsToGain(amp_master_gain_parameter->load())
         );
-        current_amp_master_gain.applyGain(buffer, num_samples);
+        node_block.multiplyBy(current_amp_master_gain);
+        profiler.endStage(StageProfiler::amp_master);
+        break;
+    case SignalChain::eq:
+        eq.process(context);
+        profiler.endStage(StageProfiler::eq);
+        break;
+    case SignalChain::chorus:
+        chorus.process(context);
+        profiler.endStage(StageProfiler::chorus);
+        break;
+    case SignalChain::ir:
+        irConvolver.process(context);
+        profiler.endStage(StageProfiler::ir);
+        break;
+    case SignalChain::num_nodes:
+        break;
     }
+}
 
-    if (eq_bypass_parameter->load() < 0.5f)
-        eq.process(context);
+void PluginAudioProcessor::resetNode(SignalChain::Node node)
+{
+    switch (node)
+    {
+    case SignalChain::compressor:
+        compressor.reset();
+        break;
+    case SignalChain::amp:
+        overdrive.reset();
+        current_amp_master_gain.setCurrentAndTargetValue(
+            juce::Decibels::decibelsToGain(amp_master_gain_parameter->load())
+        );
+        break;
+    case SignalChain::eq:
+        eq.reset();
+        break;
+    case SignalChain::chorus:
+        chorus.reset();
+        break;
+    case SignalChain::ir:
+        irConvolver.reset();
+        break;
+    case SignalChain::num_nodes:
+        break;
+    }
+}
 
-    // Copy mono signal back to both left and right channels
-    buffer.copyFrom(1, 0, buffer, 0, 0, buffer.getNumSamples());
+void PluginAudioProcessor::updateInputMode(int num_input_channels)
+{
+    // Waits for the message thread to prepare the amp for both inputs
+    const bool dual_mono = input_mode_parameter->load() >= 0.5f &&
+                           num_input_channels > 1 && amp_spec.numChannels > 1;
+    if (dual_mono == is_dual_mono)
+        return;
+
+    // The second channel of the mono nodes has been idle (or was fed a
+    // different signal), start both inputs from a clean state
+    is_dual_mono = dual_mono;
+    chorus.setDualMono(dual_mono);
+    resetNode(SignalChain::compressor);
+    resetNode(SignalChain::amp);
+    resetNode(SignalChain::eq);
+    resetNode(SignalChain::chorus);
+}
 
-    if (chorus_bypass_parameter->load() < 0.5f)
-        chorus.process(context);
-    if (ir_bypass_parameter->load() < 0.5f)
-        irConvolver.process(context);
+void PluginAudioProcessor::alignBranches(
+    juce::dsp::AudioBlock<float>& block, juce::dsp::AudioBlock<float>& branch,
+    bool& has_amp, bool branch_has_amp
+)
+{
+    // At most one lane holds the amp, delay the other one to match it
+    if (has_amp && !branch_has_amp)
+        delayBlock(branch_delay, branch);
+    else if (!has_amp && branch_has_amp)
+        delayBlock(branch_delay, block);
+    has_amp = has_amp || branch_has_amp;
+}
 
-    float outputGainDb =
-        juce::jlimit(-48.0f, 12.0f, output_gain_parameter->load());
-    current_output_gain.setTargetValue(
-        juce::Decibels::decibelsToGain(outputGainDb)
+void PluginAudioProcessor::delayBlock(
+    CompensationDelay& delay, juce::dsp::AudioBlock<float>& block
+)
+{
+    if (amp_latency <= 0.0f)
+        return;
+    juce::dsp::ProcessContextReplacing<float> context(block);
+    delay.process(context);
+}
+
+int PluginAudioProcessor::getOversamplingChoice() const
+{
+    int choice = (int)oversampling_parameter->load();
+    int render_choice = (int)render_oversampling_parameter->load();
+    if (isNonRealtime() && render_choice > 0)
+        choice = render_choice - 1;
+    return juce::jlimit(
+        0, (int)std::size(oversampling_settings) - 1, choice
     );
-    current_output_gain.applyGain(buffer, num_samples);
+}
 
-    startup_fade.applyGain(buffer, num_samples);
+int PluginAudioProcessor::getAdaaOrder() const
+{
+    return juce::jlimit(0, 2, (int)adaa_parameter->load());
+}
 
-    updateOutputLevel(buffer);
+juce::uint32 PluginAudioProcessor::getAmpNumChannels() const
+{
+    return input_mode_parameter->load() >= 0.5f &&
+                   getTotalNumInputChannels() > 1
+               ? 2
+               : 1;
 }
 
-//==============================================================================
-// Process Block Helper functions
-//==============================================================================
+void PluginAudioProcessor::configureOversampling()
+{
+    // Allocates, only called with the audio callback stopped or suspended
+    auto setting = oversampling_settings[active_oversampling_choice];
+    overdrive.setOversampling(setting.factor, setting.linear_phase);
+    overdrive.setAdaaOrder(active_adaa_order);
+    overdrive.prepare(amp_spec);
+    amp_latency = overdrive.getLatencyInSamples();
+
+    juce::dsp::ProcessSpec delay_spec = amp_spec;
+    delay_spec.numChannels = (juce::uint32)getTotalNumOutputChannels();
+    for (auto* delay : {&amp_dry_delay, &branch_delay, &chain_delay})
+    {
+        delay->prepare(delay_spec);
+        delay->setMaximumDelayInSamples(
+            std::max(1, (int)std::ceil(amp_latency))
+        );
+        delay->setDelay(amp_latency);
+        delay->reset();
+    }
+    setLatencySamples(juce::roundToInt(amp_latency));
+}
+
+void PluginAudioProcessor::applyAmpSetup()
+{
+    // Not prepared yet, prepareToPlay picks the setting up
+    if (amp_spec.sampleRate <= 0.0)
+        return;
+
+    int choice = getOversamplingChoice();
+    int adaa_order = getAdaaOrder();
+    juce::uint32 num_channels = getAmpNumChannels();
+    if (choice == active_oversampling_choice &&
+        adaa_order == active_adaa_order &&
+        num_channels == amp_spec.numChannels)
+        return;
+
+    suspendProcessing(true);
+    active_oversampling_choice = choice;
+    active_adaa_order = adaa_order;
+    amp_spec.numChannels = num_channels;
+    configureOversampling();
+    suspendProcessing(false);
+}
+
+void PluginAudioProcessor::mergeBranch(
+    juce::dsp::AudioBlock<float>& block, juce::dsp::AudioBlock<float>& branch,
+    bool& is_stereo, bool is_branch_stereo
+)
+{
+    if (is_stereo && !is_branch_stereo)
+        branch.getSingleChannelBlock(1).copyFrom(branch.getSingleChannelBlock(0)
+        );
+    else if (!is_stereo && is_branch_stereo)
+        block.getSingleChannelBlock(1).copyFrom(block.getSingleChannelBlock(0));
+    is_stereo = is_stereo || is_branch_stereo;
+
+    current_parallel_blend.setTargetValue(
+        juce::jlimit(0.0f, 1.0f, parallel_blend_parameter->load())
+    );
+
+    // Blend 0 keeps branch A only, 1 keeps branch B only
+    const size_t num_channels = is_stereo ? 2 : 1;
+    const size_t num_samples = block.getNumSamples();
+    float* main_channels[2] = {
+        block.getChannelPointer(0), block.getChannelPointer(1)
+    };
+    const float* branch_channels[2] = {
+        branch.getChannelPointer(0), branch.getChannelPointer(1)
+    };
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        float blend = current_parallel_blend.getNextValue();
+        for (size_t ch = 0; ch < num_channels; ++ch)
+        {
+            float a = main_channels[ch][i];
+            main_channels[ch][i] = a + (branch_channels[ch][i] - a) * blend;
+        }
+    }
+}
+
+void PluginAudioProcessor::setSignalChain(const SignalChain& chain)
+{
+    // Stored in the state so it is saved with sessions and presets, the
+    // property listener hands it to the audio thread
+    parameters.state.setProperty(signal_chain_id, chain.toString(), nullptr);
+}
+
+SignalChain PluginAudioProcessor::getSignalChain() const
+{
+    return SignalChain::unpack(packed_chain.load());
+}
+
+void PluginAudioProcessor::updateSignalChainFromState()
+{
+    SignalChain chain = SignalChain::makeDefault();
+    auto text = parameters.state.getProperty(signal_chain_id, "").toString();
+    if (text.isNotEmpty() && !SignalChain::fromString(text, chain))
+        chain = SignalChain::makeDefault();
+    packed_chain.store(chain.pack(), std::memory_order_release);
+}
+
+void PluginAudioProcessor::valueTreePropertyChanged(
+    juce::ValueTree& tree, const juce::Identifier& property
+)
+{
+    if (property == signal_chain_id && tree == parameters.state)
+        updateSignalChainFromState();
+}
+
+void PluginAudioProcessor::valueTreeRedirected(juce::ValueTree&)
+{
+    // Presets and sessions replace the whole state tree
+    updateSignalChainFromState();
+}
 
 void PluginAudioProcessor::updateInputLevel(juce::AudioBuffer<float>& buffer)
 {
     // Set inputLevel value for metering
     double peakInput = buffer.getRMSLevel(0, 0, buffer.getNumSamples());
-    inputLevel.setValue(peakInput);
+    input_level.store((float)peakInput);
 }
 
 void PluginAudioProcessor::updateOutputLevel(juce::AudioBuffer<float>& buffer)
 {
     // Set outputLevel value for metering
     double peakOutput = buffer.getRMSLevel(0, 0, buffer.getNumSamples());
-    outputLevel.setValue(peakOutput);
+    output_level.store((float)peakOutput);
+}
+
+void PluginAudioProcessor::timerCallback()
+{
+    if (is_amp_setup_changed.exchange(false))
+        applyAmpSetup();
+
+    // juce::Value notifies its listeners synchronously, so it is only
+    // touched from the message thread
+    inputLevel.setValue(input_level.load());
+    outputLevel.setValue(output_level.load());
+    compressorGainReductionDb.setValue(compressor_gain_reduction_db.load());
+    currentPitch.setValue(current_pitch.load());
 }
 
 bool PluginAudioProcessor::hasEditor() const
@@ -4,30 +4,81 @@
 #include "dsp/compressor.h"
 #include "dsp/eq.h"
 #include "dsp/ir.h"
-#include "dsp/overdrives/helios.h"
-#include "dsp/overdrives/overdrive.h"
+#include "dsp/overdrives/amp_selector.h"
 #include "dsp/pitch_detector.h"
+#include "dsp/signal_chain.h"
+#include "dsp/stage_profiler.h"
 #include "dsp/synth_voices.h"
 #include "preset_manager.h"
 #include "session_manager.h"
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <vector>
 
 //==============================================================================
 class PluginAudioProcessor final
     : public juce::AudioProcessor,
-      public juce::AudioProcessorValueTreeState::Listener,
-      public juce::ValueTree::Listener
+      public juce::AudioProcessorParameter::Listener,
+      public juce::ValueTree::Listener,
+      private juce::Timer
 {
   public:
     PluginAudioProcessor();
     ~PluginAudioProcessor() override;
 
-    void parameterChanged(
-        const juce::String& parameterID, float newValue
-    ) override;
-    void setParameterValue(juce::String, float);
-    void setupParameterHandlers();
+    // Dense index of every parameter forwarded to a DSP module, in the
+    // order of parameter_table
+    enum ParameterSlot
+    {
+        compressor_attack = 0,
+        compressor_hpf,
+        compressor_release,
+        compressor_ratio,
+        compressor_threshold,
+        compressor_level_db,
+        compressor_mix,
+        overdrive_mix,
+        overdrive_level_db,
+        overdrive_drive,
+        overdrive_attack,
+        overdrive_era,
+        overdrive_grunt,
+        overdrive_x_frequency,
+        overdrive_bass_frequency,
+        amp_type,
+        eq_low_shelf_gain,
+        eq_low_shelf_freq,
+        eq_low_mid_freq,
+        eq_low_mid_q,
+        eq_low_mid_gain,
+        eq_high_mid_freq,
+        eq_high_mid_q,
+        eq_high_mid_gain,
+        eq_high_shelf_gain,
+        eq_high_shelf_freq,
+        eq_lpf,
+        chorus_mix,
+        chorus_rate,
+        chorus_crossover,
+        chorus_depth,
+        ir_mix,
+        ir_level,
+        ir_type,
+        synth_octave_level,
+        synth_square_level,
+        synth_triangle_level,
+        synth_raw_level,
+        synth_master_level,
+        num_parameter_slots
+    };
+
+    // Called from the message thread or a host automation thread, the new
+    // value is queued for the audio thread
+    void parameterValueChanged(int parameterIndex, float newValue) override;
+    void parameterGestureChanged(int, bool) override {}
+    void setParameterValue(ParameterSlot, float);
+    void applyPendingParameters();
     void prepareParameters();
 
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
@@ -38,12 +89,21 @@ class PluginAudioProcessor final
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
     using AudioProcessor::processBlock;
 
+    // Thread safe, the audio thread picks the new chain up on its next block
+    void setSignalChain(const SignalChain&);
+    SignalChain getSignalChain() const;
+    void valueTreePropertyChanged(
+        juce::ValueTree&, const juce::Identifier&
+    ) override;
+    void valueTreeRedirected(juce::ValueTree&) override;
+
     // Decay factor for level smoothing
     double decayFactor = 0.95f;
     juce::Value inputLevel;                // in dB
     juce::Value outputLevel;               // in dB
     juce::Value compressorGainReductionDb; // in dB
     juce::Value currentPitch;              // in Hz
+    void timerCallback() override;
     void updateInputLevel(juce::AudioBuffer<float>& buffer);
     void updateOutputLevel(juce::AudioBuffer<float>& buffer);
     void applyGain(std::atomic<float>*, float&, juce::AudioBuffer<float>&);
@@ -73,6 +133,7 @@ class PluginAudioProcessor final
 
     PresetManager& getPresetManager() { return presetManager; }
     SessionManager& getSessionManager() { return sessionManager; }
+    StageProfiler& getStageProfiler() { return profiler; }
 
     bool loadSession(const juce::File& folder);
     void saveSessionPath(const juce::String& path);
@@ -90,8 +151,32 @@ class PluginAudioProcessor final
   private:
     juce::AudioProcessorValueTreeState parameters;
     juce::AudioProcessorValueTreeState::ParameterLayout parameterLayout;
-    using ParamHandler = std::function<void(float)>;
-    std::unordered_map<std::string, ParamHandler> parameterHandlers;
+
+    struct ParameterEntry
+    {
+        ParameterSlot slot;
+        const char* id;
+        // Values are clamped to [min, max] before being applied
+        float min;
+        float max;
+        void (*apply)(PluginAudioProcessor&, float);
+    };
+    static const std::array<ParameterEntry, num_parameter_slots>
+        parameter_table;
+    void resolveParameterSlots();
+
+    // Host parameter index -> slot (-1 when not forwarded to a module), and
+    // slot -> parameter, both filled once at construction
+    std::vector<int> parameter_slots;
+    std::array<juce::RangedAudioParameter*, num_parameter_slots>
+        slot_parameters{};
+
+    // Parameter changes waiting for the audio thread: the latest value of
+    // each slot plus one dirty bit per slot. Writers never wait and repeated
+    // changes to the same slot between two blocks collapse into one.
+    static_assert(num_parameter_slots <= 64, "pending_slots is a 64 bit mask");
+    std::array<std::atomic<float>, num_parameter_slots> pending_values{};
+    std::atomic<juce::uint64> pending_slots{0};
 
     Compressor compressor;
     EQ eq;
@@ -99,8 +184,9 @@ class PluginAudioProcessor final
     Chorus chorus;
     SynthVoices synth_voices;
     PitchDetector pitch_detector;
+    StageProfiler profiler;
 
-    HeliosOverdrive overdrive;
+    AmpSelector overdrive;
 
     float smoothing_time = 0.05f;
     float startup_fade_time = 0.03f;
@@ -116,8 +202,117 @@ class PluginAudioProcessor final
     std::atomic<float>* chorus_bypass_parameter = nullptr;
     std::atomic<float>* eq_bypass_parameter = nullptr;
     std::atomic<float>* synth_bypass_parameter = nullptr;
+    std::atomic<float>* parallel_blend_parameter = nullptr;
+    std::atomic<float>* bypass_mode_parameter = nullptr;
+    std::atomic<float>* input_mode_parameter = nullptr;
     bool is_tuner_bypassed = true;
 
+    // Dual mono runs the two input channels through independent state of
+    // the compressor, amp and EQ instead of summing them to mono. Only read
+    // and written by the audio thread, and only turned on once the amp is
+    // prepared for two channels.
+    bool is_dual_mono = false;
+    void updateInputMode(int num_input_channels);
+
+    // Effect routing, see SignalChain. Branch B of a parallel section runs
+    // in branch_buffer and is blended back by parallel_blend.
+    std::atomic<juce::uint64> packed_chain{0};
+    std::array<std::atomic<float>*, SignalChain::num_nodes>
+        node_bypass_parameters{};
+    juce::AudioBuffer<float> branch_buffer;
+    juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>
+        current_parallel_blend;
+    void processChain(juce::dsp::AudioBlock<float>&);
+    void processNode(
+        SignalChain::Node, juce::dsp::AudioBlock<float>&, bool& is_stereo
+    );
+    void mergeBranch(
+        juce::dsp::AudioBlock<float>&, juce::dsp::AudioBlock<float>&,
+        bool& is_stereo, bool is_branch_stereo
+    );
+    void matchNodeChannels(
+        SignalChain::Node, juce::dsp::AudioBlock<float>&, bool& is_stereo
+    );
+    void alignBranches(
+        juce::dsp::AudioBlock<float>&, juce::dsp::AudioBlock<float>&,
+        bool& has_amp, bool branch_has_amp
+    );
+    void runNode(SignalChain::Node, juce::dsp::AudioBlock<float>&);
+    void resetNode(SignalChain::Node);
+
+    // Bypass crossfades: 1 is fully processed, 0 fully bypassed. In reset
+    // mode a bypassed node is skipped and reset before it fades back in, in
+    // warm mode it runs on a scratch copy of one block of its input every
+    // warm_interval_time, so its state stays recent without paying for
+    // every block. The first block after the bypass always runs.
+    float bypass_fade_time = 0.02f;
+    float warm_interval_time = 0.05f;
+    size_t warm_interval_samples = 0;
+    std::array<size_t, SignalChain::num_nodes> warm_countdowns{};
+    std::array<
+        juce::SmoothedValue<float, juce::ValueSmoothingTypes::Linear>,
+        SignalChain::num_nodes>
+        node_fades;
+    std::array<bool, SignalChain::num_nodes> node_needs_reset{};
+    juce::AudioBuffer<float> bypass_buffer;
+
+    // Amp oversampling, ADAA and channel count. Changing the oversampling or
+    // the input mode reallocates the oversamplers, which are built for a
+    // single channel in Mono mode, and the oversampling and ADAA change the
+    // plugin latency, so all three are applied from the message thread with
+    // processing suspended. Offline renders may use their own oversampling.
+    std::atomic<float>* oversampling_parameter = nullptr;
+    std::atomic<float>* render_oversampling_parameter = nullptr;
+    std::atomic<float>* adaa_parameter = nullptr;
+    std::array<juce::RangedAudioParameter*, 4> amp_setup_parameters{};
+    juce::dsp::ProcessSpec amp_spec{0.0, 0, 0};
+    int active_oversampling_choice = -1;
+    int active_adaa_order = -1;
+    int getOversamplingChoice() const;
+    int getAdaaOrder() const;
+    juce::uint32 getAmpNumChannels() const;
+    void configureOversampling();
+    // Set by the parameter listener, which hosts may call on the audio
+    // thread, and polled by timerCallback()
+    std::atomic<bool> is_amp_setup_changed{false};
+    void applyAmpSetup();
+
+    // The reported latency is always the amp's. Whatever does not go
+    // through the oversampler is delayed to line up with it: the amp's
+    // dry path while bypassed or fading, a parallel branch without the amp,
+    // and the whole chain when the amp is not in it.
+    // ADAA makes the amp latency fractional. The host is told the nearest
+    // whole sample, the delays follow the exact value through Thiran
+    // allpasses.
+    using CompensationDelay = juce::dsp::DelayLine<
+        float, juce::dsp::DelayLineInterpolationTypes::Thiran>;
+    float amp_latency = 0.0f;
+    CompensationDelay amp_dry_delay, branch_delay, chain_delay;
+    void delayBlock(CompensationDelay&, juce::dsp::AudioBlock<float>&);
+
+    // Idle gating of silent nodes
+    struct IdleState
+    {
+        bool is_idle = false;
+        int silent_samples = 0;
+    };
+    std::array<IdleState, SignalChain::num_nodes> node_idle{};
+    float silence_threshold = juce::Decibels::decibelsToGain(-90.0f);
+    float idle_hold_time = 0.2f;
+    int idle_hold_samples = 0;
+    void runIdleGatedNode(
+        SignalChain::Node, juce::dsp::AudioBlock<float>&, size_t num_channels
+    );
+    static float getPeak(const juce::dsp::AudioBlock<float>&, size_t);
+    void updateSignalChainFromState();
+
+    // Written by the audio thread, pushed to the juce::Value meters above
+    // from the message thread by timerCallback()
+    std::atomic<float> input_level{0.0f};
+    std::atomic<float> output_level{0.0f};
+    std::atomic<float> compressor_gain_reduction_db{0.0f};
+    std::atomic<float> current_pitch{0.0f};
+
     PresetManager presetManager;
     SessionManager sessionManager;
 
@@ -11,7 +11,7 @@ PluginEditor::PluginEditor(
     PluginAudioProcessor& p, juce::AudioProcessorValueTreeState& params
 )
     : AudioProcessorEditor(&p), processorRef(p), parameters(params),
-      header(params, processorRef.inputLevel, processorRef.outputLevel, processorRef.getSessionManager()),
+      header(params, processorRef.inputLevel, processorRef.outputLevel, processorRef.getSessionManager(), processorRef.getStageProfiler()),
       panels(params, processorRef.compressorGainReductionDb),
       tuner(processorRef.currentPitch)
 {
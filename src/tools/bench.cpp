@@ -0,0 +1,544 @@
+// DSP microbenchmark
+//
+// Runs every processor of the chain in isolation over a grid of block sizes
+// and sample rates, and reports ns/sample along with min, median and p99
+// block times as JSON. A previous report can be passed as a baseline, in
+// which case the tool fails when a module got slower than the tolerance.
+//
+// Usage:
+//   orbital-bench [--output report.json] [--baseline previous.json]
+//                 [--tolerance 0.1] [--seconds 2] [--module helios]
+//                 [--block-sizes 16,64,512] [--sample-rates 48000,96000]
+
+#include "../assets/ImpulseResponseBinaryMapping.h"
+#include "../dsp/chorus.h"
+#include "../dsp/circuits/cmos.h"
+#include "../dsp/circuits/cmos_table.h"
+#include "../dsp/compressor.h"
+#include "../dsp/eq.h"
+#include "../dsp/ir.h"
+#include "../dsp/maths/piecewise_polynomial.h"
+#include "../dsp/overdrives/borealis.h"
+#include "../dsp/overdrives/helios.h"
+#include "../dsp/overdrives/nebula.h"
+#include "../dsp/overdrives/pulsar.h"
+#include "../dsp/pitch_detector.h"
+#include "../dsp/synth_voices.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include <map>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using Context = juce::dsp::ProcessContextReplacing<float>;
+
+// A module under test: prepare() builds a fresh processor for the given spec
+// and returns the function processing one block with it.
+struct BenchCase
+{
+    juce::String name;
+    std::function<std::function<void(const Context&)>(
+        const juce::dsp::ProcessSpec&
+    )>
+        prepare;
+    bool needs_settling = false;
+    // The pre-chorus modules run on the mono path, chorus and IR in stereo
+    int num_channels = 1;
+};
+
+struct BenchResult
+{
+    juce::String module;
+    double sample_rate;
+    int block_size;
+    double ns_per_sample;
+    double block_ns_min;
+    double block_ns_median;
+    double block_ns_p99;
+};
+
+struct BenchSettings
+{
+    std::vector<int> block_sizes = {16, 32, 64, 128, 256, 512, 1024, 2048};
+    std::vector<double> sample_rates = {44100.0, 48000.0,  88200.0,
+                                        96000.0, 176400.0, 192000.0};
+    double seconds = 2.0;
+    juce::String module_filter;
+};
+
+template <typename Module>
+std::function<void(const Context&)> prepared(
+    std::shared_ptr<Module> module, const juce::dsp::ProcessSpec& spec
+)
+{
+    module->prepare(spec);
+    return [module](const Context& context) { module->process(context); };
+}
+
+std::vector<BenchCase> createCases()
+{
+    std::vector<BenchCase> cases;
+
+    cases.push_back(
+        {"cmos",
+         [](const juce::dsp::ProcessSpec&)
+         {
+             auto cmos = std::make_shared<CMOS>();
+             cmos->prepare();
+             return std::function<void(const Context&)>(
+                 [cmos](const Context& context) { cmos->process(context); }
+             );
+         }}
+    );
+
+    // The minimax fit of the same curve, which CMOS would switch to once it
+    // beats the linear table above
+    cases.push_back(
+        {"cmos_polynomial",
+         [](const juce::dsp::ProcessSpec&)
+         {
+             auto curve = PiecewisePolynomial::Table::make(
+                 CmosTable::cells, CmosTable::subcells, CmosTable::num_cells,
+                 CmosModel::min_input, CmosModel::max_input
+             );
+             return std::function<void(const Context&)>(
+                 [curve](const Context& context)
+                 {
+                     auto& block = context.getOutputBlock();
+                     for (size_t channel = 0;
+                          channel < block.getNumChannels(); ++channel)
+                     {
+                         auto* ch = block.getChannelPointer(channel);
+                         PiecewisePolynomial::process(
+                             curve, ch, ch, block.getNumSamples()
+                         );
+                     }
+                 }
+             );
+         }}
+    );
+
+    struct HeliosSetting
+    {
+        const char* name;
+        size_t factor;
+        bool linear_phase;
+    };
+    const HeliosSetting helios_settings[] = {
+        {"helios_1x", 0, false},        {"helios_2x", 1, false},
+        {"helios_4x", 2, false},        {"helios_8x", 3, false},
+        {"helios_8x_linear", 3, true},
+    };
+    for (auto setting : helios_settings)
+    {
+        cases.push_back(
+            {setting.name,
+             [setting](const juce::dsp::ProcessSpec& spec)
+             {
+                 auto helios = std::make_shared<HeliosOverdrive>();
+                 helios->setLevel(1.0f);
+                 helios->setMix(1.0f);
+                 helios->setDrive(5.0f);
+                 helios->setAttack(5.0f);
+                 helios->setGrunt(5.0f);
+                 helios->setEra(5.0f);
+                 helios->setOversampling(setting.factor, setting.linear_phase);
+                 return prepared(helios, spec);
+             }}
+        );
+    }
+
+    const char* adaa_names[] = {"helios_2x_adaa1", "helios_2x_adaa2"};
+    for (int order = 1; order <= 2; ++order)
+    {
+        cases.push_back(
+            {adaa_names[order - 1],
+             [order](const juce::dsp::ProcessSpec& spec)
+             {
+                 auto helios = std::make_shared<HeliosOverdrive>();
+                 helios->setLevel(1.0f);
+                 helios->setMix(1.0f);
+                 helios->setDrive(5.0f);
+                 helios->setAttack(5.0f);
+                 helios->setGrunt(5.0f);
+                 helios->setEra(5.0f);
+                 helios->setOversampling(1, false);
+                 helios->setAdaaOrder(order);
+                 return prepared(helios, spec);
+             }}
+        );
+    }
+
+    cases.push_back(
+        {"borealis",
+         [](const juce::dsp::ProcessSpec& spec)
+         {
+             auto borealis = std::make_shared<BorealisOverdrive>();
+             borealis->setLevel(1.0f);
+             borealis->setMix(1.0f);
+             borealis->setDrive(5.0f);
+             borealis->setCrossFrequency(500.0f);
+             borealis->setBassFrequency(200.0f);
+             return prepared(borealis, spec);
+         }}
+    );
+
+    cases.push_back(
+        {"nebula",
+         [](const juce::dsp::ProcessSpec& spec)
+         {
+             auto nebula = std::make_shared<NebulaOverdrive>();
+             nebula->setLevel(1.0f);
+             nebula->setMix(1.0f);
+             nebula->setDrive(5.0f);
+             nebula->setAttack(5.0f);
+             nebula->setGrunt(5.0f);
+             nebula->setEra(5.0f);
+             return prepared(nebula, spec);
+         }}
+    );
+
+    cases.push_back(
+        {"pulsar",
+         [](const juce::dsp::ProcessSpec& spec)
+         {
+             auto pulsar = std::make_shared<PulsarOverdrive>();
+             pulsar->setLevel(1.0f);
+             pulsar->setMix(1.0f);
+             pulsar->setDrive(5.0f);
+             pulsar->setAttack(5.0f);
+             pulsar->setGrunt(5.0f);
+             pulsar->setEra(5.0f);
+             return prepared(pulsar, spec);
+         }}
+    );
+
+    cases.push_back(
+        {"compressor",
+         [](const juce::dsp::ProcessSpec& spec)
+         {
+             auto compressor = std::make_shared<Compressor>();
+             compressor->setThresholdDecibels(-24.0f);
+             compressor->setRatio(4.0f);
+             compressor->setAttack(10.0f);
+             compressor->setRelease(100.0f);
+             compressor->setHPF(20.0f);
+             compressor->setLevel(1.0f);
+             compressor->setMix(1.0f);
+             return prepared(compressor, spec);
+         }}
+    );
+
+    cases.push_back(
+        {"chorus",
+         [](const juce::dsp::ProcessSpec& spec)
+         {
+             auto chorus = std::make_shared<Chorus>();
+             chorus->setMix(0.5f);
+             chorus->setRate(1.5f);
+             chorus->setDepth(0.75f);
+             chorus->setCrossover(200.0f);
+             return prepared(chorus, spec);
+         },
+         false,
+         2}
+    );
+
+    cases.push_back(
+        {"eq", [](const juce::dsp::ProcessSpec& spec)
+         { return prepared(std::make_shared<EQ>(), spec); }}
+    );
+
+    for (int i = 0; i < impulseResponseBinaryNames.size(); ++i)
+    {
+        cases.push_back(
+            {"ir_" + impulseResponseBinaryNames[i].toLowerCase(),
+             [i](const juce::dsp::ProcessSpec& spec)
+             {
+                 auto ir = std::make_shared<IRConvolver>();
+                 ir->setTypeFromIndex(i);
+                 ir->setMix(1.0f);
+                 ir->setLevel(0.125f);
+                 return prepared(ir, spec);
+             },
+             true,
+             2}
+        );
+    }
+
+    cases.push_back(
+        {"pitch_detector_yin",
+         [](const juce::dsp::ProcessSpec& spec)
+         {
+             auto detector = std::make_shared<PitchDetector>();
+             detector->prepare(spec);
+             return std::function<void(const Context&)>(
+                 [detector](const Context& context)
+                 { detector->getPitch(context); }
+             );
+         }}
+    );
+
+    cases.push_back(
+        {"synth_voices", [](const juce::dsp::ProcessSpec& spec)
+         { return prepared(std::make_shared<SynthVoices>(), spec); }}
+    );
+
+    return cases;
+}
+
+// Plucked-bass-like test signal: decaying 41Hz fundamental with harmonics,
+// re-plucked every second.
+void fillInput(
+    juce::AudioBuffer<float>& buffer, int num_samples, double sample_rate,
+    int64_t& position
+)
+{
+    auto* ch = buffer.getWritePointer(0);
+    const double f0 = 41.2;
+    for (int i = 0; i < num_samples; ++i, ++position)
+    {
+        double t = (double)(position % (int64_t)sample_rate) / sample_rate;
+        double phase = juce::MathConstants<double>::twoPi * f0 * t;
+        double s = std::sin(phase) + 0.5 * std::sin(2.0 * phase) +
+                   0.25 * std::sin(3.0 * phase);
+        ch[i] = (float)(0.5 * std::exp(-3.0 * t) * s);
+    }
+    for (int channel = 1; channel < buffer.getNumChannels(); ++channel)
+        buffer.clear(channel, 0, num_samples);
+}
+
+BenchResult runCase(
+    const BenchCase& bench_case, double sample_rate, int block_size,
+    double seconds
+)
+{
+    juce::dsp::ProcessSpec spec{
+        sample_rate, (juce::uint32)block_size,
+        (juce::uint32)bench_case.num_channels
+    };
+    auto process = bench_case.prepare(spec);
+
+    juce::AudioBuffer<float> buffer(bench_case.num_channels, block_size);
+    juce::dsp::AudioBlock<float> block(buffer);
+    Context context(block);
+    int64_t position = 0;
+
+    const int num_blocks =
+        std::max(64, (int)(seconds * sample_rate / block_size));
+    const int num_warmup_blocks = std::max(8, num_blocks / 10);
+
+    for (int i = 0; i < num_warmup_blocks; ++i)
+    {
+        fillInput(buffer, block_size, sample_rate, position);
+        process(context);
+        // Convolution swaps its impulse response in from a background thread
+        if (bench_case.needs_settling && i == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    std::vector<double> block_ns((size_t)num_blocks);
+    double total_ns = 0.0;
+    for (int i = 0; i < num_blocks; ++i)
+    {
+        fillInput(buffer, block_size, sample_rate, position);
+        auto start = std::chrono::steady_clock::now();
+        process(context);
+        auto end = std::chrono::steady_clock::now();
+        double ns =
+            (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                end - start
+            )
+                .count();
+        block_ns[(size_t)i] = ns;
+        total_ns += ns;
+    }
+
+    std::sort(block_ns.begin(), block_ns.end());
+    size_t p99_index = std::min(
+        block_ns.size() - 1, (size_t)std::ceil(0.99 * block_ns.size()) - 1
+    );
+
+    return {bench_case.name,
+            sample_rate,
+            block_size,
+            total_ns / ((double)num_blocks * block_size),
+            block_ns.front(),
+            block_ns[block_ns.size() / 2],
+            block_ns[p99_index]};
+}
+
+juce::String resultKey(
+    const juce::String& module, double sample_rate, int block_size
+)
+{
+    return module + "@" + juce::String((int)sample_rate) + "/" +
+           juce::String(block_size);
+}
+
+juce::var toJson(const std::vector<BenchResult>& results)
+{
+    juce::Array<juce::var> entries;
+    for (auto& r : results)
+    {
+        auto* entry = new juce::DynamicObject();
+        entry->setProperty("module", r.module);
+        entry->setProperty("sample_rate", r.sample_rate);
+        entry->setProperty("block_size", r.block_size);
+        entry->setProperty("ns_per_sample", r.ns_per_sample);
+        entry->setProperty("block_ns_min", r.block_ns_min);
+        entry->setProperty("block_ns_median", r.block_ns_median);
+        entry->setProperty("block_ns_p99", r.block_ns_p99);
+        entries.add(juce::var(entry));
+    }
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("cpu", juce::SystemStats::getCpuModel());
+    root->setProperty("results", entries);
+    return juce::var(root);
+}
+
+// Returns the number of modules whose ns/sample regressed past the tolerance
+int compareToBaseline(
+    const std::vector<BenchResult>& results, const juce::File& baseline_file,
+    double tolerance
+)
+{
+    auto baseline = juce::JSON::parse(baseline_file);
+    auto* entries = baseline["results"].getArray();
+    if (entries == nullptr)
+    {
+        std::cerr << "Invalid baseline " << baseline_file.getFullPathName()
+                  << std::endl;
+        return 1;
+    }
+
+    std::map<juce::String, double> reference;
+    for (auto& entry : *entries)
+        reference[resultKey(
+            entry["module"].toString(), (double)entry["sample_rate"],
+            (int)entry["block_size"]
+        )] = (double)entry["ns_per_sample"];
+
+    int num_regressions = 0;
+    for (auto& r : results)
+    {
+        auto key = resultKey(r.module, r.sample_rate, r.block_size);
+        auto it = reference.find(key);
+        if (it == reference.end() || it->second <= 0.0)
+            continue;
+
+        double change = r.ns_per_sample / it->second - 1.0;
+        if (change > tolerance)
+        {
+            ++num_regressions;
+            std::cerr << "Regression " << key << ": "
+                      << juce::String(it->second, 2) << " -> "
+                      << juce::String(r.ns_per_sample, 2) << " ns/sample (+"
+                      << juce::String(100.0 * change, 1) << "%)" << std::endl;
+        }
+    }
+    return num_regressions;
+}
+
+template <typename T>
+std::vector<T> parseList(const juce::String& text)
+{
+    std::vector<T> values;
+    for (auto& token : juce::StringArray::fromTokens(text, ",", ""))
+        values.push_back((T)token.trim().getDoubleValue());
+    return values;
+}
+
+} // namespace
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h"))
+    {
+        std::cout
+            << "Usage: orbital-bench [--output <file.json>] "
+               "[--baseline <file.json>] [--tolerance <ratio>]\n"
+               "                     [--seconds <s>] [--module <name>]\n"
+               "                     [--block-sizes <n,...>] "
+               "[--sample-rates <hz,...>]\n";
+        return 0;
+    }
+
+    BenchSettings settings;
+    if (args.containsOption("--block-sizes"))
+        settings.block_sizes =
+            parseList<int>(args.getValueForOption("--block-sizes"));
+    if (args.containsOption("--sample-rates"))
+        settings.sample_rates =
+            parseList<double>(args.getValueForOption("--sample-rates"));
+    if (args.containsOption("--seconds"))
+        settings.seconds =
+            args.getValueForOption("--seconds").getDoubleValue();
+    settings.module_filter = args.getValueForOption("--module");
+
+    juce::ScopedNoDenormals no_denormals;
+    std::vector<BenchResult> results;
+    for (auto& bench_case : createCases())
+    {
+        if (settings.module_filter.isNotEmpty() &&
+            !bench_case.name.contains(settings.module_filter))
+            continue;
+
+        for (auto sample_rate : settings.sample_rates)
+        {
+            for (auto block_size : settings.block_sizes)
+            {
+                auto result = runCase(
+                    bench_case, sample_rate, block_size, settings.seconds
+                );
+                std::cerr << resultKey(result.module, sample_rate, block_size)
+                          << ": " << juce::String(result.ns_per_sample, 2)
+                          << " ns/sample" << std::endl;
+                results.push_back(result);
+            }
+        }
+    }
+
+    auto json = juce::JSON::toString(toJson(results));
+    if (args.containsOption("--output|-o"))
+    {
+        auto output = juce::File::getCurrentWorkingDirectory().getChildFile(
+            args.getValueForOption("--output|-o")
+        );
+        if (!output.replaceWithText(json))
+        {
+            std::cerr << "Cannot write " << output.getFullPathName()
+                      << std::endl;
+            return 1;
+        }
+    }
+    else
+    {
+        std::cout << json << std::endl;
+    }
+
+    if (args.containsOption("--baseline"))
+    {
+        auto baseline = juce::File::getCurrentWorkingDirectory().getChildFile(
+            args.getValueForOption("--baseline")
+        );
+        double tolerance =
+            args.containsOption("--tolerance")
+                ? args.getValueForOption("--tolerance").getDoubleValue()
+                : 0.1;
+        if (compareToBaseline(results, baseline, tolerance) > 0)
+            return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,224 @@
+// Piecewise polynomial fit report
+//
+// Fits the static curves of dsp/circuits with MinimaxFitter, the way
+// generate_cmos_table does for the CMOS waveshaper, and reports for each
+// one the size of the packed fit and its max error against the reference,
+// next to a juce::dsp::LookupTableTransform of the same curve. Both are
+// then timed over random inputs, along with the fast-math kernel of the
+// circuit where it has one.
+//
+// The CMOS reference is the double precision Newton solve of CmosModel,
+// fitted to 1e-6. The other circuits are their own processSample(), whose
+// fast-math approximations are not smooth below 1e-5, so they are fitted to
+// that unless --max-error is given.
+//
+// Usage:
+//   orbital-fit [--max-error 1e-5] [--cell-depth 8] [--lut-size 8192]
+//               [--curve cmos]
+
+#include "../dsp/circuits/bjt.h"
+#include "../dsp/circuits/cmos_approx.h"
+#include "../dsp/circuits/cmos_model.h"
+#include "../dsp/circuits/germanium_diode.h"
+#include "../dsp/circuits/opamp.h"
+#include "minimax_fitter.h"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <juce_core/juce_core.h>
+#include <juce_dsp/juce_dsp.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using BlockFunction = std::function<void(const float*, float*, size_t)>;
+
+struct Curve
+{
+    const char* name;
+    std::function<double(double)> reference;
+    double min_input;
+    double max_input;
+    double max_error;
+    // Fast-math kernel of the circuit, empty when the curve has none
+    BlockFunction process_block;
+};
+
+struct FitSettings
+{
+    // 0 for the default of each curve
+    double max_error = 0.0;
+    int cell_depth = 8;
+    size_t lut_size = 8192;
+    juce::String curve_filter;
+};
+
+constexpr size_t num_test_points = 1 << 20;
+constexpr size_t num_timing_samples = 1 << 16;
+constexpr int num_timing_runs = 200;
+
+std::vector<Curve> createCurves()
+{
+    // Shared so the lambdas can be copied into the curve list
+    auto cmos2 = std::make_shared<CMOS2>();
+    auto germanium = std::make_shared<GermaniumDiode>(192000.0f);
+    auto bjt = std::make_shared<BJT>();
+    auto opamp = std::make_shared<OpAmp>();
+
+    return {
+        {"cmos",
+         [](double x) { return CmosModel::waveshaper(x); },
+         CmosModel::min_input, CmosModel::max_input, 1e-6, nullptr},
+        {"cmos2", [cmos2](double x) { return cmos2->processSample((float)x); },
+         -4.0, 4.0, 1e-5,
+         [cmos2](const float* in, float* out, size_t n) {
+             cmos2->processBlock(in, out, n);
+         }},
+        {"germanium",
+         [germanium](double x) { return germanium->processSample((float)x); },
+         -4.0, 4.0, 1e-5,
+         [germanium](const float* in, float* out, size_t n) {
+             germanium->processBlock(in, out, n);
+         }},
+        {"bjt", [bjt](double x) { return bjt->processSample((float)x); }, -6.0,
+         6.0, 1e-5,
+         [bjt](const float* in, float* out, size_t n) {
+             bjt->processBlock(in, out, n);
+         }},
+        {"opamp", [opamp](double x) { return opamp->processSample((float)x); },
+         -3.0, 3.0, 1e-5,
+         [opamp](const float* in, float* out, size_t n) {
+             opamp->processBlock(in, out, n);
+         }},
+    };
+}
+
+// Best of num_timing_runs passes over the input, in ns/sample
+double timeBlock(const BlockFunction& process, const std::vector<float>& input)
+{
+    std::vector<float> output(input.size());
+    double best_ns = 0.0;
+    for (int run = 0; run < num_timing_runs; ++run)
+    {
+        auto start = std::chrono::steady_clock::now();
+        process(input.data(), output.data(), input.size());
+        auto end = std::chrono::steady_clock::now();
+        double ns =
+            (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                end - start
+            )
+                .count();
+        if (run == 0 || ns < best_ns)
+            best_ns = ns;
+    }
+    return best_ns / (double)input.size();
+}
+
+void reportCurve(const Curve& curve, const FitSettings& settings)
+{
+    MinimaxFitter::Settings fit_settings;
+    fit_settings.max_error =
+        settings.max_error > 0.0 ? settings.max_error : curve.max_error;
+    auto fit = MinimaxFitter::fit(
+        curve.reference, curve.min_input, curve.max_input, fit_settings
+    );
+    auto packed = MinimaxFitter::pack(fit, settings.cell_depth);
+    auto polynomial = packed.table();
+    double polynomial_error = MinimaxFitter::measureError(
+        polynomial, curve.reference, num_test_points
+    );
+
+    juce::dsp::LookupTableTransform<float> lut;
+    lut.initialise(
+        [&curve](float x) { return (float)curve.reference(x); },
+        (float)curve.min_input, (float)curve.max_input, settings.lut_size
+    );
+    double lut_error = 0.0;
+    for (size_t i = 0; i < num_test_points; ++i)
+    {
+        float x = polynomial.min_input +
+                  (polynomial.max_input - polynomial.min_input) * (float)i /
+                      (float)(num_test_points - 1);
+        lut_error = std::max(
+            lut_error, std::abs(lut.processSample(x) - curve.reference(x))
+        );
+    }
+
+    std::mt19937 random(1);
+    std::uniform_real_distribution<float> distribution(
+        (float)curve.min_input, (float)curve.max_input
+    );
+    std::vector<float> input(num_timing_samples);
+    for (auto& x : input)
+        x = distribution(random);
+
+    double polynomial_ns = timeBlock(
+        [&polynomial](const float* in, float* out, size_t n) {
+            PiecewisePolynomial::process(polynomial, in, out, n);
+        },
+        input
+    );
+    double lut_ns = timeBlock(
+        [&lut](const float* in, float* out, size_t n) {
+            lut.process(in, out, n);
+        },
+        input
+    );
+
+    std::printf(
+        "%-10s %4zu segments %6zu bytes  error %.2g | LookupTableTransform "
+        "%6zu bytes  error %.2g | %.2f vs %.2f ns/sample (%.2fx)",
+        curve.name, fit.segments.size(), packed.bytes(), polynomial_error,
+        settings.lut_size * sizeof(float), lut_error, polynomial_ns, lut_ns,
+        lut_ns / polynomial_ns
+    );
+    if (curve.process_block)
+        std::printf(
+            " | fast-math %.2f ns/sample",
+            timeBlock(curve.process_block, input)
+        );
+    std::printf("\n");
+}
+
+} // namespace
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--help|-h"))
+    {
+        std::printf(
+            "Usage: orbital-fit [--max-error <e>] [--cell-depth <n>] "
+            "[--lut-size <n>]\n"
+            "                   [--curve <name>]\n"
+        );
+        return 0;
+    }
+
+    FitSettings settings;
+    if (args.containsOption("--max-error"))
+        settings.max_error =
+            args.getValueForOption("--max-error").getDoubleValue();
+    if (args.containsOption("--cell-depth"))
+        settings.cell_depth =
+            args.getValueForOption("--cell-depth").getIntValue();
+    if (args.containsOption("--lut-size"))
+        settings.lut_size =
+            (size_t)args.getValueForOption("--lut-size").getIntValue();
+    settings.curve_filter = args.getValueForOption("--curve");
+
+    juce::ScopedNoDenormals no_denormals;
+    for (auto& curve : createCurves())
+    {
+        if (settings.curve_filter.isNotEmpty() &&
+            settings.curve_filter != curve.name)
+            continue;
+        reportCurve(curve, settings);
+    }
+    return 0;
+}
@@ -0,0 +1,130 @@
+// CMOS table generator
+//
+// Fits CmosModel::waveshaper with piecewise minimax cubics, samples it on
+// the uniform grid of the ADAA tables and integrates those twice, then
+// writes the arrays declared in dsp/circuits/cmos_table.h as a C++ source
+// file. Its output is checked in as dsp/circuits/cmos_table.cpp, so that
+// the build never runs a freshly built binary (which a cross-compile cannot
+// do), and CMOS instances only point at the finished tables. CMOS reads the
+// uniform table, the fit is there for orbital-bench to compare against it.
+// Values are written as hexadecimal floating point literals and round-trip
+// exactly.
+//
+// The accuracy of the fit and of the uniform table against the double
+// precision Newton solve is printed.
+//
+// Usage:
+//   orbital-generate-cmos-table src/dsp/circuits/cmos_table.cpp
+// or, with the tools configured, the orbital-regenerate-cmos-table target.
+
+#include "../dsp/circuits/cmos_model.h"
+#include "../dsp/maths/antiderivative_table.h"
+#include "../dsp/maths/lookup_table_simd.h"
+#include "minimax_fitter.h"
+#include <cstdio>
+#include <vector>
+
+namespace
+{
+
+// Well below the float rounding of the single precision Newton solve
+constexpr double max_fit_error = 1e-6;
+// 256 cells of 0.027, subdivided where the knees need shorter segments
+constexpr int cell_depth = 8;
+constexpr size_t num_test_points = 1 << 20;
+
+double reference(double x)
+{
+    return CmosModel::waveshaper(x);
+}
+
+template <typename T>
+void writeArray(
+    std::FILE* file, const char* type, const char* name,
+    const std::vector<T>& values
+)
+{
+    std::fprintf(
+        file, "extern const %s %s[%zu] = {\n", type, name,
+        values.size()
+    );
+    for (auto value : values)
+        std::fprintf(
+            file, "    %a%s,\n", (double)value,
+            sizeof(T) == sizeof(float) ? "f" : ""
+        );
+    std::fprintf(file, "};\n\n");
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc != 2)
+    {
+        std::fprintf(stderr, "Usage: %s output.cpp\n", argv[0]);
+        return 1;
+    }
+
+    using namespace CmosModel;
+    std::vector<float> values(table_size);
+    for (size_t i = 0; i < table_size; ++i)
+        values[i] = waveshaper(tableInput(i));
+
+    std::vector<double> f1(table_size);
+    std::vector<double> f2(table_size);
+    AntiderivativeTable::integrate(
+        values.data(), table_size, min_input, max_input, f1.data(), f2.data()
+    );
+
+    MinimaxFitter::Settings settings;
+    settings.max_error = max_fit_error;
+    auto fit = MinimaxFitter::fit(reference, min_input, max_input, settings);
+    auto polynomial = MinimaxFitter::pack(fit, cell_depth);
+
+    // Same error measure for the uniform table
+    double table_error = 0.0;
+    auto table = LookupTableSimd::Table::make(
+        values.data(), nullptr, table_size, min_input, max_input
+    );
+    for (size_t i = 0; i < num_test_points; ++i)
+    {
+        float x = min_input + (max_input - min_input) * (float)i /
+                                  (float)(num_test_points - 1);
+        double y = LookupTableSimd::processLinear(table, x);
+        table_error = std::max(table_error, std::abs(y - reference(x)));
+    }
+    std::printf(
+        "CMOS waveshaper: %zu cubic segments in %zu cells (%zu bytes), max "
+        "error %.2g; "
+        "linear table of %zu points (%zu bytes), max error %.2g\n",
+        fit.segments.size(), polynomial.numCells(), polynomial.bytes(),
+        MinimaxFitter::measureError(
+            polynomial.table(), reference, num_test_points
+        ),
+        table_size, table_size * sizeof(float), table_error
+    );
+
+    std::FILE* file = std::fopen(argv[1], "w");
+    if (file == nullptr)
+    {
+        std::fprintf(stderr, "Cannot write %s\n", argv[1]);
+        return 1;
+    }
+    std::fprintf(
+        file, "// Generated by orbital-generate-cmos-table, do not edit\n\n"
+              "#include <cstddef>\n\n"
+              "namespace CmosTable\n{\n\n"
+    );
+    std::fprintf(
+        file, "extern const size_t num_cells = %zu;\n\n",
+        polynomial.numCells()
+    );
+    writeArray(file, "float", "cells", polynomial.cells);
+    writeArray(file, "float", "subcells", polynomial.subcells);
+    writeArray(file, "float", "values", values);
+    writeArray(file, "double", "f1", f1);
+    writeArray(file, "double", "f2", f2);
+    std::fprintf(file, "} // namespace CmosTable\n");
+    return std::fclose(file) == 0 ? 0 : 1;
+}
@@ -0,0 +1,356 @@
+#pragma once
+
+#include "../dsp/maths/piecewise_polynomial.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Offline fitter of piecewise minimax polynomials, used at build time by
+// generate_cmos_table and by orbital-fit. Not part of the plugin.
+//
+// Starting from the whole input range, a segment gets a degree-n minimax
+// polynomial (Remez exchange on a dense grid) and is halved until the fit
+// error is below the requested bound, so the breakpoints gather around the
+// knees of the curve and the derivative jumps of the transistor models and
+// stay sparse elsewhere. pack() then lays the fit out as a
+// PiecewisePolynomial::Table.
+namespace MinimaxFitter
+{
+
+struct Segment
+{
+    double left = 0.0;
+    double right = 0.0;
+    // Number of halvings from the whole input range
+    int depth = 0;
+    // Coefficients of v^0 to v^degree, v in [-1, 1] across the segment
+    std::vector<double> coefficients;
+    // Minimax error of the double precision polynomial
+    double error = 0.0;
+};
+
+struct Fit
+{
+    double min_input = 0.0;
+    double max_input = 0.0;
+    int degree = 0;
+    std::vector<Segment> segments;
+    double max_error = 0.0;
+};
+
+struct Settings
+{
+    int degree = (int)PiecewisePolynomial::degree;
+    double max_error = 1e-6;
+    // Segments are at least (max_input - min_input) / 2^max_depth wide
+    int max_depth = 16;
+    // Points of the Remez grid of each segment
+    int grid_size = 256;
+    int max_iterations = 40;
+};
+
+namespace detail
+{
+
+inline constexpr double pi = 3.14159265358979323846;
+
+inline double evaluate(const std::vector<double>& coefficients, double u)
+{
+    double y = 0.0;
+    for (size_t k = coefficients.size(); k-- > 0;)
+        y = y * u + coefficients[k];
+    return y;
+}
+
+// Gaussian elimination with partial pivoting, a is n x n row-major
+inline std::vector<double> solve(std::vector<double> a, std::vector<double> b)
+{
+    const size_t n = b.size();
+    for (size_t col = 0; col < n; ++col)
+    {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < n; ++row)
+            if (std::abs(a[row * n + col]) > std::abs(a[pivot * n + col]))
+                pivot = row;
+        for (size_t k = 0; k < n; ++k)
+            std::swap(a[col * n + k], a[pivot * n + k]);
+        std::swap(b[col], b[pivot]);
+
+        for (size_t row = col + 1; row < n; ++row)
+        {
+            double factor = a[row * n + col] / a[col * n + col];
+            for (size_t k = col; k < n; ++k)
+                a[row * n + k] -= factor * a[col * n + k];
+            b[row] -= factor * b[col];
+        }
+    }
+    std::vector<double> x(n);
+    for (size_t row = n; row-- > 0;)
+    {
+        double sum = b[row];
+        for (size_t k = row + 1; k < n; ++k)
+            sum -= a[row * n + k] * x[k];
+        x[row] = sum / a[row * n + row];
+    }
+    return x;
+}
+
+// Alternating extrema of the error: one point per run of equal sign, the
+// largest of the run, then the smaller end dropped until num_points remain
+inline std::vector<size_t> alternatingExtrema(
+    const std::vector<double>& error, size_t num_points
+)
+{
+    std::vector<size_t> extrema;
+    for (size_t i = 0; i < error.size(); ++i)
+    {
+        if (error[i] == 0.0)
+            continue;
+        if (!extrema.empty() &&
+            (error[i] > 0.0) == (error[extrema.back()] > 0.0))
+        {
+            if (std::abs(error[i]) > std::abs(error[extrema.back()]))
+                extrema.back() = i;
+        }
+        else
+        {
+            extrema.push_back(i);
+        }
+    }
+    while (extrema.size() > num_points)
+    {
+        if (std::abs(error[extrema.front()]) < std::abs(error[extrema.back()]))
+            extrema.erase(extrema.begin());
+        else
+            extrema.pop_back();
+    }
+    return extrema;
+}
+
+// Discrete Remez exchange over grid_size points of [left, right], in the
+// normalised variable v = (x - middle) / half_width
+inline Segment remez(
+    const std::function<double(double)>& function, double left, double right,
+    int depth, const Settings& settings
+)
+{
+    const size_t num_coefficients = (size_t)settings.degree + 1;
+    const size_t num_points = num_coefficients + 1;
+    const size_t grid_size =
+        std::max((size_t)settings.grid_size, 4 * num_points);
+    const double middle = 0.5 * (left + right);
+    const double half_width = 0.5 * (right - left);
+
+    std::vector<double> v(grid_size);
+    std::vector<double> y(grid_size);
+    for (size_t i = 0; i < grid_size; ++i)
+    {
+        v[i] = -1.0 + 2.0 * (double)i / (double)(grid_size - 1);
+        y[i] = function(middle + half_width * v[i]);
+    }
+
+    // Start from the Chebyshev extrema
+    std::vector<size_t> reference(num_points);
+    for (size_t j = 0; j < num_points; ++j)
+    {
+        double c = -std::cos(pi * (double)j / (double)(num_points - 1));
+        reference[j] = (size_t)std::lround(0.5 * (c + 1.0) * (grid_size - 1));
+    }
+
+    std::vector<double> best;
+    double best_error = INFINITY;
+    std::vector<double> error(grid_size);
+    for (int iteration = 0; iteration < settings.max_iterations; ++iteration)
+    {
+        // p(v_j) + (-1)^j E = y_j
+        std::vector<double> a(num_points * num_points);
+        std::vector<double> b(num_points);
+        for (size_t j = 0; j < num_points; ++j)
+        {
+            double power = 1.0;
+            for (size_t k = 0; k < num_coefficients; ++k)
+            {
+                a[j * num_points + k] = power;
+                power *= v[reference[j]];
+            }
+            a[j * num_points + num_coefficients] = j % 2 == 0 ? 1.0 : -1.0;
+            b[j] = y[reference[j]];
+        }
+        auto solution = solve(a, b);
+        solution.pop_back();
+
+        double max_error = 0.0;
+        for (size_t i = 0; i < grid_size; ++i)
+        {
+            error[i] = y[i] - evaluate(solution, v[i]);
+            max_error = std::max(max_error, std::abs(error[i]));
+        }
+        if (max_error < best_error)
+        {
+            best_error = max_error;
+            best = solution;
+        }
+
+        auto next = alternatingExtrema(error, num_points);
+        if (next.size() < num_points || next == reference)
+            break;
+        reference = next;
+    }
+
+    Segment segment;
+    segment.left = left;
+    segment.right = right;
+    segment.depth = depth;
+    segment.coefficients = best;
+    segment.error = best_error;
+    return segment;
+}
+
+inline void split(
+    const std::function<double(double)>& function, double left, double right,
+    int depth, const Settings& settings, std::vector<Segment>& segments
+)
+{
+    auto segment = remez(function, left, right, depth, settings);
+    if (segment.error <= settings.max_error || depth == settings.max_depth)
+    {
+        segments.push_back(std::move(segment));
+        return;
+    }
+    const double middle = 0.5 * (left + right);
+    split(function, left, middle, depth + 1, settings, segments);
+    split(function, middle, right, depth + 1, settings, segments);
+}
+
+// Coefficients of q(s) = p(v0 + dv * s), by Horner's scheme on polynomials
+inline std::vector<double> substitute(
+    const std::vector<double>& p, double v0, double dv
+)
+{
+    std::vector<double> q(p.size(), 0.0);
+    for (size_t k = p.size(); k-- > 0;)
+    {
+        // q = q * (v0 + dv * s) + p[k]
+        for (size_t j = p.size() - 1; j > 0; --j)
+            q[j] = q[j] * v0 + q[j - 1] * dv;
+        q[0] = q[0] * v0 + p[k];
+    }
+    return q;
+}
+
+} // namespace detail
+
+inline Fit fit(
+    const std::function<double(double)>& function, double min_input,
+    double max_input, const Settings& settings = Settings()
+)
+{
+    Fit result;
+    result.min_input = min_input;
+    result.max_input = max_input;
+    result.degree = settings.degree;
+    detail::split(function, min_input, max_input, 0, settings, result.segments);
+    for (const auto& segment : result.segments)
+        result.max_error = std::max(result.max_error, segment.error);
+    return result;
+}
+
+// Arrays of a PiecewisePolynomial::Table
+struct PackedFit
+{
+    std::vector<float> cells;
+    std::vector<float> subcells;
+    float min_input = 0.0f;
+    float max_input = 0.0f;
+
+    size_t numCells() const
+    {
+        return cells.size() / PiecewisePolynomial::record_size;
+    }
+
+    size_t bytes() const
+    {
+        return (cells.size() + subcells.size()) * sizeof(float);
+    }
+
+    PiecewisePolynomial::Table table() const
+    {
+        return PiecewisePolynomial::Table::make(
+            cells.data(), subcells.data(), numCells(), min_input, max_input
+        );
+    }
+};
+
+// 2^cell_depth cells, each split down to the depth of its shortest segment,
+// and the polynomial of the segment covering each subcell re-expanded
+// around the subcell centre. The fit must be cubic.
+inline PackedFit pack(const Fit& fit, int cell_depth)
+{
+    constexpr size_t record_size = PiecewisePolynomial::record_size;
+    PackedFit packed;
+    packed.min_input = (float)fit.min_input;
+    packed.max_input = (float)fit.max_input;
+
+    const size_t num_cells = (size_t)1 << cell_depth;
+    const double cell_width = (fit.max_input - fit.min_input) / num_cells;
+    packed.cells.assign(num_cells * record_size, 0.0f);
+    size_t first = 0;
+    for (size_t cell = 0; cell < num_cells; ++cell)
+    {
+        const double left = fit.min_input + (double)cell * cell_width;
+        const double right = left + cell_width;
+        while (fit.segments[first].right <= left)
+            ++first;
+
+        int depth = cell_depth;
+        for (size_t k = first;
+             k < fit.segments.size() && fit.segments[k].left < right; ++k)
+            depth = std::max(depth, fit.segments[k].depth);
+        const size_t num_subcells = (size_t)1 << (depth - cell_depth);
+        const double subcell_width = cell_width / (double)num_subcells;
+
+        packed.cells[cell * record_size] = (float)packed.subcells.size();
+        packed.cells[cell * record_size + 1] = (float)num_subcells;
+        size_t k = first;
+        for (size_t subcell = 0; subcell < num_subcells; ++subcell)
+        {
+            const double centre =
+                left + ((double)subcell + 0.5) * subcell_width;
+            while (fit.segments[k].right < centre)
+                ++k;
+            const auto& segment = fit.segments[k];
+            const double half_width = 0.5 * (segment.right - segment.left);
+            const double middle = segment.left + half_width;
+            auto q = detail::substitute(
+                segment.coefficients, (centre - middle) / half_width,
+                subcell_width / half_width
+            );
+            for (double coefficient : q)
+                packed.subcells.push_back((float)coefficient);
+        }
+    }
+    return packed;
+}
+
+// Largest deviation of the float evaluation from the reference, over
+// num_points evenly spaced inputs
+inline double measureError(
+    const PiecewisePolynomial::Table& table,
+    const std::function<double(double)>& reference, size_t num_points
+)
+{
+    double max_error = 0.0;
+    for (size_t i = 0; i < num_points; ++i)
+    {
+        float x = table.min_input + (table.max_input - table.min_input) *
+                                        (float)i / (float)(num_points - 1);
+        double y = PiecewisePolynomial::process(table, x);
+        max_error = std::max(max_error, std::abs(y - reference(x)));
+    }
+    return max_error;
+}
+
+} // namespace MinimaxFitter
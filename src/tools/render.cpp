@@ -0,0 +1,367 @@
+// Offline render tool
+//
+// Loads a preset XML (as written by PresetManager::savePreset) and pushes DI
+// recordings through PluginAudioProcessor::processBlock faster than real
+// time. Files are spread across worker threads, each owning its own
+// processor instance.
+//
+// Usage:
+//   orbital-render --preset tone.xml --output renders/ [--sample-rate 48000]
+//                  [--block-size 64] [--threads 8] [--bit-depth 24]
+//                  di_1.wav di_2.wav di_folder/ ...
+
+#include "../plugin_audio_processor.h"
+#include <atomic>
+#include <iostream>
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_core/juce_core.h>
+#include <juce_events/juce_events.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct RenderSettings
+{
+    juce::File preset_file;
+    juce::File output_folder;
+    double sample_rate = 48000.0;
+    int block_size = 64;
+    int num_threads = 1;
+    int bit_depth = 24;
+};
+
+struct RenderJob
+{
+    juce::File input;
+    juce::File output;
+};
+
+std::mutex log_mutex;
+
+void log(const juce::String& message)
+{
+    std::lock_guard<std::mutex> lock(log_mutex);
+    std::cout << message << std::endl;
+}
+
+void printUsage()
+{
+    std::cout
+        << "Usage: orbital-render --preset <file.xml> --output <folder>\n"
+           "                      [--sample-rate <hz>] [--block-size <n>]\n"
+           "                      [--threads <n>] [--bit-depth <16|24|32>]\n"
+           "                      <input.wav|folder> ...\n";
+}
+
+bool readInput(
+    const juce::File& file, double sample_rate, juce::AudioBuffer<float>& out,
+    juce::String& error
+)
+{
+    juce::AudioFormatManager format_manager;
+    format_manager.registerBasicFormats();
+
+    std::unique_ptr<juce::AudioFormatReader> reader(
+        format_manager.createReaderFor(file)
+    );
+    if (reader == nullptr)
+    {
+        error = "unsupported or unreadable audio file";
+        return false;
+    }
+
+    const int num_channels = juce::jmin(2, (int)reader->numChannels);
+    const int num_samples = (int)reader->lengthInSamples;
+    juce::AudioBuffer<float> raw(num_channels, num_samples);
+    reader->read(&raw, 0, num_samples, 0, true, num_channels > 1);
+
+    if (juce::approximatelyEqual(reader->sampleRate, sample_rate))
+    {
+        out = std::move(raw);
+        return true;
+    }
+
+    // Bring the DI to the render sample rate
+    const double ratio = reader->sampleRate / sample_rate;
+    const int resampled_length = (int)std::ceil(num_samples / ratio);
+    out.setSize(num_channels, resampled_length);
+    for (int ch = 0; ch < num_channels; ++ch)
+    {
+        juce::LagrangeInterpolator interpolator;
+        interpolator.process(
+            ratio, raw.getReadPointer(ch), out.getWritePointer(ch),
+            resampled_length, num_samples, 0
+        );
+    }
+    return true;
+}
+
+bool writeOutput(
+    const juce::File& file, const juce::AudioBuffer<float>& buffer,
+    const RenderSettings& settings, juce::String& error
+)
+{
+    file.deleteFile();
+    std::unique_ptr<juce::FileOutputStream> stream(file.createOutputStream());
+    if (stream == nullptr)
+    {
+        error = "cannot open output file";
+        return false;
+    }
+
+    juce::WavAudioFormat wav;
+    std::unique_ptr<juce::AudioFormatWriter> writer(wav.createWriterFor(
+        stream.get(), settings.sample_rate,
+        (unsigned int)buffer.getNumChannels(), settings.bit_depth, {}, 0
+    ));
+    if (writer == nullptr)
+    {
+        error = "cannot create wav writer";
+        return false;
+    }
+    // The writer now owns the stream
+    stream.release();
+
+    if (!writer->writeFromAudioSampleBuffer(buffer, 0, buffer.getNumSamples()))
+    {
+        error = "write failed";
+        return false;
+    }
+    return true;
+}
+
+bool renderFile(
+    PluginAudioProcessor& processor, const RenderSettings& settings,
+    const RenderJob& job, juce::String& error
+)
+{
+    juce::AudioBuffer<float> input;
+    if (!readInput(job.input, settings.sample_rate, input, error))
+        return false;
+
+    // Start every file from a clean processor state
+    processor.prepareToPlay(settings.sample_rate, settings.block_size);
+
+    const int num_input_channels = input.getNumChannels();
+    const int input_length = input.getNumSamples();
+    const int tail_length = (int)std::ceil(
+        processor.getTailLengthSeconds() * settings.sample_rate
+    );
+    const int total_length = input_length + tail_length;
+
+    juce::AudioBuffer<float> output(2, total_length);
+    juce::AudioBuffer<float> block(2, settings.block_size);
+    juce::MidiBuffer midi;
+
+    for (int start = 0; start < total_length; start += settings.block_size)
+    {
+        const int num_samples =
+            juce::jmin(settings.block_size, total_length - start);
+        block.setSize(2, num_samples, false, false, true);
+        block.clear();
+
+        const int available =
+            juce::jlimit(0, num_samples, input_length - start);
+        for (int ch = 0; ch < num_input_channels; ++ch)
+            block.copyFrom(ch, 0, input, ch, start, available);
+
+        processor.processBlock(block, midi);
+
+        for (int ch = 0; ch < 2; ++ch)
+            output.copyFrom(ch, start, block, ch, 0, num_samples);
+    }
+
+    processor.releaseResources();
+    return writeOutput(job.output, output, settings, error);
+}
+
+std::unique_ptr<PluginAudioProcessor> createProcessor(
+    const RenderSettings& settings, juce::String& error
+)
+{
+    auto processor = std::make_unique<PluginAudioProcessor>();
+
+    Preset preset;
+    if (!processor->getPresetManager().loadPreset(
+            settings.preset_file, preset
+        ))
+    {
+        error = "cannot load preset " + settings.preset_file.getFullPathName();
+        return nullptr;
+    }
+    processor->getPresetManager().applyPreset(preset);
+
+    processor->setNonRealtime(true);
+    processor->setPlayConfigDetails(
+        2, 2, settings.sample_rate, settings.block_size
+    );
+    return processor;
+}
+
+void collectInputs(
+    const juce::ArgumentList& args, std::vector<juce::File>& inputs
+)
+{
+    for (auto& arg : args.arguments)
+    {
+        auto file = arg.resolveAsFile();
+        if (file.isDirectory())
+        {
+            for (auto& child : file.findChildFiles(
+                     juce::File::findFiles, false, "*.wav;*.aif;*.aiff;*.flac"
+                 ))
+                inputs.push_back(child);
+        }
+        else
+        {
+            inputs.push_back(file);
+        }
+    }
+}
+
+} // namespace
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    // The processor posts to the message queue on construction
+    juce::ScopedJuceInitialiser_GUI juce_initialiser;
+
+    juce::ArgumentList args(argc, argv);
+    if (args.size() == 0 || args.containsOption("--help|-h"))
+    {
+        printUsage();
+        return 0;
+    }
+
+    RenderSettings settings;
+    settings.preset_file = juce::File::getCurrentWorkingDirectory().getChildFile(
+        args.removeValueForOption("--preset|-p")
+    );
+    settings.output_folder =
+        juce::File::getCurrentWorkingDirectory().getChildFile(
+            args.removeValueForOption("--output|-o")
+        );
+
+    auto sample_rate = args.removeValueForOption("--sample-rate|-r");
+    if (sample_rate.isNotEmpty())
+        settings.sample_rate = sample_rate.getDoubleValue();
+    auto block_size = args.removeValueForOption("--block-size|-b");
+    if (block_size.isNotEmpty())
+        settings.block_size = block_size.getIntValue();
+    auto bit_depth = args.removeValueForOption("--bit-depth");
+    if (bit_depth.isNotEmpty())
+        settings.bit_depth = bit_depth.getIntValue();
+    auto threads = args.removeValueForOption("--threads|-j");
+    settings.num_threads = threads.isNotEmpty()
+                               ? threads.getIntValue()
+                               : juce::SystemStats::getNumCpus();
+
+    if (!settings.preset_file.existsAsFile() || settings.sample_rate <= 0.0 ||
+        settings.block_size <= 0 || settings.num_threads <= 0)
+    {
+        printUsage();
+        return 1;
+    }
+
+    std::vector<juce::File> inputs;
+    collectInputs(args, inputs);
+    if (inputs.empty())
+    {
+        std::cerr << "No input files" << std::endl;
+        return 1;
+    }
+
+    if (!settings.output_folder.createDirectory())
+    {
+        std::cerr << "Cannot create output folder "
+                  << settings.output_folder.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    // Inputs with the same name from different folders get a numbered
+    // suffix instead of overwriting each other. Names are compared without
+    // case for the macOS and Windows file systems.
+    std::vector<RenderJob> jobs;
+    juce::StringArray output_paths;
+    auto is_taken = [&](const juce::File& output, const juce::File& input) {
+        return output == input ||
+               output_paths.contains(output.getFullPathName(), true);
+    };
+    for (auto& input : inputs)
+    {
+        const auto name = input.getFileNameWithoutExtension();
+        auto output = settings.output_folder.getChildFile(name + ".wav");
+        if (output == input)
+            output = settings.output_folder.getChildFile(name + "_render.wav");
+        if (is_taken(output, input))
+        {
+            for (int suffix = 2; is_taken(output, input); ++suffix)
+                output = settings.output_folder.getChildFile(
+                    name + "_" + juce::String(suffix) + ".wav"
+                );
+            log("[warn] " + input.getFullPathName() + " renders to " +
+                output.getFileName() + ", its name is already taken");
+        }
+        output_paths.add(output.getFullPathName());
+        jobs.push_back({input, output});
+    }
+
+    // One processor per worker, created up-front on the main thread
+    const int num_workers =
+        juce::jmin(settings.num_threads, (int)jobs.size());
+    std::vector<std::unique_ptr<PluginAudioProcessor>> processors;
+    for (int i = 0; i < num_workers; ++i)
+    {
+        juce::String error;
+        auto processor = createProcessor(settings, error);
+        if (processor == nullptr)
+        {
+            std::cerr << error << std::endl;
+            return 1;
+        }
+        processors.push_back(std::move(processor));
+    }
+
+    std::atomic<size_t> next_job{0};
+    std::atomic<int> num_failures{0};
+    auto start_time = juce::Time::getMillisecondCounterHiRes();
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < num_workers; ++i)
+    {
+        workers.emplace_back(
+            [&, i]()
+            {
+                auto& processor = *processors[(size_t)i];
+                for (size_t j = next_job++; j < jobs.size(); j = next_job++)
+                {
+                    juce::String error;
+                    if (renderFile(processor, settings, jobs[j], error))
+                    {
+                        log("[ok]   " + jobs[j].output.getFullPathName());
+                    }
+                    else
+                    {
+                        ++num_failures;
+                        log("[fail] " + jobs[j].input.getFullPathName() +
+                            ": " + error);
+                    }
+                }
+            }
+        );
+    }
+    for (auto& worker : workers)
+        worker.join();
+
+    auto elapsed = juce::Time::getMillisecondCounterHiRes() - start_time;
+    log("Rendered " + juce::String((int)jobs.size() - num_failures.load()) +
+        "/" + juce::String((int)jobs.size()) + " files in " +
+        juce::String(elapsed / 1000.0, 2) + "s using " +
+        juce::String(num_workers) + " threads");
+
+    return num_failures.load() == 0 ? 0 : 1;
+}
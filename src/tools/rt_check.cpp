@@ -0,0 +1,629 @@
+// Real-time safety checker
+//
+// Hooks operator new/delete, malloc (the libc entry points on Linux, the
+// malloc zones on macOS), mutex locking and file I/O, and reports every call
+// made from inside PluginAudioProcessor::processBlock with a stack trace.
+// The processor is driven through a scripted sweep of every parameter
+// (including bypasses, IR types and the tuner), and the tool exits with an
+// error when anything non real-time safe happened on the audio thread.
+//
+// Usage:
+//   orbital-rtcheck [--sample-rate 48000] [--block-size 64]
+//                   [--max-reports 20]
+
+#include "../plugin_audio_processor.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <fcntl.h>
+#include <iostream>
+#include <new>
+#include <pthread.h>
+#include <unistd.h>
+
+#if defined(__APPLE__)
+#include <mach/mach.h>
+#include <malloc/malloc.h>
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+
+enum Violation
+{
+    allocation = 0,
+    deallocation,
+    mutex_lock,
+    file_io,
+    num_violations
+};
+
+const char* violation_names[num_violations] = {
+    "allocation", "deallocation", "mutex lock", "file I/O"
+};
+
+thread_local bool in_realtime_section = false;
+thread_local bool is_reporting = false;
+
+std::atomic<int> violation_counts[num_violations];
+std::atomic<int> max_reports{20};
+std::atomic<int> num_reports{0};
+
+void writeString(const char* text)
+{
+    auto unused = ::write(STDERR_FILENO, text, std::strlen(text));
+    (void)unused;
+}
+
+// Called from inside the hooks, so it must not allocate or lock itself
+void reportViolation(Violation kind, const char* function)
+{
+    if (!in_realtime_section || is_reporting)
+        return;
+
+    is_reporting = true;
+    violation_counts[kind]++;
+
+    if (num_reports++ < max_reports.load())
+    {
+        writeString("\n[rtcheck] ");
+        writeString(violation_names[kind]);
+        writeString(" on the audio thread: ");
+        writeString(function);
+        writeString("\n");
+
+        void* frames[64];
+        int num_frames = backtrace(frames, 64);
+        backtrace_symbols_fd(frames + 1, num_frames - 1, STDERR_FILENO);
+    }
+    is_reporting = false;
+}
+
+struct ScopedRealtimeSection
+{
+    ScopedRealtimeSection()
+    {
+        in_realtime_section = true;
+    }
+    ~ScopedRealtimeSection()
+    {
+        in_realtime_section = false;
+    }
+};
+
+template <typename Function>
+Function nextSymbol(const char* name)
+{
+    return reinterpret_cast<Function>(dlsym(RTLD_NEXT, name));
+}
+
+} // namespace
+
+//==============================================================================
+// Allocation hooks
+//==============================================================================
+#if defined(__linux__)
+extern "C"
+{
+    void* __libc_malloc(size_t);
+    void* __libc_calloc(size_t, size_t);
+    void* __libc_realloc(void*, size_t);
+    void __libc_free(void*);
+    void* __libc_memalign(size_t, size_t);
+    void* __libc_valloc(size_t);
+
+    void* malloc(size_t size)
+    {
+        reportViolation(allocation, "malloc");
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size)
+    {
+        reportViolation(allocation, "calloc");
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, size_t size)
+    {
+        reportViolation(allocation, "realloc");
+        return __libc_realloc(ptr, size);
+    }
+
+    void free(void* ptr)
+    {
+        if (ptr != nullptr)
+            reportViolation(deallocation, "free");
+        __libc_free(ptr);
+    }
+
+    // The aligned entry points do not go through malloc inside glibc
+    int posix_memalign(void** ptr, size_t alignment, size_t size)
+    {
+        reportViolation(allocation, "posix_memalign");
+        if (alignment % sizeof(void*) != 0 ||
+            (alignment & (alignment - 1)) != 0)
+            return EINVAL;
+        void* result = __libc_memalign(alignment, size);
+        if (result == nullptr)
+            return ENOMEM;
+        *ptr = result;
+        return 0;
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size)
+    {
+        reportViolation(allocation, "aligned_alloc");
+        return __libc_memalign(alignment, size);
+    }
+
+    void* memalign(size_t alignment, size_t size)
+    {
+        reportViolation(allocation, "memalign");
+        return __libc_memalign(alignment, size);
+    }
+
+    void* valloc(size_t size)
+    {
+        reportViolation(allocation, "valloc");
+        return __libc_valloc(size);
+    }
+}
+
+namespace
+{
+// The functions above replace the libc ones when the tool is linked
+void installAllocationHooks()
+{
+}
+} // namespace
+#elif defined(__APPLE__)
+
+// Allocations on macOS go through malloc zones, including those of the
+// system libraries that a malloc defined here would not see, so the hooks
+// swap the function pointers of every registered zone. The zone structures
+// are mapped read-only and are left writable once unprotected.
+namespace
+{
+struct HookedZone
+{
+    malloc_zone_t* zone;
+    malloc_zone_t original;
+};
+
+constexpr unsigned max_hooked_zones = 16;
+HookedZone hooked_zones[max_hooked_zones];
+std::atomic<unsigned> num_hooked_zones{0};
+
+const malloc_zone_t& originalZone(malloc_zone_t* zone)
+{
+    const unsigned count = num_hooked_zones.load();
+    for (unsigned i = 0; i < count; ++i)
+        if (hooked_zones[i].zone == zone)
+            return hooked_zones[i].original;
+    // Only the zones registered below point at the hooks
+    return hooked_zones[0].original;
+}
+
+void* zoneMalloc(malloc_zone_t* zone, size_t size)
+{
+    reportViolation(allocation, "malloc");
+    return originalZone(zone).malloc(zone, size);
+}
+
+void* zoneCalloc(malloc_zone_t* zone, size_t count, size_t size)
+{
+    reportViolation(allocation, "calloc");
+    return originalZone(zone).calloc(zone, count, size);
+}
+
+void* zoneValloc(malloc_zone_t* zone, size_t size)
+{
+    reportViolation(allocation, "valloc");
+    return originalZone(zone).valloc(zone, size);
+}
+
+void* zoneRealloc(malloc_zone_t* zone, void* ptr, size_t size)
+{
+    reportViolation(allocation, "realloc");
+    return originalZone(zone).realloc(zone, ptr, size);
+}
+
+void* zoneMemalign(malloc_zone_t* zone, size_t alignment, size_t size)
+{
+    reportViolation(allocation, "memalign");
+    return originalZone(zone).memalign(zone, alignment, size);
+}
+
+void zoneFree(malloc_zone_t* zone, void* ptr)
+{
+    if (ptr != nullptr)
+        reportViolation(deallocation, "free");
+    originalZone(zone).free(zone, ptr);
+}
+
+void zoneFreeDefiniteSize(malloc_zone_t* zone, void* ptr, size_t size)
+{
+    if (ptr != nullptr)
+        reportViolation(deallocation, "free");
+    originalZone(zone).free_definite_size(zone, ptr, size);
+}
+
+void installAllocationHooks()
+{
+    vm_address_t* zones = nullptr;
+    unsigned num_zones = 0;
+    if (malloc_get_all_zones(mach_task_self(), nullptr, &zones, &num_zones) !=
+        KERN_SUCCESS)
+        return;
+
+    const auto page_size = (uintptr_t)getpagesize();
+    for (unsigned i = 0; i < num_zones; ++i)
+    {
+        const unsigned index = num_hooked_zones.load();
+        if (index == max_hooked_zones)
+            break;
+        auto* zone = reinterpret_cast<malloc_zone_t*>(zones[i]);
+        auto start = reinterpret_cast<uintptr_t>(zone) & ~(page_size - 1);
+        auto end = reinterpret_cast<uintptr_t>(zone + 1);
+        if (mprotect(
+                reinterpret_cast<void*>(start), end - start,
+                PROT_READ | PROT_WRITE
+            ) != 0)
+            continue;
+
+        // The original is registered before the zone points at the hooks
+        hooked_zones[index] = {zone, *zone};
+        num_hooked_zones = index + 1;
+        zone->malloc = zoneMalloc;
+        zone->calloc = zoneCalloc;
+        zone->valloc = zoneValloc;
+        zone->realloc = zoneRealloc;
+        zone->free = zoneFree;
+        if (zone->version >= 5 && zone->memalign != nullptr)
+            zone->memalign = zoneMemalign;
+        if (zone->version >= 6 && zone->free_definite_size != nullptr)
+            zone->free_definite_size = zoneFreeDefiniteSize;
+    }
+}
+} // namespace
+#else
+namespace
+{
+void installAllocationHooks()
+{
+}
+} // namespace
+#endif
+
+namespace
+{
+// Allocates without going through the malloc hook a second time
+void* allocate(size_t size, const char* function)
+{
+    reportViolation(allocation, function);
+    bool was_reporting = is_reporting;
+    is_reporting = true;
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    is_reporting = was_reporting;
+    if (ptr == nullptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* allocateAligned(size_t size, std::align_val_t alignment)
+{
+    reportViolation(allocation, "operator new (aligned)");
+    bool was_reporting = is_reporting;
+    is_reporting = true;
+    void* ptr = nullptr;
+    int result = posix_memalign(
+        &ptr, std::max(sizeof(void*), (size_t)alignment), size == 0 ? 1 : size
+    );
+    is_reporting = was_reporting;
+    if (result != 0)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void deallocate(void* ptr, const char* function)
+{
+    if (ptr == nullptr)
+        return;
+    reportViolation(deallocation, function);
+    bool was_reporting = is_reporting;
+    is_reporting = true;
+    std::free(ptr);
+    is_reporting = was_reporting;
+}
+} // namespace
+
+void* operator new(size_t size)
+{
+    return allocate(size, "operator new");
+}
+void* operator new[](size_t size)
+{
+    return allocate(size, "operator new[]");
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return allocate(size, "operator new");
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return allocate(size, "operator new[]");
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+    return allocateAligned(size, alignment);
+}
+void operator delete(void* ptr) noexcept
+{
+    deallocate(ptr, "operator delete");
+}
+void operator delete[](void* ptr) noexcept
+{
+    deallocate(ptr, "operator delete[]");
+}
+void operator delete(void* ptr, size_t) noexcept
+{
+    deallocate(ptr, "operator delete");
+}
+void operator delete[](void* ptr, size_t) noexcept
+{
+    deallocate(ptr, "operator delete[]");
+}
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    deallocate(ptr, "operator delete (aligned)");
+}
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    deallocate(ptr, "operator delete[] (aligned)");
+}
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+    deallocate(ptr, "operator delete (aligned)");
+}
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept
+{
+    deallocate(ptr, "operator delete[] (aligned)");
+}
+
+//==============================================================================
+// Lock and file I/O hooks
+//==============================================================================
+extern "C"
+{
+    int pthread_mutex_lock(pthread_mutex_t* mutex)
+    {
+        static auto next =
+            nextSymbol<int (*)(pthread_mutex_t*)>("pthread_mutex_lock");
+        reportViolation(mutex_lock, "pthread_mutex_lock");
+        return next(mutex);
+    }
+
+    int open(const char* path, int flags, ...)
+    {
+        static auto next = nextSymbol<int (*)(const char*, int, ...)>("open");
+        reportViolation(file_io, "open");
+        mode_t mode = 0;
+        if ((flags & O_CREAT) != 0)
+        {
+            va_list args;
+            va_start(args, flags);
+            mode = (mode_t)va_arg(args, int);
+            va_end(args);
+        }
+        return next(path, flags, mode);
+    }
+
+    FILE* fopen(const char* path, const char* mode)
+    {
+        static auto next =
+            nextSymbol<FILE* (*)(const char*, const char*)>("fopen");
+        reportViolation(file_io, "fopen");
+        return next(path, mode);
+    }
+
+    ssize_t read(int fd, void* data, size_t size)
+    {
+        static auto next = nextSymbol<ssize_t (*)(int, void*, size_t)>("read");
+        reportViolation(file_io, "read");
+        return next(fd, data, size);
+    }
+
+    ssize_t write(int fd, const void* data, size_t size)
+    {
+        static auto next =
+            nextSymbol<ssize_t (*)(int, const void*, size_t)>("write");
+        reportViolation(file_io, "write");
+        return next(fd, data, size);
+    }
+
+    size_t fwrite(const void* data, size_t size, size_t count, FILE* stream)
+    {
+        static auto next =
+            nextSymbol<size_t (*)(const void*, size_t, size_t, FILE*)>(
+                "fwrite"
+            );
+        reportViolation(file_io, "fwrite");
+        return next(data, size, count, stream);
+    }
+
+    int fflush(FILE* stream)
+    {
+        static auto next = nextSymbol<int (*)(FILE*)>("fflush");
+        reportViolation(file_io, "fflush");
+        return next(stream);
+    }
+}
+
+//==============================================================================
+// Scripted parameter sweep
+//==============================================================================
+namespace
+{
+
+struct Harness
+{
+    PluginAudioProcessor& processor;
+    juce::AudioBuffer<float> buffer;
+    juce::MidiBuffer midi;
+    double sample_rate;
+    int64_t position = 0;
+
+    void fillInput()
+    {
+        // Decaying 41Hz pluck repeated twice a second
+        for (int i = 0; i < buffer.getNumSamples(); ++i, ++position)
+        {
+            double t = (double)(position % (int64_t)(sample_rate / 2)) /
+                       sample_rate;
+            double phase = juce::MathConstants<double>::twoPi * 41.2 * t;
+            buffer.setSample(
+                0, i, (float)(0.5 * std::exp(-4.0 * t) * std::sin(phase))
+            );
+            buffer.setSample(1, i, 0.0f);
+        }
+    }
+
+    void processBlocks(int num_blocks)
+    {
+        for (int i = 0; i < num_blocks; ++i)
+        {
+            fillInput();
+            ScopedRealtimeSection realtime;
+            processor.processBlock(buffer, midi);
+        }
+    }
+};
+
+void runSweep(Harness& harness)
+{
+    auto& processor = harness.processor;
+    const float steps[] = {0.0f, 0.25f, 0.5f, 0.75f, 1.0f};
+
+    harness.processBlocks(32);
+
+    // Jump every parameter through its range
+    for (auto* parameter : processor.getParameters())
+    {
+        float default_value = parameter->getDefaultValue();
+        for (float step : steps)
+        {
+            parameter->setValueNotifyingHost(step);
+            harness.processBlocks(4);
+        }
+        parameter->setValueNotifyingHost(default_value);
+        harness.processBlocks(4);
+    }
+
+    // Automation bursts: a new value before every block
+    for (auto* parameter : processor.getParameters())
+    {
+        float default_value = parameter->getDefaultValue();
+        for (int i = 0; i <= 32; ++i)
+        {
+            parameter->setValueNotifyingHost((float)i / 32.0f);
+            harness.processBlocks(1);
+        }
+        parameter->setValueNotifyingHost(default_value);
+    }
+
+    // Tuner path
+    processor.setTunerBypass(false);
+    harness.processBlocks(256);
+    processor.setTunerBypass(true);
+    harness.processBlocks(32);
+}
+
+} // namespace
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juce_initialiser;
+    juce::ArgumentList args(argc, argv);
+
+    double sample_rate = 48000.0;
+    int block_size = 64;
+    auto sample_rate_arg = args.removeValueForOption("--sample-rate|-r");
+    if (sample_rate_arg.isNotEmpty())
+        sample_rate = sample_rate_arg.getDoubleValue();
+    auto block_size_arg = args.removeValueForOption("--block-size|-b");
+    if (block_size_arg.isNotEmpty())
+        block_size = block_size_arg.getIntValue();
+    auto max_reports_arg = args.removeValueForOption("--max-reports");
+    if (max_reports_arg.isNotEmpty())
+        max_reports = max_reports_arg.getIntValue();
+
+    if (sample_rate <= 0.0 || block_size <= 0)
+    {
+        std::cerr << "Invalid sample rate or block size" << std::endl;
+        return 1;
+    }
+
+    // backtrace() loads its unwinder lazily, do it before checking starts
+    void* frames[4];
+    backtrace(frames, 4);
+    installAllocationHooks();
+
+    PluginAudioProcessor processor;
+    processor.setPlayConfigDetails(2, 2, sample_rate, block_size);
+    processor.prepareToPlay(sample_rate, block_size);
+
+    Harness harness{
+        processor, juce::AudioBuffer<float>(2, block_size), {}, sample_rate
+    };
+    runSweep(harness);
+    processor.releaseResources();
+
+    int total = 0;
+    std::cout << "\nReal-time safety report (" << block_size << " samples @ "
+              << sample_rate << " Hz)" << std::endl;
+    for (int kind = 0; kind < num_violations; ++kind)
+    {
+        int count = violation_counts[kind].load();
+        total += count;
+        std::cout << "  " << violation_names[kind] << ": " << count
+                  << std::endl;
+    }
+
+    if (total > 0)
+    {
+        std::cout << "FAILED: " << total
+                  << " non real-time safe calls inside processBlock"
+                  << std::endl;
+        return 1;
+    }
+    std::cout << "OK" << std::endl;
+    return 0;
+}